@@ -0,0 +1,232 @@
+// allocbench_churn.m.cpp                                             -*-C++-*-
+
+// This program measures the cost of repeatedly creating, filling, and
+// destroying containers whose memory comes from each benchmarked allocator
+// (the "container churn" benchmark of N4468 and P0089).  For each container
+// type and each container size of 2^e elements, 'e' in { 4, 8, 12, 16 } (but
+// not exceeding the scale), a container is created, filled, and destroyed
+// 2^(scale - e) times, so that every measurement inserts 2^scale elements in
+// total.  After each container is gone, a managed allocator is released.
+//
+// Each measurement is made in up to two modes:
+//: o 'destroy': the container is destroyed before its allocator is released.
+//:
+//: o 'wink': the container is not destroyed; its memory is reclaimed only by
+//:   releasing its allocator (measured only for managed allocators).
+//
+// See 'allocbench_util.h' for the format of the output.
+
+#include <allocbench_util.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+#include <new>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef allocbench::AllocatorKind   AllocatorKind;
+typedef allocbench::AllocatorHolder AllocatorHolder;
+typedef bsls::Types::Int64          Int64;
+
+const char k_BENCHMARK[] = "churn";
+
+const char k_TEXT[] = "a string too long for the short-string buffer";
+
+enum {
+    k_MIN_EXPONENT  = 4,  // log2 of the smallest container size
+    k_MAX_EXPONENT  = 16, // log2 of the largest container size
+    k_EXPONENT_STEP = 4   // step between successive container sizes
+};
+
+Int64 fill(bsl::vector<int> *container, int numElements)
+    // Append the specified 'numElements' values to the specified 'container'
+    // and return a checksum of the result.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+    return container->back();
+}
+
+Int64 fill(bsl::list<int> *container, int numElements)
+    // Append the specified 'numElements' values to the specified 'container'
+    // and return a checksum of the result.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+    return container->back();
+}
+
+Int64 fill(bsl::unordered_set<int> *container, int numElements)
+    // Insert the specified 'numElements' distinct values into the specified
+    // 'container' and return a checksum of the result.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->insert(i * 7919);
+    }
+    return static_cast<Int64>(container->bucket_count());
+}
+
+Int64 fill(bsl::vector<bsl::string> *container, int numElements)
+    // Append the specified 'numElements' strings, each too long to be stored
+    // without allocating, to the specified 'container' and return a checksum
+    // of the result.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->emplace_back(k_TEXT);
+    }
+    return static_cast<Int64>(container->back().size());
+}
+
+template <class CONTAINER>
+Int64 churn(AllocatorHolder *holder,
+            bool             wink,
+            int              numElements,
+            Int64            numIterations)
+    // Create, fill with the specified 'numElements' elements, and dispose of
+    // a 'CONTAINER' using the allocator held by the specified 'holder' the
+    // specified 'numIterations' times, and return a checksum of the work.
+    // Dispose of each container by destroying it and then releasing the
+    // allocator if the specified 'wink' is 'false', and only by releasing
+    // the allocator otherwise.  The behavior is undefined if 'wink' is 'true'
+    // unless 'holder->isManaged()'.
+{
+    Int64 checksum = 0;
+
+    for (Int64 i = 0; i < numIterations; ++i) {
+        if (wink) {
+            bsls::ObjectBuffer<CONTAINER> buffer;
+            new (buffer.buffer()) CONTAINER(holder->allocator());
+            checksum += fill(&buffer.object(), numElements);
+        }
+        else {
+            CONTAINER container(holder->allocator());
+            checksum += fill(&container, numElements);
+        }
+        holder->release();
+    }
+    return checksum;
+}
+
+template <class CONTAINER>
+void runWorkload(allocbench::ResultWriter         *writer,
+                 const allocbench::CounterReader&  reader,
+                 const char                       *workload,
+                 const allocbench::Options&        options)
+    // Measure the churn of 'CONTAINER' objects, identified in the output by
+    // the specified 'workload', for each of the allocators selected by the
+    // specified 'options', using the specified 'reader', and write the
+    // results to the specified 'writer'.
+{
+    for (int e = k_MIN_EXPONENT;
+         e <= k_MAX_EXPONENT && e <= options.d_scale;
+         e += k_EXPONENT_STEP) {
+        const int   numElements   = 1 << e;
+        const Int64 numIterations = 1LL << (options.d_scale - e);
+
+        for (int k = 0; k < AllocatorKind::k_NUM_KINDS; ++k) {
+            const AllocatorKind::Enum kind =
+                                           static_cast<AllocatorKind::Enum>(k);
+
+            if (!options.isSelected(kind)) {
+                continue;
+            }
+
+            for (int wink = 0; wink < 2; ++wink) {
+                AllocatorHolder holder(kind);
+
+                if (wink && !holder.isManaged()) {
+                    continue;
+                }
+
+                const allocbench::Sample before = reader.sample();
+                const Int64 checksum = churn<CONTAINER>(&holder,
+                                                        wink,
+                                                        numElements,
+                                                        numIterations);
+                const allocbench::Sample after  = reader.sample();
+
+                const allocbench::Result result = {
+                    k_BENCHMARK,
+                    workload,
+                    kind,
+                    wink ? "wink" : "destroy",
+                    1,
+                    numElements,
+                    numIterations,
+                    after - before,
+                    checksum
+                };
+                writer->write(result);
+            }
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    allocbench::Options options = {
+        20,                                    // scale
+        (1 << AllocatorKind::k_NUM_KINDS) - 1, // every allocator
+        1                                      // threads (unused)
+    };
+
+    if (0 != allocbench::Options::parse(
+                     &options,
+                     argc,
+                     argv,
+                     "Create, fill, and destroy containers repeatedly, with "
+                     "2^scale elements in all.")) {
+        return 1;                                                     // RETURN
+    }
+
+    allocbench::CounterReader reader;
+    allocbench::ResultWriter  writer(&bsl::cout);
+
+    runWorkload<bsl::vector<int> >(&writer, reader, "vector_int", options);
+    runWorkload<bsl::list<int> >(&writer, reader, "list_int", options);
+    runWorkload<bsl::unordered_set<int> >(&writer,
+                                          reader,
+                                          "unordered_set_int",
+                                          options);
+    runWorkload<bsl::vector<bsl::string> >(&writer,
+                                           reader,
+                                           "vector_string",
+                                           options);
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,256 @@
+// allocbench_locality.m.cpp                                          -*-C++-*-
+
+// This program measures how the placement of memory by each benchmarked
+// allocator affects the cost of accessing it later (the "locality" and
+// "diffusion" benchmarks of P0089).  For each list size of 2^e nodes, 'e' in
+// { 8, 12, 16 } (but not exceeding the scale), 2^(scale - e) lists of 'int'
+// are built by appending to each list in turn, so that 2^scale nodes exist in
+// all, and then:
+//: 1 'build': the lists are built (one iteration per list).
+//:
+//: 2 'access': every node of every list is visited, 8 times (8 iterations).
+//:
+//: 3 'age': 2^scale times, the first node of a randomly chosen list is moved
+//:    to the end of another randomly chosen list, scattering the nodes of
+//:    each list through memory (2^scale iterations).
+//:
+//: 4 'accessAged': as 'access', after aging.
+//
+// Each phase is measured in up to two modes:
+//: o 'shared': one allocator supplies every list.
+//:
+//: o 'perList': each list has its own allocator (not measured for
+//:   'newdelete', for which it is the same as 'shared').
+//
+// See 'allocbench_util.h' for the format of the output.
+
+#include <allocbench_util.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef allocbench::AllocatorKind   AllocatorKind;
+typedef allocbench::AllocatorHolder AllocatorHolder;
+typedef bsls::Types::Int64          Int64;
+typedef bsl::list<int>              List;
+
+const char k_BENCHMARK[] = "locality";
+
+enum {
+    k_MIN_EXPONENT  = 8,   // log2 of the smallest list size
+    k_MAX_EXPONENT  = 16,  // log2 of the largest list size
+    k_EXPONENT_STEP = 4,   // step between successive list sizes
+    k_NUM_PASSES    = 8    // number of visits of each node when accessing
+};
+
+class Random {
+    // This class provides a fast, deterministic pseudo-random number
+    // generator (xorshift64), so that every allocator sees the same sequence
+    // of operations.
+
+    // DATA
+    bsls::Types::Uint64 d_state;  // current state (never 0)
+
+  public:
+    // CREATORS
+    Random()
+        // Create a generator with a fixed seed.
+    : d_state(0x9E3779B97F4A7C15ULL)
+    {
+    }
+
+    // MANIPULATORS
+    int next(int limit)
+        // Return a pseudo-random value in the range '[0 .. limit)'.  The
+        // behavior is undefined unless '0 < limit'.
+    {
+        d_state ^= d_state << 13;
+        d_state ^= d_state >> 7;
+        d_state ^= d_state << 17;
+        return static_cast<int>(d_state % static_cast<unsigned>(limit));
+    }
+};
+
+Int64 access(const bsl::vector<List *>& lists)
+    // Visit every node of each of the specified 'lists' 'k_NUM_PASSES' times
+    // and return the sum of their values.
+{
+    Int64 sum = 0;
+
+    for (int pass = 0; pass < k_NUM_PASSES; ++pass) {
+        for (bsl::size_t i = 0; i < lists.size(); ++i) {
+            const List& list = *lists[i];
+            for (List::const_iterator it = list.begin();
+                 it != list.end();
+                 ++it) {
+                sum += *it;
+            }
+        }
+    }
+    return sum;
+}
+
+void measure(allocbench::ResultWriter         *writer,
+             const allocbench::CounterReader&  reader,
+             AllocatorKind::Enum               kind,
+             bool                              perList,
+             int                               numNodes,
+             int                               numLists)
+    // Build the specified 'numLists' lists of the specified 'numNodes' nodes
+    // each, with memory from allocators of the specified 'kind', one for
+    // each list if the specified 'perList' is 'true' and one for all of them
+    // otherwise, then measure each phase of the benchmark on them using the
+    // specified 'reader', and write the results to the specified 'writer'.
+{
+    const char *mode = perList ? "perList" : "shared";
+
+    bsl::vector<AllocatorHolder *> holders;
+    bsl::vector<List *>            lists;
+
+    holders.push_back(new AllocatorHolder(kind));
+    for (int i = 0; i < numLists; ++i) {
+        if (perList && 0 < i) {
+            holders.push_back(new AllocatorHolder(kind));
+        }
+        lists.push_back(new List(holders.back()->allocator()));
+    }
+
+    allocbench::Result result = {
+        k_BENCHMARK,
+        "build",
+        kind,
+        mode,
+        1,
+        numNodes,
+        numLists,
+        { 0, 0, 0 },
+        0
+    };
+
+    allocbench::Sample before = reader.sample();
+    for (int n = 0; n < numNodes; ++n) {
+        for (int i = 0; i < numLists; ++i) {
+            lists[i]->push_back(n);
+        }
+    }
+    result.d_counters = reader.sample() - before;
+    result.d_checksum = lists.back()->back();
+    writer->write(result);
+
+    result.d_workload   = "access";
+    result.d_iterations = k_NUM_PASSES;
+    before              = reader.sample();
+    result.d_checksum   = access(lists);
+    result.d_counters   = reader.sample() - before;
+    writer->write(result);
+
+    const Int64 numMoves = static_cast<Int64>(numNodes) * numLists;
+    Random      random;
+
+    result.d_workload   = "age";
+    result.d_iterations = numMoves;
+    result.d_checksum   = 0;
+    before              = reader.sample();
+    for (Int64 m = 0; m < numMoves; ++m) {
+        List& from = *lists[random.next(numLists)];
+        List& to   = *lists[random.next(numLists)];
+
+        if (!from.empty()) {
+            const int value = from.front();
+            from.pop_front();
+            to.push_back(value);
+            result.d_checksum += value;
+        }
+    }
+    result.d_counters = reader.sample() - before;
+    writer->write(result);
+
+    result.d_workload   = "accessAged";
+    result.d_iterations = k_NUM_PASSES;
+    before              = reader.sample();
+    result.d_checksum   = access(lists);
+    result.d_counters   = reader.sample() - before;
+    writer->write(result);
+
+    for (bsl::size_t i = 0; i < lists.size(); ++i) {
+        delete lists[i];
+    }
+    for (bsl::size_t i = 0; i < holders.size(); ++i) {
+        delete holders[i];
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    allocbench::Options options = {
+        20,                                    // scale
+        (1 << AllocatorKind::k_NUM_KINDS) - 1, // every allocator
+        1                                      // threads (unused)
+    };
+
+    if (0 != allocbench::Options::parse(
+                      &options,
+                      argc,
+                      argv,
+                      "Build, access, and age lists, with 2^scale nodes in "
+                      "all.")) {
+        return 1;                                                     // RETURN
+    }
+
+    allocbench::CounterReader reader;
+    allocbench::ResultWriter  writer(&bsl::cout);
+
+    for (int e = k_MIN_EXPONENT;
+         e <= k_MAX_EXPONENT && e <= options.d_scale;
+         e += k_EXPONENT_STEP) {
+        for (int k = 0; k < AllocatorKind::k_NUM_KINDS; ++k) {
+            const AllocatorKind::Enum kind =
+                                           static_cast<AllocatorKind::Enum>(k);
+
+            if (!options.isSelected(kind)) {
+                continue;
+            }
+
+            const int numNodes = 1 << e;
+            const int numLists = 1 << (options.d_scale - e);
+
+            measure(&writer, reader, kind, false, numNodes, numLists);
+
+            if (AllocatorKind::e_NEW_DELETE != kind) {
+                measure(&writer, reader, kind, true, numNodes, numLists);
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
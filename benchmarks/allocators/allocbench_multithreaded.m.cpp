@@ -0,0 +1,264 @@
+// allocbench_multithreaded.m.cpp                                     -*-C++-*-
+
+// This program measures how the cost of container churn (see
+// 'allocbench_churn.m.cpp') with each benchmarked allocator scales with the
+// number of threads (the "multithreaded" benchmark of P0089).  For each
+// number of threads from 1, doubling up to the maximum, every thread creates,
+// fills with 2^8 elements, and destroys a container 2^(scale - 8) times, and
+// the wall time from the start of the first thread to the end of the last is
+// measured, so that perfect scaling shows as constant time.
+//
+// Each workload is measured in up to two modes:
+//: o 'perThread': each thread has its own allocator, which is released after
+//:   each container is destroyed.
+//:
+//: o 'shared': one allocator supplies every thread, and is released only at
+//:   the end (measured only for thread-safe allocators).
+//
+// See 'allocbench_util.h' for the format of the output.
+
+#include <allocbench_util.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+typedef allocbench::AllocatorKind   AllocatorKind;
+typedef allocbench::AllocatorHolder AllocatorHolder;
+typedef bsls::Types::Int64          Int64;
+
+const char k_BENCHMARK[] = "multithreaded";
+
+const char k_TEXT[] = "a string too long for the short-string buffer";
+
+enum {
+    k_EXPONENT = 8  // log2 of the number of elements of each container
+};
+
+enum Workload {
+    e_LIST_INT,
+    e_VECTOR_STRING
+};
+
+const char *const k_WORKLOAD_NAMES[] = { "list_int", "vector_string" };
+
+struct ThreadArgs {
+    // This 'struct' describes the work of one thread.
+
+    bslmt::Barrier   *d_barrier_p;    // barrier at which all threads start
+
+    AllocatorHolder  *d_holder_p;     // supplier of memory
+
+    bool              d_release;      // release the allocator after each
+                                      // container if 'true'
+
+    Workload          d_workload;     // containers to churn
+
+    Int64             d_iterations;   // number of containers to churn
+
+    Int64             d_checksum;     // result of the thread
+};
+
+extern "C" void *churnThread(void *arg)
+    // Churn containers as described by the 'ThreadArgs' addressed by the
+    // specified 'arg', after waiting at its barrier, and store a checksum of
+    // the work in that 'ThreadArgs'.
+{
+    ThreadArgs&       args      = *static_cast<ThreadArgs *>(arg);
+    bslma::Allocator *allocator = args.d_holder_p->allocator();
+    Int64             checksum  = 0;
+
+    args.d_barrier_p->wait();
+
+    for (Int64 i = 0; i < args.d_iterations; ++i) {
+        if (e_LIST_INT == args.d_workload) {
+            bsl::list<int> container(allocator);
+            for (int n = 0; n < 1 << k_EXPONENT; ++n) {
+                container.push_back(n);
+            }
+            checksum += container.back();
+        }
+        else {
+            bsl::vector<bsl::string> container(allocator);
+            for (int n = 0; n < 1 << k_EXPONENT; ++n) {
+                container.emplace_back(k_TEXT);
+            }
+            checksum += static_cast<Int64>(container.back().size());
+        }
+
+        if (args.d_release) {
+            args.d_holder_p->release();
+        }
+    }
+
+    args.d_checksum = checksum;
+    return 0;
+}
+
+void measure(allocbench::ResultWriter         *writer,
+             const allocbench::CounterReader&  reader,
+             Workload                          workload,
+             AllocatorKind::Enum               kind,
+             bool                              shared,
+             int                               numThreads,
+             Int64                             numIterations)
+    // Run the specified 'workload' the specified 'numIterations' times in
+    // each of the specified 'numThreads' threads, with memory from
+    // allocators of the specified 'kind', one shared by all threads if the
+    // specified 'shared' is 'true' and one per thread otherwise, measuring
+    // with the specified 'reader', and write the result to the specified
+    // 'writer'.
+{
+    bslmt::Barrier                         barrier(numThreads + 1);
+    bsl::vector<AllocatorHolder *>         holders;
+    bsl::vector<ThreadArgs>                args(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+
+    for (int i = 0; i < numThreads; ++i) {
+        if (!shared || 0 == i) {
+            holders.push_back(new AllocatorHolder(kind));
+        }
+
+        ThreadArgs& arg  = args[i];
+        arg.d_barrier_p  = &barrier;
+        arg.d_holder_p   = holders.back();
+        arg.d_release    = !shared;
+        arg.d_workload   = workload;
+        arg.d_iterations = numIterations;
+        arg.d_checksum   = 0;
+
+        if (0 != bslmt::ThreadUtil::create(&handles[i], churnThread, &arg)) {
+            bsl::cerr << "Failed to create thread " << i << bsl::endl;
+            bsl::exit(1);
+        }
+    }
+
+    const allocbench::Sample before = reader.sample();
+    barrier.wait();
+
+    Int64 checksum = 0;
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+        checksum += args[i].d_checksum;
+    }
+    const allocbench::Sample after  = reader.sample();
+
+    const allocbench::Result result = {
+        k_BENCHMARK,
+        k_WORKLOAD_NAMES[workload],
+        kind,
+        shared ? "shared" : "perThread",
+        numThreads,
+        1 << k_EXPONENT,
+        numIterations,
+        after - before,
+        checksum
+    };
+    writer->write(result);
+
+    for (bsl::size_t i = 0; i < holders.size(); ++i) {
+        delete holders[i];
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    allocbench::Options options = {
+        18,                                                    // scale
+        (1 << AllocatorKind::k_NUM_KINDS) - 1,                 // every
+                                                               // allocator
+        static_cast<int>(bslmt::ThreadUtil::hardwareConcurrency())
+                                                               // threads
+    };
+    if (options.d_maxThreads < 1) {
+        options.d_maxThreads = 1;
+    }
+
+    if (0 != allocbench::Options::parse(
+                    &options,
+                    argc,
+                    argv,
+                    "Churn containers in each of 1, 2, 4, ... threads, with "
+                    "2^scale elements per thread.")) {
+        return 1;                                                     // RETURN
+    }
+
+    if (options.d_scale < k_EXPONENT) {
+        options.d_scale = k_EXPONENT;
+    }
+    const Int64 numIterations = 1LL << (options.d_scale - k_EXPONENT);
+
+    allocbench::CounterReader reader;
+    allocbench::ResultWriter  writer(&bsl::cout);
+
+    for (int w = e_LIST_INT; w <= e_VECTOR_STRING; ++w) {
+        const Workload workload = static_cast<Workload>(w);
+
+        for (int numThreads = 1;
+             numThreads <= options.d_maxThreads;
+             numThreads *= 2) {
+            for (int k = 0; k < AllocatorKind::k_NUM_KINDS; ++k) {
+                const AllocatorKind::Enum kind =
+                                           static_cast<AllocatorKind::Enum>(k);
+
+                if (!options.isSelected(kind)) {
+                    continue;
+                }
+
+                measure(&writer,
+                        reader,
+                        workload,
+                        kind,
+                        false,
+                        numThreads,
+                        numIterations);
+
+                if (AllocatorKind::isThreadSafe(kind)) {
+                    measure(&writer,
+                            reader,
+                            workload,
+                            kind,
+                            true,
+                            numThreads,
+                            numIterations);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,353 @@
+// allocbench_util.cpp                                                -*-C++-*-
+#include <allocbench_util.h>
+
+#include <bdlma_bufferedsequentialallocator.h>
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_newdeleteallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+  #include <sys/resource.h>         // 'getrusage'
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+  #include <linux/perf_event.h>     // 'perf_event_attr'
+  #include <sys/syscall.h>          // 'SYS_perf_event_open'
+  #include <unistd.h>               // 'close', 'read', 'syscall'
+#endif
+
+namespace BloombergLP {
+namespace allocbench {
+
+namespace {
+
+const char *const k_NAMES[AllocatorKind::k_NUM_KINDS] = {
+    "newdelete",
+    "sequential",
+    "multipool",
+    "concurrentmultipool",
+    "bufferedsequential",
+    "localsequential"
+};
+
+bsls::Types::Int64 difference(bsls::Types::Int64 lhs, bsls::Types::Int64 rhs)
+    // Return the difference between the specified 'lhs' and 'rhs' counter
+    // values, or -1 if either is -1.
+{
+    return 0 <= lhs && 0 <= rhs ? lhs - rhs : -1;
+}
+
+void printUsage(const char *program, const char *description)
+    // Write the usage message of the specified 'program', having the
+    // specified 'description', to 'bsl::cerr'.
+{
+    bsl::cerr << "usage: " << program << " [--scale=<n>]"
+              << " [--allocator=<name>]... [--threads=<n>]\n\n"
+              << description << "\n\n"
+              << "  --scale=<n>         log2 of the amount of work of each"
+              << " measurement\n"
+              << "  --allocator=<name>  benchmark only the named allocator"
+              << " (repeatable):\n"
+              << "                      ";
+    for (int i = 0; i < AllocatorKind::k_NUM_KINDS; ++i) {
+        bsl::cerr << (i ? ", " : "") << k_NAMES[i];
+    }
+    bsl::cerr << "\n"
+              << "  --threads=<n>       maximum number of threads\n";
+}
+
+int parseInt(int *result, const char *string)
+    // Load into the specified 'result' the positive decimal integer in the
+    // specified 'string'.  Return 0 on success, and a non-zero value
+    // otherwise.
+{
+    char *end;
+    long  value = bsl::strtol(string, &end, 10);
+
+    if (end == string || '\0' != *end || value <= 0 || 1024 * 1024 < value) {
+        return -1;                                                    // RETURN
+    }
+    *result = static_cast<int>(value);
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // struct AllocatorKind
+                            // --------------------
+
+// CLASS METHODS
+int AllocatorKind::fromAscii(Enum *result, const char *string)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(string);
+
+    for (int i = 0; i < k_NUM_KINDS; ++i) {
+        if (0 == bsl::strcmp(string, k_NAMES[i])) {
+            *result = static_cast<Enum>(i);
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+bool AllocatorKind::isThreadSafe(Enum value)
+{
+    return e_NEW_DELETE == value || e_CONCURRENT_MULTIPOOL == value;
+}
+
+const char *AllocatorKind::toAscii(Enum value)
+{
+    BSLS_ASSERT(0 <= value && static_cast<int>(value) < k_NUM_KINDS);
+
+    return k_NAMES[value];
+}
+
+                           // ---------------------
+                           // class AllocatorHolder
+                           // ---------------------
+
+// CREATORS
+AllocatorHolder::AllocatorHolder(AllocatorKind::Enum kind)
+: d_kind(kind)
+, d_allocator_p(0)
+, d_managed_p(0)
+{
+    bslma::Allocator *upstream = &bslma::NewDeleteAllocator::singleton();
+
+    switch (kind) {
+      case AllocatorKind::e_NEW_DELETE: {
+        d_allocator_p = upstream;
+      } break;
+      case AllocatorKind::e_SEQUENTIAL: {
+        d_managed_p = new bdlma::SequentialAllocator(upstream);
+      } break;
+      case AllocatorKind::e_MULTIPOOL: {
+        d_managed_p = new bdlma::MultipoolAllocator(upstream);
+      } break;
+      case AllocatorKind::e_CONCURRENT_MULTIPOOL: {
+        d_managed_p = new bdlma::ConcurrentMultipoolAllocator(upstream);
+      } break;
+      case AllocatorKind::e_BUFFERED_SEQUENTIAL: {
+        d_managed_p = new bdlma::BufferedSequentialAllocator(
+                                                           d_buffer.buffer(),
+                                                           k_BUFFER_SIZE,
+                                                           upstream);
+      } break;
+      case AllocatorKind::e_LOCAL_SEQUENTIAL: {
+        d_managed_p =
+                  new bdlma::LocalSequentialAllocator<k_BUFFER_SIZE>(upstream);
+      } break;
+      default: {
+        BSLS_ASSERT_INVOKE_NORETURN("Unknown allocator kind");
+      }
+    }
+
+    if (d_managed_p) {
+        d_allocator_p = d_managed_p;
+    }
+}
+
+AllocatorHolder::~AllocatorHolder()
+{
+    delete d_managed_p;
+}
+
+// MANIPULATORS
+void AllocatorHolder::release()
+{
+    if (d_managed_p) {
+        d_managed_p->release();
+    }
+}
+
+                                // -------------
+                                // struct Sample
+                                // -------------
+
+Sample operator-(const Sample& lhs, const Sample& rhs)
+{
+    Sample result;
+
+    result.d_nanoseconds = lhs.d_nanoseconds - rhs.d_nanoseconds;
+    result.d_minorFaults = difference(lhs.d_minorFaults, rhs.d_minorFaults);
+    result.d_tlbMisses   = difference(lhs.d_tlbMisses,   rhs.d_tlbMisses);
+
+    return result;
+}
+
+                            // -------------------
+                            // class CounterReader
+                            // -------------------
+
+// CREATORS
+CounterReader::CounterReader()
+: d_tlbFd(-1)
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_perf_event_open)
+    perf_event_attr attr;
+    bsl::memset(&attr, 0, sizeof attr);
+    attr.type           = PERF_TYPE_HW_CACHE;
+    attr.size           = sizeof attr;
+    attr.config         = PERF_COUNT_HW_CACHE_DTLB
+                        | PERF_COUNT_HW_CACHE_OP_READ << 8
+                        | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.inherit        = 1;  // count the threads created later
+
+    d_tlbFd = static_cast<int>(syscall(SYS_perf_event_open,
+                                       &attr,
+                                       0,      // calling thread
+                                       -1,     // any processor
+                                       -1,     // no group
+                                       0UL));
+#endif
+}
+
+CounterReader::~CounterReader()
+{
+#ifdef BSLS_PLATFORM_OS_LINUX
+    if (0 <= d_tlbFd) {
+        close(d_tlbFd);
+    }
+#endif
+}
+
+// ACCESSORS
+Sample CounterReader::sample() const
+{
+    Sample result = { bsls::TimeUtil::getTimer(), -1, -1 };
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+    struct rusage usage;
+    if (0 == getrusage(RUSAGE_SELF, &usage)) {
+        result.d_minorFaults = usage.ru_minflt;
+    }
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    long long count;
+    if (0 <= d_tlbFd
+     && static_cast<ssize_t>(sizeof count) ==
+                                         read(d_tlbFd, &count, sizeof count)) {
+        result.d_tlbMisses = count;
+    }
+#endif
+
+    return result;
+}
+
+                            // ------------------
+                            // class ResultWriter
+                            // ------------------
+
+// CREATORS
+ResultWriter::ResultWriter(bsl::ostream *stream)
+: d_stream_p(stream)
+{
+    BSLS_ASSERT(stream);
+
+    *d_stream_p << "benchmark,workload,allocator,mode,threads,elements,"
+                << "iterations,seconds,minorFaults,dtlbMisses,checksum"
+                << bsl::endl;
+}
+
+// MANIPULATORS
+void ResultWriter::write(const Result& result)
+{
+    *d_stream_p << result.d_benchmark
+                << ',' << result.d_workload
+                << ',' << AllocatorKind::toAscii(result.d_allocator)
+                << ',' << result.d_mode
+                << ',' << result.d_numThreads
+                << ',' << result.d_elements
+                << ',' << result.d_iterations
+                << ',' << static_cast<double>(result.d_counters.d_nanoseconds)
+                                                                         / 1e9
+                << ',' << result.d_counters.d_minorFaults
+                << ',' << result.d_counters.d_tlbMisses
+                << ',' << result.d_checksum
+                << bsl::endl;
+}
+
+                                // --------------
+                                // struct Options
+                                // --------------
+
+// CLASS METHODS
+int Options::parse(Options    *result,
+                   int         argc,
+                   char       *argv[],
+                   const char *description)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(description);
+
+    static const char k_SCALE[]     = "--scale=";
+    static const char k_ALLOCATOR[] = "--allocator=";
+    static const char k_THREADS[]   = "--threads=";
+
+    int allocatorMask = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        int         rc  = -1;
+
+        if (0 == bsl::strncmp(arg, k_SCALE, sizeof k_SCALE - 1)) {
+            rc = parseInt(&result->d_scale, arg + sizeof k_SCALE - 1);
+        }
+        else if (0 == bsl::strncmp(arg, k_ALLOCATOR, sizeof k_ALLOCATOR - 1)) {
+            AllocatorKind::Enum kind;
+            rc = AllocatorKind::fromAscii(&kind,
+                                          arg + sizeof k_ALLOCATOR - 1);
+            if (0 == rc) {
+                allocatorMask |= 1 << kind;
+            }
+        }
+        else if (0 == bsl::strncmp(arg, k_THREADS, sizeof k_THREADS - 1)) {
+            rc = parseInt(&result->d_maxThreads, arg + sizeof k_THREADS - 1);
+        }
+
+        if (0 != rc) {
+            printUsage(argv[0], description);
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (allocatorMask) {
+        result->d_allocatorMask = allocatorMask;
+    }
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,366 @@
+// allocbench_util.h                                                  -*-C++-*-
+#ifndef INCLUDED_ALLOCBENCH_UTIL
+#define INCLUDED_ALLOCBENCH_UTIL
+
+//@PURPOSE: Provide the allocators, counters, and output of the benchmarks.
+//
+//@CLASSES:
+//  allocbench::AllocatorKind: enumeration of the benchmarked allocators
+//  allocbench::AllocatorHolder: owner of one benchmarked allocator
+//  allocbench::Sample: wall time, page faults, and TLB misses
+//  allocbench::CounterReader: source of 'Sample' values
+//  allocbench::Result: one measurement of one benchmark
+//  allocbench::ResultWriter: writer of results as comma-separated values
+//  allocbench::Options: command-line options common to the benchmarks
+//
+//@DESCRIPTION: This component provides the infrastructure shared by the
+// allocator benchmark programs in this directory: an enumeration of the
+// allocators being compared, 'allocbench::AllocatorKind'; a mechanism that
+// creates and owns one such allocator, 'allocbench::AllocatorHolder'; a
+// mechanism that samples the wall time, the minor page faults, and (where
+// the platform permits) the data TLB misses of the process,
+// 'allocbench::CounterReader'; and a mechanism that writes each measurement
+// as one line of comma-separated values, 'allocbench::ResultWriter'.
+//
+///Output Format
+///-------------
+// Each benchmark program writes to standard output a header line followed by
+// one line per measurement, with the columns:
+//..
+//  benchmark,workload,allocator,mode,threads,elements,iterations,seconds,
+//  minorFaults,dtlbMisses,checksum
+//..
+// (on a single line), where 'minorFaults' and 'dtlbMisses' are -1 if the
+// counter is not available on the platform (or, for 'dtlbMisses', to the
+// user), and 'checksum' is a value computed by the workload so that its work
+// cannot be optimized away.  No other output is written to standard output,
+// so that the output of successive releases can be compared directly.
+//
+///The Allocators
+///--------------
+// The benchmarked allocators are:
+//..
+//  Name                         Allocator
+//  ---------------------------  -------------------------------------------
+//  newdelete                    bslma::NewDeleteAllocator
+//  sequential                   bdlma::SequentialAllocator
+//  multipool                    bdlma::MultipoolAllocator
+//  concurrentmultipool          bdlma::ConcurrentMultipoolAllocator
+//  bufferedsequential           bdlma::BufferedSequentialAllocator
+//  localsequential              bdlma::LocalSequentialAllocator
+//..
+// Every allocator other than 'newdelete' obtains its memory from
+// 'bslma::NewDeleteAllocator', and the buffered and local sequential
+// allocators have an initial buffer of 'AllocatorHolder::k_BUFFER_SIZE'
+// bytes.
+
+#include <bdlma_managedallocator.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+
+namespace BloombergLP {
+namespace allocbench {
+
+                            // ====================
+                            // struct AllocatorKind
+                            // ====================
+
+struct AllocatorKind {
+    // This 'struct' provides a namespace for enumerating the benchmarked
+    // allocators.
+
+    // TYPES
+    enum Enum {
+        e_NEW_DELETE,
+        e_SEQUENTIAL,
+        e_MULTIPOOL,
+        e_CONCURRENT_MULTIPOOL,
+        e_BUFFERED_SEQUENTIAL,
+        e_LOCAL_SEQUENTIAL
+    };
+
+    enum {
+        k_NUM_KINDS = e_LOCAL_SEQUENTIAL + 1  // number of enumerators
+    };
+
+    // CLASS METHODS
+    static int fromAscii(Enum *result, const char *string);
+        // Load into the specified 'result' the enumerator whose name (as
+        // returned by 'toAscii') is the specified 'string'.  Return 0 on
+        // success, and a non-zero value (with no effect on 'result')
+        // otherwise.
+
+    static bool isThreadSafe(Enum value);
+        // Return 'true' if an allocator of the specified 'value' kind may be
+        // used concurrently from multiple threads, and 'false' otherwise.
+
+    static const char *toAscii(Enum value);
+        // Return the name of the specified 'value', as used in the output of
+        // the benchmarks.
+};
+
+                           // =====================
+                           // class AllocatorHolder
+                           // =====================
+
+class AllocatorHolder {
+    // This class creates, and owns, one allocator of a kind specified at
+    // construction.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_BUFFER_SIZE = 4 * 1024  // size (in bytes) of the initial buffer of
+                                  // the buffered and local allocators
+    };
+
+  private:
+    // DATA
+    AllocatorKind::Enum                d_kind;         // kind of allocator
+
+    bsls::AlignedBuffer<k_BUFFER_SIZE> d_buffer;       // buffer of the
+                                                       // buffered allocator
+
+    bslma::Allocator                  *d_allocator_p;  // held allocator
+
+    bdlma::ManagedAllocator           *d_managed_p;    // held allocator, or
+                                                       // 0 if not managed
+
+  private:
+    // NOT IMPLEMENTED
+    AllocatorHolder(const AllocatorHolder&);
+    AllocatorHolder& operator=(const AllocatorHolder&);
+
+  public:
+    // CREATORS
+    explicit AllocatorHolder(AllocatorKind::Enum kind);
+        // Create an allocator of the specified 'kind', held by this object.
+
+    ~AllocatorHolder();
+        // Destroy the held allocator, releasing any memory allocated from it.
+
+    // MANIPULATORS
+    void release();
+        // Release all memory allocated from the held allocator if it is a
+        // managed allocator, and have no effect otherwise.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the address of the held allocator.
+
+    AllocatorKind::Enum kind() const;
+        // Return the kind of the held allocator.
+
+    bool isManaged() const;
+        // Return 'true' if the held allocator supports 'release', and 'false'
+        // otherwise.
+};
+
+                                // =============
+                                // struct Sample
+                                // =============
+
+struct Sample {
+    // This 'struct' describes the values of the counters of the process at
+    // an instant, or their difference between two instants.
+
+    bsls::Types::Int64 d_nanoseconds;  // wall time
+
+    bsls::Types::Int64 d_minorFaults;  // minor page faults, or -1 if not
+                                       // available
+
+    bsls::Types::Int64 d_tlbMisses;    // data TLB read misses, or -1 if not
+                                       // available
+};
+
+Sample operator-(const Sample& lhs, const Sample& rhs);
+    // Return the difference between the specified 'lhs' and 'rhs' samples,
+    // with each counter that is not available in either being -1.
+
+                            // ===================
+                            // class CounterReader
+                            // ===================
+
+class CounterReader {
+    // This class provides a mechanism for sampling the counters of the
+    // process.  The data TLB miss counter (available only on Linux, and only
+    // if the user is permitted to open it) counts the misses of the thread
+    // that created the reader and of the threads that it subsequently
+    // creates.
+
+    // DATA
+    int d_tlbFd;  // descriptor of the TLB miss counter, or -1
+
+  private:
+    // NOT IMPLEMENTED
+    CounterReader(const CounterReader&);
+    CounterReader& operator=(const CounterReader&);
+
+  public:
+    // CREATORS
+    CounterReader();
+        // Create a reader, opening a data TLB miss counter if possible.
+
+    ~CounterReader();
+        // Destroy this object.
+
+    // ACCESSORS
+    Sample sample() const;
+        // Return the current values of the counters.
+};
+
+                                // =============
+                                // struct Result
+                                // =============
+
+struct Result {
+    // This 'struct' describes one measurement of a benchmark.
+
+    const char          *d_benchmark;   // name of the benchmark program
+
+    const char          *d_workload;    // name of the workload
+
+    AllocatorKind::Enum  d_allocator;   // benchmarked allocator
+
+    const char          *d_mode;        // how the allocator was used
+
+    int                  d_numThreads;  // number of threads
+
+    bsls::Types::Int64   d_elements;    // elements per container
+
+    bsls::Types::Int64   d_iterations;  // repetitions of the workload
+
+    Sample               d_counters;    // counters consumed by the workload
+
+    bsls::Types::Int64   d_checksum;    // value computed by the workload
+};
+
+                            // ==================
+                            // class ResultWriter
+                            // ==================
+
+class ResultWriter {
+    // This class provides a mechanism for writing 'Result' values to a stream
+    // as comma-separated values.
+
+    // DATA
+    bsl::ostream *d_stream_p;  // destination (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ResultWriter(const ResultWriter&);
+    ResultWriter& operator=(const ResultWriter&);
+
+  public:
+    // CREATORS
+    explicit ResultWriter(bsl::ostream *stream);
+        // Create a writer to the specified 'stream', and write the header
+        // line to 'stream'.
+
+    // MANIPULATORS
+    void write(const Result& result);
+        // Write the specified 'result' to the stream of this writer as one
+        // line, and flush the stream.
+};
+
+                                // ==============
+                                // struct Options
+                                // ==============
+
+struct Options {
+    // This 'struct' describes the command-line options common to the
+    // benchmark programs:
+    //..
+    //  --scale=<n>          log2 of the amount of work of each measurement
+    //  --allocator=<name>   benchmark only the named allocator (repeatable)
+    //  --threads=<n>        maximum number of threads
+    //..
+
+    // DATA
+    int d_scale;           // log2 of the amount of work of each measurement
+
+    int d_allocatorMask;   // bit 'k' is set if allocator kind 'k' is to be
+                           // benchmarked
+
+    int d_maxThreads;      // maximum number of threads
+
+    // CLASS METHODS
+    static int parse(Options    *result,
+                     int         argc,
+                     char       *argv[],
+                     const char *description);
+        // Load into the specified 'result' (whose members hold the defaults)
+        // the options in the specified 'argc' arguments 'argv'.  Return 0 on
+        // success.  If the arguments are invalid, or '--help' is among them,
+        // write a usage message, including the specified 'description' of
+        // the program, to 'bsl::cerr' and return a non-zero value.
+
+    // ACCESSORS
+    bool isSelected(AllocatorKind::Enum kind) const;
+        // Return 'true' if the allocator of the specified 'kind' is to be
+        // benchmarked, and 'false' otherwise.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class AllocatorHolder
+                           // ---------------------
+
+// ACCESSORS
+inline
+bslma::Allocator *AllocatorHolder::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+AllocatorKind::Enum AllocatorHolder::kind() const
+{
+    return d_kind;
+}
+
+inline
+bool AllocatorHolder::isManaged() const
+{
+    return 0 != d_managed_p;
+}
+
+                                // --------------
+                                // struct Options
+                                // --------------
+
+// ACCESSORS
+inline
+bool Options::isSelected(AllocatorKind::Enum kind) const
+{
+    return 0 != (d_allocatorMask & (1 << kind));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
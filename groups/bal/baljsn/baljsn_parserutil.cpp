@@ -621,20 +621,31 @@ int ParserUtil::getValue(bsl::vector<char> *value,
         return -1;                                                    // RETURN
     }
 
-    value->clear();
-
-    bdlde::Base64Decoder base64Decoder(true);
-    bsl::back_insert_iterator<bsl::vector<char> > outputIterator(*value);
-
-    rc = base64Decoder.convert(outputIterator,
-                               base64String.begin(),
-                               base64String.end());
-
-    if (rc < 0) {
-        return rc;                                                    // RETURN
+    // Decode through 'char' pointers into a buffer of the maximum decoded
+    // length, so that 'bdlde::Base64Decoder' can convert whole groups in
+    // bulk, and then trim the buffer to the number of bytes decoded.
+
+    value->resize(bdlde::Base64Decoder::maxDecodedLength(
+                                    static_cast<int>(base64String.length())));
+
+    bdlde::Base64Decoder  base64Decoder(true);
+    char                 *output = value->data();
+    int                   numOut = 0;
+    int                   numIn  = 0;
+
+    rc = base64Decoder.convert(output,
+                               &numOut,
+                               &numIn,
+                               base64String.data(),
+                               base64String.data() + base64String.length());
+    output += numOut;
+
+    if (rc >= 0) {
+        rc = base64Decoder.endConvert(output, &numOut);
+        output += numOut;
     }
 
-    rc = base64Decoder.endConvert(outputIterator);
+    value->resize(output - value->data());
 
     if (rc < 0) {
         return rc;                                                    // RETURN
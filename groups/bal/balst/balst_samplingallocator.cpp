@@ -0,0 +1,470 @@
+// balst_samplingallocator.cpp                                        -*-C++-*-
+#include <balst_samplingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_samplingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+#include <bslma_mallocfreeallocator.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_stackaddressutil.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_iomanip.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace balst {
+namespace {
+
+typedef bsls::StackAddressUtil AddressUtil;
+
+enum {
+    k_IGNORE_FRAMES = AddressUtil::k_IGNORE_FRAMES + 1
+        // The frame of 'SamplingAllocator::allocate' is not recorded.  In
+        // addition, on some platforms, gathering the stack pointers wastes one
+        // frame gathering the address of 'AddressUtil::getStackAddresses',
+        // which is reflected in whether 'AddressUtil::k_IGNORE_FRAMES' is 0 or
+        // 1.
+};
+
+int lifetimeClass(bsls::Types::Int64 nanoseconds)
+    // Return the lifetime class of the specified 'nanoseconds': 'b' such that
+    // '2^b <= nanoseconds < 2^(b + 1)', or 0 if 'nanoseconds < 1'.
+{
+    if (nanoseconds < 2) {
+        return 0;                                                     // RETURN
+    }
+    return 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                static_cast<bsl::uint64_t>(nanoseconds));
+}
+
+struct TraceSummary {
+    // This 'struct' describes one call stack written by 'report'.
+
+    bsls::Types::Int64 d_numSamples;     // sampled allocations
+
+    bsls::Types::Int64 d_numBytes;       // bytes of the sampled allocations
+
+    bsls::Types::Int64 d_numFreed;       // sampled blocks deallocated
+
+    bsls::Types::Int64 d_totalLifetime;  // sum of the lifetimes of the
+                                         // sampled blocks deallocated
+
+    const bsl::vector<const void *>
+                      *d_trace_p;        // call stack
+};
+
+bool hasMoreSamples(const TraceSummary& lhs, const TraceSummary& rhs)
+    // Return 'true' if the specified 'lhs' has more samples than the
+    // specified 'rhs', and 'false' otherwise.
+{
+    return lhs.d_numSamples > rhs.d_numSamples;
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // class SamplingAllocator
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+int SamplingAllocator::filterIndex(const void *address)
+{
+    // Discard the low bits, which are shared by all aligned blocks, and mix
+    // the others with a multiplicative hash.
+
+    const bsls::Types::Uint64 bits =
+                          reinterpret_cast<bsls::Types::UintPtr>(address) >> 4;
+
+    return static_cast<int>((bits * 0x9E3779B97F4A7C15ULL) >> 54);
+}
+
+// PRIVATE MANIPULATORS
+void SamplingAllocator::recordDeallocation(void *address)
+{
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    SampleMap::iterator it = d_samples.find(address);
+    if (d_samples.end() == it) {
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 lifetime = now - it->second.d_allocationTime;
+
+    ++it->second.d_trace_p->d_numFreed;
+    it->second.d_trace_p->d_totalLifetime += lifetime;
+    ++d_lifetimeClasses[lifetimeClass(lifetime)];
+
+    d_samples.erase(it);
+    d_filter[filterIndex(address)].addRelaxed(-1);
+}
+
+void SamplingAllocator::recordSample(void                   *address,
+                                     bsls::Types::size_type  size)
+{
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+
+    if (static_cast<int>(d_traceBuffer.size()) < k_IGNORE_FRAMES) {
+        d_traceBuffer.clear();
+    }
+    else {
+        d_traceBuffer.erase(d_traceBuffer.begin(),
+                            d_traceBuffer.begin() + k_IGNORE_FRAMES);
+    }
+
+    TraceMap::iterator trace = d_traces.find(d_traceBuffer);
+    if (d_traces.end() == trace) {
+        // Supply the allocator explicitly so that no temporary uses the
+        // default allocator, which may be this object.
+
+        const TraceRecord          record = { 0, 0, 0, 0 };
+        const TraceMap::value_type value(
+                                  d_traceBuffer,
+                                  record,
+                                  &bslma::MallocFreeAllocator::singleton());
+        trace = d_traces.insert(value).first;
+    }
+
+    ++trace->second.d_numSamples;
+    trace->second.d_numBytes += static_cast<bsls::Types::Int64>(size);
+    ++d_numSamples;
+
+    const SampleRecord sample = { &trace->second, now };
+    d_samples[address] = sample;
+    d_filter[filterIndex(address)].addRelaxed(1);
+}
+
+// CLASS METHODS
+int SamplingAllocator::sizeClass(bsls::Types::size_type size)
+{
+    BSLS_ASSERT(0 < size);
+
+    if (size <= 8) {
+        return 0;                                                     // RETURN
+    }
+
+    const int result = 64 - 3 - bdlb::BitUtil::numLeadingUnsetBits(
+                                   static_cast<bsl::uint64_t>(size - 1));
+
+    return result < k_NUM_SIZE_CLASSES ? result : k_NUM_SIZE_CLASSES - 1;
+}
+
+bsls::Types::Uint64 SamplingAllocator::sizeClassUpperBound(int sizeClass)
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    return static_cast<bsls::Types::Uint64>(8) << sizeClass;
+}
+
+// CREATORS
+SamplingAllocator::SamplingAllocator(bslma::Allocator *basicAllocator)
+: d_numAllocations(0)
+, d_numDeallocations(0)
+, d_samplingInterval(k_DEFAULT_SAMPLING_INTERVAL)
+, d_maxRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES + k_IGNORE_FRAMES)
+, d_mutex()
+, d_numSamples(0)
+, d_traces(&bslma::MallocFreeAllocator::singleton())
+, d_samples(&bslma::MallocFreeAllocator::singleton())
+, d_traceBuffer(&bslma::MallocFreeAllocator::singleton())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    bsl::fill(d_lifetimeClasses,
+              d_lifetimeClasses + k_NUM_LIFETIME_CLASSES,
+              0);
+}
+
+SamplingAllocator::SamplingAllocator(int               samplingInterval,
+                                     bslma::Allocator *basicAllocator)
+: d_numAllocations(0)
+, d_numDeallocations(0)
+, d_samplingInterval(samplingInterval)
+, d_maxRecordedFrames(k_DEFAULT_NUM_RECORDED_FRAMES + k_IGNORE_FRAMES)
+, d_mutex()
+, d_numSamples(0)
+, d_traces(&bslma::MallocFreeAllocator::singleton())
+, d_samples(&bslma::MallocFreeAllocator::singleton())
+, d_traceBuffer(&bslma::MallocFreeAllocator::singleton())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < samplingInterval);
+
+    bsl::fill(d_lifetimeClasses,
+              d_lifetimeClasses + k_NUM_LIFETIME_CLASSES,
+              0);
+}
+
+SamplingAllocator::SamplingAllocator(int               samplingInterval,
+                                     int               numRecordedFrames,
+                                     bslma::Allocator *basicAllocator)
+: d_numAllocations(0)
+, d_numDeallocations(0)
+, d_samplingInterval(samplingInterval)
+, d_maxRecordedFrames(numRecordedFrames + k_IGNORE_FRAMES)
+, d_mutex()
+, d_numSamples(0)
+, d_traces(&bslma::MallocFreeAllocator::singleton())
+, d_samples(&bslma::MallocFreeAllocator::singleton())
+, d_traceBuffer(&bslma::MallocFreeAllocator::singleton())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < samplingInterval);
+    BSLS_ASSERT(0 < numRecordedFrames);
+
+    bsl::fill(d_lifetimeClasses,
+              d_lifetimeClasses + k_NUM_LIFETIME_CLASSES,
+              0);
+}
+
+SamplingAllocator::~SamplingAllocator()
+{
+}
+
+// MANIPULATORS
+void *SamplingAllocator::allocate(bsls::Types::size_type size)
+{
+    if (0 == size) {
+        d_numAllocations.addRelaxed(1);
+        return 0;                                                     // RETURN
+    }
+
+    void *address = d_allocator_p->allocate(size);
+
+    const int k = sizeClass(size);
+    d_sizeClassAllocations[k].addRelaxed(1);
+    d_sizeClassBytes[k].addRelaxed(static_cast<bsls::Types::Int64>(size));
+
+    if (0 == d_numAllocations.addRelaxed(1) % d_samplingInterval) {
+        // The call stack is gathered here, rather than in 'recordSample', so
+        // that the number of frames to be ignored does not depend on whether
+        // 'recordSample' is inlined.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_traceBuffer.resize(d_maxRecordedFrames);
+        const int numFrames = AddressUtil::getStackAddresses(
+                                     const_cast<void **>(d_traceBuffer.data()),
+                                     d_maxRecordedFrames);
+        d_traceBuffer.resize(0 < numFrames ? numFrames : 0);
+
+        recordSample(address, size);
+    }
+
+    return address;
+}
+
+void SamplingAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    d_numDeallocations.addRelaxed(1);
+
+    // A relaxed load suffices: the sampling of a block happens before it is
+    // returned by 'allocate', and so before any deallocation of it.  The
+    // sample must be retired before the block is returned upstream, where it
+    // could be reallocated (and sampled) by another thread.
+
+    if (0 != d_filter[filterIndex(address)].loadRelaxed()) {
+        recordDeallocation(address);
+    }
+
+    d_allocator_p->deallocate(address);
+}
+
+// ACCESSORS
+bsls::Types::Int64 SamplingAllocator::numAllocationsInSizeClass(
+                                                           int sizeClass) const
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    return d_sizeClassAllocations[sizeClass].loadRelaxed();
+}
+
+bsls::Types::Int64 SamplingAllocator::numBytesAllocated() const
+{
+    bsls::Types::Int64 result = 0;
+    for (int k = 0; k < k_NUM_SIZE_CLASSES; ++k) {
+        result += d_sizeClassBytes[k].loadRelaxed();
+    }
+    return result;
+}
+
+bsls::Types::Int64 SamplingAllocator::numBytesAllocatedInSizeClass(
+                                                           int sizeClass) const
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    return d_sizeClassBytes[sizeClass].loadRelaxed();
+}
+
+bsls::Types::Int64 SamplingAllocator::numSampledBlocksInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<bsls::Types::Int64>(d_samples.size());
+}
+
+bsls::Types::Int64 SamplingAllocator::numSamples() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numSamples;
+}
+
+void SamplingAllocator::report(bsl::ostream& stream, int maxNumTraces) const
+{
+    BSLS_ASSERT(0 <= maxNumTraces);
+
+    bslma::Allocator *allocator = &bslma::MallocFreeAllocator::singleton();
+
+    // Copy the statistics while holding the lock, so that neither resolving
+    // symbols nor writing to 'stream' (either of which may allocate from this
+    // object) is done while holding it.
+
+    bsls::Types::Int64        numSamples;
+    bsls::Types::Int64        numSampledInUse;
+    bsls::Types::Int64        lifetimeClasses[k_NUM_LIFETIME_CLASSES];
+    bsl::vector<TraceSummary> summaries(allocator);
+    TraceMap                  traces(allocator);
+    bsl::size_t               numTraces;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        numSamples      = d_numSamples;
+        numSampledInUse = static_cast<bsls::Types::Int64>(d_samples.size());
+        numTraces       = d_traces.size();
+        bsl::copy(d_lifetimeClasses,
+                  d_lifetimeClasses + k_NUM_LIFETIME_CLASSES,
+                  lifetimeClasses);
+
+        summaries.reserve(d_traces.size());
+        for (TraceMap::const_iterator it = d_traces.begin();
+             it != d_traces.end();
+             ++it) {
+            const TraceSummary summary = { it->second.d_numSamples,
+                                           it->second.d_numBytes,
+                                           it->second.d_numFreed,
+                                           it->second.d_totalLifetime,
+                                           &it->first };
+            summaries.push_back(summary);
+        }
+
+        bsl::stable_sort(summaries.begin(), summaries.end(), &hasMoreSamples);
+        if (summaries.size() > static_cast<bsl::size_t>(maxNumTraces)) {
+            summaries.resize(maxNumTraces);
+        }
+
+        // Keep a copy of each call stack to be written, and have the summary
+        // refer to the copy.
+
+        for (bsl::size_t i = 0; i < summaries.size(); ++i) {
+            const TraceMap::value_type value(*summaries[i].d_trace_p,
+                                             TraceRecord(),
+                                             allocator);
+            summaries[i].d_trace_p = &traces.insert(value).first->first;
+        }
+    }
+
+    stream << "Sampling allocator: " << numAllocations() << " allocations ("
+           << numBytesAllocated() << " bytes), " << numDeallocations()
+           << " deallocations\n"
+           << "Sampling interval: " << d_samplingInterval << ", "
+           << numSamples << " samples, " << numSampledInUse
+           << " sampled blocks in use\n\n";
+
+    stream << "size class  max size (bytes)       allocations"
+           << "             bytes\n";
+    for (int k = 0; k < k_NUM_SIZE_CLASSES; ++k) {
+        const bsls::Types::Int64 count = numAllocationsInSizeClass(k);
+        if (0 == count) {
+            continue;
+        }
+        stream << bsl::setw(10) << k
+               << bsl::setw(18) << sizeClassUpperBound(k)
+               << bsl::setw(18) << count
+               << bsl::setw(18) << numBytesAllocatedInSizeClass(k) << '\n';
+    }
+
+    stream << "\nlifetime < (ns)    sampled blocks freed\n";
+    for (int b = 0; b < k_NUM_LIFETIME_CLASSES; ++b) {
+        if (0 == lifetimeClasses[b]) {
+            continue;
+        }
+        stream << bsl::setw(15)
+               << (static_cast<bsls::Types::Uint64>(2) << b)
+               << bsl::setw(24) << lifetimeClasses[b] << '\n';
+    }
+
+    stream << "\nCall stacks: " << numTraces << " (showing "
+           << summaries.size() << ")\n";
+
+    StackTrace st(allocator);
+    for (bsl::size_t i = 0; i < summaries.size(); ++i) {
+        const TraceSummary& summary = summaries[i];
+        const Trace&        trace   = *summary.d_trace_p;
+
+        stream << "----------------------------------------------------------"
+               << "---------------------\n"
+               << "Call stack " << i + 1 << ": " << summary.d_numSamples
+               << " samples (about "
+               << summary.d_numSamples * d_samplingInterval
+               << " allocations), " << summary.d_numBytes << " bytes, "
+               << summary.d_numFreed << " freed";
+        if (0 < summary.d_numFreed) {
+            stream << ", mean lifetime "
+                   << summary.d_totalLifetime / summary.d_numFreed << " ns";
+        }
+        stream << '\n';
+
+        int rc = StackTraceUtil::loadStackTraceFromAddressArray(
+                                               &st,
+                                               trace.data(),
+                                               static_cast<int>(trace.size()));
+        if (rc || 0 == st.length()) {
+            stream << "... stack trace failed ...\n";
+        }
+        else {
+            StackTraceUtil::printFormatted(stream, st);
+        }
+        st.removeAll();
+    }
+    stream << bsl::flush;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,438 @@
+// balst_samplingallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BALST_SAMPLINGALLOCATOR
+#define INCLUDED_BALST_SAMPLINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a low-overhead allocator that profiles allocation traffic.
+//
+//@CLASSES:
+//  balst::SamplingAllocator: adaptor recording sizes, lifetimes, and traces
+//
+//@SEE_ALSO: balst_stacktracetestallocator, bdlma_countingallocator,
+//           bdlma_multipool
+//
+//@DESCRIPTION: This component provides an allocator adaptor,
+// 'balst::SamplingAllocator', that implements the 'bslma::Allocator' protocol
+// by forwarding every request to an upstream allocator supplied at
+// construction, while recording statistics of the allocation traffic that are
+// cheap enough to gather in production:
+//
+//: o The number of allocations, and of bytes allocated, in each size class
+//:   (see {Size Classes}), counted for every allocation.
+//:
+//: o For a sample of the allocations (see {Sampling}), the call stack at the
+//:   allocation and the lifetime of the block.
+//
+// A report of these statistics can be written at any time with 'report':
+//..
+//   ,------------------------.
+//  ( balst::SamplingAllocator )
+//   `------------------------'
+//                |       ctor/dtor
+//                |       numAllocations
+//                |       numAllocationsInSizeClass
+//                |       numBytesAllocated
+//                |       numBytesAllocatedInSizeClass
+//                |       numDeallocations
+//                |       numSampledBlocksInUse
+//                |       numSamples
+//                |       report
+//                |       samplingInterval
+//                |       sizeClass                     (static)
+//                |       sizeClassUpperBound           (static)
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                        allocate
+//                        deallocate
+//..
+// Unlike 'bslma::TestAllocator' and 'balst::StackTraceTestAllocator', a
+// 'balst::SamplingAllocator' adds no header to the blocks it allocates (the
+// upstream allocator sees exactly the requested sizes), takes no lock for an
+// allocation that is not sampled, and takes a lock for a deallocation only if
+// the block might have been sampled.
+//
+///Size Classes
+///------------
+// Size class 0 holds allocations of 1 to 8 bytes, and size class 'k', for
+// '0 < k', holds allocations of '(8 << (k - 1)) + 1' to '8 << k' bytes (so
+// that the upper bound of a class, 'sizeClassUpperBound(k)', is '8 << k').
+// These classes correspond to the pools of a 'bdlma::Multipool' (whose pools
+// supply blocks of 8, 16, 32, ... bytes), so that the size-class counts
+// reported for the upstream allocator of a multipool show how many pools it
+// needs and how heavily each is used.
+//
+///Sampling
+///--------
+// One allocation in every 'samplingInterval()' allocations (counted across
+// all threads) is sampled.  For a sampled allocation, the allocator records
+// the return addresses of up to 'numRecordedFrames' frames of the call stack
+// (an inexpensive operation; the addresses are resolved to symbols only when
+// a report is written), the size, and the time.  When a sampled block is
+// deallocated, its lifetime is recorded.  Multiplying a number of samples by
+// the sampling interval estimates the number of allocations it represents.
+// Note that, because the sampling is periodic, a workload that allocates in a
+// cycle whose length is a multiple of the sampling interval will see some
+// call sites over-represented; a sampling interval that is prime avoids most
+// such aliasing.
+//
+///Thread Safety
+///-------------
+// 'balst::SamplingAllocator' is *fully thread-safe*, meaning that any
+// operation on the same object can be safely invoked from any thread,
+// provided that the upstream allocator is also fully thread-safe.
+//
+///Memory Used for Bookkeeping
+///---------------------------
+// The records of sampled blocks and call stacks are allocated from the
+// 'bslma::MallocFreeAllocator' singleton, so that they neither disturb the
+// traffic being profiled nor recurse into this allocator when it is installed
+// as the default allocator.  'report' also uses that allocator, and does not
+// hold any lock while resolving symbols or writing to the stream.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Choosing the Pools of a Multipool
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service allocates its messages from a 'bdlma::Multipool',
+// and that we want to know which of the pools of the multipool are used, and
+// from where.
+//
+// First, we interpose a sampling allocator between the multipool and its
+// upstream allocator, sampling one allocation in 31:
+//..
+//  balst::SamplingAllocator samplingAllocator(31);
+//  bdlma::Multipool         multipool(&samplingAllocator);
+//..
+// Then, we run the workload of the service (here, a simple loop):
+//..
+//  bsl::vector<void *> messages;
+//  for (int i = 0; i < 1000; ++i) {
+//      messages.push_back(multipool.allocate(24 + i % 200));
+//  }
+//..
+// Next, we observe that the multipool obtained its memory in large chunks:
+//..
+//  assert(0 < samplingAllocator.numAllocations());
+//  assert(samplingAllocator.numAllocations() < 1000);
+//..
+// Then, we see how many of the allocations from the multipool itself fall in
+// each size class, by instead interposing a second sampling allocator
+// between the service and the multipool:
+//..
+//  bdlma::MultipoolAllocator multipoolAllocator;
+//  balst::SamplingAllocator  clientAllocator(31, &multipoolAllocator);
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      clientAllocator.deallocate(clientAllocator.allocate(24 + i % 200));
+//  }
+//
+//  assert(1000 == clientAllocator.numAllocations());
+//  assert(  45 == clientAllocator.numAllocationsInSizeClass(2));  // 17..32
+//  assert( 160 == clientAllocator.numAllocationsInSizeClass(3));  // 33..64
+//..
+// Finally, we write a report, which lists the size classes and the call
+// stacks of the sampled allocations, to a stream:
+//..
+//  bsl::ostringstream stream;
+//  clientAllocator.report(stream);
+//  assert(bsl::string::npos != stream.str().find("size class"));
+//..
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                          // =======================
+                          // class SamplingAllocator
+                          // =======================
+
+class SamplingAllocator : public bslma::Allocator {
+    // This class defines a concrete allocator adaptor that implements the
+    // 'bslma::Allocator' protocol by forwarding to an upstream allocator, and
+    // records the size classes of all allocations and the call stacks and
+    // lifetimes of a sample of them.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_NUM_SIZE_CLASSES        = 61,    // number of size classes
+
+        k_NUM_LIFETIME_CLASSES    = 64,    // number of (log2 nanosecond)
+                                           // lifetime classes
+
+        k_DEFAULT_SAMPLING_INTERVAL = 1021,
+                                           // default number of allocations
+                                           // per sample
+
+        k_DEFAULT_NUM_RECORDED_FRAMES = 12,
+                                           // default number of frames
+                                           // recorded per sample
+
+        k_DEFAULT_MAX_NUM_TRACES  = 10     // default number of call stacks
+                                           // written by 'report'
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::vector<const void *> Trace;
+
+    struct TraceRecord {
+        // This 'struct' accumulates the statistics of the sampled allocations
+        // made from one call stack.
+
+        bsls::Types::Int64 d_numSamples;       // sampled allocations
+
+        bsls::Types::Int64 d_numBytes;         // bytes of the sampled
+                                               // allocations
+
+        bsls::Types::Int64 d_numFreed;         // sampled blocks deallocated
+
+        bsls::Types::Int64 d_totalLifetime;    // sum of the lifetimes (in
+                                               // nanoseconds) of the sampled
+                                               // blocks deallocated
+    };
+
+    typedef bsl::map<Trace, TraceRecord> TraceMap;
+
+    struct SampleRecord {
+        // This 'struct' describes one sampled block that is in use.
+
+        TraceRecord        *d_trace_p;         // record of the call stack
+
+        bsls::Types::Int64  d_allocationTime;  // 'bsls::TimeUtil' timer value
+                                               // at allocation
+    };
+
+    typedef bsl::unordered_map<const void *, SampleRecord> SampleMap;
+
+    enum {
+        k_FILTER_SIZE = 1024  // number of counters in 'd_filter'
+    };
+
+    // DATA
+    bsls::AtomicInt64  d_numAllocations;        // allocations (including
+                                                // size 0)
+
+    bsls::AtomicInt64  d_numDeallocations;      // deallocations (excluding
+                                                // null addresses)
+
+    bsls::AtomicInt64  d_sizeClassAllocations[k_NUM_SIZE_CLASSES];
+                                                // allocations per size class
+
+    bsls::AtomicInt64  d_sizeClassBytes[k_NUM_SIZE_CLASSES];
+                                                // bytes allocated per size
+                                                // class
+
+    bsls::AtomicInt    d_filter[k_FILTER_SIZE]; // number of sampled blocks in
+                                                // use per address hash; a
+                                                // block whose counter is 0 is
+                                                // not sampled
+
+    const int          d_samplingInterval;      // allocations per sample
+
+    const int          d_maxRecordedFrames;     // frames recorded per sample,
+                                                // including ignored frames
+
+    mutable bslmt::Mutex
+                       d_mutex;                 // protects the following
+
+    bsls::Types::Int64 d_numSamples;            // sampled allocations
+
+    bsls::Types::Int64 d_lifetimeClasses[k_NUM_LIFETIME_CLASSES];
+                                                // sampled blocks deallocated
+                                                // per lifetime class
+
+    TraceMap           d_traces;                // statistics per call stack
+
+    SampleMap          d_samples;               // sampled blocks in use
+
+    Trace              d_traceBuffer;           // buffer for recording a call
+                                                // stack
+
+    bslma::Allocator  *d_allocator_p;           // upstream allocator (held,
+                                                // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SamplingAllocator(const SamplingAllocator&);
+    SamplingAllocator& operator=(const SamplingAllocator&);
+
+  private:
+    // PRIVATE CLASS METHODS
+    static int filterIndex(const void *address);
+        // Return the index of the counter of 'd_filter' for the specified
+        // 'address'.
+
+    // PRIVATE MANIPULATORS
+    void recordDeallocation(void *address);
+        // Record the deallocation of the block at the specified 'address' if
+        // it was sampled, and have no effect otherwise.
+
+    void recordSample(void *address, bsls::Types::size_type size);
+        // Record the sampled allocation of the block of the specified 'size'
+        // at the specified 'address', whose call stack, as gathered in
+        // 'allocate', is in 'd_traceBuffer'.  The behavior is undefined
+        // unless 'd_mutex' is locked.
+
+  public:
+    // CLASS METHODS
+    static int sizeClass(bsls::Types::size_type size);
+        // Return the size class of an allocation of the specified 'size' (in
+        // bytes).  The behavior is undefined unless '0 < size'.
+
+    static bsls::Types::Uint64 sizeClassUpperBound(int sizeClass);
+        // Return the largest size (in bytes) in the specified 'sizeClass'.
+        // The behavior is undefined unless
+        // '0 <= sizeClass < k_NUM_SIZE_CLASSES'.
+
+    // CREATORS
+    explicit
+    SamplingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SamplingAllocator(int               samplingInterval,
+                      bslma::Allocator *basicAllocator = 0);
+    SamplingAllocator(int               samplingInterval,
+                      int               numRecordedFrames,
+                      bslma::Allocator *basicAllocator = 0);
+        // Create a sampling allocator.  Optionally specify a
+        // 'samplingInterval', the number of allocations per sampled
+        // allocation.  If 'samplingInterval' is not specified,
+        // 'k_DEFAULT_SAMPLING_INTERVAL' is used.  Optionally specify
+        // 'numRecordedFrames', the number of frames of the call stack
+        // recorded for each sampled allocation.  If 'numRecordedFrames' is
+        // not specified, 'k_DEFAULT_NUM_RECORDED_FRAMES' is used.  Optionally
+        // specify a 'basicAllocator' to which allocation requests are
+        // forwarded.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '0 < samplingInterval' and '0 < numRecordedFrames'.
+
+    virtual ~SamplingAllocator();
+        // Destroy this allocator object.  Note that destroying this allocator
+        // has no effect on any outstanding allocated memory.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return a newly-allocated block of memory of the specified 'size' (in
+        // bytes) obtained from the allocator supplied at construction.  If
+        // 'size' is 0, a null pointer is returned and only the number of
+        // allocations is affected.  Otherwise, record the allocation in the
+        // statistics of this allocator, sampling it if it is the last of a
+        // sampling interval.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to the allocator
+        // supplied at construction.  If 'address' is 0, this function has no
+        // effect.  If the block was sampled, record its lifetime.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.
+
+    // ACCESSORS
+    bsls::Types::Int64 numAllocations() const;
+        // Return the number of calls to 'allocate' on this object.
+
+    bsls::Types::Int64 numAllocationsInSizeClass(int sizeClass) const;
+        // Return the number of allocations of a non-zero size in the
+        // specified 'sizeClass'.  The behavior is undefined unless
+        // '0 <= sizeClass < k_NUM_SIZE_CLASSES'.
+
+    bsls::Types::Int64 numBytesAllocated() const;
+        // Return the cumulative number of bytes allocated from this object.
+
+    bsls::Types::Int64 numBytesAllocatedInSizeClass(int sizeClass) const;
+        // Return the cumulative number of bytes allocated from this object in
+        // the specified 'sizeClass'.  The behavior is undefined unless
+        // '0 <= sizeClass < k_NUM_SIZE_CLASSES'.
+
+    bsls::Types::Int64 numDeallocations() const;
+        // Return the number of calls to 'deallocate' on this object with a
+        // non-null address.
+
+    bsls::Types::Int64 numSampledBlocksInUse() const;
+        // Return the number of sampled blocks that have not been deallocated.
+
+    bsls::Types::Int64 numSamples() const;
+        // Return the number of sampled allocations.
+
+    void report(bsl::ostream& stream,
+                int           maxNumTraces = k_DEFAULT_MAX_NUM_TRACES) const;
+        // Write to the specified 'stream' a human-readable report of the
+        // statistics of this allocator: the totals, the allocations in each
+        // non-empty size class, the lifetimes of the sampled blocks that have
+        // been deallocated, and, for each of the call stacks having the most
+        // samples (at most the optionally specified 'maxNumTraces' of them,
+        // or 'k_DEFAULT_MAX_NUM_TRACES' if 'maxNumTraces' is not specified),
+        // the statistics of its samples and the resolved call stack.  The
+        // behavior is undefined unless '0 <= maxNumTraces'.  Note that the
+        // format of the report is not fully specified, and can change without
+        // notice.
+
+    int samplingInterval() const;
+        // Return the number of allocations per sampled allocation.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class SamplingAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 SamplingAllocator::numAllocations() const
+{
+    return d_numAllocations.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 SamplingAllocator::numDeallocations() const
+{
+    return d_numDeallocations.loadRelaxed();
+}
+
+inline
+int SamplingAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
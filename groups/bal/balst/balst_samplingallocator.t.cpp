@@ -0,0 +1,912 @@
+// balst_samplingallocator.t.cpp                                      -*-C++-*-
+#include <balst_samplingallocator.h>
+
+#include <bdlma_multipool.h>
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'balst::SamplingAllocator' is a thread-safe allocator adaptor that forwards
+// every request to an upstream allocator and records statistics.  The primary
+// concerns are that requests are forwarded unchanged, that every allocation
+// is counted in the correct size class, that exactly one allocation in each
+// sampling interval is sampled, that the lifetimes of sampled blocks are
+// recorded on deallocation, and that 'report' writes all of these, including
+// one entry per distinct call stack.
+//
+// The benchmark (case -1) reports the cost of an allocation and deallocation
+// through the adaptor compared with calling the upstream allocator directly.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int sizeClass(bsls::Types::size_type size);
+// [ 2] static bsls::Types::Uint64 sizeClassUpperBound(int sizeClass);
+//
+// CREATORS
+// [ 3] explicit SamplingAllocator(bslma::Allocator *basicAllocator = 0);
+// [ 3] SamplingAllocator(int samplingInterval, bslma::Allocator *ba = 0);
+// [ 3] SamplingAllocator(int, int numRecordedFrames, bslma::Allocator *);
+// [ 3] ~SamplingAllocator();
+//
+// MANIPULATORS
+// [ 4] void *allocate(bsls::Types::size_type size);
+// [ 4] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 4] bsls::Types::Int64 numAllocations() const;
+// [ 4] bsls::Types::Int64 numAllocationsInSizeClass(int sizeClass) const;
+// [ 4] bsls::Types::Int64 numBytesAllocated() const;
+// [ 4] bsls::Types::Int64 numBytesAllocatedInSizeClass(int) const;
+// [ 4] bsls::Types::Int64 numDeallocations() const;
+// [ 4] bsls::Types::Int64 numSampledBlocksInUse() const;
+// [ 4] bsls::Types::Int64 numSamples() const;
+// [ 5] void report(bsl::ostream& stream, int maxNumTraces = 10) const;
+// [ 3] int samplingInterval() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 6] CONCERN: The allocator is thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [-1] BENCHMARK: overhead of the adaptor
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::SamplingAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::Uint64      Uint64;
+
+// ============================================================================
+//                     HELPER FUNCTIONS FOR CONCURRENCY TEST
+// ----------------------------------------------------------------------------
+
+namespace CONCURRENCY_TEST {
+
+enum { k_NUM_ALLOCATIONS = 10000 };
+
+extern "C" void *workerThread(void *arg)
+    // Allocate and deallocate 'k_NUM_ALLOCATIONS' blocks of varying sizes
+    // from the 'Obj' addressed by the specified 'arg', keeping up to 16 of
+    // them in use at a time.
+{
+    Obj *mX = static_cast<Obj *>(arg);
+
+    void *blocks[16] = { 0 };
+
+    for (int i = 0; i < k_NUM_ALLOCATIONS; ++i) {
+        mX->deallocate(blocks[i % 16]);
+        blocks[i % 16] = mX->allocate(1 + i % 300);
+    }
+    for (int i = 0; i < 16; ++i) {
+        mX->deallocate(blocks[i]);
+    }
+    return 0;
+}
+
+}  // close namespace CONCURRENCY_TEST
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Choosing the Pools of a Multipool
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a service allocates its messages from a 'bdlma::Multipool',
+// and that we want to know which of the pools of the multipool are used, and
+// from where.
+//
+// First, we interpose a sampling allocator between the multipool and its
+// upstream allocator, sampling one allocation in 31:
+//..
+    balst::SamplingAllocator samplingAllocator(31);
+    bdlma::Multipool         multipool(&samplingAllocator);
+//..
+// Then, we run the workload of the service (here, a simple loop):
+//..
+    bsl::vector<void *> messages;
+    for (int i = 0; i < 1000; ++i) {
+        messages.push_back(multipool.allocate(24 + i % 200));
+    }
+//..
+// Next, we observe that the multipool obtained its memory in large chunks:
+//..
+    ASSERT(0 < samplingAllocator.numAllocations());
+    ASSERT(samplingAllocator.numAllocations() < 1000);
+//..
+// Then, we see how many of the allocations from the multipool itself fall in
+// each size class, by instead interposing a second sampling allocator
+// between the service and the multipool:
+//..
+    bdlma::MultipoolAllocator multipoolAllocator;
+    balst::SamplingAllocator  clientAllocator(31, &multipoolAllocator);
+
+    for (int i = 0; i < 1000; ++i) {
+        clientAllocator.deallocate(clientAllocator.allocate(24 + i % 200));
+    }
+
+    ASSERT(1000 == clientAllocator.numAllocations());
+    ASSERT(  45 == clientAllocator.numAllocationsInSizeClass(2));  // 17..32
+    ASSERT( 160 == clientAllocator.numAllocationsInSizeClass(3));  // 33..64
+//..
+// Finally, we write a report, which lists the size classes and the call
+// stacks of the sampled allocations, to a stream:
+//..
+    bsl::ostringstream stream;
+    clientAllocator.report(stream);
+    ASSERT(bsl::string::npos != stream.str().find("size class"));
+//..
+
+        if (veryVerbose) {
+            cout << stream.str();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Allocations and deallocations from multiple threads are all
+        //:   counted, and exactly one allocation per sampling interval is
+        //:   sampled.
+        //:
+        //: 2 Every sampled block is retired when it is deallocated, even when
+        //:   its address is immediately reused by another thread.
+        //
+        // Plan:
+        //: 1 Have 4 threads each allocate and deallocate many blocks through
+        //:   one object, and verify the counts and that no sampled block
+        //:   remains in use.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: The allocator is thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace CONCURRENCY_TEST;
+
+        enum { k_NUM_THREADS = 4, k_INTERVAL = 7 };
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        {
+            Obj mX(k_INTERVAL, &ta);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      workerThread,
+                                                      &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            const Int64 TOTAL = k_NUM_THREADS * k_NUM_ALLOCATIONS;
+
+            ASSERTV(X.numAllocations(),   TOTAL == X.numAllocations());
+            ASSERTV(X.numDeallocations(), TOTAL == X.numDeallocations());
+            ASSERTV(X.numSamples(), TOTAL / k_INTERVAL == X.numSamples());
+            ASSERTV(X.numSampledBlocksInUse(),
+                    0 == X.numSampledBlocksInUse());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'report'
+        //
+        // Concerns:
+        //: 1 The report includes the totals, each non-empty size class, the
+        //:   lifetimes of the sampled blocks that were freed, and one entry
+        //:   per distinct call stack, ordered by number of samples.
+        //:
+        //: 2 At most 'maxNumTraces' call stacks are written.
+        //:
+        //: 3 'report' does not allocate from the default allocator.
+        //
+        // Plan:
+        //: 1 Allocate from two call sites, with every allocation sampled, and
+        //:   search the report for the expected text.  (C-1)
+        //:
+        //: 2 Write a report with 'maxNumTraces' of 0 and 1.  (C-2)
+        //:
+        //: 3 Install a test allocator as the default allocator, and verify
+        //:   that it is not used by 'report' (other than by the string
+        //:   stream).  (C-3)
+        //
+        // Testing:
+        //   void report(bsl::ostream& stream, int maxNumTraces = 10) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'report'" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        bslma::TestAllocator sa("stream",   veryVeryVerbose);
+
+        Obj mX(1, &ta);  const Obj& X = mX;
+
+        // The bounds of the loops are read through 'volatile' so that the
+        // loops, each having one call site, are not unrolled.
+
+        volatile int numA = 3;
+        volatile int numB = 5;
+
+        void *blocks[5];
+        for (int i = 0; i < numA; ++i) {
+            blocks[i] = mX.allocate(100);                    // call stack A
+        }
+        for (int i = numA; i < numB; ++i) {
+            blocks[i] = mX.allocate(1000);                   // call stack B
+        }
+        mX.deallocate(blocks[0]);
+        mX.deallocate(blocks[3]);
+
+        ASSERT(5 == X.numSamples());
+        ASSERT(3 == X.numSampledBlocksInUse());
+
+        {
+            bsl::ostringstream stream(&sa);
+            X.report(stream);
+            ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+            const bsl::string REPORT(stream.str(), &sa);
+
+            if (veryVerbose) cout << REPORT;
+
+            ASSERT(bsl::string::npos != REPORT.find(
+                      "Sampling allocator: 5 allocations (2300 bytes), "
+                      "2 deallocations"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                      "Sampling interval: 1, 5 samples, "
+                      "3 sampled blocks in use"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                      "         4               128                 3"
+                      "               300"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                      "         7              1024                 2"
+                      "              2000"));
+            ASSERT(bsl::string::npos != REPORT.find("lifetime < (ns)"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                                                "Call stacks: 2 (showing 2)"));
+            ASSERT(bsl::string::npos != REPORT.find(
+                         "Call stack 1: 3 samples (about 3 allocations), "
+                         "300 bytes, 1 freed, mean lifetime "));
+            ASSERT(bsl::string::npos != REPORT.find(
+                         "Call stack 2: 2 samples (about 2 allocations), "
+                         "2000 bytes, 1 freed, mean lifetime "));
+        }
+
+        if (verbose) cout << "\nLimiting the call stacks." << endl;
+        {
+            for (int n = 0; n < 2; ++n) {
+                bsl::ostringstream stream(&sa);
+                X.report(stream, n);
+                const bsl::string REPORT(stream.str(), &sa);
+
+                ASSERTV(n, bsl::string::npos != REPORT.find(n
+                                        ? "Call stacks: 2 (showing 1)"
+                                        : "Call stacks: 2 (showing 0)"));
+                ASSERTV(n, (1 == n) ==
+                           (bsl::string::npos != REPORT.find("Call stack 1")));
+                ASSERTV(n, bsl::string::npos == REPORT.find("Call stack 2"));
+            }
+        }
+
+        for (int i = 0; i < 5; ++i) {
+            if (0 != i && 3 != i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == X.numSampledBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::ostringstream stream(&sa);
+
+            ASSERT_PASS(X.report(stream, 0));
+            ASSERT_FAIL(X.report(stream, -1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'allocate', 'deallocate', AND STATISTICS
+        //
+        // Concerns:
+        //: 1 'allocate' forwards the requested size to the upstream allocator
+        //:   and returns its block, and 'deallocate' returns the block to the
+        //:   upstream allocator.
+        //:
+        //: 2 Each allocation of a non-zero size is counted, with its bytes,
+        //:   in its size class.
+        //:
+        //: 3 An allocation of 0 bytes returns 0 and is counted only in
+        //:   'numAllocations', and deallocating 0 has no effect.
+        //:
+        //: 4 Exactly the 'samplingInterval'-th, '2 * samplingInterval'-th,
+        //:   ... allocations are sampled, and a sampled block is no longer
+        //:   in use once deallocated.
+        //
+        // Plan:
+        //: 1 Using a test allocator as the upstream allocator, allocate and
+        //:   deallocate blocks of a table of sizes, and verify the statistics
+        //:   of both allocators after each operation.  (C-1..3)
+        //:
+        //: 2 For a table of sampling intervals, allocate and deallocate
+        //:   blocks, verifying 'numSamples' and 'numSampledBlocksInUse'.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numAllocations() const;
+        //   bsls::Types::Int64 numAllocationsInSizeClass(int sizeClass) const;
+        //   bsls::Types::Int64 numBytesAllocated() const;
+        //   bsls::Types::Int64 numBytesAllocatedInSizeClass(int) const;
+        //   bsls::Types::Int64 numDeallocations() const;
+        //   bsls::Types::Int64 numSampledBlocksInUse() const;
+        //   bsls::Types::Int64 numSamples() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate', 'deallocate', AND STATISTICS" << endl
+                          << "=======================================" << endl;
+
+        if (verbose) cout << "\nForwarding and size classes." << endl;
+        {
+            static const size_type SIZES[] = { 1, 8, 9, 16, 17, 100, 4096,
+                                               4097, 1000000 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+            Obj mX(1000, &ta);  const Obj& X = mX;
+
+            void  *blocks[NUM_SIZES];
+            Int64  expBytes = 0;
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                const size_type SIZE  = SIZES[i];
+                const int       CLASS = Obj::sizeClass(SIZE);
+
+                if (veryVerbose) { T_ P_(SIZE) P(CLASS) }
+
+                const Int64 CLASS_COUNT = X.numAllocationsInSizeClass(CLASS);
+                const Int64 CLASS_BYTES =
+                                         X.numBytesAllocatedInSizeClass(CLASS);
+
+                blocks[i] = mX.allocate(SIZE);
+                expBytes += SIZE;
+
+                ASSERTV(i, blocks[i] == ta.lastAllocatedAddress());
+                ASSERTV(i, SIZE == static_cast<size_type>(
+                                                  ta.lastAllocatedNumBytes()));
+                ASSERTV(i, i + 1 == X.numAllocations());
+                ASSERTV(i, expBytes == X.numBytesAllocated());
+                ASSERTV(i, CLASS_COUNT + 1 ==
+                                          X.numAllocationsInSizeClass(CLASS));
+                ASSERTV(i, CLASS_BYTES + static_cast<Int64>(SIZE) ==
+                                       X.numBytesAllocatedInSizeClass(CLASS));
+            }
+
+            ASSERT(2 == X.numAllocationsInSizeClass(0));
+            ASSERT(2 == X.numAllocationsInSizeClass(1));
+            ASSERT(1 == X.numAllocationsInSizeClass(2));
+            ASSERT(1 == X.numAllocationsInSizeClass(4));
+            ASSERT(1 == X.numAllocationsInSizeClass(9));
+            ASSERT(1 == X.numAllocationsInSizeClass(10));
+            ASSERT(1 == X.numAllocationsInSizeClass(17));
+            ASSERT(NUM_SIZES == ta.numBlocksInUse());
+
+            for (int i = 0; i < NUM_SIZES; ++i) {
+                mX.deallocate(blocks[i]);
+
+                ASSERTV(i, blocks[i] == ta.lastDeallocatedAddress());
+                ASSERTV(i, i + 1 == X.numDeallocations());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+
+            // Zero-sized allocations and null deallocations.
+
+            const Int64 NUM_BLOCKS = ta.numBlocksTotal();
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(NUM_SIZES + 1 == X.numAllocations());
+            ASSERT(expBytes == X.numBytesAllocated());
+
+            mX.deallocate(0);
+            ASSERT(NUM_SIZES == X.numDeallocations());
+            ASSERT(NUM_BLOCKS == ta.numBlocksTotal());
+            ASSERT(0 == X.numSamples());
+        }
+
+        if (verbose) cout << "\nSampling." << endl;
+        {
+            static const int INTERVALS[] = { 1, 2, 3, 7, 64 };
+            const int NUM_INTERVALS = sizeof INTERVALS / sizeof *INTERVALS;
+
+            for (int ti = 0; ti < NUM_INTERVALS; ++ti) {
+                const int INTERVAL = INTERVALS[ti];
+
+                if (veryVerbose) { T_ P(INTERVAL) }
+
+                bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+                Obj mX(INTERVAL, 4, &ta);  const Obj& X = mX;
+
+                bsl::vector<void *> blocks(&ta);
+                blocks.reserve(200);
+
+                for (int i = 1; i <= 200; ++i) {
+                    blocks.push_back(mX.allocate(i));
+
+                    ASSERTV(INTERVAL, i, i / INTERVAL == X.numSamples());
+                    ASSERTV(INTERVAL, i,
+                            i / INTERVAL == X.numSampledBlocksInUse());
+                }
+                for (int i = 1; i <= 200; ++i) {
+                    mX.deallocate(blocks[i - 1]);
+
+                    ASSERTV(INTERVAL, i, 200 / INTERVAL == X.numSamples());
+                    ASSERTV(INTERVAL, i,
+                            200 / INTERVAL - i / INTERVAL ==
+                                                    X.numSampledBlocksInUse());
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS AND 'samplingInterval'
+        //
+        // Concerns:
+        //: 1 Each constructor sets the sampling interval as documented, and
+        //:   the statistics of a new object are all 0.
+        //:
+        //: 2 The default allocator is the upstream allocator if none is
+        //:   supplied, and the object allocates no memory from either at
+        //:   construction.
+        //:
+        //: 3 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor, with and without an
+        //:   upstream allocator, and verify the accessors and the allocator
+        //:   that supplies a block.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   explicit SamplingAllocator(bslma::Allocator *basicAllocator = 0);
+        //   SamplingAllocator(int samplingInterval, bslma::Allocator *ba = 0);
+        //   SamplingAllocator(int, int numRecordedFrames, bslma::Allocator *);
+        //   ~SamplingAllocator();
+        //   int samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND 'samplingInterval'" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+
+        for (char cfg = 'a'; cfg <= 'f'; ++cfg) {
+            const char CONFIG = cfg;
+
+            if (veryVerbose) { T_ P(CONFIG) }
+
+            const bool            USE_TA   = CONFIG >= 'd';
+            bslma::Allocator     *upstream = USE_TA ? &ta : 0;
+            bslma::TestAllocator& expected = USE_TA ? ta  : da;
+
+            const Int64 NUM_DEFAULT = da.numBlocksTotal();
+
+            Obj *objPtr = 0;
+            int  EXP_INTERVAL = 0;
+
+            switch (CONFIG) {
+              case 'a':
+              case 'd': {
+                objPtr = new (bslma::NewDeleteAllocator::singleton())
+                                                                 Obj(upstream);
+                EXP_INTERVAL = Obj::k_DEFAULT_SAMPLING_INTERVAL;
+              } break;
+              case 'b':
+              case 'e': {
+                objPtr = new (bslma::NewDeleteAllocator::singleton())
+                                                             Obj(13, upstream);
+                EXP_INTERVAL = 13;
+              } break;
+              case 'c':
+              case 'f': {
+                objPtr = new (bslma::NewDeleteAllocator::singleton())
+                                                          Obj(1, 3, upstream);
+                EXP_INTERVAL = 1;
+              } break;
+            }
+
+            Obj& mX = *objPtr;  const Obj& X = mX;
+
+            ASSERTV(CONFIG, NUM_DEFAULT == da.numBlocksTotal());
+            ASSERTV(CONFIG, 0 == ta.numBlocksInUse());
+
+            ASSERTV(CONFIG, EXP_INTERVAL == X.samplingInterval());
+            ASSERTV(CONFIG, 0 == X.numAllocations());
+            ASSERTV(CONFIG, 0 == X.numDeallocations());
+            ASSERTV(CONFIG, 0 == X.numBytesAllocated());
+            ASSERTV(CONFIG, 0 == X.numSamples());
+            ASSERTV(CONFIG, 0 == X.numSampledBlocksInUse());
+
+            void *p = mX.allocate(10);
+            ASSERTV(CONFIG, p == expected.lastAllocatedAddress());
+            mX.deallocate(p);
+            ASSERTV(CONFIG, 0 == expected.numBlocksInUse());
+
+            bslma::NewDeleteAllocator::singleton().deleteObject(objPtr);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1, &ta));
+            ASSERT_FAIL(Obj(0, &ta));
+            ASSERT_PASS(Obj(1, 1, &ta));
+            ASSERT_FAIL(Obj(1, 0, &ta));
+            ASSERT_FAIL(Obj(0, 1, &ta));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'sizeClass' AND 'sizeClassUpperBound'
+        //
+        // Concerns:
+        //: 1 Sizes 1 to 8 are in size class 0, and every other size is in the
+        //:   smallest class whose upper bound is not less than the size.
+        //:
+        //: 2 The upper bound of class 'k' is '8 << k'.
+        //:
+        //: 3 Sizes beyond the upper bound of the last class are in the last
+        //:   class.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify 'sizeClass' for a table of sizes at the boundaries of
+        //:   the classes.  (C-1, 3)
+        //:
+        //: 2 Verify 'sizeClassUpperBound' and the consistency of the two
+        //:   functions for every class.  (C-1..2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   static int sizeClass(bsls::Types::size_type size);
+        //   static bsls::Types::Uint64 sizeClassUpperBound(int sizeClass);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'sizeClass' AND 'sizeClassUpperBound'" << endl
+                          << "=====================================" << endl;
+
+        static const struct {
+            int       d_line;
+            size_type d_size;
+            int       d_expClass;
+        } DATA[] = {
+            //LINE  SIZE        EXP CLASS
+            //----  ----------  ---------
+            { L_,   1,          0         },
+            { L_,   7,          0         },
+            { L_,   8,          0         },
+            { L_,   9,          1         },
+            { L_,   16,         1         },
+            { L_,   17,         2         },
+            { L_,   32,         2         },
+            { L_,   33,         3         },
+            { L_,   1024,       7         },
+            { L_,   1025,       8         },
+            { L_,   1 << 20,    17        },
+            { L_,   (1 << 20) + 1,
+                                18        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE = DATA[ti].d_line;
+            const size_type SIZE = DATA[ti].d_size;
+            const int       EXP  = DATA[ti].d_expClass;
+
+            if (veryVerbose) { T_ P_(LINE) P_(SIZE) P(EXP) }
+
+            ASSERTV(LINE, EXP == Obj::sizeClass(SIZE));
+        }
+
+        for (int k = 0; k < Obj::k_NUM_SIZE_CLASSES; ++k) {
+            const Uint64 BOUND = Obj::sizeClassUpperBound(k);
+
+            ASSERTV(k, (static_cast<Uint64>(8) << k) == BOUND);
+
+            if (BOUND <= static_cast<Uint64>(~static_cast<size_type>(0))) {
+                const size_type SIZE = static_cast<size_type>(BOUND);
+
+                ASSERTV(k, k == Obj::sizeClass(SIZE));
+                if (0 < k) {
+                    ASSERTV(k, k == Obj::sizeClass(SIZE / 2 + 1));
+                }
+            }
+        }
+
+        ASSERT(Obj::k_NUM_SIZE_CLASSES - 1 ==
+                               Obj::sizeClass(~static_cast<size_type>(0)));
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::sizeClass(1));
+            ASSERT_FAIL(Obj::sizeClass(0));
+
+            ASSERT_PASS(Obj::sizeClassUpperBound(0));
+            ASSERT_PASS(Obj::sizeClassUpperBound(Obj::k_NUM_SIZE_CLASSES - 1));
+            ASSERT_FAIL(Obj::sizeClassUpperBound(-1));
+            ASSERT_FAIL(Obj::sizeClassUpperBound(Obj::k_NUM_SIZE_CLASSES));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate, sample, and deallocate a few blocks, and write a
+        //:   report.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("upstream", veryVeryVerbose);
+        bslma::TestAllocator sa("stream",   veryVeryVerbose);
+
+        Obj mX(2, &ta);  const Obj& X = mX;
+
+        void *p = mX.allocate(10);
+        void *q = mX.allocate(20);
+        void *r = mX.allocate(30);
+
+        ASSERT(3 == X.numAllocations());
+        ASSERT(60 == X.numBytesAllocated());
+        ASSERT(1 == X.numSamples());
+        ASSERT(1 == X.numSampledBlocksInUse());
+        ASSERT(3 == ta.numBlocksInUse());
+
+        mX.deallocate(q);
+        ASSERT(0 == X.numSampledBlocksInUse());
+
+        mX.deallocate(p);
+        mX.deallocate(r);
+        ASSERT(3 == X.numDeallocations());
+        ASSERT(0 == ta.numBlocksInUse());
+
+        bsl::ostringstream stream(&sa);
+        X.report(stream);
+        if (veryVerbose) cout << stream.str();
+        ASSERT(bsl::string::npos != stream.str().find("Call stack 1"));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: OVERHEAD OF THE ADAPTOR
+        //
+        // Concerns:
+        //: 1 The cost that the adaptor adds to an allocation and deallocation
+        //:   is small when the allocation is not sampled.
+        //
+        // Plan:
+        //: 1 Time many pairs of allocation and deallocation from the
+        //:   new/delete allocator directly, and through sampling allocators
+        //:   with several sampling intervals, and report the time per pair.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BENCHMARK: overhead of the adaptor
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BENCHMARK: OVERHEAD OF THE ADAPTOR" << endl
+                          << "==================================" << endl;
+
+        enum { k_NUM_PAIRS = 4 * 1000 * 1000 };
+
+        bslma::NewDeleteAllocator& newDelete =
+                                       bslma::NewDeleteAllocator::singleton();
+
+        static const int INTERVALS[] = { 0, 1 << 16, 1021, 31 };
+        const int NUM_INTERVALS = sizeof INTERVALS / sizeof *INTERVALS;
+
+        for (int ti = 0; ti < NUM_INTERVALS; ++ti) {
+            const int INTERVAL = INTERVALS[ti];
+
+            Obj               mX(INTERVAL ? INTERVAL : 1, &newDelete);
+            bslma::Allocator *allocator = INTERVAL
+                                        ? static_cast<bslma::Allocator *>(&mX)
+                                        : &newDelete;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                allocator->deallocate(allocator->allocate(16 + i % 256));
+            }
+            timer.stop();
+
+            cout << "interval=" << (INTERVAL ? INTERVAL : 0)
+                 << ",nsPerPair="
+                 << timer.elapsedTime() * 1e9 / k_NUM_PAIRS << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
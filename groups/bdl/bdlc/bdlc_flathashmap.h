@@ -0,0 +1,921 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//
+//@SEE_ALSO: bdlc_flathashset, bdlc_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', implementing a value-semantic container that maps
+// unique keys to values, and that is largely interface-compatible with
+// 'bsl::unordered_map'.  Unlike 'bsl::unordered_map', which allocates a node
+// for each element and chains the nodes of each bucket in a linked list,
+// 'bdlc::FlatHashMap' stores its elements inline in a single array and
+// resolves collisions by open addressing, using an auxiliary array of one-byte
+// control values that are probed 16 at a time (with SSE2 instructions where
+// available).  See 'bdlc_flathashtable' for details of the implementation.
+//
+// The flat layout has the following consequences:
+//
+//: o Inserting an element does not allocate memory, except when the map
+//:   grows, and a lookup typically touches a single cache line of control
+//:   bytes and a single element.
+//:
+//: o Elements are moved when the map grows (or is rehashed), so iterators,
+//:   pointers, and references to elements are invalidated by any insertion
+//:   that causes a rehash.  Clients that require stable element addresses
+//:   should use 'bsl::unordered_map'.
+//:
+//: o Unused slots of the element array are not constructed, but occupy
+//:   'sizeof(value_type)' bytes each; for very large 'value_type' objects,
+//:   storing pointers (or using 'bsl::unordered_map') may be preferable.
+//
+// 'bdlc::FlatHashMap' uses the 'bslma::Allocator' protocol for all memory
+// allocation, and propagates its allocator to its elements if they use
+// 'bslma'-style allocation.  The 'HASH' functor defaults to 'bsl::hash<KEY>';
+// 'bslh::Hash<>' (or any other 'bslh'-style hash functor) may be supplied
+// instead.  Since the map mixes the hash values it is given, a weak hash
+// function (such as the identity function 'bsl::hash' provides for integral
+// types) does not cause clustering.
+//
+// The value type of the map is 'bsl::pair<KEY, VALUE>' (rather than
+// 'bsl::pair<const KEY, VALUE>' as for 'bsl::unordered_map'), allowing
+// elements to be moved efficiently; the behavior is undefined if the key of
+// an element is modified through an iterator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Symbol Table
+/// - - - - - - - - - - - - - - - - -
+// Suppose we are writing a linker and need a table mapping symbol names to
+// addresses that is consulted far more often than it is modified.
+//
+// First, we create a map, supplying an allocator, and reserve room for the
+// expected number of symbols so that no rehash occurs while loading them:
+//..
+//  bslma::TestAllocator oa("object");
+//
+//  bdlc::FlatHashMap<bsl::string, int> symbols(&oa);
+//  symbols.reserve(3);
+//..
+// Then, we insert a few symbols:
+//..
+//  symbols.insert(bsl::make_pair(bsl::string("main"),   0x1000));
+//  symbols.insert(bsl::make_pair(bsl::string("printf"), 0x2040));
+//  symbols["exit"] = 0x2080;
+//
+//  assert(3 == symbols.size());
+//..
+// Next, we look up symbols by name:
+//..
+//  assert(0x2040 == symbols.at("printf"));
+//  assert(symbols.contains("exit"));
+//  assert(symbols.end() == symbols.find("malloc"));
+//..
+// Finally, we observe that inserting a duplicate key leaves the map
+// unchanged:
+//..
+//  bsl::pair<bdlc::FlatHashMap<bsl::string, int>::iterator, bool> rv =
+//                      symbols.insert(bsl::make_pair(bsl::string("main"), 7));
+//
+//  assert(false  == rv.second);
+//  assert(0x1000 == rv.first->second);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable.h>
+
+#include <bslalg_constructorproxy.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ============================
+                        // struct FlatHashMap_EntryUtil
+                        // ============================
+
+template <class KEY, class VALUE>
+struct FlatHashMap_EntryUtil {
+    // This 'struct' provides the utility functions required by
+    // 'FlatHashTable' for entries of type 'bsl::pair<KEY, VALUE>'.
+
+    // CLASS METHODS
+    static void constructFromKey(bsl::pair<KEY, VALUE> *entry,
+                                 bslma::Allocator      *allocator,
+                                 const KEY&             key);
+        // Create, at the specified 'entry' address, a pair having the
+        // specified 'key' and a default-constructed 'VALUE', using the
+        // specified 'allocator' to supply memory.
+
+    static const KEY& key(const bsl::pair<KEY, VALUE>& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic container that maps
+    // unique keys of the (template parameter) type 'KEY' to values of the
+    // (template parameter) type 'VALUE', storing its elements inline in an
+    // open-addressed hash table.  See the component-level documentation for
+    // details.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          bsl::pair<KEY, VALUE>,
+                          FlatHashMap_EntryUtil<KEY, VALUE>,
+                          HASH,
+                          EQUAL> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying flat hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef VALUE                                mapped_type;
+    typedef bsl::pair<KEY, VALUE>                value_type;
+    typedef bsl::size_t                          size_type;
+    typedef bsl::ptrdiff_t                       difference_type;
+    typedef HASH                                 hasher;
+    typedef EQUAL                                key_equal;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef value_type                          *pointer;
+    typedef const value_type                    *const_pointer;
+    typedef typename ImplType::iterator          iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t       capacity,
+                         bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'capacity' indicating the
+        // minimum initial number of slots of the map.  If 'capacity' is not
+        // supplied or is 0, no memory is allocated.  Optionally specify a
+        // 'hash' functor used to generate hash values for keys.  If 'hash' is
+        // not supplied, a default-constructed 'HASH' is used.  Optionally
+        // specify an 'equal' functor used to compare keys for equality.  If
+        // 'equal' is not supplied, a default-constructed 'EQUAL' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash = HASH(),
+                const EQUAL&      equal = EQUAL(),
+                bslma::Allocator *basicAllocator = 0);
+        // Create a map and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those having a key
+        // that appears earlier in the sequence.  Optionally specify a
+        // 'capacity' indicating the minimum initial number of slots of the
+        // map.  Optionally specify a 'hash' functor used to generate hash
+        // values for keys.  If 'hash' is not supplied, a default-constructed
+        // 'HASH' is used.  Optionally specify an 'equal' functor used to
+        // compare keys for equality.  If 'equal' is not supplied, a
+        // default-constructed 'EQUAL' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '[first .. last)' is a valid range.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a map having the same value, hash functor, and equality
+        // functor as the specified 'original' map.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap> original);
+        // Create a map having the same value, hash functor, equality functor,
+        // and allocator as the specified 'original' map, leaving 'original'
+        // empty.  No memory is allocated.
+
+    FlatHashMap(bslmf::MovableRef<FlatHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+        // Create a map having the same value, hash functor, and equality
+        // functor as the specified 'original' map, using the specified
+        // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+        // currently installed default allocator is used.  If 'original' uses
+        // the same allocator, its storage is transferred and 'original' is
+        // left empty; otherwise, 'original' is copied and left unchanged.
+
+    ~FlatHashMap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this map the value, hash functor, and equality functor of
+        // the specified 'rhs' map, and return a reference providing modifiable
+        // access to this map.
+
+    FlatHashMap& operator=(bslmf::MovableRef<FlatHashMap> rhs);
+        // Assign to this map the value, hash functor, and equality functor of
+        // the specified 'rhs' map, and return a reference providing modifiable
+        // access to this map.  If 'rhs' uses the same allocator as this map,
+        // its storage is transferred and 'rhs' is left empty; otherwise, 'rhs'
+        // is copied and left unchanged.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // element having the specified 'key', first inserting an element
+        // having 'key' and a default-constructed 'VALUE' if there is no such
+        // element.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // element having the specified 'key'.  Throw 'bsl::out_of_range' if
+        // there is no such element.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of this
+        // map is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element having the specified 'key', if it
+        // exists, and return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the element following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return 'last'.  The behavior is undefined unless
+        // '[first .. last)' is a valid range of elements of this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if an element
+        // having the same key does not already exist.  Return a pair whose
+        // 'first' member refers to the element having the key of 'value', and
+        // whose 'second' member is 'true' if the insertion was performed and
+        // 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map, using its move
+        // constructor, if an element having the same key does not already
+        // exist.  Return a pair whose 'first' member refers to the element
+        // having the key of 'value', and whose 'second' member is 'true' if
+        // the insertion was performed and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those having a key
+        // already in this map.  The behavior is undefined unless
+        // '[first .. last)' is a valid range.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to at least the specified
+        // 'minimumCapacity' (and enough to hold its elements), and
+        // redistribute the elements.  If the resulting capacity is 0, release
+        // all memory.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this map, if needed, so that the specified
+        // 'numElements' may be held without a rehash.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, hash functor, and equality functor of this map
+        // with those of the specified 'other' map.  This method provides the
+        // no-throw exception-safety guarantee.  The behavior is undefined
+        // unless this map and 'other' use the same allocator.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value of
+        // the element having the specified 'key'.  Throw 'bsl::out_of_range'
+        // if there is no such element.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map holds an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this map having the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map holds no elements, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key equality functor of this map.
+
+    float load_factor() const;
+        // Return the ratio of the number of elements to the capacity of this
+        // map, or 0 if the capacity is 0.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this map.  Note that the value
+        // returned is fixed at 0.875.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same
+    // value, and 'false' otherwise.  Two maps have the same value if they
+    // have the same number of elements and, for each element of 'lhs', 'rhs'
+    // holds an element having the same key and an equal value.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  If 'a' and 'b'
+    // use different allocators, the exchange is performed by copying.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatHashMap_EntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                                         bsl::pair<KEY, VALUE> *entry,
+                                         bslma::Allocator      *allocator,
+                                         const KEY&             key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    // The value is default-constructed using 'allocator' (rather than as a
+    // temporary using the default allocator) and then moved into the entry.
+
+    bslalg::ConstructorProxy<VALUE> value(allocator);
+
+    bslma::ConstructionUtil::construct(
+                                  entry,
+                                  allocator,
+                                  key,
+                                  bslmf::MovableRefUtil::move(value.object()));
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE>::key(
+                                            const bsl::pair<KEY, VALUE>& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          const FlatHashMap&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                       bslmf::MovableRef<FlatHashMap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                             bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                              bslmf::MovableRef<FlatHashMap>  original,
+                              bslma::Allocator               *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                             bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::~FlatHashMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<FlatHashMap> rhs)
+{
+    d_impl = bslmf::MovableRefUtil::move(
+                                   bslmf::MovableRefUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.tryEmplace(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    const iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                         "FlatHashMap<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    // Erasing never moves other elements, so 'last' remains valid.
+
+    while (first != last) {
+        first = d_impl.erase(first);
+    }
+    return iterator(last.imp());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                          bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insert(bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                   "FlatHashMap<...>::at(key_type) const: invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hasher();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.equalityComparator();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.loadFactor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.maxLoadFactor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureA(b, a.allocator());
+    FlatHashMap<KEY, VALUE, HASH, EQUAL> futureB(a, b.allocator());
+
+    a.swap(futureA);
+    b.swap(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
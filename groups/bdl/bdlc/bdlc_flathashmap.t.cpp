@@ -0,0 +1,1164 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a value-semantic container,
+// 'bdlc::FlatHashMap', as a thin wrapper around 'bdlc::FlatHashTable' (which
+// is thoroughly tested in its own component).  The concerns here are
+// therefore that each method forwards correctly, that the map-specific
+// methods ('operator[]', 'at') behave as specified, and that the allocator
+// and hash functor are used as documented.  Two negative test cases compare
+// the performance of the map with that of 'bsl::unordered_map' for 'int' and
+// 'bsl::string' keys.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] FlatHashMap(bsl::size_t capacity, bslma::Allocator *bA = 0);
+// [ 2] FlatHashMap(capacity, hash, bslma::Allocator *bA = 0);
+// [ 2] FlatHashMap(capacity, hash, equal, bslma::Allocator *bA = 0);
+// [ 5] FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+// [ 5] FlatHashMap(first, last, capacity, hash, equal, *bA = 0);
+// [ 4] FlatHashMap(const FlatHashMap& original, *bA = 0);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap> original);
+// [ 4] FlatHashMap(MovableRef<FlatHashMap> original, *bA);
+// [ 2] ~FlatHashMap();
+//
+// MANIPULATORS
+// [ 4] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 4] FlatHashMap& operator=(MovableRef<FlatHashMap> rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 3] void clear();
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const value_type& value);
+// [ 3] pair<iterator, bool> insert(MovableRef<value_type> value);
+// [ 5] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void rehash(bsl::size_t minimumCapacity);
+// [ 3] void reserve(bsl::size_t numElements);
+// [ 4] void swap(FlatHashMap& other);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 3] bsl::size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] bsl::size_t count(const KEY& key) const;
+// [ 3] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 6] HASH hash_function() const;
+// [ 6] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] bsl::size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 4] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashMap& a, FlatHashMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 6] CONCERN: 'bslh::Hash' may be used as the hash functor.
+// [ 2] CONCERN: The allocator is propagated to the elements.
+// [-1] PERFORMANCE: 'int' KEYS
+// [-2] PERFORMANCE: 'bsl::string' KEYS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashMap<int, int>                 Obj;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StrObj;
+
+typedef bslmf::MovableRefUtil                       MoveUtil;
+
+                               // ==============
+                               // struct ModHash
+                               // ==============
+
+struct ModHash {
+    // This 'struct' provides a hash functor consistent with 'ModEqual'.
+
+    int d_divisor;
+
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' modulo 'd_divisor'.
+    {
+        return static_cast<bsl::size_t>(key % d_divisor);
+    }
+};
+
+                               // ===============
+                               // struct ModEqual
+                               // ===============
+
+struct ModEqual {
+    // This 'struct' provides an equality functor that considers two integers
+    // equal if they are congruent modulo 'd_divisor'.
+
+    int d_divisor;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are congruent modulo
+        // 'd_divisor', and 'false' otherwise.
+    {
+        return lhs % d_divisor == rhs % d_divisor;
+    }
+};
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+// ============================================================================
+//                          HELPERS FOR BENCHMARKS
+// ----------------------------------------------------------------------------
+
+namespace benchmark {
+
+template <class MAP, class KEY>
+void run(const char              *name,
+         const bsl::vector<KEY>&  keys,
+         const bsl::vector<KEY>&  missingKeys,
+         int                      numRounds)
+    // Report the time taken, by a map of the (template parameter) type 'MAP'
+    // constructed with a test allocator, to insert each of the specified
+    // 'keys', look up each of them and each of the specified 'missingKeys'
+    // the specified 'numRounds' times, iterate over the map, and erase each of
+    // 'keys', as well as the number of allocations performed, labeling the
+    // results with the specified 'name'.
+{
+    bslma::TestAllocator ta("benchmark");
+
+    bsls::Stopwatch timer;
+    int             checksum = 0;
+
+    MAP map(&ta);
+
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        map[keys[i]] = static_cast<int>(i);
+    }
+    timer.stop();
+    const double insertTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            checksum += map.find(keys[i])->second;
+        }
+    }
+    timer.stop();
+    const double hitTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (bsl::size_t i = 0; i < missingKeys.size(); ++i) {
+            checksum += map.end() == map.find(missingKeys[i]);
+        }
+    }
+    timer.stop();
+    const double missTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (typename MAP::const_iterator it = map.begin();
+             it != map.end();
+             ++it) {
+            checksum += it->second;
+        }
+    }
+    timer.stop();
+    const double iterateTime = timer.accumulatedWallTime();
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+    const bsls::Types::Int64 numBytes       = ta.numBytesInUse();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        map.erase(keys[i]);
+    }
+    timer.stop();
+    const double eraseTime = timer.accumulatedWallTime();
+
+    const double numLookups = static_cast<double>(keys.size()) * numRounds;
+    const double numKeys    = static_cast<double>(keys.size());
+
+    bsl::printf("%-22s insert %6.1f  hit %6.1f  miss %6.1f  iterate %6.2f"
+                "  erase %6.1f ns/op;  %8lld allocations, %10lld bytes"
+                "  (checksum %d)\n",
+                name,
+                insertTime  * 1e9 / numKeys,
+                hitTime     * 1e9 / numLookups,
+                missTime    * 1e9 / numLookups,
+                iterateTime * 1e9 / numLookups,
+                eraseTime   * 1e9 / numKeys,
+                static_cast<long long>(numAllocations),
+                static_cast<long long>(numBytes),
+                checksum);
+}
+
+}  // close namespace benchmark
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Symbol Table
+/// - - - - - - - - - - - - - - - - -
+// Suppose we are writing a linker and need a table mapping symbol names to
+// addresses that is consulted far more often than it is modified.
+//
+// First, we create a map, supplying an allocator, and reserve room for the
+// expected number of symbols so that no rehash occurs while loading them:
+//..
+    bslma::TestAllocator oa("object");
+
+    bdlc::FlatHashMap<bsl::string, int> symbols(&oa);
+    symbols.reserve(3);
+//..
+// Then, we insert a few symbols:
+//..
+    symbols.insert(bsl::make_pair(bsl::string("main"),   0x1000));
+    symbols.insert(bsl::make_pair(bsl::string("printf"), 0x2040));
+    symbols["exit"] = 0x2080;
+
+    ASSERT(3 == symbols.size());
+//..
+// Next, we look up symbols by name:
+//..
+    ASSERT(0x2040 == symbols.at("printf"));
+    ASSERT(symbols.contains("exit"));
+    ASSERT(symbols.end() == symbols.find("malloc"));
+//..
+// Finally, we observe that inserting a duplicate key leaves the map
+// unchanged:
+//..
+    bsl::pair<bdlc::FlatHashMap<bsl::string, int>::iterator, bool> rv =
+                        symbols.insert(bsl::make_pair(bsl::string("main"), 7));
+
+    ASSERT(false  == rv.second);
+    ASSERT(0x1000 == rv.first->second);
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // HASH AND EQUALITY FUNCTORS
+        //
+        // Concerns:
+        //: 1 The map uses the supplied hash and equality functors, and
+        //:   returns copies of them from 'hash_function' and 'key_eq'.
+        //:
+        //: 2 'bslh::Hash<>' may be used as the hash functor.
+        //
+        // Plan:
+        //: 1 Use a stateful equality functor that compares keys modulo a
+        //:   divisor, with a hash functor consistent with it, and verify
+        //:   that keys equal under the functor are treated as duplicates.
+        //:   (C-1)
+        //:
+        //: 2 Instantiate the map with 'bslh::Hash<>' for 'int' and
+        //:   'bsl::string' keys and exercise it.  (C-2)
+        //
+        // Testing:
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   CONCERN: 'bslh::Hash' may be used as the hash functor.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HASH AND EQUALITY FUNCTORS" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const ModHash  HASH  = { 10 };
+        const ModEqual EQUAL = { 10 };
+
+        bdlc::FlatHashMap<int, int, ModHash, ModEqual> mX(0, HASH, EQUAL, &oa);
+
+        ASSERT(10 == mX.hash_function().d_divisor);
+        ASSERT(10 == mX.key_eq().d_divisor);
+
+        for (int i = 0; i < 100; ++i) {
+            mX[i] += 1;
+        }
+        ASSERT(10 == mX.size());
+        ASSERT(10 == mX[3]);
+        ASSERT(mX.contains(73));
+
+        bdlc::FlatHashMap<int, int, bslh::Hash<> > mY(&oa);
+        for (int i = 0; i < 1000; ++i) {
+            mY[i * 31] = i;
+        }
+        ASSERT(1000 == mY.size());
+        for (int i = 0; i < 1000; ++i) {
+            ASSERTV(i, i == mY.at(i * 31));
+        }
+
+        bdlc::FlatHashMap<bsl::string, int, bslh::Hash<> > mZ(&oa);
+        bsl::string key(&oa);
+        for (int i = 0; i < 200; ++i) {
+            key.assign(1 + i % 7, static_cast<char>('a' + i % 26));
+            key += static_cast<char>('0' + i / 26);
+            mZ[key] = i;
+        }
+        ASSERT(200 == mZ.size());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // RANGE CONSTRUCTORS AND RANGE INSERTION
+        //
+        // Concerns:
+        //: 1 The range constructors and range 'insert' insert each element
+        //:   of the range whose key is not already present, keeping the
+        //:   first occurrence.
+        //:
+        //: 2 The supplied capacity, hash, equality, and allocator are used.
+        //
+        // Plan:
+        //: 1 Construct maps from a vector of pairs containing duplicates,
+        //:   and verify the contents against a 'bsl::map' oracle.  (C-1..2)
+        //
+        // Testing:
+        //   FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+        //   FlatHashMap(first, last, capacity, hash, equal, *bA = 0);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGE CONSTRUCTORS AND RANGE INSERTION" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::pair<int, int> > values(&sa);
+        bsl::map<int, int>                oracle(&sa);
+
+        for (int i = 0; i < 500; ++i) {
+            const int key = (i * 37) % 211;
+            values.push_back(bsl::make_pair(key, i));
+            oracle.insert(bsl::make_pair(key, i));
+        }
+
+        {
+            Obj mX(values.begin(), values.end(), &oa);  const Obj& X = mX;
+
+            ASSERT(oracle.size() == X.size());
+            ASSERT(&oa == X.allocator());
+            for (bsl::map<int, int>::const_iterator it = oracle.begin();
+                 it != oracle.end();
+                 ++it) {
+                ASSERTV(it->first, it->second == X.at(it->first));
+            }
+        }
+        {
+            Obj mX(values.begin(),
+                   values.end(),
+                   1000,
+                   bsl::hash<int>(),
+                   bsl::equal_to<int>(),
+                   &oa);
+            const Obj& X = mX;
+
+            ASSERT(oracle.size() == X.size());
+            ASSERT(1024          == X.capacity());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX[3] = -1;
+            mX.insert(values.begin(), values.end());
+
+            ASSERT(oracle.size() == X.size());
+            ASSERT(-1 == X.at(3));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value and use the supplied allocator.
+        //:
+        //: 2 Moves with the same allocator do not allocate and leave the
+        //:   source empty; moves with a different allocator copy.
+        //:
+        //: 3 Equality compares keys and mapped values, independently of
+        //:   insertion order.
+        //:
+        //: 4 Member 'swap' does not allocate; free 'swap' works with
+        //:   different allocators.
+        //
+        // Plan:
+        //: 1 Perform each operation on maps of strings, monitoring the
+        //:   allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, *bA = 0);
+        //   FlatHashMap(MovableRef<FlatHashMap> original);
+        //   FlatHashMap(MovableRef<FlatHashMap> original, *bA);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   FlatHashMap& operator=(MovableRef<FlatHashMap> rhs);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                 << "==========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        StrObj mX(&oa);  const StrObj& X = mX;
+        StrObj mW(&za);  const StrObj& W = mW;
+
+        bsl::string key(&oa);
+        bsl::string value(SUFFICIENTLY_LONG_STRING, &oa);
+        for (int i = 0; i < 50; ++i) {
+            key.assign(1, static_cast<char>('A' + i % 26));
+            key += static_cast<char>('0' + i / 26);
+            mX[key] = value;
+        }
+        for (int i = 49; i >= 0; --i) {
+            key.assign(1, static_cast<char>('A' + i % 26));
+            key += static_cast<char>('0' + i / 26);
+            mW[key] = value;
+        }
+
+        ASSERT(X == W);
+        ASSERT(!(X != W));
+
+        mW["A0"] = "different";
+        ASSERT(X != W);
+        mW["A0"] = value;
+        ASSERT(X == W);
+
+        {
+            StrObj mY(X, &za);  const StrObj& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(&za == Y.allocator());
+            ASSERT(&za == Y.begin()->second.get_allocator().mechanism());
+        }
+        {
+            StrObj mS(X, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            StrObj mY(MoveUtil::move(mS));  const StrObj& Y = mY;
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == Y);
+            ASSERT(mS.empty());
+
+            StrObj mZ(MoveUtil::move(mY), &za);  const StrObj& Z = mZ;
+
+            ASSERT(X == Z);
+            ASSERT(X == Y);
+            ASSERT(&za == Z.allocator());
+        }
+        {
+            StrObj mY(&za);
+
+            mY = X;
+            ASSERT(X == mY);
+            ASSERT(&za == mY.allocator());
+
+            StrObj mS(X, &za);
+            mY.clear();
+            mY = MoveUtil::move(mS);
+            ASSERT(X == mY);
+            ASSERT(mS.empty());
+        }
+        {
+            StrObj mA(X, &oa);
+            StrObj mB(&oa);
+            mB["k"] = "v";
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mA.swap(mB);
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == mB);
+            ASSERT(1 == mA.size());
+
+            StrObj mC(&za);
+            swap(mB, mC);
+            ASSERT(X == mC);
+            ASSERT(mB.empty());
+            ASSERT(&za == mC.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS, INSERTION, LOOKUP, AND REMOVAL
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed value when the key is
+        //:   absent, and returns a reference to the mapped value.
+        //:
+        //: 2 'at' returns the mapped value, and throws 'bsl::out_of_range'
+        //:   when the key is absent.
+        //:
+        //: 3 'insert' does not overwrite an existing element.
+        //:
+        //: 4 'find', 'count', and 'contains' agree; iteration visits each
+        //:   element exactly once.
+        //:
+        //: 5 Each 'erase' overload removes the specified elements.
+        //:
+        //: 6 'reserve', 'rehash', 'capacity', and the load factors behave as
+        //:   documented.
+        //
+        // Plan:
+        //: 1 Exercise each method on maps of 'int' and of 'bsl::string',
+        //:   verifying against expected values.  (C-1..6)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   pair<iterator, bool> insert(MovableRef<value_type> value);
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numElements);
+        //   iterator begin();
+        //   iterator end();
+        //   const VALUE& at(const KEY& key) const;
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY& key) const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   bsl::size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+             << "ELEMENT ACCESS, INSERTION, LOOKUP, AND REMOVAL" << endl
+             << "==============================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\t'operator[]' and 'at'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0 == mX[5]);
+            ASSERT(1 == X.size());
+
+            mX[5] = 50;
+            ASSERT(50 == mX[5]);
+            ASSERT(50 == mX.at(5));
+            ASSERT(50 == X.at(5));
+
+            mX.at(5) = 55;
+            ASSERT(55 == X.at(5));
+
+            bool caught = false;
+            try {
+                mX.at(6);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(6);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(1 == X.size());
+        }
+
+        if (verbose) cout << "\t'insert', 'find', 'count', 'contains'."
+                          << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(0.0f   == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+
+            bsl::pair<Obj::iterator, bool> rv =
+                                            mX.insert(bsl::make_pair(1, 10));
+            ASSERT(rv.second);
+            ASSERT(1  == rv.first->first);
+            ASSERT(10 == rv.first->second);
+
+            rv = mX.insert(bsl::make_pair(1, 20));
+            ASSERT(!rv.second);
+            ASSERT(10 == rv.first->second);
+
+            bsl::pair<int, int> value(2, 20);
+            rv = mX.insert(MoveUtil::move(value));
+            ASSERT(rv.second);
+
+            ASSERT(2 == X.size());
+            ASSERT(!X.empty());
+            ASSERT(16 == X.capacity());
+            ASSERT(2.0f / 16.0f == X.load_factor());
+
+            ASSERT(1 == X.count(1));
+            ASSERT(0 == X.count(3));
+            ASSERT(X.contains(2));
+            ASSERT(!X.contains(3));
+            ASSERT(X.find(3) == X.end());
+            ASSERT(mX.find(3) == mX.end());
+            ASSERT(20 == X.find(2)->second);
+
+            mX.find(2)->second = 21;
+            ASSERT(21 == X.at(2));
+
+            for (int i = 3; i < 1000; ++i) {
+                mX[i] = i * 10;
+            }
+
+            int count = 0;
+            bsls::Types::Int64 sum = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ++count;
+                sum += it->first;
+            }
+            ASSERT(999    == count);
+            ASSERT(499500 == sum);
+
+            count = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second = 0;
+                ++count;
+            }
+            ASSERT(999 == count);
+            ASSERT(0   == X.at(500));
+        }
+
+        if (verbose) cout << "\t'erase'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+
+            ASSERT(1 == mX.erase(7));
+            ASSERT(0 == mX.erase(7));
+            ASSERT(99 == X.size());
+
+            Obj::iterator it = mX.find(8);
+            mX.erase(it);
+            ASSERT(!X.contains(8));
+
+            Obj::const_iterator cit = X.find(9);
+            mX.erase(cit);
+            ASSERT(!X.contains(9));
+            ASSERT(97 == X.size());
+
+            Obj::const_iterator last = X.begin();
+            for (int i = 0; i < 10; ++i) {
+                ++last;
+            }
+            ASSERT(last == mX.erase(X.begin(), last));
+            ASSERT(87 == X.size());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+
+            mX[1] = 1;
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(16 <= X.capacity());
+        }
+
+        if (verbose) cout << "\t'reserve' and 'rehash'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(100);
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERT(128 == CAPACITY);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(CAPACITY  == X.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, i == X.at(i));
+            }
+
+            mX.clear();
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tString keys." << endl;
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            const bsl::string LONG(SUFFICIENTLY_LONG_STRING, &oa);
+
+            mX[LONG] = LONG;
+            ASSERT(X.contains(LONG));
+            ASSERT(LONG == X.at(LONG));
+            ASSERT(&oa  == X.begin()->first.get_allocator().mechanism());
+            ASSERT(&oa  == X.begin()->second.get_allocator().mechanism());
+
+            ASSERT(1 == mX.erase(LONG));
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND ALLOCATOR
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty map using the expected
+        //:   allocator, hash functor, and capacity.
+        //:
+        //: 2 A map created without a capacity allocates no memory.
+        //:
+        //: 3 The allocator of the map is propagated to its elements, and no
+        //:   memory is obtained from the default allocator when an object
+        //:   allocator is supplied.
+        //
+        // Plan:
+        //: 1 Create maps using each constructor and verify their state and
+        //:   the allocators' usage.  (C-1..3)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   FlatHashMap(bslma::Allocator *basicAllocator);
+        //   FlatHashMap(bsl::size_t capacity, bslma::Allocator *bA = 0);
+        //   FlatHashMap(capacity, hash, bslma::Allocator *bA = 0);
+        //   FlatHashMap(capacity, hash, equal, bslma::Allocator *bA = 0);
+        //   ~FlatHashMap();
+        //   bslma::Allocator *allocator() const;
+        //   CONCERN: The allocator is propagated to the elements.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND ALLOCATOR" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        {
+            Obj mX(100, &oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(128 == X.capacity());
+            ASSERT(2   == oa.numBlocksInUse());
+        }
+        {
+            Obj mX(16, bsl::hash<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(16  == X.capacity());
+        }
+        {
+            Obj mX(17, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(&oa == X.allocator());
+            ASSERT(32  == X.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            StrObj mX(&oa);
+
+            const bsl::string LONG(SUFFICIENTLY_LONG_STRING, &oa);
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            mX[LONG] = LONG;
+
+            // Two arrays plus two strings.
+
+            ASSERT(NUM_BLOCKS + 4 == oa.numBlocksInUse());
+            ASSERT(&oa == mX[LONG].get_allocator().mechanism());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, look up, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            mX[i] = i * i;
+        }
+        ASSERT(100 == X.size());
+        ASSERT(81  == X.at(9));
+
+        mX.erase(9);
+        ASSERT(!X.contains(9));
+
+        Obj mY(X, &oa);
+        ASSERT(X == mY);
+
+        mY[9] = 0;
+        ASSERT(X != mY);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'int' KEYS
+        //   Compare 'bdlc::FlatHashMap<int, int>' with
+        //   'bsl::unordered_map<int, int>'.  Command line parameters:
+        //   2nd parameter: number of keys (default: 100000)
+        //   3rd parameter: number of lookup rounds (default: 10)
+        //
+        // Concerns:
+        //: 1 The flat map performs fewer allocations, uses less memory, and
+        //:   looks up keys faster than the node-based map.
+        //
+        // Plan:
+        //: 1 Time insertion, successful and unsuccessful lookup, iteration,
+        //:   and removal of pseudo-random keys in each map, and report the
+        //:   results.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'int' KEYS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'int' KEYS" << endl
+             << "=======================" << endl;
+
+        const int numKeys   = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numRounds = argc > 3 ? atoi(argv[3]) : 10;
+
+        bslma::TestAllocator sa("scratch");
+
+        bsl::vector<int> keys(&sa);
+        bsl::vector<int> missingKeys(&sa);
+
+        unsigned int state = 1;
+        for (int i = 0; i < numKeys; ++i) {
+            state = state * 1103515245 + 12345;
+            keys.push_back(static_cast<int>(state & 0x7FFFFFFE));
+            missingKeys.push_back(static_cast<int>(state & 0x7FFFFFFE) | 1);
+        }
+
+        benchmark::run<bsl::unordered_map<int, int> >("bsl::unordered_map",
+                                                      keys,
+                                                      missingKeys,
+                                                      numRounds);
+        benchmark::run<bdlc::FlatHashMap<int, int> >("bdlc::FlatHashMap",
+                                                     keys,
+                                                     missingKeys,
+                                                     numRounds);
+        benchmark::run<bdlc::FlatHashMap<int, int, bslh::Hash<> > >(
+                                                   "bdlc::FlatHashMap/bslh",
+                                                   keys,
+                                                   missingKeys,
+                                                   numRounds);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'bsl::string' KEYS
+        //   Compare 'bdlc::FlatHashMap<bsl::string, int>' with
+        //   'bsl::unordered_map<bsl::string, int>'.  Command line parameters:
+        //   2nd parameter: number of keys (default: 100000)
+        //   3rd parameter: number of lookup rounds (default: 10)
+        //   4th parameter: key length (default: 16)
+        //
+        // Concerns:
+        //: 1 The flat map performs fewer allocations and looks up keys faster
+        //:   than the node-based map, also when comparing keys is costly.
+        //
+        // Plan:
+        //: 1 Time insertion, successful and unsuccessful lookup, iteration,
+        //:   and removal of pseudo-random symbol-like keys in each map, and
+        //:   report the results.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'bsl::string' KEYS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'bsl::string' KEYS" << endl
+             << "===============================" << endl;
+
+        const int numKeys   = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numRounds = argc > 3 ? atoi(argv[3]) : 10;
+        const int keyLength = argc > 4 ? atoi(argv[4]) : 16;
+
+        bslma::TestAllocator sa("scratch");
+
+        bsl::vector<bsl::string> keys(&sa);
+        bsl::vector<bsl::string> missingKeys(&sa);
+
+        unsigned int state = 1;
+        for (int i = 0; i < numKeys; ++i) {
+            bsl::string key(&sa);
+            for (int j = 0; j < keyLength; ++j) {
+                state = state * 1103515245 + 12345;
+                key += static_cast<char>('a' + (state >> 16) % 26);
+            }
+            keys.push_back(key);
+            key[0] = '_';
+            missingKeys.push_back(key);
+        }
+
+        benchmark::run<bsl::unordered_map<bsl::string, int> >(
+                                                        "bsl::unordered_map",
+                                                        keys,
+                                                        missingKeys,
+                                                        numRounds);
+        benchmark::run<bdlc::FlatHashMap<bsl::string, int> >(
+                                                        "bdlc::FlatHashMap",
+                                                        keys,
+                                                        missingKeys,
+                                                        numRounds);
+        benchmark::run<bdlc::FlatHashMap<bsl::string, int, bslh::Hash<> > >(
+                                                   "bdlc::FlatHashMap/bslh",
+                                                   keys,
+                                                   missingKeys,
+                                                   numRounds);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
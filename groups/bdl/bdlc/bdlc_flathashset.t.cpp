@@ -0,0 +1,779 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a value-semantic container,
+// 'bdlc::FlatHashSet', as a thin wrapper around 'bdlc::FlatHashTable' (which
+// is thoroughly tested in its own component).  The concerns here are
+// therefore that each method forwards correctly to the underlying table and
+// that the allocator is used as documented.  A negative test case compares
+// the performance of the set with that of 'bsl::unordered_set'.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] FlatHashSet(bslma::Allocator *basicAllocator);
+// [ 2] FlatHashSet(bsl::size_t capacity, bslma::Allocator *bA = 0);
+// [ 2] FlatHashSet(capacity, hash, bslma::Allocator *bA = 0);
+// [ 2] FlatHashSet(capacity, hash, equal, bslma::Allocator *bA = 0);
+// [ 2] FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+// [ 2] FlatHashSet(first, last, capacity, hash, equal, *bA = 0);
+// [ 3] FlatHashSet(const FlatHashSet& original, *bA = 0);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet> original);
+// [ 3] FlatHashSet(MovableRef<FlatHashSet> original, *bA);
+// [ 2] ~FlatHashSet();
+//
+// MANIPULATORS
+// [ 3] FlatHashSet& operator=(const FlatHashSet& rhs);
+// [ 3] FlatHashSet& operator=(MovableRef<FlatHashSet> rhs);
+// [ 2] void clear();
+// [ 2] bsl::size_t erase(const KEY& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] pair<iterator, bool> insert(const KEY& value);
+// [ 2] pair<iterator, bool> insert(MovableRef<KEY> value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void rehash(bsl::size_t minimumCapacity);
+// [ 2] void reserve(bsl::size_t numElements);
+// [ 3] void swap(FlatHashSet& other);
+//
+// ACCESSORS
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 2] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] bsl::size_t size() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 3] bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatHashSet& a, FlatHashSet& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'int' KEYS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<int>         Obj;
+typedef bdlc::FlatHashSet<bsl::string> StrObj;
+
+typedef bslmf::MovableRefUtil          MoveUtil;
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+// ============================================================================
+//                          HELPERS FOR BENCHMARKS
+// ----------------------------------------------------------------------------
+
+namespace benchmark {
+
+template <class SET>
+void run(const char              *name,
+         const bsl::vector<int>&  keys,
+         const bsl::vector<int>&  missingKeys,
+         int                      numRounds)
+    // Report the time taken, by a set of the (template parameter) type 'SET'
+    // constructed with a test allocator, to insert each of the specified
+    // 'keys', look up each of them and each of the specified 'missingKeys'
+    // the specified 'numRounds' times, and erase each of 'keys', as well as
+    // the number of allocations performed, labeling the results with the
+    // specified 'name'.
+{
+    bslma::TestAllocator ta("benchmark");
+
+    bsls::Stopwatch timer;
+    int             checksum = 0;
+
+    SET set(&ta);
+
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        set.insert(keys[i]);
+    }
+    timer.stop();
+    const double insertTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            checksum += static_cast<int>(set.count(keys[i]));
+        }
+    }
+    timer.stop();
+    const double hitTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (bsl::size_t i = 0; i < missingKeys.size(); ++i) {
+            checksum += static_cast<int>(set.count(missingKeys[i]));
+        }
+    }
+    timer.stop();
+    const double missTime = timer.accumulatedWallTime();
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+    const bsls::Types::Int64 numBytes       = ta.numBytesInUse();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        set.erase(keys[i]);
+    }
+    timer.stop();
+    const double eraseTime = timer.accumulatedWallTime();
+
+    const double numLookups = static_cast<double>(keys.size()) * numRounds;
+    const double numKeys    = static_cast<double>(keys.size());
+
+    bsl::printf("%-22s insert %6.1f  hit %6.1f  miss %6.1f  erase %6.1f"
+                " ns/op;  %8lld allocations, %10lld bytes  (checksum %d)\n",
+                name,
+                insertTime * 1e9 / numKeys,
+                hitTime    * 1e9 / numLookups,
+                missTime   * 1e9 / numLookups,
+                eraseTime  * 1e9 / numKeys,
+                static_cast<long long>(numAllocations),
+                static_cast<long long>(numBytes),
+                checksum);
+}
+
+}  // close namespace benchmark
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicate Identifiers
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive a sequence of order identifiers that may contain
+// duplicates, and we want to process each identifier only once.
+//
+// First, we define the input sequence:
+//..
+    const int IDS[]   = { 17, 4, 17, 9, 4, 4, 23 };
+    const int NUM_IDS = static_cast<int>(sizeof IDS / sizeof *IDS);
+//..
+// Then, we create a set using 'bslh::Hash<>' as its hash functor:
+//..
+    bslma::TestAllocator oa("object");
+
+    bdlc::FlatHashSet<int, bslh::Hash<> > seen(&oa);
+//..
+// Now, we process each identifier the first time it is seen:
+//..
+    int numProcessed = 0;
+    for (int i = 0; i < NUM_IDS; ++i) {
+        if (seen.insert(IDS[i]).second) {
+            ++numProcessed;
+        }
+    }
+//..
+// Finally, we verify the result:
+//..
+    ASSERT(4 == numProcessed);
+    ASSERT(4 == seen.size());
+    ASSERT(seen.contains(23));
+    ASSERT(!seen.contains(5));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value and use the supplied allocator.
+        //:
+        //: 2 Moves with the same allocator do not allocate and leave the
+        //:   source empty; moves with a different allocator copy.
+        //:
+        //: 3 Equality is independent of insertion order.
+        //:
+        //: 4 Member 'swap' does not allocate; free 'swap' works with
+        //:   different allocators.
+        //
+        // Plan:
+        //: 1 Perform each operation on sets of strings, monitoring the
+        //:   allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet& original, *bA = 0);
+        //   FlatHashSet(MovableRef<FlatHashSet> original);
+        //   FlatHashSet(MovableRef<FlatHashSet> original, *bA);
+        //   FlatHashSet& operator=(const FlatHashSet& rhs);
+        //   FlatHashSet& operator=(MovableRef<FlatHashSet> rhs);
+        //   void swap(FlatHashSet& other);
+        //   bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& a, FlatHashSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                 << "==========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        StrObj mX(&oa);  const StrObj& X = mX;
+        StrObj mW(&za);  const StrObj& W = mW;
+
+        bsl::string key(SUFFICIENTLY_LONG_STRING, &oa);
+        for (int i = 0; i < 50; ++i) {
+            key[0] = static_cast<char>('A' + i);
+            mX.insert(key);
+        }
+        for (int i = 49; i >= 0; --i) {
+            key[0] = static_cast<char>('A' + i);
+            mW.insert(key);
+        }
+
+        ASSERT(X == W);
+        ASSERT(!(X != W));
+
+        key[0] = 'A';
+        mW.erase(key);
+        ASSERT(X != W);
+        mW.insert(key);
+        ASSERT(X == W);
+
+        {
+            StrObj mY(X, &za);  const StrObj& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(&za == Y.allocator());
+            ASSERT(&za == Y.begin()->get_allocator().mechanism());
+        }
+        {
+            StrObj mS(X, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            StrObj mY(MoveUtil::move(mS));  const StrObj& Y = mY;
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == Y);
+            ASSERT(mS.empty());
+
+            StrObj mZ(MoveUtil::move(mY), &za);  const StrObj& Z = mZ;
+
+            ASSERT(X == Z);
+            ASSERT(&za == Z.allocator());
+        }
+        {
+            StrObj mY(&za);
+
+            mY = X;
+            ASSERT(X == mY);
+            ASSERT(&za == mY.allocator());
+
+            StrObj mS(X, &za);
+            mY.clear();
+            mY = MoveUtil::move(mS);
+            ASSERT(X == mY);
+            ASSERT(mS.empty());
+        }
+        {
+            StrObj mA(X, &oa);
+            StrObj mB(&oa);
+            mB.insert(key);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mA.swap(mB);
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == mB);
+            ASSERT(1 == mA.size());
+
+            StrObj mC(&za);
+            swap(mB, mC);
+            ASSERT(X == mC);
+            ASSERT(mB.empty());
+            ASSERT(&za == mC.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a set using the expected allocator,
+        //:   functors, and capacity, and the range constructors insert each
+        //:   distinct element of the range.
+        //:
+        //: 2 'insert' adds only elements not already present, and reports
+        //:   whether it did so.
+        //:
+        //: 3 'find', 'count', and 'contains' agree with an oracle after any
+        //:   sequence of insertions and removals; iteration visits each
+        //:   element exactly once.
+        //:
+        //: 4 Each 'erase' overload removes the specified elements.
+        //:
+        //: 5 'reserve', 'rehash', 'capacity', and the load factors behave as
+        //:   documented.
+        //:
+        //: 6 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Exercise each method, comparing the result with a 'bsl::set'
+        //:   oracle.  (C-1..6)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   FlatHashSet(bslma::Allocator *basicAllocator);
+        //   FlatHashSet(bsl::size_t capacity, bslma::Allocator *bA = 0);
+        //   FlatHashSet(capacity, hash, bslma::Allocator *bA = 0);
+        //   FlatHashSet(capacity, hash, equal, bslma::Allocator *bA = 0);
+        //   FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+        //   FlatHashSet(first, last, capacity, hash, equal, *bA = 0);
+        //   ~FlatHashSet();
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, bool> insert(const KEY& value);
+        //   pair<iterator, bool> insert(MovableRef<KEY> value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numElements);
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY& key) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   bsl::size_t size() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONSTRUCTORS, MANIPULATORS, AND ACCESSORS" << endl
+                  << "=========================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tConstructors." << endl;
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERT(&defaultAllocator == A.allocator());
+            ASSERT(0 == A.capacity());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERT(&oa == B.allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            Obj mC(100, &oa);  const Obj& C = mC;
+            ASSERT(128 == C.capacity());
+
+            Obj mD(16, bsl::hash<int>(), &oa);  const Obj& D = mD;
+            ASSERT(16 == D.capacity());
+
+            Obj mE(17, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& E = mE;
+            ASSERT(32 == E.capacity());
+            ASSERT(bsl::equal_to<int>()(1, 1) == E.key_eq()(1, 1));
+            ASSERT(bsl::hash<int>()(7) == E.hash_function()(7));
+
+            const int VALUES[] = { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5 };
+            const int NUM_VALUES = static_cast<int>(sizeof VALUES /
+                                                    sizeof *VALUES);
+
+            Obj mF(VALUES, VALUES + NUM_VALUES, &oa);  const Obj& F = mF;
+            ASSERT(7 == F.size());
+
+            Obj mG(VALUES,
+                   VALUES + NUM_VALUES,
+                   100,
+                   bsl::hash<int>(),
+                   bsl::equal_to<int>(),
+                   &oa);
+            const Obj& G = mG;
+            ASSERT(7   == G.size());
+            ASSERT(128 == G.capacity());
+            ASSERT(F   == G);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tInsertion, lookup, and removal." << endl;
+        {
+            Obj           mX(&oa);  const Obj& X = mX;
+            bsl::set<int> oracle(&sa);
+
+            ASSERT(X.empty());
+            ASSERT(0.0f   == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+
+            unsigned int state = 7;
+            for (int i = 0; i < 5000; ++i) {
+                state = state * 1103515245 + 12345;
+                const int key = static_cast<int>((state >> 16) % 1000);
+
+                if ((state >> 8) & 3) {
+                    int value = key;
+                    const bool EXP = oracle.insert(key).second;
+                    const bool RES = i & 1
+                                   ? mX.insert(key).second
+                                   : mX.insert(MoveUtil::move(value)).second;
+                    ASSERTV(i, key, EXP == RES);
+                }
+                else {
+                    ASSERTV(i, key, oracle.erase(key) == mX.erase(key));
+                }
+                ASSERTV(i, oracle.size() == X.size());
+            }
+
+            for (int key = 0; key < 1000; ++key) {
+                const bool EXP = oracle.count(key) != 0;
+                ASSERTV(key, EXP == X.contains(key));
+                ASSERTV(key, EXP == (1 == X.count(key)));
+                ASSERTV(key, EXP == (X.end() != X.find(key)));
+                if (EXP) {
+                    ASSERTV(key, key == *X.find(key));
+                }
+            }
+
+            bsl::set<int> visited(&sa);
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(*it, visited.insert(*it).second);
+            }
+            ASSERT(oracle == visited);
+            ASSERT(X.size() / static_cast<float>(X.capacity())
+                                                         == X.load_factor());
+
+            const int KEY = *X.begin();
+            mX.erase(X.begin());
+            ASSERT(!X.contains(KEY));
+
+            Obj::const_iterator last = X.begin();
+            for (int i = 0; i < 10; ++i) {
+                ++last;
+            }
+            const bsl::size_t SIZE = X.size();
+            ASSERT(last == mX.erase(X.begin(), last));
+            ASSERT(SIZE - 10 == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\t'reserve' and 'rehash'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(100);
+            ASSERT(128 == X.capacity());
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+
+            mX.rehash(1000);
+            ASSERT(1024 == X.capacity());
+            ASSERT(100  == X.size());
+
+            mX.clear();
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            const bsl::string LONG(SUFFICIENTLY_LONG_STRING, &oa);
+
+            mX.insert(LONG);
+            ASSERT(X.contains(LONG));
+            ASSERT(&oa == X.begin()->get_allocator().mechanism());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, look up, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERTV(i, mX.insert(i).second);
+            ASSERTV(i, !mX.insert(i).second);
+        }
+        ASSERT(100 == X.size());
+        ASSERT(X.contains(42));
+
+        mX.erase(42);
+        ASSERT(!X.contains(42));
+
+        Obj mY(X, &oa);
+        ASSERT(X == mY);
+
+        mY.insert(42);
+        ASSERT(X != mY);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'int' KEYS
+        //   Compare 'bdlc::FlatHashSet<int>' with 'bsl::unordered_set<int>'.
+        //   Command line parameters:
+        //   2nd parameter: number of keys (default: 100000)
+        //   3rd parameter: number of lookup rounds (default: 10)
+        //
+        // Concerns:
+        //: 1 The flat set performs fewer allocations, uses less memory, and
+        //:   looks up keys faster than the node-based set.
+        //
+        // Plan:
+        //: 1 Time insertion, successful and unsuccessful lookup, and removal
+        //:   of pseudo-random keys in each set, and report the results.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'int' KEYS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'int' KEYS" << endl
+             << "=======================" << endl;
+
+        const int numKeys   = argc > 2 ? atoi(argv[2]) : 100000;
+        const int numRounds = argc > 3 ? atoi(argv[3]) : 10;
+
+        bslma::TestAllocator sa("scratch");
+
+        bsl::vector<int> keys(&sa);
+        bsl::vector<int> missingKeys(&sa);
+
+        unsigned int state = 1;
+        for (int i = 0; i < numKeys; ++i) {
+            state = state * 1103515245 + 12345;
+            keys.push_back(static_cast<int>(state & 0x7FFFFFFE));
+            missingKeys.push_back(static_cast<int>(state & 0x7FFFFFFE) | 1);
+        }
+
+        benchmark::run<bsl::unordered_set<int> >("bsl::unordered_set",
+                                                 keys,
+                                                 missingKeys,
+                                                 numRounds);
+        benchmark::run<bdlc::FlatHashSet<int> >("bdlc::FlatHashSet",
+                                                keys,
+                                                missingKeys,
+                                                numRounds);
+        benchmark::run<bdlc::FlatHashSet<int, bslh::Hash<> > >(
+                                                   "bdlc::FlatHashSet/bslh",
+                                                   keys,
+                                                   missingKeys,
+                                                   numRounds);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1585 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table with inline storage.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table of inline entries
+//  bdlc::FlatHashTable_GroupControl: control-byte group of a flat hash table
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashTable', implementing an open-addressed hash table that stores
+// its entries inline in a single contiguous array (i.e., without allocating a
+// node per entry) and that locates entries by probing an auxiliary array of
+// one-byte "control" values (a design commonly referred to as a "Swiss
+// table").  'bdlc::FlatHashTable' is the engine underlying 'bdlc::FlatHashMap'
+// and 'bdlc::FlatHashSet', and is not intended for direct use by clients.
+//
+// The table is parameterized by the 'KEY' type, the 'ENTRY' type stored in
+// the table, an 'ENTRY_UTIL' utility that extracts the key from an entry and
+// constructs an entry from a key, a 'HASH' functor, and an 'EQUAL' functor.
+// The 'ENTRY_UTIL' type must provide the following two class methods:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a reference providing non-modifiable access to the key of
+//      // the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Create, at the specified 'entry' address, an entry having the
+//      // specified 'key' (and a default value for any non-key portion of the
+//      // entry), using the specified 'allocator' to supply memory.
+//..
+//
+///Storage and Probing
+///-------------------
+// The table maintains two parallel arrays of 'capacity()' slots: an array of
+// (possibly uninitialized) 'ENTRY' objects, and an array of control bytes.
+// Each control byte records whether the corresponding slot is empty, erased
+// (a "tombstone" left by 'erase'), or in use; for a slot in use, the low seven
+// bits of the control byte hold the seven bits of the (mixed) hash value of
+// the key stored in the slot that lie just below the bits selecting a group.
+// Unlike its low-order bits, these bits of the mixed hash value vary even
+// among keys whose hash values differ only in their high-order bits (such as
+// the identity hashes of aligned pointers).  The capacity is always either 0
+// or a power of two that is at least 'FlatHashTable_GroupControl::k_SIZE'
+// (16), so the control array is naturally divided into groups of 16 control
+// bytes.
+//
+// To locate a key, the table computes the hash of the key, selects an initial
+// group from the high-order bits of the hash, and compares all 16 control
+// bytes of the group against the seven hash bits of the key at once using
+// 'FlatHashTable_GroupControl'.  Only slots whose control byte matches are
+// compared (using 'EQUAL') against the key.  If the group contains an empty
+// slot, the search is over; otherwise, the search continues with the next
+// group in a (triangular) quadratic probe sequence that is guaranteed to
+// visit every group.  On platforms supporting SSE2, the group comparisons are
+// single SIMD instructions; elsewhere they are performed 8 bytes at a time
+// using portable word-wide bit manipulation.
+//
+// The table grows (doubling its capacity) when an insertion would cause the
+// number of slots in use or erased to exceed 7/8 of the capacity.  If a
+// substantial fraction of those slots are erased, the table is instead
+// rehashed in place, reclaiming the tombstones.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any operation that may cause a rehash ('insert', 'tryEmplace', 'rehash',
+// 'reserve') invalidates all iterators, pointers, and references to entries
+// of the table if a rehash occurs.  'erase' invalidates only iterators,
+// pointers, and references to the erased entry.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown while rehashing (e.g., by 'HASH', or by the move
+// constructor of a non-bitwise-movable 'ENTRY'), the table is left in a valid
+// but unspecified state.  All other operations provide the strong guarantee
+// with respect to the value of the table.
+//
+///Usage
+///-----
+// This component is an implementation detail of 'bdlc_flathashmap' and
+// 'bdlc_flathashset', and is *not* intended for direct client use.  See
+// those components for usage examples.
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslalg_swaputil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bslstl_forwarditerator.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_iterator.h>
+#include <bsl_utility.h>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                  \
+                                  (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BDLC_FLATHASHTABLE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides a view of a group of 'k_SIZE' consecutive control
+    // bytes of a flat hash table, and answers questions about all bytes of
+    // the group at once.  Each query returns a bit mask in which bit 'i' (with
+    // bit 0 being the least-significant) corresponds to the control byte at
+    // offset 'i' in the group.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SIZE = 16  // number of control bytes in a group
+    };
+
+    static const unsigned char k_EMPTY  = 0x80;  // slot has never been used
+    static const unsigned char k_ERASED = 0xC0;  // slot is a tombstone
+
+  private:
+    // DATA
+#ifdef BDLC_FLATHASHTABLE_SSE2
+    __m128i             d_value;  // the 16 control bytes
+#else
+    bsls::Types::Uint64 d_low;    // control bytes 0-7, byte 'i' at bit '8*i'
+    bsls::Types::Uint64 d_high;   // control bytes 8-15
+#endif
+
+    // PRIVATE CLASS METHODS
+#ifndef BDLC_FLATHASHTABLE_SSE2
+    static bsls::Types::Uint64 load(const unsigned char *data);
+        // Return the 8 bytes at the specified 'data' address packed into a
+        // 64-bit word having byte 'i' of 'data' at bits '[8*i .. 8*i+7]'.
+
+    static unsigned int toMask(bsls::Types::Uint64 highBits);
+        // Return an 8-bit mask having bit 'i' set if and only if bit '8*i+7'
+        // of the specified 'highBits' is set.  The behavior is undefined
+        // unless 'highBits' has no bits set other than (some of) the bits
+        // '8*i+7'.
+#endif
+
+    // NOT IMPLEMENTED
+    FlatHashTable_GroupControl();
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const unsigned char *data);
+        // Create a group control object providing a view of the 'k_SIZE'
+        // control bytes starting at the specified 'data' address.
+
+    //! FlatHashTable_GroupControl(
+    //!                 const FlatHashTable_GroupControl& original) = default;
+    //! ~FlatHashTable_GroupControl() = default;
+
+    // ACCESSORS
+    unsigned int available() const;
+        // Return a bit mask of the control bytes of this group that are either
+        // empty or erased.
+
+    unsigned int inUse() const;
+        // Return a bit mask of the control bytes of this group that are in
+        // use.
+
+    unsigned int match(unsigned char value) const;
+        // Return a bit mask of the control bytes of this group that are equal
+        // to the specified 'value'.  The behavior is undefined unless
+        // '0x80 > value'.
+
+    bool neverFull() const;
+        // Return 'true' if at least one of the control bytes of this group is
+        // empty (i.e., not merely erased), and 'false' otherwise.  Note that a
+        // probe sequence can stop at a group that has never been full.
+};
+
+                     // ===============================
+                     // class FlatHashTable_IteratorImp
+                     // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class provides the core functionality needed by
+    // 'bslstl::ForwardIterator' to iterate over the entries of a
+    // 'FlatHashTable'.
+
+    // DATA
+    ENTRY               *d_entry_p;       // current entry
+    const unsigned char *d_control_p;     // control byte of current entry
+    const unsigned char *d_controlEnd_p;  // one past the last control byte
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const FlatHashTable_IteratorImp<OTHER_ENTRY>&,
+                           const FlatHashTable_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator that does not refer to any entry.
+
+    FlatHashTable_IteratorImp(ENTRY               *entry,
+                              const unsigned char *control,
+                              const unsigned char *controlEnd);
+        // Create an iterator referring to the specified 'entry', whose control
+        // byte is at the specified 'control' address, in a table whose control
+        // bytes end at the specified 'controlEnd' address.  The behavior is
+        // undefined unless 'control == controlEnd' (for the past-the-end
+        // iterator) or '*control' indicates that 'entry' is in use.
+
+    //! FlatHashTable_IteratorImp(
+    //!                  const FlatHashTable_IteratorImp& original) = default;
+    //! ~FlatHashTable_IteratorImp() = default;
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                       const FlatHashTable_IteratorImp& rhs) = default;
+
+    void operator++();
+        // Advance this iterator to the next entry in use, or to the
+        // past-the-end position if there is no such entry.  The behavior is
+        // undefined unless this iterator refers to an entry.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator.  The
+        // behavior is undefined unless this iterator refers to an entry.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterators refer to the
+    // same entry, and 'false' otherwise.
+
+                           // ===================
+                           // class FlatHashTable
+                           // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed hash table of 'ENTRY'
+    // objects, each identified by a unique 'KEY', storing the entries inline.
+    // See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl GroupControl;
+    typedef bsls::Types::Uint64        Uint64;
+
+    // DATA
+    ENTRY            *d_entries_p;         // array of 'd_capacity' slots
+    unsigned char    *d_controls_p;        // array of 'd_capacity' control
+                                           // bytes
+
+    bsl::size_t       d_size;              // number of entries in use
+
+    bsl::size_t       d_numErased;         // number of erased slots
+
+    bsl::size_t       d_capacity;          // number of slots (0 or a power
+                                           // of two that is at least 16)
+
+    int               d_groupShift;        // shift applied to a mixed hash
+                                           // value to obtain a group index
+
+    HASH              d_hasher;            // hash functor
+
+    EQUAL             d_equal;             // key equality functor
+
+    bslma::Allocator *d_allocator_p;       // memory allocator (held, not
+                                           // owned)
+
+  public:
+    // TYPES
+    typedef FlatHashTable_IteratorImp<ENTRY>                    IteratorImp;
+    typedef bslstl::ForwardIterator<ENTRY, IteratorImp>         iterator;
+    typedef bslstl::ForwardIterator<const ENTRY, IteratorImp>   const_iterator;
+
+  private:
+    // PRIVATE CLASS METHODS
+    static bsl::size_t capacityForNumEntries(bsl::size_t numEntries);
+        // Return the minimum capacity allowing the specified 'numEntries' to
+        // be held without exceeding the maximum load.
+
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of slots of a table having the specified
+        // 'capacity' that may be in use or erased.
+
+    // PRIVATE MANIPULATORS
+    void allocateArrays(bsl::size_t capacity);
+        // Allocate the entry and control arrays for the specified 'capacity',
+        // and set all control bytes to empty.  The behavior is undefined
+        // unless this table holds no arrays and 'capacity' is 0 or a power of
+        // two that is at least 'GroupControl::k_SIZE'.
+
+    void destroyAndDeallocate();
+        // Destroy all entries in use and deallocate the entry and control
+        // arrays, leaving this table empty with a capacity of 0.
+
+    bsl::size_t findOrPrepareSlot(bool       *isNew,
+                                  Uint64     *hashValue,
+                                  const KEY&  key);
+        // Return the index of the slot holding the specified 'key' and load
+        // 'false' into the specified 'isNew' if 'key' is in this table;
+        // otherwise, grow or rehash this table as needed, and return the index
+        // of an available slot into which an entry having 'key' may be
+        // inserted and load 'true' into 'isNew'.  Load the mixed hash value
+        // of 'key' into the specified 'hashValue'.  Note that, when 'isNew' is
+        // 'true', the returned slot must be committed with 'commitSlot' after
+        // an entry has been constructed in it.
+
+    void commitSlot(bsl::size_t index, Uint64 hashValue);
+        // Mark as in use the slot at the specified 'index', into which an
+        // entry whose key has the specified (mixed) 'hashValue' has just been
+        // constructed.
+
+    iterator makeIterator(bsl::size_t index);
+        // Return an iterator referring to the slot at the specified 'index',
+        // or the past-the-end iterator if 'index == capacity()'.
+
+    void rehashToCapacity(bsl::size_t newCapacity);
+        // Move all the entries of this table into new arrays having the
+        // specified 'newCapacity'.  The behavior is undefined unless
+        // 'newCapacity' is 0 or a power of two that is at least
+        // 'GroupControl::k_SIZE', and 'size() <= maxLoad(newCapacity)'.
+
+    // PRIVATE ACCESSORS
+    unsigned char controlByte(Uint64 hashValue) const;
+        // Return the control byte of a slot in use holding a key having the
+        // specified (mixed) 'hashValue', i.e., the seven bits of 'hashValue'
+        // just below those selecting the initial group of the key.  The
+        // behavior is undefined unless '0 < capacity()'.
+
+    bsl::size_t findAvailable(Uint64 hashValue) const;
+        // Return the index of the first available (empty or erased) slot in
+        // the probe sequence for the specified (mixed) 'hashValue'.  The
+        // behavior is undefined unless 'size() < capacity()'.
+
+    bsl::size_t indexOf(const KEY& key, Uint64 hashValue) const;
+        // Return the index of the slot holding the specified 'key' having the
+        // specified (mixed) 'hashValue', or 'capacity()' if there is no such
+        // slot.
+
+    Uint64 mixedHash(const KEY& key) const;
+        // Return the hash value of the specified 'key' after mixing it so that
+        // its high-order bits are suitable for selecting a group.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table having at least the specified 'capacity',
+        // using the specified 'hash' to generate hash values for keys and the
+        // specified 'equal' to compare keys for equality.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  Note that the
+        // resulting capacity is 0 if 'capacity' is 0, and otherwise the least
+        // power of two, and at least 'GroupControl::k_SIZE', that is not less
+        // than 'capacity'.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, capacity, hash functor, and
+        // equality functor as the specified 'original' table.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable> original);
+        // Create a table having the same value, capacity, hash functor,
+        // equality functor, and allocator as the specified 'original' table,
+        // leaving 'original' empty with a capacity of 0.  No memory is
+        // allocated.
+
+    FlatHashTable(bslmf::MovableRef<FlatHashTable>  original,
+                  bslma::Allocator                 *basicAllocator);
+        // Create a table having the same value, capacity, hash functor, and
+        // equality functor as the specified 'original' table, using the
+        // specified 'basicAllocator' to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.  If
+        // 'original' uses the same allocator, its storage is transferred and
+        // 'original' is left empty with a capacity of 0; otherwise,
+        // 'original' is copied and left unchanged.
+
+    ~FlatHashTable();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value, hash functor, and equality functor
+        // of the specified 'rhs' table, and return a reference providing
+        // modifiable access to this table.
+
+    FlatHashTable& operator=(bslmf::MovableRef<FlatHashTable> rhs);
+        // Assign to this table the value, hash functor, and equality functor
+        // of the specified 'rhs' table, and return a reference providing
+        // modifiable access to this table.  If 'rhs' uses the same allocator
+        // as this table, its storage is transferred and 'rhs' is left empty
+        // with a capacity of 0; otherwise, 'rhs' is copied and left
+        // unchanged.
+
+    void clear();
+        // Destroy all entries of this table, leaving it empty.  Note that the
+        // capacity of this table is unchanged.
+
+    iterator erase(const_iterator position);
+        // Remove from this table the entry at the specified 'position', and
+        // return an iterator referring to the entry following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an entry of this table.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this table the entry having the specified 'key', if it
+        // exists, and return the number of entries removed (0 or 1).
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' into this table if an entry
+        // having the same key does not already exist.  Return a pair whose
+        // 'first' member refers to the entry in this table having the key of
+        // 'entry', and whose 'second' member is 'true' if the insertion was
+        // performed and 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this table, using its move
+        // constructor, if an entry having the same key does not already exist.
+        // Return a pair whose 'first' member refers to the entry in this table
+        // having the key of 'entry', and whose 'second' member is 'true' if
+        // the insertion was performed and 'false' otherwise.  If the insertion
+        // is not performed, 'entry' is unchanged.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the least power of two (and at
+        // least 'GroupControl::k_SIZE') that is not less than the specified
+        // 'minimumCapacity' and allows the current entries to be held, and
+        // redistribute the entries.  If the resulting capacity is 0, release
+        // all memory.  Note that this operation also reclaims erased slots.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase the capacity of this table, if needed, so that the
+        // specified 'numEntries' may be held without a rehash.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value, capacity, hash functor, and equality functor of
+        // this table with those of the specified 'other' table.  The behavior
+        // is undefined unless this table and 'other' use the same allocator.
+
+    bsl::pair<iterator, bool> tryEmplace(const KEY& key);
+        // Insert into this table an entry created from the specified 'key'
+        // using 'ENTRY_UTIL::constructFromKey', if an entry having 'key' does
+        // not already exist.  Return a pair whose 'first' member refers to the
+        // entry having 'key', and whose 'second' member is 'true' if the
+        // insertion was performed and 'false' otherwise.
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this table.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table holds an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    const unsigned char *controls() const;
+        // Return the address of the control bytes of this table.  Note that
+        // this method is provided for testing.
+
+    bool empty() const;
+        // Return 'true' if this table holds no entries, and 'false' otherwise.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this table.
+
+    const EQUAL& equalityComparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // equality functor of this table.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    const HASH& hasher() const;
+        // Return a reference providing non-modifiable access to the hash
+        // functor of this table.
+
+    float loadFactor() const;
+        // Return the ratio of the number of entries to the capacity of this
+        // table, or 0 if the capacity is 0.
+
+    float maxLoadFactor() const;
+        // Return the maximum ratio of slots in use or erased to the capacity
+        // of this table (i.e., 0.875).
+
+    bsl::size_t size() const;
+        // Return the number of entries in this table.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries and, for each entry in 'lhs', 'rhs'
+    // holds an entry having the same key and comparing equal (using
+    // 'ENTRY::operator==').
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+          FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' tables.  If 'a' and
+    // 'b' use different allocators, the exchange is performed by copying.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+#ifdef BDLC_FLATHASHTABLE_SSE2
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                    const unsigned char *data)
+: d_value(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)))
+{
+}
+
+// ACCESSORS
+inline
+unsigned int FlatHashTable_GroupControl::available() const
+{
+    return static_cast<unsigned int>(_mm_movemask_epi8(d_value));
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xFFFFu;
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::match(unsigned char value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+    return static_cast<unsigned int>(
+                         _mm_movemask_epi8(_mm_cmpeq_epi8(pattern, d_value)));
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(k_EMPTY));
+    return 0 != _mm_movemask_epi8(_mm_cmpeq_epi8(pattern, d_value));
+}
+
+#else
+
+// PRIVATE CLASS METHODS
+inline
+bsls::Types::Uint64 FlatHashTable_GroupControl::load(
+                                                    const unsigned char *data)
+{
+    // Assembling the word byte by byte keeps the mapping from byte offset to
+    // bit position independent of the endianness of the platform; compilers
+    // reduce this to a single load on little-endian platforms.
+
+    return  static_cast<bsls::Types::Uint64>(data[0])
+         | (static_cast<bsls::Types::Uint64>(data[1]) <<  8)
+         | (static_cast<bsls::Types::Uint64>(data[2]) << 16)
+         | (static_cast<bsls::Types::Uint64>(data[3]) << 24)
+         | (static_cast<bsls::Types::Uint64>(data[4]) << 32)
+         | (static_cast<bsls::Types::Uint64>(data[5]) << 40)
+         | (static_cast<bsls::Types::Uint64>(data[6]) << 48)
+         | (static_cast<bsls::Types::Uint64>(data[7]) << 56);
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::toMask(bsls::Types::Uint64 highBits)
+{
+    // Multiplying moves bit '8*i' to bit '56+i'; no two partial products
+    // share a bit position, so no carries disturb the top byte.
+
+    return static_cast<unsigned int>(
+                         ((highBits >> 7) * 0x0102040810204080ULL) >> 56);
+}
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                    const unsigned char *data)
+: d_low(load(data))
+, d_high(load(data + 8))
+{
+}
+
+// ACCESSORS
+inline
+unsigned int FlatHashTable_GroupControl::available() const
+{
+    const bsls::Types::Uint64 k_HIGH = 0x8080808080808080ULL;
+
+    return toMask(d_low & k_HIGH) | (toMask(d_high & k_HIGH) << 8);
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & 0xFFFFu;
+}
+
+inline
+unsigned int FlatHashTable_GroupControl::match(unsigned char value) const
+{
+    BSLS_ASSERT_SAFE(0x80 > value);
+
+    const bsls::Types::Uint64 k_LOW7  = 0x7F7F7F7F7F7F7F7FULL;
+    const bsls::Types::Uint64 k_HIGH  = 0x8080808080808080ULL;
+    const bsls::Types::Uint64 pattern = 0x0101010101010101ULL * value;
+
+    // A byte of 'x' is zero if and only if the high bit of the corresponding
+    // byte of '((x & k_LOW7) + k_LOW7) | x' is clear; unlike the classic
+    // "has zero byte" expression, this test produces no false positives.
+
+    const bsls::Types::Uint64 lowX  = d_low ^ pattern;
+    const bsls::Types::Uint64 highX = d_high ^ pattern;
+
+    const bsls::Types::Uint64 lowZ  =
+                                 ~(((lowX & k_LOW7) + k_LOW7) | lowX) & k_HIGH;
+    const bsls::Types::Uint64 highZ =
+                              ~(((highX & k_LOW7) + k_LOW7) | highX) & k_HIGH;
+
+    return toMask(lowZ) | (toMask(highZ) << 8);
+}
+
+inline
+bool FlatHashTable_GroupControl::neverFull() const
+{
+    // A control byte is empty if and only if its bit 7 is set and its bit 6
+    // is clear.
+
+    const bsls::Types::Uint64 k_HIGH = 0x8080808080808080ULL;
+
+    return 0 != (((d_low  & ~(d_low  << 1)) & k_HIGH)
+               | ((d_high & ~(d_high << 1)) & k_HIGH));
+}
+
+#endif
+
+                     // -------------------------------
+                     // class FlatHashTable_IteratorImp
+                     // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entry_p(0)
+, d_control_p(0)
+, d_controlEnd_p(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                         ENTRY               *entry,
+                                         const unsigned char *control,
+                                         const unsigned char *controlEnd)
+: d_entry_p(entry)
+, d_control_p(control)
+, d_controlEnd_p(controlEnd)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_control_p != d_controlEnd_p);
+
+    do {
+        ++d_entry_p;
+        ++d_control_p;
+    } while (d_control_p != d_controlEnd_p && (*d_control_p & 0x80));
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_control_p != d_controlEnd_p);
+
+    return *d_entry_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                      const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_entry_p == rhs.d_entry_p;
+}
+
+namespace bdlc {
+
+                           // -------------------
+                           // class FlatHashTable
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                               capacityForNumEntries(bsl::size_t numEntries)
+{
+    if (0 == numEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t capacity = GroupControl::k_SIZE;
+    while (maxLoad(capacity) < numEntries) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoad(
+                                                          bsl::size_t capacity)
+{
+    return capacity / 8 * 7;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateArrays(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT(0 == d_entries_p);
+    BSLS_ASSERT(0 == d_controls_p);
+    BSLS_ASSERT(0 == capacity || (GroupControl::k_SIZE <= capacity
+                                  && 0 == (capacity & (capacity - 1))));
+
+    d_size       = 0;
+    d_numErased  = 0;
+    d_capacity   = 0;
+    d_groupShift = 0;
+
+    if (0 == capacity) {
+        return;                                                       // RETURN
+    }
+
+    unsigned char *controls = static_cast<unsigned char *>(
+                                           d_allocator_p->allocate(capacity));
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(controls,
+                                                        d_allocator_p);
+
+    d_entries_p = static_cast<ENTRY *>(
+                            d_allocator_p->allocate(capacity * sizeof(ENTRY)));
+
+    proctor.release();
+    d_controls_p = controls;
+    bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+
+    const bsl::size_t numGroups = capacity / GroupControl::k_SIZE;
+
+    d_capacity   = capacity;
+    d_groupShift = 64 - bdlb::BitUtil::log2(
+                                        static_cast<bsl::uint64_t>(numGroups));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::destroyAndDeallocate()
+{
+    if (0 == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            bslma::DestructionUtil::destroy(d_entries_p + i);
+            --d_size;
+        }
+    }
+
+    d_allocator_p->deallocate(d_entries_p);
+    d_allocator_p->deallocate(d_controls_p);
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+    d_size       = 0;
+    d_numErased  = 0;
+    d_capacity   = 0;
+    d_groupShift = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                  findOrPrepareSlot(bool       *isNew,
+                                                    Uint64     *hashValue,
+                                                    const KEY&  key)
+{
+    BSLS_ASSERT_SAFE(isNew);
+    BSLS_ASSERT_SAFE(hashValue);
+
+    *hashValue = mixedHash(key);
+
+    if (d_size) {
+        const bsl::size_t index = indexOf(key, *hashValue);
+        if (index != d_capacity) {
+            *isNew = false;
+            return index;                                             // RETURN
+        }
+    }
+
+    if (d_size + d_numErased >= maxLoad(d_capacity)) {
+        // Grow, unless at least a quarter of the maximum load consists of
+        // erased slots, in which case rehashing in place reclaims them.
+
+        const bsl::size_t newCapacity =
+                          0 == d_capacity
+                          ? static_cast<bsl::size_t>(GroupControl::k_SIZE)
+                          : d_numErased >= maxLoad(d_capacity) / 4
+                            ? d_capacity
+                            : 2 * d_capacity;
+
+        rehashToCapacity(newCapacity);
+    }
+
+    *isNew = true;
+    return findAvailable(*hashValue);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::commitSlot(
+                                                         bsl::size_t index,
+                                                         Uint64      hashValue)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(d_controls_p[index] & 0x80);
+
+    if (GroupControl::k_ERASED == d_controls_p[index]) {
+        --d_numErased;
+    }
+    d_controls_p[index] = controlByte(hashValue);
+    ++d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::makeIterator(
+                                                             bsl::size_t index)
+{
+    return iterator(IteratorImp(d_entries_p + index,
+                                d_controls_p + index,
+                                d_controls_p + d_capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashToCapacity(
+                                                       bsl::size_t newCapacity)
+{
+    BSLS_ASSERT(d_size <= maxLoad(newCapacity));
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+    other.allocateArrays(newCapacity);
+
+    // Each entry is marked erased in this table as soon as it is moved, so
+    // that both tables remain consistent should 'HASH' or the move throw.
+
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            const Uint64      hashValue = mixedHash(ENTRY_UTIL::key(
+                                                              d_entries_p[i]));
+            const bsl::size_t index     = other.findAvailable(hashValue);
+
+            bslma::ConstructionUtil::destructiveMove(other.d_entries_p + index,
+                                                     d_allocator_p,
+                                                     d_entries_p + i);
+            d_controls_p[i] = GroupControl::k_ERASED;
+            --d_size;
+            ++d_numErased;
+
+            other.d_controls_p[index] = other.controlByte(hashValue);
+            ++other.d_size;
+        }
+    }
+
+    swap(other);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+unsigned char FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::controlByte(
+                                                        Uint64 hashValue) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+
+    // The low-order bits of a mixed hash value depend only on the low-order
+    // bits of the hash value, which identity hashes leave mostly constant;
+    // the bits below the group index depend on all lower bits of the hash.
+
+    return static_cast<unsigned char>((hashValue >> (d_groupShift - 7))
+                                                                      & 0x7F);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                        Uint64 hashValue) const
+{
+    BSLS_ASSERT_SAFE(d_size < d_capacity);
+
+    const bsl::size_t groupMask = d_capacity / GroupControl::k_SIZE - 1;
+
+    // Masking the shift keeps it defined for a single group (whose shift is
+    // 64); 'groupMask' is then 0.
+
+    bsl::size_t group = static_cast<bsl::size_t>(
+                                hashValue >> (d_groupShift & 63)) & groupMask;
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const unsigned int available = GroupControl(
+                      d_controls_p + group * GroupControl::k_SIZE).available();
+        if (available) {
+            return group * GroupControl::k_SIZE
+                 + bdlb::BitUtil::numTrailingUnsetBits(
+                                        static_cast<bsl::uint32_t>(available));
+                                                                      // RETURN
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::indexOf(
+                                                  const KEY& key,
+                                                  Uint64     hashValue) const
+{
+    if (0 == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned char h2        = controlByte(hashValue);
+    const bsl::size_t   numGroups = d_capacity / GroupControl::k_SIZE;
+    const bsl::size_t   groupMask = numGroups - 1;
+
+    bsl::size_t group = static_cast<bsl::size_t>(
+                                hashValue >> (d_groupShift & 63)) & groupMask;
+
+    // The triangular probe sequence visits every group exactly once in
+    // 'numGroups' steps.
+
+    for (bsl::size_t step = 1; step <= numGroups; ++step) {
+        const bsl::size_t  base = group * GroupControl::k_SIZE;
+        const GroupControl control(d_controls_p + base);
+
+        for (unsigned int candidates = control.match(h2);
+             candidates;
+             candidates &= candidates - 1) {
+            const bsl::size_t index = base
+                                    + bdlb::BitUtil::numTrailingUnsetBits(
+                                       static_cast<bsl::uint32_t>(candidates));
+            if (d_equal(key, ENTRY_UTIL::key(d_entries_p[index]))) {
+                return index;                                         // RETURN
+            }
+        }
+
+        if (control.neverFull()) {
+            break;
+        }
+        group = (group + step) & groupMask;
+    }
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsls::Types::Uint64
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mixedHash(
+                                                          const KEY& key) const
+{
+    // Fibonacci hashing: multiplying by 2^64 divided by the golden ratio
+    // spreads all bits of the hash into the high-order bits, which select the
+    // group and provide the control byte (see 'controlByte'); this protects
+    // the table against weak hash functions such as the identity hash
+    // commonly used for integers.
+
+    return static_cast<Uint64>(d_hasher(key)) * 0x9E3779B97F4A7C15ULL;
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (capacity) {
+        bsl::size_t actual = GroupControl::k_SIZE;
+        while (actual < capacity) {
+            actual *= 2;
+        }
+        allocateArrays(actual);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                        const FlatHashTable&  original,
+                                        bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // Since the hash functor is copied, each entry can be copied into the
+    // same slot it occupies in 'original', avoiding the need to rehash.  The
+    // copy is built in a temporary table so that, should a copy constructor
+    // throw, the entries already copied are destroyed by its destructor.
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+    other.allocateArrays(original.d_capacity);
+
+    for (bsl::size_t i = 0; i < original.d_capacity; ++i) {
+        if (0 == (original.d_controls_p[i] & 0x80)) {
+            bslma::ConstructionUtil::construct(other.d_entries_p + i,
+                                               d_allocator_p,
+                                               original.d_entries_p[i]);
+            other.d_controls_p[i] = original.d_controls_p[i];
+            ++other.d_size;
+        }
+    }
+
+    if (other.d_capacity) {
+        bsl::memcpy(other.d_controls_p,
+                    original.d_controls_p,
+                    other.d_capacity);
+    }
+    other.d_numErased = original.d_numErased;
+
+    swap(other);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                     bslmf::MovableRef<FlatHashTable> original)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(bslmf::MovableRefUtil::access(original).d_hasher)
+, d_equal(bslmf::MovableRefUtil::access(original).d_equal)
+, d_allocator_p(bslmf::MovableRefUtil::access(original).d_allocator_p)
+{
+    swap(bslmf::MovableRefUtil::access(original));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                            bslmf::MovableRef<FlatHashTable>  original,
+                            bslma::Allocator                 *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_numErased(0)
+, d_capacity(0)
+, d_groupShift(0)
+, d_hasher(bslmf::MovableRefUtil::access(original).d_hasher)
+, d_equal(bslmf::MovableRefUtil::access(original).d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    FlatHashTable& lvalue = original;
+
+    if (d_allocator_p == lvalue.d_allocator_p) {
+        swap(lvalue);
+    }
+    else {
+        FlatHashTable other(lvalue, d_allocator_p);
+        swap(other);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    BSLS_ASSERT(d_size <= d_capacity);
+
+    destroyAndDeallocate();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                          bslmf::MovableRef<FlatHashTable> rhs)
+{
+    FlatHashTable& lvalue = rhs;
+
+    if (this != &lvalue) {
+        FlatHashTable other(bslmf::MovableRefUtil::move(lvalue),
+                            d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & 0x80)) {
+            bslma::DestructionUtil::destroy(d_entries_p + i);
+            --d_size;
+        }
+    }
+    if (d_capacity) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+    d_numErased = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    const bsl::size_t index = &*position - d_entries_p;
+
+    BSLS_ASSERT(index < d_capacity);
+    BSLS_ASSERT(0 == (d_controls_p[index] & 0x80));
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    --d_size;
+
+    // If the group of the slot has an empty slot, no probe sequence continues
+    // past this group, so the slot can be marked empty rather than erased.
+
+    const bsl::size_t base = index & ~static_cast<bsl::size_t>(
+                                                    GroupControl::k_SIZE - 1);
+    if (GroupControl(d_controls_p + base).neverFull()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+        ++d_numErased;
+    }
+
+    iterator result = makeIterator(index);
+    ++result;
+    return result;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const const_iterator position = find(key);
+    if (position == end()) {
+        return 0;                                                     // RETURN
+    }
+    erase(position);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    if (0 == d_size) {
+        return end();                                                 // RETURN
+    }
+
+    return makeIterator(indexOf(key, mixedHash(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    bool              isNew;
+    Uint64            hashValue;
+    const bsl::size_t index = findOrPrepareSlot(&isNew,
+                                                &hashValue,
+                                                ENTRY_UTIL::key(entry));
+
+    if (isNew) {
+        bslma::ConstructionUtil::construct(d_entries_p + index,
+                                           d_allocator_p,
+                                           entry);
+        commitSlot(index, hashValue);
+    }
+
+    return bsl::pair<iterator, bool>(makeIterator(index), isNew);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&            lvalue = entry;
+    bool              isNew;
+    Uint64            hashValue;
+    const bsl::size_t index  = findOrPrepareSlot(&isNew,
+                                                 &hashValue,
+                                                 ENTRY_UTIL::key(lvalue));
+
+    if (isNew) {
+        bslma::ConstructionUtil::construct(
+                                        d_entries_p + index,
+                                        d_allocator_p,
+                                        bslmf::MovableRefUtil::move(lvalue));
+        commitSlot(index, hashValue);
+    }
+
+    return bsl::pair<iterator, bool>(makeIterator(index), isNew);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t newCapacity = capacityForNumEntries(d_size);
+
+    if (minimumCapacity > newCapacity) {
+        newCapacity = GroupControl::k_SIZE;
+        while (newCapacity < minimumCapacity) {
+            newCapacity *= 2;
+        }
+    }
+
+    if (0 == newCapacity) {
+        destroyAndDeallocate();
+        return;                                                       // RETURN
+    }
+
+    rehashToCapacity(newCapacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    const bsl::size_t newCapacity = capacityForNumEntries(numEntries);
+
+    if (newCapacity > d_capacity) {
+        rehashToCapacity(newCapacity);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_numErased,  &other.d_numErased);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_groupShift, &other.d_groupShift);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+         typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+         bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::tryEmplace(const KEY& key)
+{
+    bool              isNew;
+    Uint64            hashValue;
+    const bsl::size_t index = findOrPrepareSlot(&isNew, &hashValue, key);
+
+    if (isNew) {
+        ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+        commitSlot(index, hashValue);
+    }
+
+    return bsl::pair<iterator, bool>(makeIterator(index), isNew);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    bsl::size_t index = 0;
+    while (index < d_capacity && (d_controls_p[index] & 0x80)) {
+        ++index;
+    }
+    return makeIterator(index);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return makeIterator(d_capacity);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return 0 != d_size && d_capacity != indexOf(key, mixedHash(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const unsigned char *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::controls() const
+{
+    return d_controls_p;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_cast<FlatHashTable *>(this)->end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const EQUAL&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::equalityComparator() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_cast<FlatHashTable *>(this)->find(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+const HASH& FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hasher() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::loadFactor() const
+{
+    return 0 == d_capacity
+           ? 0.0f
+           : static_cast<float>(d_size) / static_cast<float>(d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxLoadFactor() const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        const ConstIterator match = rhs.find(ENTRY_UTIL::key(*it));
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void bdlc::swap(FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& a,
+                FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureA(b,
+                                                               a.allocator());
+    FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL> futureB(a,
+                                                               b.allocator());
+
+    a.swap(futureA);
+    b.swap(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1212 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements an open-addressed hash table,
+// 'bdlc::FlatHashTable', and a component-private class,
+// 'bdlc::FlatHashTable_GroupControl', that evaluates a group of control bytes
+// at once.  The group control is tested first, against a byte-by-byte oracle,
+// since the correctness of every table operation depends on it.  The table is
+// then tested by applying sequences of operations to it and to a 'bsl::set'
+// oracle, using both a reasonable hash functor and a degenerate one (that
+// forces every key into the same probe sequence, exercising probing across
+// groups and the handling of erased slots).
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o Injected exceptions are safely propagated during memory allocation.
+// ----------------------------------------------------------------------------
+// CLASS 'bdlc::FlatHashTable_GroupControl'
+// [ 2] FlatHashTable_GroupControl(const unsigned char *data);
+// [ 2] unsigned int available() const;
+// [ 2] unsigned int inUse() const;
+// [ 2] unsigned int match(unsigned char value) const;
+// [ 2] bool neverFull() const;
+//
+// CLASS 'bdlc::FlatHashTable'
+// [ 3] FlatHashTable(capacity, hash, equal, basicAllocator);
+// [ 5] FlatHashTable(const FlatHashTable& original, basicAllocator);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable> original);
+// [ 5] FlatHashTable(MovableRef<FlatHashTable> original, basicAllocator);
+// [ 3] ~FlatHashTable();
+// [ 5] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 5] FlatHashTable& operator=(MovableRef<FlatHashTable> rhs);
+// [ 3] void clear();
+// [ 3] iterator erase(const_iterator position);
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const ENTRY& entry);
+// [ 3] pair<iterator, bool> insert(MovableRef<ENTRY> entry);
+// [ 4] void rehash(bsl::size_t minimumCapacity);
+// [ 4] void reserve(bsl::size_t numEntries);
+// [ 5] void swap(FlatHashTable& other);
+// [ 3] pair<iterator, bool> tryEmplace(const KEY& key);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 3] bslma::Allocator *allocator() const;
+// [ 3] bsl::size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 3] float loadFactor() const;
+// [ 3] bsl::size_t size() const;
+// [ 5] bool operator==(lhs, rhs);
+// [ 5] bool operator!=(lhs, rhs);
+// [ 5] void swap(FlatHashTable& a, FlatHashTable& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: Injected exceptions are safely propagated.
+// [ 4] CONCERN: Erased slots are reclaimed.
+// [ 7] CONCERN: Control bytes filter keys having identity hashes.
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl GroupControl;
+
+                          // ===================
+                          // struct IdentityUtil
+                          // ===================
+
+template <class KEY>
+struct IdentityUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' functions for a table whose
+    // entries are their own keys.
+
+    static void constructFromKey(KEY              *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key)
+        // Create a copy of the specified 'key' at the specified 'entry'
+        // address using the specified 'allocator'.
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+
+    static const KEY& key(const KEY& entry)
+        // Return the specified 'entry'.
+    {
+        return entry;
+    }
+};
+
+                            // ==============
+                            // struct BadHash
+                            // ==============
+
+struct BadHash {
+    // This functor maps every key to the same hash value, so that all keys
+    // share a single probe sequence.
+
+    template <class KEY>
+    bsl::size_t operator()(const KEY&) const
+        // Return 0.
+    {
+        return 0;
+    }
+};
+
+                          // ====================
+                          // struct CountingEqual
+                          // ====================
+
+struct CountingEqual {
+    // This functor compares 'int' keys for equality, and counts the number of
+    // comparisons performed by all objects of this type.
+
+    static int s_numComparisons;  // number of comparisons performed
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal, and
+        // 'false' otherwise.
+    {
+        ++s_numComparisons;
+        return lhs == rhs;
+    }
+};
+
+int CountingEqual::s_numComparisons = 0;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            bsl::hash<int>,
+                            bsl::equal_to<int> >          Obj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            bsl::hash<int>,
+                            CountingEqual>                CountingObj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            BadHash,
+                            bsl::equal_to<int> >          BadObj;
+
+typedef bdlc::FlatHashTable<bsl::string,
+                            bsl::string,
+                            IdentityUtil<bsl::string>,
+                            bsl::hash<bsl::string>,
+                            bsl::equal_to<bsl::string> >  StrObj;
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+// ============================================================================
+//                            HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+unsigned int oracleMask(const unsigned char *data, unsigned char value)
+    // Return the mask of the 16 bytes at the specified 'data' address that
+    // are equal to the specified 'value'.
+{
+    unsigned int mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (data[i] == value) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+unsigned int oracleHighMask(const unsigned char *data)
+    // Return the mask of the 16 bytes at the specified 'data' address that
+    // have their high bit set.
+{
+    unsigned int mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (data[i] & 0x80) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+template <class TABLE>
+bool verify(const TABLE& table, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'table' holds exactly the keys in the
+    // specified 'oracle' and satisfies the invariants of a flat hash table,
+    // and 'false' otherwise.
+{
+    if (table.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    const bsl::size_t capacity = table.capacity();
+    if (capacity && (capacity < 16 || (capacity & (capacity - 1)))) {
+        return false;                                                 // RETURN
+    }
+    if (table.size() > capacity / 8 * 7) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::size_t numIterated = 0;
+    for (typename TABLE::const_iterator it = table.begin();
+         it != table.end();
+         ++it) {
+        if (0 == oracle.count(*it)) {
+            return false;                                             // RETURN
+        }
+        ++numIterated;
+    }
+    if (numIterated != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (bsl::set<int>::const_iterator it = oracle.begin();
+         it != oracle.end();
+         ++it) {
+        if (!table.contains(*it) || *table.find(*it) != *it) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class TABLE, class HASH>
+void randomOperations(int numOperations, int keyRange, int seed)
+    // Apply the specified 'numOperations' random insertions and removals of
+    // keys in the range '[0 .. keyRange)', using the specified 'seed', to a
+    // table of the (template parameter) 'TABLE' type, using the (template
+    // parameter) 'HASH' functor, and to an oracle, and verify that they agree.
+{
+    bslma::TestAllocator oa("object");
+
+    TABLE         mX(0, HASH(), bsl::equal_to<int>(), &oa);
+    bsl::set<int> oracle(&oa);
+
+    unsigned int state = seed;
+    for (int i = 0; i < numOperations; ++i) {
+        state = state * 1103515245 + 12345;
+        const int key = static_cast<int>((state >> 8) % keyRange);
+        const int op  = static_cast<int>((state >> 4) % 3);
+
+        if (op < 2) {
+            const bool inserted = mX.insert(key).second;
+            ASSERTV(i, key, inserted == oracle.insert(key).second);
+        }
+        else {
+            ASSERTV(i, key, oracle.erase(key) == mX.erase(key));
+        }
+
+        if (0 == i % 97) {
+            ASSERTV(i, verify(mX, oracle));
+        }
+    }
+    ASSERT(verify(mX, oracle));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONTROL BYTES OF KEYS HAVING IDENTITY HASHES
+        //
+        // Concerns:
+        //: 1 The control bytes of keys whose identity hash values differ only
+        //:   in their high-order bits (here, multiples of 128) are
+        //:   distributed, so that a look-up compares its key with few
+        //:   entries.
+        //
+        // Plan:
+        //: 1 Insert the keys 'i << 7' into a table using 'bsl::hash<int>' and
+        //:   an equality functor counting its invocations.  Look up each
+        //:   inserted key, and as many absent multiples of 128, and verify
+        //:   that the average number of comparisons per look-up is close to
+        //:   1 and 0, respectively.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Control bytes filter keys having identity hashes.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONTROL BYTES OF KEYS HAVING IDENTITY HASHES"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int NUM_KEYS[] = { 10, 100, 1000, 10000 };
+
+        for (bsl::size_t ti = 0; ti < sizeof NUM_KEYS / sizeof *NUM_KEYS;
+                                                                        ++ti) {
+            const int N = NUM_KEYS[ti];
+
+            CountingObj mX(0, bsl::hash<int>(), CountingEqual(), &oa);
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(N, i, mX.insert(i << 7).second);
+            }
+
+            CountingEqual::s_numComparisons = 0;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(N, i, mX.contains(i << 7));
+            }
+            const double hitRatio =
+                        static_cast<double>(CountingEqual::s_numComparisons)
+                                                                         / N;
+
+            CountingEqual::s_numComparisons = 0;
+            for (int i = N; i < 2 * N; ++i) {
+                ASSERTV(N, i, !mX.contains(i << 7));
+            }
+            const double missRatio =
+                        static_cast<double>(CountingEqual::s_numComparisons)
+                                                                         / N;
+
+            if (veryVerbose) { T_ P_(N) P_(hitRatio) P(missRatio) }
+
+            ASSERTV(N, hitRatio,  hitRatio  < 1.25);
+            ASSERTV(N, missRatio, missRatio < 0.5);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 An exception thrown while allocating the arrays of a table, or
+        //:   while copying an entry into it, leaves the table unchanged and
+        //:   leaks no memory.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, insert
+        //:   and copy tables of long strings, and verify the value of the
+        //:   table after each attempt.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Injected exceptions are safely propagated.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int NUM_VALUES = 40;
+
+        bsl::vector<bsl::string> values(&oa);
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            bsl::string s(SUFFICIENTLY_LONG_STRING, &oa);
+            s += static_cast<char>('A' + i);
+            values.push_back(s);
+        }
+        const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+        if (verbose) cout << "\tInsertion." << endl;
+        {
+            StrObj mX(0,
+                      bsl::hash<bsl::string>(),
+                      bsl::equal_to<bsl::string>(),
+                      &oa);
+
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    if (veryVerbose) { T_ P(i) }
+
+                    ASSERTV(i, static_cast<bsl::size_t>(i) == mX.size());
+
+                    mX.insert(values[i]);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, static_cast<bsl::size_t>(i + 1) == mX.size());
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(i, j, mX.contains(values[j]));
+                }
+            }
+
+            if (verbose) cout << "\tCopy construction." << endl;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StrObj mY(mX, &oa);
+
+                ASSERT(mY == mX);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            if (verbose) cout << "\tCopy assignment." << endl;
+
+            StrObj mZ(0,
+                      bsl::hash<bsl::string>(),
+                      bsl::equal_to<bsl::string>(),
+                      &oa);
+            mZ.insert(values[0]);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(1 == mZ.size() || mZ == mX);
+
+                mZ = mX;
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(mZ == mX);
+        }
+        ASSERTV(oa.numBlocksInUse(), NUM_BLOCKS == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original, and uses the
+        //:   supplied allocator.
+        //:
+        //: 2 Moving with the same allocator transfers the storage without
+        //:   allocating, leaving the source empty; moving with a different
+        //:   allocator copies.
+        //:
+        //: 3 Assignment, copy or move, gives the target the value of the
+        //:   source, including self-assignment.
+        //:
+        //: 4 Two tables holding the same keys compare equal regardless of
+        //:   insertion order and capacity.
+        //:
+        //: 5 The member 'swap' exchanges values without allocating; the free
+        //:   'swap' works with different allocators.
+        //
+        // Plan:
+        //: 1 Create tables of various sizes and perform each operation,
+        //:   monitoring the allocators.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, basicAllocator);
+        //   FlatHashTable(MovableRef<FlatHashTable> original);
+        //   FlatHashTable(MovableRef<FlatHashTable> original, basicAllocator);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   FlatHashTable& operator=(MovableRef<FlatHashTable> rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(lhs, rhs);
+        //   bool operator!=(lhs, rhs);
+        //   void swap(FlatHashTable& a, FlatHashTable& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, SWAP, AND EQUALITY" << endl
+                          << "==============================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 13, 14, 15, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX.insert(i * 7);
+            }
+            // Erase and re-insert some keys to leave tombstones.
+            for (int i = 0; i < SIZE; i += 3) {
+                mX.erase(i * 7);
+            }
+            for (int i = 0; i < SIZE; i += 3) {
+                mX.insert(i * 7);
+            }
+
+            // Same keys, in reverse order and with a larger capacity.
+            Obj mW(4096, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            for (int i = SIZE - 1; i >= 0; --i) {
+                mW.insert(i * 7);
+            }
+            ASSERTV(SIZE, X == mW);
+            ASSERTV(SIZE, !(X != mW));
+
+            mW.insert(-1);
+            ASSERTV(SIZE, X != mW);
+            mW.erase(-1);
+            ASSERTV(SIZE, X == mW);
+
+            if (SIZE) {
+                mW.erase(0);
+                mW.insert(-7);
+                ASSERTV(SIZE, X != mW);
+            }
+
+            // Copy construction.
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, &za == Y.allocator());
+                ASSERTV(SIZE, X.capacity() == Y.capacity());
+            }
+
+            // Move construction, same allocator.
+            {
+                Obj mS(X, &oa);
+                const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+                Obj mY(MoveUtil::move(mS));  const Obj& Y = mY;
+
+                ASSERTV(SIZE, NUM_ALLOC == oa.numAllocations());
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, 0 == mS.size());
+                ASSERTV(SIZE, 0 == mS.capacity());
+                ASSERTV(SIZE, &oa == Y.allocator());
+
+                mS.insert(5);  // moved-from object is usable
+                ASSERTV(SIZE, mS.contains(5));
+            }
+
+            // Move construction, different allocator.
+            {
+                Obj mS(X, &oa);
+
+                Obj mY(MoveUtil::move(mS), &za);  const Obj& Y = mY;
+
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, X == mS);
+                ASSERTV(SIZE, &za == Y.allocator());
+            }
+
+            // Copy and move assignment.
+            {
+                Obj mY(0, bsl::hash<int>(), bsl::equal_to<int>(), &za);
+                mY.insert(12345);
+
+                mY = X;
+                ASSERTV(SIZE, X == mY);
+                ASSERTV(SIZE, &za == mY.allocator());
+
+                mY = mY;
+                ASSERTV(SIZE, X == mY);
+
+                Obj mS(X, &za);
+                mY.clear();
+                mY = MoveUtil::move(mS);
+                ASSERTV(SIZE, X == mY);
+                ASSERTV(SIZE, 0 == mS.size());
+
+                Obj mT(X, &oa);
+                mY.clear();
+                mY = MoveUtil::move(mT);
+                ASSERTV(SIZE, X == mY);
+                ASSERTV(SIZE, X == mT);
+                ASSERTV(SIZE, &za == mY.allocator());
+            }
+
+            // Swap.
+            {
+                Obj mA(X, &oa);
+                Obj mB(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+                mB.insert(-3);
+
+                const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+                mA.swap(mB);
+
+                ASSERTV(SIZE, NUM_ALLOC == oa.numAllocations());
+                ASSERTV(SIZE, X == mB);
+                ASSERTV(SIZE, 1 == mA.size() && mA.contains(-3));
+
+                Obj mC(0, bsl::hash<int>(), bsl::equal_to<int>(), &za);
+                mC.insert(-5);
+
+                swap(mB, mC);
+
+                ASSERTV(SIZE, X == mC);
+                ASSERTV(SIZE, 1 == mB.size() && mB.contains(-5));
+                ASSERTV(SIZE, &oa == mB.allocator());
+                ASSERTV(SIZE, &za == mC.allocator());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // REHASH AND RESERVE
+        //
+        // Concerns:
+        //: 1 'reserve(n)' allocates enough capacity that 'n' insertions do
+        //:   not allocate.
+        //:
+        //: 2 'rehash' changes the capacity to the requested power of two
+        //:   (but never below what the entries need), preserving the entries,
+        //:   and 'rehash(0)' on an empty table releases all memory.
+        //:
+        //: 3 Repeatedly erasing and inserting keys does not grow the table
+        //:   without bound; erased slots are reclaimed.
+        //
+        // Plan:
+        //: 1 Reserve, then insert, monitoring the allocator.  (C-1)
+        //:
+        //: 2 Rehash to various capacities and verify the entries.  (C-2)
+        //:
+        //: 3 Using the degenerate hash, churn a table of constant size and
+        //:   verify its capacity remains bounded.  (C-3)
+        //
+        // Testing:
+        //   void rehash(bsl::size_t minimumCapacity);
+        //   void reserve(bsl::size_t numEntries);
+        //   CONCERN: Erased slots are reclaimed.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "REHASH AND RESERVE" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\t'reserve'." << endl;
+        {
+            const int COUNTS[] = { 1, 14, 15, 100, 1000, 10000 };
+            const int NUM_COUNTS =
+                              static_cast<int>(sizeof COUNTS / sizeof *COUNTS);
+
+            for (int ti = 0; ti < NUM_COUNTS; ++ti) {
+                const int COUNT = COUNTS[ti];
+
+                Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+                mX.reserve(COUNT);
+
+                const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+                const bsl::size_t        CAPACITY  = mX.capacity();
+
+                ASSERTV(COUNT, CAPACITY / 8 * 7 >= bsl::size_t(COUNT));
+                ASSERTV(COUNT, CAPACITY / 16 * 7 < bsl::size_t(COUNT)
+                                                         || 16 == CAPACITY);
+
+                for (int i = 0; i < COUNT; ++i) {
+                    mX.insert(i);
+                }
+                ASSERTV(COUNT, NUM_ALLOC == oa.numAllocations());
+                ASSERTV(COUNT, CAPACITY  == mX.capacity());
+
+                mX.reserve(1);  // never shrinks
+                ASSERTV(COUNT, CAPACITY  == mX.capacity());
+            }
+        }
+
+        if (verbose) cout << "\t'rehash'." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            bsl::set<int> oracle;
+
+            mX.rehash(0);
+            ASSERT(0 == mX.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.rehash(1);
+            ASSERT(16 == mX.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == mX.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(i * 3);
+                oracle.insert(i * 3);
+            }
+            ASSERT(64 == mX.capacity());
+
+            mX.rehash(1000);
+            ASSERT(1024 == mX.capacity());
+            ASSERT(verify(mX, oracle));
+
+            mX.rehash(0);
+            ASSERT(64 == mX.capacity());
+            ASSERT(verify(mX, oracle));
+
+            mX.clear();
+            ASSERT(64 == mX.capacity());
+            mX.rehash(0);
+            ASSERT(0 == mX.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tReclaiming erased slots." << endl;
+        {
+            BadObj mX(0, BadHash(), bsl::equal_to<int>(), &oa);
+            bsl::set<int> oracle;
+
+            for (int i = 0; i < 40; ++i) {
+                mX.insert(i);
+                oracle.insert(i);
+            }
+            const bsl::size_t CAPACITY = mX.capacity();
+
+            for (int i = 40; i < 5000; ++i) {
+                mX.erase(i - 40);
+                oracle.erase(i - 40);
+                mX.insert(i);
+                oracle.insert(i);
+                ASSERTV(i, CAPACITY == mX.capacity());
+            }
+            ASSERT(verify(mX, oracle));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly-created table is empty and, if created with 0 capacity,
+        //:   allocates no memory.
+        //:
+        //: 2 'insert' and 'tryEmplace' add an entry exactly when its key is
+        //:   absent, returning an iterator to the entry having the key.
+        //:
+        //: 3 'find', 'contains', and iteration agree with the set of inserted
+        //:   and not erased keys, including when every key collides.
+        //:
+        //: 4 'erase' by key and by position removes exactly one entry, and
+        //:   erasing by position returns an iterator to the next entry.
+        //:
+        //: 5 'clear' destroys all entries, retaining capacity.
+        //:
+        //: 6 All memory comes from the object allocator, and the capacity is
+        //:   a power of two (at least 16) respecting the maximum load.
+        //
+        // Plan:
+        //: 1 Perform table-driven and random sequences of operations, on
+        //:   tables with a good and a degenerate hash functor, comparing
+        //:   against a 'bsl::set' oracle.  (C-1..6)
+        //
+        // Testing:
+        //   FlatHashTable(capacity, hash, equal, basicAllocator);
+        //   ~FlatHashTable();
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const ENTRY& entry);
+        //   pair<iterator, bool> insert(MovableRef<ENTRY> entry);
+        //   pair<iterator, bool> tryEmplace(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   bslma::Allocator *allocator() const;
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY& key) const;
+        //   float loadFactor() const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tEmpty table." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            ASSERT(0   == oa.numBlocksTotal());
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.empty());
+            ASSERT(0   == X.size());
+            ASSERT(0   == X.capacity());
+            ASSERT(0.0f == X.loadFactor());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.end() == X.find(3));
+            ASSERT(!X.contains(3));
+            ASSERT(0 == mX.erase(3));
+
+            Obj mY(5, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            ASSERT(16 == mY.capacity());
+            ASSERT(2  == oa.numBlocksInUse());
+
+            Obj mZ(17, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            ASSERT(32 == mZ.capacity());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tInsert, find, and erase." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            bsl::pair<Obj::iterator, bool> rv = mX.insert(10);
+            ASSERT(rv.second);
+            ASSERT(10 == *rv.first);
+            ASSERT(16 == X.capacity());
+
+            rv = mX.insert(10);
+            ASSERT(!rv.second);
+            ASSERT(10 == *rv.first);
+            ASSERT(1  == X.size());
+
+            int value = 20;
+            rv = mX.insert(bslmf::MovableRefUtil::move(value));
+            ASSERT(rv.second);
+            ASSERT(20 == *rv.first);
+
+            rv = mX.tryEmplace(30);
+            ASSERT(rv.second);
+            ASSERT(30 == *rv.first);
+
+            rv = mX.tryEmplace(30);
+            ASSERT(!rv.second);
+            ASSERT(3 == X.size());
+
+            ASSERT(X.contains(10));
+            ASSERT(X.contains(20));
+            ASSERT(X.contains(30));
+            ASSERT(!X.contains(40));
+            ASSERT(20 == *X.find(20));
+            ASSERT(X.end() == X.find(40));
+            ASSERT(3.0f / 16.0f == X.loadFactor());
+
+            Obj::iterator it = mX.find(20);
+            Obj::iterator next = it;
+            ++next;
+            ASSERT(next == mX.erase(it));
+            ASSERT(2 == X.size());
+            ASSERT(!X.contains(20));
+
+            ASSERT(1 == mX.erase(10));
+            ASSERT(0 == mX.erase(10));
+            ASSERT(1 == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(16 == X.capacity());
+            ASSERT(X.begin() == X.end());
+            ASSERT(!X.contains(30));
+
+            // Erasing every entry through iterators.
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            int count = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ) {
+                it = mX.erase(it);
+                ++count;
+            }
+            ASSERT(100 == count);
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tCapacity growth." << endl;
+        {
+            Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 14; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(16 == X.capacity());
+            mX.insert(14);
+            ASSERT(32 == X.capacity());
+
+            for (int i = 15; i < 10000; ++i) {
+                mX.insert(i);
+                ASSERTV(i, X.size() <= X.capacity() / 8 * 7);
+            }
+            ASSERT(16384 == X.capacity());
+            ASSERT(2     == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tRandom operations." << endl;
+        {
+            for (int seed = 1; seed <= 5; ++seed) {
+                randomOperations<Obj, bsl::hash<int> >(5000, 300, seed);
+                randomOperations<Obj, bsl::hash<int> >(5000, 3000, seed);
+                randomOperations<BadObj, BadHash>(2000, 100, seed);
+            }
+        }
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            StrObj mX(0,
+                      bsl::hash<bsl::string>(),
+                      bsl::equal_to<bsl::string>(),
+                      &oa);
+
+            const bsl::string LONG(SUFFICIENTLY_LONG_STRING, &oa);
+
+            bsl::string longer(LONG, &oa);
+            longer += 'x';
+
+            mX.insert(LONG);
+            mX.tryEmplace(longer);
+
+            for (StrObj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ASSERT(&oa == it->get_allocator().mechanism());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // GROUP CONTROL
+        //
+        // Concerns:
+        //: 1 'match' returns exactly the bytes equal to the value.
+        //:
+        //: 2 'available' returns exactly the empty and erased bytes, and
+        //:   'inUse' its complement.
+        //:
+        //: 3 'neverFull' is 'true' exactly when some byte is empty.
+        //:
+        //: 4 Bit 'i' of each mask corresponds to byte 'i', on every platform.
+        //
+        // Plan:
+        //: 1 For a set of crafted and random groups of control bytes,
+        //:   compare the result of each query against a byte-by-byte oracle.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const unsigned char *data);
+        //   unsigned int available() const;
+        //   unsigned int inUse() const;
+        //   unsigned int match(unsigned char value) const;
+        //   bool neverFull() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GROUP CONTROL" << endl
+                          << "=============" << endl;
+
+        ASSERT(0x80 == GroupControl::k_EMPTY);
+        ASSERT(0xC0 == GroupControl::k_ERASED);
+        ASSERT(16   == GroupControl::k_SIZE);
+
+        unsigned char data[16];
+
+        if (verbose) cout << "\tCrafted groups." << endl;
+        {
+            bsl::memset(data, GroupControl::k_EMPTY, sizeof data);
+
+            GroupControl empty(data);
+            ASSERT(0xFFFF == empty.available());
+            ASSERT(0      == empty.inUse());
+            ASSERT(0      == empty.match(0));
+            ASSERT(empty.neverFull());
+
+            bsl::memset(data, GroupControl::k_ERASED, sizeof data);
+
+            GroupControl erased(data);
+            ASSERT(0xFFFF == erased.available());
+            ASSERT(0      == erased.inUse());
+            ASSERT(!erased.neverFull());
+
+            for (int i = 0; i < 16; ++i) {
+                bsl::memset(data, 0x11, sizeof data);
+                data[i] = 0x7F;
+
+                GroupControl one(data);
+                ASSERTV(i, (1u << i) == one.match(0x7F));
+                ASSERTV(i, (0xFFFFu & ~(1u << i)) == one.match(0x11));
+                ASSERTV(i, 0 == one.available());
+                ASSERTV(i, 0xFFFF == one.inUse());
+                ASSERTV(i, !one.neverFull());
+
+                data[i] = GroupControl::k_EMPTY;
+
+                GroupControl hole(data);
+                ASSERTV(i, (1u << i) == hole.available());
+                ASSERTV(i, hole.neverFull());
+                ASSERTV(i, 0 == hole.match(0));
+
+                data[i] = GroupControl::k_ERASED;
+
+                GroupControl tomb(data);
+                ASSERTV(i, (1u << i) == tomb.available());
+                ASSERTV(i, !tomb.neverFull());
+            }
+
+            // Neighboring bytes must not influence each other (e.g., through
+            // borrows in word-wide arithmetic).
+
+            for (int i = 0; i < 16; ++i) {
+                data[i] = static_cast<unsigned char>(i % 2 ? 0x01 : 0x00);
+            }
+            GroupControl alternating(data);
+            ASSERT(0x5555 == alternating.match(0x00));
+            ASSERT(0xAAAA == alternating.match(0x01));
+        }
+
+        if (verbose) cout << "\tRandom groups." << endl;
+        {
+            unsigned int state = 12345;
+            for (int ti = 0; ti < 20000; ++ti) {
+                for (int i = 0; i < 16; ++i) {
+                    state = state * 1103515245 + 12345;
+                    const unsigned int r = (state >> 16) % 8;
+                    data[i] = r == 0 ? GroupControl::k_EMPTY
+                            : r == 1 ? GroupControl::k_ERASED
+                            : static_cast<unsigned char>(
+                                         (state >> 8) % (r == 2 ? 4 : 128));
+                }
+
+                const GroupControl X(data);
+
+                const unsigned int HIGH = oracleHighMask(data);
+                ASSERTV(ti, HIGH == X.available());
+                ASSERTV(ti, (~HIGH & 0xFFFF) == X.inUse());
+                ASSERTV(ti, (0 != oracleMask(data, GroupControl::k_EMPTY))
+                                                          == X.neverFull());
+
+                for (int v = 0; v < 128; v += (v < 8 ? 1 : 13)) {
+                    const unsigned char V = static_cast<unsigned char>(v);
+                    ASSERTV(ti, v, oracleMask(data, V) == X.match(V));
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, find, and erase a few keys.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(0, bsl::hash<int>(), bsl::equal_to<int>(), &oa);
+        const Obj& X = mX;
+
+        ASSERT(X.empty());
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERTV(i, mX.insert(i).second);
+        }
+        ASSERT(1000 == X.size());
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERTV(i, X.contains(i));
+        }
+        ASSERT(!X.contains(1000));
+
+        for (int i = 0; i < 1000; i += 2) {
+            ASSERTV(i, 1 == mX.erase(i));
+        }
+        ASSERT(500 == X.size());
+
+        for (int i = 0; i < 1000; ++i) {
+            ASSERTV(i, (i % 2 == 1) == X.contains(i));
+        }
+
+        int sum = 0;
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            sum += *it;
+        }
+        ASSERT(250000 == sum);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,971 @@
+// bdlc_flatmap.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATMAP
+#define INCLUDED_BDLC_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map container stored in a sorted vector.
+//
+//@CLASSES:
+//  bdlc::FlatMap: ordered map of unique keys in contiguous storage
+//
+//@SEE_ALSO: bdlc_flatmultimap, bdlc_flatset, bdlc_flattree, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatMap', implementing a value-semantic container that maps unique
+// keys to values in key order, and that is largely interface-compatible with
+// 'bsl::map'.  Unlike 'bsl::map', which allocates a red-black tree node for
+// each element, 'bdlc::FlatMap' stores its elements in a single
+// 'bsl::vector', sorted by key.  See 'bdlc_flattree' for details of the
+// implementation.
+//
+// The flat layout makes 'bdlc::FlatMap' well suited to tables that are built
+// once (or rarely) and then read many times:
+//
+//: o Lookup is a branch-free binary search over contiguous memory, and
+//:   iteration is a linear scan, so both are several times faster than for
+//:   'bsl::map' once the map no longer fits in the first-level cache.
+//:
+//: o Building a map performs a logarithmic number of allocations, and the map
+//:   uses no memory per element beyond 'sizeof(value_type)'.
+//:
+//: o Inserting or erasing a single element is linear in the size of the map.
+//:   Maps should therefore be built in bulk: by the range constructor, by
+//:   range 'insert', or by adopting a 'bsl::vector' of elements, each of
+//:   which sorts the new elements once and merges them with the existing
+//:   ones.
+//:
+//: o Any insertion or removal invalidates iterators, pointers, and references
+//:   to elements.
+//
+// 'bdlc::FlatMap' uses the 'bslma::Allocator' protocol for all memory
+// allocation, and propagates its allocator to its elements if they use
+// 'bslma'-style allocation.  It supports BDEX streaming (see the 'bslx'
+// package documentation) provided that 'KEY' and 'VALUE' do.
+//
+// The value type of the map is 'bsl::pair<KEY, VALUE>' (rather than
+// 'bsl::pair<const KEY, VALUE>' as for 'bsl::map'), allowing elements to be
+// moved efficiently within the vector; the behavior is undefined if the key
+// of an element is modified through an iterator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Read-Mostly Configuration Table
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we load a table of configuration parameters once at startup, and
+// consult it many times afterwards.
+//
+// First, we gather the parameters, in no particular order, in a vector:
+//..
+//  typedef bdlc::FlatMap<bsl::string, int> Config;
+//
+//  bslma::TestAllocator oa("object");
+//
+//  bsl::vector<Config::value_type> entries(&oa);
+//  entries.push_back(Config::value_type("timeout",     30, &oa));
+//  entries.push_back(Config::value_type("maxRetries",   5, &oa));
+//  entries.push_back(Config::value_type("poolSize",    16, &oa));
+//  entries.push_back(Config::value_type("timeout",     60, &oa));
+//..
+// Then, we create the map by adopting the vector, which sorts the elements
+// once and keeps one element for the duplicated key:
+//..
+//  Config config(bslmf::MovableRefUtil::move(entries), &oa);
+//
+//  assert(3 == config.size());
+//..
+// Next, we look up parameters:
+//..
+//  assert(5  == config.at("maxRetries"));
+//  assert(16 == config["poolSize"]);
+//  assert(config.contains("timeout"));
+//  assert(config.end() == config.find("logLevel"));
+//..
+// Finally, we observe that iteration visits the elements in key order:
+//..
+//  Config::const_iterator it = config.begin();
+//  assert("maxRetries" == it->first);
+//  ++it;
+//  assert("poolSize"   == it->first);
+//  ++it;
+//  assert("timeout"    == it->first);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flattree.h>
+
+#include <bslalg_constructorproxy.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                               // =============
+                               // class FlatMap
+                               // =============
+
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class FlatMap {
+    // This class template implements a value-semantic container that maps
+    // unique keys of the (template parameter) type 'KEY' to values of the
+    // (template parameter) type 'VALUE', ordered by the (template parameter)
+    // type 'COMPARATOR', storing its elements in a sorted vector.  See the
+    // component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef FlatTree<KEY,
+                     bsl::pair<KEY, VALUE>,
+                     FlatTree_PairEntryUtil<KEY, VALUE>,
+                     COMPARATOR> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying sorted vector
+
+    // FRIENDS
+    template <class K, class V, class C>
+    friend bool operator==(const FlatMap<K, V, C>&, const FlatMap<K, V, C>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef VALUE                                mapped_type;
+    typedef bsl::pair<KEY, VALUE>                value_type;
+    typedef bsl::size_t                          size_type;
+    typedef bsl::ptrdiff_t                       difference_type;
+    typedef COMPARATOR                           key_compare;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef value_type                          *pointer;
+    typedef const value_type                    *const_pointer;
+    typedef typename ImplType::iterator          iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+    typedef bsl::vector<value_type>              container_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatMap, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to the 'bdexStreamOut'
+        // method.  Note that it is highly recommended that 'versionSelector'
+        // be formatted as "YYYYMMDD", a date representation.  Also note that
+        // 'versionSelector' should be a *compile*-time-chosen value that
+        // selects a format version supported by both externalizer and
+        // unexternalizer.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+
+    // CREATORS
+    FlatMap();
+    explicit FlatMap(bslma::Allocator *basicAllocator);
+    explicit FlatMap(const COMPARATOR&  comparator,
+                     bslma::Allocator  *basicAllocator = 0);
+        // Create an empty map.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMap(INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a map holding the 'value_type' objects in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element.  If the sequence holds several
+        // elements having equivalent keys, it is unspecified which of them is
+        // inserted.  Optionally specify a 'comparator' used to order keys.  If
+        // 'comparator' is not supplied, a default-constructed 'COMPARATOR' is
+        // used.  Optionally specify a 'basicAllocator' used to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  The behavior is undefined unless '[first .. last)' is a
+        // valid range.
+
+    explicit FlatMap(bslmf::MovableRef<container_type>  container,
+                     bslma::Allocator                  *basicAllocator = 0);
+    FlatMap(bslmf::MovableRef<container_type>  container,
+            const COMPARATOR&                  comparator,
+            bslma::Allocator                  *basicAllocator = 0);
+        // Create a map holding the elements of the specified 'container',
+        // which need not be sorted.  If 'container' holds several elements
+        // having equivalent keys, it is unspecified which of them is retained.
+        // Optionally specify a 'comparator' used to order keys.  If
+        // 'comparator' is not supplied, a default-constructed 'COMPARATOR' is
+        // used.  Optionally specify a 'basicAllocator' used to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  If 'container' uses the same allocator, its storage is
+        // adopted and 'container' is left empty; otherwise, 'container' is
+        // copied and left unchanged.
+
+    FlatMap(const FlatMap& original, bslma::Allocator *basicAllocator = 0);
+        // Create a map having the same value and comparator as the specified
+        // 'original' map.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    FlatMap(bslmf::MovableRef<FlatMap> original);
+        // Create a map having the same value, comparator, and allocator as the
+        // specified 'original' map, leaving 'original' empty.  No memory is
+        // allocated.
+
+    FlatMap(bslmf::MovableRef<FlatMap>  original,
+            bslma::Allocator           *basicAllocator);
+        // Create a map having the same value and comparator as the specified
+        // 'original' map, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' uses the same allocator, its
+        // storage is transferred and 'original' is left empty; otherwise,
+        // 'original' is copied and left unchanged.
+
+    ~FlatMap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatMap& operator=(const FlatMap& rhs);
+        // Assign to this map the value and comparator of the specified 'rhs'
+        // map, and return a reference providing modifiable access to this
+        // map.
+
+    FlatMap& operator=(bslmf::MovableRef<FlatMap> rhs);
+        // Assign to this map the value and comparator of the specified 'rhs'
+        // map, and return a reference providing modifiable access to this
+        // map.  If 'rhs' uses the same allocator as this map, its storage is
+        // transferred and 'rhs' is left empty; otherwise, 'rhs' is copied and
+        // left unchanged.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // element having the specified 'key', first inserting an element
+        // having 'key' and a default-constructed 'VALUE' if there is no such
+        // element.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the value of the
+        // element having the specified 'key'.  Throw 'bsl::out_of_range' if
+        // there is no such element.
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version);
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, if 'stream'
+        // becomes invalid, or if the keys read are not strictly increasing,
+        // this object is unaltered and 'stream' is invalidated.  Note that no
+        // version is read from 'stream'.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of this
+        // map is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this map the element having the specified 'key', if it
+        // exists, and return the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the element following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the element that followed them
+        // (or the past-the-end iterator).  The behavior is undefined unless
+        // '[first .. last)' is a valid range of elements of this map.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return the pair of iterators 'lower_bound(key)' and
+        // 'upper_bound(key)' for the specified 'key'.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if an element
+        // having an equivalent key does not already exist.  Return a pair
+        // whose 'first' member refers to the element having the key of
+        // 'value', and whose 'second' member is 'true' if the insertion was
+        // performed and 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this map, using its move
+        // constructor, if an element having an equivalent key does not already
+        // exist.  Return a pair whose 'first' member refers to the element
+        // having the key of 'value', and whose 'second' member is 'true' if
+        // the insertion was performed and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, whose key is not already in
+        // this map.  If the sequence holds several elements having equivalent
+        // keys, it is unspecified which of them is inserted.  The behavior is
+        // undefined unless '[first .. last)' is a valid range.
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first element whose key is not
+        // ordered before the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this map, if needed, so that the specified
+        // 'numElements' may be held without reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this map to (approximately) its size.
+
+    void swap(FlatMap& other);
+        // Exchange the value and comparator of this map with those of the
+        // specified 'other' map.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // map and 'other' use the same allocator.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first element whose key is
+        // ordered after the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this map.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the value of
+        // the element having the specified 'key'.  Throw 'bsl::out_of_range'
+        // if there is no such element.
+
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write the value of this object, using the specified 'version'
+        // format, to the specified output 'stream', and return a reference to
+        // 'stream'.  If 'stream' is initially invalid, this operation has no
+        // effect.  If 'version' is not supported, 'stream' is invalidated, but
+        // otherwise unmodified.  Note that 'version' is not written to
+        // 'stream'.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this map can hold without
+        // reallocating.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map holds an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this map having the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map holds no elements, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                        const;
+        // Return the pair of iterators 'lower_bound(key)' and
+        // 'upper_bound(key)' for the specified 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element having the specified
+        // 'key', or the past-the-end iterator if there is no such element.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key comparator of this map.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator referring to the first element whose key is not
+        // ordered before the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator referring to the first element whose key is
+        // ordered after the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this map, or
+        // the past-the-end iterator if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this map.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps have the same
+    // value, and 'false' otherwise.  Two maps have the same value if they
+    // have the same number of elements and corresponding elements (in key
+    // order) have equal keys and equal values.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' maps do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+          FlatMap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' maps.  If 'a' and 'b'
+    // use different allocators, the exchange is performed by copying.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class FlatMap
+                               // -------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+int FlatMap<KEY, VALUE, COMPARATOR>::maxSupportedBdexVersion(
+                                                     int /* versionSelector */)
+{
+    return 1;  // Required by BDE policy; versions start at 1.
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(INPUT_ITERATOR    first,
+                                         INPUT_ITERATOR    last,
+                                         bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    d_impl.insertUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(INPUT_ITERATOR     first,
+                                         INPUT_ITERATOR     last,
+                                         const COMPARATOR&  comparator,
+                                         bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    d_impl.insertUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(
+                           bslmf::MovableRef<container_type>  container,
+                           bslma::Allocator                  *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(container),
+         true,
+         COMPARATOR(),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(
+                           bslmf::MovableRef<container_type>  container,
+                           const COMPARATOR&                  comparator,
+                           bslma::Allocator                  *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(container),
+         true,
+         comparator,
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(const FlatMap&    original,
+                                         bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(bslmf::MovableRef<FlatMap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::FlatMap(
+                                  bslmf::MovableRef<FlatMap>  original,
+                                  bslma::Allocator           *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>::~FlatMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>&
+FlatMap<KEY, VALUE, COMPARATOR>::operator=(const FlatMap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMap<KEY, VALUE, COMPARATOR>&
+FlatMap<KEY, VALUE, COMPARATOR>::operator=(bslmf::MovableRef<FlatMap> rhs)
+{
+    d_impl = bslmf::MovableRefUtil::move(
+                                   bslmf::MovableRefUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+VALUE& FlatMap<KEY, VALUE, COMPARATOR>::operator[](const KEY& key)
+{
+    iterator it = d_impl.lowerBound(key);
+    if (it == d_impl.end() || d_impl.comparator()(key, it->first)) {
+        // The value is default-constructed using the allocator of this map
+        // (rather than as a temporary using the default allocator) and then
+        // moved into the new element.
+
+        bslalg::ConstructorProxy<VALUE> value(allocator());
+        value_type                      element(
+                                  key,
+                                  bslmf::MovableRefUtil::move(value.object()),
+                                  allocator());
+
+        it = d_impl.insertAt(it, bslmf::MovableRefUtil::move(element));
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+VALUE& FlatMap<KEY, VALUE, COMPARATOR>::at(const KEY& key)
+{
+    const iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                             "FlatMap<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class STREAM>
+inline
+STREAM& FlatMap<KEY, VALUE, COMPARATOR>::bdexStreamIn(STREAM& stream,
+                                                      int     version)
+{
+    return d_impl.bdexStreamIn(stream, version, true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(iterator position)
+{
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                       const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::iterator,
+          typename FlatMap<KEY, VALUE, COMPARATOR>::iterator>
+FlatMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key)
+{
+    return d_impl.equalRange(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::iterator, bool>
+FlatMap<KEY, VALUE, COMPARATOR>::insert(const value_type& value)
+{
+    return d_impl.insertUnique(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::iterator, bool>
+FlatMap<KEY, VALUE, COMPARATOR>::insert(bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insertUnique(bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                             INPUT_ITERATOR last)
+{
+    d_impl.insertUnique(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::shrink_to_fit()
+{
+    d_impl.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMap<KEY, VALUE, COMPARATOR>::swap(FlatMap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::iterator
+FlatMap<KEY, VALUE, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const VALUE& FlatMap<KEY, VALUE, COMPARATOR>::at(const KEY& key) const
+{
+    const const_iterator it = d_impl.find(key);
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                       "FlatMap<...>::at(key_type) const: invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class STREAM>
+inline
+STREAM& FlatMap<KEY, VALUE, COMPARATOR>::bdexStreamOut(STREAM& stream,
+                                                       int     version) const
+{
+    return d_impl.bdexStreamOut(stream, version);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator,
+          typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator>
+FlatMap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equalRange(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR FlatMap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *FlatMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatMap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(FlatMap<KEY, VALUE, COMPARATOR>& a,
+                FlatMap<KEY, VALUE, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatMap<KEY, VALUE, COMPARATOR> futureA(b, a.allocator());
+    FlatMap<KEY, VALUE, COMPARATOR> futureB(a, b.allocator());
+
+    a.swap(futureA);
+    b.swap(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
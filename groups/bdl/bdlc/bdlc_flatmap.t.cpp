@@ -0,0 +1,1059 @@
+// bdlc_flatmap.t.cpp                                                 -*-C++-*-
+#include <bdlc_flatmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bslx_testinstream.h>
+#include <bslx_testoutstream.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a value-semantic container,
+// 'bdlc::FlatMap', as a thin wrapper around 'bdlc::FlatTree' (which is
+// thoroughly tested in its own component).  The concerns here are therefore
+// that each method forwards correctly to the underlying tree, that elements
+// have unique keys, and that the allocator is used as documented.  Negative
+// test cases compare the performance of the map with that of 'bsl::map'.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int maxSupportedBdexVersion(int versionSelector);
+//
+// CREATORS
+// [ 2] FlatMap();
+// [ 2] FlatMap(bslma::Allocator *basicAllocator);
+// [ 2] FlatMap(const COMPARATOR& comparator, bslma::Allocator *bA = 0);
+// [ 2] FlatMap(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+// [ 2] FlatMap(first, last, const COMPARATOR& comparator, *bA = 0);
+// [ 2] FlatMap(MovableRef<container_type> container, *bA = 0);
+// [ 2] FlatMap(MovableRef<container_type> c, comparator, *bA = 0);
+// [ 3] FlatMap(const FlatMap& original, *bA = 0);
+// [ 3] FlatMap(MovableRef<FlatMap> original);
+// [ 3] FlatMap(MovableRef<FlatMap> original, *bA);
+// [ 2] ~FlatMap();
+//
+// MANIPULATORS
+// [ 3] FlatMap& operator=(const FlatMap& rhs);
+// [ 3] FlatMap& operator=(MovableRef<FlatMap> rhs);
+// [ 2] VALUE& operator[](const KEY& key);
+// [ 2] VALUE& at(const KEY& key);
+// [ 4] STREAM& bdexStreamIn(STREAM& stream, int version);
+// [ 2] void clear();
+// [ 2] bsl::size_t erase(const KEY& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 2] iterator find(const KEY& key);
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type> value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] iterator lower_bound(const KEY& key);
+// [ 2] void reserve(bsl::size_t numElements);
+// [ 2] void shrink_to_fit();
+// [ 3] void swap(FlatMap& other);
+// [ 2] iterator upper_bound(const KEY& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+//
+// ACCESSORS
+// [ 2] const VALUE& at(const KEY& key) const;
+// [ 4] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(key) const;
+// [ 2] const_iterator find(const KEY& key) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 2] const_iterator lower_bound(const KEY& key) const;
+// [ 2] bsl::size_t size() const;
+// [ 2] const_iterator upper_bound(const KEY& key) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const FlatMap& lhs, const FlatMap& rhs);
+// [ 3] bool operator!=(const FlatMap& lhs, const FlatMap& rhs);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatMap& a, FlatMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'int' KEYS
+// [-2] PERFORMANCE: 'bsl::string' KEYS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatMap<int, int>                 Obj;
+typedef bdlc::FlatMap<bsl::string, bsl::string> StrObj;
+
+typedef Obj::value_type                         IntPair;
+typedef StrObj::value_type                      StrPair;
+
+typedef bslmf::MovableRefUtil                   MoveUtil;
+
+const int SERIALIZATION_VERSION = 20200101;
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+// ============================================================================
+//                          HELPERS FOR BENCHMARKS
+// ----------------------------------------------------------------------------
+
+namespace benchmark {
+
+template <class MAP, class KEY>
+void run(const char              *name,
+         const bsl::vector<KEY>&  keys,
+         const bsl::vector<KEY>&  missingKeys,
+         int                      numRounds)
+    // Report the time taken, by a map of the (template parameter) type 'MAP'
+    // constructed with a test allocator, to be built from the specified
+    // 'keys' (in the order given), to look up each of 'keys' and each of the
+    // specified 'missingKeys' the specified 'numRounds' times, and to be
+    // iterated over 'numRounds' times, as well as the number of allocations
+    // performed, labeling the results with the specified 'name'.
+{
+    typedef bsl::pair<KEY, int> Element;
+
+    bslma::TestAllocator ta("benchmark");
+
+    bsl::vector<Element> elements(&ta);
+    elements.reserve(keys.size());
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        elements.push_back(Element(keys[i], static_cast<int>(i)));
+    }
+
+    const bsls::Types::Int64 numScratchAllocations = ta.numAllocations();
+
+    bsls::Stopwatch timer;
+    int             checksum = 0;
+
+    timer.start();
+    MAP map(elements.begin(), elements.end(), &ta);
+    timer.stop();
+    const double buildTime = timer.accumulatedWallTime();
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations()
+                                            - numScratchAllocations;
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (bsl::size_t i = 0; i < keys.size(); ++i) {
+            checksum += map.find(keys[i])->second;
+        }
+    }
+    timer.stop();
+    const double hitTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (bsl::size_t i = 0; i < missingKeys.size(); ++i) {
+            checksum += static_cast<int>(map.count(missingKeys[i]));
+        }
+    }
+    timer.stop();
+    const double missTime = timer.accumulatedWallTime();
+
+    timer.reset();
+    timer.start();
+    for (int r = 0; r < numRounds; ++r) {
+        for (typename MAP::const_iterator it = map.begin();
+                                          it != map.end();
+                                          ++it) {
+            checksum += it->second;
+        }
+    }
+    timer.stop();
+    const double iterateTime = timer.accumulatedWallTime();
+
+    const double numLookups = static_cast<double>(keys.size()) * numRounds;
+    const double numKeys    = static_cast<double>(keys.size());
+
+    bsl::printf("%-18s build %6.1f  hit %6.1f  miss %6.1f  iterate %5.2f"
+                " ns/op;  %8lld allocations  (checksum %d)\n",
+                name,
+                buildTime   * 1e9 / numKeys,
+                hitTime     * 1e9 / numLookups,
+                missTime    * 1e9 / numLookups,
+                iterateTime * 1e9 / numLookups,
+                static_cast<long long>(numAllocations),
+                checksum);
+}
+
+}  // close namespace benchmark
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Building a Read-Mostly Configuration Table
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we load a table of configuration parameters once at startup, and
+// consult it many times afterwards.
+//
+// First, we gather the parameters, in no particular order, in a vector:
+//..
+    typedef bdlc::FlatMap<bsl::string, int> Config;
+
+    bslma::TestAllocator oa("object");
+
+    bsl::vector<Config::value_type> entries(&oa);
+    entries.push_back(Config::value_type("timeout",     30, &oa));
+    entries.push_back(Config::value_type("maxRetries",   5, &oa));
+    entries.push_back(Config::value_type("poolSize",    16, &oa));
+    entries.push_back(Config::value_type("timeout",     60, &oa));
+//..
+// Then, we create the map by adopting the vector, which sorts the elements
+// once and keeps one element for the duplicated key:
+//..
+    Config config(bslmf::MovableRefUtil::move(entries), &oa);
+
+    ASSERT(3 == config.size());
+//..
+// Next, we look up parameters:
+//..
+    ASSERT(5  == config.at("maxRetries"));
+    ASSERT(16 == config["poolSize"]);
+    ASSERT(config.contains("timeout"));
+    ASSERT(config.end() == config.find("logLevel"));
+//..
+// Finally, we observe that iteration visits the elements in key order:
+//..
+    Config::const_iterator it = config.begin();
+    ASSERT("maxRetries" == it->first);
+    ++it;
+    ASSERT("poolSize"   == it->first);
+    ++it;
+    ASSERT("timeout"    == it->first);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 'maxSupportedBdexVersion' returns 1.
+        //:
+        //: 2 A map streamed out and back in has the same value.
+        //:
+        //: 3 An unsupported version invalidates the stream.
+        //:
+        //: 4 Data holding duplicate keys invalidates the stream and leaves the
+        //:   map unchanged.
+        //
+        // Plan:
+        //: 1 Stream maps of strings out to, and back in from,
+        //:   'bslx::TestOutStream' and 'bslx::TestInStream'.  (C-1..3)
+        //:
+        //: 2 Stream out a multimap-style tree holding duplicate keys using the
+        //:   same format, and stream it in to a map.  (C-4)
+        //
+        // Testing:
+        //   int maxSupportedBdexVersion(int versionSelector);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version);
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BDEX STREAMING" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ASSERT(1 == Obj::maxSupportedBdexVersion(SERIALIZATION_VERSION));
+        ASSERT(1 == StrObj::maxSupportedBdexVersion(0));
+
+        if (verbose) cout << "\tRound trip." << endl;
+        for (int n = 0; n < 40; n += 3) {
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            bsl::string key(&oa);
+            for (int i = 0; i < n; ++i) {
+                key.assign(1 + i % 4, static_cast<char>('a' + i % 26));
+                mX[key] = SUFFICIENTLY_LONG_STRING;
+            }
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out, 1);
+            ASSERTV(n, out);
+
+            StrObj mY(&oa);  const StrObj& Y = mY;
+            mY["zzzzz"] = "zzzzz";
+
+            bslx::TestInStream in(out.data(), out.length());
+            mY.bdexStreamIn(in, 1);
+            ASSERTV(n, in);
+            ASSERTV(n, in.isEmpty());
+            ASSERTV(n, X == Y);
+            if (!Y.empty()) {
+                ASSERTV(n,
+                        &oa == Y.begin()->second.get_allocator().mechanism());
+            }
+        }
+
+        if (verbose) cout << "\tUnsupported versions." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX[1] = 10;
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out, 2);
+            ASSERT(!out);
+
+            bslx::TestOutStream out2(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out2, 1);
+            ASSERT(out2);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY[2] = 20;
+            const Obj Z(Y, &oa);
+
+            bslx::TestInStream in(out2.data(), out2.length());
+            mY.bdexStreamIn(in, 0);
+            ASSERT(!in);
+            ASSERT(Z == Y);
+        }
+
+        if (verbose) cout << "\tDuplicate keys." << endl;
+        {
+            typedef bdlc::FlatTree<int,
+                                   IntPair,
+                                   bdlc::FlatTree_PairEntryUtil<int, int>,
+                                   bsl::less<int> > MultiTree;
+
+            MultiTree mT(bsl::less<int>(), &oa);
+            mT.insertMulti(IntPair(1, 10));
+            mT.insertMulti(IntPair(1, 11));
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            mT.bdexStreamOut(out, 1);
+            ASSERT(out);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY[2] = 20;
+            const Obj Z(Y, &oa);
+
+            bslx::TestInStream in(out.data(), out.length());
+            mY.bdexStreamIn(in, 1);
+            ASSERT(!in);
+            ASSERT(Z == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value and use the supplied allocator.
+        //:
+        //: 2 Moves with the same allocator do not allocate and leave the
+        //:   source empty; moves with a different allocator copy.
+        //:
+        //: 3 Equality compares both keys and mapped values.
+        //:
+        //: 4 Member 'swap' does not allocate; free 'swap' works with
+        //:   different allocators.
+        //
+        // Plan:
+        //: 1 Perform each operation on maps of strings, monitoring the
+        //:   allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatMap(const FlatMap& original, *bA = 0);
+        //   FlatMap(MovableRef<FlatMap> original);
+        //   FlatMap(MovableRef<FlatMap> original, *bA);
+        //   FlatMap& operator=(const FlatMap& rhs);
+        //   FlatMap& operator=(MovableRef<FlatMap> rhs);
+        //   void swap(FlatMap& other);
+        //   bool operator==(const FlatMap& lhs, const FlatMap& rhs);
+        //   bool operator!=(const FlatMap& lhs, const FlatMap& rhs);
+        //   void swap(FlatMap& a, FlatMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                 << "==========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        StrObj mX(&oa);  const StrObj& X = mX;
+        StrObj mW(&za);  const StrObj& W = mW;
+
+        bsl::string key(SUFFICIENTLY_LONG_STRING, &oa);
+        for (int i = 0; i < 50; ++i) {
+            key[0] = static_cast<char>('A' + i);
+            mX[key] = key;
+        }
+        for (int i = 49; i >= 0; --i) {
+            key[0] = static_cast<char>('A' + i);
+            mW[key] = key;
+        }
+
+        ASSERT(X == W);
+        ASSERT(!(X != W));
+
+        key[0] = 'A';
+        mW[key] = "different";
+        ASSERT(X != W);
+        mW[key] = key;
+        ASSERT(X == W);
+
+        {
+            StrObj mY(X, &za);  const StrObj& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(&za == Y.allocator());
+            ASSERT(&za == Y.begin()->first.get_allocator().mechanism());
+            ASSERT(&za == Y.begin()->second.get_allocator().mechanism());
+        }
+        {
+            StrObj mS(X, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            StrObj mY(MoveUtil::move(mS));  const StrObj& Y = mY;
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == Y);
+            ASSERT(mS.empty());
+
+            StrObj mZ(MoveUtil::move(mY), &za);  const StrObj& Z = mZ;
+
+            ASSERT(X == Z);
+            ASSERT(&za == Z.allocator());
+        }
+        {
+            StrObj mY(&za);
+
+            mY = X;
+            ASSERT(X == mY);
+            ASSERT(&za == mY.allocator());
+
+            StrObj mS(X, &za);
+            mY.clear();
+            mY = MoveUtil::move(mS);
+            ASSERT(X == mY);
+            ASSERT(mS.empty());
+        }
+        {
+            StrObj mA(X, &oa);
+            StrObj mB(&oa);
+            mB[key] = key;
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mA.swap(mB);
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == mB);
+            ASSERT(1 == mA.size());
+
+            StrObj mC(&za);
+            swap(mB, mC);
+            ASSERT(X == mC);
+            ASSERT(mB.empty());
+            ASSERT(&za == mC.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a map using the expected allocator and
+        //:   comparator, and the range and adopting constructors keep one
+        //:   element for each distinct key.
+        //:
+        //: 2 'insert' adds only elements whose keys are not already present,
+        //:   and reports whether it did so.
+        //:
+        //: 3 'operator[]' inserts a default-constructed value, using the
+        //:   allocator of the map, only if the key is absent; 'at' throws
+        //:   'bsl::out_of_range' if the key is absent.
+        //:
+        //: 4 The lookup methods agree with an oracle after any sequence of
+        //:   insertions and removals, and iteration visits the elements in
+        //:   key order.
+        //:
+        //: 5 Each 'erase' overload removes the specified elements.
+        //:
+        //: 6 'reserve' and 'shrink_to_fit' change the capacity as documented.
+        //:
+        //: 7 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Exercise each method, comparing the result with a 'bsl::map'
+        //:   oracle.  (C-1..7)
+        //
+        // Testing:
+        //   FlatMap();
+        //   FlatMap(bslma::Allocator *basicAllocator);
+        //   FlatMap(const COMPARATOR& comparator, bslma::Allocator *bA = 0);
+        //   FlatMap(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+        //   FlatMap(first, last, const COMPARATOR& comparator, *bA = 0);
+        //   FlatMap(MovableRef<container_type> container, *bA = 0);
+        //   FlatMap(MovableRef<container_type> c, comparator, *bA = 0);
+        //   ~FlatMap();
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   pair<iterator, bool> insert(MovableRef<value_type> value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   iterator lower_bound(const KEY& key);
+        //   void reserve(bsl::size_t numElements);
+        //   void shrink_to_fit();
+        //   iterator upper_bound(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   const VALUE& at(const KEY& key) const;
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   COMPARATOR key_comp() const;
+        //   const_iterator lower_bound(const KEY& key) const;
+        //   bsl::size_t size() const;
+        //   const_iterator upper_bound(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONSTRUCTORS, MANIPULATORS, AND ACCESSORS" << endl
+                  << "=========================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tConstructors." << endl;
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERT(&defaultAllocator == A.allocator());
+            ASSERT(A.empty());
+            ASSERT(0 == A.capacity());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERT(&oa == B.allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bdlc::FlatMap<int, int, bsl::greater<int> > mC(
+                                                         bsl::greater<int>(),
+                                                         &oa);
+            ASSERT(mC.key_comp()(2, 1));
+            mC[1] = 1;
+            mC[3] = 3;
+            mC[2] = 2;
+            ASSERT(3 == mC.begin()->first);
+
+            const IntPair VALUES[] = { IntPair(3, 30), IntPair(1, 10),
+                                       IntPair(4, 40), IntPair(1, 11),
+                                       IntPair(5, 50), IntPair(9, 90),
+                                       IntPair(2, 20), IntPair(6, 60) };
+            const int NUM_VALUES = static_cast<int>(sizeof VALUES /
+                                                    sizeof *VALUES);
+
+            Obj mD(VALUES, VALUES + NUM_VALUES, &oa);  const Obj& D = mD;
+            ASSERT(7 == D.size());
+            ASSERT(1 == D.begin()->first);
+
+            Obj mE(VALUES, VALUES + NUM_VALUES, bsl::less<int>(), &oa);
+            const Obj& E = mE;
+            ASSERT(D == E);
+
+            bsl::vector<IntPair> v(VALUES, VALUES + NUM_VALUES, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            Obj mF(MoveUtil::move(v), &oa);  const Obj& F = mF;
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(v.empty());
+            ASSERT(D.size() == F.size());
+            ASSERT(D.begin()->first == F.begin()->first);
+
+            bsl::vector<IntPair> w(VALUES, VALUES + NUM_VALUES, &sa);
+
+            Obj mG(MoveUtil::move(w), bsl::less<int>(), &oa);
+            const Obj& G = mG;
+            ASSERT(NUM_VALUES == static_cast<int>(w.size()));
+            ASSERT(7 == G.size());
+            ASSERT(&oa == G.allocator());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\t'operator[]' and 'at'." << endl;
+        {
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            const bsl::string LONG(SUFFICIENTLY_LONG_STRING, &oa);
+
+            ASSERT(mX[LONG].empty());
+            ASSERT(1 == X.size());
+            ASSERT(&oa == X.begin()->second.get_allocator().mechanism());
+
+            mX[LONG] = LONG;
+            ASSERT(LONG == mX[LONG]);
+            ASSERT(LONG == mX.at(LONG));
+            ASSERT(LONG == X.at(LONG));
+            ASSERT(1 == X.size());
+
+            mX.at(LONG) = "x";
+            ASSERT("x" == X.at(LONG));
+
+            bool caught = false;
+            try {
+                mX.at("missing");
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at("missing");
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(1 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tInsertion, lookup, and removal." << endl;
+        {
+            Obj                mX(&oa);  const Obj& X = mX;
+            bsl::map<int, int> oracle(&sa);
+
+            unsigned int state = 7;
+            for (int i = 0; i < 3000; ++i) {
+                state = state * 1103515245 + 12345;
+                const int key = static_cast<int>((state >> 16) % 500);
+
+                if ((state >> 8) & 3) {
+                    IntPair    value(key, i);
+                    const bool EXP = oracle.insert(value).second;
+                    const bool RES = i & 1
+                                   ? mX.insert(value).second
+                                   : mX.insert(MoveUtil::move(value)).second;
+                    ASSERTV(i, key, EXP == RES);
+                }
+                else {
+                    ASSERTV(i, key, oracle.erase(key) == mX.erase(key));
+                }
+                ASSERTV(i, oracle.size() == X.size());
+            }
+
+            for (int key = -1; key <= 500; ++key) {
+                const bool EXP = oracle.count(key) != 0;
+                ASSERTV(key, EXP == X.contains(key));
+                ASSERTV(key, EXP == (1 == X.count(key)));
+                ASSERTV(key, EXP == (X.end() != X.find(key)));
+                ASSERTV(key, EXP == (mX.end() != mX.find(key)));
+                if (EXP) {
+                    ASSERTV(key, oracle[key] == X.find(key)->second);
+                }
+
+                const bsl::map<int, int>::iterator LB =
+                                                     oracle.lower_bound(key);
+                const bsl::map<int, int>::iterator UB =
+                                                     oracle.upper_bound(key);
+                const int NLB = static_cast<int>(
+                                          bsl::distance(oracle.begin(), LB));
+                const int NUB = static_cast<int>(
+                                          bsl::distance(oracle.begin(), UB));
+
+                ASSERTV(key, NLB == X.lower_bound(key) - X.begin());
+                ASSERTV(key, NUB == X.upper_bound(key) - X.begin());
+                ASSERTV(key, NLB == mX.lower_bound(key) - mX.begin());
+                ASSERTV(key, NUB == mX.upper_bound(key) - mX.begin());
+                ASSERTV(key, NLB == X.equal_range(key).first - X.begin());
+                ASSERTV(key, NUB == X.equal_range(key).second - X.begin());
+                ASSERTV(key, NLB == mX.equal_range(key).first - mX.begin());
+                ASSERTV(key, NUB == mX.equal_range(key).second - mX.begin());
+            }
+
+            bsl::map<int, int>::const_iterator oit = oracle.begin();
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(it->first, oit->first  == it->first);
+                ASSERTV(it->first, oit->second == it->second);
+                ++oit;
+            }
+            ASSERT(oracle.end() == oit);
+
+            const int KEY = X.begin()->first;
+            ASSERT(X.begin() == mX.erase(X.begin()));
+            ASSERT(!X.contains(KEY));
+
+            const int KEY2 = mX.begin()->first;
+            ASSERT(mX.begin() == mX.erase(mX.begin()));
+            ASSERT(!X.contains(KEY2));
+
+            const bsl::size_t SIZE = X.size();
+            ASSERT(X.begin() == mX.erase(X.begin(), X.begin() + 10));
+            ASSERT(SIZE - 10 == X.size());
+
+            bsl::vector<IntPair> more(&sa);
+            for (int key = 1000; key > 900; --key) {
+                more.push_back(IntPair(key, key));
+                more.push_back(IntPair(key, -key));
+            }
+            mX.insert(more.begin(), more.end());
+            ASSERT(SIZE + 90 == X.size());
+            ASSERT(X.contains(1000));
+            ASSERT(X.contains(901));
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.begin() == X.end());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\t'reserve' and 'shrink_to_fit'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+
+            mX.erase(X.begin() + 10, X.end());
+            mX.shrink_to_fit();
+            ASSERT(10 == X.capacity());
+            ASSERT(10 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, look up, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 99; i >= 0; --i) {
+            ASSERTV(i, mX.insert(IntPair(i, i * i)).second);
+            ASSERTV(i, !mX.insert(IntPair(i, 0)).second);
+        }
+        ASSERT(100 == X.size());
+        ASSERT(X.contains(42));
+        ASSERT(42 * 42 == X.find(42)->second);
+        ASSERT(0 == X.begin()->first);
+
+        mX.erase(42);
+        ASSERT(!X.contains(42));
+
+        Obj mY(X, &oa);
+        ASSERT(X == mY);
+
+        mY[42] = 0;
+        ASSERT(X != mY);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'int' KEYS
+        //   Compare 'bdlc::FlatMap<int, int>' with 'bsl::map<int, int>'.
+        //   Command line parameters:
+        //   2nd parameter: number of keys (default: 10000)
+        //   3rd parameter: number of lookup rounds (default: 100)
+        //
+        // Concerns:
+        //: 1 The flat map performs fewer allocations, and looks up and
+        //:   iterates over elements faster, than the node-based map.
+        //
+        // Plan:
+        //: 1 Time building each map from pseudo-random keys, successful and
+        //:   unsuccessful lookup, and iteration, and report the results.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'int' KEYS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'int' KEYS" << endl
+             << "=======================" << endl;
+
+        const int numKeys   = argc > 2 ? atoi(argv[2]) : 10000;
+        const int numRounds = argc > 3 ? atoi(argv[3]) : 100;
+
+        bslma::TestAllocator sa("scratch");
+
+        bsl::vector<int> keys(&sa);
+        bsl::vector<int> missingKeys(&sa);
+
+        unsigned int state = 1;
+        for (int i = 0; i < numKeys; ++i) {
+            state = state * 1103515245 + 12345;
+            keys.push_back(static_cast<int>(state & 0x7FFFFFFE));
+            missingKeys.push_back(static_cast<int>(state & 0x7FFFFFFE) | 1);
+        }
+
+        benchmark::run<bsl::map<int, int> >("bsl::map",
+                                            keys,
+                                            missingKeys,
+                                            numRounds);
+        benchmark::run<bdlc::FlatMap<int, int> >("bdlc::FlatMap",
+                                                 keys,
+                                                 missingKeys,
+                                                 numRounds);
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'bsl::string' KEYS
+        //   Compare 'bdlc::FlatMap<bsl::string, int>' with
+        //   'bsl::map<bsl::string, int>'.
+        //   Command line parameters:
+        //   2nd parameter: number of keys (default: 10000)
+        //   3rd parameter: number of lookup rounds (default: 100)
+        //
+        // Concerns:
+        //: 1 The flat map performs fewer allocations, and looks up and
+        //:   iterates over elements faster, than the node-based map.
+        //
+        // Plan:
+        //: 1 Time building each map from pseudo-random keys, successful and
+        //:   unsuccessful lookup, and iteration, and report the results.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'bsl::string' KEYS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: 'bsl::string' KEYS" << endl
+             << "===============================" << endl;
+
+        const int numKeys   = argc > 2 ? atoi(argv[2]) : 10000;
+        const int numRounds = argc > 3 ? atoi(argv[3]) : 100;
+
+        bslma::TestAllocator sa("scratch");
+
+        bsl::vector<bsl::string> keys(&sa);
+        bsl::vector<bsl::string> missingKeys(&sa);
+
+        unsigned int state = 1;
+        char         buffer[32];
+        for (int i = 0; i < numKeys; ++i) {
+            state = state * 1103515245 + 12345;
+            const unsigned int value = state & 0x7FFFFFFE;
+
+            bsl::sprintf(buffer, "instrument.%010u", value);
+            keys.push_back(buffer);
+            bsl::sprintf(buffer, "instrument.%010u", value | 1);
+            missingKeys.push_back(buffer);
+        }
+
+        typedef bsl::map<bsl::string, int>      Map;
+        typedef bdlc::FlatMap<bsl::string, int> FlatMap;
+
+        benchmark::run<Map>("bsl::map", keys, missingKeys, numRounds);
+        benchmark::run<FlatMap>("bdlc::FlatMap", keys, missingKeys, numRounds);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
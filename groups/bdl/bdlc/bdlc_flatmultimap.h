@@ -0,0 +1,918 @@
+// bdlc_flatmultimap.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATMULTIMAP
+#define INCLUDED_BDLC_FLATMULTIMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered multimap container stored in a sorted vector.
+//
+//@CLASSES:
+//  bdlc::FlatMultimap: ordered multimap in contiguous storage
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flattree, bslstl_multimap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatMultimap', implementing a value-semantic container that maps
+// keys, which need not be unique, to values in key order, and that is largely
+// interface-compatible with 'bsl::multimap'.  Unlike 'bsl::multimap', which
+// allocates a red-black tree node for each element, 'bdlc::FlatMultimap'
+// stores its elements in a single 'bsl::vector', sorted by key.  See
+// 'bdlc_flattree' for details of the implementation.
+//
+// As for 'bdlc::FlatMap', lookup is a branch-free binary search and iteration
+// is a linear scan over contiguous memory, while inserting or erasing a
+// single element is linear in the size of the multimap.  Multimaps should
+// therefore be built in bulk -- by the range constructor, by range 'insert',
+// or by adopting a 'bsl::vector' of elements -- and then read.  Any insertion
+// or removal invalidates iterators, pointers, and references to elements.
+//
+// An element inserted singly follows any existing elements having an
+// equivalent key.  Elements inserted in bulk also follow existing elements
+// having an equivalent key, but the relative order of equivalent elements
+// within the inserted sequence is unspecified.
+//
+// 'bdlc::FlatMultimap' uses the 'bslma::Allocator' protocol for all memory
+// allocation, and propagates its allocator to its elements if they use
+// 'bslma'-style allocation.  It supports BDEX streaming (see the 'bslx'
+// package documentation) provided that 'KEY' and 'VALUE' do.
+//
+// The value type of the multimap is 'bsl::pair<KEY, VALUE>' (rather than
+// 'bsl::pair<const KEY, VALUE>' as for 'bsl::multimap'); the behavior is
+// undefined if the key of an element is modified through an iterator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Account
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we receive a day's trades as (account, trade identifier) pairs, and
+// want to list the trades of any account.
+//
+// First, we index the trades, in bulk, by account:
+//..
+//  typedef bdlc::FlatMultimap<int, int> TradeIndex;
+//
+//  const TradeIndex::value_type TRADES[] = {
+//      TradeIndex::value_type(7, 1001),
+//      TradeIndex::value_type(3, 1002),
+//      TradeIndex::value_type(7, 1003),
+//      TradeIndex::value_type(5, 1004),
+//  };
+//
+//  bslma::TestAllocator oa("object");
+//
+//  TradeIndex index(TRADES, TRADES + 4, &oa);
+//
+//  assert(4 == index.size());
+//..
+// Then, we add a late trade, which follows the earlier trades of its account:
+//..
+//  index.insert(TradeIndex::value_type(7, 1005));
+//..
+// Finally, we list the trades of account 7:
+//..
+//  assert(3 == index.count(7));
+//
+//  bsl::pair<TradeIndex::iterator, TradeIndex::iterator> range =
+//                                                        index.equal_range(7);
+//
+//  int numTrades = 0;
+//  for (TradeIndex::iterator it = range.first; it != range.second; ++it) {
+//      assert(7 == it->first);
+//      ++numTrades;
+//  }
+//  assert(3    == numTrades);
+//  assert(1005 == (range.second - 1)->second);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flattree.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                             // ==================
+                             // class FlatMultimap
+                             // ==================
+
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class FlatMultimap {
+    // This class template implements a value-semantic container that maps
+    // keys of the (template parameter) type 'KEY', which need not be unique,
+    // to values of the (template parameter) type 'VALUE', ordered by the
+    // (template parameter) type 'COMPARATOR', storing its elements in a sorted
+    // vector.  See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef FlatTree<KEY,
+                     bsl::pair<KEY, VALUE>,
+                     FlatTree_PairEntryUtil<KEY, VALUE>,
+                     COMPARATOR> ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying sorted vector
+
+    // FRIENDS
+    template <class K, class V, class C>
+    friend bool operator==(const FlatMultimap<K, V, C>&,
+                           const FlatMultimap<K, V, C>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef VALUE                                mapped_type;
+    typedef bsl::pair<KEY, VALUE>                value_type;
+    typedef bsl::size_t                          size_type;
+    typedef bsl::ptrdiff_t                       difference_type;
+    typedef COMPARATOR                           key_compare;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef value_type                          *pointer;
+    typedef const value_type                    *const_pointer;
+    typedef typename ImplType::iterator          iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+    typedef bsl::vector<value_type>              container_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatMultimap, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to the 'bdexStreamOut'
+        // method.  Note that it is highly recommended that 'versionSelector'
+        // be formatted as "YYYYMMDD", a date representation.  Also note that
+        // 'versionSelector' should be a *compile*-time-chosen value that
+        // selects a format version supported by both externalizer and
+        // unexternalizer.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+
+    // CREATORS
+    FlatMultimap();
+    explicit FlatMultimap(bslma::Allocator *basicAllocator);
+    explicit FlatMultimap(const COMPARATOR&  comparator,
+                          bslma::Allocator  *basicAllocator = 0);
+        // Create an empty multimap.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatMultimap(INPUT_ITERATOR    first,
+                 INPUT_ITERATOR    last,
+                 bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatMultimap(INPUT_ITERATOR     first,
+                 INPUT_ITERATOR     last,
+                 const COMPARATOR&  comparator,
+                 bslma::Allocator  *basicAllocator = 0);
+        // Create a multimap holding the 'value_type' objects in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element.  The relative order of
+        // elements of the sequence having equivalent keys is unspecified.
+        // Optionally specify a 'comparator' used to order keys.  If
+        // 'comparator' is not supplied, a default-constructed 'COMPARATOR' is
+        // used.  Optionally specify a 'basicAllocator' used to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  The behavior is undefined unless '[first .. last)' is a
+        // valid range.
+
+    explicit FlatMultimap(
+                        bslmf::MovableRef<container_type>  container,
+                        bslma::Allocator                  *basicAllocator = 0);
+    FlatMultimap(bslmf::MovableRef<container_type>  container,
+                 const COMPARATOR&                  comparator,
+                 bslma::Allocator                  *basicAllocator = 0);
+        // Create a multimap holding the elements of the specified
+        // 'container', which need not be sorted.  The relative order of
+        // elements of 'container' having equivalent keys is unspecified.
+        // Optionally specify a 'comparator' used to order keys.  If
+        // 'comparator' is not supplied, a default-constructed 'COMPARATOR' is
+        // used.  Optionally specify a 'basicAllocator' used to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  If 'container' uses the same allocator, its storage is
+        // adopted and 'container' is left empty; otherwise, 'container' is
+        // copied and left unchanged.
+
+    FlatMultimap(const FlatMultimap&  original,
+                 bslma::Allocator    *basicAllocator = 0);
+        // Create a multimap having the same value and comparator as the
+        // specified 'original' multimap.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    FlatMultimap(bslmf::MovableRef<FlatMultimap> original);
+        // Create a multimap having the same value, comparator, and allocator
+        // as the specified 'original' multimap, leaving 'original' empty.  No
+        // memory is allocated.
+
+    FlatMultimap(bslmf::MovableRef<FlatMultimap>  original,
+                 bslma::Allocator                *basicAllocator);
+        // Create a multimap having the same value and comparator as the
+        // specified 'original' multimap, using the specified 'basicAllocator'
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  If 'original' uses the same allocator,
+        // its storage is transferred and 'original' is left empty; otherwise,
+        // 'original' is copied and left unchanged.
+
+    ~FlatMultimap();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatMultimap& operator=(const FlatMultimap& rhs);
+        // Assign to this multimap the value and comparator of the specified
+        // 'rhs' multimap, and return a reference providing modifiable access
+        // to this multimap.
+
+    FlatMultimap& operator=(bslmf::MovableRef<FlatMultimap> rhs);
+        // Assign to this multimap the value and comparator of the specified
+        // 'rhs' multimap, and return a reference providing modifiable access
+        // to this multimap.  If 'rhs' uses the same allocator as this
+        // multimap, its storage is transferred and 'rhs' is left empty;
+        // otherwise, 'rhs' is copied and left unchanged.
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version);
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, if 'stream'
+        // becomes invalid, or if the keys read are not in non-decreasing
+        // order, this object is unaltered and 'stream' is invalidated.  Note
+        // that no version is read from 'stream'.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    void clear();
+        // Remove all elements from this multimap.  Note that the capacity of
+        // this multimap is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this multimap all elements having the specified 'key',
+        // and return the number of elements removed.
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Remove from this multimap the element at the specified 'position',
+        // and return an iterator referring to the element following it (or
+        // the past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an element of this multimap.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this multimap the elements starting at the specified
+        // 'first' position up to, but not including, the specified 'last'
+        // position, and return an iterator referring to the element that
+        // followed them (or the past-the-end iterator).  The behavior is
+        // undefined unless '[first .. last)' is a valid range of elements of
+        // this multimap.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return the pair of iterators 'lower_bound(key)' and
+        // 'upper_bound(key)', delimiting the elements having the specified
+        // 'key'.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the first element having the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // element.
+
+    iterator insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this multimap, after
+        // any elements having an equivalent key, and return an iterator
+        // referring to the new element.
+
+    iterator insert(bslmf::MovableRef<value_type> value);
+        // Insert the specified 'value' into this multimap, using its move
+        // constructor, after any elements having an equivalent key, and
+        // return an iterator referring to the new element.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this multimap each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element.  Each inserted element follows
+        // the existing elements having an equivalent key; the relative order
+        // of elements of the sequence having equivalent keys is unspecified.
+        // The behavior is undefined unless '[first .. last)' is a valid
+        // range.
+
+    iterator lower_bound(const KEY& key);
+        // Return an iterator referring to the first element whose key is not
+        // ordered before the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this multimap, if needed, so that the
+        // specified 'numElements' may be held without reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this multimap to (approximately) its size.
+
+    void swap(FlatMultimap& other);
+        // Exchange the value and comparator of this multimap with those of the
+        // specified 'other' multimap.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // multimap and 'other' use the same allocator.
+
+    iterator upper_bound(const KEY& key);
+        // Return an iterator referring to the first element whose key is
+        // ordered after the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    iterator begin();
+        // Return an iterator referring to the first element of this multimap,
+        // or the past-the-end iterator if this multimap is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this multimap.
+
+    // ACCESSORS
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write the value of this object, using the specified 'version'
+        // format, to the specified output 'stream', and return a reference to
+        // 'stream'.  If 'stream' is initially invalid, this operation has no
+        // effect.  If 'version' is not supported, 'stream' is invalidated, but
+        // otherwise unmodified.  Note that 'version' is not written to
+        // 'stream'.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this multimap can hold without
+        // reallocating.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this multimap holds an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this multimap having the specified
+        // 'key'.
+
+    bool empty() const;
+        // Return 'true' if this multimap holds no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                        const;
+        // Return the pair of iterators 'lower_bound(key)' and
+        // 'upper_bound(key)', delimiting the elements having the specified
+        // 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the first element having the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // element.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key comparator of this multimap.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator referring to the first element whose key is not
+        // ordered before the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this multimap.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator referring to the first element whose key is
+        // ordered after the specified 'key', or the past-the-end iterator if
+        // there is no such element.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this multimap,
+        // or the past-the-end iterator if this multimap is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this multimap.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this multimap to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator==(const FlatMultimap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMultimap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' multimaps have the same
+    // value, and 'false' otherwise.  Two multimaps have the same value if
+    // they have the same number of elements and corresponding elements (in
+    // iteration order) have equal keys and equal values.
+
+template <class KEY, class VALUE, class COMPARATOR>
+bool operator!=(const FlatMultimap<KEY, VALUE, COMPARATOR>& lhs,
+                const FlatMultimap<KEY, VALUE, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' multimaps do not have
+    // the same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+void swap(FlatMultimap<KEY, VALUE, COMPARATOR>& a,
+          FlatMultimap<KEY, VALUE, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' multimaps.  If 'a' and
+    // 'b' use different allocators, the exchange is performed by copying.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class FlatMultimap
+                             // ------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+int FlatMultimap<KEY, VALUE, COMPARATOR>::maxSupportedBdexVersion(
+                                                     int /* versionSelector */)
+{
+    return 1;  // Required by BDE policy; versions start at 1.
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                                             const COMPARATOR&  comparator,
+                                             bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    d_impl.insertMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                                             INPUT_ITERATOR     first,
+                                             INPUT_ITERATOR     last,
+                                             const COMPARATOR&  comparator,
+                                             bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    d_impl.insertMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                           bslmf::MovableRef<container_type>  container,
+                           bslma::Allocator                  *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(container),
+         false,
+         COMPARATOR(),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                           bslmf::MovableRef<container_type>  container,
+                           const COMPARATOR&                  comparator,
+                           bslma::Allocator                  *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(container),
+         false,
+         comparator,
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                                           const FlatMultimap&  original,
+                                           bslma::Allocator    *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                                      bslmf::MovableRef<FlatMultimap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::FlatMultimap(
+                             bslmf::MovableRef<FlatMultimap>  original,
+                             bslma::Allocator                *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>::~FlatMultimap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>&
+FlatMultimap<KEY, VALUE, COMPARATOR>::operator=(const FlatMultimap& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+FlatMultimap<KEY, VALUE, COMPARATOR>&
+FlatMultimap<KEY, VALUE, COMPARATOR>::operator=(
+                                           bslmf::MovableRef<FlatMultimap> rhs)
+{
+    d_impl = bslmf::MovableRefUtil::move(
+                                   bslmf::MovableRefUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class STREAM>
+inline
+STREAM& FlatMultimap<KEY, VALUE, COMPARATOR>::bdexStreamIn(STREAM& stream,
+                                                           int     version)
+{
+    return d_impl.bdexStreamIn(stream, version, false);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultimap<KEY, VALUE, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultimap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::erase(iterator position)
+{
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator,
+          typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator>
+FlatMultimap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key)
+{
+    return d_impl.equalRange(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::insert(const value_type& value)
+{
+    return d_impl.insertMulti(value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::insert(
+                                           bslmf::MovableRef<value_type> value)
+{
+    return d_impl.insertMulti(bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatMultimap<KEY, VALUE, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    d_impl.insertMulti(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key)
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void
+FlatMultimap<KEY, VALUE, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultimap<KEY, VALUE, COMPARATOR>::shrink_to_fit()
+{
+    d_impl.shrinkToFit();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void FlatMultimap<KEY, VALUE, COMPARATOR>::swap(FlatMultimap& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key)
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::end()
+{
+    return d_impl.end();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+template <class STREAM>
+inline
+STREAM&
+FlatMultimap<KEY, VALUE, COMPARATOR>::bdexStreamOut(STREAM& stream,
+                                                    int     version) const
+{
+    return d_impl.bdexStreamOut(stream, version);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultimap<KEY, VALUE, COMPARATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool
+FlatMultimap<KEY, VALUE, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t
+FlatMultimap<KEY, VALUE, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool FlatMultimap<KEY, VALUE, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::pair<typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator,
+          typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator>
+FlatMultimap<KEY, VALUE, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equalRange(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+COMPARATOR FlatMultimap<KEY, VALUE, COMPARATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t FlatMultimap<KEY, VALUE, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+typename FlatMultimap<KEY, VALUE, COMPARATOR>::const_iterator
+FlatMultimap<KEY, VALUE, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *FlatMultimap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatMultimap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMultimap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatMultimap<KEY, VALUE, COMPARATOR>& lhs,
+                      const FlatMultimap<KEY, VALUE, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void bdlc::swap(FlatMultimap<KEY, VALUE, COMPARATOR>& a,
+                FlatMultimap<KEY, VALUE, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatMultimap<KEY, VALUE, COMPARATOR> futureA(b, a.allocator());
+    FlatMultimap<KEY, VALUE, COMPARATOR> futureB(a, b.allocator());
+
+    a.swap(futureA);
+    b.swap(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
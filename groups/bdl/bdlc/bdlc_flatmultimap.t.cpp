@@ -0,0 +1,826 @@
+// bdlc_flatmultimap.t.cpp                                            -*-C++-*-
+#include <bdlc_flatmultimap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bslx_testinstream.h>
+#include <bslx_testoutstream.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a value-semantic container,
+// 'bdlc::FlatMultimap', as a thin wrapper around 'bdlc::FlatTree' (which is
+// thoroughly tested in its own component).  The concerns here are therefore
+// that each method forwards correctly to the underlying tree, that elements
+// having equivalent keys are retained, and that the allocator is used as
+// documented.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int maxSupportedBdexVersion(int versionSelector);
+//
+// CREATORS
+// [ 2] FlatMultimap();
+// [ 2] FlatMultimap(bslma::Allocator *basicAllocator);
+// [ 2] FlatMultimap(const COMPARATOR& comparator, *bA = 0);
+// [ 2] FlatMultimap(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+// [ 2] FlatMultimap(first, last, const COMPARATOR& comparator, *bA = 0);
+// [ 2] FlatMultimap(MovableRef<container_type> container, *bA = 0);
+// [ 2] FlatMultimap(MovableRef<container_type> c, comparator, *bA = 0);
+// [ 3] FlatMultimap(const FlatMultimap& original, *bA = 0);
+// [ 3] FlatMultimap(MovableRef<FlatMultimap> original);
+// [ 3] FlatMultimap(MovableRef<FlatMultimap> original, *bA);
+// [ 2] ~FlatMultimap();
+//
+// MANIPULATORS
+// [ 3] FlatMultimap& operator=(const FlatMultimap& rhs);
+// [ 3] FlatMultimap& operator=(MovableRef<FlatMultimap> rhs);
+// [ 4] STREAM& bdexStreamIn(STREAM& stream, int version);
+// [ 2] void clear();
+// [ 2] bsl::size_t erase(const KEY& key);
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 2] iterator find(const KEY& key);
+// [ 2] iterator insert(const value_type& value);
+// [ 2] iterator insert(MovableRef<value_type> value);
+// [ 2] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] iterator lower_bound(const KEY& key);
+// [ 2] void reserve(bsl::size_t numElements);
+// [ 2] void shrink_to_fit();
+// [ 3] void swap(FlatMultimap& other);
+// [ 2] iterator upper_bound(const KEY& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+//
+// ACCESSORS
+// [ 4] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+// [ 2] bsl::size_t capacity() const;
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equal_range(key) const;
+// [ 2] const_iterator find(const KEY& key) const;
+// [ 2] COMPARATOR key_comp() const;
+// [ 2] const_iterator lower_bound(const KEY& key) const;
+// [ 2] bsl::size_t size() const;
+// [ 2] const_iterator upper_bound(const KEY& key) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const FlatMultimap& lhs, const FlatMultimap& rhs);
+// [ 3] bool operator!=(const FlatMultimap& lhs, const FlatMultimap& rhs);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(FlatMultimap& a, FlatMultimap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatMultimap<int, int>                 Obj;
+typedef bdlc::FlatMultimap<bsl::string, bsl::string> StrObj;
+
+typedef Obj::value_type                              IntPair;
+typedef StrObj::value_type                           StrPair;
+
+typedef bslmf::MovableRefUtil                        MoveUtil;
+
+const int SERIALIZATION_VERSION = 20200101;
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+// ============================================================================
+//                            TEST HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+bool sameElements(const Obj& object, const bsl::multimap<int, int>& oracle)
+    // Return 'true' if the specified 'object' holds the same elements, in the
+    // same order, as the specified 'oracle', and 'false' otherwise.
+{
+    if (object.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+
+    bsl::multimap<int, int>::const_iterator oit = oracle.begin();
+    for (Obj::const_iterator it = object.begin(); it != object.end(); ++it) {
+        if (it->first != oit->first || it->second != oit->second) {
+            return false;                                             // RETURN
+        }
+        ++oit;
+    }
+    return true;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Indexing Trades by Account
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we receive a day's trades as (account, trade identifier) pairs, and
+// want to list the trades of any account.
+//
+// First, we index the trades, in bulk, by account:
+//..
+    typedef bdlc::FlatMultimap<int, int> TradeIndex;
+
+    const TradeIndex::value_type TRADES[] = {
+        TradeIndex::value_type(7, 1001),
+        TradeIndex::value_type(3, 1002),
+        TradeIndex::value_type(7, 1003),
+        TradeIndex::value_type(5, 1004),
+    };
+
+    bslma::TestAllocator oa("object");
+
+    TradeIndex index(TRADES, TRADES + 4, &oa);
+
+    ASSERT(4 == index.size());
+//..
+// Then, we add a late trade, which follows the earlier trades of its account:
+//..
+    index.insert(TradeIndex::value_type(7, 1005));
+//..
+// Finally, we list the trades of account 7:
+//..
+    ASSERT(3 == index.count(7));
+
+    bsl::pair<TradeIndex::iterator, TradeIndex::iterator> range =
+                                                          index.equal_range(7);
+
+    int numTrades = 0;
+    for (TradeIndex::iterator it = range.first; it != range.second; ++it) {
+        ASSERT(7 == it->first);
+        ++numTrades;
+    }
+    ASSERT(3    == numTrades);
+    ASSERT(1005 == (range.second - 1)->second);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 'maxSupportedBdexVersion' returns 1.
+        //:
+        //: 2 A multimap streamed out and back in has the same value, including
+        //:   the order of elements having equivalent keys.
+        //:
+        //: 3 An unsupported version invalidates the stream.
+        //:
+        //: 4 Data holding decreasing keys invalidates the stream and leaves
+        //:   the multimap unchanged.
+        //
+        // Plan:
+        //: 1 Stream multimaps of strings out to, and back in from,
+        //:   'bslx::TestOutStream' and 'bslx::TestInStream'.  (C-1..3)
+        //:
+        //: 2 Stream in hand-made data holding keys that are not in
+        //:   non-decreasing order.  (C-4)
+        //
+        // Testing:
+        //   int maxSupportedBdexVersion(int versionSelector);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version);
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BDEX STREAMING" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        ASSERT(1 == Obj::maxSupportedBdexVersion(SERIALIZATION_VERSION));
+        ASSERT(1 == StrObj::maxSupportedBdexVersion(0));
+
+        if (verbose) cout << "\tRound trip." << endl;
+        for (int n = 0; n < 40; n += 3) {
+            StrObj mX(&oa);  const StrObj& X = mX;
+
+            bsl::string key(&oa);
+            bsl::string value(SUFFICIENTLY_LONG_STRING, &oa);
+            for (int i = 0; i < n; ++i) {
+                key.assign(1, static_cast<char>('a' + i % 5));
+                value[0] = static_cast<char>('A' + i);
+                mX.insert(StrPair(key, value, &oa));
+            }
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out, 1);
+            ASSERTV(n, out);
+
+            StrObj mY(&oa);  const StrObj& Y = mY;
+            mY.insert(StrPair("zzzzz", "zzzzz", &oa));
+
+            bslx::TestInStream in(out.data(), out.length());
+            mY.bdexStreamIn(in, 1);
+            ASSERTV(n, in);
+            ASSERTV(n, in.isEmpty());
+            ASSERTV(n, X == Y);
+        }
+
+        if (verbose) cout << "\tUnsupported versions." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.insert(IntPair(1, 10));
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out, 2);
+            ASSERT(!out);
+
+            bslx::TestOutStream out2(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out2, 1);
+            ASSERT(out2);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.insert(IntPair(2, 20));
+            const Obj Z(Y, &oa);
+
+            bslx::TestInStream in(out2.data(), out2.length());
+            mY.bdexStreamIn(in, 0);
+            ASSERT(!in);
+            ASSERT(Z == Y);
+        }
+
+        if (verbose) cout << "\tDecreasing keys." << endl;
+        {
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            out.putLength(3);
+            out.putInt32(1);  out.putInt32(10);
+            out.putInt32(2);  out.putInt32(20);
+            out.putInt32(1);  out.putInt32(11);
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            mY.insert(IntPair(7, 70));
+            const Obj Z(Y, &oa);
+
+            bslx::TestInStream in(out.data(), out.length());
+            mY.bdexStreamIn(in, 1);
+            ASSERT(!in);
+            ASSERT(Z == Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value and use the supplied allocator.
+        //:
+        //: 2 Moves with the same allocator do not allocate and leave the
+        //:   source empty; moves with a different allocator copy.
+        //:
+        //: 3 Equality compares keys, mapped values, and the order of elements
+        //:   having equivalent keys.
+        //:
+        //: 4 Member 'swap' does not allocate; free 'swap' works with
+        //:   different allocators.
+        //
+        // Plan:
+        //: 1 Perform each operation on multimaps of strings, monitoring the
+        //:   allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatMultimap(const FlatMultimap& original, *bA = 0);
+        //   FlatMultimap(MovableRef<FlatMultimap> original);
+        //   FlatMultimap(MovableRef<FlatMultimap> original, *bA);
+        //   FlatMultimap& operator=(const FlatMultimap& rhs);
+        //   FlatMultimap& operator=(MovableRef<FlatMultimap> rhs);
+        //   void swap(FlatMultimap& other);
+        //   bool operator==(const FlatMultimap& lhs, const FlatMultimap& rhs);
+        //   bool operator!=(const FlatMultimap& lhs, const FlatMultimap& rhs);
+        //   void swap(FlatMultimap& a, FlatMultimap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                 << "==========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        StrObj mX(&oa);  const StrObj& X = mX;
+        StrObj mW(&za);  const StrObj& W = mW;
+
+        bsl::string key(SUFFICIENTLY_LONG_STRING, &oa);
+        for (int i = 0; i < 50; ++i) {
+            key[0] = static_cast<char>('A' + i % 10);
+            key[1] = static_cast<char>('A' + i);
+            mX.insert(StrPair(key.substr(0, 1), key, &oa));
+            mW.insert(StrPair(key.substr(0, 1), key, &za));
+        }
+
+        ASSERT(X == W);
+        ASSERT(!(X != W));
+
+        {
+            StrObj mV(&oa);  const StrObj& V = mV;
+            for (int i = 49; i >= 0; --i) {
+                key[0] = static_cast<char>('A' + i % 10);
+                key[1] = static_cast<char>('A' + i);
+                mV.insert(StrPair(key.substr(0, 1), key, &oa));
+            }
+            ASSERT(X.size() == V.size());
+            ASSERT(X != V);
+        }
+
+        {
+            StrObj mY(X, &za);  const StrObj& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(&za == Y.allocator());
+            ASSERT(&za == Y.begin()->second.get_allocator().mechanism());
+        }
+        {
+            StrObj mS(X, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            StrObj mY(MoveUtil::move(mS));  const StrObj& Y = mY;
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == Y);
+            ASSERT(mS.empty());
+
+            StrObj mZ(MoveUtil::move(mY), &za);  const StrObj& Z = mZ;
+
+            ASSERT(X == Z);
+            ASSERT(&za == Z.allocator());
+        }
+        {
+            StrObj mY(&za);
+
+            mY = X;
+            ASSERT(X == mY);
+            ASSERT(&za == mY.allocator());
+
+            StrObj mS(X, &za);
+            mY.clear();
+            mY = MoveUtil::move(mS);
+            ASSERT(X == mY);
+            ASSERT(mS.empty());
+        }
+        {
+            StrObj mA(X, &oa);
+            StrObj mB(&oa);
+            mB.insert(StrPair(key, key, &oa));
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mA.swap(mB);
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == mB);
+            ASSERT(1 == mA.size());
+
+            StrObj mC(&za);
+            swap(mB, mC);
+            ASSERT(X == mC);
+            ASSERT(mB.empty());
+            ASSERT(&za == mC.allocator());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS, MANIPULATORS, AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates a multimap using the expected allocator
+        //:   and comparator, and the range and adopting constructors retain
+        //:   every element.
+        //:
+        //: 2 A singly inserted element follows the existing elements having
+        //:   an equivalent key, and 'insert' returns an iterator to it.
+        //:
+        //: 3 Bulk-inserted elements follow the existing elements having an
+        //:   equivalent key.
+        //:
+        //: 4 The lookup methods agree with an oracle after any sequence of
+        //:   insertions and removals.
+        //:
+        //: 5 Each 'erase' overload removes the specified elements, and
+        //:   'erase(key)' returns the number removed.
+        //:
+        //: 6 'reserve' and 'shrink_to_fit' change the capacity as documented.
+        //:
+        //: 7 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Exercise each method, comparing the result with a
+        //:   'bsl::multimap' oracle.  (C-1..7)
+        //
+        // Testing:
+        //   FlatMultimap();
+        //   FlatMultimap(bslma::Allocator *basicAllocator);
+        //   FlatMultimap(const COMPARATOR& comparator, *bA = 0);
+        //   FlatMultimap(INPUT_ITERATOR first, INPUT_ITERATOR last, *bA = 0);
+        //   FlatMultimap(first, last, const COMPARATOR& comparator, *bA = 0);
+        //   FlatMultimap(MovableRef<container_type> container, *bA = 0);
+        //   FlatMultimap(MovableRef<container_type> c, comparator, *bA = 0);
+        //   ~FlatMultimap();
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   iterator find(const KEY& key);
+        //   iterator insert(const value_type& value);
+        //   iterator insert(MovableRef<value_type> value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   iterator lower_bound(const KEY& key);
+        //   void reserve(bsl::size_t numElements);
+        //   void shrink_to_fit();
+        //   iterator upper_bound(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   bsl::size_t capacity() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   COMPARATOR key_comp() const;
+        //   const_iterator lower_bound(const KEY& key) const;
+        //   bsl::size_t size() const;
+        //   const_iterator upper_bound(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CONSTRUCTORS, MANIPULATORS, AND ACCESSORS" << endl
+                  << "=========================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tConstructors." << endl;
+        {
+            Obj mA;  const Obj& A = mA;
+            ASSERT(&defaultAllocator == A.allocator());
+            ASSERT(A.empty());
+            ASSERT(0 == A.capacity());
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+            Obj mB(&oa);  const Obj& B = mB;
+            ASSERT(&oa == B.allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            bdlc::FlatMultimap<int, int, bsl::greater<int> > mC(
+                                                         bsl::greater<int>(),
+                                                         &oa);
+            ASSERT(mC.key_comp()(2, 1));
+            mC.insert(IntPair(1, 1));
+            mC.insert(IntPair(3, 3));
+            mC.insert(IntPair(2, 2));
+            ASSERT(3 == mC.begin()->first);
+
+            const IntPair VALUES[] = { IntPair(3, 30), IntPair(1, 10),
+                                       IntPair(4, 40), IntPair(1, 10),
+                                       IntPair(5, 50), IntPair(9, 90),
+                                       IntPair(2, 20), IntPair(5, 50) };
+            const int NUM_VALUES = static_cast<int>(sizeof VALUES /
+                                                    sizeof *VALUES);
+
+            const bsl::multimap<int, int> ORACLE(VALUES,
+                                                 VALUES + NUM_VALUES,
+                                                 &sa);
+
+            Obj mD(VALUES, VALUES + NUM_VALUES, &oa);  const Obj& D = mD;
+            ASSERT(sameElements(D, ORACLE));
+
+            Obj mE(VALUES, VALUES + NUM_VALUES, bsl::less<int>(), &oa);
+            const Obj& E = mE;
+            ASSERT(D == E);
+
+            bsl::vector<IntPair> v(VALUES, VALUES + NUM_VALUES, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            Obj mF(MoveUtil::move(v), &oa);  const Obj& F = mF;
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(v.empty());
+            ASSERT(D == F);
+
+            bsl::vector<IntPair> w(VALUES, VALUES + NUM_VALUES, &sa);
+
+            Obj mG(MoveUtil::move(w), bsl::less<int>(), &oa);
+            const Obj& G = mG;
+            ASSERT(NUM_VALUES == static_cast<int>(w.size()));
+            ASSERT(D == G);
+            ASSERT(&oa == G.allocator());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tInsertion, lookup, and removal." << endl;
+        {
+            Obj                     mX(&oa);  const Obj& X = mX;
+            bsl::multimap<int, int> oracle(&sa);
+
+            unsigned int state = 7;
+            for (int i = 0; i < 3000; ++i) {
+                state = state * 1103515245 + 12345;
+                const int key = static_cast<int>((state >> 16) % 100);
+
+                if ((state >> 8) & 3) {
+                    IntPair value(key, i);
+                    oracle.insert(value);
+
+                    const Obj::iterator it = i & 1
+                                           ? mX.insert(value)
+                                           : mX.insert(MoveUtil::move(value));
+                    ASSERTV(i, key == it->first);
+                    ASSERTV(i, i   == it->second);
+                    ASSERTV(i, it + 1 == mX.upper_bound(key));
+                }
+                else {
+                    ASSERTV(i, key, oracle.erase(key) == mX.erase(key));
+                }
+                ASSERTV(i, sameElements(X, oracle));
+            }
+
+            for (int key = -1; key <= 100; ++key) {
+                const bsl::size_t EXP = oracle.count(key);
+                ASSERTV(key, EXP         == X.count(key));
+                ASSERTV(key, (EXP != 0)  == X.contains(key));
+                ASSERTV(key, (EXP != 0)  == (X.end() != X.find(key)));
+                ASSERTV(key, (EXP != 0)  == (mX.end() != mX.find(key)));
+
+                const int NLB = static_cast<int>(
+                       bsl::distance(oracle.begin(), oracle.lower_bound(key)));
+                const int NUB = static_cast<int>(
+                       bsl::distance(oracle.begin(), oracle.upper_bound(key)));
+
+                if (EXP) {
+                    ASSERTV(key, NLB == X.find(key) - X.begin());
+                }
+                ASSERTV(key, NLB == X.lower_bound(key) - X.begin());
+                ASSERTV(key, NUB == X.upper_bound(key) - X.begin());
+                ASSERTV(key, NLB == mX.lower_bound(key) - mX.begin());
+                ASSERTV(key, NUB == mX.upper_bound(key) - mX.begin());
+                ASSERTV(key, NLB == X.equal_range(key).first - X.begin());
+                ASSERTV(key, NUB == X.equal_range(key).second - X.begin());
+                ASSERTV(key, NLB == mX.equal_range(key).first - mX.begin());
+                ASSERTV(key, NUB == mX.equal_range(key).second - mX.begin());
+            }
+
+            bsl::vector<IntPair> more(&sa);
+            for (int key = 120; key > -20; --key) {
+                more.push_back(IntPair(key, -1));
+            }
+            const bsl::size_t SIZE = X.size();
+            mX.insert(more.begin(), more.end());
+            ASSERT(SIZE + more.size() == X.size());
+            for (int key = 0; key < 100; ++key) {
+                const Obj::const_iterator LAST = X.upper_bound(key) - 1;
+                ASSERTV(key, key == LAST->first);
+                ASSERTV(key, -1  == LAST->second);
+            }
+
+            ASSERT(mX.begin() == mX.erase(mX.begin()));
+            ASSERT(X.begin() == mX.erase(X.cbegin()));
+            ASSERT(SIZE + more.size() - 2 == X.size());
+            ASSERT(X.begin() == mX.erase(X.begin(), X.begin() + 10));
+            ASSERT(SIZE + more.size() - 12 == X.size());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(X.cbegin() == X.cend());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\t'reserve' and 'shrink_to_fit'." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(IntPair(i % 7, i));
+            }
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+
+            mX.erase(X.begin() + 10, X.end());
+            mX.shrink_to_fit();
+            ASSERT(10 == X.capacity());
+            ASSERT(10 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a multimap, insert, look up, and erase a few elements.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 99; i >= 0; --i) {
+            mX.insert(IntPair(i / 2, i));
+        }
+        ASSERT(100 == X.size());
+        ASSERT(2   == X.count(21));
+        ASSERT(43  == X.find(21)->second);
+        ASSERT(0   == X.begin()->first);
+
+        ASSERT(2 == mX.erase(21));
+        ASSERT(!X.contains(21));
+
+        Obj mY(X, &oa);
+        ASSERT(X == mY);
+
+        mY.insert(IntPair(21, 0));
+        ASSERT(X != mY);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
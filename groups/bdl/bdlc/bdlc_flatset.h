@@ -0,0 +1,788 @@
+// bdlc_flatset.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATSET
+#define INCLUDED_BDLC_FLATSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set container stored in a sorted vector.
+//
+//@CLASSES:
+//  bdlc::FlatSet: ordered set of unique keys in contiguous storage
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flattree, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatSet', implementing a value-semantic container that holds unique
+// keys in order, and that is largely interface-compatible with 'bsl::set'.
+// Unlike 'bsl::set', which allocates a red-black tree node for each element,
+// 'bdlc::FlatSet' stores its elements in a single 'bsl::vector', sorted by
+// key.  See 'bdlc_flattree' for details of the implementation.
+//
+// As for 'bdlc::FlatMap', lookup is a branch-free binary search and iteration
+// is a linear scan over contiguous memory, while inserting or erasing a
+// single element is linear in the size of the set.  Sets should therefore be
+// built in bulk -- by the range constructor, by range 'insert', or by
+// adopting a 'bsl::vector' of keys -- and then read.  Any insertion or
+// removal invalidates iterators, pointers, and references to elements.
+//
+// 'bdlc::FlatSet' uses the 'bslma::Allocator' protocol for all memory
+// allocation, and propagates its allocator to its elements if they use
+// 'bslma'-style allocation.  It supports BDEX streaming (see the 'bslx'
+// package documentation) provided that 'KEY' does.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Checking Membership in a Fixed Set of Symbols
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to check, many times over, whether a ticker symbol belongs
+// to a watch list that changes rarely.
+//
+// First, we build the watch list from an unsorted range, which is sorted
+// once:
+//..
+//  const char *SYMBOLS[] = { "IBM", "AAPL", "MSFT", "GOOG", "AAPL" };
+//
+//  bslma::TestAllocator oa("object");
+//
+//  bdlc::FlatSet<bsl::string> watchList(SYMBOLS, SYMBOLS + 5, &oa);
+//
+//  assert(4 == watchList.size());
+//..
+// Then, we check membership:
+//..
+//  assert( watchList.contains("MSFT"));
+//  assert(!watchList.contains("ORCL"));
+//..
+// Finally, we list the symbols in alphabetical order:
+//..
+//  bdlc::FlatSet<bsl::string>::const_iterator it = watchList.begin();
+//  assert("AAPL" == *it++);
+//  assert("GOOG" == *it++);
+//  assert("IBM"  == *it++);
+//  assert("MSFT" == *it++);
+//  assert(watchList.end() == it);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flattree.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                               // =============
+                               // class FlatSet
+                               // =============
+
+template <class KEY, class COMPARATOR = bsl::less<KEY> >
+class FlatSet {
+    // This class template implements a value-semantic container that holds
+    // unique keys of the (template parameter) type 'KEY', ordered by the
+    // (template parameter) type 'COMPARATOR', in a sorted vector.  See the
+    // component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef FlatTree<KEY, KEY, FlatTree_KeyEntryUtil<KEY>, COMPARATOR>
+                                                                     ImplType;
+
+    // DATA
+    ImplType d_impl;  // underlying sorted vector
+
+    // FRIENDS
+    template <class K, class C>
+    friend bool operator==(const FlatSet<K, C>&, const FlatSet<K, C>&);
+
+  public:
+    // TYPES
+    typedef KEY                                  key_type;
+    typedef KEY                                  value_type;
+    typedef bsl::size_t                          size_type;
+    typedef bsl::ptrdiff_t                       difference_type;
+    typedef COMPARATOR                           key_compare;
+    typedef COMPARATOR                           value_compare;
+    typedef value_type&                          reference;
+    typedef const value_type&                    const_reference;
+    typedef value_type                          *pointer;
+    typedef const value_type                    *const_pointer;
+    typedef typename ImplType::const_iterator    iterator;
+    typedef typename ImplType::const_iterator    const_iterator;
+    typedef bsl::vector<KEY>                     container_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatSet, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to the 'bdexStreamOut'
+        // method.  Note that it is highly recommended that 'versionSelector'
+        // be formatted as "YYYYMMDD", a date representation.  Also note that
+        // 'versionSelector' should be a *compile*-time-chosen value that
+        // selects a format version supported by both externalizer and
+        // unexternalizer.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+
+    // CREATORS
+    FlatSet();
+    explicit FlatSet(bslma::Allocator *basicAllocator);
+    explicit FlatSet(const COMPARATOR&  comparator,
+                     bslma::Allocator  *basicAllocator = 0);
+        // Create an empty set.  Optionally specify a 'comparator' used to
+        // order keys.  If 'comparator' is not supplied, a default-constructed
+        // 'COMPARATOR' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  No memory is allocated.
+
+    template <class INPUT_ITERATOR>
+    FlatSet(INPUT_ITERATOR    first,
+            INPUT_ITERATOR    last,
+            bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    FlatSet(INPUT_ITERATOR     first,
+            INPUT_ITERATOR     last,
+            const COMPARATOR&  comparator,
+            bslma::Allocator  *basicAllocator = 0);
+        // Create a set holding the keys in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element.  If the sequence holds several equivalent
+        // keys, it is unspecified which of them is inserted.  Optionally
+        // specify a 'comparator' used to order keys.  If 'comparator' is not
+        // supplied, a default-constructed 'COMPARATOR' is used.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '[first .. last)' is a
+        // valid range.
+
+    explicit FlatSet(bslmf::MovableRef<container_type>  container,
+                     bslma::Allocator                  *basicAllocator = 0);
+    FlatSet(bslmf::MovableRef<container_type>  container,
+            const COMPARATOR&                  comparator,
+            bslma::Allocator                  *basicAllocator = 0);
+        // Create a set holding the keys of the specified 'container', which
+        // need not be sorted.  If 'container' holds several equivalent keys,
+        // it is unspecified which of them is retained.  Optionally specify a
+        // 'comparator' used to order keys.  If 'comparator' is not supplied, a
+        // default-constructed 'COMPARATOR' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  If 'container'
+        // uses the same allocator, its storage is adopted and 'container' is
+        // left empty; otherwise, 'container' is copied and left unchanged.
+
+    FlatSet(const FlatSet& original, bslma::Allocator *basicAllocator = 0);
+        // Create a set having the same value and comparator as the specified
+        // 'original' set.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    FlatSet(bslmf::MovableRef<FlatSet> original);
+        // Create a set having the same value, comparator, and allocator as the
+        // specified 'original' set, leaving 'original' empty.  No memory is
+        // allocated.
+
+    FlatSet(bslmf::MovableRef<FlatSet>  original,
+            bslma::Allocator           *basicAllocator);
+        // Create a set having the same value and comparator as the specified
+        // 'original' set, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' uses the same allocator, its
+        // storage is transferred and 'original' is left empty; otherwise,
+        // 'original' is copied and left unchanged.
+
+    ~FlatSet();
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatSet& operator=(const FlatSet& rhs);
+        // Assign to this set the value and comparator of the specified 'rhs'
+        // set, and return a reference providing modifiable access to this
+        // set.
+
+    FlatSet& operator=(bslmf::MovableRef<FlatSet> rhs);
+        // Assign to this set the value and comparator of the specified 'rhs'
+        // set, and return a reference providing modifiable access to this
+        // set.  If 'rhs' uses the same allocator as this set, its storage is
+        // transferred and 'rhs' is left empty; otherwise, 'rhs' is copied and
+        // left unchanged.
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version);
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, if 'stream'
+        // becomes invalid, or if the keys read are not strictly increasing,
+        // this object is unaltered and 'stream' is invalidated.  Note that no
+        // version is read from 'stream'.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    void clear();
+        // Remove all elements from this set.  Note that the capacity of this
+        // set is unchanged.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this set the specified 'key', if it exists, and return
+        // the number of elements removed (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Remove from this set the element at the specified 'position', and
+        // return an iterator referring to the element following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an element of this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the elements starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the element that followed them
+        // (or the past-the-end iterator).  The behavior is undefined unless
+        // '[first .. last)' is a valid range of elements of this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& value);
+        // Insert a copy of the specified 'value' into this set if an
+        // equivalent key does not already exist.  Return a pair whose 'first'
+        // member refers to the element equivalent to 'value', and whose
+        // 'second' member is 'true' if the insertion was performed and
+        // 'false' otherwise.
+
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<KEY> value);
+        // Insert the specified 'value' into this set, using its move
+        // constructor, if an equivalent key does not already exist.  Return a
+        // pair whose 'first' member refers to the element equivalent to
+        // 'value', and whose 'second' member is 'true' if the insertion was
+        // performed and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set each key in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, that is not already in this set.  If the
+        // sequence holds several equivalent keys, it is unspecified which of
+        // them is inserted.  The behavior is undefined unless
+        // '[first .. last)' is a valid range.
+
+    void reserve(bsl::size_t numElements);
+        // Increase the capacity of this set, if needed, so that the specified
+        // 'numElements' may be held without reallocating.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this set to (approximately) its size.
+
+    void swap(FlatSet& other);
+        // Exchange the value and comparator of this set with those of the
+        // specified 'other' set.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // set and 'other' use the same allocator.
+
+    // ACCESSORS
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write the value of this object, using the specified 'version'
+        // format, to the specified output 'stream', and return a reference to
+        // 'stream'.  If 'stream' is initially invalid, this operation has no
+        // effect.  If 'version' is not supported, 'stream' is invalidated, but
+        // otherwise unmodified.  Note that 'version' is not written to
+        // 'stream'.  See the 'bslx' package-level documentation for more
+        // information on BDEX streaming of value-semantic types and
+        // containers.
+
+    bsl::size_t capacity() const;
+        // Return the number of elements this set can hold without
+        // reallocating.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set holds the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements of this set equivalent to the
+        // specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set holds no elements, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                        const;
+        // Return the pair of iterators 'lower_bound(key)' and
+        // 'upper_bound(key)' for the specified 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element equivalent to the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // element.
+
+    COMPARATOR key_comp() const;
+        // Return (a copy of) the key comparator of this set.
+
+    const_iterator lower_bound(const KEY& key) const;
+        // Return an iterator referring to the first element not ordered
+        // before the specified 'key', or the past-the-end iterator if there is
+        // no such element.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+    const_iterator upper_bound(const KEY& key) const;
+        // Return an iterator referring to the first element ordered after the
+        // specified 'key', or the past-the-end iterator if there is no such
+        // element.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this set, or
+        // the past-the-end iterator if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator of this set.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+bool operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets have the same
+    // value, and 'false' otherwise.  Two sets have the same value if they
+    // have the same number of elements and corresponding elements (in key
+    // order) are equal.
+
+template <class KEY, class COMPARATOR>
+bool operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                const FlatSet<KEY, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' sets do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+void swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' sets.  If 'a' and 'b'
+    // use different allocators, the exchange is performed by copying.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                               // -------------
+                               // class FlatSet
+                               // -------------
+
+// CLASS METHODS
+template <class KEY, class COMPARATOR>
+inline
+int FlatSet<KEY, COMPARATOR>::maxSupportedBdexVersion(
+                                                     int /* versionSelector */)
+{
+    return 1;  // Required by BDE policy; versions start at 1.
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet()
+: d_impl(COMPARATOR())
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(INPUT_ITERATOR    first,
+                                  INPUT_ITERATOR    last,
+                                  bslma::Allocator *basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+    d_impl.insertUnique(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(INPUT_ITERATOR     first,
+                                  INPUT_ITERATOR     last,
+                                  const COMPARATOR&  comparator,
+                                  bslma::Allocator  *basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    d_impl.insertUnique(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(
+                           bslmf::MovableRef<container_type>  container,
+                           bslma::Allocator                  *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(container),
+         true,
+         COMPARATOR(),
+         basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(
+                           bslmf::MovableRef<container_type>  container,
+                           const COMPARATOR&                  comparator,
+                           bslma::Allocator                  *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(container),
+         true,
+         comparator,
+         basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(const FlatSet&    original,
+                                  bslma::Allocator *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslmf::MovableRef<FlatSet> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::FlatSet(bslmf::MovableRef<FlatSet>  original,
+                                  bslma::Allocator           *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                              bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>::~FlatSet()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>&
+FlatSet<KEY, COMPARATOR>::operator=(const FlatSet& rhs)
+{
+    d_impl = rhs.d_impl;
+    return *this;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+FlatSet<KEY, COMPARATOR>&
+FlatSet<KEY, COMPARATOR>::operator=(bslmf::MovableRef<FlatSet> rhs)
+{
+    d_impl = bslmf::MovableRefUtil::move(
+                                   bslmf::MovableRefUtil::access(rhs).d_impl);
+    return *this;
+}
+
+template <class KEY, class COMPARATOR>
+template <class STREAM>
+inline
+STREAM& FlatSet<KEY, COMPARATOR>::bdexStreamIn(STREAM& stream, int version)
+{
+    return d_impl.bdexStreamIn(stream, version, true);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::erase(const_iterator position)
+{
+    return d_impl.erase(position);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::iterator
+FlatSet<KEY, COMPARATOR>::erase(const_iterator first, const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::iterator, bool>
+FlatSet<KEY, COMPARATOR>::insert(const KEY& value)
+{
+    return d_impl.insertUnique(value);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::iterator, bool>
+FlatSet<KEY, COMPARATOR>::insert(bslmf::MovableRef<KEY> value)
+{
+    return d_impl.insertUnique(bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class COMPARATOR>
+template <class INPUT_ITERATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::insert(INPUT_ITERATOR first,
+                                      INPUT_ITERATOR last)
+{
+    d_impl.insertUnique(first, last);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::reserve(bsl::size_t numElements)
+{
+    d_impl.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::shrink_to_fit()
+{
+    d_impl.shrinkToFit();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+void FlatSet<KEY, COMPARATOR>::swap(FlatSet& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR>
+template <class STREAM>
+inline
+STREAM& FlatSet<KEY, COMPARATOR>::bdexStreamOut(STREAM& stream,
+                                                int     version) const
+{
+    return d_impl.bdexStreamOut(stream, version);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool FlatSet<KEY, COMPARATOR>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::count(const KEY& key) const
+{
+    return d_impl.contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool FlatSet<KEY, COMPARATOR>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::pair<typename FlatSet<KEY, COMPARATOR>::const_iterator,
+          typename FlatSet<KEY, COMPARATOR>::const_iterator>
+FlatSet<KEY, COMPARATOR>::equal_range(const KEY& key) const
+{
+    return d_impl.equalRange(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+COMPARATOR FlatSet<KEY, COMPARATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::lower_bound(const KEY& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bsl::size_t FlatSet<KEY, COMPARATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::upper_bound(const KEY& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR>
+inline
+typename FlatSet<KEY, COMPARATOR>::const_iterator
+FlatSet<KEY, COMPARATOR>::cend() const
+{
+    return d_impl.end();
+}
+
+                                  // Aspects
+
+template <class KEY, class COMPARATOR>
+inline
+bslma::Allocator *FlatSet<KEY, COMPARATOR>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatSet<KEY, COMPARATOR>& lhs,
+                      const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatSet<KEY, COMPARATOR>& lhs,
+                      const FlatSet<KEY, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR>
+inline
+void bdlc::swap(FlatSet<KEY, COMPARATOR>& a, FlatSet<KEY, COMPARATOR>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    FlatSet<KEY, COMPARATOR> futureA(b, a.allocator());
+    FlatSet<KEY, COMPARATOR> futureB(a, b.allocator());
+
+    a.swap(futureA);
+    b.swap(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
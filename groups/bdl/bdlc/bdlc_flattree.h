@@ -0,0 +1,1363 @@
+// bdlc_flattree.h                                                    -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATTREE
+#define INCLUDED_BDLC_FLATTREE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sorted-vector implementation of ordered containers.
+//
+//@CLASSES:
+//  bdlc::FlatTree: sorted-vector storage for ordered associative containers
+//  bdlc::FlatTree_KeyEntryUtil: entry utility for entries that are keys
+//  bdlc::FlatTree_PairEntryUtil: entry utility for key-value pair entries
+//
+//@SEE_ALSO: bdlc_flatmap, bdlc_flatmultimap, bdlc_flatset
+//
+//@DESCRIPTION: This component provides a class template, 'bdlc::FlatTree',
+// that implements the storage and algorithms shared by the ordered
+// associative containers 'bdlc::FlatMap', 'bdlc::FlatMultimap', and
+// 'bdlc::FlatSet'.  The entries of a 'FlatTree' are held, sorted by key, in a
+// single 'bsl::vector', rather than in one individually allocated node per
+// entry as in the red-black trees underlying 'bsl::map' and 'bsl::set'.
+//
+// This layout favors containers that are built once and then read many
+// times:
+//
+//: o Lookup is a binary search over contiguous memory, implemented without
+//:   data-dependent branches, and iteration is a linear scan; both make far
+//:   better use of the cache than traversing tree nodes.
+//:
+//: o A container of 'N' entries performs O(log N) allocations while it is
+//:   built and uses no per-entry memory beyond 'sizeof(ENTRY)'.
+//:
+//: o Inserting or erasing a single entry is O(N), as subsequent entries are
+//:   moved.  Bulk insertion of 'M' entries (via the range methods, or by
+//:   adopting a 'bsl::vector') appends the entries, sorts them, and merges
+//:   them with the existing entries, which is O(N + M log M).
+//:
+//: o Any insertion or removal invalidates iterators, pointers, and
+//:   references to entries.
+//
+// 'FlatTree' is parameterized by the types of its keys and entries, by an
+// 'ENTRY_UTIL' type providing access to the key of an entry and BDEX
+// streaming of entries, and by a 'COMPARATOR' type defining a strict weak
+// ordering of keys.  Uniqueness of keys is not a property of the type:
+// separate methods insert entries into a tree holding unique keys and into a
+// tree that may hold equivalent keys, and the client must use one family of
+// methods consistently.  This component provides two 'ENTRY_UTIL' types:
+// 'FlatTree_KeyEntryUtil', for entries that are themselves keys, and
+// 'FlatTree_PairEntryUtil', for entries of type 'bsl::pair<KEY, VALUE>'.
+//
+// The entries are streamed, in BDEX version 1 format, as a length followed by
+// each entry in order; unexternalization verifies the order of the keys and
+// invalidates the stream if they are not sorted.
+//
+// This component is an implementation detail of 'bdlc_flatmap',
+// 'bdlc_flatmultimap', and 'bdlc_flatset', and is not intended for direct
+// use.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Sorted Sequence of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain an ordered sequence of unique integers.
+//
+// First, we define the type of the tree, and create an object:
+//..
+//  typedef bdlc::FlatTree<int,
+//                         int,
+//                         bdlc::FlatTree_KeyEntryUtil<int>,
+//                         bsl::less<int> > Tree;
+//
+//  bslma::TestAllocator oa("object");
+//
+//  Tree tree(bsl::less<int>(), &oa);
+//..
+// Then, we insert some values one at a time, and some in bulk:
+//..
+//  tree.insertUnique(7);
+//  tree.insertUnique(3);
+//
+//  const int VALUES[] = { 9, 3, 1, 5 };
+//  tree.insertUnique(VALUES, VALUES + 4);
+//..
+// Now, we observe that the entries are sorted and duplicates were dropped:
+//..
+//  assert(5 == tree.size());
+//  assert(1 == tree.begin()[0]);
+//  assert(3 == tree.begin()[1]);
+//  assert(5 == tree.begin()[2]);
+//  assert(7 == tree.begin()[3]);
+//  assert(9 == tree.begin()[4]);
+//..
+// Finally, we look up a few values:
+//..
+//  assert(tree.end() != tree.find(5));
+//  assert(tree.end() == tree.find(6));
+//  assert(7          == *tree.lowerBound(6));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+
+#include <bslx_instreamfunctions.h>
+#include <bslx_outstreamfunctions.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlc {
+
+                        // ============================
+                        // struct FlatTree_KeyEntryUtil
+                        // ============================
+
+template <class KEY>
+struct FlatTree_KeyEntryUtil {
+    // This 'struct' provides the utility functions required by 'FlatTree' for
+    // entries that are keys.
+
+    // CLASS METHODS
+    template <class STREAM>
+    static void bdexStreamIn(STREAM& stream, KEY *entry);
+        // Assign to the specified 'entry' the value read from the specified
+        // input 'stream'.
+
+    template <class STREAM>
+    static void bdexStreamOut(STREAM& stream, const KEY& entry);
+        // Write the specified 'entry' to the specified output 'stream'.
+
+    static const KEY& key(const KEY& entry);
+        // Return the specified 'entry'.
+};
+
+                        // =============================
+                        // struct FlatTree_PairEntryUtil
+                        // =============================
+
+template <class KEY, class VALUE>
+struct FlatTree_PairEntryUtil {
+    // This 'struct' provides the utility functions required by 'FlatTree' for
+    // entries of type 'bsl::pair<KEY, VALUE>'.
+
+    // CLASS METHODS
+    template <class STREAM>
+    static void bdexStreamIn(STREAM& stream, bsl::pair<KEY, VALUE> *entry);
+        // Assign to the specified 'entry' the key and value read from the
+        // specified input 'stream'.
+
+    template <class STREAM>
+    static void bdexStreamOut(STREAM&                      stream,
+                              const bsl::pair<KEY, VALUE>& entry);
+        // Write the key and value of the specified 'entry' to the specified
+        // output 'stream'.
+
+    static const KEY& key(const bsl::pair<KEY, VALUE>& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+                       // ==============================
+                       // class FlatTree_EntryComparator
+                       // ==============================
+
+template <class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class FlatTree_EntryComparator {
+    // This class provides a functor that orders entries by applying a
+    // 'COMPARATOR' to their keys.
+
+    // DATA
+    const COMPARATOR *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+    explicit FlatTree_EntryComparator(const COMPARATOR *comparator);
+        // Create a functor ordering entries using the specified 'comparator'.
+
+    // ACCESSORS
+    bool operator()(const ENTRY& lhs, const ENTRY& rhs) const;
+        // Return 'true' if the key of the specified 'lhs' is ordered before
+        // the key of the specified 'rhs', and 'false' otherwise.
+};
+
+                          // ========================
+                          // class FlatTree_TailGuard
+                          // ========================
+
+template <class CONTAINER>
+class FlatTree_TailGuard {
+    // This class implements a proctor that, unless released, truncates a
+    // container to a specified length on destruction.  It is used to restore
+    // the ordering invariant of a 'FlatTree' if an exception is thrown while
+    // entries are being sorted or merged.
+
+    // DATA
+    CONTAINER   *d_container_p;  // guarded container, or 0 if released
+    bsl::size_t  d_length;       // length to which to truncate
+
+  private:
+    // NOT IMPLEMENTED
+    FlatTree_TailGuard(const FlatTree_TailGuard&);
+    FlatTree_TailGuard& operator=(const FlatTree_TailGuard&);
+
+  public:
+    // CREATORS
+    FlatTree_TailGuard(CONTAINER *container, bsl::size_t length);
+        // Create a guard that truncates the specified 'container' to the
+        // specified 'length' on destruction, unless released.
+
+    ~FlatTree_TailGuard();
+        // Truncate the guarded container, unless this guard was released, and
+        // destroy this object.
+
+    // MANIPULATORS
+    void release();
+        // Release the guarded container from management by this guard.
+
+    void setLength(bsl::size_t length);
+        // Set the length to which the guarded container is truncated to the
+        // specified 'length'.
+};
+
+                               // ==============
+                               // class FlatTree
+                               // ==============
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+class FlatTree {
+    // This class template stores entries of the (template parameter) type
+    // 'ENTRY' in a contiguous array sorted by their keys, of the (template
+    // parameter) type 'KEY', according to the (template parameter) type
+    // 'COMPARATOR'.  The (template parameter) type 'ENTRY_UTIL' provides
+    // access to the key of an entry and BDEX streaming of entries.  See the
+    // component-level documentation for details.
+
+  public:
+    // TYPES
+    typedef bsl::vector<ENTRY>                     ContainerType;
+    typedef typename ContainerType::iterator       iterator;
+    typedef typename ContainerType::const_iterator const_iterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatTree_EntryComparator<ENTRY, ENTRY_UTIL, COMPARATOR>
+                                                           EntryComparator;
+    typedef bslmf::MovableRefUtil                          MoveUtil;
+
+    // DATA
+    ContainerType d_container;   // entries, sorted by key
+    COMPARATOR    d_comparator;  // key comparator
+
+    // PRIVATE MANIPULATORS
+    void mergeTail(bsl::size_t numSorted, bool uniqueKeys);
+        // Sort the entries following the specified 'numSorted' leading
+        // (sorted) entries of this tree, and merge them with the leading
+        // entries.  If the specified 'uniqueKeys' is 'true', remove each
+        // trailing entry whose key is equivalent to that of a leading entry
+        // or of an earlier trailing entry (after sorting).  If an exception
+        // is thrown, this tree is left holding a subset of its entries.
+
+    // PRIVATE ACCESSORS
+    bool isOrdered(const_iterator first,
+                   const_iterator last,
+                   bool           uniqueKeys) const;
+        // Return 'true' if the keys of the entries in the specified range
+        // '[first .. last)' are sorted (with no two keys equivalent if the
+        // specified 'uniqueKeys' is 'true'), and 'false' otherwise.
+
+    bsl::size_t lowerBoundIndex(const KEY& key) const;
+        // Return the index of the first entry whose key is not ordered before
+        // the specified 'key', or 'size()' if there is no such entry.
+
+    bsl::size_t upperBoundIndex(const KEY& key) const;
+        // Return the index of the first entry whose key is ordered after the
+        // specified 'key', or 'size()' if there is no such entry.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatTree, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit FlatTree(const COMPARATOR&  comparator,
+                      bslma::Allocator  *basicAllocator = 0);
+        // Create an empty tree that orders keys using the specified
+        // 'comparator'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    FlatTree(bslmf::MovableRef<ContainerType>  container,
+             bool                              uniqueKeys,
+             const COMPARATOR&                 comparator,
+             bslma::Allocator                 *basicAllocator = 0);
+        // Create a tree that orders keys using the specified 'comparator' and
+        // holds the entries of the specified 'container', sorted.  If the
+        // specified 'uniqueKeys' is 'true', only one (unspecified) entry of
+        // each set of entries having equivalent keys is retained.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'container' uses the same allocator, its storage is
+        // adopted and 'container' is left empty; otherwise, 'container' is
+        // copied and left unchanged.
+
+    FlatTree(const FlatTree& original, bslma::Allocator *basicAllocator = 0);
+        // Create a tree having the same value and comparator as the specified
+        // 'original' tree.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    FlatTree(bslmf::MovableRef<FlatTree> original);
+        // Create a tree having the same value, comparator, and allocator as
+        // the specified 'original' tree, leaving 'original' empty.  No memory
+        // is allocated.
+
+    FlatTree(bslmf::MovableRef<FlatTree>  original,
+             bslma::Allocator            *basicAllocator);
+        // Create a tree having the same value and comparator as the specified
+        // 'original' tree, using the specified 'basicAllocator' to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If 'original' uses the same allocator, its
+        // storage is transferred and 'original' is left empty; otherwise,
+        // 'original' is copied and left unchanged.
+
+    //! ~FlatTree() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    FlatTree& operator=(const FlatTree& rhs);
+        // Assign to this tree the value and comparator of the specified 'rhs'
+        // tree, and return a reference providing modifiable access to this
+        // tree.
+
+    FlatTree& operator=(bslmf::MovableRef<FlatTree> rhs);
+        // Assign to this tree the value and comparator of the specified 'rhs'
+        // tree, and return a reference providing modifiable access to this
+        // tree.  If 'rhs' uses the same allocator as this tree, its storage is
+        // transferred and 'rhs' is left empty; otherwise, 'rhs' is copied and
+        // left unchanged.
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version, bool uniqueKeys);
+        // Assign to this tree the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If the specified 'uniqueKeys' is 'true',
+        // the keys read must be strictly increasing; otherwise they must be
+        // non-decreasing.  If 'stream' is initially invalid, this operation
+        // has no effect.  If 'version' is not supported, if 'stream' becomes
+        // invalid, or if the keys read are not ordered, this tree is
+        // unaltered and 'stream' is invalidated.  Note that no version is
+        // read from 'stream'.
+
+    void clear();
+        // Remove all entries from this tree.  Note that the capacity of this
+        // tree is unchanged.
+
+    iterator erase(const_iterator position);
+        // Remove from this tree the entry at the specified 'position', and
+        // return an iterator referring to the entry following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an entry of this tree.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this tree the entries starting at the specified 'first'
+        // position up to, but not including, the specified 'last' position,
+        // and return an iterator referring to the entry that followed them
+        // (or the past-the-end iterator).  The behavior is undefined unless
+        // '[first .. last)' is a valid range of entries of this tree.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove from this tree the entries having a key equivalent to the
+        // specified 'key', and return the number of entries removed.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the first entry having a key
+        // equivalent to the specified 'key', or the past-the-end iterator if
+        // there is no such entry.
+
+    bsl::pair<iterator, iterator> equalRange(const KEY& key);
+        // Return the pair of iterators 'lowerBound(key)' and
+        // 'upperBound(key)' for the specified 'key'.
+
+    iterator lowerBound(const KEY& key);
+        // Return an iterator referring to the first entry whose key is not
+        // ordered before the specified 'key', or the past-the-end iterator if
+        // there is no such entry.
+
+    iterator upperBound(const KEY& key);
+        // Return an iterator referring to the first entry whose key is
+        // ordered after the specified 'key', or the past-the-end iterator if
+        // there is no such entry.
+
+    iterator insertAt(const_iterator position, const ENTRY& entry);
+    iterator insertAt(const_iterator position, bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree immediately before the
+        // specified 'position', and return an iterator referring to the
+        // inserted entry.  The behavior is undefined unless inserting 'entry'
+        // at 'position' preserves the ordering of this tree.
+
+    iterator insertMulti(const ENTRY& entry);
+    iterator insertMulti(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree after any entries having
+        // an equivalent key, and return an iterator referring to the inserted
+        // entry.
+
+    template <class INPUT_ITERATOR>
+    void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each entry in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element.  Inserted entries are placed after the
+        // existing entries having an equivalent key; the relative order of
+        // inserted entries having equivalent keys is unspecified.  The
+        // behavior is undefined unless '[first .. last)' is a valid range.
+
+    bsl::pair<iterator, bool> insertUnique(const ENTRY& entry);
+    bsl::pair<iterator, bool> insertUnique(bslmf::MovableRef<ENTRY> entry);
+        // Insert the specified 'entry' into this tree if no entry having an
+        // equivalent key exists.  Return a pair whose 'first' member refers to
+        // the entry having a key equivalent to that of 'entry', and whose
+        // 'second' member is 'true' if the insertion was performed and
+        // 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this tree each entry in the sequence starting at the
+        // specified 'first' element, and ending immediately before the
+        // specified 'last' element, whose key is not equivalent to that of an
+        // existing entry.  If the sequence holds several entries having
+        // equivalent keys, it is unspecified which of them is inserted.  The
+        // behavior is undefined unless '[first .. last)' is a valid range.
+
+    void reserve(bsl::size_t numEntries);
+        // Increase the capacity of this tree, if needed, so that the specified
+        // 'numEntries' may be held without reallocating.
+
+    void shrinkToFit();
+        // Reduce the capacity of this tree to (approximately) its size.
+
+    void swap(FlatTree& other);
+        // Exchange the value and comparator of this tree with those of the
+        // specified 'other' tree.  This method provides the no-throw
+        // exception-safety guarantee if 'COMPARATOR' can be swapped without
+        // throwing.  The behavior is undefined unless this tree and 'other'
+        // use the same allocator.
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this tree, or
+        // the past-the-end iterator if this tree is empty.
+
+    iterator end();
+        // Return the past-the-end iterator of this tree.
+
+    // ACCESSORS
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write the value of this tree, using the specified 'version' format,
+        // to the specified output 'stream', and return a reference to
+        // 'stream'.  If 'stream' is initially invalid, this operation has no
+        // effect.  If 'version' is not supported, 'stream' is invalidated,
+        // but otherwise unmodified.  Note that 'version' is not written to
+        // 'stream'.
+
+    bsl::size_t capacity() const;
+        // Return the number of entries this tree can hold without
+        // reallocating.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the key
+        // comparator of this tree.
+
+    const ContainerType& container() const;
+        // Return a reference providing non-modifiable access to the sorted
+        // entries of this tree.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this tree holds an entry having a key equivalent to
+        // the specified 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries of this tree having a key equivalent
+        // to the specified 'key'.
+
+    bool empty() const;
+        // Return 'true' if this tree holds no entries, and 'false' otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equalRange(const KEY& key)
+                                                                        const;
+        // Return the pair of iterators 'lowerBound(key)' and
+        // 'upperBound(key)' for the specified 'key'.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the first entry having a key
+        // equivalent to the specified 'key', or the past-the-end iterator if
+        // there is no such entry.
+
+    const_iterator lowerBound(const KEY& key) const;
+        // Return an iterator referring to the first entry whose key is not
+        // ordered before the specified 'key', or the past-the-end iterator if
+        // there is no such entry.
+
+    bsl::size_t size() const;
+        // Return the number of entries in this tree.
+
+    const_iterator upperBound(const KEY& key) const;
+        // Return an iterator referring to the first entry whose key is
+        // ordered after the specified 'key', or the past-the-end iterator if
+        // there is no such entry.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this tree, or
+        // the past-the-end iterator if this tree is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator of this tree.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this tree to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator==(const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' trees have the same
+    // value, and 'false' otherwise.  Two trees have the same value if they
+    // have the same number of entries and corresponding entries compare
+    // equal.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool operator!=(const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' trees do not have the
+    // same value, and 'false' otherwise.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // struct FlatTree_KeyEntryUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class KEY>
+template <class STREAM>
+inline
+void FlatTree_KeyEntryUtil<KEY>::bdexStreamIn(STREAM& stream, KEY *entry)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslx::InStreamFunctions::bdexStreamIn(stream, *entry);
+}
+
+template <class KEY>
+template <class STREAM>
+inline
+void FlatTree_KeyEntryUtil<KEY>::bdexStreamOut(STREAM&    stream,
+                                               const KEY& entry)
+{
+    bslx::OutStreamFunctions::bdexStreamOut(stream, entry);
+}
+
+template <class KEY>
+inline
+const KEY& FlatTree_KeyEntryUtil<KEY>::key(const KEY& entry)
+{
+    return entry;
+}
+
+                        // -----------------------------
+                        // struct FlatTree_PairEntryUtil
+                        // -----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+template <class STREAM>
+inline
+void FlatTree_PairEntryUtil<KEY, VALUE>::bdexStreamIn(
+                                          STREAM&                stream,
+                                          bsl::pair<KEY, VALUE> *entry)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslx::InStreamFunctions::bdexStreamIn(stream, entry->first);
+    bslx::InStreamFunctions::bdexStreamIn(stream, entry->second);
+}
+
+template <class KEY, class VALUE>
+template <class STREAM>
+inline
+void FlatTree_PairEntryUtil<KEY, VALUE>::bdexStreamOut(
+                                          STREAM&                      stream,
+                                          const bsl::pair<KEY, VALUE>& entry)
+{
+    bslx::OutStreamFunctions::bdexStreamOut(stream, entry.first);
+    bslx::OutStreamFunctions::bdexStreamOut(stream, entry.second);
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY& FlatTree_PairEntryUtil<KEY, VALUE>::key(
+                                            const bsl::pair<KEY, VALUE>& entry)
+{
+    return entry.first;
+}
+
+                       // ------------------------------
+                       // class FlatTree_EntryComparator
+                       // ------------------------------
+
+// CREATORS
+template <class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree_EntryComparator<ENTRY, ENTRY_UTIL, COMPARATOR>::
+                  FlatTree_EntryComparator(const COMPARATOR *comparator)
+: d_comparator_p(comparator)
+{
+    BSLS_ASSERT_SAFE(comparator);
+}
+
+// ACCESSORS
+template <class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatTree_EntryComparator<ENTRY, ENTRY_UTIL, COMPARATOR>::operator()(
+                                                        const ENTRY& lhs,
+                                                        const ENTRY& rhs) const
+{
+    return (*d_comparator_p)(ENTRY_UTIL::key(lhs), ENTRY_UTIL::key(rhs));
+}
+
+                          // ------------------------
+                          // class FlatTree_TailGuard
+                          // ------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatTree_TailGuard<CONTAINER>::FlatTree_TailGuard(CONTAINER   *container,
+                                                  bsl::size_t  length)
+: d_container_p(container)
+, d_length(length)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatTree_TailGuard<CONTAINER>::~FlatTree_TailGuard()
+{
+    if (d_container_p && d_length < d_container_p->size()) {
+        d_container_p->erase(d_container_p->begin() + d_length,
+                             d_container_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatTree_TailGuard<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+template <class CONTAINER>
+inline
+void FlatTree_TailGuard<CONTAINER>::setLength(bsl::size_t length)
+{
+    d_length = length;
+}
+
+                               // --------------
+                               // class FlatTree
+                               // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::mergeTail(
+                                                    bsl::size_t numSorted,
+                                                    bool        uniqueKeys)
+{
+    BSLS_ASSERT(numSorted <= d_container.size());
+
+    const EntryComparator less(&d_comparator);
+
+    FlatTree_TailGuard<ContainerType> guard(&d_container, numSorted);
+
+    const iterator tail = d_container.begin() + numSorted;
+
+    // The tail is frequently already sorted (e.g., when the entries come from
+    // another ordered container), in which case sorting can be skipped.
+
+    if (!isOrdered(tail, d_container.end(), false)) {
+        bsl::sort(tail, d_container.end(), less);
+    }
+
+    if (uniqueKeys) {
+        iterator out = tail;
+        for (iterator in = tail; in != d_container.end(); ++in) {
+            if (out == tail || less(*(out - 1), *in)) {
+                if (out != in) {
+                    *out = MoveUtil::move(*in);
+                }
+                ++out;
+            }
+        }
+        d_container.erase(out, d_container.end());
+    }
+
+    if (0 == numSorted
+     || d_container.size() == numSorted
+     || (uniqueKeys
+         ? less(d_container[numSorted - 1], d_container[numSorted])
+         : !less(d_container[numSorted], d_container[numSorted - 1]))) {
+        // The tail follows the leading entries; no merge is required.
+
+        guard.release();
+        return;                                                       // RETURN
+    }
+
+    // Merge into new storage; both sequences are moved from, so the tree is
+    // cleared if an exception is thrown.
+
+    guard.setLength(0);
+
+    ContainerType merged(allocator());
+    merged.reserve(d_container.size());
+
+    iterator       head    = d_container.begin();
+    const iterator headEnd = d_container.begin() + numSorted;
+    iterator       next    = headEnd;
+
+    while (head != headEnd && next != d_container.end()) {
+        if (less(*next, *head)) {
+            merged.push_back(MoveUtil::move(*next));
+            ++next;
+        }
+        else {
+            if (uniqueKeys && !less(*head, *next)) {
+                ++next;  // drop the equivalent new entry
+            }
+            else {
+                merged.push_back(MoveUtil::move(*head));
+                ++head;
+            }
+        }
+    }
+    for (; head != headEnd; ++head) {
+        merged.push_back(MoveUtil::move(*head));
+    }
+    for (; next != d_container.end(); ++next) {
+        merged.push_back(MoveUtil::move(*next));
+    }
+
+    d_container.swap(merged);
+    guard.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+bool FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::isOrdered(
+                                               const_iterator first,
+                                               const_iterator last,
+                                               bool           uniqueKeys) const
+{
+    const EntryComparator less(&d_comparator);
+
+    if (first == last) {
+        return true;                                                  // RETURN
+    }
+    for (const_iterator prev = first++; first != last; prev = first++) {
+        if (uniqueKeys ? !less(*prev, *first) : less(*first, *prev)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBoundIndex(
+                                                          const KEY& key) const
+{
+    // This binary search halves the candidate range unconditionally, so that
+    // the comparison result selects between two addresses (typically
+    // compiled to a conditional move) rather than between two branches.
+
+    bsl::size_t length = d_container.size();
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const ENTRY *base = d_container.data();
+    while (length > 1) {
+        const bsl::size_t half = length / 2;
+        base = d_comparator(ENTRY_UTIL::key(base[half - 1]), key)
+             ? base + half
+             : base;
+        length -= half;
+    }
+    base += d_comparator(ENTRY_UTIL::key(*base), key) ? 1 : 0;
+    return static_cast<bsl::size_t>(base - d_container.data());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBoundIndex(
+                                                          const KEY& key) const
+{
+    bsl::size_t length = d_container.size();
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const ENTRY *base = d_container.data();
+    while (length > 1) {
+        const bsl::size_t half = length / 2;
+        base = d_comparator(key, ENTRY_UTIL::key(base[half - 1]))
+             ? base
+             : base + half;
+        length -= half;
+    }
+    base += d_comparator(key, ENTRY_UTIL::key(*base)) ? 0 : 1;
+    return static_cast<bsl::size_t>(base - d_container.data());
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatTree(
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_container(basicAllocator)
+, d_comparator(comparator)
+{
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatTree(
+                            bslmf::MovableRef<ContainerType>  container,
+                            bool                              uniqueKeys,
+                            const COMPARATOR&                 comparator,
+                            bslma::Allocator                 *basicAllocator)
+: d_container(MoveUtil::move(container), basicAllocator)
+, d_comparator(comparator)
+{
+    mergeTail(0, uniqueKeys);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatTree(
+                                            const FlatTree&   original,
+                                            bslma::Allocator *basicAllocator)
+: d_container(original.d_container, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatTree(
+                                          bslmf::MovableRef<FlatTree> original)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container))
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::FlatTree(
+                                bslmf::MovableRef<FlatTree>  original,
+                                bslma::Allocator            *basicAllocator)
+: d_container(MoveUtil::move(MoveUtil::access(original).d_container),
+              basicAllocator)
+, d_comparator(MoveUtil::access(original).d_comparator)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator=(const FlatTree& rhs)
+{
+    d_container  = rhs.d_container;
+    d_comparator = rhs.d_comparator;
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::operator=(
+                                               bslmf::MovableRef<FlatTree> rhs)
+{
+    FlatTree& other = MoveUtil::access(rhs);
+
+    d_container  = MoveUtil::move(other.d_container);
+    d_comparator = other.d_comparator;
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class STREAM>
+STREAM& FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::bdexStreamIn(
+                                                        STREAM& stream,
+                                                        int     version,
+                                                        bool    uniqueKeys)
+{
+    if (stream) {
+        switch (version) {  // switch on the schema version
+          case 1: {
+            int length;
+            stream.getLength(length);
+            if (!stream) {
+                return stream;                                        // RETURN
+            }
+
+            ContainerType entries(allocator());
+            entries.resize(length);
+            for (int i = 0; i < length && stream; ++i) {
+                ENTRY_UTIL::bdexStreamIn(stream, &entries[i]);
+            }
+            if (!stream) {
+                return stream;                                        // RETURN
+            }
+
+            if (!isOrdered(entries.begin(), entries.end(), uniqueKeys)) {
+                stream.invalidate();
+                return stream;                                        // RETURN
+            }
+            d_container.swap(entries);
+          } break;
+          default: {
+            stream.invalidate();  // unrecognized version number
+          }
+        }
+    }
+    return stream;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::clear()
+{
+    d_container.clear();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT(position != end());
+
+    return d_container.erase(position);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(const_iterator first,
+                                                    const_iterator last)
+{
+    return d_container.erase(first, last);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t first = lowerBoundIndex(key);
+    const bsl::size_t last  = upperBoundIndex(key);
+
+    d_container.erase(d_container.begin() + first,
+                      d_container.begin() + last);
+    return last - first;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const KEY& key)
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return index == d_container.size()
+        || d_comparator(key, ENTRY_UTIL::key(d_container[index]))
+           ? d_container.end()
+           : d_container.begin() + index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator,
+          typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator>
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::equalRange(const KEY& key)
+{
+    return bsl::pair<iterator, iterator>(lowerBound(key), upperBound(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBound(const KEY& key)
+{
+    return d_container.begin() + lowerBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBound(const KEY& key)
+{
+    return d_container.begin() + upperBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertAt(
+                                                   const_iterator position,
+                                                   const ENTRY&   entry)
+{
+    return d_container.insert(position, entry);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertAt(
+                                     const_iterator           position,
+                                     bslmf::MovableRef<ENTRY> entry)
+{
+    return d_container.insert(position, MoveUtil::move(entry));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMulti(const ENTRY& entry)
+{
+    return d_container.insert(
+                       d_container.begin() + upperBoundIndex(
+                                                      ENTRY_UTIL::key(entry)),
+                       entry);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMulti(
+                                                bslmf::MovableRef<ENTRY> entry)
+{
+    const bsl::size_t index = upperBoundIndex(
+                                    ENTRY_UTIL::key(MoveUtil::access(entry)));
+
+    return d_container.insert(d_container.begin() + index,
+                              MoveUtil::move(entry));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertMulti(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    const bsl::size_t numSorted = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+    mergeTail(numSorted, false);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator,
+          bool>
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUnique(const ENTRY& entry)
+{
+    const KEY&        key   = ENTRY_UTIL::key(entry);
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index != d_container.size()
+     && !d_comparator(key, ENTRY_UTIL::key(d_container[index]))) {
+        return bsl::pair<iterator, bool>(d_container.begin() + index,
+                                         false);                      // RETURN
+    }
+    return bsl::pair<iterator, bool>(
+                        d_container.insert(d_container.begin() + index, entry),
+                        true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator,
+          bool>
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUnique(
+                                                bslmf::MovableRef<ENTRY> entry)
+{
+    const KEY&        key   = ENTRY_UTIL::key(MoveUtil::access(entry));
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    if (index != d_container.size()
+     && !d_comparator(key, ENTRY_UTIL::key(d_container[index]))) {
+        return bsl::pair<iterator, bool>(d_container.begin() + index,
+                                         false);                      // RETURN
+    }
+    return bsl::pair<iterator, bool>(
+                            d_container.insert(d_container.begin() + index,
+                                               MoveUtil::move(entry)),
+                            true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class INPUT_ITERATOR>
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::insertUnique(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    const bsl::size_t numSorted = d_container.size();
+
+    d_container.insert(d_container.end(), first, last);
+    mergeTail(numSorted, true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    d_container.reserve(numEntries);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::shrinkToFit()
+{
+    d_container.shrink_to_fit();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+void FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::swap(FlatTree& other)
+{
+    BSLS_ASSERT(allocator() == other.allocator());
+
+    d_container.swap(other.d_container);
+
+    using bsl::swap;
+    swap(d_comparator, other.d_comparator);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin()
+{
+    return d_container.begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end()
+{
+    return d_container.end();
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+template <class STREAM>
+STREAM& FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::bdexStreamOut(
+                                                         STREAM& stream,
+                                                         int     version) const
+{
+    if (stream) {
+        switch (version) {  // switch on the schema version
+          case 1: {
+            stream.putLength(static_cast<int>(d_container.size()));
+            for (const_iterator it = d_container.begin();
+                 it != d_container.end() && stream;
+                 ++it) {
+                ENTRY_UTIL::bdexStreamOut(stream, *it);
+            }
+          } break;
+          default: {
+            stream.invalidate();  // unrecognized version number
+          }
+        }
+    }
+    return stream;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::capacity() const
+{
+    return d_container.capacity();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+const COMPARATOR&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::comparator() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+const typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::ContainerType&
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::container() const
+{
+    return d_container;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::contains(
+                                                          const KEY& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::count(
+                                                          const KEY& key) const
+{
+    return upperBoundIndex(key) - lowerBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::empty() const
+{
+    return d_container.empty();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::pair<
+        typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator,
+        typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator>
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::equalRange(const KEY& key) const
+{
+    return bsl::pair<const_iterator, const_iterator>(lowerBound(key),
+                                                     upperBound(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::find(const KEY& key) const
+{
+    const bsl::size_t index = lowerBoundIndex(key);
+
+    return index == d_container.size()
+        || d_comparator(key, ENTRY_UTIL::key(d_container[index]))
+           ? d_container.end()
+           : d_container.begin() + index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::lowerBound(const KEY& key) const
+{
+    return d_container.begin() + lowerBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bsl::size_t FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::size() const
+{
+    return d_container.size();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::upperBound(const KEY& key) const
+{
+    return d_container.begin() + upperBoundIndex(key);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::begin() const
+{
+    return d_container.begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+typename FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::const_iterator
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::end() const
+{
+    return d_container.end();
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bslma::Allocator *
+FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>::allocator() const
+{
+    return d_container.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool bdlc::operator==(const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                      const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    return lhs.container() == rhs.container();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class COMPARATOR>
+inline
+bool bdlc::operator!=(const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& lhs,
+                      const FlatTree<KEY, ENTRY, ENTRY_UTIL, COMPARATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
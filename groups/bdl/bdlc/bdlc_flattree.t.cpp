@@ -0,0 +1,1214 @@
+// bdlc_flattree.t.cpp                                                -*-C++-*-
+#include <bdlc_flattree.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_review.h>
+
+#include <bslx_testinstream.h>
+#include <bslx_testoutstream.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test implements a mechanism, 'bdlc::FlatTree', holding
+// entries sorted by key in a 'bsl::vector'.  Most methods are tested by
+// applying sequences of operations to both a tree and an oracle ('bsl::set'
+// or 'bsl::multiset'), and comparing the results; the bulk-insertion methods
+// are tested for each relative placement of the existing and inserted keys.
+// BDEX streaming is tested for round trips, unsupported versions, truncated
+// data, and out-of-order keys.
+//
+// Global Concerns:
+//: o No memory is ever allocated from the global allocator.
+//: o Any allocated memory is always from the object allocator.
+//: o An exception thrown during bulk insertion leaves the tree ordered.
+// ----------------------------------------------------------------------------
+// CLASS 'FlatTree_KeyEntryUtil'
+// [ 6] void bdexStreamIn(STREAM& stream, KEY *entry);
+// [ 6] void bdexStreamOut(STREAM& stream, const KEY& entry);
+// [ 2] const KEY& key(const KEY& entry);
+//
+// CLASS 'FlatTree_PairEntryUtil'
+// [ 6] void bdexStreamIn(STREAM& stream, bsl::pair<KEY, VALUE> *entry);
+// [ 6] void bdexStreamOut(STREAM& stream, const bsl::pair<K, V>& entry);
+// [ 5] const KEY& key(const bsl::pair<KEY, VALUE>& entry);
+//
+// CLASS 'FlatTree'
+// [ 2] FlatTree(const COMPARATOR& comparator, bslma::Allocator *bA = 0);
+// [ 4] FlatTree(MovableRef<ContainerType> c, bool unique, cmp, *bA = 0);
+// [ 5] FlatTree(const FlatTree& original, bslma::Allocator *bA = 0);
+// [ 5] FlatTree(MovableRef<FlatTree> original);
+// [ 5] FlatTree(MovableRef<FlatTree> original, bslma::Allocator *bA);
+// [ 5] FlatTree& operator=(const FlatTree& rhs);
+// [ 5] FlatTree& operator=(MovableRef<FlatTree> rhs);
+// [ 6] STREAM& bdexStreamIn(STREAM& stream, int version, bool unique);
+// [ 2] void clear();
+// [ 2] iterator erase(const_iterator position);
+// [ 2] iterator erase(const_iterator first, const_iterator last);
+// [ 2] bsl::size_t erase(const KEY& key);
+// [ 2] iterator find(const KEY& key);
+// [ 2] pair<iterator, iterator> equalRange(const KEY& key);
+// [ 2] iterator lowerBound(const KEY& key);
+// [ 2] iterator upperBound(const KEY& key);
+// [ 3] iterator insertAt(const_iterator position, const ENTRY& entry);
+// [ 3] iterator insertAt(const_iterator position, MovableRef<ENTRY> entry);
+// [ 3] iterator insertMulti(const ENTRY& entry);
+// [ 3] iterator insertMulti(MovableRef<ENTRY> entry);
+// [ 4] void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] pair<iterator, bool> insertUnique(const ENTRY& entry);
+// [ 2] pair<iterator, bool> insertUnique(MovableRef<ENTRY> entry);
+// [ 4] void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 2] void reserve(bsl::size_t numEntries);
+// [ 2] void shrinkToFit();
+// [ 5] void swap(FlatTree& other);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 6] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+// [ 2] bsl::size_t capacity() const;
+// [ 2] const COMPARATOR& comparator() const;
+// [ 5] const ContainerType& container() const;
+// [ 2] bool contains(const KEY& key) const;
+// [ 2] bsl::size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 2] pair<const_iterator, const_iterator> equalRange(const KEY&) const;
+// [ 2] const_iterator find(const KEY& key) const;
+// [ 2] const_iterator lowerBound(const KEY& key) const;
+// [ 2] bsl::size_t size() const;
+// [ 2] const_iterator upperBound(const KEY& key) const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const FlatTree& lhs, const FlatTree& rhs);
+// [ 5] bool operator!=(const FlatTree& lhs, const FlatTree& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [ 7] CONCERN: Bulk insertion is exception neutral and keeps the order.
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatTree<int,
+                       int,
+                       bdlc::FlatTree_KeyEntryUtil<int>,
+                       bsl::less<int> >                     Obj;
+
+typedef bsl::pair<int, int>                                 IntPair;
+
+typedef bdlc::FlatTree<int,
+                       IntPair,
+                       bdlc::FlatTree_PairEntryUtil<int, int>,
+                       bsl::less<int> >                     PairObj;
+
+typedef bsl::pair<bsl::string, bsl::string>                 StrPair;
+
+typedef bdlc::FlatTree<bsl::string,
+                       StrPair,
+                       bdlc::FlatTree_PairEntryUtil<bsl::string, bsl::string>,
+                       bsl::less<bsl::string> >             StrObj;
+
+typedef bslmf::MovableRefUtil                               MoveUtil;
+
+// Define 'bsl::string' value long enough to ensure dynamic memory allocation.
+#define SUFFICIENTLY_LONG_STRING "1234567890123456789012345678901234567890" \
+                                 "1234567890123456789012345678901234567890"
+
+const int SERIALIZATION_VERSION = 20200101;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class TREE>
+bool isSortedTree(const TREE& tree, bool uniqueKeys)
+    // Return 'true' if the keys of the specified 'tree' are sorted (strictly,
+    // if the specified 'uniqueKeys' is 'true'), and 'false' otherwise.
+{
+    typedef typename TREE::const_iterator Iterator;
+
+    if (tree.empty()) {
+        return true;                                                  // RETURN
+    }
+    for (Iterator prev = tree.begin(), it = prev + 1;
+         it != tree.end();
+         prev = it++) {
+        if (uniqueKeys ? !(prev->first < it->first)
+                       : it->first < prev->first) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+bool verify(const Obj& tree, const bsl::set<int>& oracle)
+    // Return 'true' if the specified 'tree' holds exactly the keys of the
+    // specified 'oracle', in order, and 'false' otherwise.
+{
+    if (tree.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    return bsl::equal(oracle.begin(), oracle.end(), tree.begin());
+}
+
+bool verify(const PairObj& tree, const bsl::vector<IntPair>& oracle)
+    // Return 'true' if the specified 'tree' holds exactly the entries of the
+    // specified 'oracle', in order, and 'false' otherwise.
+{
+    return tree.container() == oracle;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    int             verbose = argc > 2;
+    int         veryVerbose = argc > 3;
+    int     veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Maintaining a Sorted Sequence of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to maintain an ordered sequence of unique integers.
+//
+// First, we define the type of the tree, and create an object:
+//..
+    typedef bdlc::FlatTree<int,
+                           int,
+                           bdlc::FlatTree_KeyEntryUtil<int>,
+                           bsl::less<int> > Tree;
+
+    bslma::TestAllocator oa("object");
+
+    Tree tree(bsl::less<int>(), &oa);
+//..
+// Then, we insert some values one at a time, and some in bulk:
+//..
+    tree.insertUnique(7);
+    tree.insertUnique(3);
+
+    const int VALUES[] = { 9, 3, 1, 5 };
+    tree.insertUnique(VALUES, VALUES + 4);
+//..
+// Now, we observe that the entries are sorted and duplicates were dropped:
+//..
+    ASSERT(5 == tree.size());
+    ASSERT(1 == tree.begin()[0]);
+    ASSERT(3 == tree.begin()[1]);
+    ASSERT(5 == tree.begin()[2]);
+    ASSERT(7 == tree.begin()[3]);
+    ASSERT(9 == tree.begin()[4]);
+//..
+// Finally, we look up a few values:
+//..
+    ASSERT(tree.end() != tree.find(5));
+    ASSERT(tree.end() == tree.find(6));
+    ASSERT(7          == *tree.lowerBound(6));
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF BULK INSERTION
+        //
+        // Concerns:
+        //: 1 If an allocation fails during bulk insertion (into unique or
+        //:   non-unique trees, with or without a merge), the exception
+        //:   propagates, the tree remains sorted, holds no entries other than
+        //:   its original entries and the inserted ones, and no memory leaks.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, insert
+        //:   ranges of strings into trees of strings, and verify the tree
+        //:   afterwards.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Bulk insertion is exception neutral and keeps the order.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY OF BULK INSERTION" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::vector<StrPair> existing(&sa);
+        bsl::vector<StrPair> inserted(&sa);
+        bsl::string          key(SUFFICIENTLY_LONG_STRING, &sa);
+
+        for (int i = 0; i < 20; ++i) {
+            key[0] = static_cast<char>('a' + (i * 7) % 20);
+            existing.push_back(StrPair(key, key, &sa));
+            key[1] = static_cast<char>('a' + (i * 3) % 25);
+            inserted.push_back(StrPair(key, key, &sa));
+        }
+
+        for (int unique = 0; unique < 2; ++unique) {
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                StrObj mX(bsl::less<bsl::string>(), &oa);
+                const StrObj& X = mX;
+
+                if (unique) {
+                    mX.insertUnique(existing.begin(), existing.end());
+                    ASSERT(20 == X.size());
+                    mX.insertUnique(inserted.begin(), inserted.end());
+                    ASSERT(40 == X.size());
+                }
+                else {
+                    mX.insertMulti(existing.begin(), existing.end());
+                    mX.insertMulti(inserted.begin(), inserted.end());
+                    ASSERT(40 == X.size());
+                }
+                ASSERT(isSortedTree(X, unique));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            // Verify the invariant after each possible failure.
+
+            StrObj mX(bsl::less<bsl::string>(), &oa);  const StrObj& X = mX;
+            if (unique) {
+                mX.insertUnique(existing.begin(), existing.end());
+            }
+            else {
+                mX.insertMulti(existing.begin(), existing.end());
+            }
+            for (int limit = 0; limit < 200; ++limit) {
+                StrObj mY(X, &oa);  const StrObj& Y = mY;
+
+                oa.setAllocationLimit(limit);
+#ifdef BDE_BUILD_TARGET_EXC
+                try {
+                    if (unique) {
+                        mY.insertUnique(inserted.begin(), inserted.end());
+                    }
+                    else {
+                        mY.insertMulti(inserted.begin(), inserted.end());
+                    }
+                }
+                catch (const bslma::TestAllocatorException&) {
+                }
+#endif
+                oa.setAllocationLimit(-1);
+
+                ASSERTV(unique, limit, isSortedTree(Y, unique));
+                ASSERTV(unique, limit, Y.size() <= 40);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BDEX STREAMING
+        //
+        // Concerns:
+        //: 1 Externalization followed by unexternalization reproduces the
+        //:   value, for trees of keys and of key-value pairs.
+        //:
+        //: 2 An unsupported version invalidates the stream and leaves the
+        //:   tree unchanged.
+        //:
+        //: 3 Truncated data invalidates the stream and leaves the tree
+        //:   unchanged.
+        //:
+        //: 4 Keys that are not sorted (or, for unique trees, that are
+        //:   repeated) invalidate the stream and leave the tree unchanged.
+        //:
+        //: 5 Unexternalization from an invalid stream has no effect.
+        //
+        // Plan:
+        //: 1 Stream trees of various sizes out and in using
+        //:   'bslx::TestOutStream' and 'bslx::TestInStream'.  (C-1)
+        //:
+        //: 2 Attempt to stream with version 0 and version 2.  (C-2)
+        //:
+        //: 3 Stream in from every proper prefix of a valid stream.  (C-3)
+        //:
+        //: 4 Hand-craft streams with out-of-order and repeated keys.  (C-4)
+        //:
+        //: 5 Stream in from an invalidated stream.  (C-5)
+        //
+        // Testing:
+        //   void bdexStreamIn(STREAM& stream, KEY *entry);
+        //   void bdexStreamOut(STREAM& stream, const KEY& entry);
+        //   void bdexStreamIn(STREAM& stream, bsl::pair<KEY, VALUE> *entry);
+        //   void bdexStreamOut(STREAM& stream, const bsl::pair<K, V>& entry);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version, bool unique);
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BDEX STREAMING" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tRound trip." << endl;
+        for (int n = 0; n < 50; n += 7) {
+            StrObj mX(bsl::less<bsl::string>(), &oa);  const StrObj& X = mX;
+
+            bsl::string key(&oa);
+            bsl::string value(SUFFICIENTLY_LONG_STRING, &oa);
+            for (int i = 0; i < n; ++i) {
+                key.assign(1 + i % 3, static_cast<char>('a' + i % 26));
+                mX.insertMulti(StrPair(key, value, &oa));
+            }
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out, 1);
+            ASSERTV(n, out);
+
+            StrObj mY(bsl::less<bsl::string>(), &oa);  const StrObj& Y = mY;
+            mY.insertMulti(StrPair("zzz", "zzz", &oa));
+
+            bslx::TestInStream in(out.data(), out.length());
+            mY.bdexStreamIn(in, 1, false);
+            ASSERTV(n, in);
+            ASSERTV(n, in.isEmpty());
+            ASSERTV(n, X == Y);
+
+            if (0 == n % 2) {
+                continue;
+            }
+
+            // Truncated data.
+
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                StrObj mZ(Y, &oa);  const StrObj& Z = mZ;
+
+                mZ.insertMulti(StrPair("zzz", "zzz", &oa));
+                const StrObj W(Z, &oa);
+
+                bslx::TestInStream in(out.data(), len);
+                in.setQuiet(true);
+                mZ.bdexStreamIn(in, 1, false);
+                ASSERTV(n, len, !in);
+                ASSERTV(n, len, W == Z);
+            }
+        }
+
+        if (verbose) cout << "\tUnsupported versions and invalid streams."
+                          << endl;
+        {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+            mX.insertUnique(1);
+            mX.insertUnique(2);
+
+            bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out, 0);
+            ASSERT(!out);
+
+            bslx::TestOutStream out2(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out2, 2);
+            ASSERT(!out2);
+
+            bslx::TestOutStream out3(SERIALIZATION_VERSION, &oa);
+            X.bdexStreamOut(out3, 1);
+            ASSERT(out3);
+
+            Obj mY(bsl::less<int>(), &oa);  const Obj& Y = mY;
+            mY.insertUnique(5);
+            const Obj Z(Y, &oa);
+
+            bslx::TestInStream in(out3.data(), out3.length());
+            mY.bdexStreamIn(in, 2, true);
+            ASSERT(!in);
+            ASSERT(Z == Y);
+
+            bslx::TestInStream in2(out3.data(), out3.length());
+            in2.invalidate();
+            mY.bdexStreamIn(in2, 1, true);
+            ASSERT(!in2);
+            ASSERT(Z == Y);
+
+            bslx::TestInStream in3(out3.data(), out3.length());
+            mY.bdexStreamIn(in3, 1, true);
+            ASSERT(in3);
+            ASSERT(X == Y);
+        }
+
+        if (verbose) cout << "\tOut-of-order keys." << endl;
+        {
+            const int KEYS[][3] = {
+                { 1, 2, 3 },  // valid for unique and non-unique
+                { 1, 1, 3 },  // valid for non-unique only
+                { 2, 1, 3 },  // invalid
+                { 1, 3, 2 },  // invalid
+            };
+
+            for (int i = 0; i < 4; ++i) {
+                for (int unique = 0; unique < 2; ++unique) {
+                    bslx::TestOutStream out(SERIALIZATION_VERSION, &oa);
+                    out.putLength(3);
+                    for (int j = 0; j < 3; ++j) {
+                        out.putInt32(KEYS[i][j]);
+                        out.putInt32(j);
+                    }
+
+                    PairObj mX(bsl::less<int>(), &oa);
+                    const PairObj& X = mX;
+                    mX.insertUnique(IntPair(7, 7));
+                    const PairObj Y(X, &oa);
+
+                    bslx::TestInStream in(out.data(), out.length());
+                    mX.bdexStreamIn(in, 1, unique);
+
+                    const bool EXP = 0 == i || (1 == i && !unique);
+                    ASSERTV(i, unique, EXP == static_cast<bool>(in));
+                    if (EXP) {
+                        ASSERTV(i, unique, 3 == X.size());
+                        ASSERTV(i, unique, KEYS[i][2] == X.begin()[2].first);
+                    }
+                    else {
+                        ASSERTV(i, unique, Y == X);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 Copies have the same value and comparator, and use the supplied
+        //:   allocator, which is propagated to the entries.
+        //:
+        //: 2 Moves with the same allocator do not allocate and leave the
+        //:   source empty; moves with a different allocator copy.
+        //:
+        //: 3 Equality compares the entries in order.
+        //:
+        //: 4 'swap' exchanges values and comparators without allocating.
+        //
+        // Plan:
+        //: 1 Perform each operation on trees of strings, monitoring the
+        //:   allocators.  (C-1..4)
+        //
+        // Testing:
+        //   FlatTree(const FlatTree& original, bslma::Allocator *bA = 0);
+        //   FlatTree(MovableRef<FlatTree> original);
+        //   FlatTree(MovableRef<FlatTree> original, bslma::Allocator *bA);
+        //   FlatTree& operator=(const FlatTree& rhs);
+        //   FlatTree& operator=(MovableRef<FlatTree> rhs);
+        //   void swap(FlatTree& other);
+        //   const ContainerType& container() const;
+        //   bool operator==(const FlatTree& lhs, const FlatTree& rhs);
+        //   bool operator!=(const FlatTree& lhs, const FlatTree& rhs);
+        //   const KEY& key(const bsl::pair<KEY, VALUE>& entry);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "COPY, MOVE, ASSIGNMENT, SWAP, AND EQUALITY" << endl
+                 << "==========================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        StrObj mX(bsl::less<bsl::string>(), &oa);  const StrObj& X = mX;
+
+        bsl::string key(&oa);
+        bsl::string value(SUFFICIENTLY_LONG_STRING, &oa);
+        for (int i = 0; i < 30; ++i) {
+            key.assign(1, static_cast<char>('A' + i % 26));
+            key += static_cast<char>('0' + i / 26);
+            mX.insertUnique(StrPair(key, value, &oa));
+        }
+
+        {
+            StrObj mY(X, &za);  const StrObj& Y = mY;
+
+            ASSERT(X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(&za == Y.allocator());
+            ASSERT(&za == Y.begin()->second.get_allocator().mechanism());
+
+            mY.begin()->second = "changed";
+            ASSERT(X != Y);
+
+            mY = X;
+            ASSERT(X == Y);
+            ASSERT(&za == Y.begin()->second.get_allocator().mechanism());
+        }
+        {
+            StrObj mS(X, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            StrObj mY(MoveUtil::move(mS));  const StrObj& Y = mY;
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == Y);
+            ASSERT(mS.empty());
+
+            StrObj mZ(MoveUtil::move(mY), &za);  const StrObj& Z = mZ;
+
+            ASSERT(X == Z);
+            ASSERT(X == Y);
+            ASSERT(&za == Z.allocator());
+
+            StrObj mW(bsl::less<bsl::string>(), &oa);
+            StrObj mT(X, &oa);
+
+            const bsls::Types::Int64 NUM_ALLOC2 = oa.numAllocations();
+
+            mW = MoveUtil::move(mT);
+            ASSERT(NUM_ALLOC2 == oa.numAllocations());
+            ASSERT(X == mW);
+        }
+        {
+            StrObj mA(X, &oa);
+            StrObj mB(bsl::less<bsl::string>(), &oa);
+            mB.insertUnique(StrPair("k", "v", &oa));
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            mA.swap(mB);
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(X == mB);
+            ASSERT(1 == mA.size());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION AND CONTAINER ADOPTION
+        //
+        // Concerns:
+        //: 1 Range insertion sorts the inserted entries and merges them with
+        //:   the existing entries, whether the inserted keys precede, follow,
+        //:   or interleave with the existing keys, and whether or not the
+        //:   inserted range is already sorted.
+        //:
+        //: 2 For unique trees, inserted entries whose keys are equivalent to
+        //:   those of existing entries are dropped, and one entry of each set
+        //:   of equivalent inserted keys is kept.
+        //:
+        //: 3 For non-unique trees, existing entries precede inserted entries
+        //:   having equivalent keys.
+        //:
+        //: 4 A tree adopting a container having the same allocator does not
+        //:   allocate; an already sorted container is not reallocated.
+        //:
+        //: 5 Appending a sorted range after the existing keys allocates only
+        //:   to grow the vector.
+        //
+        // Plan:
+        //: 1 For a set of ranges of keys, insert each range into trees
+        //:   holding each of a set of initial ranges, and compare the result
+        //:   with an oracle.  (C-1..3)
+        //:
+        //: 2 Adopt containers, monitoring the allocators.  (C-4)
+        //:
+        //: 3 Append sorted ranges to a tree having reserved capacity, and
+        //:   verify that no memory is allocated.  (C-5)
+        //
+        // Testing:
+        //   FlatTree(MovableRef<ContainerType> c, bool unique, cmp, *bA = 0);
+        //   void insertMulti(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void insertUnique(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "BULK INSERTION AND CONTAINER ADOPTION" << endl
+                      << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;
+            const char *d_keys_p;  // each character is a key
+        } DATA[] = {
+            { L_, ""           },
+            { L_, "a"          },
+            { L_, "aa"         },
+            { L_, "abc"        },
+            { L_, "cba"        },
+            { L_, "mnop"       },
+            { L_, "xyz"        },
+            { L_, "ACE"        },
+            { L_, "bdfhjlnprt" },
+            { L_, "tsrqponmlk" },
+            { L_, "abcabcabc"  },
+            { L_, "zazbzczdz"  },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const char *const INIT = DATA[ti].d_keys_p;
+            const int         LEN1 = static_cast<int>(strlen(INIT));
+
+            for (int tj = 0; tj < NUM_DATA; ++tj) {
+                const int         LINE = DATA[tj].d_line;
+                const char *const KEYS = DATA[tj].d_keys_p;
+                const int         LEN2 = static_cast<int>(strlen(KEYS));
+
+                // Unique keys; the mapped value records the source.
+
+                {
+                    PairObj mX(bsl::less<int>(), &oa);
+                    bsl::map<int, int> oracle(&sa);
+
+                    bsl::vector<IntPair> init(&sa);
+                    for (int i = 0; i < LEN1; ++i) {
+                        init.push_back(IntPair(INIT[i], 1));
+                        oracle.insert(IntPair(INIT[i], 1));
+                    }
+                    mX.insertUnique(init.begin(), init.end());
+
+                    bsl::vector<IntPair> range(&sa);
+                    for (int i = 0; i < LEN2; ++i) {
+                        range.push_back(IntPair(KEYS[i], 2));
+                        oracle.insert(IntPair(KEYS[i], 2));
+                    }
+                    mX.insertUnique(range.begin(), range.end());
+
+                    bsl::vector<IntPair> exp(oracle.begin(),
+                                             oracle.end(),
+                                             &sa);
+                    ASSERTV(LINE, INIT, verify(mX, exp));
+                }
+
+                // Non-unique keys; the mapped value records the order.
+
+                {
+                    PairObj mX(bsl::less<int>(), &oa);
+                    bsl::multimap<int, int> oracle(&sa);
+
+                    bsl::vector<IntPair> init(&sa);
+                    for (int i = 0; i < LEN1; ++i) {
+                        init.push_back(IntPair(INIT[i], 0));
+                        oracle.insert(IntPair(INIT[i], 0));
+                    }
+                    mX.insertMulti(init.begin(), init.end());
+
+                    bsl::vector<IntPair> range(&sa);
+                    for (int i = 0; i < LEN2; ++i) {
+                        range.push_back(IntPair(KEYS[i], 1));
+                        oracle.insert(IntPair(KEYS[i], 1));
+                    }
+                    mX.insertMulti(range.begin(), range.end());
+
+                    bsl::vector<IntPair> exp(oracle.begin(),
+                                             oracle.end(),
+                                             &sa);
+                    ASSERTV(LINE, INIT, verify(mX, exp));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tContainer adoption." << endl;
+        {
+            bsl::vector<IntPair> c(&oa);
+            for (int i = 0; i < 100; ++i) {
+                c.push_back(IntPair((i * 37) % 50, i));
+            }
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            PairObj mX(MoveUtil::move(c), true, bsl::less<int>(), &oa);
+            const PairObj& X = mX;
+
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(50 == X.size());
+            ASSERT(isSortedTree(X, true));
+            ASSERT(c.empty());
+
+            bsl::vector<IntPair> d(&sa);
+            for (int i = 0; i < 100; ++i) {
+                d.push_back(IntPair(i / 2, i));
+            }
+
+            PairObj mY(MoveUtil::move(d), false, bsl::less<int>(), &oa);
+            const PairObj& Y = mY;
+
+            ASSERT(100 == Y.size());
+            ASSERT(100 == d.size());  // copied, not moved
+            ASSERT(d == Y.container());
+        }
+
+        if (verbose) cout << "\tAppending sorted ranges." << endl;
+        {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+            mX.reserve(1000);
+
+            const bsls::Types::Int64 NUM_ALLOC = oa.numAllocations();
+
+            bsl::vector<int> range(&sa);
+            for (int r = 0; r < 10; ++r) {
+                range.clear();
+                for (int i = 0; i < 100; ++i) {
+                    range.push_back(r * 100 + i);
+                }
+                mX.insertUnique(range.begin(), range.end());
+            }
+            ASSERT(NUM_ALLOC == oa.numAllocations());
+            ASSERT(1000 == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // NON-UNIQUE AND POSITIONAL INSERTION
+        //
+        // Concerns:
+        //: 1 'insertMulti' places an entry after the existing entries having
+        //:   an equivalent key, and returns an iterator to it.
+        //:
+        //: 2 'count', 'equalRange', and 'erase(key)' account for all entries
+        //:   having an equivalent key.
+        //:
+        //: 3 'insertAt' inserts at the specified position.
+        //
+        // Plan:
+        //: 1 Apply random insertions and removals to a tree of pairs, and
+        //:   compare with a 'bsl::multimap' oracle, which also places
+        //:   equivalent keys in insertion order.  (C-1..2)
+        //:
+        //: 2 Insert entries using 'insertAt' at the 'lowerBound' position.
+        //:   (C-3)
+        //
+        // Testing:
+        //   iterator insertAt(const_iterator position, const ENTRY& entry);
+        //   iterator insertAt(const_iterator position, MovableRef<ENTRY> e);
+        //   iterator insertMulti(const ENTRY& entry);
+        //   iterator insertMulti(MovableRef<ENTRY> entry);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                        << "NON-UNIQUE AND POSITIONAL INSERTION" << endl
+                        << "===================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            PairObj                 mX(bsl::less<int>(), &oa);
+            const PairObj&          X = mX;
+            bsl::multimap<int, int> oracle(&sa);
+
+            unsigned int state = 11;
+            for (int i = 0; i < 3000; ++i) {
+                state = state * 1103515245 + 12345;
+                const int key = static_cast<int>((state >> 16) % 50);
+
+                if ((state >> 8) % 5) {
+                    oracle.insert(IntPair(key, i));
+
+                    PairObj::iterator it;
+                    if (i & 1) {
+                        it = mX.insertMulti(IntPair(key, i));
+                    }
+                    else {
+                        IntPair entry(key, i);
+                        it = mX.insertMulti(MoveUtil::move(entry));
+                    }
+                    ASSERTV(i, key == it->first && i == it->second);
+                    ASSERTV(i, it + 1 == X.end() || key < (it + 1)->first);
+                }
+                else {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                }
+                ASSERTV(i, oracle.count(key) == X.count(key));
+
+                const bsl::pair<PairObj::const_iterator,
+                                PairObj::const_iterator> R =
+                                                         X.equalRange(key);
+                ASSERTV(i, X.count(key) ==
+                        static_cast<bsl::size_t>(R.second - R.first));
+            }
+
+            bsl::vector<IntPair> exp(oracle.begin(), oracle.end(), &sa);
+            ASSERT(verify(X, exp));
+        }
+
+        {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 20; ++i) {
+                const int key = (i * 7) % 20;
+                if (i & 1) {
+                    mX.insertAt(mX.lowerBound(key), key);
+                }
+                else {
+                    int entry = key;
+                    mX.insertAt(mX.lowerBound(key), MoveUtil::move(entry));
+                }
+            }
+            for (int i = 0; i < 20; ++i) {
+                ASSERTV(i, i == X.begin()[i]);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // UNIQUE INSERTION, LOOKUP, AND REMOVAL
+        //
+        // Concerns:
+        //: 1 A default-constructed tree is empty, allocates no memory, and
+        //:   reports its comparator and allocator.
+        //:
+        //: 2 'insertUnique' inserts an entry iff no entry having an
+        //:   equivalent key exists, and returns an iterator to the entry
+        //:   having that key.
+        //:
+        //: 3 'find', 'lowerBound', 'upperBound', 'equalRange', 'count', and
+        //:   'contains' agree with 'bsl::set' for keys present and absent,
+        //:   including keys before the first and after the last entry.
+        //:
+        //: 4 Each 'erase' overload removes the specified entries.
+        //:
+        //: 5 'reserve', 'shrinkToFit', 'capacity', and 'clear' behave as
+        //:   documented.
+        //
+        // Plan:
+        //: 1 Apply random insertions and removals to a tree and to a
+        //:   'bsl::set' oracle, comparing all lookups for every key after
+        //:   each operation.  (C-1..4)
+        //:
+        //: 2 Exercise the capacity methods directly.  (C-5)
+        //
+        // Testing:
+        //   FlatTree(const COMPARATOR& comparator, bslma::Allocator *bA = 0);
+        //   void clear();
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   bsl::size_t erase(const KEY& key);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, iterator> equalRange(const KEY& key);
+        //   iterator lowerBound(const KEY& key);
+        //   iterator upperBound(const KEY& key);
+        //   pair<iterator, bool> insertUnique(const ENTRY& entry);
+        //   pair<iterator, bool> insertUnique(MovableRef<ENTRY> entry);
+        //   void reserve(bsl::size_t numEntries);
+        //   void shrinkToFit();
+        //   iterator begin();
+        //   iterator end();
+        //   bsl::size_t capacity() const;
+        //   const COMPARATOR& comparator() const;
+        //   bool contains(const KEY& key) const;
+        //   bsl::size_t count(const KEY& key) const;
+        //   bool empty() const;
+        //   pair<const_iterator, const_iterator> equalRange(const KEY&) const;
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator lowerBound(const KEY& key) const;
+        //   bsl::size_t size() const;
+        //   const_iterator upperBound(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bslma::Allocator *allocator() const;
+        //   const KEY& key(const KEY& entry);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                      << "UNIQUE INSERTION, LOOKUP, AND REMOVAL" << endl
+                      << "=====================================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        {
+            Obj mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0 == X.capacity());
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.comparator()(1, 2));
+            ASSERT(0 == oa.numBlocksTotal());
+            ASSERT(X.end() == X.find(0));
+            ASSERT(X.end() == X.lowerBound(0));
+            ASSERT(X.end() == X.upperBound(0));
+            ASSERT(0 == X.count(0));
+        }
+
+        {
+            Obj           mX(bsl::less<int>(), &oa);  const Obj& X = mX;
+            bsl::set<int> oracle(&sa);
+
+            unsigned int state = 3;
+            for (int i = 0; i < 2000; ++i) {
+                state = state * 1103515245 + 12345;
+                const int key = 2 * static_cast<int>((state >> 16) % 60);
+
+                switch ((state >> 8) % 5) {
+                  case 0: {
+                    ASSERTV(i, oracle.erase(key) == mX.erase(key));
+                  } break;
+                  case 1: {
+                    Obj::iterator it = mX.find(key);
+                    if (it != mX.end()) {
+                        Obj::iterator next = mX.erase(it);
+                        oracle.erase(key);
+                        ASSERTV(i, next == mX.upperBound(key));
+                    }
+                  } break;
+                  default: {
+                    const bool EXP = oracle.insert(key).second;
+                    bsl::pair<Obj::iterator, bool> rv;
+                    if (i & 1) {
+                        rv = mX.insertUnique(key);
+                    }
+                    else {
+                        int entry = key;
+                        rv = mX.insertUnique(MoveUtil::move(entry));
+                    }
+                    ASSERTV(i, key, EXP == rv.second);
+                    ASSERTV(i, key, key == *rv.first);
+                  } break;
+                }
+
+                if (0 == i % 50) {
+                    ASSERTV(i, verify(X, oracle));
+
+                    // Probe odd keys (always absent) and even keys, including
+                    // keys beyond both ends.
+
+                    for (int k = -3; k < 124; ++k) {
+                        const bool PRESENT = oracle.count(k) != 0;
+
+                        ASSERTV(i, k, PRESENT == X.contains(k));
+                        ASSERTV(i, k, PRESENT == (1 == X.count(k)));
+                        ASSERTV(i, k, PRESENT == (X.end() != X.find(k)));
+                        ASSERTV(i, k, PRESENT == (mX.end() != mX.find(k)));
+
+                        bsl::set<int>::const_iterator lb =
+                                                      oracle.lower_bound(k);
+                        bsl::set<int>::const_iterator ub =
+                                                      oracle.upper_bound(k);
+
+                        const bsl::size_t LB = static_cast<bsl::size_t>(
+                                        bsl::distance(oracle.begin(), lb));
+                        const bsl::size_t UB = static_cast<bsl::size_t>(
+                                        bsl::distance(oracle.begin(), ub));
+
+                        ASSERTV(i, k, X.begin() + LB == X.lowerBound(k));
+                        ASSERTV(i, k, X.begin() + UB == X.upperBound(k));
+                        ASSERTV(i, k, mX.begin() + LB == mX.lowerBound(k));
+                        ASSERTV(i, k, mX.begin() + UB == mX.upperBound(k));
+                        ASSERTV(i, k, X.begin() + LB == X.equalRange(k).first);
+                        ASSERTV(i, k,
+                                mX.begin() + UB == mX.equalRange(k).second);
+                    }
+                }
+            }
+            ASSERT(verify(X, oracle));
+
+            if (verbose) cout << "\tRange erase and capacity." << endl;
+
+            const bsl::size_t SIZE = X.size();
+            ASSERT(SIZE > 10);
+
+            Obj::iterator it = mX.erase(X.begin() + 2, X.begin() + 7);
+            ASSERT(SIZE - 5 == X.size());
+            ASSERT(X.begin() + 2 == it);
+
+            mX.reserve(500);
+            ASSERT(500 <= X.capacity());
+
+            mX.shrinkToFit();
+            ASSERT(X.size() == X.capacity());
+
+            mX.clear();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a tree, insert, look up, and erase a few entries.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        PairObj mX(bsl::less<int>(), &oa);  const PairObj& X = mX;
+
+        ASSERT(mX.insertUnique(IntPair(3, 30)).second);
+        ASSERT(mX.insertUnique(IntPair(1, 10)).second);
+        ASSERT(mX.insertUnique(IntPair(2, 20)).second);
+        ASSERT(!mX.insertUnique(IntPair(2, 21)).second);
+
+        ASSERT(3  == X.size());
+        ASSERT(1  == X.begin()->first);
+        ASSERT(20 == X.find(2)->second);
+        ASSERT(X.end() == X.find(4));
+
+        ASSERT(1 == mX.erase(2));
+        ASSERT(!X.contains(2));
+
+        PairObj mY(X, &oa);
+        ASSERT(X == mY);
+
+        mY.insertMulti(IntPair(3, 31));
+        ASSERT(X != mY);
+        ASSERT(2 == mY.count(3));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
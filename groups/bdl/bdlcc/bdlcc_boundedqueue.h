@@ -28,6 +28,19 @@ BSLS_IDENT("$Id: $")
 // value, if the queue is full.  The 'tryPopFront' method fails immediately,
 // returning a non-zero value, if the queue is empty.
 //
+// The queue also provides batch methods, 'pushBackBatch' and 'popFrontBatch',
+// and their non-blocking counterparts, 'tryPushBackBatch' and
+// 'tryPopFrontBatch', that move several elements per call.  A batch method
+// reserves as many elements of the queue as are available, up to the number
+// requested, with a single operation on a semaphore, and makes the elements it
+// pushes available to consumers (or the elements it pops available to
+// producers) with a single post of a semaphore.  A batch push additionally
+// claims the positions of all of its elements with a single atomic operation;
+// a batch pop claims the position of each element it pops separately, so that
+// an exception thrown while popping an element leaves the remaining elements
+// in the queue.  The cost of synchronization is thereby amortized over the
+// elements of the batch.  See {Example 2: Pushing Bursts of Values}.
+//
 // The queue may be placed into a "enqueue disabled" state using the
 // 'disablePushBack' method.  When disabled, 'pushBack' and 'tryPushBack' fail
 // immediately and return an error code.  Any threads blocked in 'pushBack'
@@ -175,6 +188,52 @@ BSLS_IDENT("$Id: $")
 //      consumerThreads.joinAll();
 //  }
 //..
+//
+///Example 2: Pushing Bursts of Values
+///- - - - - - - - - - - - - - - - - -
+// In the following example a producer receives values in bursts, and a
+// consumer processes them in batches, using the batch methods of
+// 'bdlcc::BoundedQueue' to synchronize once per batch rather than once per
+// value.
+//
+// First, we create a queue and push a burst of values with a single call:
+//..
+//  bdlcc::BoundedQueue<int> queue(64);
+//
+//  int burst[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+//
+//  bsl::size_t numPushed;
+//  int         rc = queue.pushBackBatch(&numPushed, burst, 10);
+//  assert(0  == rc);
+//  assert(10 == numPushed);
+//..
+// Then, we pop up to 4 values, which are available, so that the call does not
+// block:
+//..
+//  int         values[4];
+//  bsl::size_t numPopped;
+//
+//  rc = queue.popFrontBatch(&numPopped, values, 4);
+//  assert(0 == rc);
+//  assert(4 == numPopped);
+//  assert(0 == values[0]);
+//  assert(3 == values[3]);
+//..
+// Finally, we pop the remaining values without blocking.  Fewer values than
+// requested are popped, and a subsequent attempt fails because the queue is
+// empty:
+//..
+//  int rest[16];
+//
+//  rc = queue.tryPopFrontBatch(&numPopped, rest, 16);
+//  assert(0 == rc);
+//  assert(6 == numPopped);
+//  assert(9 == rest[5]);
+//
+//  rc = queue.tryPopFrontBatch(&numPopped, rest, 16);
+//  assert(bdlcc::BoundedQueue<int>::e_EMPTY == rc);
+//  assert(0 == numPopped);
+//..
 
 #include <bdlscm_version.h>
 
@@ -198,6 +257,9 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstddef.h>
 #include <bsl_cstdint.h>
 
 namespace BloombergLP {
@@ -272,6 +334,97 @@ class BoundedQueue_PushExceptionCompleteProctor {
         // If no queue is currently managed, this method has no effect.
 };
 
+                    // ==================================
+                    // class BoundedQueue_PopBatchProctor
+                    // ==================================
+
+template <class TYPE>
+class BoundedQueue_PopBatchProctor {
+    // This class implements a proctor that, upon destruction, invokes
+    // 'TYPE::popBatchExceptionComplete' with the number of elements reserved
+    // by a batch "pop" operation that have not been popped.
+
+    // DATA
+    TYPE        *d_queue_p;       // managed queue
+
+    bsl::size_t  d_numRemaining;  // number of reserved elements not yet
+                                  // popped
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PopBatchProctor();
+    BoundedQueue_PopBatchProctor(const BoundedQueue_PopBatchProctor&);
+    BoundedQueue_PopBatchProctor& operator=(
+                                          const BoundedQueue_PopBatchProctor&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PopBatchProctor(TYPE *queue, bsl::size_t numReserved);
+        // Create a proctor managing the specified 'numReserved' elements
+        // reserved by a batch "pop" operation on the specified 'queue'.
+
+    ~BoundedQueue_PopBatchProctor();
+        // Destroy this object and, if any of the managed elements have not
+        // been popped, invoke the managed queue's 'popBatchExceptionComplete'
+        // method with their number.
+
+    // MANIPULATORS
+    void advance();
+        // Release from management the next of the reserved elements, which is
+        // being popped.  The behavior is undefined unless an element remains
+        // under management.
+};
+
+                    // ===================================
+                    // class BoundedQueue_PushBatchProctor
+                    // ===================================
+
+template <class TYPE>
+class BoundedQueue_PushBatchProctor {
+    // This class implements a proctor that invokes
+    // 'TYPE::pushBatchExceptionComplete' upon destruction unless 'release' has
+    // been called.
+
+    // DATA
+    TYPE                *d_queue_p;       // managed queue
+
+    bsls::Types::Uint64  d_index;         // index of the next element to be
+                                          // pushed
+
+    bsl::size_t          d_numPushed;     // number of elements pushed
+
+    bsl::size_t          d_numRemaining;  // number of reserved elements not
+                                          // yet pushed
+
+    // NOT IMPLEMENTED
+    BoundedQueue_PushBatchProctor();
+    BoundedQueue_PushBatchProctor(const BoundedQueue_PushBatchProctor&);
+    BoundedQueue_PushBatchProctor& operator=(
+                                         const BoundedQueue_PushBatchProctor&);
+
+  public:
+    // CREATORS
+    BoundedQueue_PushBatchProctor(TYPE                *queue,
+                                  bsls::Types::Uint64  index,
+                                  bsl::size_t          numReserved);
+        // Create a proctor managing the specified 'numReserved' elements,
+        // starting at the specified 'index', reserved by a batch "push"
+        // operation on the specified 'queue'.
+
+    ~BoundedQueue_PushBatchProctor();
+        // Destroy this object and, if 'release' has not been invoked, invoke
+        // the managed queue's 'pushBatchExceptionComplete' method with the
+        // index of the first element not pushed, and the numbers of elements
+        // pushed and not pushed.
+
+    // MANIPULATORS
+    void advance();
+        // Record that the next of the reserved elements has been pushed.  The
+        // behavior is undefined unless an element remains under management.
+
+    void release();
+        // Release from management the queue currently managed by this proctor.
+};
+
                          // ========================
                          // struct BoundedQueue_Node
                          // ========================
@@ -404,6 +557,10 @@ class BoundedQueue {
     friend class BoundedQueue_PushExceptionCompleteProctor<
                                                           BoundedQueue<TYPE> >;
 
+    friend class BoundedQueue_PopBatchProctor<BoundedQueue<TYPE> >;
+
+    friend class BoundedQueue_PushBatchProctor<BoundedQueue<TYPE> >;
+
     // PRIVATE CLASS METHODS
     static bool isQuiescentState(bsls::Types::Uint64 count);
         // Return 'true' if the specified 'count' implies a quiescent state
@@ -417,18 +574,50 @@ class BoundedQueue {
         // by a guard to complete the reclamation of a node in the presence of
         // an exception.
 
+    void popBatchExceptionComplete(bsl::size_t numRemaining);
+        // Remove the indicators for the specified 'numRemaining' started
+        // "pop" operations, 'post' to the 'd_pushSemaphore' if appropriate,
+        // and return the 'numRemaining' elements reserved for those
+        // operations to the 'd_popSemaphore'.  This method is used within
+        // 'popFrontBatchHelper' by a proctor to release the elements of a
+        // batch that were not popped in the presence of an exception.
+
+    void popFrontBatchHelper(TYPE *values, bsl::size_t numValues);
+        // Remove the specified 'numValues' elements from the front of this
+        // queue and load them, in order, into the array starting at the
+        // specified 'values'.  This method is invoked by 'popFrontBatch' and
+        // 'tryPopFrontBatch' once 'numValues' elements are reserved.
+
     void popFrontHelper(TYPE *value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  This method is invoked by
         // 'popFront' and 'tryPopFront' once an element is available.
 
-    void pushComplete();
-        // Mark a "push" operation as complete, and 'post' to the
-        // 'd_popSemaphore' if appropriate.
-
-    void pushExceptionComplete();
-        // Remove the indicator for a started push operation, and 'post' to the
-        // 'd_popSemaphore' if appropriate.  This method is used within
+    void pushBackBatchHelper(const TYPE *values, bsl::size_t numValues);
+        // Append the specified 'numValues' values in the array starting at
+        // the specified 'values', in order, to the back of this queue.  This
+        // method is invoked by 'pushBackBatch' and 'tryPushBackBatch' once
+        // 'numValues' elements are reserved.
+
+    void pushBatchExceptionComplete(bsls::Types::Uint64 index,
+                                    bsl::size_t         numPushed,
+                                    bsl::size_t         numRemaining);
+        // Mark the specified 'numRemaining' nodes starting at the specified
+        // 'index' to reclaim, mark the specified 'numPushed' "push" operations
+        // as complete, remove the indicators for the 'numRemaining' started
+        // "push" operations, and 'post' to the 'd_popSemaphore' if
+        // appropriate.  This method is used within 'pushBackBatchHelper' by a
+        // proctor to complete a batch in the presence of an exception.
+
+    void pushComplete(bsl::size_t numPushed = 1);
+        // Mark a "push" operation, or optionally the specified 'numPushed'
+        // "push" operations, as complete, and 'post' to the 'd_popSemaphore'
+        // if appropriate.
+
+    void pushExceptionComplete(bsl::size_t numRemoved = 1);
+        // Remove the indicator for a started push operation, or optionally
+        // for the specified 'numRemoved' started push operations, and 'post'
+        // to the 'd_popSemaphore' if appropriate.  This method is used within
         // 'pushFront' by a proctor to complete the marking of a node to
         // reclaim in the presence of an exception.
 
@@ -474,6 +663,24 @@ class BoundedQueue {
         // the queue being empty will return 'e_DISABLED' if 'disablePopFront'
         // is invoked.
 
+    int popFrontBatch(bsl::size_t *numPopped,
+                      TYPE        *values,
+                      bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into
+        // the specified 'numPopped'.  If the queue is empty, block until it
+        // is not empty; then remove, without blocking, as many of the
+        // elements in the queue as 'maxNumValues' allows.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' on success, 'e_DISABLED' if 'isPopFrontDisabled()' and
+        // 'e_FAILED' if an error occurs.  On failure, '*numPopped' is 0 and
+        // 'values' is not changed.  Threads blocked due to the queue being
+        // empty will return 'e_DISABLED' if 'disablePopFront' is invoked.  If
+        // 'maxNumValues' is 0, return 'e_SUCCESS' without blocking.  The
+        // behavior is undefined unless 'values' refers to an array of at
+        // least 'maxNumValues' elements.
+
     int pushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  If the
         // queue is full, block until it is not full.  Return 0 on success, and
@@ -492,6 +699,24 @@ class BoundedQueue {
         // due to the queue being full will return 'e_DISABLED' if
         // 'disablePushBack' is invoked.
 
+    int pushBackBatch(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' values in the array starting at
+        // the specified 'values', in order, to the back of this queue, and
+        // load the number of values appended into the specified 'numPushed'.
+        // If the queue is full, block until it is not full, repeatedly, until
+        // all of the values are appended; the values are appended in as few
+        // batches as the available capacity allows.  Return 0 on success, and
+        // a non-zero value otherwise.  Specifically, return 'e_SUCCESS' on
+        // success (in which case '*numPushed' is 'numValues'), 'e_DISABLED' if
+        // 'isPushBackDisabled()' and 'e_FAILED' if an error occurs.  On
+        // failure, the first '*numPushed' values have been appended.  Threads
+        // blocked due to the queue being full will return 'e_DISABLED' if
+        // 'disablePushBack' is invoked.  Note that the values of a batch are
+        // contiguous in the queue, but values pushed concurrently by other
+        // threads may be interleaved between batches.
+
     void removeAll();
         // Remove all items currently in this queue.  Note that this operation
         // is not atomic; if other threads are concurrently pushing items into
@@ -507,6 +732,21 @@ class BoundedQueue {
         // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
         // an error occurs.  On failure, 'value' is not changed.
 
+    int tryPopFrontBatch(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues);
+        // Attempt to remove up to the specified 'maxNumValues' elements from
+        // the front of this queue without blocking, load them, in order, into
+        // the array starting at the specified 'values', and load the number
+        // of elements removed into the specified 'numPopped'.  Return 0 on
+        // success, and a non-zero value otherwise.  Specifically, return
+        // 'e_SUCCESS' if at least one element was removed (or 'maxNumValues'
+        // is 0), 'e_DISABLED' if 'isPopFrontDisabled()', 'e_EMPTY' if
+        // '!isPopFrontDisabled()' and the queue was empty, and 'e_FAILED' if
+        // an error occurs.  On failure, '*numPopped' is 0 and 'values' is not
+        // changed.  The behavior is undefined unless 'values' refers to an
+        // array of at least 'maxNumValues' elements.
+
     int tryPushBack(const TYPE& value);
         // Append the specified 'value' to the back of this queue.  Return 0 on
         // success, and a non-zero value otherwise.  Specifically, return
@@ -522,6 +762,19 @@ class BoundedQueue {
         // 'e_FULL' if '!isPushBackDisabled()' and the queue was full, and
         // 'e_FAILED' if an error occurs.  On failure, 'value' is not changed.
 
+    int tryPushBackBatch(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Append, without blocking, as many as the available capacity allows
+        // of the specified 'numValues' values in the array starting at the
+        // specified 'values', in order, to the back of this queue, and load
+        // the number of values appended into the specified 'numPushed'.
+        // Return 0 on success, and a non-zero value otherwise.  Specifically,
+        // return 'e_SUCCESS' if at least one value was appended (or
+        // 'numValues' is 0), 'e_DISABLED' if 'isPushBackDisabled()', 'e_FULL'
+        // if '!isPushBackDisabled()' and the queue was full, and 'e_FAILED' if
+        // an error occurs.  On failure, '*numPushed' is 0.
+
                        // Enqueue/Dequeue State
 
     void disablePopFront();
@@ -637,6 +890,88 @@ BoundedQueue_PushExceptionCompleteProctor<TYPE>::
 template <class TYPE>
 inline
 void BoundedQueue_PushExceptionCompleteProctor<TYPE>::release()
+{
+    d_queue_p = 0;
+}
+
+                    // ----------------------------------
+                    // class BoundedQueue_PopBatchProctor
+                    // ----------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PopBatchProctor<TYPE>::BoundedQueue_PopBatchProctor(
+                                                      TYPE        *queue,
+                                                      bsl::size_t  numReserved)
+: d_queue_p(queue)
+, d_numRemaining(numReserved)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PopBatchProctor<TYPE>::~BoundedQueue_PopBatchProctor()
+{
+    if (0 != d_numRemaining) {
+        d_queue_p->popBatchExceptionComplete(d_numRemaining);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PopBatchProctor<TYPE>::advance()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    --d_numRemaining;
+}
+
+                    // -----------------------------------
+                    // class BoundedQueue_PushBatchProctor
+                    // -----------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue_PushBatchProctor<TYPE>::BoundedQueue_PushBatchProctor(
+                                              TYPE                *queue,
+                                              bsls::Types::Uint64  index,
+                                              bsl::size_t          numReserved)
+: d_queue_p(queue)
+, d_index(index)
+, d_numPushed(0)
+, d_numRemaining(numReserved)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue_PushBatchProctor<TYPE>::~BoundedQueue_PushBatchProctor()
+{
+    if (d_queue_p) {
+        d_queue_p->pushBatchExceptionComplete(d_index,
+                                              d_numPushed,
+                                              d_numRemaining);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue_PushBatchProctor<TYPE>::advance()
+{
+    BSLS_ASSERT(0 < d_numRemaining);
+
+    ++d_index;
+    ++d_numPushed;
+    --d_numRemaining;
+}
+
+template <class TYPE>
+inline
+void BoundedQueue_PushBatchProctor<TYPE>::release()
 {
     d_queue_p = 0;
 }
@@ -716,6 +1051,85 @@ void BoundedQueue<TYPE>::popComplete(Node *node, bool isEmpty)
     }
 }
 
+template <class TYPE>
+void BoundedQueue<TYPE>::popBatchExceptionComplete(bsl::size_t numRemaining)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(
+                                              &d_popCount,
+                                              -(k_STARTED_INC * numRemaining));
+
+    int numToPost = static_cast<int>(count & k_STARTED_MASK);
+
+    if (0 != numToPost && isQuiescentState(count)) {
+
+        // The total number of popped elements is 'count & k_STARTED_MASK'.
+        // Attempt, once, to zero the count and, if successful, post to the
+        // push semaphore.
+
+        if (AtomicOp::testAndSwapUint64AcqRel(&d_popCount,
+                                              count,
+                                              0) == count) {
+            d_pushSemaphore.post(numToPost);
+        }
+    }
+
+    // The remaining elements were never dequeued, so they are available to
+    // be popped again.
+
+    d_popSemaphore.post(static_cast<int>(numRemaining));
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popFrontBatchHelper(TYPE        *values,
+                                             bsl::size_t  numValues)
+{
+    bool empty = isEmpty();
+
+    // Start all of the "pop" operations of the batch at once, so that the
+    // quiescent state is not reached (and 'd_pushSemaphore' is not posted)
+    // until the last of them completes.
+
+    AtomicOp::addUint64AcqRel(&d_popCount, k_STARTED_INC * numValues);
+
+    BoundedQueue_PopBatchProctor<BoundedQueue<TYPE> > proctor(this,
+                                                              numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i) {
+        // 'd_popIndex' stores the next location to use (want the original
+        // value).  Note that the positions are claimed one at a time, rather
+        // than all at once as in 'pushBackBatchHelper', since the elements
+        // of the batch that are not popped due to an exception are returned
+        // to 'd_popSemaphore' for other consumers, which must find them at
+        // the positions that follow 'd_popIndex'.
+
+        Uint64  index = (AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1)
+                                                                  % d_capacity;
+        Node   *node  = &d_element_p[index];
+
+        // Nodes marked for reclamation are skipped as in 'popFrontHelper'.
+
+        while (node->reclaim()) {
+            AtomicOp::addUint64AcqRel(&d_popCount,
+                                      k_STARTED_INC + k_FINISHED_INC);
+
+            index = (AtomicOp::addUint64NvAcqRel(&d_popIndex, 1) - 1)
+                                                                  % d_capacity;
+            node  = &d_element_p[index];
+        }
+
+        proctor.advance();
+
+        BoundedQueue_PopCompleteGuard<BoundedQueue<TYPE>, Node>
+                                guard(this, node, empty && i + 1 == numValues);
+
+#if defined(BSLMF_MOVABLEREF_USES_RVALUE_REFERENCES)
+        values[i] = bslmf::MovableRefUtil::move(node->d_value.object());
+#else
+        values[i] = node->d_value.object();
+#endif
+    }
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 {
@@ -754,9 +1168,64 @@ void BoundedQueue<TYPE>::popFrontHelper(TYPE *value)
 }
 
 template <class TYPE>
-void BoundedQueue<TYPE>::pushComplete()
+void BoundedQueue<TYPE>::pushBackBatchHelper(const TYPE  *values,
+                                             bsl::size_t  numValues)
+{
+    AtomicOp::addUint64AcqRel(&d_pushCount, k_STARTED_INC * numValues);
+
+    // 'd_pushIndex' stores the next location to use (want the original value)
+
+    Uint64 index = AtomicOp::addUint64NvAcqRel(&d_pushIndex, numValues)
+                                                                   - numValues;
+
+    BoundedQueue_PushBatchProctor<BoundedQueue<TYPE> > proctor(this,
+                                                               index,
+                                                               numValues);
+
+    for (bsl::size_t i = 0; i < numValues; ++i, ++index) {
+        Node& node = d_element_p[index % d_capacity];
+
+        node.assignReclaim(true);
+
+        bslalg::ScalarPrimitives::copyConstruct(node.d_value.address(),
+                                                values[i],
+                                                d_allocator_p);
+
+        node.assignReclaim(false);
+
+        proctor.advance();
+    }
+
+    proctor.release();
+
+    pushComplete(numValues);
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushBatchExceptionComplete(
+                                              bsls::Types::Uint64 index,
+                                              bsl::size_t         numPushed,
+                                              bsl::size_t         numRemaining)
 {
-    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_pushCount, k_FINISHED_INC);
+    // The nodes that were not pushed are skipped by "pop" operations, which
+    // return them to 'd_pushSemaphore'.
+
+    for (bsl::size_t i = 0; i < numRemaining; ++i, ++index) {
+        d_element_p[index % d_capacity].assignReclaim(true);
+    }
+
+    if (0 != numPushed) {
+        pushComplete(numPushed);
+    }
+
+    pushExceptionComplete(numRemaining);
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::pushComplete(bsl::size_t numPushed)
+{
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_pushCount,
+                                               k_FINISHED_INC * numPushed);
     if (isQuiescentState(count)) {
 
         // The total number of pushed elements is 'count & k_STARTED_MASK'.
@@ -772,9 +1241,10 @@ void BoundedQueue<TYPE>::pushComplete()
 }
 
 template <class TYPE>
-void BoundedQueue<TYPE>::pushExceptionComplete()
+void BoundedQueue<TYPE>::pushExceptionComplete(bsl::size_t numRemoved)
 {
-    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_pushCount, -k_STARTED_INC);
+    Uint64 count = AtomicOp::addUint64NvAcqRel(&d_pushCount,
+                                               -(k_STARTED_INC * numRemoved));
 
     int numToPost = static_cast<int>(count & k_STARTED_MASK);
 
@@ -849,6 +1319,39 @@ int BoundedQueue<TYPE>::popFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::popFrontBatch(bsl::size_t *numPopped,
+                                      TYPE        *values,
+                                      bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values || 0 == maxNumValues);
+
+    *numPopped = 0;
+
+    if (0 == maxNumValues) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int rv = d_popSemaphore.wait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    const bsl::size_t numValues = 1 + d_popSemaphore.take(
+                   static_cast<int>(bsl::min<bsl::size_t>(maxNumValues - 1,
+                                                          INT_MAX)));
+
+    popFrontBatchHelper(values, numValues);
+
+    *numPopped = numValues;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::pushBack(const TYPE& value)
 {
@@ -922,6 +1425,38 @@ int BoundedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBackBatch(bsl::size_t *numPushed,
+                                      const TYPE  *values,
+                                      bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    while (*numPushed < numValues) {
+        int rv = d_pushSemaphore.wait();
+        if (rv) {
+            if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+                return e_DISABLED;                                    // RETURN
+            }
+            return e_FAILED;                                          // RETURN
+        }
+
+        const bsl::size_t numRemaining = numValues - *numPushed;
+        const bsl::size_t numReserved  = 1 + d_pushSemaphore.take(
+                   static_cast<int>(bsl::min<bsl::size_t>(numRemaining - 1,
+                                                          INT_MAX)));
+
+        pushBackBatchHelper(values + *numPushed, numReserved);
+
+        *numPushed += numReserved;
+    }
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 void BoundedQueue<TYPE>::removeAll()
 {
@@ -980,6 +1515,42 @@ int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
     return e_SUCCESS;
 }
 
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFrontBatch(bsl::size_t *numPopped,
+                                         TYPE        *values,
+                                         bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(numPopped);
+    BSLS_ASSERT(values || 0 == maxNumValues);
+
+    *numPopped = 0;
+
+    if (0 == maxNumValues) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int rv = d_popSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_EMPTY;                                           // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    const bsl::size_t numValues = 1 + d_popSemaphore.take(
+                   static_cast<int>(bsl::min<bsl::size_t>(maxNumValues - 1,
+                                                          INT_MAX)));
+
+    popFrontBatchHelper(values, numValues);
+
+    *numPopped = numValues;
+
+    return e_SUCCESS;
+}
+
 template <class TYPE>
 int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
 {
@@ -1056,6 +1627,42 @@ int BoundedQueue<TYPE>::tryPushBack(bslmf::MovableRef<TYPE> value)
 
     pushComplete();
 
+    return e_SUCCESS;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBackBatch(bsl::size_t *numPushed,
+                                         const TYPE  *values,
+                                         bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+    BSLS_ASSERT(values || 0 == numValues);
+
+    *numPushed = 0;
+
+    if (0 == numValues) {
+        return e_SUCCESS;                                             // RETURN
+    }
+
+    int rv = d_pushSemaphore.tryWait();
+    if (rv) {
+        if (bslmt::FastPostSemaphore::e_DISABLED == rv) {
+            return e_DISABLED;                                        // RETURN
+        }
+        if (bslmt::FastPostSemaphore::e_WOULD_BLOCK == rv) {
+            return e_FULL;                                            // RETURN
+        }
+        return e_FAILED;                                              // RETURN
+    }
+
+    const bsl::size_t numReserved = 1 + d_pushSemaphore.take(
+                      static_cast<int>(bsl::min<bsl::size_t>(numValues - 1,
+                                                             INT_MAX)));
+
+    pushBackBatchHelper(values, numReserved);
+
+    *numPushed = numReserved;
+
     return e_SUCCESS;
 }
 
@@ -79,12 +79,16 @@ using namespace bsl;
 // [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator bA = 0);
 // [ 2] ~BoundedQueue();
 // [ 2] int popFront(TYPE *value);
+// [12] int popFrontBatch(size_t *numPopped, TYPE *values, size_t max);
 // [ 2] int pushBack(const TYPE& value);
 // [ 9] int pushBack(bslmf::MovableRef<TYPE> value);
+// [12] int pushBackBatch(size_t *numPushed, const TYPE *v, size_t n);
 // [ 2] void removeAll();
 // [ 7] int tryPopFront(TYPE *value);
+// [12] int tryPopFrontBatch(size_t *numPopped, TYPE *values, size_t max);
 // [ 6] int tryPushBack(const TYPE& value);
 // [ 9] int tryPushBack(bslmf::MovableRef<TYPE> value);
+// [12] int tryPushBackBatch(size_t *numPushed, const TYPE *v, size_t n);
 // [ 5] void disablePopFront();
 // [ 5] void disablePushBack();
 // [ 5] void enablePopFront();
@@ -98,7 +102,7 @@ using namespace bsl;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -106,6 +110,7 @@ using namespace bsl;
 // [ 9] CONCERN: 'popFront' and 'tryPopFront' honor move-semantics
 // [10] CONCERN: template requirements
 // [11] CONCERN: ordering guarantee
+// [12] CONCERN: batch methods are thread-safe and exception neutral
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -735,6 +740,67 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
     bslmt::ThreadUtil::join(watchdogHandle);
 }
 
+// ============================================================================
+//                      HELPER FUNCTIONS FOR BATCH TEST
+// ----------------------------------------------------------------------------
+
+void batchProducer(Obj *queue, int id, int numValues, int batchSize)
+    // Push to the specified 'queue' the specified 'numValues' values from
+    // 'id * numValues' to 'id * numValues + numValues - 1', in order, in
+    // batches of the specified 'batchSize' values, where 'id' is the
+    // specified 'id'.  The behavior is undefined unless
+    // '0 < batchSize <= 64'.
+{
+    int batch[64];
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        const int n = numValues - i < batchSize ? numValues - i : batchSize;
+        for (int j = 0; j < n; ++j) {
+            batch[j] = id * numValues + i + j;
+        }
+
+        bsl::size_t numPushed;
+        int         rv = queue->pushBackBatch(&numPushed, batch, n);
+
+        ASSERTV(rv, e_SUCCESS == rv);
+        ASSERTV(numPushed, n == static_cast<int>(numPushed));
+    }
+}
+
+void batchConsumer(Obj               *queue,
+                   int                numValuesPerProducer,
+                   bsls::AtomicInt64 *sum,
+                   bsls::AtomicInt   *count)
+    // Pop values from the specified 'queue', in batches of up to 16 values,
+    // until popping is disabled, and add them to the specified 'sum' and
+    // their number to the specified 'count'.  Verify that the values of each
+    // batch pushed by the same producer, which pushes values in blocks of the
+    // specified 'numValuesPerProducer', are in increasing order.
+{
+    int values[16];
+
+    for (;;) {
+        bsl::size_t numPopped;
+        int         rv = queue->popFrontBatch(&numPopped, values, 16);
+        if (e_DISABLED == rv) {
+            break;
+        }
+        ASSERTV(rv, e_SUCCESS == rv);
+        ASSERTV(numPopped, 0 < numPopped && numPopped <= 16);
+
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            *sum += values[i];
+            for (bsl::size_t j = 0; j < i; ++j) {
+                if (values[j] / numValuesPerProducer ==
+                                        values[i] / numValuesPerProducer) {
+                    ASSERTV(values[j], values[i], values[j] < values[i]);
+                }
+            }
+        }
+        *count += static_cast<int>(numPopped);
+    }
+}
+
 // ============================================================================
 //               GENERATOR FUNCTIONS 'gg' AND 'ggg' FOR TESTING
 // ----------------------------------------------------------------------------
@@ -955,7 +1021,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -992,6 +1058,347 @@ int main(int argc, char *argv[])
         s_continue = 0;
 
         bslmt::ThreadUtil::join(watchdogHandle);
+
+        {
+            ///Example 2: Pushing Bursts of Values
+            ///- - - - - - - - - - - - - - - - - -
+
+            bdlcc::BoundedQueue<int> queue(64);
+
+            int burst[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+            bsl::size_t numPushed;
+            int         rc = queue.pushBackBatch(&numPushed, burst, 10);
+            ASSERT(0  == rc);
+            ASSERT(10 == numPushed);
+
+            int         values[4];
+            bsl::size_t numPopped;
+
+            rc = queue.popFrontBatch(&numPopped, values, 4);
+            ASSERT(0 == rc);
+            ASSERT(4 == numPopped);
+            ASSERT(0 == values[0]);
+            ASSERT(3 == values[3]);
+
+            int rest[16];
+
+            rc = queue.tryPopFrontBatch(&numPopped, rest, 16);
+            ASSERT(0 == rc);
+            ASSERT(6 == numPopped);
+            ASSERT(9 == rest[5]);
+
+            rc = queue.tryPopFrontBatch(&numPopped, rest, 16);
+            ASSERT(bdlcc::BoundedQueue<int>::e_EMPTY == rc);
+            ASSERT(0 == numPopped);
+        }
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH METHODS
+        //   Ensure the batch manipulators function as expected.
+        //
+        // Concerns:
+        //: 1 'pushBackBatch' appends all of the values, in order, blocking
+        //:   while the queue is full, and 'tryPushBackBatch' appends as many
+        //:   as the available capacity allows without blocking.
+        //:
+        //: 2 'popFrontBatch' blocks only until an element is available, and
+        //:   then removes, in order, as many elements as are available up to
+        //:   the maximum; 'tryPopFrontBatch' does not block.
+        //:
+        //: 3 The methods return the documented values when the queue is full,
+        //:   empty, or disabled, and when the number of values is 0.
+        //:
+        //: 4 Batches wrap around the end of the queue correctly.
+        //:
+        //: 5 If the copy of a value throws while pushing a batch, the values
+        //:   already copied remain in the queue and the capacity of the queue
+        //:   is eventually restored.
+        //:
+        //: 6 If the assignment of a value throws while popping a batch, the
+        //:   elements of the batch that were not popped remain in the queue.
+        //:
+        //: 7 The batch methods may be used concurrently by multiple producers
+        //:   and consumers without loss or duplication of values, and the
+        //:   values of a batch are in the order pushed.
+        //
+        // Plan:
+        //: 1 Using a queue of capacity 8, push and pop batches of various
+        //:   sizes, verifying the return values, the numbers of values
+        //:   pushed and popped, the values, and 'numElements'.  (C-1..4)
+        //:
+        //: 2 Using a queue of 'bsl::string', limit the allocations of the
+        //:   test allocator so that a copy (or assignment) in the middle of a
+        //:   batch throws, and verify the state of the queue.  (C-5..6)
+        //:
+        //: 3 Have 4 producers push batches of values to a small queue, and 3
+        //:   consumers pop batches from it; verify the number and sum of the
+        //:   values popped, and their order within each batch.  (C-7)
+        //
+        // Testing:
+        //   int popFrontBatch(size_t *numPopped, TYPE *values, size_t max);
+        //   int pushBackBatch(size_t *numPushed, const TYPE *v, size_t n);
+        //   int tryPopFrontBatch(size_t *numPopped, TYPE *values, size_t max);
+        //   int tryPushBackBatch(size_t *numPushed, const TYPE *v, size_t n);
+        //   CONCERN: batch methods are thread-safe and exception neutral
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH METHODS" << endl
+                          << "=====================" << endl;
+
+        if (verbose) cout << "\nBasic behavior." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj mX(8, &sa);  const Obj& X = mX;
+
+            const int   VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+            int         values[16];
+            bsl::size_t n;
+            int         rv;
+
+            rv = mX.pushBackBatch(&n, VALUES, 0);
+            ASSERT(e_SUCCESS == rv);  ASSERT(0 == n);
+
+            rv = mX.tryPushBackBatch(&n, VALUES, 0);
+            ASSERT(e_SUCCESS == rv);  ASSERT(0 == n);
+
+            rv = mX.popFrontBatch(&n, values, 0);
+            ASSERT(e_SUCCESS == rv);  ASSERT(0 == n);
+
+            rv = mX.tryPopFrontBatch(&n, values, 4);
+            ASSERT(e_EMPTY == rv);    ASSERT(0 == n);
+
+            rv = mX.pushBackBatch(&n, VALUES, 5);
+            ASSERT(e_SUCCESS == rv);  ASSERT(5 == n);
+            ASSERT(5 == X.numElements());
+
+            rv = mX.tryPushBackBatch(&n, VALUES + 5, 5);
+            ASSERT(e_SUCCESS == rv);  ASSERT(3 == n);
+            ASSERT(8 == X.numElements());
+            ASSERT(X.isFull());
+
+            rv = mX.tryPushBackBatch(&n, VALUES, 5);
+            ASSERT(e_FULL == rv);     ASSERT(0 == n);
+
+            rv = mX.popFrontBatch(&n, values, 3);
+            ASSERT(e_SUCCESS == rv);  ASSERT(3 == n);
+            ASSERT(0 == values[0]);
+            ASSERT(1 == values[1]);
+            ASSERT(2 == values[2]);
+            ASSERT(5 == X.numElements());
+
+            rv = mX.tryPopFrontBatch(&n, values, 16);
+            ASSERT(e_SUCCESS == rv);  ASSERT(5 == n);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, values[i], i + 3 == values[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            rv = mX.tryPopFrontBatch(&n, values, 16);
+            ASSERT(e_EMPTY == rv);    ASSERT(0 == n);
+
+            // Batches wrapping around the end of the queue.
+
+            for (int i = 0; i < 20; ++i) {
+                const bsl::size_t NUM = 1 + i % 8;
+
+                rv = mX.pushBackBatch(&n, VALUES + i % 3, NUM);
+                ASSERTV(i, e_SUCCESS == rv);  ASSERTV(i, NUM == n);
+
+                rv = mX.popFrontBatch(&n, values, 16);
+                ASSERTV(i, e_SUCCESS == rv);  ASSERTV(i, NUM == n);
+
+                for (bsl::size_t j = 0; j < NUM; ++j) {
+                    ASSERTV(i, j, VALUES[i % 3 + j] == values[j]);
+                }
+            }
+
+            // Disabled queue.
+
+            rv = mX.pushBackBatch(&n, VALUES, 2);
+            ASSERT(e_SUCCESS == rv);  ASSERT(2 == n);
+
+            mX.disablePushBack();
+
+            rv = mX.pushBackBatch(&n, VALUES, 2);
+            ASSERT(e_DISABLED == rv); ASSERT(0 == n);
+
+            rv = mX.tryPushBackBatch(&n, VALUES, 2);
+            ASSERT(e_DISABLED == rv); ASSERT(0 == n);
+
+            mX.disablePopFront();
+
+            rv = mX.popFrontBatch(&n, values, 2);
+            ASSERT(e_DISABLED == rv); ASSERT(0 == n);
+
+            rv = mX.tryPopFrontBatch(&n, values, 2);
+            ASSERT(e_DISABLED == rv); ASSERT(0 == n);
+
+            ASSERT(2 == X.numElements());
+        }
+
+        if (verbose) cout << "\nBlocking 'pushBackBatch'." << endl;
+        {
+            // A batch larger than the capacity of the queue is pushed while
+            // this thread pops.
+
+            Obj mX(8);
+
+            bslmt::ThreadGroup producer;
+            ASSERT(0 == producer.addThread(bdlf::BindUtil::bind(&batchProducer,
+                                                                &mX,
+                                                                0,
+                                                                60,
+                                                                60)));
+
+            int         values[16];
+            bsl::size_t n;
+            int         expected = 0;
+
+            while (expected < 60) {
+                int rv = mX.popFrontBatch(&n, values, 16);
+                ASSERTV(rv, e_SUCCESS == rv);
+
+                for (bsl::size_t i = 0; i < n; ++i) {
+                    ASSERTV(expected, values[i], expected == values[i]);
+                    ++expected;
+                }
+            }
+
+            producer.joinAll();
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) cout << "\nException neutrality." << endl;
+        {
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator va("values",   veryVeryVeryVerbose);
+
+            AllocObj mX(8, &sa);  const AllocObj& X = mX;
+
+            const char *LONG = "a string long enough to allocate memory";
+
+            bsl::vector<bsl::string> values(&va);
+            for (int i = 0; i < 5; ++i) {
+                values.push_back(bsl::string(LONG, &va));
+                values.back()[0] = static_cast<char>('0' + i);
+            }
+
+            // The third copy throws.
+
+            bsl::size_t n = 99;
+            int         numException = 0;
+
+            sa.setAllocationLimit(2);
+            try {
+                mX.pushBackBatch(&n, values.data(), 5);
+            } catch (const bslma::TestAllocatorException&) {
+                ++numException;
+            }
+            sa.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(2 == X.numElements());
+
+            // Three elements of the queue remain reserved until skipped by a
+            // pop.
+
+            int rv = mX.tryPushBackBatch(&n, values.data() + 2, 3);
+            ASSERT(e_SUCCESS == rv);  ASSERT(3 == n);
+            ASSERT(5 == X.numElements());
+
+            bsl::vector<bsl::string> popped(8, bsl::string(&va), &va);
+
+            rv = mX.popFrontBatch(&n, popped.data(), 8);
+            ASSERT(e_SUCCESS == rv);  ASSERT(5 == n);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, values[i] == popped[i]);
+            }
+            ASSERT(0 == X.numElements());
+
+            // The capacity is restored.
+
+            rv = mX.tryPushBackBatch(&n, values.data(), 5);
+            ASSERT(e_SUCCESS == rv);  ASSERT(5 == n);
+            rv = mX.tryPushBackBatch(&n, values.data(), 5);
+            ASSERT(e_SUCCESS == rv);  ASSERT(3 == n);
+            ASSERT(X.isFull());
+
+            mX.removeAll();
+
+            // The third assignment of a popped value throws (the values are
+            // copied, as the allocators differ).
+
+            rv = mX.pushBackBatch(&n, values.data(), 5);
+            ASSERT(e_SUCCESS == rv);  ASSERT(5 == n);
+
+            bsl::vector<bsl::string> shortValues(&va);
+            shortValues.resize(8);
+
+            numException = 0;
+
+            va.setAllocationLimit(2);
+            try {
+                mX.popFrontBatch(&n, shortValues.data(), 8);
+            } catch (const bslma::TestAllocatorException&) {
+                ++numException;
+            }
+            va.setAllocationLimit(-1);
+
+            ASSERT(1 == numException);
+            ASSERT(values[0] == shortValues[0]);
+            ASSERT(values[1] == shortValues[1]);
+            ASSERT(2 == X.numElements());
+
+            rv = mX.popFrontBatch(&n, popped.data(), 8);
+            ASSERT(e_SUCCESS == rv);  ASSERT(2 == n);
+            ASSERT(values[3] == popped[0]);
+            ASSERT(values[4] == popped[1]);
+        }
+#endif
+
+        if (verbose) cout << "\nConcurrent producers and consumers." << endl;
+        {
+            const int k_NUM_PRODUCERS = 4;
+            const int k_NUM_CONSUMERS = 3;
+            const int k_NUM_VALUES    = 5000;  // per producer
+
+            Obj mX(32);  const Obj& X = mX;
+
+            bsls::AtomicInt64 sum(0);
+            bsls::AtomicInt   count(0);
+
+            bslmt::ThreadGroup producers;
+            bslmt::ThreadGroup consumers;
+
+            for (int i = 0; i < k_NUM_CONSUMERS; ++i) {
+                consumers.addThread(bdlf::BindUtil::bind(&batchConsumer,
+                                                         &mX,
+                                                         k_NUM_VALUES,
+                                                         &sum,
+                                                         &count));
+            }
+            for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                producers.addThread(bdlf::BindUtil::bind(&batchProducer,
+                                                         &mX,
+                                                         i,
+                                                         k_NUM_VALUES,
+                                                         7 + 13 * i));
+            }
+
+            producers.joinAll();
+            ASSERT(0 == X.waitUntilEmpty());
+            mX.disablePopFront();
+            consumers.joinAll();
+
+            const bsls::Types::Int64 TOTAL = k_NUM_PRODUCERS * k_NUM_VALUES;
+
+            ASSERTV(count, TOTAL == count);
+            ASSERTV(sum, TOTAL * (TOTAL - 1) / 2 == sum);
+        }
       } break;
       case 11: {
         // ---------------------------------------------------------
@@ -2,6 +2,190 @@
 
 #include <bdlcc_cache.h>
 
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_cache_cpp,"$Id$ $CSID$")
+
+#include <bsl_algorithm.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+namespace {
+
+const bsls::Types::Uint64 k_SEEDS[] = {
+    // Multipliers used to derive the index of each of the four counters of a
+    // hash value.
+
+    0xc3a5c85c97cb3127ULL,
+    0xb492b66fbe98f273ULL,
+    0x9ae16a3b2f90404fULL,
+    0xcbf29ce484222325ULL
+};
+
+const bsls::Types::Uint64 k_RESET_MASK = 0x7777777777777777ULL;
+    // Mask clearing the bit shifted into each counter when halving.
+
+const int k_MAX_FREQUENCY = 15;
+    // Maximum value of a counter.
+
+const bsl::size_t k_MAX_TABLE_SIZE = 1 << 24;
+    // Maximum number of words of a sketch.
+
+inline
+bsls::Types::Uint64 spread(bsl::size_t hashValue)
+    // Return a value derived from the specified 'hashValue', whose bits all
+    // depend on all the bits of 'hashValue'.
+{
+    bsls::Types::Uint64 x = hashValue;
+    x = (x ^ (x >> 33)) * 0xff51afd7ed558ccdULL;
+    x = (x ^ (x >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+    return x ^ (x >> 33);
+}
+
+inline
+bsl::size_t wordIndex(bsls::Types::Uint64 hash, int i, bsl::size_t mask)
+    // Return the index, in a table whose size is the specified 'mask' plus
+    // one, of the word holding the specified 'i'th counter of the specified
+    // 'hash'.
+{
+    const bsls::Types::Uint64 h = (hash + k_SEEDS[i]) * k_SEEDS[i];
+    return static_cast<bsl::size_t>(h + (h >> 32)) & mask;
+}
+
+}  // close unnamed namespace
+
+                        // --------------------------
+                        // class Cache_StripedCounter
+                        // --------------------------
+
+// CREATORS
+Cache_StripedCounter::Stripe::Stripe()
+: d_value(0)
+, d_padding()
+{
+}
+
+Cache_StripedCounter::Cache_StripedCounter()
+{
+}
+
+// MANIPULATORS
+void Cache_StripedCounter::reset()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes[i].d_value.storeRelaxed(0);
+    }
+}
+
+// ACCESSORS
+bsls::Types::Int64 Cache_StripedCounter::value() const
+{
+    bsls::Types::Int64 result = 0;
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        result += d_stripes[i].d_value.loadRelaxed();
+    }
+    return result;
+}
+
+                        // ---------------------------
+                        // class Cache_FrequencySketch
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+void Cache_FrequencySketch::age()
+{
+    for (bsl::size_t i = 0; i < d_table.size(); ++i) {
+        d_table[i] = (d_table[i] >> 1) & k_RESET_MASK;
+    }
+    d_numIncrements /= 2;
+}
+
+// CREATORS
+Cache_FrequencySketch::Cache_FrequencySketch(bslma::Allocator *basicAllocator)
+: d_table(basicAllocator)
+, d_tableMask(0)
+, d_sampleSize(0)
+, d_numIncrements(0)
+{
+}
+
+// MANIPULATORS
+void Cache_FrequencySketch::clear()
+{
+    bsl::fill(d_table.begin(), d_table.end(), 0);
+    d_numIncrements = 0;
+}
+
+void Cache_FrequencySketch::increment(bsl::size_t hashValue)
+{
+    if (d_table.empty()) {
+        return;                                                       // RETURN
+    }
+
+    // Each word holds 16 counters.  The four counters of a hash value are in
+    // (possibly) different words, at offsets chosen among four consecutive
+    // counters.
+
+    const bsls::Types::Uint64 hash  = spread(hashValue);
+    const int                 start = static_cast<int>(hash & 3) << 2;
+
+    bool incremented = false;
+    for (int i = 0; i < 4; ++i) {
+        const bsl::size_t index = wordIndex(hash, i, d_tableMask);
+        const int         shift = (start + i) << 2;
+
+        if (((d_table[index] >> shift) & 0xf) != k_MAX_FREQUENCY) {
+            d_table[index] += 1ULL << shift;
+            incremented = true;
+        }
+    }
+
+    if (incremented && ++d_numIncrements >= d_sampleSize) {
+        age();
+    }
+}
+
+void Cache_FrequencySketch::reserve(bsl::size_t capacity)
+{
+    // Use about one word (i.e., 16 counters) per item, rounded up to a power
+    // of two.
+
+    bsl::size_t size = 16;
+    while (size < capacity && size < k_MAX_TABLE_SIZE) {
+        size <<= 1;
+    }
+
+    d_table.assign(size, 0);
+    d_tableMask     = size - 1;
+    d_sampleSize    = 10 * (capacity < size ? capacity : size);
+    d_numIncrements = 0;
+}
+
+// ACCESSORS
+int Cache_FrequencySketch::frequency(bsl::size_t hashValue) const
+{
+    if (d_table.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Uint64 hash  = spread(hashValue);
+    const int                 start = static_cast<int>(hash & 3) << 2;
+
+    int result = k_MAX_FREQUENCY;
+    for (int i = 0; i < 4; ++i) {
+        const bsl::size_t index = wordIndex(hash, i, d_tableMask);
+        const int         shift = (start + i) << 2;
+        const int         count =
+                           static_cast<int>((d_table[index] >> shift) & 0xf);
+        if (count < result) {
+            result = count;
+        }
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
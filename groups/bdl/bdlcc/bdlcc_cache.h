@@ -27,11 +27,52 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Four eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), CLOCK (an approximation of LRU), and W-TinyLFU (a
+// frequency-aware policy resisting scans).  With LRU, the
+// item that has *not* been accessed for the longest period of time will be
+// evicted first.  With FIFO, the eviction order is based on the order of
+// insertion, with the earliest inserted item being evicted first.  With CLOCK
+// (also known as "second chance"), accessing an item merely sets a reference
+// bit on the item instead of moving it to the back of the eviction queue;
+// when an item at the front of the queue is considered for eviction and its
+// reference bit is set, the bit is cleared and the item is moved to the back
+// of the queue instead of being evicted.  CLOCK thus evicts items that have
+// not been accessed recently, like LRU, while allowing 'tryGetValue' to
+// proceed with only a read lock, like FIFO.
+//
+// With LRU, FIFO, and CLOCK, a single pass over a large number of keys that
+// are not accessed again (a "scan") evicts all the frequently accessed items
+// from the cache.  W-TinyLFU protects those items by taking the frequency of
+// the accesses into account: the items are divided into a small *admission*
+// *window* (1% of the high watermark) and a *main* queue, both in LRU order.
+// New items are inserted into the window.  When an item must be evicted while
+// the window is full, the least recently used item of the window (the
+// candidate) is admitted into the main queue only if its key has been
+// accessed (inserted or retrieved) more often than the key of the least
+// recently used item of the main queue, which is then evicted in its place;
+// otherwise, the candidate itself is evicted.  The access frequencies are
+// estimated using a compact probabilistic sketch ("count-min sketch") whose
+// counters are periodically halved, so that keys that are no longer accessed
+// eventually lose their advantage.  The main queue is further divided into a
+// *probation* segment and a *protected* segment (80% of the main queue):
+// items are promoted to the protected segment when they are accessed while in
+// the probation segment, so that items accessed only once are evicted first.
+// As with LRU, a 'tryGetValue' on a W-TinyLFU cache modifies the eviction
+// queues, and thus requires a write lock.
+//
+///Statistics
+///----------
+// The cache counts the number of hits and misses of 'tryGetValue', and the
+// number of items evicted to enforce the watermarks (or by 'popFront'), which
+// are available through the 'numHits', 'numMisses', and 'numEvictions'
+// accessors, and can be reset using 'resetStatistics'.  Those statistics are
+// intended to help choosing the eviction policy and the watermarks best
+// suited to an application.  Hits and misses are counted on several counters,
+// each on its own cache line and selected from the identifier of the calling
+// thread, so that concurrent lookups under the read lock do not contend on a
+// single cache line; 'numHits' and 'numMisses' return the sum of these
+// counters.
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +90,13 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO or CLOCK,
+// or the argument 'modifyEvictionQueue' is set to 'false'.  For read-heavy
+// caches, the CLOCK policy avoids serializing readers on the write lock while
+// retaining most of the benefit of LRU; for limited cases where contention is
+// likely, temporarily setting 'modifyEvictionQueue' to 'false' might also be
+// of value.  See also 'bdlcc_shardedcache', which partitions the items among
+// several independently locked caches.
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -297,18 +341,23 @@ BSLS_IDENT("$Id: $")
 #include <bslim_printer.h>
 
 #include <bslma_allocator.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_allocatorargt.h>
 #include <bslmf_integralconstant.h>
 #include <bslmf_movableref.h>
 
+#include <bslmt_platform.h>
 #include <bslmt_readerwritermutex.h>
 #include <bslmt_readlockguard.h>
+#include <bslmt_threadutil.h>
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_memory.h>
 #include <bsl_map.h>
@@ -329,9 +378,217 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,     // Least Recently Used
+        e_FIFO,    // First In, First Out
+        e_CLOCK,   // approximate LRU ("second chance")
+        e_TINYLFU  // W-TinyLFU: LRU window and frequency-based admission
+    };
+};
+
+                        // ===========================
+                        // class Cache_FrequencySketch
+                        // ===========================
+
+class Cache_FrequencySketch {
+    // This component-private class implements a count-min sketch estimating
+    // the number of occurrences of hash values, used by the W-TinyLFU
+    // eviction policy of 'Cache'.  Each hash value is mapped to four 4-bit
+    // counters, so that the estimated frequency of a hash value saturates at
+    // 15.  After a number of increments proportional to the configured
+    // capacity, all counters are halved, so that the estimates reflect recent
+    // history.  This class is *not* thread-safe.
+
+    // DATA
+    bsl::vector<bsls::Types::Uint64> d_table;          // counters, 16 per
+                                                       // word
+
+    bsl::size_t                      d_tableMask;      // 'd_table.size() - 1'
+
+    bsl::size_t                      d_sampleSize;     // number of increments
+                                                       // between two halvings
+
+    bsl::size_t                      d_numIncrements;  // increments since the
+                                                       // last halving
+
+    // PRIVATE MANIPULATORS
+    void age();
+        // Halve the value of every counter of this sketch.
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_FrequencySketch(const Cache_FrequencySketch&);
+    Cache_FrequencySketch& operator=(const Cache_FrequencySketch&);
+
+  public:
+    // CREATORS
+    explicit Cache_FrequencySketch(bslma::Allocator *basicAllocator = 0);
+        // Create a 'Cache_FrequencySketch' object having no counters, whose
+        // estimates are all 0 until 'reserve' is called.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // 0, the currently installed default allocator is used.
+
+    //! ~Cache_FrequencySketch() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Reset every counter of this sketch to 0.
+
+    void increment(bsl::size_t hashValue);
+        // Increment the estimated frequency of the specified 'hashValue'.
+
+    void reserve(bsl::size_t capacity);
+        // Size this sketch to estimate the frequencies of the items of a cache
+        // holding up to the specified 'capacity' items, and reset every
+        // counter to 0.
+
+    // ACCESSORS
+    int frequency(bsl::size_t hashValue) const;
+        // Return the estimated frequency, in the range '[0 .. 15]', of the
+        // specified 'hashValue'.
+};
+
+                        // ==========================
+                        // class Cache_StripedCounter
+                        // ==========================
+
+class Cache_StripedCounter {
+    // This component-private class implements a counter that many threads can
+    // increment concurrently without contending on a single cache line: each
+    // thread increments one of several stripes, each occupying its own cache
+    // line, selected from the identifier of the thread, and the value of the
+    // counter is the sum of the stripes.  This class is thread-safe, but
+    // 'value' is not atomic with respect to concurrent increments and resets.
+
+    // PRIVATE TYPES
+    enum {
+        k_STRIPE_BITS = 3,                   // log2 of the number of stripes
+        k_NUM_STRIPES = 1 << k_STRIPE_BITS   // number of stripes
+    };
+
+    struct Stripe {
+        // This 'struct' holds one stripe of the counter, padded to the size
+        // of a cache line.
+
+        bsls::AtomicInt64 d_value;
+        const char        d_padding[bslmt::Platform::e_CACHE_LINE_SIZE
+                                                 - sizeof(bsls::AtomicInt64)];
+
+        Stripe();
+            // Create a stripe having the value 0.
     };
+
+    // DATA
+    Stripe d_stripes[k_NUM_STRIPES];  // stripes, summed by 'value'
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_StripedCounter(const Cache_StripedCounter&);
+    Cache_StripedCounter& operator=(const Cache_StripedCounter&);
+
+  public:
+    // CREATORS
+    Cache_StripedCounter();
+        // Create a 'Cache_StripedCounter' object having the value 0.
+
+    //! ~Cache_StripedCounter() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void increment();
+        // Increment the value of this counter by one, using the stripe of the
+        // calling thread.
+
+    void reset();
+        // Set the value of this counter to 0.
+
+    // ACCESSORS
+    bsls::Types::Int64 value() const;
+        // Return the value of this counter.
+};
+
+                        // =========================
+                        // struct Cache_TinyLfuState
+                        // =========================
+
+template <class KEY>
+struct Cache_TinyLfuState {
+    // This component-private 'struct' holds the state specific to the
+    // W-TinyLFU eviction policy of a 'Cache': the eviction queues of the
+    // admission window and of the protected segment (the probation segment
+    // being the main eviction queue of the cache), their target sizes, and
+    // the frequency sketch.  It is allocated only by the caches using that
+    // policy.
+
+    // PUBLIC DATA
+    bsl::list<KEY>        d_windowQueue;        // admission window, in LRU
+                                                // order
+
+    bsl::list<KEY>        d_protectedQueue;     // protected segment, in LRU
+                                                // order
+
+    Cache_FrequencySketch d_sketch;             // access frequencies
+
+    bsl::size_t           d_windowCapacity;     // target size of
+                                                // 'd_windowQueue'
+
+    bsl::size_t           d_mainCapacity;       // target size of the
+                                                // probation and protected
+                                                // segments
+
+    bsl::size_t           d_protectedCapacity;  // maximum size of
+                                                // 'd_protectedQueue'
+
+    // CREATORS
+    Cache_TinyLfuState(bsl::size_t       highWatermark,
+                       bslma::Allocator *basicAllocator);
+        // Create a 'Cache_TinyLfuState' object for a cache having the
+        // specified 'highWatermark', using the specified 'basicAllocator' to
+        // supply memory.  The admission window is given 1% of
+        // 'highWatermark' (at least 1), and the protected segment 80% of the
+        // rest, as recommended by the authors of W-TinyLFU.
+};
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+    // This 'struct' holds the mapped value of an item in a 'Cache': a pointer
+    // to the cached value, the position of the key of the item in the
+    // eviction queue, the reference bit used by the CLOCK eviction policy,
+    // and the segment used by the W-TinyLFU eviction policy.  The reference
+    // bit can be set while holding only a read lock on the cache.
+
+    // PUBLIC DATA
+    VALUE_PTR                d_valuePtr;    // cached value
+
+    QUEUE_ITERATOR           d_queueIt;     // position in the eviction queue
+
+    mutable bsls::AtomicBool d_referenced;  // 'true' if the item was accessed
+                                            // since it was last considered for
+                                            // eviction (CLOCK only)
+
+    int                      d_segment;     // eviction queue holding the item
+                                            // (W-TinyLFU only)
+
+    // CREATORS
+    Cache_MapValue(const VALUE_PTR& valuePtr, QUEUE_ITERATOR queueIt);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   QUEUE_ITERATOR               queueIt);
+        // Create a 'Cache_MapValue' object holding the specified 'valuePtr'
+        // and 'queueIt', whose reference bit is not set, and whose segment is
+        // 0.
+
+    Cache_MapValue(const Cache_MapValue& original);
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+        // Create a 'Cache_MapValue' object having the same value as the
+        // specified 'original' object.  In the second overload, 'original' is
+        // left in a valid but unspecified state.
+
+    //! ~Cache_MapValue() = default;
+        // Destroy this object.
+
+  private:
+    // NOT IMPLEMENTED
+    Cache_MapValue& operator=(const Cache_MapValue&);
 };
 
 template <class KEY>
@@ -398,14 +655,27 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
         // Value type of the hash map.
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
         // Hash map type.
 
+    typedef Cache_TinyLfuState<KEY>                               TinyLfuState;
+        // Additional state of the W-TinyLFU eviction policy.
+
     typedef bslmt::ReaderWriterMutex                              LockType;
 
+    enum Segment {
+        // Enumeration of the eviction queues used by the W-TinyLFU eviction
+        // policy.  With the other policies, all items are in 'e_MAIN'.
+
+        e_MAIN      = 0,  // probation segment of the main queue
+        e_WINDOW    = 1,  // admission window
+        e_PROTECTED = 2   // protected segment of the main queue
+    };
+
     // DATA
     bslma::Allocator          *d_allocator_p;          // memory allocator
                                                        // (held, not owned)
@@ -421,6 +691,8 @@ class Cache {
                                                        // first item to be
                                                        // evicted is at the
                                                        // front of the queue
+                                                       // (probation segment
+                                                       // with W-TinyLFU)
 
     CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
 
@@ -438,19 +710,75 @@ class Cache {
                                                        // been evicted from the
                                                        // cache
 
+    bslma::ManagedPtr<TinyLfuState>
+                               d_tinyLfu_mp;           // additional state of
+                                                       // the W-TinyLFU policy,
+                                                       // null with other
+                                                       // policies
+
+    Cache_StripedCounter       d_numHits;              // number of successful
+                                                       // lookups
+
+    Cache_StripedCounter       d_numMisses;            // number of failed
+                                                       // lookups
+
+    bsls::AtomicInt64          d_numEvictions;         // number of items
+                                                       // evicted to enforce
+                                                       // the watermarks or by
+                                                       // 'popFront'
+
     // FRIENDS
     friend class Cache_TestUtil<KEY, VALUE, HASH, EQUAL>;
 
     // PRIVATE MANIPULATORS
+    void admitFromWindow();
+        // Move items from the front of the admission window to the back of
+        // the probation segment while the window holds more than its target
+        // number of items and the main queue holds less than its target
+        // number of items (W-TinyLFU only).
+
     void enforceHighWatermark();
         // Evict items from this cache if 'size() >= highWatermark()' until
         // 'size() < lowWatermark()' beginning from the front of the eviction
         // queue.  Invoke the post-eviction callback for each item evicted.
 
+    void evictFront();
+        // Evict the item at the front of the eviction queue and invoke the
+        // post-eviction callback for that item.  If the eviction policy is
+        // CLOCK, items at the front of the queue whose reference bit is set
+        // are first given a second chance: their bit is cleared and they are
+        // moved to the back of the queue.  If the eviction policy is
+        // W-TinyLFU, see 'evictTinyLfu'.  The behavior is undefined unless
+        // this cache is not empty.
+
+    void evictTinyLfu();
+        // Evict one item according to the W-TinyLFU eviction policy and
+        // invoke the post-eviction callback for that item.  If the admission
+        // window holds more than its target number of items, the item at the
+        // front of the window (the candidate) competes with the item at the
+        // front of the main queue (the victim): the candidate is moved to the
+        // main queue and the victim is evicted if the estimated frequency of
+        // the candidate is greater than that of the victim, and the candidate
+        // is evicted otherwise.  Otherwise, the item at the front of the main
+        // queue is evicted.  The behavior is undefined unless this cache is
+        // not empty.
+
     void evictItem(const typename MapType::iterator& mapIt);
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
 
+    QueueType& queueOf(const MapValue& mapValue);
+        // Return a reference providing modifiable access to the eviction
+        // queue holding the item having the specified 'mapValue'.
+
+    void recordTinyLfuAccess(const typename MapType::iterator& mapIt);
+        // Record an access to the item at the specified 'mapIt' according to
+        // the W-TinyLFU eviction policy: increment the estimated frequency of
+        // its key, and move it to the back of the admission window if it is
+        // in the window, or to the back of the protected segment otherwise,
+        // demoting the front of the protected segment to the probation
+        // segment if the protected segment becomes too large.
+
     bool insertValuePtrMoveImp(KEY          *key_p,
                                bool          moveKey,
                                ValuePtrType *valuePtr_p,
@@ -528,7 +856,7 @@ class Cache {
     // MANIPULATORS
     void clear();
         // Remove all items from this cache.  Do *not* invoke the post-eviction
-        // callback.
+        // callback.  Note that the statistics of this cache are not reset.
 
     int erase(const KEY& key);
         // Remove the item having the specified 'key' from this cache.  Invoke
@@ -577,7 +905,14 @@ class Cache {
     int popFront();
         // Remove the item at the front of the eviction queue.  Invoke the
         // post-eviction callback for the removed item.  Return 0 on success,
-        // and 1 if this cache is empty.
+        // and 1 if this cache is empty.  Note that, if the eviction policy is
+        // CLOCK, the items at the front of the queue whose reference bit is
+        // set are first moved to the back of the queue, and that, if the
+        // eviction policy is W-TinyLFU, the removed item is selected as
+        // described in the component documentation.
+
+    void resetStatistics();
+        // Reset the number of hits, misses, and evictions of this cache to 0.
 
     void setPostEvictionCallback(
                              const PostEvictionCallback& postEvictionCallback);
@@ -591,9 +926,15 @@ class Cache {
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
         // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
-        // success, and 1 if 'key' does not exist in this cache.  Note that a
-        // write lock is acquired only if this queue is modified.
+        // move the cached item to the back of the eviction queue; if
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is CLOCK,
+        // mark the cached item as recently used; if 'modifyEvictionQueue' is
+        // 'true' and the eviction policy is W-TinyLFU, record the access as
+        // described in the component documentation.  Return 0 on success, and
+        // 1 if 'key' does not exist in this cache.  Note that a write lock is
+        // acquired only if this queue is modified, which never happens with
+        // the FIFO and CLOCK policies.  Also note that the access is counted
+        // as a hit or a miss in the statistics of this cache.
 
     // ACCESSORS
     EQUAL equalFunction() const;
@@ -616,6 +957,22 @@ class Cache {
         // Return the low watermark of this cache, which is the size at which
         // eviction of existing items ends.
 
+    bsls::Types::Int64 numEvictions() const;
+        // Return the number of items evicted from this cache, to enforce the
+        // watermarks or by 'popFront', since its construction or the last
+        // call to 'resetStatistics'.  Note that items removed by 'erase',
+        // 'eraseBulk', and 'clear' are not counted.
+
+    bsls::Types::Int64 numHits() const;
+        // Return the number of calls to 'tryGetValue' that found the
+        // requested item since the construction of this cache or the last
+        // call to 'resetStatistics'.
+
+    bsls::Types::Int64 numMisses() const;
+        // Return the number of calls to 'tryGetValue' that did not find the
+        // requested item since the construction of this cache or the last
+        // call to 'resetStatistics'.
+
     bsl::size_t size() const;
         // Return the current size of this cache.
 
@@ -623,6 +980,9 @@ class Cache {
     void visit(VISITOR& visitor) const;
         // Call the specified 'visitor' for every item stored in this cache in
         // the order of the eviction queue until 'visitor' returns 'false'.
+        // If the eviction policy is W-TinyLFU, the items of the probation
+        // segment are visited first, followed by the items of the protected
+        // segment and of the admission window.
         // The 'VISITOR' type must be a callable object that can be invoked in
         // the same way as the function 'bool (const KEY&, const VALUE&)'
 };
@@ -664,6 +1024,94 @@ class Cache_TestUtil {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                        // --------------------------
+                        // class Cache_StripedCounter
+                        // --------------------------
+
+// MANIPULATORS
+inline
+void Cache_StripedCounter::increment()
+{
+    // Fibonacci hashing spreads the (typically aligned) thread identifiers
+    // over the stripes.
+
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    d_stripes[(id * 0x9E3779B97F4A7C15ULL) >> (64 - k_STRIPE_BITS)]
+                                                        .d_value.addRelaxed(1);
+}
+
+                        // --------------------
+                        // class Cache_MapValue
+                        // --------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                               const VALUE_PTR& valuePtr,
+                                               QUEUE_ITERATOR   queueIt)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced(false)
+, d_segment(0)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                   bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                   QUEUE_ITERATOR               queueIt)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced(false)
+, d_segment(0)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                                const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+, d_segment(original.d_segment)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                    bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                         bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_referenced(
+          bslmf::MovableRefUtil::access(original).d_referenced.loadRelaxed())
+, d_segment(bslmf::MovableRefUtil::access(original).d_segment)
+{
+}
+
+                        // -------------------------
+                        // struct Cache_TinyLfuState
+                        // -------------------------
+
+// CREATORS
+template <class KEY>
+Cache_TinyLfuState<KEY>::Cache_TinyLfuState(
+                                          bsl::size_t       highWatermark,
+                                          bslma::Allocator *basicAllocator)
+: d_windowQueue(basicAllocator)
+, d_protectedQueue(basicAllocator)
+, d_sketch(basicAllocator)
+, d_windowCapacity(highWatermark / 100 ? highWatermark / 100 : 1)
+, d_mainCapacity(highWatermark - d_windowCapacity)
+, d_protectedCapacity(d_mainCapacity / 5 * 4)
+{
+    d_sketch.reserve(highWatermark);
+}
+
                         // ------------------------
                         // class Cache_QueueProctor
                         // ------------------------
@@ -718,6 +1166,10 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(bslma::Allocator *basicAllocator)
 , d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+, d_tinyLfu_mp()
+, d_numHits()
+, d_numMisses()
+, d_numEvictions(0)
 {
 }
 
@@ -734,10 +1186,20 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+, d_tinyLfu_mp()
+, d_numHits()
+, d_numMisses()
+, d_numEvictions(0)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
     BSLS_REVIEW(1 <= lowWatermark);
     BSLS_REVIEW(1 <= highWatermark);
+
+    if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        d_tinyLfu_mp.load(new (*d_allocator_p) TinyLfuState(highWatermark,
+                                                             d_allocator_p),
+                          d_allocator_p);
+    }
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -755,13 +1217,40 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
+, d_tinyLfu_mp()
+, d_numHits()
+, d_numMisses()
+, d_numEvictions(0)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
     BSLS_REVIEW(1 <= lowWatermark);
     BSLS_REVIEW(1 <= highWatermark);
+
+    if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        d_tinyLfu_mp.load(new (*d_allocator_p) TinyLfuState(highWatermark,
+                                                             d_allocator_p),
+                          d_allocator_p);
+    }
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::admitFromWindow()
+{
+    TinyLfuState& state  = *d_tinyLfu_mp;
+    QueueType&    window = state.d_windowQueue;
+
+    while (window.size() > state.d_windowCapacity
+        && d_queue.size() + state.d_protectedQueue.size() <
+                                                        state.d_mainCapacity) {
+        typename MapType::iterator mapIt = d_map.find(window.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        d_queue.splice(d_queue.end(), window, mapIt->second.d_queueIt);
+        mapIt->second.d_segment = e_MAIN;
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
 {
@@ -770,9 +1259,77 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictFront();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::evictFront()
+{
+    ++d_numEvictions;
+
+    if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+        evictTinyLfu();
+        return;                                                       // RETURN
+    }
+
+    typename MapType::iterator mapIt = d_map.find(d_queue.front());
+    BSLS_ASSERT(mapIt != d_map.end());
+
+    if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+        // Since a write lock is held, no reader can set a reference bit
+        // concurrently, and the loop ends after at most one pass over the
+        // queue.
+
+        while (mapIt->second.d_referenced.loadRelaxed()) {
+            mapIt->second.d_referenced.storeRelaxed(false);
+            d_queue.splice(d_queue.end(), d_queue, mapIt->second.d_queueIt);
+
+            mapIt = d_map.find(d_queue.front());
+            BSLS_ASSERT(mapIt != d_map.end());
+        }
+    }
+
+    evictItem(mapIt);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::evictTinyLfu()
+{
+    TinyLfuState& state     = *d_tinyLfu_mp;
+    QueueType&    window    = state.d_windowQueue;
+    QueueType&    mainQueue = d_queue.empty() ? state.d_protectedQueue
+                                              : d_queue;
+
+    if (mainQueue.empty()) {
+        evictItem(d_map.find(window.front()));
+        return;                                                       // RETURN
+    }
+
+    typename MapType::iterator victimIt = d_map.find(mainQueue.front());
+    BSLS_ASSERT(victimIt != d_map.end());
+
+    if (window.size() <= state.d_windowCapacity) {
+        evictItem(victimIt);
+        return;                                                       // RETURN
+    }
+
+    typename MapType::iterator candidateIt = d_map.find(window.front());
+    BSLS_ASSERT(candidateIt != d_map.end());
+
+    const HASH hasher             = d_map.hash_function();
+    const int  candidateFrequency =
+                         state.d_sketch.frequency(hasher(candidateIt->first));
+    const int  victimFrequency    =
+                         state.d_sketch.frequency(hasher(victimIt->first));
+
+    if (candidateFrequency > victimFrequency) {
+        d_queue.splice(d_queue.end(), window, candidateIt->second.d_queueIt);
+        candidateIt->second.d_segment = e_MAIN;
+        evictItem(victimIt);
+    }
+    else {
+        evictItem(candidateIt);
     }
 }
 
@@ -780,15 +1337,62 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    queueOf(mapIt->second).erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename Cache<KEY, VALUE, HASH, EQUAL>::QueueType&
+Cache<KEY, VALUE, HASH, EQUAL>::queueOf(const MapValue& mapValue)
+{
+    switch (mapValue.d_segment) {
+      case e_WINDOW:    return d_tinyLfu_mp->d_windowQueue;           // RETURN
+      case e_PROTECTED: return d_tinyLfu_mp->d_protectedQueue;        // RETURN
+      default:          return d_queue;                               // RETURN
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::recordTinyLfuAccess(
+                                       const typename MapType::iterator& mapIt)
+{
+    TinyLfuState& state          = *d_tinyLfu_mp;
+    QueueType&    protectedQueue = state.d_protectedQueue;
+    MapValue&     mapValue       = mapIt->second;
+
+    state.d_sketch.increment(d_map.hash_function()(mapIt->first));
+
+    if (e_WINDOW == mapValue.d_segment) {
+        state.d_windowQueue.splice(state.d_windowQueue.end(),
+                                   state.d_windowQueue,
+                                   mapValue.d_queueIt);
+        return;                                                       // RETURN
+    }
+
+    protectedQueue.splice(protectedQueue.end(),
+                          queueOf(mapValue),
+                          mapValue.d_queueIt);
+    mapValue.d_segment = e_PROTECTED;
+
+    if (protectedQueue.size() > state.d_protectedCapacity) {
+        typename MapType::iterator demotedIt =
+                                            d_map.find(protectedQueue.front());
+        BSLS_ASSERT(demotedIt != d_map.end());
+
+        d_queue.splice(d_queue.end(),
+                       protectedQueue,
+                       demotedIt->second.d_queueIt);
+        demotedIt->second.d_segment = e_MAIN;
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -811,24 +1415,37 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        if (CacheEvictionPolicy::e_CLOCK == d_evictionPolicy) {
+            mapIt->second.d_referenced.storeRelaxed(true);
+        }
+        else if (CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy) {
+            recordTinyLfuAccess(mapIt);
+        }
+        else {
+            typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
-        // Move 'queueIt' to the back of 'd_queue'.
+            // Move 'queueIt' to the back of 'd_queue'.
 
-        d_queue.splice(d_queue.end(), d_queue, queueIt);
+            d_queue.splice(d_queue.end(), d_queue, queueIt);
+        }
 
         return false;                                                 // RETURN
     }
     else {
-        Cache_QueueProctor<KEY>      proctor(&d_queue);
-        d_queue.push_back(key);
-        typename QueueType::iterator queueIt = d_queue.end();
+        const bool isTinyLfu =
+                         CacheEvictionPolicy::e_TINYLFU == d_evictionPolicy;
+        QueueType& queue     = isTinyLfu ? d_tinyLfu_mp->d_windowQueue
+                                         : d_queue;
+
+        Cache_QueueProctor<KEY>      proctor(&queue);
+        queue.push_back(key);
+        typename QueueType::iterator queueIt = queue.end();
         --queueIt;
 
         bsls::ObjectBuffer<MapValue> mapValueFootprint;
@@ -836,16 +1453,18 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
-                                      queueIt,
-                                      d_allocator_p);
+                                      queueIt);
         }
         else {
-            new (mapValue_p) MapValue(valuePtr,
-                                      queueIt,
-                                      d_allocator_p);
+            new (mapValue_p) MapValue(valuePtr, queueIt);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
+        if (isTinyLfu) {
+            mapValue_p->d_segment = e_WINDOW;
+            d_tinyLfu_mp->d_sketch.increment(d_map.hash_function()(key));
+        }
+
         if (moveKey) {
             d_map.emplace(bslmf::MovableRefUtil::move(key),
                           bslmf::MovableRefUtil::move(*mapValue_p));
@@ -857,6 +1476,10 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         proctor.release();
 
+        if (isTinyLfu) {
+            admitFromWindow();
+        }
+
         return true;                                                  // RETURN
     }
 }
@@ -909,6 +1532,11 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
     d_map.clear();
     d_queue.clear();
+    if (d_tinyLfu_mp) {
+        d_tinyLfu_mp->d_windowQueue.clear();
+        d_tinyLfu_mp->d_protectedQueue.clear();
+        d_tinyLfu_mp->d_sketch.clear();
+    }
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1072,15 +1700,22 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictFront();
         return 0;                                                     // RETURN
     }
 
     return 1;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void Cache<KEY, VALUE, HASH, EQUAL>::resetStatistics()
+{
+    d_numHits.reset();
+    d_numMisses.reset();
+    d_numEvictions = 0;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
                               const PostEvictionCallback& postEvictionCallback)
@@ -1095,7 +1730,8 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
                                    const KEY&              key,
                                    bool                    modifyEvictionQueue)
 {
-    int writeLock = d_evictionPolicy == CacheEvictionPolicy::e_LRU &&
+    int writeLock = (d_evictionPolicy == CacheEvictionPolicy::e_LRU ||
+                     d_evictionPolicy == CacheEvictionPolicy::e_TINYLFU) &&
          modifyEvictionQueue ? 1 : 0;
     if (writeLock) {
         d_rwlock.lockWrite();
@@ -1112,19 +1748,34 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
 
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt == d_map.end()) {
+        d_numMisses.increment();
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    d_numHits.increment();
 
-    if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+    *value = mapIt->second.d_valuePtr;
+
+    if (writeLock && d_evictionPolicy == CacheEvictionPolicy::e_TINYLFU) {
+        recordTinyLfuAccess(mapIt);
+    }
+    else if (writeLock) {
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
             d_queue.splice(d_queue.end(), d_queue, queueIt);
         }
     }
+    else if (d_evictionPolicy == CacheEvictionPolicy::e_CLOCK &&
+             modifyEvictionQueue) {
+        // The bit is written only when clear, so that hits on a hot entry do
+        // not bounce its cache line between the reading threads.
+
+        if (!mapIt->second.d_referenced.loadRelaxed()) {
+            mapIt->second.d_referenced.storeRelaxed(true);
+        }
+    }
 
     return 0;
 }
@@ -1166,6 +1817,27 @@ bsl::size_t Cache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
     return d_lowWatermark;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Int64 Cache<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    return d_numEvictions.loadRelaxed();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Int64 Cache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    return d_numHits.value();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Int64 Cache<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    return d_numMisses.value();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t Cache<KEY, VALUE, HASH, EQUAL>::size() const
@@ -1180,16 +1852,24 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
 {
     bslmt::ReadLockGuard<LockType> guard(&d_rwlock);
 
-    for (typename QueueType::const_iterator queueIt = d_queue.begin();
-         queueIt != d_queue.end(); ++queueIt) {
+    const QueueType *queues[] = { &d_queue, 0, 0 };
+    if (d_tinyLfu_mp) {
+        queues[1] = &d_tinyLfu_mp->d_protectedQueue;
+        queues[2] = &d_tinyLfu_mp->d_windowQueue;
+    }
 
-        const KEY&                             key = *queueIt;
-        const typename MapType::const_iterator mapIt = d_map.find(key);
-        BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+    for (int i = 0; i < 3 && queues[i]; ++i) {
+        for (typename QueueType::const_iterator queueIt = queues[i]->begin();
+             queueIt != queues[i]->end(); ++queueIt) {
+
+            const KEY&                             key = *queueIt;
+            const typename MapType::const_iterator mapIt = d_map.find(key);
+            BSLS_ASSERT(mapIt != d_map.end());
+            const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
-        if (!visitor(key, *valuePtr)) {
-            break;
+            if (!visitor(key, *valuePtr)) {
+                return;                                               // RETURN
+            }
         }
     }
 }
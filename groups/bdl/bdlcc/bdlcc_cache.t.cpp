@@ -6,6 +6,8 @@
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
+#include <bdlf_bind.h>
+
 #include <bdlb_random.h>
 #include <bdlb_randomdevice.h>
 
@@ -107,6 +109,7 @@ using namespace bsl;
 // [13] int insertBulk(bsl::vector<KVType>&& data);
 // [ 5] int tryGetValue(value, KEYTYPE& key, bool modifyEvictionQueue);
 // [ 9] int popFront();
+// [21] void resetStatistics();
 // [ 6] int erase(const KEYTYPE& key);
 // [ 7] int eraseBulk(const bsl::vector<KEYTYPE>& keys);
 // [ 5] void setPostEvictionCallback(postEvictionCallback);
@@ -120,6 +123,9 @@ using namespace bsl;
 // [ 4] bsl::size_t size() const;
 // [ 4] HASH hashFunction() const;
 // [ 4] EQUAL equalFunction() const;
+// [21] bsls::Types::Int64 numEvictions() const;
+// [21] bsls::Types::Int64 numHits() const;
+// [21] bsls::Types::Int64 numMisses() const;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -128,7 +134,11 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [18] REPRODUCE DRQS 134930805
+// [19] CLOCK EVICTION POLICY
+// [20] W-TINYLFU EVICTION POLICY
+// [21] STATISTICS
+// [22] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
@@ -1744,6 +1754,21 @@ void threadedTest1()
     }
 }
 
+const int k_NUM_LOOKED_UP_KEYS = 1000;
+
+extern "C" void *lookUpKeysThread(void *cache)
+    // Look up, with 'modifyEvictionQueue', each key in the range
+    // '[0 .. k_NUM_LOOKED_UP_KEYS)' in the 'ThreadArg::CacheType' object
+    // addressed by the specified 'cache'.
+{
+    ThreadArg::CacheType *cache_p = static_cast<ThreadArg::CacheType *>(cache);
+    for (int i = 0; i < k_NUM_LOOKED_UP_KEYS; ++i) {
+        ThreadArg::CacheType::ValuePtrType valuePtr;
+        cache_p->tryGetValue(&valuePtr, i, true);
+    }
+    return cache;
+}
+
 }  // close namespace threaded
 
 // TestDriver template
@@ -3003,11 +3028,12 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase5()
     const bsl::size_t    MAX_LENGTH = 9;
     bslma::TestAllocator scratch("scratch", veryVeryVeryVerbose);
 
-    // Testing FIFO and LRU without any item access.
+    // Testing FIFO, LRU, and CLOCK without any item access.
     {
         const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
             bdlcc::CacheEvictionPolicy::e_LRU,
-            bdlcc::CacheEvictionPolicy::e_FIFO
+            bdlcc::CacheEvictionPolicy::e_FIFO,
+            bdlcc::CacheEvictionPolicy::e_CLOCK
         };
 
         const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
@@ -4136,6 +4162,40 @@ void TestDriver<KEYTYPE, VALUETYPE, HASH, EQUAL>::testCase1()
 
 }  // close unnamed namespace
 
+// ============================================================================
+//                      HELPERS FOR EVICTION POLICY TESTS
+// ----------------------------------------------------------------------------
+
+namespace policyTest {
+
+void recordEviction(bsl::vector<int> *evicted, const bsl::shared_ptr<int>& v)
+    // Append the value referred to by the specified 'v' to the specified
+    // 'evicted'.
+{
+    evicted->push_back(*v);
+}
+
+struct KeyCollector {
+    // This 'struct' provides a visitor recording the visited keys.
+
+    bsl::vector<int> d_keys;
+
+    explicit KeyCollector(bslma::Allocator *basicAllocator)
+        // Create a 'KeyCollector' using the specified 'basicAllocator'.
+    : d_keys(basicAllocator)
+    {
+    }
+
+    bool operator()(int key, int)
+        // Record the specified 'key' and return 'true'.
+    {
+        d_keys.push_back(key);
+        return true;
+    }
+};
+
+}  // close namespace policyTest
+
 int main(int argc, char *argv[])
 {
     int test            = argc > 1 ? atoi(argv[1]) : 0;
@@ -4163,7 +4223,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 22: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4244,467 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 21: {
+        // --------------------------------------------------------------------
+        // STATISTICS
+        //
+        // Concerns:
+        //: 1 Each call to 'tryGetValue' is counted as either a hit or a miss,
+        //:   regardless of the eviction policy and of 'modifyEvictionQueue'.
+        //:
+        //: 2 Items evicted to enforce the watermarks or by 'popFront' are
+        //:   counted as evictions; items removed by 'erase', 'eraseBulk', and
+        //:   'clear' are not.
+        //:
+        //: 3 'resetStatistics' resets all counters to 0.
+        //:
+        //: 4 Hits and misses counted concurrently by several threads are all
+        //:   counted.
+        //
+        // Plan:
+        //: 1 For each eviction policy, perform a known sequence of operations
+        //:   and verify the value of the counters after each operation.
+        //:   (C-1..3)
+        //:
+        //: 2 For each eviction policy, look up present and absent keys from
+        //:   several threads, and verify the number of hits and misses.
+        //:   (C-4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numEvictions() const;
+        //   bsls::Types::Int64 numHits() const;
+        //   bsls::Types::Int64 numMisses() const;
+        //   void resetStatistics();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATISTICS" << endl
+                          << "==========" << endl;
+
+        typedef bdlcc::Cache<int, int> Obj;
+
+        const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
+            bdlcc::CacheEvictionPolicy::e_LRU,
+            bdlcc::CacheEvictionPolicy::e_FIFO,
+            bdlcc::CacheEvictionPolicy::e_CLOCK,
+            bdlcc::CacheEvictionPolicy::e_TINYLFU
+        };
+        const int NUM_POLICIES = static_cast<int>(sizeof POLICIES /
+                                                  sizeof *POLICIES);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const bdlcc::CacheEvictionPolicy::Enum POLICY = POLICIES[ti];
+
+            Obj mX(POLICY, 5, 10, &oa);  const Obj& X = mX;
+
+            ASSERTV(ti, 0 == X.numHits());
+            ASSERTV(ti, 0 == X.numMisses());
+            ASSERTV(ti, 0 == X.numEvictions());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERTV(ti, 0 == X.numEvictions());
+
+            bsl::shared_ptr<int> value;
+            for (int i = 0; i < 15; ++i) {
+                mX.tryGetValue(&value, i, 0 == i % 2);
+            }
+            ASSERTV(ti, X.numHits(),   10 == X.numHits());
+            ASSERTV(ti, X.numMisses(),  5 == X.numMisses());
+
+            mX.insert(10, 10);  // evicts 6 items, down to 4 items
+            ASSERTV(ti, X.size(),         5 == X.size());
+            ASSERTV(ti, X.numEvictions(), 6 == X.numEvictions());
+
+            ASSERTV(ti, 0 == mX.popFront());
+            ASSERTV(ti, X.numEvictions(), 7 == X.numEvictions());
+
+            ASSERTV(ti, 0 == mX.erase(10));
+            bsl::vector<int> keys(&oa);
+            for (int i = 0; i < 10; ++i) {
+                keys.push_back(i);
+            }
+            ASSERTV(ti, 3 == mX.eraseBulk(keys));
+            ASSERTV(ti, X.numEvictions(), 7 == X.numEvictions());
+            ASSERTV(ti, X.size(),         0 == X.size());
+
+            mX.insert(0, 0);
+            mX.clear();
+            ASSERTV(ti, X.numEvictions(), 7 == X.numEvictions());
+            ASSERTV(ti, X.numHits(),     10 == X.numHits());
+            ASSERTV(ti, X.numMisses(),    5 == X.numMisses());
+
+            mX.resetStatistics();
+            ASSERTV(ti, 0 == X.numHits());
+            ASSERTV(ti, 0 == X.numMisses());
+            ASSERTV(ti, 0 == X.numEvictions());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "	Concurrent lookups." << endl;
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const bdlcc::CacheEvictionPolicy::Enum POLICY = POLICIES[ti];
+
+            const int k_NUM_THREADS = 8;
+            const int k_NUM_ITEMS   = 100;
+            const int k_NUM_KEYS    = threaded::k_NUM_LOOKED_UP_KEYS;
+
+            Obj mX(POLICY, 2 * k_NUM_ITEMS, 2 * k_NUM_ITEMS, &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                mX.insert(i, i);
+            }
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(ti, i, 0 == bslmt::ThreadUtil::create(
+                                                   &handles[i],
+                                                   &threaded::lookUpKeysThread,
+                                                   &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(ti, X.numHits(),
+                    k_NUM_THREADS * k_NUM_ITEMS == X.numHits());
+            ASSERTV(ti, X.numMisses(),
+                    k_NUM_THREADS * (k_NUM_KEYS - k_NUM_ITEMS)
+                                                           == X.numMisses());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // W-TINYLFU EVICTION POLICY
+        //
+        // Concerns:
+        //: 1 The frequency sketch estimates are 0 for hash values never
+        //:   incremented, never underestimate the number of increments, and
+        //:   saturate at 15.
+        //:
+        //: 2 The counters of the sketch are halved after a number of
+        //:   increments proportional to its capacity, and reset by 'clear'.
+        //:
+        //: 3 The size of a W-TinyLFU cache is bounded by its high watermark,
+        //:   and every item is either in the cache or has been evicted.
+        //:
+        //: 4 'erase', 'clear', and 'visit' work on items held by every
+        //:   segment.
+        //:
+        //: 5 Frequently accessed items survive a scan of keys accessed only
+        //:   once, which is not the case with the LRU policy.
+        //
+        // Plan:
+        //: 1 Increment and query a 'Cache_FrequencySketch' object.  (C-1..2)
+        //:
+        //: 2 Insert and access keys with a post-eviction callback recording
+        //:   the evicted values, then verify the size and content of the
+        //:   cache.  Erase some keys, visit and clear the cache.  (C-3..4)
+        //:
+        //: 3 Access a set of "hot" keys several times, then insert many keys
+        //:   accessed only once, and count the hot keys remaining in the
+        //:   cache, for both W-TinyLFU and LRU.  (C-5)
+        //
+        // Testing:
+        //   W-TINYLFU EVICTION POLICY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "W-TINYLFU EVICTION POLICY" << endl
+                          << "=========================" << endl;
+
+        typedef bdlcc::Cache<int, int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tTesting 'Cache_FrequencySketch'." << endl;
+        {
+            bdlcc::Cache_FrequencySketch mX(&oa);
+            const bdlcc::Cache_FrequencySketch& X = mX;
+
+            ASSERT(0 == X.frequency(1));
+            mX.increment(1);                 // no counters yet
+            ASSERT(0 == X.frequency(1));
+
+            mX.reserve(1000);
+            for (bsl::size_t h = 0; h < 100; ++h) {
+                ASSERTV(h, 0 == X.frequency(h));
+            }
+
+            for (int i = 1; i <= 20; ++i) {
+                mX.increment(7);
+                ASSERTV(i, X.frequency(7),
+                        (i < 15 ? i : 15) <= X.frequency(7));
+            }
+            ASSERT(15 == X.frequency(7));
+
+            int numOverestimated = 0;
+            for (bsl::size_t h = 100; h < 200; ++h) {
+                mX.increment(h);
+                ASSERTV(h, 1 <= X.frequency(h));
+                numOverestimated += 1 < X.frequency(h);
+            }
+            ASSERTV(numOverestimated, numOverestimated < 10);
+
+            mX.clear();
+            ASSERT(0 == X.frequency(7));
+            ASSERT(0 == X.frequency(150));
+
+            // Counters are halved after '10 * capacity' increments.
+
+            for (int i = 0; i < 8; ++i) {
+                mX.increment(7);
+            }
+            ASSERT(8 == X.frequency(7));
+            for (bsl::size_t h = 1000; h < 1000 + 10 * 1000; ++h) {
+                mX.increment(h);
+            }
+            ASSERTV(X.frequency(7), 4 >= X.frequency(7));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting basic behavior." << endl;
+        {
+            bsl::vector<int> evicted(&oa);
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_TINYLFU, 150, 200, &oa);
+            const Obj& X = mX;
+            ASSERT(bdlcc::CacheEvictionPolicy::e_TINYLFU ==
+                                                          X.evictionPolicy());
+
+            mX.setPostEvictionCallback(
+                          Obj::PostEvictionCallback(
+                              bsl::allocator_arg,
+                              &oa,
+                              bdlf::BindUtil::bind(&policyTest::recordEviction,
+                                                   &evicted,
+                                                   bdlf::PlaceHolders::_1)));
+
+            const int NUM_KEYS = 2000;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(i, i);
+                ASSERTV(i, X.size(), X.size() <= 200);
+
+                bsl::shared_ptr<int> value;
+                if (0 == mX.tryGetValue(&value, i / 2)) {
+                    ASSERTV(i, *value, i / 2 == *value);
+                }
+            }
+
+            bsl::vector<bool> seen(NUM_KEYS, false, &oa);
+            for (bsl::size_t i = 0; i < evicted.size(); ++i) {
+                ASSERTV(i, evicted[i], !seen[evicted[i]]);
+                seen[evicted[i]] = true;
+            }
+            ASSERTV(evicted.size(), X.size(),
+                    NUM_KEYS == static_cast<int>(evicted.size() + X.size()));
+
+            policyTest::KeyCollector collector(&oa);
+            X.visit(collector);
+            ASSERTV(collector.d_keys.size(),
+                    X.size() == collector.d_keys.size());
+
+            for (bsl::size_t i = 0; i < collector.d_keys.size(); ++i) {
+                const int KEY = collector.d_keys[i];
+                ASSERTV(i, KEY, !seen[KEY]);
+
+                if (0 == i % 3) {
+                    ASSERTV(i, KEY, 0 == mX.erase(KEY));
+                    ASSERTV(i, KEY, 1 == mX.erase(KEY));
+                }
+            }
+            ASSERTV(X.size(), X.size() == collector.d_keys.size()
+                                        - (collector.d_keys.size() + 2) / 3);
+
+            mX.clear();
+            ASSERT(0 == X.size());
+
+            mX.insert(1, 1);
+            bsl::shared_ptr<int> value;
+            ASSERT(0 == mX.tryGetValue(&value, 1));
+            ASSERT(1 == *value);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting scan resistance." << endl;
+        {
+            const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
+                bdlcc::CacheEvictionPolicy::e_TINYLFU,
+                bdlcc::CacheEvictionPolicy::e_LRU
+            };
+
+            const int NUM_HOT = 50;
+
+            for (int ti = 0; ti < 2; ++ti) {
+                const bdlcc::CacheEvictionPolicy::Enum POLICY = POLICIES[ti];
+
+                Obj mX(POLICY, 100, 100, &oa);
+
+                bsl::shared_ptr<int> value;
+                for (int i = 0; i < NUM_HOT; ++i) {
+                    mX.insert(i, i);
+                }
+                for (int j = 0; j < 5; ++j) {
+                    for (int i = 0; i < NUM_HOT; ++i) {
+                        ASSERTV(ti, i, 0 == mX.tryGetValue(&value, i));
+                    }
+                }
+
+                for (int i = 1000; i < 3000; ++i) {
+                    mX.insert(i, i);
+                }
+
+                int numHot = 0;
+                for (int i = 0; i < NUM_HOT; ++i) {
+                    numHot += 0 == mX.tryGetValue(&value, i, false);
+                }
+
+                if (veryVerbose) { P_(POLICY) P(numHot) }
+
+                if (bdlcc::CacheEvictionPolicy::e_TINYLFU == POLICY) {
+                    ASSERTV(numHot, numHot >= NUM_HOT - 5);
+                }
+                else {
+                    ASSERTV(numHot, 0 == numHot);
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // CLOCK EVICTION POLICY
+        //
+        // Concerns:
+        //: 1 Without any access, CLOCK evicts items in the order of insertion.
+        //:
+        //: 2 An item accessed through 'tryGetValue' (with
+        //:   'modifyEvictionQueue' set to 'true') or re-inserted is given a
+        //:   second chance: it is skipped, and moved to the back of the
+        //:   eviction queue, the next time it reaches the front of the queue.
+        //:
+        //: 3 An item accessed with 'modifyEvictionQueue' set to 'false' is
+        //:   not given a second chance.
+        //:
+        //: 4 A second chance is granted only once per access.
+        //:
+        //: 5 'tryGetValue' on a CLOCK cache acquires only a read lock.
+        //
+        // Plan:
+        //: 1 Insert items into a CLOCK cache, access some of them, and verify
+        //:   the order of evicted items using the post-eviction callback and
+        //:   the order of the remaining items using 'visit'.  (C-1..4)
+        //:
+        //: 2 Hold a read lock using 'Cache_TestUtil' while calling
+        //:   'tryGetValue'.  (C-5)
+        //
+        // Testing:
+        //   CLOCK EVICTION POLICY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLOCK EVICTION POLICY" << endl
+                          << "=====================" << endl;
+
+        typedef bdlcc::Cache<int, int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<int> evicted(&oa);
+        Obj::PostEvictionCallback callback(
+                       bsl::allocator_arg,
+                       &oa,
+                       bdlf::BindUtil::bind(&policyTest::recordEviction,
+                                            &evicted,
+                                            bdlf::PlaceHolders::_1));
+        {
+            bsl::shared_ptr<int> value;
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 4, 4, &oa);
+            const Obj& X = mX;
+            ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == X.evictionPolicy());
+            mX.setPostEvictionCallback(callback);
+
+            for (int i = 0; i < 4; ++i) {
+                mX.insert(i, 100 + i);
+            }
+
+            // Access item 0 with a second chance, item 1 without.
+
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            ASSERT(100 == *value);
+            ASSERT(0 == mX.tryGetValue(&value, 1, false));
+            ASSERT(101 == *value);
+
+            mX.insert(4, 104);   // evicts 1 (0 gets a second chance)
+
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], 101 == evicted[0]);
+
+            policyTest::KeyCollector collector(&oa);
+            X.visit(collector);
+            const int EXP[] = { 2, 3, 0, 4 };
+            ASSERTV(collector.d_keys.size(), 4 == collector.d_keys.size());
+            for (bsl::size_t i = 0; i < collector.d_keys.size(); ++i) {
+                ASSERTV(i, collector.d_keys[i], EXP[i] == collector.d_keys[i]);
+            }
+
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            mX.insert(5, 105);   // evicts 3, after skipping 2
+
+            ASSERTV(evicted.size(), 2 == evicted.size());
+            ASSERTV(evicted[1], 103 == evicted[1]);
+
+            // 0 has already used its second chance.
+
+            mX.insert(6, 106);   // evicts 0
+            ASSERTV(evicted.size(), 3 == evicted.size());
+            ASSERTV(evicted[2], 100 == evicted[2]);
+
+            ASSERT(0 == mX.popFront());  // evicts 4
+            ASSERTV(evicted.size(), 4 == evicted.size());
+            ASSERTV(evicted[3], 104 == evicted[3]);
+
+            ASSERT(0 == mX.tryGetValue(&value, 2));
+            ASSERT(102 == *value);
+            ASSERT(3 == X.size());
+        }
+        evicted.clear();
+        {
+            // Re-inserting an item also grants a second chance, without
+            // moving the item.
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 3, 3, &oa);
+            mX.setPostEvictionCallback(callback);
+
+            mX.insert(0, 100);
+            mX.insert(1, 101);
+            mX.insert(0, 200);
+            mX.insert(2, 102);
+            ASSERT(evicted.empty());
+
+            mX.insert(3, 103);   // evicts 1, after skipping 0
+            ASSERTV(evicted.size(), 1 == evicted.size());
+            ASSERTV(evicted[0], 101 == evicted[0]);
+        }
+        {
+            bsl::shared_ptr<int> value;
+
+            Obj mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 4, 4, &oa);
+            mX.insert(0, 0);
+
+            bdlcc::Cache_TestUtil<int, int> testUtil(mX);
+            testUtil.lockRead();
+            ASSERT(0 == mX.tryGetValue(&value, 0));
+            testUtil.unlock();
+        }
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
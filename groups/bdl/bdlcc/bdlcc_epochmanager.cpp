@@ -0,0 +1,341 @@
+// bdlcc_epochmanager.cpp                                             -*-C++-*-
+
+#include <bdlcc_epochmanager.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_epochmanager_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_bslexceptionutil.h>
+
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Uint64 s_nextId = { 0 };
+    // identifier of the most recently created epoch manager
+
+bslmt::Once s_recordsKeyOnce = BSLMT_ONCE_INITIALIZER;
+    // guards the creation of 'EpochManager::s_recordsKey'
+
+}  // close unnamed namespace
+
+                            // ------------------
+                            // class EpochManager
+                            // ------------------
+
+// CLASS DATA
+bslmt::ThreadUtil::Key EpochManager::s_recordsKey;
+
+// PRIVATE CLASS METHODS
+void EpochManager::initializeRecordsKey()
+{
+    bslmt::Once::OnceLock onceLock;
+    if (s_recordsKeyOnce.enter(&onceLock)) {
+        int rc = bslmt::ThreadUtil::createKey(
+                               &s_recordsKey,
+                               (bslmt::ThreadUtil::Destructor)&releaseRecords);
+        if (0 != rc) {
+            // Let a subsequent epoch manager try again.
+
+            s_recordsKeyOnce.cancel(&onceLock);
+            bsls::BslExceptionUtil::throwBadAlloc();
+        }
+        s_recordsKeyOnce.leave(&onceLock);
+    }
+}
+
+void EpochManager::releaseOwnership(Record *record, int owner)
+{
+    if (0 == record->d_owners.add(-owner)) {
+        bslma::Allocator *allocator = record->d_allocator_p;
+        record->~Record();
+        allocator->deallocate(record);
+    }
+}
+
+void EpochManager::releaseRecords(void *records)
+{
+    Record *record = static_cast<Record *>(records);
+    while (record) {
+        BSLS_ASSERT(0 == record->d_nesting);
+
+        Record *next = record->d_threadNext_p;
+        record->d_state = 0;
+        releaseOwnership(record, Record::k_OWNED_BY_THREAD);
+        record = next;
+    }
+}
+
+void EpochManager::releaseThreadRecord(Record *record)
+{
+    BSLS_ASSERT(0 == record->d_nesting);
+
+    Record *records = static_cast<Record *>(
+                                bslmt::ThreadUtil::getSpecific(s_recordsKey));
+    if (records == record) {
+        int rc = bslmt::ThreadUtil::setSpecific(s_recordsKey,
+                                                record->d_threadNext_p);
+        BSLS_ASSERT(0 == rc);  // The key of the thread already has a value.
+        (void)rc;
+    }
+    else {
+        Record *previous = records;
+        while (previous->d_threadNext_p != record) {
+            previous = previous->d_threadNext_p;
+        }
+        previous->d_threadNext_p = record->d_threadNext_p;
+    }
+
+    record->d_state = 0;
+    releaseOwnership(record, Record::k_OWNED_BY_THREAD);
+}
+
+// PRIVATE MANIPULATORS
+EpochManager::Record *EpochManager::acquireRecord()
+{
+    Record *record = 0;
+
+    for (Record *r = d_records.loadAcquire(); r; r = r->d_next_p) {
+        if (Record::k_OWNED_BY_MANAGER == r->d_owners.loadRelaxed()
+         && Record::k_OWNED_BY_MANAGER == r->d_owners.testAndSwap(
+                                                 Record::k_OWNED_BY_MANAGER,
+                                                 Record::k_OWNED_BY_MANAGER
+                                               | Record::k_OWNED_BY_THREAD)) {
+            record = r;
+            break;
+        }
+    }
+
+    if (!record) {
+        record = new (*d_allocator_p) Record();
+        record->d_owners.storeRelaxed(Record::k_OWNED_BY_MANAGER
+                                    | Record::k_OWNED_BY_THREAD);
+        record->d_managerId   = d_id;
+        record->d_allocator_p = d_allocator_p;
+
+        Record *head = d_records.loadRelaxed();
+        do {
+            record->d_next_p = head;
+            Record *previous = d_records.testAndSwap(head, record);
+            if (previous == head) {
+                break;
+            }
+            head = previous;
+        } while (true);
+    }
+
+    record->d_nesting = 0;
+    record->d_state   = 0;
+
+    // Link the record at the front of the list of the calling thread.  The
+    // list is modified only once the record is installed, so that it is left
+    // unchanged if the installation fails.
+
+    Record *records = static_cast<Record *>(
+                                bslmt::ThreadUtil::getSpecific(s_recordsKey));
+    record->d_threadNext_p = records;
+    if (0 != bslmt::ThreadUtil::setSpecific(s_recordsKey, record)) {
+        releaseOwnership(record, Record::k_OWNED_BY_THREAD);
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    // Release the records of the calling thread whose epoch manager has been
+    // destroyed.
+
+    Record *previous = record;
+    while (Record *r = previous->d_threadNext_p) {
+        if (Record::k_OWNED_BY_THREAD == r->d_owners.loadAcquire()) {
+            previous->d_threadNext_p = r->d_threadNext_p;
+            releaseOwnership(r, Record::k_OWNED_BY_THREAD);
+        }
+        else {
+            previous = r;
+        }
+    }
+
+    return record;
+}
+
+bool EpochManager::tryAdvance()
+{
+    // The full fence (or read-modify-write operation) orders the unlinking of
+    // the objects retired by the calling thread before the scan of the
+    // records, and pairs with the one in 'pin' (see 'pin').
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    const bsls::Types::Uint64 epoch = d_epoch;
+    bsl::atomic_thread_fence(bsl::memory_order_seq_cst);
+#else
+    const bsls::Types::Uint64 epoch = d_epoch.add(0);
+#endif
+
+    for (Record *r = d_records.loadAcquire(); r; r = r->d_next_p) {
+        const bsls::Types::Uint64 state = r->d_state;
+        if ((state & 1) && (state >> 1) != epoch) {
+            return false;                                             // RETURN
+        }
+    }
+
+    d_epoch.testAndSwap(epoch, epoch + 1);
+    return true;
+}
+
+// PRIVATE ACCESSORS
+EpochManager::Record *EpochManager::findRecord(Record *records) const
+{
+    Record *previous = 0;
+    for (Record *r = records; r; previous = r, r = r->d_threadNext_p) {
+        if (d_id != r->d_managerId) {
+            continue;
+        }
+        if (previous) {
+            // Move the record to the front of the list, unless the list
+            // cannot be updated, in which case it is left unchanged.
+
+            previous->d_threadNext_p = r->d_threadNext_p;
+            r->d_threadNext_p        = records;
+            if (0 != bslmt::ThreadUtil::setSpecific(s_recordsKey, r)) {
+                r->d_threadNext_p        = previous->d_threadNext_p;
+                previous->d_threadNext_p = r;
+            }
+        }
+        return r;                                                     // RETURN
+    }
+    return 0;
+}
+
+// CREATORS
+EpochManager::EpochManager(bslma::Allocator *basicAllocator)
+: d_epoch(1)
+, d_records(0)
+, d_id(bsls::AtomicOperations::addUint64Nv(&s_nextId, 1))
+, d_retired(basicAllocator)
+, d_numRetirements(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initializeRecordsKey();
+}
+
+EpochManager::~EpochManager()
+{
+    for (bsl::size_t i = 0; i < d_retired.size(); ++i) {
+        d_retired[i].d_deleter(d_retired[i].d_object_p,
+                               d_retired[i].d_context_p);
+    }
+
+    // The record of the calling thread can be released now; the records of
+    // the other threads are destroyed by those threads once they no longer
+    // refer to them.
+
+    unregisterThread();
+
+    Record *record = d_records.loadRelaxed();
+    while (record) {
+        BSLS_ASSERT(0 == (record->d_state.loadRelaxed() & 1));
+
+        Record *next = record->d_next_p;
+        releaseOwnership(record, Record::k_OWNED_BY_MANAGER);
+        record = next;
+    }
+}
+
+// MANIPULATORS
+void EpochManager::registerThread()
+{
+    if (!lookupRecord()) {
+        acquireRecord();
+    }
+}
+
+bsl::size_t EpochManager::reclaim()
+{
+    tryAdvance();
+
+    bsl::vector<Retired> reclaimable(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+
+        const bsls::Types::Uint64 epoch = d_epoch;
+
+        bsl::vector<Retired>::iterator end = d_retired.begin();
+        while (end != d_retired.end() && end->d_epoch + 2 <= epoch) {
+            ++end;
+        }
+        reclaimable.assign(d_retired.begin(), end);
+        d_retired.erase(d_retired.begin(), end);
+    }
+
+    for (bsl::size_t i = 0; i < reclaimable.size(); ++i) {
+        reclaimable[i].d_deleter(reclaimable[i].d_object_p,
+                                 reclaimable[i].d_context_p);
+    }
+    return reclaimable.size();
+}
+
+void EpochManager::retire(void *object, Deleter deleter, void *context)
+{
+    BSLS_ASSERT(deleter);
+
+    bool reclaimNow;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+
+        Retired retired;
+        retired.d_object_p  = object;
+        retired.d_deleter   = deleter;
+        retired.d_context_p = context;
+        retired.d_epoch     = d_epoch;
+
+        d_retired.push_back(retired);
+
+        reclaimNow = 0 == ++d_numRetirements % k_RECLAIM_INTERVAL;
+    }
+
+    if (reclaimNow) {
+        reclaim();
+    }
+}
+
+void EpochManager::unregisterThread()
+{
+    Record *record = lookupRecord();
+    if (record) {
+        releaseThreadRecord(record);
+    }
+}
+
+// ACCESSORS
+bsl::size_t EpochManager::numRetired() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_retiredLock);
+
+    return d_retired.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,687 @@
+// bdlcc_epochmanager.h                                               -*-C++-*-
+
+#ifndef INCLUDED_BDLCC_EPOCHMANAGER
+#define INCLUDED_BDLCC_EPOCHMANAGER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide epoch-based reclamation of memory shared with readers.
+//
+//@CLASSES:
+//  bdlcc::EpochManager: epoch-based deferred reclamation of retired objects
+//  bdlcc::EpochGuard: scoped guard pinning the calling thread to an epoch
+//
+//@SEE_ALSO: bdlcc_singlewriterskipmap
+//
+//@DESCRIPTION: This component provides a mechanism, 'bdlcc::EpochManager',
+// that allows a concurrent data structure to free the objects it unlinks
+// (e.g., the nodes of a linked list) while other threads, *readers*, may still
+// be traversing them without holding any lock.  Readers bracket each access to
+// the data structure with a 'bdlcc::EpochGuard' (or with calls to 'enter' and
+// 'leave'), and a thread that unlinks an object from the data structure hands
+// it to 'retire' instead of destroying it.  A retired object is destroyed,
+// using the deleter supplied to 'retire', once every reader that might have
+// obtained a reference to it has left the data structure.
+//
+// This component is the basis of read paths that never block on, or wait
+// for, threads modifying the data structure, such as those of
+// 'bdlcc::SingleWriterSkipMap'.
+//
+///Epochs
+///------
+// An epoch manager maintains a global *epoch* counter, and each thread that
+// enters the manager publishes the epoch that it observed on entry.  Each
+// retired object is tagged with the epoch current at the time it was retired.
+// The global epoch may advance from 'E' to 'E + 1' only when every thread
+// currently within the manager has observed 'E', and an object retired during
+// epoch 'E' is destroyed once the global epoch has reached 'E + 2', at which
+// point every thread that was inside the manager when the object was unlinked
+// has left.
+//
+// Attempts to advance the epoch, and to destroy the retired objects that have
+// become safe to destroy, are made by 'reclaim', which 'retire' also invokes
+// after every 'k_RECLAIM_INTERVAL' retirements.  Note that a thread that
+// remains within an epoch manager indefinitely prevents the reclamation of
+// every object retired after it entered.
+//
+///Cost of Entering and Leaving
+///----------------------------
+// Entering an epoch manager requires loading the global epoch, storing it to a
+// record owned by the calling thread, and a full memory fence, which keeps the
+// loads of shared data that follow 'enter' from being performed before the
+// store is visible to a thread attempting to advance the epoch; leaving
+// requires a single release store to that record.  On platforms lacking the
+// C++11 standard library, the store is instead an atomic read-modify-write
+// operation, which acts as a full fence.  Neither operation acquires a lock or
+// writes to memory shared with other readers, except the first time a thread
+// enters a given epoch manager, when a record is assigned to that thread.
+// Entering is reentrant: only the outermost 'enter' and 'leave' of a thread
+// publish its epoch.
+//
+// Each thread keeps the records assigned to it, by every epoch manager it has
+// entered, in a list that is shared by all epoch managers through a single
+// thread-specific storage key, created when the first epoch manager is
+// created.  Consequently, the number of epoch managers that may exist in a
+// process is not limited by the number of thread-specific storage keys, and
+// an epoch manager can be embedded in each instance of a container.  Finding
+// the record of a thread takes time linear in the number of epoch managers
+// that the thread has entered, but the most recently used record is found
+// first.  Threads that access many containers may therefore benefit from
+// having the containers share a single epoch manager, where the containers
+// support it (e.g., 'bdlcc::SnapshotHolder').
+//
+// The record of a thread is returned to its epoch manager, for use by other
+// threads, when the thread exits.  If the epoch manager is destroyed first,
+// the record is released by the destructor if it belongs to the calling
+// thread and, otherwise, when its thread exits or is next assigned a record by
+// any epoch manager, at which point its memory is returned to the allocator
+// of the (destroyed) epoch manager.
+//
+///Thread Registration
+///-------------------
+// A thread may call 'registerThread' to be assigned its record ahead of its
+// first 'enter' (e.g., when a reader thread of a latency-sensitive data
+// structure starts), so that none of its subsequent entries allocates memory
+// or performs an atomic read-modify-write operation on shared memory.  A
+// thread that will not enter the epoch manager again, but does not exit, may
+// call 'unregisterThread' to make its record available to other threads.  The
+// number of records of an epoch manager is the largest number of threads
+// simultaneously registered with it, whether explicitly or by entering it.
+//
+///Retiring Objects
+///----------------
+// An object may be retired either with a user-supplied 'Deleter' and context
+// (see 'retire'), or, if it was created with a 'bslma::Allocator', with that
+// allocator (see 'retireObject'), in which case it is destroyed and its
+// memory returned to the allocator as if by 'bslma::DeleterHelper'.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::EpochManager' is fully *thread-safe*, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.  Deleters supplied to 'retire' are invoked, without any lock held,
+// by the thread calling 'reclaim' or 'retire', or by the destructor.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Configuration Value Replaced by One Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads read a configuration string that is occasionally
+// replaced by a single administrative thread, and we want the readers to
+// neither take a lock nor modify any reference count.
+//
+// First, we define the configuration holder, which publishes the current
+// string through an atomic pointer, and a deleter that destroys a retired
+// string:
+//..
+//  void deleteString(void *string, void *)
+//      // Destroy the specified 'string'.
+//  {
+//      delete static_cast<bsl::string *>(string);
+//  }
+//
+//  class Configuration {
+//      // This class holds a string that can be read concurrently with the
+//      // replacement of its value by a single writer.
+//
+//      // DATA
+//      mutable bdlcc::EpochManager      d_epochManager;
+//      bsls::AtomicPointer<bsl::string> d_value_p;
+//
+//    public:
+//      // CREATORS
+//      Configuration()
+//      : d_value_p(new bsl::string())
+//      {
+//      }
+//
+//      ~Configuration()
+//      {
+//          delete d_value_p.load();
+//      }
+//
+//      // MANIPULATORS
+//      void setValue(const bsl::string& value)
+//          // Set the value of this configuration to the specified 'value'.
+//      {
+//          bsl::string *previous = d_value_p.swap(new bsl::string(value));
+//          d_epochManager.retire(previous, &deleteString);
+//      }
+//
+//      // ACCESSORS
+//      bsl::size_t length() const
+//          // Return the length of the value of this configuration.
+//      {
+//          bdlcc::EpochGuard guard(&d_epochManager);
+//
+//          return d_value_p.loadAcquire()->length();
+//      }
+//  };
+//..
+// Then, a reader can use the string for as long as its guard is in scope:
+//..
+//  Configuration configuration;
+//  configuration.setValue("server=primary");
+//  assert(14 == configuration.length());
+//..
+// Finally, when the value is replaced again, the previous value is retired,
+// and is destroyed by a later call to 'reclaim' (made by 'retire' every
+// 'k_RECLAIM_INTERVAL' retirements) or, at the latest, by the destructor of
+// the epoch manager:
+//..
+//  configuration.setValue("server=backup");
+//  assert(13 == configuration.length());
+//..
+//
+///Example 2: Registering Readers and Retiring Allocated Objects
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the objects shared with readers are created with a
+// 'bslma::Allocator', and that reader threads should not allocate memory when
+// they first access the shared data.
+//
+// First, we create an epoch manager, and register the calling thread, as each
+// reader thread would on startup:
+//..
+//  bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+//
+//  bdlcc::EpochManager manager(allocator);
+//  manager.registerThread();
+//  assert(manager.isRegistered());
+//..
+// Then, a writer creates an object with the allocator, publishes it, and,
+// once it has been unlinked, retires it with the same allocator:
+//..
+//  bsl::vector<int> *numbers = new (*allocator) bsl::vector<int>(allocator);
+//  numbers->push_back(42);
+//
+//  manager.retireObject(numbers, allocator);
+//  assert(1 == manager.numRetired());
+//..
+// Next, once no reader is within the manager, two calls to 'reclaim' advance
+// the epoch twice, destroying the vector and returning its memory:
+//..
+//  manager.reclaim();
+//  manager.reclaim();
+//  assert(0 == manager.numRetired());
+//..
+// Finally, a reader thread that stops reading the shared data, but keeps
+// running, releases its record for use by other threads:
+//..
+//  manager.unregisterThread();
+//  assert(!manager.isRegistered());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deleterhelper.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_libraryfeatures.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+#include <bsl_atomic.h>      // 'atomic_thread_fence'
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ==========================
+                        // struct EpochManager_Record
+                        // ==========================
+
+struct EpochManager_Record {
+    // This component-private 'struct' holds the state that a thread publishes
+    // to an 'EpochManager'.  Records are linked in a list that only grows
+    // during the lifetime of their manager, and each record is assigned to
+    // at most one thread at a time, which also links it in the list of the
+    // records of that thread.  A record is destroyed by whichever of its
+    // manager and its thread releases it last.
+
+    // TYPES
+    enum {
+        k_OWNED_BY_MANAGER = 1,  // the manager of the record is alive
+        k_OWNED_BY_THREAD  = 2   // the record is assigned to a thread
+    };
+
+    // DATA
+    bsls::AtomicUint64   d_state;         // '(epoch << 1) | 1' while the
+                                          // owner is within the manager, and
+                                          // 0 otherwise
+
+    bsls::AtomicInt      d_owners;        // combination of 'k_OWNED_BY_*'
+                                          // flags
+
+    int                  d_nesting;       // depth of 'enter' calls of the
+                                          // owner (accessed by the owner
+                                          // only)
+
+    EpochManager_Record *d_next_p;        // next record of the manager
+                                          // (immutable once published)
+
+    EpochManager_Record *d_threadNext_p;  // next record of the owner
+                                          // (accessed by the owner only)
+
+    bsls::Types::Uint64  d_managerId;     // unique identifier of the
+                                          // manager (immutable)
+
+    bslma::Allocator    *d_allocator_p;   // allocator of the manager, used
+                                          // to free the record (held)
+};
+
+                            // ==================
+                            // class EpochManager
+                            // ==================
+
+class EpochManager {
+    // This class provides a mechanism that defers the destruction of retired
+    // objects until no thread that entered this epoch manager before their
+    // retirement remains within it.
+
+  public:
+    // TYPES
+    typedef void (*Deleter)(void *object, void *context);
+        // 'Deleter' is an alias for a function that destroys the specified
+        // 'object', given the specified 'context' supplied at its retirement.
+
+    // CONSTANTS
+    enum { k_RECLAIM_INTERVAL = 64 };  // number of retirements between the
+                                       // calls to 'reclaim' made by 'retire'
+
+  private:
+    // PRIVATE TYPES
+    typedef EpochManager_Record Record;
+
+    struct Retired {
+        // This 'struct' describes an object awaiting reclamation.
+
+        void                *d_object_p;  // retired object
+        Deleter              d_deleter;   // destroys 'd_object_p'
+        void                *d_context_p; // passed to 'd_deleter'
+        bsls::Types::Uint64  d_epoch;     // epoch of retirement
+    };
+
+    // CLASS DATA
+    static bslmt::ThreadUtil::Key s_recordsKey;  // key of the list of the
+                                                 // records of each thread,
+                                                 // shared by all managers
+
+    // DATA
+    bsls::AtomicUint64           d_epoch;        // global epoch
+
+    bsls::AtomicPointer<Record>  d_records;      // list of all records
+
+    bsls::Types::Uint64          d_id;           // unique identifier of this
+                                                 // epoch manager
+
+    mutable bslmt::Mutex         d_retiredLock;  // guards 'd_retired' and
+                                                 // 'd_numRetirements'
+
+    bsl::vector<Retired>         d_retired;      // retired objects, in
+                                                 // non-decreasing epoch order
+
+    bsls::Types::Uint64          d_numRetirements;
+                                                 // number of calls to
+                                                 // 'retire'
+
+    bslma::Allocator            *d_allocator_p;  // memory allocator (held,
+                                                 // not owned)
+
+    // FRIENDS
+    friend class EpochGuard;
+
+    // NOT IMPLEMENTED
+    EpochManager(const EpochManager&);
+    EpochManager& operator=(const EpochManager&);
+
+    // PRIVATE CLASS METHODS
+    template <class TYPE>
+    static void deleteObject(void *object, void *allocator);
+        // Destroy the specified 'object', of the template parameter 'TYPE',
+        // and return its memory to the specified 'allocator'.  This function
+        // is the deleter of the objects retired by 'retireObject'.
+
+    static void initializeRecordsKey();
+        // Create the thread-specific storage key shared by all epoch managers
+        // if it has not been created yet.  Throw 'bsl::bad_alloc' if the key
+        // cannot be created.
+
+    static void releaseOwnership(Record *record, int owner);
+        // Release the ownership of the specified 'record' by the specified
+        // 'owner', and destroy 'record' if it has no other owner.  The
+        // behavior is undefined unless 'owner' is one of the 'k_OWNED_BY_*'
+        // flags of 'record'.
+
+    static void releaseRecords(void *records);
+        // Return each record in the specified 'records' list to the epoch
+        // manager that assigned it.  This function is the destructor of the
+        // thread-specific storage key, and is invoked when a thread exits.
+
+    static void releaseThreadRecord(Record *record);
+        // Unlink the specified 'record' from the list of the records of the
+        // calling thread, and return it to the epoch manager that assigned
+        // it.  The behavior is undefined unless 'record' is assigned to the
+        // calling thread.
+
+    // PRIVATE MANIPULATORS
+    Record *acquireRecord();
+        // Assign a record to the calling thread, reusing a record released
+        // by an exited thread if one is available, and return it.  Also
+        // release the records of the calling thread whose epoch manager has
+        // been destroyed.  Throw 'bsl::bad_alloc' if the list of the records
+        // of the calling thread cannot be updated.
+
+    bool tryAdvance();
+        // Advance the global epoch of this epoch manager if every thread
+        // within it has observed the current epoch.  Return 'true' if the
+        // epoch advanced (by this or another thread), and 'false' otherwise.
+
+    Record *pin();
+        // Enter this epoch manager from the calling thread, and return the
+        // record of the calling thread.
+
+    void unpin(Record *record);
+        // Leave this epoch manager from the calling thread, whose record is
+        // the specified 'record'.
+
+    // PRIVATE ACCESSORS
+    Record *findRecord(Record *records) const;
+        // Return the record assigned by this epoch manager in the specified
+        // 'records' list of the calling thread, moving it to the front of
+        // the list, or 0 if there is no such record.
+
+    Record *lookupRecord() const;
+        // Return the record assigned by this epoch manager to the calling
+        // thread, or 0 if the calling thread is not registered.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EpochManager, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit EpochManager(bslma::Allocator *basicAllocator = 0);
+        // Create an epoch manager having no retired objects.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Throw 'bsl::bad_alloc' if the thread-specific storage key
+        // shared by all epoch managers does not exist and cannot be created.
+
+    ~EpochManager();
+        // Destroy every object retired to this epoch manager, then destroy
+        // this object.  The behavior is undefined unless no thread is within
+        // this epoch manager.  Note that the records of the threads other
+        // than the calling thread are released when those threads exit (see
+        // {Cost of Entering and Leaving}), so that the allocator of this
+        // object must remain valid until then.
+
+    // MANIPULATORS
+    void enter();
+        // Enter this epoch manager from the calling thread: no object retired
+        // after this call is destroyed until the calling thread invokes
+        // 'leave' as many times as it has invoked 'enter'.
+
+    void leave();
+        // Leave this epoch manager from the calling thread.  The behavior is
+        // undefined unless the calling thread has invoked 'enter' more times
+        // than it has invoked 'leave'.
+
+    void registerThread();
+        // Assign to the calling thread, if it does not have one already, the
+        // record that it uses to enter this epoch manager, so that subsequent
+        // calls to 'enter' and 'leave' by the calling thread neither allocate
+        // memory nor perform an atomic read-modify-write operation on shared
+        // memory.  Note
+        // that a thread that enters this epoch manager without having called
+        // this method is registered on its first entry.
+
+    bsl::size_t reclaim();
+        // Attempt to advance the epoch of this epoch manager, and destroy the
+        // retired objects that no thread within this epoch manager can refer
+        // to.  Return the number of objects destroyed.
+
+    void retire(void *object, Deleter deleter, void *context = 0);
+        // Schedule the specified 'object' to be destroyed by invoking the
+        // specified 'deleter' with 'object' and the optionally specified
+        // 'context' once no thread that is within this epoch manager at the
+        // time of this call remains within it.  The behavior is undefined
+        // unless 'object' can no longer be reached by a thread entering this
+        // epoch manager after this call.
+
+    template <class TYPE>
+    void retireObject(TYPE *object, bslma::Allocator *allocator);
+        // Schedule the specified 'object' to be destroyed, and its memory
+        // returned to the specified 'allocator', once no thread that is
+        // within this epoch manager at the time of this call remains within
+        // it.  The behavior is undefined unless 'object' was created using
+        // 'allocator' (e.g., with 'bslma::Allocator::operator new') and can no
+        // longer be reached by a thread entering this epoch manager after
+        // this call.
+
+    void unregisterThread();
+        // Return the record of the calling thread, if any, to this epoch
+        // manager for use by other threads.  The calling thread will be
+        // registered again if it subsequently enters this epoch manager.  The
+        // behavior is undefined if the calling thread is within this epoch
+        // manager.  Note that the record of a thread is returned
+        // automatically when the thread exits.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this epoch manager to supply memory.
+
+    bsls::Types::Uint64 epoch() const;
+        // Return a snapshot of the global epoch of this epoch manager.
+
+    bool isEntered() const;
+        // Return 'true' if the calling thread is within this epoch manager,
+        // and 'false' otherwise.
+
+    bool isRegistered() const;
+        // Return 'true' if the calling thread is registered with this epoch
+        // manager, and 'false' otherwise.
+
+    bsl::size_t numRetired() const;
+        // Return a snapshot of the number of objects retired to this epoch
+        // manager that have not yet been destroyed.
+};
+
+                             // ================
+                             // class EpochGuard
+                             // ================
+
+class EpochGuard {
+    // This class implements a guard that keeps the calling thread within an
+    // epoch manager for its lifetime.
+
+    // DATA
+    EpochManager        *d_manager_p;  // guarded epoch manager (held)
+
+    EpochManager_Record *d_record_p;   // record of the calling thread
+
+    // NOT IMPLEMENTED
+    EpochGuard(const EpochGuard&);
+    EpochGuard& operator=(const EpochGuard&);
+
+  public:
+    // CREATORS
+    explicit EpochGuard(EpochManager *manager);
+        // Create a guard that enters the specified epoch 'manager' from the
+        // calling thread.
+
+    ~EpochGuard();
+        // Leave the epoch manager guarded by this object, then destroy this
+        // object.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class EpochManager
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+void EpochManager::deleteObject(void *object, void *allocator)
+{
+    bslma::DeleterHelper::deleteObject(
+                                 static_cast<TYPE *>(object),
+                                 static_cast<bslma::Allocator *>(allocator));
+}
+
+// PRIVATE MANIPULATORS
+inline
+EpochManager::Record *EpochManager::pin()
+{
+    Record *record = lookupRecord();
+    if (!record) {
+        record = acquireRecord();
+    }
+
+    if (0 == record->d_nesting++) {
+        // A store followed by acquire loads provides no store-load ordering:
+        // the full fence (or read-modify-write operation) ensures that either
+        // 'tryAdvance' observes the pin, or the loads of shared data that
+        // follow it observe every object unlinked before the epoch advanced.
+        // It pairs with the fence in 'tryAdvance'.
+
+        const bsls::Types::Uint64 state = (d_epoch.loadAcquire() << 1) | 1;
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+        record->d_state = state;
+        bsl::atomic_thread_fence(bsl::memory_order_seq_cst);
+#else
+        record->d_state.swap(state);
+#endif
+    }
+    return record;
+}
+
+inline
+void EpochManager::unpin(Record *record)
+{
+    BSLS_ASSERT(0 < record->d_nesting);
+
+    if (0 == --record->d_nesting) {
+        record->d_state.storeRelease(0);
+    }
+}
+
+// MANIPULATORS
+inline
+void EpochManager::enter()
+{
+    pin();
+}
+
+inline
+void EpochManager::leave()
+{
+    Record *record = lookupRecord();
+    BSLS_ASSERT(record);
+
+    unpin(record);
+}
+
+template <class TYPE>
+inline
+void EpochManager::retireObject(TYPE *object, bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(allocator);
+
+    retire(object, &deleteObject<TYPE>, allocator);
+}
+
+// PRIVATE ACCESSORS
+inline
+EpochManager::Record *EpochManager::lookupRecord() const
+{
+    Record *records = static_cast<Record *>(
+                                bslmt::ThreadUtil::getSpecific(s_recordsKey));
+
+    // The record of the most recently used epoch manager is first.
+
+    if (records && d_id == records->d_managerId) {
+        return records;                                               // RETURN
+    }
+    return findRecord(records);
+}
+
+// ACCESSORS
+inline
+bslma::Allocator *EpochManager::allocator() const
+{
+    return d_allocator_p;
+}
+
+inline
+bsls::Types::Uint64 EpochManager::epoch() const
+{
+    return d_epoch;
+}
+
+inline
+bool EpochManager::isEntered() const
+{
+    const Record *record = lookupRecord();
+    return record && 0 < record->d_nesting;
+}
+
+inline
+bool EpochManager::isRegistered() const
+{
+    return 0 != lookupRecord();
+}
+
+                             // ----------------
+                             // class EpochGuard
+                             // ----------------
+
+// CREATORS
+inline
+EpochGuard::EpochGuard(EpochManager *manager)
+: d_manager_p(manager)
+, d_record_p(manager->pin())
+{
+}
+
+inline
+EpochGuard::~EpochGuard()
+{
+    d_manager_p->unpin(d_record_p);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
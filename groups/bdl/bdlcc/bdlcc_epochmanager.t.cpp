@@ -0,0 +1,1007 @@
+// bdlcc_epochmanager.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_epochmanager.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a mechanism that defers the destruction of
+// retired objects until no thread that may refer to them remains within the
+// manager.  We first verify, with a single thread, entering and leaving
+// (including nesting), and that retired objects are destroyed by 'reclaim'
+// only once the epoch has advanced twice, and by the destructor otherwise.  We
+// then verify that a thread within the manager prevents the reclamation of
+// objects retired after it entered, and that the records of exited threads
+// are reused.  Next, we verify, under concurrent replacement of a shared
+// object, that readers never observe a destroyed object.  Finally, we verify
+// that the number of epoch managers is not limited by the number of
+// thread-specific storage keys.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] EpochManager(bslma::Allocator *basicAllocator = 0);
+// [ 1] ~EpochManager();
+//
+// MANIPULATORS
+// [ 1] void enter();
+// [ 1] void leave();
+// [ 3] void registerThread();
+// [ 1] bsl::size_t reclaim();
+// [ 1] void retire(void *object, Deleter deleter, void *context = 0);
+// [ 3] void retireObject(TYPE *object, bslma::Allocator *allocator);
+// [ 3] void unregisterThread();
+//
+// ACCESSORS
+// [ 1] bslma::Allocator *allocator() const;
+// [ 1] bsls::Types::Uint64 epoch() const;
+// [ 1] bool isEntered() const;
+// [ 3] bool isRegistered() const;
+// [ 1] bsl::size_t numRetired() const;
+//
+// 'EpochGuard'
+// [ 1] EpochGuard(EpochManager *manager);
+// [ 1] ~EpochGuard();
+// ----------------------------------------------------------------------------
+// [ 2] READERS DELAY RECLAMATION
+// [ 4] CONCURRENCY TEST
+// [ 5] MANY EPOCH MANAGERS
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::EpochManager Obj;
+typedef bdlcc::EpochGuard   Guard;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void countDeletion(void *object, void *counter)
+    // Increment the specified 'counter', addressing a 'bsls::AtomicInt', and
+    // ignore the specified 'object'.
+{
+    (void)object;
+
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void reclaimAll(Obj *manager)
+    // Call 'reclaim' on the specified 'manager' enough times for every object
+    // retired before this call to be destroyed, provided no thread is within
+    // 'manager'.
+{
+    for (int i = 0; i < 3; ++i) {
+        manager->reclaim();
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          CASE 2 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EPOCHMANAGER_CASE_2 {
+
+void holdEntered(Obj             *manager,
+                 bslmt::Semaphore *entered,
+                 bslmt::Semaphore *release)
+    // Enter the specified 'manager', post on the specified 'entered', and
+    // leave 'manager' once the specified 'release' is posted.
+{
+    Guard guard(manager);
+
+    entered->post();
+    release->wait();
+}
+
+void enterOnce(Obj *manager)
+    // Enter and leave the specified 'manager'.
+{
+    Guard guard(manager);
+}
+
+}  // close namespace EPOCHMANAGER_CASE_2
+
+// ============================================================================
+//                          CASE 3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EPOCHMANAGER_CASE_3 {
+
+class Tracked {
+    // This class counts its live instances, and holds a string allocated
+    // from the allocator supplied at construction.
+
+    // DATA
+    bsl::string d_string;
+
+  public:
+    // CLASS DATA
+    static bsls::AtomicInt s_numLive;
+
+    // CREATORS
+    explicit Tracked(bslma::Allocator *basicAllocator)
+    : d_string("a string too long for the short-string buffer",
+               basicAllocator)
+    {
+        ++s_numLive;
+    }
+
+    ~Tracked()
+    {
+        --s_numLive;
+    }
+};
+
+bsls::AtomicInt Tracked::s_numLive(0);
+
+void checkRegistration(Obj *manager, bsls::AtomicInt *numErrors)
+    // Register with, and unregister from, the specified 'manager',
+    // incrementing the specified 'numErrors' if 'isRegistered' does not
+    // reflect the registration of the calling thread.
+{
+    if (manager->isRegistered()) {
+        ++*numErrors;
+    }
+    manager->registerThread();
+    if (!manager->isRegistered()) {
+        ++*numErrors;
+    }
+    manager->unregisterThread();
+    if (manager->isRegistered()) {
+        ++*numErrors;
+    }
+}
+
+}  // close namespace EPOCHMANAGER_CASE_3
+
+// ============================================================================
+//                          CASE 4 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EPOCHMANAGER_CASE_4 {
+
+enum { k_NUM_READERS = 4, k_NUM_REPLACEMENTS = 20000, k_MAGIC = 0x5eed };
+
+struct Payload {
+    // This 'struct' is an object shared with the readers, whose 'd_magic' is
+    // cleared on destruction.
+
+    int d_magic;
+    int d_value;
+};
+
+bsls::AtomicPointer<Payload> s_current(0);
+bsls::AtomicBool             s_done(false);
+bsls::AtomicInt              s_numErrors(0);
+bsls::AtomicInt              s_numDeleted(0);
+
+void deletePayload(void *payload, void *allocator)
+    // Clear and deallocate the specified 'payload', allocated from the
+    // specified 'allocator'.
+{
+    Payload *p = static_cast<Payload *>(payload);
+
+    p->d_magic = 0;
+    static_cast<bslma::Allocator *>(allocator)->deallocate(p);
+    ++s_numDeleted;
+}
+
+void reader(Obj *manager, bslmt::Barrier *barrier)
+    // Repeatedly read the current payload within the specified 'manager',
+    // after waiting on the specified 'barrier', until 's_done' is set.
+{
+    barrier->wait();
+
+    int previous = 0;
+    while (!s_done) {
+        Guard guard(manager);
+
+        const Payload *p = s_current.loadAcquire();
+        for (int i = 0; i < 16; ++i) {
+            if (k_MAGIC != p->d_magic || p->d_value < previous) {
+                ++s_numErrors;
+            }
+        }
+        previous = p->d_value;
+    }
+}
+
+void writer(Obj              *manager,
+            bslmt::Barrier   *barrier,
+            bslma::Allocator *allocator)
+    // Replace the current payload 'k_NUM_REPLACEMENTS' times, retiring each
+    // replaced payload to the specified 'manager', after waiting on the
+    // specified 'barrier'.  Allocate the payloads from the specified
+    // 'allocator'.
+{
+    barrier->wait();
+
+    for (int i = 1; i <= k_NUM_REPLACEMENTS; ++i) {
+        Payload *p = static_cast<Payload *>(
+                                        allocator->allocate(sizeof(Payload)));
+        p->d_magic = k_MAGIC;
+        p->d_value = i;
+
+        manager->retire(s_current.swap(p), &deletePayload, allocator);
+
+        if (0 == i % 1000) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    s_done = true;
+}
+
+}  // close namespace EPOCHMANAGER_CASE_4
+
+// ============================================================================
+//                          CASE 5 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EPOCHMANAGER_CASE_5 {
+
+enum { k_NUM_MANAGERS = 5000 };
+
+void outliveManagers(Obj                  **managers,
+                     int                    numManagers,
+                     Obj                   *survivor,
+                     bslma::TestAllocator  *allocator,
+                     bslmt::Semaphore      *entered,
+                     bslmt::Semaphore      *destroyed)
+    // Enter and leave each of the specified 'numManagers' epoch managers in
+    // the specified 'managers' array, post on the specified 'entered', and,
+    // once the specified 'destroyed' is posted, enter the specified
+    // 'survivor' and verify that the records of the destroyed managers have
+    // been returned to the specified 'allocator'.
+{
+    for (int i = 0; i < numManagers; ++i) {
+        Guard guard(managers[i]);
+    }
+    entered->post();
+    destroyed->wait();
+
+    Guard guard(survivor);
+
+    // Only the record assigned by 'survivor' remains.
+
+    ASSERTV(allocator->numBlocksInUse(), 1 == allocator->numBlocksInUse());
+}
+
+}  // close namespace EPOCHMANAGER_CASE_5
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Configuration Value Replaced by One Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that many threads read a configuration string that is occasionally
+// replaced by a single administrative thread, and we want the readers to
+// neither take a lock nor modify any reference count.
+//
+// First, we define the configuration holder, which publishes the current
+// string through an atomic pointer, and a deleter that destroys a retired
+// string:
+//..
+    void deleteString(void *string, void *)
+        // Destroy the specified 'string'.
+    {
+        delete static_cast<bsl::string *>(string);
+    }
+
+    class Configuration {
+        // This class holds a string that can be read concurrently with the
+        // replacement of its value by a single writer.
+
+        // DATA
+        mutable bdlcc::EpochManager      d_epochManager;
+        bsls::AtomicPointer<bsl::string> d_value_p;
+
+      public:
+        // CREATORS
+        Configuration()
+        : d_value_p(new bsl::string())
+        {
+        }
+
+        ~Configuration()
+        {
+            delete d_value_p.load();
+        }
+
+        // MANIPULATORS
+        void setValue(const bsl::string& value)
+            // Set the value of this configuration to the specified 'value'.
+        {
+            bsl::string *previous = d_value_p.swap(new bsl::string(value));
+            d_epochManager.retire(previous, &deleteString);
+        }
+
+        // ACCESSORS
+        bsl::size_t length() const
+            // Return the length of the value of this configuration.
+        {
+            bdlcc::EpochGuard guard(&d_epochManager);
+
+            return d_value_p.loadAcquire()->length();
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // MANY EPOCH MANAGERS
+        //
+        // Concerns:
+        //: 1 The number of epoch managers that may exist simultaneously is not
+        //:   limited by the number of thread-specific storage keys.
+        //:
+        //: 2 A thread that enters many epoch managers finds the record
+        //:   assigned by each of them, in any order.
+        //:
+        //: 3 The records of a thread that outlives an epoch manager are
+        //:   returned to the allocator of the epoch manager by its destructor
+        //:   if the thread is the calling thread, and otherwise when the
+        //:   thread is next assigned a record or exits.
+        //
+        // Plan:
+        //: 1 Create several thousand epoch managers, and enter and leave each
+        //:   of them from the main thread, forward and backward, verifying
+        //:   'isEntered' and 'isRegistered'.  (C-1..2)
+        //:
+        //: 2 Have a second thread enter some of the managers, destroy all of
+        //:   them while that thread is alive, then have the thread enter
+        //:   another manager.  Verify that all memory is returned, both
+        //:   before and after the thread exits.  (C-3)
+        //
+        // Testing:
+        //   MANY EPOCH MANAGERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANY EPOCH MANAGERS" << endl
+                          << "===================" << endl;
+
+        using namespace EPOCHMANAGER_CASE_5;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        bslma::TestAllocator ma("managers", veryVeryVeryVerbose);
+        {
+            bsl::vector<Obj *> managers(&ta);
+            for (int i = 0; i < k_NUM_MANAGERS; ++i) {
+                managers.push_back(new (ma) Obj(&ma));
+            }
+
+            for (int i = 0; i < k_NUM_MANAGERS; ++i) {
+                Guard guard(managers[i]);
+
+                ASSERTV(i, managers[i]->isEntered());
+                ASSERTV(i, 0 == i || !managers[i - 1]->isEntered());
+            }
+            for (int i = k_NUM_MANAGERS - 1; 0 <= i; --i) {
+                ASSERTV(i, managers[i]->isRegistered());
+
+                managers[i]->enter();
+                ASSERTV(i, managers[i]->isEntered());
+                managers[i]->leave();
+                ASSERTV(i, !managers[i]->isEntered());
+            }
+
+            Obj              survivor(&ma);
+            bslmt::Semaphore entered;
+            bslmt::Semaphore destroyed;
+
+            bslmt::ThreadGroup threadGroup(&ta);
+            threadGroup.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &outliveManagers,
+                                                        managers.data(),
+                                                        100,
+                                                        &survivor,
+                                                        &ma,
+                                                        &entered,
+                                                        &destroyed));
+            entered.wait();
+
+            for (int i = 0; i < k_NUM_MANAGERS; ++i) {
+                ma.deleteObject(managers[i]);
+            }
+            destroyed.post();
+            threadGroup.joinAll();
+
+            // The exited thread returned its record to 'survivor'.
+
+            ASSERTV(ma.numBlocksInUse(), 1 == ma.numBlocksInUse());
+        }
+        ASSERTV(ma.numBlocksInUse(), 0 == ma.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, a reader can use the string for as long as its guard is in scope:
+//..
+    Configuration configuration;
+    configuration.setValue("server=primary");
+    ASSERT(14 == configuration.length());
+//..
+// Finally, when the value is replaced again, the previous value is retired,
+// and is destroyed by a later call to 'reclaim' (made by 'retire' every
+// 'k_RECLAIM_INTERVAL' retirements) or, at the latest, by the destructor of
+// the epoch manager:
+//..
+    configuration.setValue("server=backup");
+    ASSERT(13 == configuration.length());
+//..
+//
+///Example 2: Registering Readers and Retiring Allocated Objects
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the objects shared with readers are created with a
+// 'bslma::Allocator', and that reader threads should not allocate memory when
+// they first access the shared data.
+//
+// First, we create an epoch manager, and register the calling thread, as each
+// reader thread would on startup:
+//..
+    bslma::Allocator *allocator = bslma::Default::defaultAllocator();
+
+    bdlcc::EpochManager manager(allocator);
+    manager.registerThread();
+    ASSERT(manager.isRegistered());
+//..
+// Then, a writer creates an object with the allocator, publishes it, and,
+// once it has been unlinked, retires it with the same allocator:
+//..
+    bsl::vector<int> *numbers = new (*allocator) bsl::vector<int>(allocator);
+    numbers->push_back(42);
+
+    manager.retireObject(numbers, allocator);
+    ASSERT(1 == manager.numRetired());
+//..
+// Next, once no reader is within the manager, two calls to 'reclaim' advance
+// the epoch twice, destroying the vector and returning its memory:
+//..
+    manager.reclaim();
+    manager.reclaim();
+    ASSERT(0 == manager.numRetired());
+//..
+// Finally, a reader thread that stops reading the shared data, but keeps
+// running, releases its record for use by other threads:
+//..
+    manager.unregisterThread();
+    ASSERT(!manager.isRegistered());
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 A reader within the manager never observes a destroyed object,
+        //:   while a writer concurrently replaces and retires it.
+        //:
+        //: 2 Retired objects are reclaimed while readers are active, so that
+        //:   the number of retired objects remains bounded.
+        //:
+        //: 3 Every retired object is destroyed exactly once.
+        //
+        // Plan:
+        //: 1 Run several reader threads that repeatedly check, within a
+        //:   guard, a marker of the current object, that is cleared by the
+        //:   deleter, and a writer thread that replaces the object many
+        //:   times.  Verify that no reader observed a cleared marker, that
+        //:   some objects were destroyed before the end of the test, and that
+        //:   all objects are destroyed, and their memory returned, on
+        //:   destruction of the manager.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace EPOCHMANAGER_CASE_4;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Payload *initial = static_cast<Payload *>(
+                                                ta.allocate(sizeof(Payload)));
+            initial->d_magic = k_MAGIC;
+            initial->d_value = 0;
+            s_current = initial;
+
+            Obj mX(&ta);
+
+            bslmt::Barrier     barrier(k_NUM_READERS + 1);
+            bslmt::ThreadGroup threadGroup(&ta);
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bindS(&ta,
+                                                            &reader,
+                                                            &mX,
+                                                            &barrier));
+            }
+            threadGroup.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &writer,
+                                                        &mX,
+                                                        &barrier,
+                                                        &ta));
+            threadGroup.joinAll();
+
+            ASSERTV(s_numErrors, 0 == s_numErrors);
+            ASSERTV(s_numDeleted, 0 < s_numDeleted);
+
+            if (veryVerbose) {
+                P_(s_numDeleted) P(mX.numRetired());
+            }
+
+            deletePayload(s_current.load(), &ta);
+        }
+        ASSERTV(s_numDeleted, k_NUM_REPLACEMENTS + 1 == s_numDeleted);
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // THREAD REGISTRATION AND 'retireObject'
+        //
+        // Concerns:
+        //: 1 'registerThread' assigns a record to the calling thread, after
+        //:   which entering and leaving the manager allocates no memory, and
+        //:   has no effect if the calling thread is already registered.
+        //:
+        //: 2 'unregisterThread' releases the record of the calling thread,
+        //:   which is reused by the next thread that registers, and has no
+        //:   effect if the calling thread is not registered.
+        //:
+        //: 3 'isRegistered' reflects the registration of the calling thread
+        //:   only.
+        //:
+        //: 4 An object retired with 'retireObject' is destroyed, and its
+        //:   memory returned to the supplied allocator, by 'reclaim' once the
+        //:   epoch has advanced twice, or else by the destructor.
+        //
+        // Plan:
+        //: 1 Register and unregister the main thread, checking
+        //:   'isRegistered' and the number of blocks allocated by the
+        //:   manager.  Then register and unregister another thread, and
+        //:   verify that its record is the one released by the main thread.
+        //:   (C-1..3)
+        //:
+        //: 2 Retire objects that count their live instances, and hold memory
+        //:   from a test allocator, and verify their destruction by 'reclaim'
+        //:   and by the destructor.  (C-4)
+        //
+        // Testing:
+        //   void registerThread();
+        //   void retireObject(TYPE *object, bslma::Allocator *allocator);
+        //   void unregisterThread();
+        //   bool isRegistered() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THREAD REGISTRATION AND 'retireObject'" << endl
+                          << "======================================" << endl;
+
+        using namespace EPOCHMANAGER_CASE_3;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            if (verbose) cout << "\tRegistration." << endl;
+
+            ASSERT(!X.isRegistered());
+            mX.unregisterThread();
+            ASSERT(!X.isRegistered());
+
+            mX.registerThread();
+            ASSERT(X.isRegistered());
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+            ASSERT(0 < numBlocks);
+
+            mX.registerThread();
+            for (int i = 0; i < 10; ++i) {
+                Guard guard(&mX);
+            }
+            ASSERTV(numBlocks, ta.numBlocksTotal(),
+                    numBlocks == ta.numBlocksTotal());
+
+            mX.unregisterThread();
+            ASSERT(!X.isRegistered());
+
+            bsls::AtomicInt           numErrors(0);
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&checkRegistration,
+                                                         &mX,
+                                                         &numErrors),
+                                    &defaultAllocator));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(numErrors, 0 == numErrors);
+            ASSERTV(numBlocks, ta.numBlocksTotal(),
+                    numBlocks == ta.numBlocksTotal());
+
+            mX.enter();
+            ASSERT(X.isRegistered());
+            mX.leave();
+
+            if (verbose) cout << "\tRetiring allocated objects." << endl;
+
+            mX.retireObject(new (oa) Tracked(&oa), &oa);
+            mX.retireObject(new (oa) Tracked(&oa), &oa);
+            ASSERT(2 == Tracked::s_numLive);
+            ASSERT(4 == oa.numBlocksInUse());
+
+            ASSERT(0 == mX.reclaim());
+            ASSERT(2 == mX.reclaim());
+            ASSERT(0 == Tracked::s_numLive);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.retireObject(new (oa) Tracked(&oa), &oa);
+            ASSERT(1 == Tracked::s_numLive);
+        }
+        ASSERT(0 == Tracked::s_numLive);
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // READERS DELAY RECLAMATION
+        //
+        // Concerns:
+        //: 1 An object retired while another thread is within the manager is
+        //:   not destroyed before that thread leaves, however many times
+        //:   'reclaim' is called.
+        //:
+        //: 2 Once that thread leaves, the object is destroyed by 'reclaim'.
+        //:
+        //: 3 The record of a thread that exits is reused by a thread that
+        //:   enters later, so that the memory used by the manager does not
+        //:   grow with the number of threads created over time.
+        //
+        // Plan:
+        //: 1 Have a thread enter the manager and wait on a semaphore; retire
+        //:   an object, and verify that repeated calls to 'reclaim' do not
+        //:   destroy it.  Release the thread, and verify that 'reclaim' then
+        //:   destroys the object.  (C-1..2)
+        //:
+        //: 2 Create, one after the other, several threads that each enter and
+        //:   leave the manager, and verify that the number of blocks
+        //:   allocated by the manager does not grow after the first thread.
+        //:   (C-3)
+        //
+        // Testing:
+        //   READERS DELAY RECLAMATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "READERS DELAY RECLAMATION" << endl
+                          << "=========================" << endl;
+
+        using namespace EPOCHMANAGER_CASE_2;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            bsls::AtomicInt  numDeleted(0);
+            bslmt::Semaphore entered;
+            bslmt::Semaphore release;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&holdEntered,
+                                                         &mX,
+                                                         &entered,
+                                                         &release),
+                                    &defaultAllocator));
+            entered.wait();
+
+            mX.retire(0, &countDeletion, &numDeleted);
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERT(0 == mX.reclaim());
+            }
+            ASSERT(0 == numDeleted);
+            ASSERT(1 == X.numRetired());
+
+            release.post();
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            reclaimAll(&mX);
+            ASSERTV(numDeleted, 1 == numDeleted);
+            ASSERT(0 == X.numRetired());
+
+            if (verbose) cout << "\tReuse of records." << endl;
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksTotal();
+
+            for (int i = 0; i < 5; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&enterOnce, &mX),
+                                    &defaultAllocator));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            }
+            ASSERTV(numBlocks, ta.numBlocksTotal(),
+                    numBlocks == ta.numBlocksTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 'enter' and 'leave', and 'EpochGuard', mark the calling thread as
+        //:   within the manager, and nest.
+        //:
+        //: 2 'reclaim' advances the epoch when no thread is within the
+        //:   manager, and destroys an object once the epoch has advanced twice
+        //:   since its retirement.
+        //:
+        //: 3 The calling thread being within the manager prevents the
+        //:   destruction of objects retired after it entered.
+        //:
+        //: 4 'retire' reclaims every 'k_RECLAIM_INTERVAL' retirements.
+        //:
+        //: 5 The destructor destroys the objects not yet reclaimed, and all
+        //:   memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Perform each of the operations, using a deleter that counts its
+        //:   invocations, and verify the state of the manager after each.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   EpochManager(bslma::Allocator *basicAllocator = 0);
+        //   ~EpochManager();
+        //   void enter();
+        //   void leave();
+        //   bsl::size_t reclaim();
+        //   void retire(void *object, Deleter deleter, void *context = 0);
+        //   bslma::Allocator *allocator() const;
+        //   bsls::Types::Uint64 epoch() const;
+        //   bool isEntered() const;
+        //   bsl::size_t numRetired() const;
+        //   EpochGuard(EpochManager *manager);
+        //   ~EpochGuard();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        bsls::AtomicInt numDeleted(0);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(!X.isEntered());
+            ASSERT(0   == X.numRetired());
+
+            if (verbose) cout << "\tEntering and leaving." << endl;
+
+            mX.enter();
+            ASSERT(X.isEntered());
+            {
+                Guard guard(&mX);
+                ASSERT(X.isEntered());
+            }
+            ASSERT(X.isEntered());
+            mX.leave();
+            ASSERT(!X.isEntered());
+
+            if (verbose) cout << "\tRetiring and reclaiming." << endl;
+
+            const bsls::Types::Uint64 epoch = X.epoch();
+
+            mX.retire(0, &countDeletion, &numDeleted);
+            ASSERT(1 == X.numRetired());
+
+            ASSERT(0 == mX.reclaim());
+            ASSERT(epoch + 1 == X.epoch());
+            ASSERT(1 == mX.reclaim());
+            ASSERT(epoch + 2 == X.epoch());
+            ASSERT(1 == numDeleted);
+            ASSERT(0 == X.numRetired());
+
+            if (verbose) cout << "\tBlocking reclamation." << endl;
+
+            mX.enter();
+            mX.retire(0, &countDeletion, &numDeleted);
+            for (int i = 0; i < 5; ++i) {
+                mX.reclaim();
+            }
+            ASSERT(1 == numDeleted);
+            ASSERT(1 == X.numRetired());
+            mX.leave();
+
+            reclaimAll(&mX);
+            ASSERT(2 == numDeleted);
+
+            if (verbose) cout << "\tPeriodic reclamation." << endl;
+
+            for (int i = 0; i < 4 * Obj::k_RECLAIM_INTERVAL; ++i) {
+                mX.retire(0, &countDeletion, &numDeleted);
+            }
+            ASSERTV(X.numRetired(),
+                    X.numRetired() <= 2 * Obj::k_RECLAIM_INTERVAL);
+
+            if (verbose) cout << "\tDestruction." << endl;
+
+            mX.retire(0, &countDeletion, &numDeleted);
+        }
+        ASSERTV(numDeleted, 3 + 4 * Obj::k_RECLAIM_INTERVAL == numDeleted);
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -30,11 +30,24 @@ BSLS_IDENT("$Id: $")
 // 'tryPushBack' and 'tryPopFront' are also provided, which fail immediately
 // returning a non-zero value in case of overflow or underflow.
 //
+// Batch methods 'pushBackBatch', 'tryPushBackBatch', 'popFrontBatch', and
+// 'tryPopFrontBatch' move several values per call.  Each value of a batch is
+// still reserved and committed individually, but threads blocked waiting for
+// the values pushed by a batch are woken with a single post of a semaphore,
+// rather than one post per value.
+//
 // The queue may be placed into a "disabled" state using the 'disable' method.
 // When disabled, 'pushBack' and 'tryPushBack' fail immediately (they do not
 // block and any blocked invocations will fail immediately).  The queue may be
 // restored to normal operation with the 'enable' method.
 //
+// By default, a thread blocked in 'popFront' (or 'popFrontBatch') on an empty
+// queue waits on a semaphore, so each wake-up costs a context switch.  A
+// 'bdlcc::WaitStrategy::Enum' may be specified at construction to have such
+// threads poll the queue before (or instead of) blocking (see
+// 'bdlcc_waitstrategy').  Threads blocked in 'pushBack' on a full queue
+// always wait on a semaphore.
+//
 // Unlike 'bdlcc::Queue', a fixed queue is not double-ended, there is no timed
 // API like 'timedPushBack' and 'timedPopFront', and no 'forcePush' methods, as
 // the queue capacity is fixed.  Also, this component is not based on
@@ -184,6 +197,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlcc_fixedqueueindexmanager.h>
+#include <bdlcc_waitstrategy.h>
 
 #include <bslmt_semaphore.h>
 #include <bslmt_threadutil.h>
@@ -261,9 +275,17 @@ class FixedQueue {
     const char        d_pushControlSemaPad[k_SEMA_PADDING];
                                            // padding to prevent false sharing
 
+    const WaitStrategy::Enum
+                      d_waitStrategy;      // how threads wait in 'popFront'
+
     bslma::Allocator *d_allocator_p;       // allocator, held not owned
 
   private:
+    // PRIVATE MANIPULATORS
+    void init(bsl::size_t capacity);
+        // Allocate the storage for the specified 'capacity' elements of this
+        // queue.  This method is intended to be used by the constructors.
+
     // NOT IMPLEMENTED
     FixedQueue(const FixedQueue&);
     FixedQueue& operator=(const FixedQueue&);
@@ -284,6 +306,17 @@ class FixedQueue {
         // allocator is used.  The behavior is undefined unless '0 < capacity'
         // and 'capacity <= bdlcc::FixedQueueIndexManager::k_MAX_CAPACITY'.
 
+    FixedQueue(bsl::size_t         capacity,
+               WaitStrategy::Enum  waitStrategy,
+               bslma::Allocator   *basicAllocator = 0);
+        // Create a thread-enabled lock-free queue having the specified
+        // 'capacity', on which threads wait in 'popFront' according to the
+        // specified 'waitStrategy'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '0 < capacity' and
+        // 'capacity <= bdlcc::FixedQueueIndexManager::k_MAX_CAPACITY'.
+
     ~FixedQueue();
         // Destroy this object.
 
@@ -312,6 +345,27 @@ class FixedQueue {
         // unspecified state.  Return 0 on success, and a non-zero value if the
         // queue is full or disabled.
 
+    int pushBackBatch(bsl::size_t *numPushed,
+                      const TYPE  *values,
+                      bsl::size_t  numValues);
+        // Append the specified 'numValues' values in the array starting at
+        // the specified 'values', in order, to the back of this queue,
+        // blocking until either space is available - if necessary - or the
+        // queue is disabled, and load the number of values appended into the
+        // specified 'numPushed'.  Return 0 on success, and a nonzero value if
+        // the queue is disabled, in which case the first '*numPushed' values
+        // have been appended.
+
+    int tryPushBackBatch(bsl::size_t *numPushed,
+                         const TYPE  *values,
+                         bsl::size_t  numValues);
+        // Attempt to append, without blocking, the specified 'numValues'
+        // values in the array starting at the specified 'values', in order, to
+        // the back of this queue, stopping when the queue is full, and load
+        // the number of values appended into the specified 'numPushed'.
+        // Return 0 if at least one value was appended (or 'numValues' is 0),
+        // and a non-zero value if the queue is full or disabled.
+
     void popFront(TYPE* value);
         // Remove the element from the front of this queue and load that
         // element into the specified 'value'.  If the queue is empty, block
@@ -327,6 +381,26 @@ class FixedQueue {
         // removed element.  Return 0 on success, and a non-zero value if queue
         // was empty.  On failure, 'value' is not changed.
 
+    void popFrontBatch(bsl::size_t *numPopped,
+                       TYPE        *values,
+                       bsl::size_t  maxNumValues);
+        // Remove up to the specified 'maxNumValues' elements from the front of
+        // this queue, load them, in order, into the array starting at the
+        // specified 'values', and load the number of elements removed into the
+        // specified 'numPopped'.  If the queue is empty (and 'maxNumValues' is
+        // not 0), block until it is not empty; then remove, without blocking,
+        // as many of the elements in the queue as 'maxNumValues' allows.
+
+    int tryPopFrontBatch(bsl::size_t *numPopped,
+                         TYPE        *values,
+                         bsl::size_t  maxNumValues);
+        // Attempt to remove, without blocking, up to the specified
+        // 'maxNumValues' elements from the front of this queue, load them, in
+        // order, into the array starting at the specified 'values', and load
+        // the number of elements removed into the specified 'numPopped'.
+        // Return 0 if at least one element was removed (or 'maxNumValues' is
+        // 0), and a non-zero value if the queue was empty.
+
     void removeAll();
         // Remove all items from this queue.  Note that this operation is not
         // atomic; if other threads are concurrently pushing items into the
@@ -363,6 +437,10 @@ class FixedQueue {
     int numElements() const;
         // Returns the number of elements currently in this queue.
 
+    WaitStrategy::Enum waitStrategy() const;
+        // Return the strategy by which threads wait in 'popFront' on this
+        // queue.
+
     int length() const;
         // [!DEPRECATED!] Invoke 'numElements'.
 
@@ -480,6 +558,15 @@ class FixedQueue_PushProctor {
                            // ---------------------
                            // class FixedQueue
                            // ---------------------
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+void FixedQueue<TYPE>::init(bsl::size_t capacity)
+{
+    d_elements = static_cast<TYPE *>(
+                            d_allocator_p->allocate(capacity * sizeof(TYPE)));
+}
+
 // CREATORS
 template <class TYPE>
 FixedQueue<TYPE>::FixedQueue(bsl::size_t       capacity,
@@ -493,10 +580,29 @@ FixedQueue<TYPE>::FixedQueue(bsl::size_t       capacity,
 , d_numWaitingPushers(0)
 , d_pushControlSema(0)
 , d_pushControlSemaPad()
+, d_waitStrategy(WaitStrategy::e_BLOCK)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    d_elements = static_cast<TYPE *>(
-                            d_allocator_p->allocate(capacity * sizeof(TYPE)));
+    init(capacity);
+}
+
+template <class TYPE>
+FixedQueue<TYPE>::FixedQueue(bsl::size_t         capacity,
+                             WaitStrategy::Enum  waitStrategy,
+                             bslma::Allocator   *basicAllocator)
+: d_elements()
+, d_elementsPad()
+, d_impl(capacity, basicAllocator)
+, d_numWaitingPoppers(0)
+, d_popControlSema(0)
+, d_popControlSemaPad()
+, d_numWaitingPushers(0)
+, d_pushControlSema(0)
+, d_pushControlSemaPad()
+, d_waitStrategy(waitStrategy)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(capacity);
 }
 
 template <class TYPE>
@@ -687,10 +793,109 @@ int FixedQueue<TYPE>::pushBack(bslmf::MovableRef<TYPE> value)
     return 0;
 }
 
+template <class TYPE>
+int FixedQueue<TYPE>::pushBackBatch(bsl::size_t *numPushed,
+                                    const TYPE  *values,
+                                    bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+
+    *numPushed = 0;
+
+    while (*numPushed < numValues) {
+        bsl::size_t numBatched;
+        int         retval = tryPushBackBatch(&numBatched,
+                                              values + *numPushed,
+                                              numValues - *numPushed);
+
+        *numPushed += numBatched;
+
+        if (0 == retval) {
+            continue;
+        }
+
+        if (retval < 0) {
+            // The queue is disabled.
+
+            return retval;                                            // RETURN
+        }
+
+        d_numWaitingPushers.addRelaxed(1);
+
+        // SYNCHRONIZATION POINT 1-Prime (see 'pushBack')
+
+        if (isFull() && isEnabled()) {
+            d_pushControlSema.wait();
+        }
+
+        d_numWaitingPushers.addRelaxed(-1);
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::tryPushBackBatch(bsl::size_t *numPushed,
+                                       const TYPE  *values,
+                                       bsl::size_t  numValues)
+{
+    BSLS_ASSERT(numPushed);
+
+    *numPushed = 0;
+
+    int retval = 0;
+
+    while (*numPushed < numValues) {
+        unsigned int generation;
+        unsigned int index;
+
+        // SYNCHRONIZATION POINT 1 (see 'tryPushBack')
+
+        retval = d_impl.reservePushIndex(&generation, &index);
+
+        if (0 != retval) {
+            break;
+        }
+
+        FixedQueue_PushProctor<TYPE> guard(this, generation, index);
+        bslalg::ScalarPrimitives::copyConstruct(&d_elements[index],
+                                                values[*numPushed],
+                                                d_allocator_p);
+        guard.release();
+        d_impl.commitPushIndex(generation, index);
+
+        ++*numPushed;
+    }
+
+    if (0 == *numPushed) {
+        return retval;                                                // RETURN
+    }
+
+    // Wake up as many waiting poppers as there are values pushed, with a
+    // single post.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingPoppers)) {
+        const int numWakeUps = static_cast<int>(bsl::min<bsl::size_t>(
+                                                         *numPushed,
+                                                         d_numWaitingPoppers));
+        if (0 < numWakeUps) {
+            d_popControlSema.post(numWakeUps);
+        }
+    }
+
+    return 0;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::popFront(TYPE *value)
 {
+    int numWaits = 0;
+
     while (0 != tryPopFront(value)) {
+        if (WaitStrategy::pause(d_waitStrategy, &numWaits)) {
+            continue;
+        }
+
         d_numWaitingPoppers.addRelaxed(1);
 
         // SYNCHRONIZATION POINT 2-Prime
@@ -715,7 +920,13 @@ TYPE FixedQueue<TYPE>::popFront()
     unsigned int generation;
     unsigned int index;
 
+    int numWaits = 0;
+
     while (0 != d_impl.reservePopIndex(&generation, &index)) {
+        if (WaitStrategy::pause(d_waitStrategy, &numWaits)) {
+            continue;
+        }
+
         d_numWaitingPoppers.addRelaxed(1);
 
         if (isEmpty()) {
@@ -741,6 +952,50 @@ TYPE FixedQueue<TYPE>::popFront()
 #endif
 }
 
+template <class TYPE>
+void FixedQueue<TYPE>::popFrontBatch(bsl::size_t *numPopped,
+                                     TYPE        *values,
+                                     bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    if (0 == maxNumValues) {
+        return;                                                       // RETURN
+    }
+
+    popFront(values);
+
+    tryPopFrontBatch(numPopped, values + 1, maxNumValues - 1);
+
+    ++*numPopped;
+}
+
+template <class TYPE>
+int FixedQueue<TYPE>::tryPopFrontBatch(bsl::size_t *numPopped,
+                                       TYPE        *values,
+                                       bsl::size_t  maxNumValues)
+{
+    BSLS_ASSERT(numPopped);
+
+    *numPopped = 0;
+
+    int retval = 0;
+
+    while (*numPopped < maxNumValues) {
+        retval = tryPopFront(values + *numPopped);
+
+        if (0 != retval) {
+            break;
+        }
+
+        ++*numPopped;
+    }
+
+    return 0 == *numPopped ? retval : 0;
+}
+
 template <class TYPE>
 void FixedQueue<TYPE>::removeAll()
 {
@@ -829,6 +1084,13 @@ int FixedQueue<TYPE>::numElements() const
     return static_cast<int>(d_impl.length());
 }
 
+template <class TYPE>
+inline
+WaitStrategy::Enum FixedQueue<TYPE>::waitStrategy() const
+{
+    return d_waitStrategy;
+}
+
 template <class TYPE>
 inline
 int FixedQueue<TYPE>::size() const
@@ -986,6 +986,165 @@ void runtest(int numIterations, int numPushers, int numPoppers)
 }
 }  // close namespace zerotst
 
+namespace batchtst {
+
+struct Control {
+    bdlcc::FixedQueue<int> *d_queue;
+
+    int                     d_numValues;   // values pushed per pusher
+
+    bsls::AtomicInt64       d_sum;         // sum of the values popped
+
+    bsls::AtomicInt         d_numPopped;   // number of values popped
+};
+
+void pusherThread(Control *control, int id, int batchSize)
+    // Push 'control->d_numValues' values, in increasing order starting at
+    // 'id * control->d_numValues', in batches of 'batchSize' values.
+{
+    int batch[64];
+
+    const int numValues = control->d_numValues;
+
+    for (int i = 0; i < numValues; i += batchSize) {
+        const int n = bsl::min(batchSize, numValues - i);
+        for (int j = 0; j < n; ++j) {
+            batch[j] = id * numValues + i + j;
+        }
+
+        bsl::size_t numPushed;
+        ASSERTT(0 == control->d_queue->pushBackBatch(&numPushed, batch, n));
+        ASSERTT(n  == static_cast<int>(numPushed));
+    }
+}
+
+void popperThread(Control *control)
+    // Pop batches of values until a negative value is popped, re-pushing any
+    // additional negative values popped in the same batch.
+{
+    int values[16];
+
+    for (;;) {
+        bsl::size_t numPopped;
+        control->d_queue->popFrontBatch(&numPopped, values, 16);
+        ASSERTT(0 < numPopped && numPopped <= 16);
+
+        int numStops = 0;
+        for (bsl::size_t i = 0; i < numPopped; ++i) {
+            if (values[i] < 0) {
+                ++numStops;
+                continue;
+            }
+            control->d_sum += values[i];
+            ++control->d_numPopped;
+
+            // Values from the same pusher are in increasing order.
+
+            for (bsl::size_t j = 0; j < i; ++j) {
+                if (0 <= values[j] && values[j] / control->d_numValues ==
+                                         values[i] / control->d_numValues) {
+                    LOOP2_ASSERTT(values[j], values[i], values[j] < values[i]);
+                }
+            }
+        }
+
+        if (numStops) {
+            while (--numStops) {
+                control->d_queue->pushBack(-1);
+            }
+            return;                                                   // RETURN
+        }
+    }
+}
+
+void runtest(int numPushers, int numPoppers, int queueSize)
+{
+    enum { k_NUM_VALUES = 5000 };
+
+    bdlcc::FixedQueue<int> queue(queueSize);
+
+    Control control;
+    control.d_queue     = &queue;
+    control.d_numValues = k_NUM_VALUES;
+    control.d_sum       = 0;
+    control.d_numPopped = 0;
+
+    bslmt::ThreadGroup pushers;
+    bslmt::ThreadGroup poppers;
+
+    poppers.addThreads(bdlf::BindUtil::bind(&popperThread, &control),
+                       numPoppers);
+    for (int i = 0; i < numPushers; ++i) {
+        pushers.addThread(bdlf::BindUtil::bind(&pusherThread,
+                                               &control,
+                                               i,
+                                               1 + (7 + 13 * i) % 64));
+    }
+    pushers.joinAll();
+
+    for (int i = 0; i < numPoppers; ++i) {
+        queue.pushBack(-1);
+    }
+    poppers.joinAll();
+
+    const bsls::Types::Int64 total = numPushers * k_NUM_VALUES;
+
+    LOOP_ASSERT(control.d_numPopped, total == control.d_numPopped);
+    LOOP_ASSERT(control.d_sum, total * (total - 1) / 2 == control.d_sum);
+    ASSERT(queue.isEmpty());
+}
+
+}  // close namespace batchtst
+
+namespace waittst {
+
+enum { k_NUM_VALUES = 2000 };
+
+void pusherThread(bdlcc::FixedQueue<int> *queue, int numPoppers)
+    // Push the values from 0 to 'k_NUM_VALUES - 1' onto the specified 'queue',
+    // periodically sleeping so that waiting poppers exhaust any spinning of
+    // their wait strategy, followed by the specified 'numPoppers' values of
+    // -1.
+{
+    for (int i = 0; i < k_NUM_VALUES; ++i) {
+        if (0 == i % 500) {
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+        queue->pushBack(i);
+    }
+
+    for (int i = 0; i < numPoppers; ++i) {
+        queue->pushBack(-1);
+    }
+}
+
+void popperThread(bdlcc::FixedQueue<int> *queue,
+                  bsls::AtomicInt64      *sum,
+                  bsls::AtomicInt        *numPopped)
+    // Pop values from the specified 'queue', alternating between the two
+    // overloads of 'popFront', and add them to the specified 'sum' and
+    // increment the specified 'numPopped' for each, until -1 is popped.
+{
+    for (int i = 0; ; ++i) {
+        int value;
+
+        if (i % 2) {
+            value = queue->popFront();
+        }
+        else {
+            queue->popFront(&value);
+        }
+
+        if (0 > value) {
+            return;                                                   // RETURN
+        }
+        *sum += value;
+        ++*numPopped;
+    }
+}
+
+}  // close namespace waittst
+
 namespace case18 {
 
                               // ==========
@@ -1305,7 +1464,7 @@ int main(int argc, char *argv[])
                     bslmt::Configuration::recommendedDefaultThreadStackSize());
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 19: {
+      case 21: {
         // ---------------------------------------------------------
         // Usage example test
         //
@@ -1321,6 +1480,175 @@ int main(int argc, char *argv[])
         break;
       }
 
+      case 20: {
+        // ---------------------------------------------------------
+        // TESTING wait strategies
+        //
+        // Concerns:
+        //: 1 The queue reports the wait strategy supplied at construction,
+        //:   and 'e_BLOCK' by default.
+        //:
+        //: 2 For every wait strategy, both overloads of 'popFront' return
+        //:   every value pushed exactly once, whether or not they had to
+        //:   wait, with one or several poppers.
+        //
+        // Plan:
+        //: 1 For each wait strategy, create a queue with a small capacity,
+        //:   verify 'waitStrategy', and pop, from one and from several
+        //:   threads, the values pushed by a thread that periodically sleeps.
+        //:   Verify the number and the sum of the values popped.  (C-1..2)
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING wait strategies" << endl
+                          << "=======================" << endl;
+
+        typedef bdlcc::WaitStrategy WS;
+
+        {
+            bdlcc::FixedQueue<int>        mX(4);
+            const bdlcc::FixedQueue<int>& X = mX;
+
+            ASSERT(WS::e_BLOCK == X.waitStrategy());
+        }
+
+        const WS::Enum STRATEGIES[] = { WS::e_BLOCK,
+                                        WS::e_SPIN,
+                                        WS::e_SPIN_THEN_YIELD,
+                                        WS::e_SPIN_THEN_BLOCK };
+        const int      NUM_STRATEGIES = static_cast<int>(
+                                      sizeof STRATEGIES / sizeof *STRATEGIES);
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+        for (int numPoppers = 1; numPoppers <= 3; numPoppers += 2) {
+            const WS::Enum STRATEGY = STRATEGIES[ti];
+
+            if (veryVerbose) { P_(WS::toAscii(STRATEGY)) P(numPoppers) }
+
+            bdlcc::FixedQueue<int>        mX(4, STRATEGY);
+            const bdlcc::FixedQueue<int>& X = mX;
+
+            ASSERTV(ti, STRATEGY == X.waitStrategy());
+
+            bsls::AtomicInt64 sum(0);
+            bsls::AtomicInt   numPopped(0);
+
+            bslmt::ThreadGroup threads;
+            threads.addThreads(bdlf::BindUtil::bind(&waittst::popperThread,
+                                                    &mX,
+                                                    &sum,
+                                                    &numPopped),
+                               numPoppers);
+            threads.addThread(bdlf::BindUtil::bind(&waittst::pusherThread,
+                                                   &mX,
+                                                   numPoppers));
+            threads.joinAll();
+
+            const int N = waittst::k_NUM_VALUES;
+
+            ASSERTV(ti, numPoppers, numPopped, N == numPopped);
+            ASSERTV(ti, numPoppers, sum, N * (N - 1) / 2 == sum);
+            ASSERTV(ti, numPoppers, X.isEmpty());
+        }
+        }
+      } break;
+
+      case 19: {
+        // ---------------------------------------------------------
+        // TESTING batch methods
+        //
+        // Concerns:
+        //: 1 'tryPushBackBatch' appends as many values as fit, in order, and
+        //:   'pushBackBatch' blocks until all of the values are appended.
+        //:
+        //: 2 'tryPopFrontBatch' removes as many elements as are available up
+        //:   to the maximum, in order, and 'popFrontBatch' blocks only until
+        //:   an element is available.
+        //:
+        //: 3 The methods return the documented values when the queue is full,
+        //:   empty, or disabled, and when the number of values is 0.
+        //:
+        //: 4 Batch methods may be used concurrently without loss or
+        //:   duplication of values, and a batch preserves the order in which
+        //:   the values of each pusher were pushed.
+        //
+        // Plan:
+        //: 1 Push and pop batches of various sizes on a queue of capacity 8,
+        //:   verifying the results.  (C-1..3)
+        //:
+        //: 2 Run pushers and poppers of batches concurrently on small and
+        //:   large queues, and verify the number and sum of the values
+        //:   popped, and their order within each batch.  (C-4)
+        // ---------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING batch methods" << endl
+                          << "=====================" << endl;
+
+        {
+            bdlcc::FixedQueue<int>        mX(8);
+            const bdlcc::FixedQueue<int>& X = mX;
+
+            const int   VALUES[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+            int         values[16];
+            bsl::size_t n;
+
+            ASSERT(0 == mX.pushBackBatch(&n, VALUES, 0));     ASSERT(0 == n);
+            ASSERT(0 == mX.tryPushBackBatch(&n, VALUES, 0));  ASSERT(0 == n);
+            mX.popFrontBatch(&n, values, 0);                  ASSERT(0 == n);
+            ASSERT(0 != mX.tryPopFrontBatch(&n, values, 4));  ASSERT(0 == n);
+
+            ASSERT(0 == mX.pushBackBatch(&n, VALUES, 5));     ASSERT(5 == n);
+            ASSERT(5 == X.numElements());
+
+            ASSERT(0 == mX.tryPushBackBatch(&n, VALUES + 5, 5));
+            ASSERT(3 == n);
+            ASSERT(X.isFull());
+
+            ASSERT(0 != mX.tryPushBackBatch(&n, VALUES, 5));  ASSERT(0 == n);
+
+            mX.popFrontBatch(&n, values, 3);
+            ASSERT(3 == n);
+            ASSERT(0 == values[0]);
+            ASSERT(2 == values[2]);
+
+            ASSERT(0 == mX.tryPopFrontBatch(&n, values, 16)); ASSERT(5 == n);
+            for (int i = 0; i < 5; ++i) {
+                LOOP2_ASSERT(i, values[i], i + 3 == values[i]);
+            }
+            ASSERT(X.isEmpty());
+
+            for (int i = 0; i < 20; ++i) {
+                const bsl::size_t NUM = 1 + i % 8;
+
+                ASSERT(0 == mX.pushBackBatch(&n, VALUES + i % 3, NUM));
+                LOOP_ASSERT(i, NUM == n);
+
+                mX.popFrontBatch(&n, values, 16);
+                LOOP_ASSERT(i, NUM == n);
+
+                for (bsl::size_t j = 0; j < NUM; ++j) {
+                    LOOP2_ASSERT(i, j, VALUES[i % 3 + j] == values[j]);
+                }
+            }
+
+            mX.disable();
+
+            ASSERT(0 != mX.pushBackBatch(&n, VALUES, 2));     ASSERT(0 == n);
+            ASSERT(0 != mX.tryPushBackBatch(&n, VALUES, 2));  ASSERT(0 == n);
+            ASSERT(X.isEmpty());
+        }
+
+        for (int numPushers = 1; numPushers <= 4; numPushers += 3) {
+        for (int numPoppers = 1; numPoppers <= 4; numPoppers += 3) {
+            if (veryVerbose) { P_(numPushers) P(numPoppers) }
+
+            batchtst::runtest(numPushers, numPoppers, 8);
+            batchtst::runtest(numPushers, numPoppers, 2047);
+        }
+        }
+      } break;
+
       case 18: {
           // ---------------------------------------------------------
           // Moving tests
@@ -0,0 +1,794 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an in-process cache partitioned into independent shards.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: in-process key-value cache made of independent shards
+//
+//@SEE_ALSO: bdlcc_cache, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// that is partitioned into a fixed number of *shards*, each of which is an
+// independent 'bdlcc::Cache' object protected by its own reader-writer lock.
+// Each item is held by the shard selected by the hash value of its key, so
+// that operations on items held by different shards never contend with each
+// other.
+//
+// 'bdlcc::ShardedCache' provides the same interface as 'bdlcc::Cache' (see
+// 'bdlcc_cache'), with the exceptions that the number of shards must be
+// supplied at construction, and that 'popFront' is not provided, since there
+// is no single eviction queue.
+//
+///Eviction
+///--------
+// All of the eviction policies supported by 'bdlcc::Cache' (LRU, FIFO, CLOCK,
+// and W-TinyLFU) are supported, and are applied *per* *shard*: each shard
+// maintains its own eviction queue and evicts its own items.  The low and high
+// watermarks supplied at construction apply to the cache as a whole; each
+// shard is given an equal share of each watermark, rounded up.  Provided that
+// the hash function distributes the keys evenly, the size of the cache is thus
+// kept close to the specified watermarks; note, however, that the size of the
+// cache may exceed the high watermark by less than the number of shards, and
+// that the items evicted are the "oldest" items of their shard, not
+// necessarily the "oldest" items of the cache.
+//
+// Since an LRU (or W-TinyLFU) hit needs to modify the eviction queue of its
+// shard, it requires a write lock on that shard; for read-heavy caches,
+// consider using the CLOCK policy, with which 'tryGetValue' requires only a
+// read lock.
+//
+///Choosing the Number of Shards
+///-----------------------------
+// The number of shards does not change after construction.  A larger number of
+// shards reduces contention between threads, at the cost of less accurate
+// eviction and a larger memory footprint for an empty cache.  A number of
+// shards between one and four times the number of threads accessing the cache
+// concurrently is usually appropriate.
+//
+///Statistics
+///----------
+// The numbers of hits, misses, and evictions reported by a
+// 'bdlcc::ShardedCache' are the sums of those of its shards (see
+// 'bdlcc_cache').
+//
+///Thread Safety
+///-------------
+// The 'bdlcc::ShardedCache' class template is fully thread-safe (see
+// 'bsldoc_glossary') provided that the allocator supplied at construction and
+// the default allocator in effect during the lifetime of cached items are both
+// fully thread-safe.  Note that the methods operating on several items (e.g.,
+// 'insertBulk', 'clear', 'size', and 'visit') lock the shards one at a time,
+// and are therefore not atomic with respect to the cache as a whole.
+//
+///Post-eviction Callback and Potential Deadlocks
+///---------------------------------------------
+// As with 'bdlcc::Cache', the post-eviction callback is invoked, within the
+// calling thread, while the write lock of the shard holding the evicted item
+// is held.  The cache object itself should therefore not be used in a
+// post-eviction callback; otherwise, a deadlock may result.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows some basic usage of the sharded cache.
+//
+// First, we define a 'bdlcc::ShardedCache' object, 'myCache', that maps 'int'
+// to 'bsl::string', is made of 4 shards, uses the CLOCK eviction policy, and
+// holds at most around 100 items:
+//..
+//  bdlcc::ShardedCache<int, bsl::string> myCache(
+//                                        4,
+//                                        bdlcc::CacheEvictionPolicy::e_CLOCK,
+//                                        100,
+//                                        100,
+//                                        &talloc);
+//  assert(4   == myCache.numShards());
+//  assert(100 == myCache.highWatermark());
+//..
+// Then, we insert a few items into the cache, and verify that the size of the
+// cache has been updated correctly:
+//..
+//  myCache.insert(0, "Alex");
+//  myCache.insert(1, "John");
+//  myCache.insert(2, "Rob");
+//  assert(3 == myCache.size());
+//..
+// Next, we retrieve the value of one of the items using 'tryGetValue'; since
+// the eviction policy is CLOCK, only the shard holding the item is read
+// locked:
+//..
+//  bsl::shared_ptr<bsl::string> value;
+//  int rc = myCache.tryGetValue(&value, 1);
+//  assert(0 == rc);
+//  assert("John" == *value);
+//..
+// Now, we insert many more items into the cache:
+//..
+//  for (int i = 3; i < 1000; ++i) {
+//      myCache.insert(i, "Other");
+//  }
+//..
+// Finally, we observe that the size of the cache is kept close to the high
+// watermark, even though each shard evicts its own items independently:
+//..
+//  assert(myCache.size() <= 100 + myCache.numShards());
+//..
+
+#include <bdlcc_cache.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_integralconstant.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // ===========================
+                        // struct ShardedCache_Visitor
+                        // ===========================
+
+template <class KEY, class VALUE, class VISITOR>
+struct ShardedCache_Visitor {
+    // This component-private 'struct' adapts a visitor supplied to
+    // 'ShardedCache::visit' so that the visit of the items stays interrupted
+    // across shards once the visitor has returned 'false'.
+
+    // DATA
+    VISITOR *d_visitor_p;  // visitor being adapted (held, not owned)
+    bool     d_continue;   // 'false' if 'd_visitor_p' returned 'false'
+
+    // CREATORS
+    explicit ShardedCache_Visitor(VISITOR *visitor);
+        // Create a 'ShardedCache_Visitor' object adapting the specified
+        // 'visitor'.
+
+    // MANIPULATORS
+    bool operator()(const KEY& key, const VALUE& value);
+        // Call the adapted visitor with the specified 'key' and 'value', and
+        // return the result of that call.
+};
+
+                            // ==================
+                            // class ShardedCache
+                            // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store partitioned into
+    // independently locked shards, each supporting a variety of eviction
+    // policies.
+
+  public:
+    // PUBLIC TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL>              CacheType;
+        // Type of a shard.
+
+    typedef typename CacheType::ValuePtrType            ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef typename CacheType::PostEvictionCallback    PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef typename CacheType::KVType                  KVType;
+        // Value type of a bulk insert entry.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::vector<bsl::shared_ptr<CacheType> >    ShardVector;
+
+    // DATA
+    bslma::Allocator          *d_allocator_p;    // memory allocator (held, not
+                                                 // owned)
+
+    ShardVector                d_shards;         // independent caches
+
+    HASH                       d_hashFunction;   // hash functor used to select
+                                                 // the shard of a key
+
+    bsl::size_t                d_lowWatermark;   // aggregate low watermark
+
+    bsl::size_t                d_highWatermark;  // aggregate high watermark
+
+    // PRIVATE MANIPULATORS
+    void createShards(bsl::size_t                numShards,
+                      CacheEvictionPolicy::Enum  evictionPolicy,
+                      const EQUAL&               equalFunction);
+        // Create the specified 'numShards' shards using the specified
+        // 'evictionPolicy' and 'equalFunction', each having its share of the
+        // watermarks of this cache.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+    ShardedCache(bsl::size_t                numShards,
+                 CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache made of the specified 'numShards' shards using
+        // the specified 'evictionPolicy' and the specified 'lowWatermark' and
+        // 'highWatermark'.  Optionally specify the 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '1 <= numShards', 'lowWatermark <= highWatermark',
+        // '1 <= lowWatermark', and '1 <= highWatermark'.
+
+    ShardedCache(bsl::size_t                numShards,
+                 CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache made of the specified 'numShards' shards using
+        // the specified 'evictionPolicy', 'lowWatermark', and
+        // 'highWatermark'.  The specified 'hashFunction' is used to generate
+        // the hash values for a given key, and the specified 'equalFunction'
+        // is used to determine whether two keys have the same value.
+        // Optionally specify the 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numShards',
+        // 'lowWatermark <= highWatermark', '1 <= lowWatermark', and
+        // '1 <= highWatermark'.
+
+    //! ~ShardedCache() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  Note that all the methods that take moved objects provide
+        // the 'basic' but not the 'strong' exception guarantee.  Also note
+        // that 'key' must be copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that the method with 'key' moved provides the
+        // 'basic' but not the 'strong' exception guarantee.  Also note that
+        // 'key' must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // Note that each shard is locked only once, regardless of the number
+        // of items of 'data' it receives.
+
+    void resetStatistics();
+        // Reset the number of hits, misses, and evictions of this cache to 0.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache.  If the optionally specified
+        // 'modifyEvictionQueue' is 'true', record the access in the eviction
+        // queue of the shard holding 'key' as described in
+        // 'bdlcc::Cache::tryGetValue'.  Return 0 on success, and 1 if 'key'
+        // does not exist in this cache.  Note that only the shard holding
+        // 'key' is locked.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache that
+        // returns 'true' if two 'KEY' objects have the same value, and 'false'
+        // otherwise.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache to
+        // generate a hash value (of type 'std::size_t') for a 'KEY' object.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, as supplied at
+        // construction.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, as supplied at
+        // construction.
+
+    bsls::Types::Int64 numEvictions() const;
+        // Return the number of items evicted from this cache to enforce the
+        // watermarks since its construction or the last call to
+        // 'resetStatistics'.
+
+    bsls::Types::Int64 numHits() const;
+        // Return the number of calls to 'tryGetValue' that found the
+        // requested item since the construction of this cache or the last
+        // call to 'resetStatistics'.
+
+    bsls::Types::Int64 numMisses() const;
+        // Return the number of calls to 'tryGetValue' that did not find the
+        // requested item since the construction of this cache or the last
+        // call to 'resetStatistics'.
+
+    bsl::size_t numShards() const;
+        // Return the number of shards of this cache.
+
+    bsl::size_t shardIndex(const KEY& key) const;
+        // Return the index, in the range '[0 .. numShards() - 1]', of the
+        // shard holding the item having the specified 'key', if any.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // shard by shard, in the order of the eviction queue of each shard,
+        // until 'visitor' returns 'false'.  The 'VISITOR' type must be a
+        // callable object that can be invoked in the same way as the function
+        // 'bool (const KEY&, const VALUE&)'.  Note that only one shard is
+        // locked at a time.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this cache to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ---------------------------
+                        // struct ShardedCache_Visitor
+                        // ---------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+ShardedCache_Visitor<KEY, VALUE, VISITOR>::ShardedCache_Visitor(
+                                                              VISITOR *visitor)
+: d_visitor_p(visitor)
+, d_continue(true)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class VISITOR>
+inline
+bool ShardedCache_Visitor<KEY, VALUE, VISITOR>::operator()(const KEY&   key,
+                                                           const VALUE& value)
+{
+    d_continue = (*d_visitor_p)(key, value);
+    return d_continue;
+}
+
+                            // ------------------
+                            // class ShardedCache
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::createShards(
+                                     bsl::size_t                numShards,
+                                     CacheEvictionPolicy::Enum  evictionPolicy,
+                                     const EQUAL&               equalFunction)
+{
+    BSLS_ASSERT(1 <= numShards);
+    BSLS_ASSERT(d_lowWatermark <= d_highWatermark);
+    BSLS_ASSERT(1 <= d_lowWatermark);
+    BSLS_ASSERT(1 <= d_highWatermark);
+
+    // Each shard receives its share of the watermarks, rounded up, so that no
+    // shard has a watermark of 0.
+
+    const bsl::size_t lowWatermark  =
+                                 (d_lowWatermark  + numShards - 1) / numShards;
+    const bsl::size_t highWatermark =
+                                 (d_highWatermark + numShards - 1) / numShards;
+
+    d_shards.reserve(numShards);
+    for (bsl::size_t i = 0; i < numShards; ++i) {
+        CacheType *shard_p = new (*d_allocator_p) CacheType(evictionPolicy,
+                                                            lowWatermark,
+                                                            highWatermark,
+                                                            d_hashFunction,
+                                                            equalFunction,
+                                                            d_allocator_p);
+        d_shards.push_back(bsl::shared_ptr<CacheType>(shard_p,
+                                                      d_allocator_p));
+    }
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                 bsl::size_t                numShards,
+                                 CacheEvictionPolicy::Enum  evictionPolicy,
+                                 bsl::size_t                lowWatermark,
+                                 bsl::size_t                highWatermark,
+                                 bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_hashFunction()
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    createShards(numShards, evictionPolicy, EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                 bsl::size_t                numShards,
+                                 CacheEvictionPolicy::Enum  evictionPolicy,
+                                 bsl::size_t                lowWatermark,
+                                 bsl::size_t                highWatermark,
+                                 const HASH&                hashFunction,
+                                 const EQUAL&               equalFunction,
+                                 bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_hashFunction(hashFunction)
+, d_lowWatermark(lowWatermark)
+, d_highWatermark(highWatermark)
+{
+    createShards(numShards, evictionPolicy, equalFunction);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_shards[shardIndex(key)]->erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                  const bsl::vector<KEY>& keys)
+{
+    if (1 == d_shards.size()) {
+        return d_shards[0]->eraseBulk(keys);                          // RETURN
+    }
+
+    bsl::vector<bsl::vector<KEY> > keysPerShard(d_shards.size(),
+                                                bsl::vector<KEY>(),
+                                                d_allocator_p);
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        keysPerShard[shardIndex(keys[i])].push_back(keys[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!keysPerShard[i].empty()) {
+            count += d_shards[i]->eraseBulk(keysPerShard[i]);
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    d_shards[shardIndex(key)]->insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               const KEY&               key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    d_shards[shardIndex(key)]->insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                 bslmf::MovableRef<KEY> key,
+                                                 const VALUE&           value)
+{
+    KEY& localKey = key;
+    d_shards[shardIndex(localKey)]->insert(bslmf::MovableRefUtil::move(key),
+                                           value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                               bslmf::MovableRef<KEY>   key,
+                                               bslmf::MovableRef<VALUE> value)
+{
+    KEY& localKey = key;
+    d_shards[shardIndex(localKey)]->insert(
+                                           bslmf::MovableRefUtil::move(key),
+                                           bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                const KEY&          key,
+                                                const ValuePtrType& valuePtr)
+{
+    d_shards[shardIndex(key)]->insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY> key,
+                                              const ValuePtrType&    valuePtr)
+{
+    KEY& localKey = key;
+    d_shards[shardIndex(localKey)]->insert(bslmf::MovableRefUtil::move(key),
+                                           valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                              const bsl::vector<KVType>& data)
+{
+    if (1 == d_shards.size()) {
+        return d_shards[0]->insertBulk(data);                         // RETURN
+    }
+
+    bsl::vector<bsl::vector<KVType> > dataPerShard(d_shards.size(),
+                                                   bsl::vector<KVType>(),
+                                                   d_allocator_p);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        dataPerShard[shardIndex(data[i].first)].push_back(data[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!dataPerShard[i].empty()) {
+            count += d_shards[i]->insertBulk(
+                          bslmf::MovableRefUtil::move(dataPerShard[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::resetStatistics()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->resetStatistics();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->setPostEvictionCallback(postEvictionCallback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    return d_shards[shardIndex(key)]->tryGetValue(value,
+                                                  key,
+                                                  modifyEvictionQueue);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards[0]->equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_shards[0]->evictionPolicy();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_highWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_lowWatermark;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Int64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    bsls::Types::Int64 result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->numEvictions();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Int64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    bsls::Types::Int64 result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->numHits();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Int64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    bsls::Types::Int64 result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->numMisses();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndex(const KEY& key) const
+{
+    // The hash value is mixed before being reduced to a shard index so that
+    // the shard index is independent from the bucket index used by the hash
+    // table of the shard, which is computed from the same hash value.
+
+    enum { k_HALF_BITS = sizeof(bsl::size_t) * 4 };
+
+    bsl::size_t hashValue = d_hashFunction(key);
+    hashValue ^= hashValue >> k_HALF_BITS;
+    hashValue *= static_cast<bsl::size_t>(0x9E3779B97F4A7C15ULL);
+    hashValue ^= hashValue >> k_HALF_BITS;
+
+    return hashValue % d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    ShardedCache_Visitor<KEY, VALUE, VISITOR> adapter(&visitor);
+
+    for (bsl::size_t i = 0; i < d_shards.size() && adapter.d_continue; ++i) {
+        d_shards[i]->visit(adapter);
+    }
+}
+
+                                  // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *ShardedCache<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY,  class VALUE,  class HASH,  class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1301 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_shardedcache.h>
+
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmt_threadgroup.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// provides an in-memory key-value cache partitioned into independent
+// 'bdlcc::Cache' objects.  Since all of the functionality of storing,
+// retrieving, and evicting items is delegated to 'bdlcc::Cache', which is
+// tested in its own test driver, this test driver concentrates on verifying
+// that the operations are forwarded to the correct shard, that the aggregate
+// watermarks are correctly divided among the shards, and that the operations
+// on several shards ('insertBulk', 'eraseBulk', 'clear', 'size', and 'visit')
+// behave as documented.
+//
+// Primary Manipulators:
+//: o 'insert'
+//: o 'erase'
+//: o 'clear'
+//
+// Basic Accessors:
+//: o 'tryGetValue'
+//: o 'size'
+//: o 'numShards'
+//: o 'shardIndex'
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedCache(numShards, policy, lowWat, highWat, alloc);
+// [ 2] ShardedCache(numShards, policy, lowWat, highWat, hash, equal, alloc);
+//
+// MANIPULATORS
+// [ 3] void clear();
+// [ 3] int erase(const KEY& key);
+// [ 5] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 3] void insert(const KEY& key, const VALUE& value);
+// [ 3] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 3] void insert(MovableRef<KEY> key, const VALUE& value);
+// [ 3] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 3] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 3] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 5] int insertBulk(const bsl::vector<KVType>& data);
+// [ 8] void resetStatistics();
+// [ 4] void setPostEvictionCallback(postEvictionCallback);
+// [ 3] int tryGetValue(value, key, modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 8] bsls::Types::Int64 numEvictions() const;
+// [ 8] bsls::Types::Int64 numHits() const;
+// [ 8] bsls::Types::Int64 numMisses() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 3] bsl::size_t shardIndex(const KEY& key) const;
+// [ 3] bsl::size_t size() const;
+// [ 6] void visit(VISITOR& visitor) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] EVICTION
+// [ 7] CONCURRENCY
+// [ 9] USAGE EXAMPLE
+// [-1] READ THROUGHPUT BENCHMARK
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ShardedCache<int, int>         Obj;
+typedef bdlcc::ShardedCache<int, bsl::string> StringObj;
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       HELPER CLASSES AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct TestHash {
+    // This 'struct' provides a hash functor distinguishable by its 'd_id'.
+
+    // DATA
+    int d_id;
+
+    // CREATORS
+    explicit TestHash(int id = 0)
+        // Create a 'TestHash' object having the optionally specified 'id'.
+    : d_id(id)
+    {
+    }
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+        // Return the specified 'key' converted to 'bsl::size_t'.
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+struct TestEqual {
+    // This 'struct' provides an equality functor distinguishable by its
+    // 'd_id'.
+
+    // DATA
+    int d_id;
+
+    // CREATORS
+    explicit TestEqual(int id = 0)
+        // Create a 'TestEqual' object having the optionally specified 'id'.
+    : d_id(id)
+    {
+    }
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal, and
+        // 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+};
+
+void recordEviction(bsl::vector<int> *evicted, const bsl::shared_ptr<int>& v)
+    // Append the value referred to by the specified 'v' to the specified
+    // 'evicted'.
+{
+    evicted->push_back(*v);
+}
+
+struct KeyCollector {
+    // This 'struct' provides a visitor recording the visited keys, and
+    // stopping after a configurable number of keys.
+
+    // DATA
+    bsl::vector<int> d_keys;   // visited keys
+    bsl::size_t      d_limit;  // number of keys to visit
+
+    // CREATORS
+    KeyCollector(bsl::size_t limit, bslma::Allocator *basicAllocator)
+        // Create a 'KeyCollector' object visiting at most the specified
+        // 'limit' keys, and using the specified 'basicAllocator' to supply
+        // memory.
+    : d_keys(basicAllocator)
+    , d_limit(limit)
+    {
+    }
+
+    // MANIPULATORS
+    bool operator()(int key, int)
+        // Record the specified 'key', and return 'true' if more keys may be
+        // visited.
+    {
+        d_keys.push_back(key);
+        return d_keys.size() < d_limit;
+    }
+};
+
+                          // =====================
+                          // class ConcurrencyTest
+                          // =====================
+
+class ConcurrencyTest {
+    // This class provides the thread functions of the concurrency test.
+
+    // DATA
+    Obj              *d_cache_p;   // cache under test (held, not owned)
+    int               d_numKeys;   // number of distinct keys
+    int               d_numIter;   // number of iterations per thread
+    bsls::AtomicInt   d_numErrors; // number of inconsistent values read
+
+  public:
+    // CREATORS
+    ConcurrencyTest(Obj *cache, int numKeys, int numIter)
+        // Create a 'ConcurrencyTest' object operating on the specified
+        // 'cache', using the specified 'numKeys' keys and the specified
+        // 'numIter' iterations per thread.
+    : d_cache_p(cache)
+    , d_numKeys(numKeys)
+    , d_numIter(numIter)
+    , d_numErrors(0)
+    {
+    }
+
+    // MANIPULATORS
+    void run(int seed)
+        // Perform a pseudo-random mix of 'insert', 'tryGetValue', and 'erase'
+        // operations on the cache, using the specified 'seed'.  A value read
+        // from the cache must be the key times 10.
+    {
+        unsigned int state = static_cast<unsigned int>(seed) * 2654435761U;
+        for (int i = 0; i < d_numIter; ++i) {
+            state = state * 1103515245U + 12345U;
+            const int key = static_cast<int>((state >> 8) % d_numKeys);
+            const int op  = static_cast<int>((state >> 24) % 10);
+
+            if (op < 6) {
+                bsl::shared_ptr<int> value;
+                if (0 == d_cache_p->tryGetValue(&value, key) &&
+                    key * 10 != *value) {
+                    ++d_numErrors;
+                }
+            }
+            else if (op < 9) {
+                d_cache_p->insert(key, key * 10);
+            }
+            else {
+                d_cache_p->erase(key);
+            }
+        }
+    }
+
+    // ACCESSORS
+    int numErrors() const
+        // Return the number of inconsistent values read.
+    {
+        return d_numErrors;
+    }
+};
+
+                        // =========================
+                        // class ReadThroughputTest
+                        // =========================
+
+template <class CACHE>
+class ReadThroughputTest {
+    // This class provides the thread functions of the read throughput
+    // benchmark.
+
+    // DATA
+    CACHE *d_cache_p;  // cache under test (held, not owned)
+    int    d_numKeys;  // number of distinct keys
+
+  public:
+    // CREATORS
+    ReadThroughputTest(CACHE *cache, int numKeys)
+        // Create a 'ReadThroughputTest' object operating on the specified
+        // 'cache' holding the specified 'numKeys' keys.
+    : d_cache_p(cache)
+    , d_numKeys(numKeys)
+    {
+    }
+
+    // MANIPULATORS
+    void read(int threadIndex)
+        // Read a pseudo-random key selected using the specified
+        // 'threadIndex'.
+    {
+        static bsls::AtomicInt s_counter(0);
+        const int              key = (++s_counter + threadIndex * 7919)
+                                                                   % d_numKeys;
+
+        bsl::shared_ptr<int> value;
+        d_cache_p->tryGetValue(&value, key);
+    }
+};
+
+template <class CACHE>
+double readThroughput(CACHE *cache, int numThreads, int numKeys, int millis)
+    // Return the median number of read operations per second performed by
+    // the specified 'numThreads' threads on the specified 'cache' holding the
+    // specified 'numKeys' keys, over the specified 'millis' milliseconds.
+{
+    for (int i = 0; i < numKeys; ++i) {
+        cache->insert(i, i);
+    }
+
+    ReadThroughputTest<CACHE> test(cache, numKeys);
+
+    bslmt::ThroughputBenchmark bench;
+    bench.addThreadGroup(bdlf::BindUtil::bind(&ReadThroughputTest<CACHE>::read,
+                                              &test,
+                                              bdlf::PlaceHolders::_1),
+                         numThreads,
+                         10);
+
+    bslmt::ThroughputBenchmarkResult result;
+    bench.execute(&result, millis, 5);
+
+    double median;
+    result.getMedian(&median, 0);
+    return median;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample1 {
+
+bslma::TestAllocator talloc("usage", veryVeryVeryVerbose);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Basic Usage
+/// - - - - - - - - - - -
+// This example shows some basic usage of the sharded cache.
+
+void example1()
+{
+// First, we define a 'bdlcc::ShardedCache' object, 'myCache', that maps 'int'
+// to 'bsl::string', is made of 4 shards, uses the CLOCK eviction policy, and
+// holds at most around 100 items:
+//..
+    bdlcc::ShardedCache<int, bsl::string> myCache(
+                                          4,
+                                          bdlcc::CacheEvictionPolicy::e_CLOCK,
+                                          100,
+                                          100,
+                                          &talloc);
+    ASSERT(4   == myCache.numShards());
+    ASSERT(100 == myCache.highWatermark());
+//..
+// Then, we insert a few items into the cache, and verify that the size of the
+// cache has been updated correctly:
+//..
+    myCache.insert(0, "Alex");
+    myCache.insert(1, "John");
+    myCache.insert(2, "Rob");
+    ASSERT(3 == myCache.size());
+//..
+// Next, we retrieve the value of one of the items using 'tryGetValue'; since
+// the eviction policy is CLOCK, only the shard holding the item is read
+// locked:
+//..
+    bsl::shared_ptr<bsl::string> value;
+    int rc = myCache.tryGetValue(&value, 1);
+    ASSERT(0 == rc);
+    ASSERT("John" == *value);
+//..
+// Now, we insert many more items into the cache:
+//..
+    for (int i = 3; i < 1000; ++i) {
+        myCache.insert(i, "Other");
+    }
+//..
+// Finally, we observe that the size of the cache is kept close to the high
+// watermark, even though each shard evicts its own items independently:
+//..
+    ASSERT(myCache.size() <= 100 + myCache.numShards());
+//..
+}
+
+}  // close namespace usageExample1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample1::example1();
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // STATISTICS
+        //
+        // Concerns:
+        //: 1 The statistics of the cache are the sums of the statistics of
+        //:   its shards.
+        //:
+        //: 2 'resetStatistics' resets the statistics of all shards.
+        //
+        // Plan:
+        //: 1 Perform a known number of hits, misses, and evictions on caches
+        //:   having various numbers of shards, and verify the statistics.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numEvictions() const;
+        //   bsls::Types::Int64 numHits() const;
+        //   bsls::Types::Int64 numMisses() const;
+        //   void resetStatistics();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATISTICS" << endl
+                          << "==========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::size_t NUM_SHARDS[] = { 1, 3, 8 };
+
+        for (bsl::size_t ti = 0;
+             ti < sizeof NUM_SHARDS / sizeof *NUM_SHARDS;
+             ++ti) {
+            const bsl::size_t SHARDS = NUM_SHARDS[ti];
+
+            Obj mX(SHARDS, bdlcc::CacheEvictionPolicy::e_TINYLFU, 80, 80, &oa);
+            const Obj& X = mX;
+
+            for (int i = 0; i < 40; ++i) {
+                mX.insert(i, i);
+            }
+
+            bsl::shared_ptr<int> value;
+            for (int i = 0; i < 60; ++i) {
+                mX.tryGetValue(&value, i);
+            }
+            ASSERTV(SHARDS, X.numHits(),      40 == X.numHits());
+            ASSERTV(SHARDS, X.numMisses(),    20 == X.numMisses());
+            ASSERTV(SHARDS, X.numEvictions(),  0 == X.numEvictions());
+
+            for (int i = 40; i < 1000; ++i) {
+                mX.insert(i, i);
+            }
+            ASSERTV(SHARDS, X.numEvictions(), X.size(),
+                    1000 == X.numEvictions() + static_cast<int>(X.size()));
+
+            mX.resetStatistics();
+            ASSERTV(SHARDS, 0 == X.numHits());
+            ASSERTV(SHARDS, 0 == X.numMisses());
+            ASSERTV(SHARDS, 0 == X.numEvictions());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 The cache can be used concurrently by several threads inserting,
+        //:   reading, and erasing items, with each eviction policy.
+        //:
+        //: 2 A value read from the cache is always the value inserted for the
+        //:   key.
+        //
+        // Plan:
+        //: 1 For each eviction policy, run several threads performing a
+        //:   pseudo-random mix of operations on a cache smaller than the
+        //:   number of keys, and verify that the values read are consistent
+        //:   and that the size of the cache stays bounded.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
+            bdlcc::CacheEvictionPolicy::e_LRU,
+            bdlcc::CacheEvictionPolicy::e_FIFO,
+            bdlcc::CacheEvictionPolicy::e_CLOCK,
+            bdlcc::CacheEvictionPolicy::e_TINYLFU
+        };
+        const int NUM_POLICIES = static_cast<int>(sizeof POLICIES /
+                                                  sizeof *POLICIES);
+
+        const int k_NUM_THREADS = 4;
+        const int k_NUM_KEYS    = 500;
+        const int k_NUM_ITER    = 20000;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_POLICIES; ++ti) {
+            const bdlcc::CacheEvictionPolicy::Enum POLICY = POLICIES[ti];
+
+            Obj mX(8, POLICY, 100, 120, &oa);  const Obj& X = mX;
+
+            ConcurrencyTest test(&mX, k_NUM_KEYS, k_NUM_ITER);
+
+            bslmt::ThreadGroup threadGroup(&oa);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERTV(ti, i, 0 == threadGroup.addThread(
+                                  bdlf::BindUtil::bind(&ConcurrencyTest::run,
+                                                       &test,
+                                                       i)));
+            }
+            threadGroup.joinAll();
+
+            ASSERTV(ti, test.numErrors(), 0 == test.numErrors());
+            ASSERTV(ti, X.size(), X.size() <= 8 * 15);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // VISIT
+        //
+        // Concerns:
+        //: 1 'visit' calls the visitor once for every item of every shard.
+        //:
+        //: 2 Items of a shard are visited in the order of the eviction queue
+        //:   of that shard.
+        //:
+        //: 3 Once the visitor has returned 'false', no more items are
+        //:   visited, including items of the following shards.
+        //
+        // Plan:
+        //: 1 Insert items into a FIFO cache having several shards, and visit
+        //:   them with a visitor recording the visited keys.  Verify that all
+        //:   keys are visited and that the keys of each shard are visited in
+        //:   insertion order.  (C-1..2)
+        //:
+        //: 2 Visit the items with a visitor returning 'false' after 1, and
+        //:   then 'N', keys, for various 'N'.  Verify the number of visited
+        //:   keys.  (C-3)
+        //
+        // Testing:
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VISIT" << endl
+                          << "=====" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int k_NUM_KEYS = 40;
+
+        Obj mX(4, bdlcc::CacheEvictionPolicy::e_FIFO, 100, 100, &oa);
+        const Obj& X = mX;
+
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            mX.insert(i, i);
+        }
+
+        {
+            KeyCollector collector(k_NUM_KEYS + 1, &oa);
+            X.visit(collector);
+
+            ASSERTV(collector.d_keys.size(),
+                    k_NUM_KEYS == static_cast<int>(collector.d_keys.size()));
+
+            bsl::set<int> keys(collector.d_keys.begin(),
+                               collector.d_keys.end(),
+                               bsl::less<int>(),
+                               &oa);
+            ASSERT(k_NUM_KEYS == static_cast<int>(keys.size()));
+
+            bsl::size_t shard = 0;
+            for (bsl::size_t i = 1; i < collector.d_keys.size(); ++i) {
+                const int         PREV      = collector.d_keys[i - 1];
+                const int         CURR      = collector.d_keys[i];
+                const bsl::size_t PREV_SHARD = X.shardIndex(PREV);
+                const bsl::size_t CURR_SHARD = X.shardIndex(CURR);
+
+                ASSERTV(i, PREV_SHARD, CURR_SHARD, PREV_SHARD <= CURR_SHARD);
+                if (PREV_SHARD == CURR_SHARD) {
+                    ASSERTV(i, PREV, CURR, PREV < CURR);
+                }
+                shard = CURR_SHARD;
+            }
+            ASSERTV(shard, shard < X.numShards());
+        }
+
+        const bsl::size_t LIMITS[] = { 1, 2, 7, 15, 39 };
+        for (bsl::size_t ti = 0; ti < sizeof LIMITS / sizeof *LIMITS; ++ti) {
+            const bsl::size_t LIMIT = LIMITS[ti];
+
+            KeyCollector collector(LIMIT, &oa);
+            X.visit(collector);
+
+            ASSERTV(LIMIT,
+                    collector.d_keys.size(),
+                    LIMIT == collector.d_keys.size());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // BULK OPERATIONS
+        //
+        // Concerns:
+        //: 1 'insertBulk' inserts every item of its argument into the shard
+        //:   selected by its key, and returns the number of new items.
+        //:
+        //: 2 'eraseBulk' erases every item of its argument from the shard
+        //:   selected by its key, and returns the number of erased items.
+        //:
+        //: 3 Both methods work with a single shard.
+        //
+        // Plan:
+        //: 1 For caches having 1 and 5 shards, insert a vector of items
+        //:   containing some existing keys, and verify the return value and
+        //:   the content of the cache.  (C-1, 3)
+        //:
+        //: 2 Erase a vector of keys containing some keys not in the cache, and
+        //:   verify the return value and the content of the cache.  (C-2..3)
+        //
+        // Testing:
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK OPERATIONS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::size_t NUM_SHARDS[] = { 1, 5 };
+
+        for (bsl::size_t ti = 0;
+             ti < sizeof NUM_SHARDS / sizeof *NUM_SHARDS;
+             ++ti) {
+            const bsl::size_t SHARDS = NUM_SHARDS[ti];
+
+            Obj mX(SHARDS, bdlcc::CacheEvictionPolicy::e_LRU, 100, 100, &oa);
+            const Obj& X = mX;
+
+            mX.insert(0, 0);
+            mX.insert(1, 1);
+
+            bsl::vector<Obj::KVType> data(&oa);
+            for (int i = 0; i < 20; ++i) {
+                data.push_back(Obj::KVType(i,
+                                           bsl::allocate_shared<int>(&oa,
+                                                                     i + 50)));
+            }
+
+            ASSERTV(SHARDS, 18 == mX.insertBulk(data));
+            ASSERTV(SHARDS, X.size(), 20 == X.size());
+
+            for (int i = 0; i < 20; ++i) {
+                bsl::shared_ptr<int> value;
+                ASSERTV(SHARDS, i, 0 == mX.tryGetValue(&value, i));
+                ASSERTV(SHARDS, i, i + 50 == *value);
+            }
+
+            bsl::vector<int> keys(&oa);
+            for (int i = 10; i < 30; ++i) {
+                keys.push_back(i);
+            }
+
+            ASSERTV(SHARDS, 10 == mX.eraseBulk(keys));
+            ASSERTV(SHARDS, X.size(), 10 == X.size());
+
+            for (int i = 0; i < 20; ++i) {
+                bsl::shared_ptr<int> value;
+                ASSERTV(SHARDS, i, (i < 10 ? 0 : 1) ==
+                                                  mX.tryGetValue(&value, i));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // EVICTION
+        //
+        // Concerns:
+        //: 1 Each shard evicts its own items when its share of the high
+        //:   watermark is reached.
+        //:
+        //: 2 The size of the cache never exceeds the high watermark by more
+        //:   than the number of shards.
+        //:
+        //: 3 The post-eviction callback is invoked by every shard, for every
+        //:   evicted or erased item.
+        //:
+        //: 4 A single shard behaves as a 'bdlcc::Cache'.
+        //
+        // Plan:
+        //: 1 Set a post-eviction callback recording the evicted values, and
+        //:   insert many items into caches having various numbers of shards.
+        //:   Verify the size of the cache after each insertion, and verify
+        //:   that every item is either in the cache or has been evicted.
+        //:   (C-1..3)
+        //:
+        //: 2 Using a single shard, verify that the evicted items are the
+        //:   first inserted items.  (C-4)
+        //
+        // Testing:
+        //   EVICTION
+        //   void setPostEvictionCallback(postEvictionCallback);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EVICTION" << endl
+                          << "========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const bsl::size_t NUM_SHARDS[] = { 1, 2, 3, 7, 16 };
+
+        for (bsl::size_t ti = 0;
+             ti < sizeof NUM_SHARDS / sizeof *NUM_SHARDS;
+             ++ti) {
+            const bsl::size_t SHARDS = NUM_SHARDS[ti];
+            const int         NUM_KEYS = 1000;
+
+            bsl::vector<int> evicted(&oa);
+
+            Obj mX(SHARDS, bdlcc::CacheEvictionPolicy::e_FIFO, 48, 64, &oa);
+            const Obj& X = mX;
+
+            mX.setPostEvictionCallback(
+                       Obj::PostEvictionCallback(
+                              bsl::allocator_arg,
+                              &oa,
+                              bdlf::BindUtil::bind(&recordEviction,
+                                                   &evicted,
+                                                   bdlf::PlaceHolders::_1)));
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                mX.insert(i, i);
+                ASSERTV(SHARDS, i, X.size(), X.size() < 64 + SHARDS);
+            }
+            ASSERTV(SHARDS, X.size(), X.size() >= 48 - SHARDS);
+
+            bsl::vector<bool> seen(NUM_KEYS, false, &oa);
+            for (bsl::size_t i = 0; i < evicted.size(); ++i) {
+                ASSERTV(SHARDS, i, !seen[evicted[i]]);
+                seen[evicted[i]] = true;
+            }
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                bsl::shared_ptr<int> value;
+                const int            rc = mX.tryGetValue(&value, i);
+                ASSERTV(SHARDS, i, seen[i] == (1 == rc));
+            }
+            ASSERTV(SHARDS, NUM_KEYS == static_cast<int>(evicted.size() +
+                                                         X.size()));
+
+            if (1 == SHARDS) {
+                for (bsl::size_t i = 0; i < evicted.size(); ++i) {
+                    ASSERTV(i, evicted[i], static_cast<int>(i) == evicted[i]);
+                }
+            }
+
+            const bsl::size_t NUM_EVICTED = evicted.size();
+            ASSERT(0 == mX.erase(NUM_KEYS - 1));
+            ASSERT(NUM_EVICTED + 1 == evicted.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Each overload of 'insert' adds an item retrievable by
+        //:   'tryGetValue', or replaces the value of an existing item.
+        //:
+        //: 2 'shardIndex' is in the range '[0 .. numShards() - 1]', and keys
+        //:   are distributed among all shards, even if the hash function is
+        //:   the identity.
+        //:
+        //: 3 'erase' removes exactly the specified item.
+        //:
+        //: 4 'clear' removes all items of all shards.
+        //:
+        //: 5 'size' returns the number of items in all shards.
+        //:
+        //: 6 All memory is supplied by the object allocator.
+        //
+        // Plan:
+        //: 1 Insert items using each overload of 'insert', verify that they
+        //:   can be retrieved, and that 'size' is correct.  (C-1, 5)
+        //:
+        //: 2 Count the number of keys mapped to each shard for a range of
+        //:   consecutive keys, and for a range of keys multiple of the number
+        //:   of shards.  (C-2)
+        //:
+        //: 3 Erase and clear the items, and verify the content of the cache.
+        //:   Verify that memory is released.  (C-3..4, 6)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   bsl::size_t shardIndex(const KEY& key) const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS" << endl
+                          << "====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            StringObj mX(4,
+                         bdlcc::CacheEvictionPolicy::e_LRU,
+                         100,
+                         100,
+                         &oa);
+            const StringObj& X = mX;
+
+            const bsl::string LONG_A("a long string that allocates memory",
+                                     &oa);
+            const bsl::string LONG_B("another string that allocates memory",
+                                     &oa);
+
+            mX.insert(0, LONG_A);
+            {
+                bsl::string value(LONG_B, &oa);
+                mX.insert(1, bslmf::MovableRefUtil::move(value));
+            }
+            {
+                int key = 2;
+                mX.insert(bslmf::MovableRefUtil::move(key), LONG_A);
+            }
+            {
+                int         key = 3;
+                bsl::string value(LONG_B, &oa);
+                mX.insert(bslmf::MovableRefUtil::move(key),
+                          bslmf::MovableRefUtil::move(value));
+            }
+            const StringObj::ValuePtrType PTR =
+                                bsl::allocate_shared<bsl::string>(&oa, LONG_A);
+            mX.insert(4, PTR);
+            {
+                int key = 5;
+                mX.insert(bslmf::MovableRefUtil::move(key), PTR);
+            }
+            ASSERTV(X.size(), 6 == X.size());
+
+            for (int i = 0; i < 6; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERTV(i, 0 == mX.tryGetValue(&value, i, i % 2));
+                ASSERTV(i, *value, (1 == i || 3 == i ? LONG_B : LONG_A)
+                                                                   == *value);
+            }
+
+            mX.insert(0, LONG_B);
+            ASSERTV(X.size(), 6 == X.size());
+            {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERT(0 == mX.tryGetValue(&value, 0));
+                ASSERT(LONG_B == *value);
+                ASSERT(1 == mX.tryGetValue(&value, 6));
+            }
+
+            ASSERT(0 == mX.erase(3));
+            ASSERT(1 == mX.erase(3));
+            ASSERTV(X.size(), 5 == X.size());
+            {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERT(1 == mX.tryGetValue(&value, 3));
+                ASSERT(0 == mX.tryGetValue(&value, 2));
+            }
+
+            mX.clear();
+            ASSERTV(X.size(), 0 == X.size());
+            for (int i = 0; i < 6; ++i) {
+                bsl::shared_ptr<bsl::string> value;
+                ASSERTV(i, 1 == mX.tryGetValue(&value, i));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        {
+            const bsl::size_t NUM_SHARDS[] = { 1, 2, 4, 5, 8, 13 };
+
+            for (bsl::size_t ti = 0;
+                 ti < sizeof NUM_SHARDS / sizeof *NUM_SHARDS;
+                 ++ti) {
+                const bsl::size_t SHARDS   = NUM_SHARDS[ti];
+                const int         NUM_KEYS = static_cast<int>(SHARDS) * 64;
+
+                Obj mX(SHARDS,
+                       bdlcc::CacheEvictionPolicy::e_FIFO,
+                       1,
+                       1,
+                       &oa);
+                const Obj& X = mX;
+
+                bsl::vector<int> consecutive(SHARDS, 0, &oa);
+                bsl::vector<int> strided(SHARDS, 0, &oa);
+
+                for (int i = 0; i < NUM_KEYS; ++i) {
+                    const bsl::size_t INDEX1 = X.shardIndex(i);
+                    const bsl::size_t INDEX2 = X.shardIndex(
+                                               i * static_cast<int>(SHARDS));
+                    ASSERTV(SHARDS, i, INDEX1, INDEX1 < SHARDS);
+                    ASSERTV(SHARDS, i, INDEX2, INDEX2 < SHARDS);
+                    ++consecutive[INDEX1];
+                    ++strided[INDEX2];
+                }
+
+                for (bsl::size_t i = 0; i < SHARDS; ++i) {
+                    // Expect each shard to receive at least a quarter of its
+                    // fair share.
+
+                    ASSERTV(SHARDS, i, consecutive[i], consecutive[i] >= 16);
+                    ASSERTV(SHARDS, i, strided[i],     strided[i]     >= 16);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructors create an empty cache having the specified
+        //:   number of shards, eviction policy, and watermarks.
+        //:
+        //: 2 The specified hash and equality functors are used.
+        //:
+        //: 3 All memory is supplied by the specified allocator, or the
+        //:   default allocator if none is specified, and is released on
+        //:   destruction.
+        //:
+        //: 4 Each shard receives its share of the watermarks, rounded up.
+        //
+        // Plan:
+        //: 1 Create caches with various numbers of shards, eviction policies,
+        //:   and watermarks, and verify the values of the accessors.
+        //:   (C-1..3)
+        //:
+        //: 2 Fill a cache with keys mapped to a single shard, and verify that
+        //:   its size does not exceed the share of the high watermark of that
+        //:   shard.  (C-4)
+        //
+        // Testing:
+        //   ShardedCache(numShards, policy, lowWat, highWat, alloc);
+        //   ShardedCache(numShards, policy, lowWat, highWat, hash, eq, alloc);
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   bsl::size_t numShards() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        static const struct {
+            int                              d_line;
+            bsl::size_t                      d_numShards;
+            bdlcc::CacheEvictionPolicy::Enum d_policy;
+            bsl::size_t                      d_lowWatermark;
+            bsl::size_t                      d_highWatermark;
+        } DATA[] = {
+            { L_,  1, bdlcc::CacheEvictionPolicy::e_LRU,     1,    1 },
+            { L_,  1, bdlcc::CacheEvictionPolicy::e_FIFO,   10,   20 },
+            { L_,  4, bdlcc::CacheEvictionPolicy::e_CLOCK,   1,    2 },
+            { L_,  4, bdlcc::CacheEvictionPolicy::e_LRU,   100,  100 },
+            { L_,  7, bdlcc::CacheEvictionPolicy::e_FIFO,   50,  101 },
+            { L_, 32, bdlcc::CacheEvictionPolicy::e_CLOCK, 900, 1000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                              LINE   = DATA[ti].d_line;
+            const bsl::size_t                      SHARDS =
+                                                          DATA[ti].d_numShards;
+            const bdlcc::CacheEvictionPolicy::Enum POLICY = DATA[ti].d_policy;
+            const bsl::size_t                      LOW    =
+                                                       DATA[ti].d_lowWatermark;
+            const bsl::size_t                      HIGH   =
+                                                      DATA[ti].d_highWatermark;
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            bslma::TestAllocator da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            {
+                Obj mX(SHARDS, POLICY, LOW, HIGH, &oa);  const Obj& X = mX;
+
+                ASSERTV(LINE, SHARDS == X.numShards());
+                ASSERTV(LINE, POLICY == X.evictionPolicy());
+                ASSERTV(LINE, LOW    == X.lowWatermark());
+                ASSERTV(LINE, HIGH   == X.highWatermark());
+                ASSERTV(LINE, 0      == X.size());
+                ASSERTV(LINE, &oa    == X.allocator());
+                ASSERTV(LINE, 0      <  oa.numBlocksInUse());
+                ASSERTV(LINE, 0      == da.numBlocksTotal());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                bdlcc::ShardedCache<int, int, TestHash, TestEqual> mX(
+                                                                SHARDS,
+                                                                POLICY,
+                                                                LOW,
+                                                                HIGH,
+                                                                TestHash(7),
+                                                                TestEqual(9),
+                                                                &oa);
+                const bdlcc::ShardedCache<int, int, TestHash, TestEqual>& X =
+                                                                            mX;
+
+                ASSERTV(LINE, SHARDS == X.numShards());
+                ASSERTV(LINE, POLICY == X.evictionPolicy());
+                ASSERTV(LINE, LOW    == X.lowWatermark());
+                ASSERTV(LINE, HIGH   == X.highWatermark());
+                ASSERTV(LINE, 7      == X.hashFunction().d_id);
+                ASSERTV(LINE, 9      == X.equalFunction().d_id);
+                ASSERTV(LINE, 0      == da.numBlocksTotal());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                Obj mX(SHARDS, POLICY, LOW, HIGH);  const Obj& X = mX;
+
+                ASSERTV(LINE, &da == X.allocator());
+                ASSERTV(LINE, 0   <  da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == da.numBlocksInUse());
+
+            {
+                Obj mX(SHARDS, POLICY, LOW, HIGH, &oa);  const Obj& X = mX;
+
+                const bsl::size_t SHARE = (HIGH + SHARDS - 1) / SHARDS;
+                const bsl::size_t SHARD = X.shardIndex(0);
+
+                int inserted = 0;
+                for (int key = 0; inserted < 1000; ++key) {
+                    if (SHARD == X.shardIndex(key)) {
+                        mX.insert(key, key);
+                        ++inserted;
+                        ASSERTV(LINE, X.size(), SHARE, X.size() <= SHARE);
+                    }
+                }
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a cache, insert, retrieve, and erase some items.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(4, bdlcc::CacheEvictionPolicy::e_LRU, 10, 20, &oa);
+            const Obj& X = mX;
+
+            ASSERT(4  == X.numShards());
+            ASSERT(0  == X.size());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i, i * i);
+            }
+            ASSERT(10 == X.size());
+
+            bsl::shared_ptr<int> value;
+            ASSERT(0  == mX.tryGetValue(&value, 3));
+            ASSERT(9  == *value);
+            ASSERT(1  == mX.tryGetValue(&value, 10));
+
+            ASSERT(0  == mX.erase(3));
+            ASSERT(1  == mX.tryGetValue(&value, 3));
+            ASSERT(9  == X.size());
+
+            mX.clear();
+            ASSERT(0  == X.size());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ THROUGHPUT BENCHMARK
+        //   Compare the throughput of 'tryGetValue' on a 'bdlcc::Cache' and on
+        //   a 'bdlcc::ShardedCache', with the LRU and CLOCK eviction
+        //   policies.  Command line parameters:
+        //   2nd parameter: number of threads (default: 4)
+        //   3rd parameter: number of shards (default: 16)
+        //   4th parameter: duration of each sample in milliseconds
+        //                  (default: 500)
+        //
+        // Concerns:
+        //: 1 Sharding and the CLOCK policy reduce the contention of readers.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', measure the read throughput
+        //:   of each kind of cache, and report the results.  (C-1)
+        //
+        // Testing:
+        //   READ THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "READ THROUGHPUT BENCHMARK" << endl
+             << "=========================" << endl;
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int numShards  = argc > 3 ? atoi(argv[3]) : 16;
+        const int millis     = argc > 4 ? atoi(argv[4]) : 500;
+        const int numKeys    = 10000;
+
+        typedef bdlcc::Cache<int, int> CacheType;
+
+        const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
+            bdlcc::CacheEvictionPolicy::e_LRU,
+            bdlcc::CacheEvictionPolicy::e_CLOCK
+        };
+        const char *NAMES[] = { "LRU  ", "CLOCK" };
+
+        for (int ti = 0; ti < 2; ++ti) {
+            CacheType cache(POLICIES[ti], numKeys, numKeys);
+            Obj       sharded(numShards, POLICIES[ti], numKeys, numKeys);
+
+            const double single = readThroughput(&cache,
+                                                 numThreads,
+                                                 numKeys,
+                                                 millis);
+            const double shards = readThroughput(&sharded,
+                                                 numThreads,
+                                                 numKeys,
+                                                 millis);
+
+            cout << NAMES[ti] << " Cache:        " << single
+                 << " reads/s" << endl
+                 << NAMES[ti] << " ShardedCache: " << shards
+                 << " reads/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the default allocator.
+
+        ASSERT(dam.isTotalSame());
+
+        // CONCERN: In no case does memory come from the global allocator.
+
+        ASSERT(gam.isTotalSame());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -40,6 +40,14 @@ BSLS_IDENT("$Id: $")
 // blocked in 'popFront' when the queue is dequeue disabled return from
 // 'popFront' immediately and return an error code.
 //
+///Wait Strategy
+///-------------
+// By default, the consumer blocked in 'popFront' on an empty queue yields the
+// processor once and then blocks on a condition variable, so each wake-up
+// costs a context switch.  A latency-critical consumer may instead specify a
+// 'bdlcc::WaitStrategy::Enum' at construction to poll the queue before (or
+// instead of) blocking (see 'bdlcc_waitstrategy').
+//
 ///Template Requirements
 ///---------------------
 // 'bdlcc::SingleConsumerQueue' is a template that is parameterized on the type
@@ -148,6 +156,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlcc_singleconsumerqueueimpl.h>
+#include <bdlcc_waitstrategy.h>
 
 #include <bslalg_scalarprimitives.h>
 
@@ -216,6 +225,15 @@ class SingleConsumerQueue {
         // memory.  If 'basicAllocator' is 0, the currently installed default
         // allocator is used.
 
+    SingleConsumerQueue(bsl::size_t         capacity,
+                        WaitStrategy::Enum  waitStrategy,
+                        bslma::Allocator   *basicAllocator = 0);
+        // Create a thread-aware queue with, at least, the specified
+        // 'capacity', whose consumer waits in 'popFront' according to the
+        // specified 'waitStrategy'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
     //! ~SingleConsumerQueue() = default;
         // Destroy this object.
 
@@ -324,6 +342,10 @@ class SingleConsumerQueue {
         // thread waiting for the queue to empty will return 'e_DISABLED' if
         // 'disablePopFront' is invoked.
 
+    WaitStrategy::Enum waitStrategy() const;
+        // Return the strategy by which the consumer of this queue waits in
+        // 'popFront'.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -354,6 +376,15 @@ SingleConsumerQueue<TYPE>::SingleConsumerQueue(
 {
 }
 
+template <class TYPE>
+SingleConsumerQueue<TYPE>::SingleConsumerQueue(
+                                            bsl::size_t         capacity,
+                                            WaitStrategy::Enum  waitStrategy,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(capacity, waitStrategy, basicAllocator)
+{
+}
+
 // MANIPULATORS
 template <class TYPE>
 int SingleConsumerQueue<TYPE>::popFront(TYPE *value)
@@ -460,6 +491,13 @@ int SingleConsumerQueue<TYPE>::waitUntilEmpty() const
     return d_impl.waitUntilEmpty();
 }
 
+template <class TYPE>
+inline
+WaitStrategy::Enum SingleConsumerQueue<TYPE>::waitStrategy() const
+{
+    return d_impl.waitStrategy();
+}
+
                                   // Aspects
 
 template <class TYPE>
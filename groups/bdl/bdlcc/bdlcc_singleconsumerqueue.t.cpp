@@ -77,6 +77,7 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 2] SingleConsumerQueue(bslma::Allocator *basicAllocator = 0);
 // [ 5] SingleConsumerQueue(capacity, *bA = 0);
+// [13] SingleConsumerQueue(capacity, strategy, *bA = 0);
 // [ 2] ~SingleConsumerQueue();
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
@@ -95,10 +96,11 @@ using namespace bsl;
 // [ 6] bool isPushBackDisabled() const;
 // [ 4] bsl::size_t numElements() const;
 // [ 9] int waitUntilEmpty() const;
+// [13] WaitStrategy::Enum waitStrategy() const;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -700,6 +702,25 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
 //
 // <ELEMENT> ::= 'a' | 'b' | 'c' | 'd' | 'e'
 
+enum { k_NUM_WAIT_VALUES = 2000 };
+
+extern "C" void *waitStrategyPush(void *arg)
+    // Push the values from 0 to 'k_NUM_WAIT_VALUES - 1' onto the 'Obj'
+    // addressed by the specified 'arg', periodically sleeping so that the
+    // consumer exhausts any spinning of its wait strategy.
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    for (int i = 0; i < k_NUM_WAIT_VALUES; ++i) {
+        if (0 == i % 500) {
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+        mX.pushBack(i);
+    }
+
+    return 0;
+}
+
 int getValue(int *value, char specChar, int verboseFlag);
     // Place into the specified 'value' the value corresponding to the
     // specified 'specChar' and display errors to 'cerr' if the specified
@@ -872,7 +893,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -910,6 +931,101 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING WAIT STRATEGIES
+        //
+        // Concerns:
+        //: 1 The queue reports the wait strategy supplied at construction,
+        //:   and 'e_BLOCK' by default.
+        //:
+        //: 2 For every wait strategy, 'popFront' returns every value pushed,
+        //:   in order, whether or not it had to wait.
+        //:
+        //: 3 For every wait strategy, a consumer waiting in 'popFront'
+        //:   returns 'e_DISABLED' when 'disablePopFront' is invoked.
+        //:
+        //: 4 Memory is supplied by the object allocator only.
+        //
+        // Plan:
+        //: 1 For each wait strategy, create a queue, verify 'waitStrategy',
+        //:   and pop the values pushed by a thread that periodically sleeps.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 For each wait strategy, invoke 'popFront' on an empty queue
+        //:   while another thread disables dequeueing.  (C-3)
+        //
+        // Testing:
+        //   SingleConsumerQueue(capacity, strategy, *bA = 0);
+        //   WaitStrategy::Enum waitStrategy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING WAIT STRATEGIES" << endl
+                          << "=======================" << endl;
+
+        typedef bdlcc::WaitStrategy WS;
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(WS::e_BLOCK == X.waitStrategy());
+        }
+
+        const WS::Enum STRATEGIES[] = { WS::e_BLOCK,
+                                        WS::e_SPIN,
+                                        WS::e_SPIN_THEN_YIELD,
+                                        WS::e_SPIN_THEN_BLOCK };
+        const int      NUM_STRATEGIES = static_cast<int>(
+                                      sizeof STRATEGIES / sizeof *STRATEGIES);
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const WS::Enum STRATEGY = STRATEGIES[ti];
+
+            if (veryVerbose) { P(WS::toAscii(STRATEGY)) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bsls::Types::Int64 numDefault = defaultAllocator.numAllocations();
+
+            {
+                Obj mX(4, STRATEGY, &sa);  const Obj& X = mX;
+
+                ASSERTV(ti, STRATEGY == X.waitStrategy());
+                ASSERTV(ti, X.allocator() == &sa);
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::create(&handle, waitStrategyPush, &mX);
+
+                for (int i = 0; i < k_NUM_WAIT_VALUES; ++i) {
+                    int value = -1;
+
+                    ASSERTV(ti, i, e_SUCCESS == mX.popFront(&value));
+                    ASSERTV(ti, i, value, i == value);
+                }
+
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(ti, X.isEmpty());
+            }
+
+            {
+                Obj mX(4, STRATEGY, &sa);
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::create(&handle,
+                                          deferredDisablePopFront,
+                                          &mX);
+
+                int value;
+                ASSERTV(ti, e_DISABLED == mX.popFront(&value));
+
+                bslmt::ThreadUtil::join(handle);
+            }
+
+            ASSERTV(ti, numDefault == defaultAllocator.numAllocations());
+        }
+      } break;
       case 12: {
         // ---------------------------------------------------------
         // Ordering Guarantee Test
@@ -40,6 +40,11 @@ BSLS_IDENT("$Id: $")
 // blocked in 'popFront' when the queue is dequeue disabled return from
 // 'popFront' immediately and return an error code.
 //
+// By default, the consumer blocked in 'popFront' on an empty queue yields the
+// processor once and then blocks on 'CONDITION'.  A 'bdlcc::WaitStrategy'
+// may be specified at construction to have the consumer poll the queue before
+// (or instead of) blocking (see 'bdlcc_waitstrategy').
+//
 ///Exception safety
 ///----------------
 // A 'bdlcc::SingleConsumerQueueImpl' is exception neutral, and all of the
@@ -84,6 +89,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_waitstrategy.h>
+
 #include <bslalg_scalarprimitives.h>
 
 #include <bslma_deallocatorproctor.h>
@@ -309,6 +316,9 @@ class SingleConsumerQueueImpl {
                                              // generation count; see
                                              // *Implementation* *Note*
 
+    WaitStrategy::Enum  d_waitStrategy;      // how the consumer waits in
+                                             // 'popFront'
+
     bslma::Allocator   *d_allocator_p;       // allocator, held not owned
 
     // FRIENDS
@@ -359,6 +369,11 @@ class SingleConsumerQueueImpl {
         // stored in 'd_popFrontDisabled' and 'd_pushBackDisabled'.  See
         // *Implementation* *Note* for further details.
 
+    void init(bsl::size_t capacity);
+        // Initialize the state of this queue, and allocate the nodes for, at
+        // least, the specified 'capacity'.  This method is intended to be used
+        // by the constructors.
+
     void releaseAllRaw();
         // Return all memory to the allocator.  This method is intended to be
         // used by the destructor and to avoid a memory leak when there is an
@@ -398,6 +413,15 @@ class SingleConsumerQueueImpl {
         // memory.  If 'basicAllocator' is 0, the currently installed default
         // allocator is used.
 
+    SingleConsumerQueueImpl(bsl::size_t         capacity,
+                            WaitStrategy::Enum  waitStrategy,
+                            bslma::Allocator   *basicAllocator = 0);
+        // Create a thread-aware queue with, at least, the specified
+        // 'capacity', whose consumer waits in 'popFront' according to the
+        // specified 'waitStrategy'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
     ~SingleConsumerQueueImpl();
         // Destroy this container.  The behavior is undefined unless all access
         // or modification of the container has completed prior to this call.
@@ -507,6 +531,10 @@ class SingleConsumerQueueImpl {
         // thread waiting for the queue to empty will return 'e_DISABLED' if
         // 'disablePopFront' is invoked.
 
+    WaitStrategy::Enum waitStrategy() const;
+        // Return the strategy by which the consumer of this queue waits in
+        // 'popFront'.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -770,6 +798,46 @@ void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     }
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
+                                                  ::init(bsl::size_t capacity)
+{
+    ATOMIC_OP::initInt64(&d_capacity, 0);
+    ATOMIC_OP::initInt64(&d_state,    0);
+
+    ATOMIC_OP::initUint(&d_popFrontDisabled, 0);
+    ATOMIC_OP::initUint(&d_pushBackDisabled, 0);
+
+    ATOMIC_OP::initPointer(&d_nextWrite, 0);
+
+    SingleConsumerQueueImpl_ReleaseAllRawProctor<SingleConsumerQueueImpl <
+                                                    TYPE,
+                                                    ATOMIC_OP,
+                                                    MUTEX,
+                                                    CONDITION> > proctor(this);
+
+    Node *n = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+    ATOMIC_OP::initInt(&n->d_state, e_WRITABLE);
+    ATOMIC_OP::initPointer(&n->d_next, n);
+
+    ATOMIC_OP::setPtrRelease(&d_nextWrite, n);
+    ATOMIC_OP::setPtrRelease(&d_nextRead,  n);
+
+    for (bsl::size_t i = 0; i < capacity; ++i) {
+        Node *nn = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
+        ATOMIC_OP::initInt(&nn->d_state, e_WRITABLE);
+        ATOMIC_OP::initPointer(&nn->d_next,
+                               static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
+                                                                 &n->d_next)));
+        ATOMIC_OP::setPtrRelease(&n->d_next, nn);
+    }
+
+    ATOMIC_OP::addInt64AcqRel(&d_capacity, capacity);
+    ATOMIC_OP::addInt64AcqRel(&d_state, k_AVAILABLE_INC * capacity);
+
+    proctor.release();
+}
+
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
 void SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
                                                               ::releaseAllRaw()
@@ -809,30 +877,10 @@ SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 , d_writeMutex()
 , d_emptyMutex()
 , d_emptyCondition()
+, d_waitStrategy(WaitStrategy::e_BLOCK)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    ATOMIC_OP::initInt64(&d_capacity, 0);
-    ATOMIC_OP::initInt64(&d_state,    0);
-
-    ATOMIC_OP::initUint(&d_popFrontDisabled, 0);
-    ATOMIC_OP::initUint(&d_pushBackDisabled, 0);
-
-    ATOMIC_OP::initPointer(&d_nextWrite, 0);
-
-    SingleConsumerQueueImpl_ReleaseAllRawProctor<SingleConsumerQueueImpl <
-                                                    TYPE,
-                                                    ATOMIC_OP,
-                                                    MUTEX,
-                                                    CONDITION> > proctor(this);
-
-    Node *n = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
-    ATOMIC_OP::initInt(&n->d_state, e_WRITABLE);
-    ATOMIC_OP::initPointer(&n->d_next, n);
-
-    ATOMIC_OP::setPtrRelease(&d_nextWrite, n);
-    ATOMIC_OP::setPtrRelease(&d_nextRead,  n);
-
-    proctor.release();
+    init(0);
 }
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -844,42 +892,26 @@ SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
 , d_writeMutex()
 , d_emptyMutex()
 , d_emptyCondition()
+, d_waitStrategy(WaitStrategy::e_BLOCK)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    ATOMIC_OP::initInt64(&d_capacity, 0);
-    ATOMIC_OP::initInt64(&d_state,    0);
-
-    ATOMIC_OP::initUint(&d_popFrontDisabled, 0);
-    ATOMIC_OP::initUint(&d_pushBackDisabled, 0);
-
-    ATOMIC_OP::initPointer(&d_nextWrite, 0);
-
-    SingleConsumerQueueImpl_ReleaseAllRawProctor<SingleConsumerQueueImpl <
-                                                    TYPE,
-                                                    ATOMIC_OP,
-                                                    MUTEX,
-                                                    CONDITION> > proctor(this);
-
-    Node *n = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
-    ATOMIC_OP::initInt(&n->d_state, e_WRITABLE);
-    ATOMIC_OP::initPointer(&n->d_next, n);
-
-    ATOMIC_OP::setPtrRelease(&d_nextWrite, n);
-    ATOMIC_OP::setPtrRelease(&d_nextRead,  n);
-
-    for (bsl::size_t i = 0; i < capacity; ++i) {
-        Node *nn = static_cast<Node *>(d_allocator_p->allocate(sizeof(Node)));
-        ATOMIC_OP::initInt(&nn->d_state, e_WRITABLE);
-        ATOMIC_OP::initPointer(&nn->d_next,
-                               static_cast<Node *>(ATOMIC_OP::getPtrAcquire(
-                                                                 &n->d_next)));
-        ATOMIC_OP::setPtrRelease(&n->d_next, nn);
-    }
-
-    ATOMIC_OP::addInt64AcqRel(&d_capacity, capacity);
-    ATOMIC_OP::addInt64AcqRel(&d_state, k_AVAILABLE_INC * capacity);
+    init(capacity);
+}
 
-    proctor.release();
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::
+                    SingleConsumerQueueImpl(bsl::size_t         capacity,
+                                            WaitStrategy::Enum  waitStrategy,
+                                            bslma::Allocator   *basicAllocator)
+: d_readMutex()
+, d_readCondition()
+, d_writeMutex()
+, d_emptyMutex()
+, d_emptyCondition()
+, d_waitStrategy(waitStrategy)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(capacity);
 }
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -909,6 +941,16 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::popFront(
         // changed the node state already, or the consumer will change the node
         // state in 'popComplete'.
 
+        if (e_WRITABLE == nodeState) {
+            int numWaits = 0;
+            while (e_WRITABLE == nodeState
+                && generation ==
+                                ATOMIC_OP::getUintAcquire(&d_popFrontDisabled)
+                && WaitStrategy::pause(d_waitStrategy, &numWaits)) {
+                nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
+            }
+        }
+
         if (e_WRITABLE == nodeState) {
             bslmt::ThreadUtil::yield();
             nodeState = ATOMIC_OP::getIntAcquire(&nextRead->d_state);
@@ -1209,6 +1251,15 @@ int SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>
     return 0;
 }
 
+template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
+inline
+WaitStrategy::Enum
+SingleConsumerQueueImpl<TYPE, ATOMIC_OP, MUTEX, CONDITION>::waitStrategy()
+                                                                          const
+{
+    return d_waitStrategy;
+}
+
                                   // Aspects
 
 template <class TYPE, class ATOMIC_OP, class MUTEX, class CONDITION>
@@ -46,6 +46,16 @@ BSLS_IDENT("$Id: $")
 // disabled return immediately and return an error code.  The queue may be
 // restored to normal operation with the 'enablePopFront' method.
 //
+///Wait Strategy
+///-------------
+// By default, the consumer blocked in 'popFront' on an empty queue yields the
+// processor once and then blocks on a condition variable, so each wake-up
+// costs a context switch.  A latency-critical consumer may instead specify a
+// 'bdlcc::WaitStrategy::Enum' at construction to poll the queue before (or
+// instead of) blocking (see 'bdlcc_waitstrategy').  The wait strategy governs
+// only 'popFront'; the producer blocked in 'pushBack' on a full queue, and
+// threads blocked in 'waitUntilEmpty', always block.
+//
 ///Template Requirements
 ///---------------------
 // 'bdlcc::SingleProducerSingleConsumerBoundedQueue' is a template that is
@@ -177,6 +187,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_waitstrategy.h>
+
 #include <bslalg_scalarprimitives.h>
 
 #include <bslma_default.h>
@@ -365,6 +377,9 @@ class SingleProducerSingleConsumerBoundedQueue {
     mutable bslmt::Condition  d_emptyCondition;  // condition variable for
                                                  // 'waitUntilEmpty'
 
+    const WaitStrategy::Enum  d_waitStrategy;    // how the consumer waits in
+                                                 // 'popFront'
+
     bslma::Allocator         *d_allocator_p;     // allocator, held not owned
 
     // FRIENDS
@@ -380,6 +395,10 @@ class SingleProducerSingleConsumerBoundedQueue {
         // stored in 'd_popDisabledGeneration' and 'd_pushDisabledGeneration'.
 
     // PRIVATE MANIPULATORS
+    void init();
+        // Initialize the state of this queue, and allocate its 'd_popCapacity'
+        // nodes.  This method is intended to be used by the constructors.
+
     void popComplete(Node *node, Uint64 index);
         // Destruct the value stored in the specified 'node', use the specified
         // 'index' in calculations to mark the 'node' writable, unblock any
@@ -463,7 +482,18 @@ class SingleProducerSingleConsumerBoundedQueue {
         // Create a thread-aware queue with, at least, the specified
         // 'capacity'.  Optionally specify a 'basicAllocator' used to supply
         // memory.  If 'basicAllocator' is 0, the currently installed default
-        // allocator is used.
+        // allocator is used.  Note that the consumer blocks in 'popFront' as
+        // for 'WaitStrategy::e_BLOCK'.
+
+    SingleProducerSingleConsumerBoundedQueue(
+                                   bsl::size_t         capacity,
+                                   WaitStrategy::Enum  waitStrategy,
+                                   bslma::Allocator   *basicAllocator = 0);
+        // Create a thread-aware queue with, at least, the specified
+        // 'capacity', whose consumer waits in 'popFront' according to the
+        // specified 'waitStrategy'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
 
     ~SingleProducerSingleConsumerBoundedQueue();
         // Destroy this object.
@@ -589,6 +619,10 @@ class SingleProducerSingleConsumerBoundedQueue {
         // thread waiting for the queue to empty will return a non-zero value
         // if 'disablePopFront' is invoked.
 
+    WaitStrategy::Enum waitStrategy() const;
+        // Return the strategy by which the consumer of this queue waits in
+        // 'popFront'.
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -647,6 +681,27 @@ void SingleProducerSingleConsumerBoundedQueue<TYPE>
 }
 
 // PRIVATE MANIPULATORS
+template <class TYPE>
+void SingleProducerSingleConsumerBoundedQueue<TYPE>::init()
+{
+    AtomicOp::initUint64(&d_popIndex,  0);
+    AtomicOp::initUint64(&d_pushIndex, 0);
+
+    AtomicOp::initUint(&d_popDisabledGeneration,  0);
+    AtomicOp::initUint(&d_emptyCount,             0);
+    AtomicOp::initUint(&d_emptyGeneration,        0);
+    AtomicOp::initUint(&d_pushDisabledGeneration, 0);
+
+    d_popElement_p = static_cast<Node *>(
+                        d_allocator_p->allocate(d_popCapacity * sizeof(Node)));
+
+    d_pushElement_p = d_popElement_p;
+
+    for (bsl::size_t i = 0; i < d_popCapacity; ++i) {
+        AtomicOp::initUint(&d_popElement_p[i].d_state, e_WRITABLE);
+    }
+}
+
 template <class TYPE>
 inline
 void SingleProducerSingleConsumerBoundedQueue<TYPE>::popComplete(Node   *node,
@@ -698,7 +753,8 @@ int SingleProducerSingleConsumerBoundedQueue<TYPE>::popFrontImp(TYPE *value,
 
     // If the node is not available for reading:
     //   * if this is a "try" invocation, return
-    //   * otherwise, yield and check again, then block
+    //   * otherwise, poll as specified by the wait strategy, then yield and
+    //     check again, then block
     // Note that 'e_WRITABLE_AND_BLOCKED != nodeState' since this is the one
     // consumer.
 
@@ -707,6 +763,16 @@ int SingleProducerSingleConsumerBoundedQueue<TYPE>::popFrontImp(TYPE *value,
             return e_EMPTY;                                           // RETURN
         }
 
+        int numWaits = 0;
+        while (e_WRITABLE == nodeState
+            && disabledGen ==
+                          AtomicOp::getUintAcquire(&d_popDisabledGeneration)
+            && WaitStrategy::pause(d_waitStrategy, &numWaits)) {
+            nodeState = AtomicOp::getUintAcquire(&node.d_state);
+        }
+    }
+
+    if (e_WRITABLE == nodeState) {
         bslmt::ThreadUtil::yield();
         nodeState = AtomicOp::getUintAcquire(&node.d_state);
         if (e_WRITABLE == nodeState) {
@@ -934,24 +1000,33 @@ SingleProducerSingleConsumerBoundedQueue<TYPE>::
 , d_pushCondition()
 , d_emptyMutex()
 , d_emptyCondition()
+, d_waitStrategy(WaitStrategy::e_BLOCK)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
-    AtomicOp::initUint64(&d_popIndex,  0);
-    AtomicOp::initUint64(&d_pushIndex, 0);
-
-    AtomicOp::initUint(&d_popDisabledGeneration,  0);
-    AtomicOp::initUint(&d_emptyCount,             0);
-    AtomicOp::initUint(&d_emptyGeneration,        0);
-    AtomicOp::initUint(&d_pushDisabledGeneration, 0);
-
-    d_popElement_p = static_cast<Node *>(
-                        d_allocator_p->allocate(d_popCapacity * sizeof(Node)));
-
-    d_pushElement_p = d_popElement_p;
+    init();
+}
 
-    for (bsl::size_t i = 0; i < d_popCapacity; ++i) {
-        AtomicOp::initUint(&d_popElement_p[i].d_state, e_WRITABLE);
-    }
+template <class TYPE>
+SingleProducerSingleConsumerBoundedQueue<TYPE>::
+     SingleProducerSingleConsumerBoundedQueue(
+                                       bsl::size_t         capacity,
+                                       WaitStrategy::Enum  waitStrategy,
+                                       bslma::Allocator   *basicAllocator)
+: d_popElement_p(0)
+, d_popCapacity(capacity > 0 ? capacity : 1)
+, d_popPad()
+, d_pushCapacity(capacity > 0 ? capacity : 1)
+, d_pushPad()
+, d_popMutex()
+, d_popCondition()
+, d_pushMutex()
+, d_pushCondition()
+, d_emptyMutex()
+, d_emptyCondition()
+, d_waitStrategy(waitStrategy)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init();
 }
 
 template <class TYPE>
@@ -1191,6 +1266,14 @@ int SingleProducerSingleConsumerBoundedQueue<TYPE>::waitUntilEmpty() const
     return e_SUCCESS;
 }
 
+template <class TYPE>
+inline
+WaitStrategy::Enum
+SingleProducerSingleConsumerBoundedQueue<TYPE>::waitStrategy() const
+{
+    return d_waitStrategy;
+}
+
                                   // Aspects
 
 template <class TYPE>
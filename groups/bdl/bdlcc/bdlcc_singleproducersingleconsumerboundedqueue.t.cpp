@@ -27,11 +27,13 @@
 #include <bsls_atomicoperations.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 #include <bsltf_moveonlyalloctesttype.h>
 #include <bsltf_movablealloctesttype.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
@@ -81,6 +83,7 @@ using namespace bsl;
 //: o ACCESSOR methods are 'const' thread-safe.
 // ----------------------------------------------------------------------------
 // [ 2] SingleProducerSingleConsumerBoundedQueue(capacity, bA = 0);
+// [12] SingleProducerSingleConsumerBoundedQueue(capacity, strategy, bA);
 // [ 2] ~SingleProducerSingleConsumerBoundedQueue();
 // [ 2] int popFront(TYPE *value);
 // [ 2] int pushBack(const TYPE& value);
@@ -99,10 +102,12 @@ using namespace bsl;
 // [ 5] bool isPushBackDisabled() const;
 // [ 4] bsl::size_t numElements() const;
 // [ 8] int waitUntilEmpty() const;
+// [12] WaitStrategy::Enum waitStrategy() const;
 // [ 4] bslma::Allocator *allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
+// [-1] PERFORMANCE: wake-up latency of each wait strategy
 // [ 3] Obj& gg(Obj *object, const char *spec);
 // [ 3] int ggg(Obj *object, const char *spec);
 // [ 2] CONCERN: 0 == e_SUCCESS
@@ -759,6 +764,81 @@ void orderingGuaranteeTest(const int numPushThread, const int numPopThread)
 //
 // <ELEMENT> ::= 'a' | 'b' | 'c' | 'd' | 'e'
 
+enum { k_NUM_WAIT_VALUES = 2000 };
+
+extern "C" void *waitStrategyPush(void *arg)
+    // Push the values from 0 to 'k_NUM_WAIT_VALUES - 1' onto the 'Obj'
+    // addressed by the specified 'arg', periodically sleeping so that the
+    // consumer exhausts any spinning of its wait strategy.
+{
+    Obj& mX = *static_cast<Obj *>(arg);
+
+    for (int i = 0; i < k_NUM_WAIT_VALUES; ++i) {
+        if (0 == i % 500) {
+            bslmt::ThreadUtil::microSleep(10000);
+        }
+        mX.pushBack(i);
+    }
+
+    return 0;
+}
+
+void latencyEcho(Obj *ping, Obj *pong)
+    // Pop values from the specified 'ping' queue and push them onto the
+    // specified 'pong' queue until a negative value is popped.
+{
+    int value = 0;
+
+    while (0 <= value) {
+        ping->popFront(&value);
+        pong->pushBack(value);
+    }
+}
+
+void latencyTest(bdlcc::WaitStrategy::Enum strategy, int numRoundTrips)
+    // Measure the specified 'numRoundTrips' round trips of a value between
+    // this thread and an echoing thread through queues waiting according to
+    // the specified 'strategy', and print the median and the 99th percentile
+    // of the round-trip times.
+{
+    Obj ping(16, strategy);
+    Obj pong(16, strategy);
+
+    bsl::vector<bsls::Types::Int64> samples;
+    samples.reserve(numRoundTrips);
+
+    bslmt::ThreadGroup echoThread;
+    echoThread.addThread(bdlf::BindUtil::bind(&latencyEcho, &ping, &pong));
+
+    for (int i = 0; i < numRoundTrips; ++i) {
+        // Let the echoing thread settle into its wait, as an idle consumer
+        // would.
+
+        bslmt::ThreadUtil::microSleep(100);
+
+        int value;
+
+        const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+        ping.pushBack(i);
+        pong.popFront(&value);
+
+        samples.push_back(bsls::TimeUtil::getTimer() - start);
+
+        ASSERT(i == value);
+    }
+
+    ping.pushBack(-1);
+    echoThread.joinAll();
+
+    bsl::sort(samples.begin(), samples.end());
+
+    cout << bdlcc::WaitStrategy::toAscii(strategy)
+         << ": p50 = " << samples[samples.size() / 2]
+         << "ns, p99 = " << samples[samples.size() * 99 / 100]
+         << "ns" << endl;
+}
+
 int getValue(int *value, char specChar, int verboseFlag);
     // Place into the specified 'value' the value corresponding to the
     // specified 'specChar' and display errors to 'cerr' if the specified
@@ -954,7 +1034,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -992,6 +1072,101 @@ int main(int argc, char *argv[])
 
         bslmt::ThreadUtil::join(watchdogHandle);
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING WAIT STRATEGIES
+        //
+        // Concerns:
+        //: 1 The queue reports the wait strategy supplied at construction,
+        //:   and 'e_BLOCK' by default.
+        //:
+        //: 2 For every wait strategy, 'popFront' returns every value pushed,
+        //:   in order, whether or not it had to wait.
+        //:
+        //: 3 For every wait strategy, a consumer waiting in 'popFront'
+        //:   returns 'e_DISABLED' when 'disablePopFront' is invoked.
+        //:
+        //: 4 Memory is supplied by the object allocator only.
+        //
+        // Plan:
+        //: 1 For each wait strategy, create a queue with a small capacity,
+        //:   verify 'waitStrategy', and pop the values pushed by a thread
+        //:   that periodically sleeps.  (C-1..2, 4)
+        //:
+        //: 2 For each wait strategy, invoke 'popFront' on an empty queue
+        //:   while another thread disables dequeueing.  (C-3)
+        //
+        // Testing:
+        //   SingleProducerSingleConsumerBoundedQueue(capacity, strategy, bA);
+        //   WaitStrategy::Enum waitStrategy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING WAIT STRATEGIES" << endl
+                          << "=======================" << endl;
+
+        typedef bdlcc::WaitStrategy WS;
+
+        {
+            Obj mX(4);  const Obj& X = mX;
+
+            ASSERT(WS::e_BLOCK == X.waitStrategy());
+        }
+
+        const WS::Enum STRATEGIES[] = { WS::e_BLOCK,
+                                        WS::e_SPIN,
+                                        WS::e_SPIN_THEN_YIELD,
+                                        WS::e_SPIN_THEN_BLOCK };
+        const int      NUM_STRATEGIES = static_cast<int>(
+                                      sizeof STRATEGIES / sizeof *STRATEGIES);
+
+        for (int ti = 0; ti < NUM_STRATEGIES; ++ti) {
+            const WS::Enum STRATEGY = STRATEGIES[ti];
+
+            if (veryVerbose) { P(WS::toAscii(STRATEGY)) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            bsls::Types::Int64 numDefault = defaultAllocator.numAllocations();
+
+            {
+                Obj mX(4, STRATEGY, &sa);  const Obj& X = mX;
+
+                ASSERTV(ti, STRATEGY == X.waitStrategy());
+                ASSERTV(ti, X.allocator() == &sa);
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::create(&handle, waitStrategyPush, &mX);
+
+                for (int i = 0; i < k_NUM_WAIT_VALUES; ++i) {
+                    int value = -1;
+
+                    ASSERTV(ti, i, e_SUCCESS == mX.popFront(&value));
+                    ASSERTV(ti, i, value, i == value);
+                }
+
+                bslmt::ThreadUtil::join(handle);
+
+                ASSERTV(ti, X.isEmpty());
+            }
+
+            {
+                Obj mX(4, STRATEGY, &sa);
+
+                bslmt::ThreadUtil::Handle handle;
+                bslmt::ThreadUtil::create(&handle,
+                                          deferredDisablePopFront,
+                                          &mX);
+
+                int value;
+                ASSERTV(ti, e_DISABLED == mX.popFront(&value));
+
+                bslmt::ThreadUtil::join(handle);
+            }
+
+            ASSERTV(ti, numDefault == defaultAllocator.numAllocations());
+        }
+      } break;
       case 11: {
         // ---------------------------------------------------------
         // ORDERING GUARANTEE TEST
@@ -2863,6 +3038,38 @@ int main(int argc, char *argv[])
         ASSERT(3 == v);
         ASSERT(0 == X.numElements());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: wake-up latency of each wait strategy
+        //
+        // Concerns:
+        //: 1 The time for a value to reach an idle consumer, and for the
+        //:   consumer's reply to reach the producer, is reported for each
+        //:   wait strategy.
+        //
+        // Plan:
+        //: 1 For each wait strategy, measure the round trips of values
+        //:   between two threads through a pair of queues, letting the
+        //:   consumers become idle before each round trip, and report the
+        //:   median and the 99th percentile of the round-trip times.
+        //:   Optionally specify the number of round trips as the second
+        //:   argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: wake-up latency of each wait strategy
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE: wake-up latency of each wait strategy" << endl
+             << "==================================================" << endl;
+
+        const int numRoundTrips = argc > 2 ? atoi(argv[2]) : 10000;
+
+        latencyTest(bdlcc::WaitStrategy::e_BLOCK,           numRoundTrips);
+        latencyTest(bdlcc::WaitStrategy::e_SPIN,            numRoundTrips);
+        latencyTest(bdlcc::WaitStrategy::e_SPIN_THEN_YIELD, numRoundTrips);
+        latencyTest(bdlcc::WaitStrategy::e_SPIN_THEN_BLOCK, numRoundTrips);
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,789 @@
+// bdlcc_singlewriterskipmap.h                                        -*-C++-*-
+
+#ifndef INCLUDED_BDLCC_SINGLEWRITERSKIPMAP
+#define INCLUDED_BDLCC_SINGLEWRITERSKIPMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered map with lock-free readers and a single writer.
+//
+//@CLASSES:
+//  bdlcc::SingleWriterSkipMap: ordered map, one writer, lock-free readers
+//  bdlcc::SingleWriterSkipMapCursor: forward cursor over a skip map
+//
+//@SEE_ALSO: bdlcc_epochmanager, bdlcc_skiplist
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlcc::SingleWriterSkipMap', implementing an ordered associative container
+// that maps unique keys to values, and that can be read by any number of
+// threads concurrently with its modification by a single *writer* thread.
+// Readers never acquire a lock, and never wait for the writer: lookups
+// ('find', 'lowerBound') and forward iteration (via
+// 'bdlcc::SingleWriterSkipMapCursor') traverse the map using only atomic
+// loads, and the nodes unlinked by the writer are reclaimed using a
+// 'bdlcc::EpochManager' once no reader can still be traversing them.
+//
+// 'bdlcc::SingleWriterSkipMap' is an alternative to 'bdlcc::SkipList' for
+// read-mostly ordered indexes (e.g., of live orders, by price or by
+// identifier) that are maintained by one thread.  'bdlcc::SkipList' serializes
+// all operations, including lookups, on one mutex.
+//
+///Single Writer
+///-------------
+// The manipulators of a skip map ('insert', 'erase', and 'clear') must not be
+// invoked concurrently with each other; if more than one thread modifies a
+// skip map, the writers must be serialized by the user (e.g., with a
+// 'bslmt::Mutex'), which does not affect the readers.
+//
+///Consistency
+///-----------
+// The nodes of a skip map are immutable once published: replacing the value
+// associated with a key replaces its node.  Therefore, a reader always
+// observes a key and value that were inserted together, and every operation
+// of a reader observes, for each key, either the state before or the state
+// after each modification that is concurrent with it.  A cursor iterates over
+// keys in strictly increasing order, and visits every element that is in the
+// map for the whole duration of the iteration; elements inserted or erased
+// during the iteration may or may not be visited.
+//
+// A reader that holds a cursor keeps the nodes that it may reach from being
+// reclaimed (see {'bdlcc_epochmanager'}), so cursors should not be held
+// longer than needed.
+//
+///Thread Safety
+///-------------
+// The accessors of 'bdlcc::SingleWriterSkipMap', and
+// 'bdlcc::SingleWriterSkipMapCursor' objects (each used by a single thread),
+// can be used concurrently with each other and with one thread invoking the
+// manipulators of the skip map.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An Index of Resting Orders
+///- - - - - - - - - - - - - - - - - - -
+// Suppose a matching engine thread maintains the resting sell orders of an
+// instrument, keyed by price, while other threads query the book.
+//
+// First, the engine thread adds orders to the book:
+//..
+//  typedef bdlcc::SingleWriterSkipMap<int, int> Book;  // price -> quantity
+//
+//  Book book;
+//
+//  book.insert(10150, 300);
+//  book.insert(10100, 200);
+//  book.insert(10125, 100);
+//..
+// Then, a querying thread finds the best (lowest) price not below a limit,
+// without ever blocking the engine:
+//..
+//  int price, quantity;
+//  int rc = book.lowerBound(&price, &quantity, 10110);
+//  assert(0     == rc);
+//  assert(10125 == price);
+//  assert(100   == quantity);
+//..
+// Next, the engine updates an order, and removes another:
+//..
+//  book.insert(10125, 50);
+//  book.erase(10100);
+//..
+// Finally, a querying thread walks the book in price order:
+//..
+//  int total = 0;
+//  for (Book::Cursor cursor(&book); cursor.isValid(); cursor.advance()) {
+//      total += cursor.value();
+//  }
+//  assert(350 == total);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_epochmanager.h>
+
+#include <bdlb_random.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_destructorproctor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class KEY, class VALUE, class COMPARATOR>
+class SingleWriterSkipMapCursor;
+
+                      // ===============================
+                      // struct SingleWriterSkipMap_Node
+                      // ===============================
+
+template <class KEY, class VALUE>
+struct SingleWriterSkipMap_Node {
+    // This component-private 'struct' is a node of a 'SingleWriterSkipMap'.
+    // A node is allocated with room for 'd_numLevels' forward links, and its
+    // key and value are not modified after the node is published.
+
+    // TYPES
+    typedef bsls::AtomicPointer<SingleWriterSkipMap_Node> Link;
+
+    // DATA
+    bsls::ObjectBuffer<KEY>   d_key;        // key of the element
+
+    bsls::ObjectBuffer<VALUE> d_value;      // value of the element
+
+    int                       d_numLevels;  // number of elements of 'd_next'
+
+    Link                      d_next[1];    // forward links, the first of
+                                            // 'd_numLevels'
+};
+
+                         // =========================
+                         // class SingleWriterSkipMap
+                         // =========================
+
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class SingleWriterSkipMap {
+    // This class template provides an ordered map from unique keys of the
+    // template parameter type 'KEY' to values of the template parameter type
+    // 'VALUE', ordered by the template parameter type 'COMPARATOR', that is
+    // modified by a single writer and read concurrently, without locking, by
+    // any number of threads.
+
+  public:
+    // TYPES
+    typedef SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR> Cursor;
+
+    enum {
+        e_SUCCESS   = 0,  // the operation found an element
+        e_NOT_FOUND = 1   // no element satisfies the operation
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_MAX_NUM_LEVELS = 32  // number of forward links of the head node
+    };
+
+    // PRIVATE TYPES
+    typedef SingleWriterSkipMap_Node<KEY, VALUE> Node;
+
+    // DATA
+    mutable EpochManager  d_epochManager;  // reclaims the unlinked nodes
+
+    Node                 *d_head_p;        // head sentinel, having
+                                           // 'k_MAX_NUM_LEVELS' links and no
+                                           // key or value (owned)
+
+    bsls::AtomicInt       d_numLevels;     // number of levels of the head in
+                                           // use
+
+    bsls::AtomicInt       d_length;        // number of elements
+
+    int                   d_seed;          // seed of the random number of
+                                           // levels of new nodes (accessed
+                                           // by the writer only)
+
+    COMPARATOR            d_comparator;    // orders the keys
+
+    bslma::Allocator     *d_allocator_p;   // memory allocator (held, not
+                                           // owned)
+
+    // FRIENDS
+    friend class SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>;
+
+    // NOT IMPLEMENTED
+    SingleWriterSkipMap(const SingleWriterSkipMap&);
+    SingleWriterSkipMap& operator=(const SingleWriterSkipMap&);
+
+    // PRIVATE CLASS METHODS
+    static Node *allocateNode(int               numLevels,
+                              bslma::Allocator *allocator);
+        // Return a node, allocated from the specified 'allocator', having
+        // the specified 'numLevels' null forward links, and neither key nor
+        // value.
+
+    static void deleteNode(void *node, void *allocator);
+        // Destroy the key and value of the specified 'node', and return it to
+        // the specified 'allocator'.  This function is the deleter of the
+        // nodes retired to the epoch manager.
+
+    // PRIVATE MANIPULATORS
+    Node *createNode(int numLevels, const KEY& key, const VALUE& value);
+        // Return a new node having the specified 'numLevels' null forward
+        // links, the specified 'key', and the specified 'value'.
+
+    Node *findPredecessors(Node **predecessors, const KEY& key);
+        // Load into the specified 'predecessors' array, for each level in use,
+        // the last node whose key is less than the specified 'key' (or the
+        // head node), and return the node following the predecessor at level
+        // 0.  This method must be called by the writer.
+
+    int randomNumLevels();
+        // Return a random number of levels for a new node.  This method must
+        // be called by the writer.
+
+    // PRIVATE ACCESSORS
+    const Node *findLowerBound(const KEY& key) const;
+        // Return the first node whose key is not less than the specified
+        // 'key', or 0 if there is no such node.  The behavior is undefined
+        // unless the calling thread is within 'd_epochManager'.
+
+    bool isLess(const Node *node, const KEY& key) const;
+        // Return 'true' if the key of the specified 'node' is less than the
+        // specified 'key', and 'false' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SingleWriterSkipMap,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit SingleWriterSkipMap(bslma::Allocator *basicAllocator = 0);
+    explicit SingleWriterSkipMap(const COMPARATOR&  comparator,
+                                 bslma::Allocator  *basicAllocator = 0);
+        // Create an empty skip map.  Optionally specify a 'comparator' used to
+        // order the keys; if 'comparator' is not specified, a
+        // default-constructed 'COMPARATOR' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    ~SingleWriterSkipMap();
+        // Destroy this object.  The behavior is undefined unless no other
+        // thread is accessing this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all elements from this skip map.  This method must be called
+        // by the writer.
+
+    bsl::size_t erase(const KEY& key);
+        // Remove the element having the specified 'key' from this skip map,
+        // if any.  Return the number of elements removed (0 or 1).  This
+        // method must be called by the writer.
+
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+        // Insert into this skip map an element having the specified 'key' and
+        // 'value' if 'key' is not already in this skip map, and otherwise
+        // replace the value associated with 'key' by 'value'.  Return the
+        // number of elements inserted (0 or 1).  This method must be called
+        // by the writer.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this skip map to supply memory.
+
+    int find(VALUE *value, const KEY& key) const;
+        // Load into the specified 'value' the value associated with the
+        // specified 'key' in this skip map.  Return 'e_SUCCESS' if 'key' was
+        // found, and 'e_NOT_FOUND' (with no effect on 'value') otherwise.
+
+    bool isEmpty() const;
+        // Return 'true' if this skip map has no elements, and 'false'
+        // otherwise.
+
+    bsl::size_t length() const;
+        // Return a snapshot of the number of elements in this skip map.
+
+    int lowerBound(KEY *key, VALUE *value, const KEY& bound) const;
+        // Load into the specified 'key' and 'value' the first element of this
+        // skip map whose key is not less than the specified 'bound'.  Return
+        // 'e_SUCCESS' if there is such an element, and 'e_NOT_FOUND' (with no
+        // effect on 'key' and 'value') otherwise.
+};
+
+                      // ===============================
+                      // class SingleWriterSkipMapCursor
+                      // ===============================
+
+template <class KEY, class VALUE, class COMPARATOR = bsl::less<KEY> >
+class SingleWriterSkipMapCursor {
+    // This class template provides a forward cursor over the elements of a
+    // 'SingleWriterSkipMap'.  A cursor keeps the elements it refers to from
+    // being reclaimed for its lifetime, and must be used by one thread only.
+
+    // PRIVATE TYPES
+    typedef SingleWriterSkipMap<KEY, VALUE, COMPARATOR> Map;
+    typedef SingleWriterSkipMap_Node<KEY, VALUE>        Node;
+
+    // DATA
+    const Map   *d_map_p;   // map over which to iterate (held)
+
+    EpochGuard   d_guard;   // keeps the traversed nodes from being reclaimed
+
+    const Node  *d_node_p;  // current element, or 0 if invalid
+
+    // NOT IMPLEMENTED
+    SingleWriterSkipMapCursor(const SingleWriterSkipMapCursor&);
+    SingleWriterSkipMapCursor& operator=(const SingleWriterSkipMapCursor&);
+
+  public:
+    // CREATORS
+    explicit SingleWriterSkipMapCursor(const Map *map);
+        // Create a cursor referring to the first element of the specified
+        // 'map', or an invalid cursor if 'map' is empty.
+
+    //! ~SingleWriterSkipMapCursor() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void advance();
+        // Make this cursor refer to the element following its current element
+        // in its map, or make it invalid if there is no such element.  The
+        // behavior is undefined unless this cursor is valid.
+
+    void first();
+        // Make this cursor refer to the first element of its map, or make it
+        // invalid if its map is empty.
+
+    void lowerBound(const KEY& key);
+        // Make this cursor refer to the first element of its map whose key is
+        // not less than the specified 'key', or make it invalid if there is
+        // no such element.
+
+    // ACCESSORS
+    bool isValid() const;
+        // Return 'true' if this cursor refers to an element, and 'false'
+        // otherwise.
+
+    const KEY& key() const;
+        // Return a reference providing non-modifiable access to the key of
+        // the element referred to by this cursor.  The behavior is undefined
+        // unless this cursor is valid.
+
+    const VALUE& value() const;
+        // Return a reference providing non-modifiable access to the value of
+        // the element referred to by this cursor.  The behavior is undefined
+        // unless this cursor is valid.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class SingleWriterSkipMap
+                         // -------------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class COMPARATOR>
+typename SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::Node *
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::allocateNode(
+                                                  int               numLevels,
+                                                  bslma::Allocator *allocator)
+{
+    BSLS_ASSERT(1 <= numLevels);
+    BSLS_ASSERT(numLevels <= k_MAX_NUM_LEVELS);
+
+    typedef typename Node::Link Link;
+
+    Node *node = static_cast<Node *>(allocator->allocate(
+                              sizeof(Node) + (numLevels - 1) * sizeof(Link)));
+
+    node->d_numLevels = numLevels;
+    for (int i = 0; i < numLevels; ++i) {
+        ::new (&node->d_next[i]) Link(0);
+    }
+    return node;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+void SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::deleteNode(void *node,
+                                                             void *allocator)
+{
+    Node *n = static_cast<Node *>(node);
+
+    n->d_value.object().~VALUE();
+    n->d_key.object().~KEY();
+    static_cast<bslma::Allocator *>(allocator)->deallocate(n);
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+typename SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::Node *
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::createNode(int          numLevels,
+                                                        const KEY&   key,
+                                                        const VALUE& value)
+{
+    Node *node = allocateNode(numLevels, d_allocator_p);
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(node, d_allocator_p);
+
+    bslalg::ScalarPrimitives::copyConstruct(node->d_key.address(),
+                                            key,
+                                            d_allocator_p);
+    bslma::DestructorProctor<KEY> keyProctor(node->d_key.address());
+
+    bslalg::ScalarPrimitives::copyConstruct(node->d_value.address(),
+                                            value,
+                                            d_allocator_p);
+    keyProctor.release();
+    proctor.release();
+
+    return node;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+typename SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::Node *
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::findPredecessors(
+                                                    Node       **predecessors,
+                                                    const KEY&   key)
+{
+    // The writer is the only thread modifying the links, so relaxed loads
+    // suffice.
+
+    Node *node = d_head_p;
+    for (int level = d_numLevels.loadRelaxed() - 1; 0 <= level; --level) {
+        Node *next = node->d_next[level].loadRelaxed();
+        while (next && isLess(next, key)) {
+            node = next;
+            next = node->d_next[level].loadRelaxed();
+        }
+        predecessors[level] = node;
+    }
+    return predecessors[0]->d_next[0].loadRelaxed();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+int SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::randomNumLevels()
+{
+    // Each additional level is chosen with probability 1/4.
+
+    int numLevels = 1;
+    while (numLevels < k_MAX_NUM_LEVELS
+        && 0 == (bdlb::Random::generate15(&d_seed) & 3)) {
+        ++numLevels;
+    }
+    return numLevels;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+const typename SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::Node *
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::findLowerBound(
+                                                          const KEY& key) const
+{
+    const Node *node = d_head_p;
+    const Node *next = 0;
+    for (int level = d_numLevels.loadAcquire() - 1; 0 <= level; --level) {
+        next = node->d_next[level].loadAcquire();
+        while (next && isLess(next, key)) {
+            node = next;
+            next = node->d_next[level].loadAcquire();
+        }
+    }
+    return next;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::isLess(
+                                                   const Node *node,
+                                                   const KEY&  key) const
+{
+    return d_comparator(node->d_key.object(), key);
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::SingleWriterSkipMap(
+                                              bslma::Allocator *basicAllocator)
+: d_epochManager(basicAllocator)
+, d_head_p(0)
+, d_numLevels(1)
+, d_length(0)
+, d_seed(1)
+, d_comparator()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_head_p = allocateNode(k_MAX_NUM_LEVELS, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::SingleWriterSkipMap(
+                                           const COMPARATOR&  comparator,
+                                           bslma::Allocator  *basicAllocator)
+: d_epochManager(basicAllocator)
+, d_head_p(0)
+, d_numLevels(1)
+, d_length(0)
+, d_seed(1)
+, d_comparator(comparator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_head_p = allocateNode(k_MAX_NUM_LEVELS, d_allocator_p);
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::~SingleWriterSkipMap()
+{
+    Node *node = d_head_p->d_next[0].loadRelaxed();
+    while (node) {
+        Node *next = node->d_next[0].loadRelaxed();
+        deleteNode(node, d_allocator_p);
+        node = next;
+    }
+    d_allocator_p->deallocate(d_head_p);
+
+    // The nodes retired but not yet reclaimed are destroyed by the destructor
+    // of 'd_epochManager'.
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+void SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::clear()
+{
+    Node *node = d_head_p->d_next[0].loadRelaxed();
+
+    for (int level = 0; level < k_MAX_NUM_LEVELS; ++level) {
+        d_head_p->d_next[level].storeRelease(0);
+    }
+    d_length = 0;
+
+    while (node) {
+        Node *next = node->d_next[0].loadRelaxed();
+        d_epochManager.retire(node, &deleteNode, d_allocator_p);
+        node = next;
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::size_t SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::erase(const KEY& key)
+{
+    Node *predecessors[k_MAX_NUM_LEVELS];
+
+    Node *node = findPredecessors(predecessors, key);
+    if (!node || d_comparator(key, node->d_key.object())) {
+        return 0;                                                     // RETURN
+    }
+
+    // Unlink from the top level down, leaving the links of 'node' intact so
+    // that readers positioned on it can proceed.
+
+    for (int level = node->d_numLevels - 1; 0 <= level; --level) {
+        predecessors[level]->d_next[level].storeRelease(
+                                       node->d_next[level].loadRelaxed());
+    }
+    d_length.addRelaxed(-1);
+
+    d_epochManager.retire(node, &deleteNode, d_allocator_p);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+bsl::size_t SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::insert(
+                                                            const KEY&   key,
+                                                            const VALUE& value)
+{
+    Node *predecessors[k_MAX_NUM_LEVELS];
+
+    Node *node = findPredecessors(predecessors, key);
+    if (node && !d_comparator(key, node->d_key.object())) {
+        // Replace 'node' by a copy having the new value, linked to the same
+        // successors, so that readers never observe a partially assigned
+        // value.
+
+        const int  numLevels   = node->d_numLevels;
+        Node      *replacement = createNode(numLevels, key, value);
+
+        for (int level = 0; level < numLevels; ++level) {
+            replacement->d_next[level].storeRelaxed(
+                                       node->d_next[level].loadRelaxed());
+        }
+        for (int level = 0; level < numLevels; ++level) {
+            predecessors[level]->d_next[level].storeRelease(replacement);
+        }
+
+        d_epochManager.retire(node, &deleteNode, d_allocator_p);
+        return 0;                                                     // RETURN
+    }
+
+    const int numLevels = randomNumLevels();
+    Node      *newNode  = createNode(numLevels, key, value);
+
+    const int numLevelsInUse = d_numLevels.loadRelaxed();
+    for (int level = numLevelsInUse; level < numLevels; ++level) {
+        predecessors[level] = d_head_p;
+    }
+
+    for (int level = 0; level < numLevels; ++level) {
+        newNode->d_next[level].storeRelaxed(
+                          predecessors[level]->d_next[level].loadRelaxed());
+    }
+
+    // Publish from the bottom level up, so that a reader finding 'newNode'
+    // at some level also finds it at every level below.
+
+    for (int level = 0; level < numLevels; ++level) {
+        predecessors[level]->d_next[level].storeRelease(newNode);
+    }
+    if (numLevels > numLevelsInUse) {
+        d_numLevels.storeRelease(numLevels);
+    }
+    d_length.addRelaxed(1);
+
+    return 1;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bslma::Allocator *
+SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+int SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::find(VALUE      *value,
+                                                      const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    EpochGuard guard(&d_epochManager);
+
+    const Node *node = findLowerBound(key);
+    if (!node || d_comparator(key, node->d_key.object())) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *value = node->d_value.object();
+    return e_SUCCESS;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::isEmpty() const
+{
+    return 0 == d_head_p->d_next[0].loadAcquire();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bsl::size_t SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::length() const
+{
+    return d_length.loadRelaxed();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+int SingleWriterSkipMap<KEY, VALUE, COMPARATOR>::lowerBound(
+                                                   KEY        *key,
+                                                   VALUE      *value,
+                                                   const KEY&  bound) const
+{
+    BSLS_ASSERT(key);
+    BSLS_ASSERT(value);
+
+    EpochGuard guard(&d_epochManager);
+
+    const Node *node = findLowerBound(bound);
+    if (!node) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    *key   = node->d_key.object();
+    *value = node->d_value.object();
+    return e_SUCCESS;
+}
+
+                      // -------------------------------
+                      // class SingleWriterSkipMapCursor
+                      // -------------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::SingleWriterSkipMapCursor(
+                                                                const Map *map)
+: d_map_p(map)
+, d_guard(&map->d_epochManager)
+, d_node_p(map->d_head_p->d_next[0].loadAcquire())
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::advance()
+{
+    BSLS_ASSERT(d_node_p);
+
+    d_node_p = d_node_p->d_next[0].loadAcquire();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::first()
+{
+    d_node_p = d_map_p->d_head_p->d_next[0].loadAcquire();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+void SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::lowerBound(
+                                                                const KEY& key)
+{
+    d_node_p = d_map_p->findLowerBound(key);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+bool SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::isValid() const
+{
+    return 0 != d_node_p;
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const KEY& SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::key() const
+{
+    BSLS_ASSERT(d_node_p);
+
+    return d_node_p->d_key.object();
+}
+
+template <class KEY, class VALUE, class COMPARATOR>
+inline
+const VALUE& SingleWriterSkipMapCursor<KEY, VALUE, COMPARATOR>::value() const
+{
+    BSLS_ASSERT(d_node_p);
+
+    return d_node_p->d_value.object();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
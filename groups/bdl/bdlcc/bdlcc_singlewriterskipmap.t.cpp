@@ -0,0 +1,713 @@
+// bdlcc_singlewriterskipmap.t.cpp                                    -*-C++-*-
+
+#include <bdlcc_singlewriterskipmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an ordered map modified by a single writer and
+// read, without locking, by any number of threads.  We first verify the basic
+// manipulators and accessors on a few elements.  We then verify, against
+// 'bsl::map', the result of long random sequences of insertions, updates, and
+// erasures, including iteration with cursors, and that elements having an
+// allocator use the allocator of the map.  Finally, we verify that readers
+// observe consistent elements, in order, while the writer modifies the map.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] SingleWriterSkipMap(bslma::Allocator *basicAllocator = 0);
+// [ 2] SingleWriterSkipMap(const COMPARATOR&, bslma::Allocator * = 0);
+// [ 1] ~SingleWriterSkipMap();
+//
+// MANIPULATORS
+// [ 2] void clear();
+// [ 1] bsl::size_t erase(const KEY& key);
+// [ 1] bsl::size_t insert(const KEY& key, const VALUE& value);
+//
+// ACCESSORS
+// [ 1] bslma::Allocator *allocator() const;
+// [ 1] int find(VALUE *value, const KEY& key) const;
+// [ 1] bool isEmpty() const;
+// [ 1] bsl::size_t length() const;
+// [ 1] int lowerBound(KEY *key, VALUE *value, const KEY& bound) const;
+//
+// 'SingleWriterSkipMapCursor'
+// [ 1] SingleWriterSkipMapCursor(const Map *map);
+// [ 2] void advance();
+// [ 2] void first();
+// [ 2] void lowerBound(const KEY& key);
+// [ 1] bool isValid() const;
+// [ 1] const KEY& key() const;
+// [ 1] const VALUE& value() const;
+// ----------------------------------------------------------------------------
+// [ 3] CONCURRENCY TEST
+// [ 4] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Uint64                  Uint64;
+
+typedef bdlcc::SingleWriterSkipMap<int, int> Obj;
+typedef Obj::Cursor                          Cursor;
+
+typedef bdlcc::SingleWriterSkipMap<bsl::string, bsl::string> StringObj;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of a pseudo-random sequence whose state is the
+    // specified 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state >> 11;
+}
+
+template <class MAP, class MODEL>
+bool isEqual(const MAP& map, const MODEL& model)
+    // Return 'true' if iterating over the specified 'map' with a cursor
+    // yields the elements of the specified 'model', in order, and 'false'
+    // otherwise.
+{
+    typename MAP::Cursor           cursor(&map);
+    typename MODEL::const_iterator it = model.begin();
+
+    for (; cursor.isValid() && it != model.end(); cursor.advance(), ++it) {
+        if (cursor.key() != it->first || cursor.value() != it->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return !cursor.isValid() && it == model.end()
+        && map.length() == model.size();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          CASE 3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace SINGLEWRITERSKIPMAP_CASE_3 {
+
+enum {
+    k_NUM_READERS    = 4,
+    k_NUM_KEYS       = 1000,
+    k_NUM_OPERATIONS = 100000,
+    k_SCALE          = 1000000  // values are 'key * k_SCALE + generation'
+};
+
+bsls::AtomicBool s_done(false);
+bsls::AtomicInt  s_numErrors(0);
+
+void reader(const Obj *map, bslmt::Barrier *barrier, int id)
+    // Repeatedly look up and iterate over the specified 'map', after waiting
+    // on the specified 'barrier', until 's_done' is set, incrementing
+    // 's_numErrors' for each inconsistency observed.  Use the specified 'id'
+    // to seed the keys looked up.  Every even key is always in 'map', and
+    // every value is 'key * k_SCALE + generation'.
+{
+    Uint64 state = id;
+
+    barrier->wait();
+
+    while (!s_done) {
+        const int key = static_cast<int>(nextRandom(&state) % k_NUM_KEYS);
+
+        int value;
+        int rc = map->find(&value, key);
+        if (0 == rc ? value / k_SCALE != key : 0 == key % 2) {
+            ++s_numErrors;
+        }
+
+        int foundKey;
+        rc = map->lowerBound(&foundKey, &value, key);
+        if (0 == rc
+          ? foundKey < key || foundKey > key + 1 || value / k_SCALE != foundKey
+          : key < k_NUM_KEYS - 1) {
+            ++s_numErrors;
+        }
+
+        // Every even key not less than 'key' must be visited, in order.
+
+        int expected = key + key % 2;
+        int previous = -1;
+        int count    = 0;
+        for (Cursor cursor(map); cursor.isValid() && count < 50;
+                                                            cursor.advance()) {
+            const int k = cursor.key();
+            if (k <= previous || cursor.value() / k_SCALE != k) {
+                ++s_numErrors;
+            }
+            previous = k;
+            ++count;
+        }
+
+        Cursor cursor(map);
+        cursor.lowerBound(key);
+        for (count = 0; cursor.isValid() && count < 20; cursor.advance()) {
+            const int k = cursor.key();
+            if (0 == k % 2) {
+                if (k != expected) {
+                    ++s_numErrors;
+                }
+                expected = k + 2;
+                ++count;
+            }
+        }
+    }
+}
+
+}  // close namespace SINGLEWRITERSKIPMAP_CASE_3
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: An Index of Resting Orders
+///- - - - - - - - - - - - - - - - - - -
+// Suppose a matching engine thread maintains the resting sell orders of an
+// instrument, keyed by price, while other threads query the book.
+//
+// First, the engine thread adds orders to the book:
+//..
+    typedef bdlcc::SingleWriterSkipMap<int, int> Book;  // price -> quantity
+
+    Book book;
+
+    book.insert(10150, 300);
+    book.insert(10100, 200);
+    book.insert(10125, 100);
+//..
+// Then, a querying thread finds the best (lowest) price not below a limit,
+// without ever blocking the engine:
+//..
+    int price, quantity;
+    int rc = book.lowerBound(&price, &quantity, 10110);
+    ASSERT(0     == rc);
+    ASSERT(10125 == price);
+    ASSERT(100   == quantity);
+//..
+// Next, the engine updates an order, and removes another:
+//..
+    book.insert(10125, 50);
+    book.erase(10100);
+//..
+// Finally, a querying thread walks the book in price order:
+//..
+    int total = 0;
+    for (Book::Cursor cursor(&book); cursor.isValid(); cursor.advance()) {
+        total += cursor.value();
+    }
+    ASSERT(350 == total);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Readers observe only keys and values that were inserted together.
+        //:
+        //: 2 Cursors visit keys in strictly increasing order, and visit every
+        //:   key that is in the map for the whole iteration.
+        //:
+        //: 3 'find' and 'lowerBound' find every key that is in the map for
+        //:   the whole operation.
+        //:
+        //: 4 No node is accessed after it is reclaimed, and every node is
+        //:   eventually reclaimed.
+        //
+        // Plan:
+        //: 1 Populate a map with the even keys, and have a writer thread
+        //:   repeatedly update the even keys, and insert and erase the odd
+        //:   keys, while several reader threads look up and iterate over the
+        //:   map, checking that each value encodes its key, that iteration is
+        //:   ordered, and that no even key is missing.  (C-1..3)
+        //:
+        //: 2 Verify that all memory is returned to the allocator when the map
+        //:   is destroyed (and, when built with a sanitizer, that no freed
+        //:   memory is accessed).  (C-4)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace SINGLEWRITERSKIPMAP_CASE_3;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int key = 0; key < k_NUM_KEYS; key += 2) {
+                mX.insert(key, key * k_SCALE);
+            }
+
+            bslmt::Barrier     barrier(k_NUM_READERS + 1);
+            bslmt::ThreadGroup threadGroup(&ta);
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bindS(&ta,
+                                                            &reader,
+                                                            &X,
+                                                            &barrier,
+                                                            i + 1));
+            }
+
+            barrier.wait();
+
+            Uint64 state = 0;
+            for (int i = 1; i <= k_NUM_OPERATIONS; ++i) {
+                const int key = static_cast<int>(nextRandom(&state)
+                                                                % k_NUM_KEYS);
+                const int generation = i % k_SCALE;
+
+                if (0 == key % 2 || 0 == i % 3) {
+                    mX.insert(key, key * k_SCALE + generation);
+                }
+                else {
+                    mX.erase(key);
+                }
+            }
+            s_done = true;
+            threadGroup.joinAll();
+
+            ASSERTV(s_numErrors, 0 == s_numErrors);
+            ASSERT(k_NUM_KEYS / 2 <= X.length());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // RANDOM OPERATIONS AGAINST A MODEL
+        //
+        // Concerns:
+        //: 1 After any sequence of insertions, updates, and erasures, the map
+        //:   has the same elements as a 'bsl::map' subjected to the same
+        //:   sequence, and 'insert' and 'erase' return the number of elements
+        //:   inserted and removed.
+        //:
+        //: 2 'find', 'lowerBound', and the methods of the cursor find the same
+        //:   elements as the corresponding operations of 'bsl::map'.
+        //:
+        //: 3 A user-supplied comparator orders the keys.
+        //:
+        //: 4 'clear' removes all elements, and the map remains usable.
+        //:
+        //: 5 Keys and values that use an allocator are supplied the allocator
+        //:   of the map, and no memory is leaked, in particular when values
+        //:   are replaced and elements erased.
+        //
+        // Plan:
+        //: 1 Apply random sequences of operations to a map, ordered by
+        //:   'bsl::less' and by 'bsl::greater', and to a 'bsl::map' having
+        //:   the same comparator, comparing their contents and the results of
+        //:   lookups periodically.  (C-1..3)
+        //:
+        //: 2 Clear the map, verify it is empty, and insert more elements.
+        //:   (C-4)
+        //:
+        //: 3 Using a map of strings too long for the short-string buffer,
+        //:   verify that no memory comes from the default allocator, and that
+        //:   all memory is returned on destruction.  (C-5)
+        //
+        // Testing:
+        //   SingleWriterSkipMap(const COMPARATOR&, bslma::Allocator * = 0);
+        //   void clear();
+        //   void advance();
+        //   void first();
+        //   void lowerBound(const KEY& key);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANDOM OPERATIONS AGAINST A MODEL" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tAscending keys." << endl;
+        {
+            Obj                mX(&ta);  const Obj& X = mX;
+            bsl::map<int, int> model(&ta);
+
+            Uint64 state = 7;
+            for (int i = 0; i < 20000; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 500);
+
+                if (nextRandom(&state) % 3) {
+                    const bsl::size_t inserted = model.count(key) ? 0 : 1;
+                    model[key] = i;
+                    ASSERTV(i, inserted == mX.insert(key, i));
+                }
+                else {
+                    ASSERTV(i, model.erase(key) == mX.erase(key));
+                }
+
+                if (0 == i % 1000) {
+                    ASSERTV(i, isEqual(X, model));
+                }
+
+                const int probe = static_cast<int>(nextRandom(&state) % 510);
+
+                int value = -1;
+                bsl::map<int, int>::const_iterator it = model.find(probe);
+                if (it == model.end()) {
+                    ASSERTV(i, Obj::e_NOT_FOUND == X.find(&value, probe));
+                    ASSERTV(i, -1 == value);
+                }
+                else {
+                    ASSERTV(i, Obj::e_SUCCESS == X.find(&value, probe));
+                    ASSERTV(i, it->second == value);
+                }
+
+                int foundKey = -1;
+                int rc;
+                it = model.lower_bound(probe);
+                Cursor cursor(&X);
+                cursor.lowerBound(probe);
+                if (it == model.end()) {
+                    rc = X.lowerBound(&foundKey, &value, probe);
+                    ASSERTV(i, Obj::e_NOT_FOUND == rc);
+                    ASSERTV(i, !cursor.isValid());
+                }
+                else {
+                    rc = X.lowerBound(&foundKey, &value, probe);
+                    ASSERTV(i, Obj::e_SUCCESS == rc);
+                    ASSERTV(i, it->first  == foundKey);
+                    ASSERTV(i, it->second == value);
+                    ASSERTV(i, cursor.isValid());
+                    ASSERTV(i, it->first  == cursor.key());
+                    ASSERTV(i, it->second == cursor.value());
+                }
+
+                cursor.first();
+                ASSERTV(i, model.empty() == !cursor.isValid());
+                ASSERTV(i, model.empty() == X.isEmpty());
+            }
+            ASSERT(isEqual(X, model));
+
+            mX.clear();
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.length());
+            ASSERT(!Cursor(&X).isValid());
+
+            model.clear();
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i * 7 % 100, i);
+                model[i * 7 % 100] = i;
+            }
+            ASSERT(isEqual(X, model));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tDescending keys." << endl;
+        {
+            typedef bdlcc::SingleWriterSkipMap<int, int, bsl::greater<int> >
+                                                                    GreaterObj;
+
+            GreaterObj mX(bsl::greater<int>(), &ta);  const GreaterObj& X = mX;
+            bsl::map<int, int, bsl::greater<int> > model(&ta);
+
+            Uint64 state = 11;
+            for (int i = 0; i < 5000; ++i) {
+                const int key = static_cast<int>(nextRandom(&state) % 200);
+
+                if (nextRandom(&state) % 2) {
+                    model[key] = i;
+                    mX.insert(key, i);
+                }
+                else {
+                    ASSERTV(i, model.erase(key) == mX.erase(key));
+                }
+            }
+            ASSERT(isEqual(X, model));
+
+            int key, value;
+            if (Obj::e_SUCCESS == X.lowerBound(&key, &value, 100)) {
+                ASSERT(model.lower_bound(100)->first == key);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            const char *const PREFIX = "a string too long for the short-string"
+                                       " buffer: ";
+
+            StringObj mX(&ta);  const StringObj& X = mX;
+            bsl::map<bsl::string, bsl::string> model(&ta);
+
+            for (int i = 0; i < 200; ++i) {
+                bsl::string key(PREFIX, &ta);
+                key.push_back(static_cast<char>('a' + i % 26));
+                key.push_back(static_cast<char>('a' + i % 7));
+                const bsl::string value(key, &ta);
+
+                if (i % 5) {
+                    model[key] = value;
+                    mX.insert(key, value);
+                }
+                else {
+                    ASSERTV(i, model.erase(key) == mX.erase(key));
+                }
+            }
+            ASSERT(isEqual(X, model));
+            ASSERTV(defaultAllocator.numBlocksTotal(),
+                    0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 Elements can be inserted, updated, found, and erased, and the
+        //:   length of the map reflects its elements.
+        //:
+        //: 2 A cursor iterates over the elements in key order.
+        //:
+        //: 3 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Perform a few operations, verifying the state of the map after
+        //:   each.  (C-1..3)
+        //
+        // Testing:
+        //   SingleWriterSkipMap(bslma::Allocator *basicAllocator = 0);
+        //   ~SingleWriterSkipMap();
+        //   bsl::size_t erase(const KEY& key);
+        //   bsl::size_t insert(const KEY& key, const VALUE& value);
+        //   bslma::Allocator *allocator() const;
+        //   int find(VALUE *value, const KEY& key) const;
+        //   bool isEmpty() const;
+        //   bsl::size_t length() const;
+        //   int lowerBound(KEY *key, VALUE *value, const KEY& bound) const;
+        //   SingleWriterSkipMapCursor(const Map *map);
+        //   bool isValid() const;
+        //   const KEY& key() const;
+        //   const VALUE& value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(X.isEmpty());
+            ASSERT(0 == X.length());
+            ASSERT(!Cursor(&X).isValid());
+
+            int key, value;
+            ASSERT(Obj::e_NOT_FOUND == X.find(&value, 1));
+            ASSERT(Obj::e_NOT_FOUND == X.lowerBound(&key, &value, 1));
+
+            ASSERT(1 == mX.insert(20, 200));
+            ASSERT(1 == mX.insert(10, 100));
+            ASSERT(1 == mX.insert(30, 300));
+            ASSERT(!X.isEmpty());
+            ASSERT(3 == X.length());
+
+            ASSERT(Obj::e_SUCCESS == X.find(&value, 10));
+            ASSERT(100 == value);
+            ASSERT(Obj::e_NOT_FOUND == X.find(&value, 15));
+
+            ASSERT(Obj::e_SUCCESS == X.lowerBound(&key, &value, 15));
+            ASSERT(20 == key);
+            ASSERT(200 == value);
+            ASSERT(Obj::e_NOT_FOUND == X.lowerBound(&key, &value, 31));
+
+            ASSERT(0 == mX.insert(20, 201));
+            ASSERT(3 == X.length());
+            ASSERT(Obj::e_SUCCESS == X.find(&value, 20));
+            ASSERT(201 == value);
+
+            {
+                const int EXP_KEYS[]   = { 10, 20, 30 };
+                const int EXP_VALUES[] = { 100, 201, 300 };
+
+                int i = 0;
+                for (Cursor cursor(&X); cursor.isValid(); cursor.advance()) {
+                    ASSERTV(i, i < 3);
+                    ASSERTV(i, EXP_KEYS[i]   == cursor.key());
+                    ASSERTV(i, EXP_VALUES[i] == cursor.value());
+                    ++i;
+                }
+                ASSERTV(i, 3 == i);
+            }
+
+            ASSERT(1 == mX.erase(20));
+            ASSERT(0 == mX.erase(20));
+            ASSERT(2 == X.length());
+            ASSERT(Obj::e_NOT_FOUND == X.find(&value, 20));
+
+            ASSERT(1 == mX.erase(10));
+            ASSERT(1 == mX.erase(30));
+            ASSERT(X.isEmpty());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
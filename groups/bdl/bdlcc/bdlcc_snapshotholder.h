@@ -0,0 +1,691 @@
+// bdlcc_snapshotholder.h                                             -*-C++-*-
+
+#ifndef INCLUDED_BDLCC_SNAPSHOTHOLDER
+#define INCLUDED_BDLCC_SNAPSHOTHOLDER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a holder of immutable snapshots read without locking.
+//
+//@CLASSES:
+//  bdlcc::SnapshotHolder: holder of the current snapshot of a value
+//  bdlcc::SnapshotHolderGuard: guard giving access to the current snapshot
+//
+//@SEE_ALSO: bdlcc_epochmanager
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlcc::SnapshotHolder', that holds a value of the template parameter type
+// 'TYPE' that is read very frequently, by many threads, and replaced rarely
+// (e.g., a routing table, or the reference data of instruments).  The value
+// is published as a sequence of immutable *snapshots*: a writer replaces the
+// current snapshot with a new one (read-copy-update), and the readers of the
+// previous snapshot continue to use it undisturbed.  The memory of a replaced
+// snapshot is reclaimed once no reader can still be using it.
+//
+// Readers access the current snapshot through a 'bdlcc::SnapshotHolderGuard',
+// whose construction is wait-free and does not write to any memory shared
+// with other readers: each reader thread publishes that it is reading in a
+// reference slot of its own (see {'bdlcc_epochmanager'}), so that readers
+// neither contend on a lock nor on a reference count, as they would with a
+// 'bsl::shared_ptr' guarded by a 'bslmt::ReaderWriterLock'.
+//
+///Reclamation of Snapshots
+///------------------------
+// A replaced snapshot is destroyed by a later call to 'setValue',
+// 'modifyValue', or 'reclaim' made after every reader that was using it has
+// released its guard, and at the latest when the snapshot holder is
+// destroyed.  A writer that replaces a value only once in a long while and
+// wants the previous snapshot to be reclaimed promptly can call 'reclaim'
+// periodically (e.g., from a timer).  Guards should not be held longer than
+// needed, since a guard prevents the destruction of every snapshot replaced
+// while it is held.
+//
+///Sharing an Epoch Manager
+///------------------------
+// By default, each snapshot holder owns the 'bdlcc::EpochManager' that
+// reclaims its snapshots.  An application holding many snapshot holders
+// (e.g., one per instrument) that are read by the same threads may instead
+// supply, at construction, an epoch manager shared by all of them.  A reader
+// thread then uses a single record to access all of the holders (see
+// {'bdlcc_epochmanager'|Cost of Entering and Leaving}), and the snapshots
+// replaced in any holder are reclaimed together.  A shared epoch manager must
+// outlive the snapshot holders using it, and the allocator of each holder
+// must remain valid until the epoch manager has reclaimed (or, at the latest,
+// has been destroyed with) the replaced snapshots of that holder.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::SnapshotHolder' is fully *thread-safe*, meaning that all
+// non-creator operations on an object can be safely invoked simultaneously
+// from multiple threads.  Writers ('setValue', 'modifyValue') are serialized
+// by an internal mutex, which readers never acquire.  A
+// 'bdlcc::SnapshotHolderGuard' object must be used by a single thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Routing Table
+///- - - - - - - - - - - - -
+// Suppose that the threads of a message router look up, for each message,
+// the destination of its topic in a routing table that is occasionally
+// replaced by an administrative thread.
+//
+// First, we define the routing table type and create its holder:
+//..
+//  typedef bsl::map<bsl::string, int> RoutingTable;  // topic -> destination
+//
+//  bdlcc::SnapshotHolder<RoutingTable> routes;
+//..
+// Then, the administrative thread publishes an initial table:
+//..
+//  RoutingTable table;
+//  table["prices"] = 1;
+//  table["trades"] = 2;
+//
+//  routes.setValue(table);
+//  assert(1 == routes.version());
+//..
+// Next, a router thread looks up a destination, holding the snapshot only for
+// the duration of the lookup:
+//..
+//  {
+//      bdlcc::SnapshotHolderGuard<RoutingTable> guard(&routes);
+//
+//      RoutingTable::const_iterator it = guard->find("trades");
+//      assert(guard->end() != it);
+//      assert(2            == it->second);
+//  }
+//..
+// Then, we define a function that adds a route to a table:
+//..
+//  struct AddRoute {
+//      static void add(RoutingTable *table)
+//      {
+//          (*table)["orders"] = 3;
+//      }
+//  };
+//..
+// Finally, the administrative thread adds the route by copying the current
+// snapshot, modifying the copy, and publishing it.  A router thread that
+// pinned the previous snapshot continues to see it, while a new reader sees
+// the new table:
+//..
+//  {
+//      bdlcc::SnapshotHolderGuard<RoutingTable> before(&routes);
+//
+//      routes.modifyValue(&AddRoute::add);
+//      assert(2 == routes.version());
+//
+//      bdlcc::SnapshotHolderGuard<RoutingTable> after(&routes);
+//
+//      assert(2 == before->size());
+//      assert(1 == before.version());
+//      assert(3 == after->size());
+//      assert(2 == after.version());
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_epochmanager.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class TYPE>
+class SnapshotHolderGuard;
+
+                       // =============================
+                       // class SnapshotHolder_Snapshot
+                       // =============================
+
+template <class TYPE>
+class SnapshotHolder_Snapshot {
+    // This component-private class template holds one immutable snapshot of
+    // the value of a 'SnapshotHolder', and its version.
+
+    // DATA
+    bsls::ObjectBuffer<TYPE> d_value;    // value of the snapshot
+
+    bsls::Types::Uint64      d_version;  // version of the snapshot
+
+    // NOT IMPLEMENTED
+    SnapshotHolder_Snapshot(const SnapshotHolder_Snapshot&);
+    SnapshotHolder_Snapshot& operator=(const SnapshotHolder_Snapshot&);
+
+  public:
+    // CREATORS
+    SnapshotHolder_Snapshot(bsls::Types::Uint64  version,
+                            bslma::Allocator    *basicAllocator);
+        // Create a snapshot having the default value of 'TYPE' and the
+        // specified 'version', using the specified 'basicAllocator' to supply
+        // memory to the value.
+
+    SnapshotHolder_Snapshot(const TYPE&          value,
+                            bsls::Types::Uint64  version,
+                            bslma::Allocator    *basicAllocator);
+        // Create a snapshot having the specified 'value' and 'version', using
+        // the specified 'basicAllocator' to supply memory to the value.
+
+    ~SnapshotHolder_Snapshot();
+        // Destroy this object.
+
+    // MANIPULATORS
+    TYPE& value();
+        // Return a reference providing modifiable access to the value of this
+        // snapshot.  The behavior is undefined if this snapshot is published.
+
+    // ACCESSORS
+    const TYPE& value() const;
+        // Return a reference providing non-modifiable access to the value of
+        // this snapshot.
+
+    bsls::Types::Uint64 version() const;
+        // Return the version of this snapshot.
+};
+
+                            // ====================
+                            // class SnapshotHolder
+                            // ====================
+
+template <class TYPE>
+class SnapshotHolder {
+    // This class template holds a value of the template parameter 'TYPE',
+    // published as a sequence of immutable snapshots that are read without
+    // locking.
+
+    // PRIVATE TYPES
+    typedef SnapshotHolder_Snapshot<TYPE> Snapshot;
+
+    // DATA
+    EpochManager                     *d_epochManager_p;
+        // reclaims the replaced snapshots (held, and owned only if it
+        // addresses 'd_ownedEpochManager')
+
+    bsls::ObjectBuffer<EpochManager>  d_ownedEpochManager;
+        // epoch manager created if none is supplied at construction
+
+    bsls::AtomicPointer<Snapshot>     d_current;
+        // current snapshot (owned)
+
+    bslmt::Mutex                      d_writeLock;
+        // serializes writers
+
+    bslma::Allocator                 *d_allocator_p;
+        // memory allocator (held, not owned)
+
+    // FRIENDS
+    friend class SnapshotHolderGuard<TYPE>;
+
+    // NOT IMPLEMENTED
+    SnapshotHolder(const SnapshotHolder&);
+    SnapshotHolder& operator=(const SnapshotHolder&);
+
+    // PRIVATE MANIPULATORS
+    void initialize(Snapshot *snapshot);
+        // Make the specified 'snapshot' the current snapshot of this object,
+        // and create the epoch manager owned by this object if none was
+        // supplied at construction.  If an exception is thrown, 'snapshot' is
+        // destroyed and its memory returned to the allocator of this object.
+
+    void publish(Snapshot *snapshot);
+        // Make the specified 'snapshot' the current snapshot of this object,
+        // retire the previous snapshot, and reclaim the snapshots that are no
+        // longer in use.  The behavior is undefined unless 'd_writeLock' is
+        // held by the calling thread.
+
+  public:
+    // TYPES
+    typedef SnapshotHolderGuard<TYPE> Guard;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SnapshotHolder, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit SnapshotHolder(bslma::Allocator *basicAllocator = 0);
+        // Create a snapshot holder whose current snapshot, of version 0, has
+        // the default value of 'TYPE'.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    explicit SnapshotHolder(EpochManager     *epochManager,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a snapshot holder whose current snapshot, of version 0, has
+        // the default value of 'TYPE', and whose replaced snapshots are
+        // reclaimed by the specified 'epochManager'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  If
+        // 'epochManager' is 0, this object creates its own epoch manager.
+        // See {Sharing an Epoch Manager}.
+
+    explicit SnapshotHolder(const TYPE&       value,
+                            bslma::Allocator *basicAllocator = 0);
+        // Create a snapshot holder whose current snapshot, of version 0, has
+        // the specified 'value'.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    SnapshotHolder(const TYPE&       value,
+                   EpochManager     *epochManager,
+                   bslma::Allocator *basicAllocator = 0);
+        // Create a snapshot holder whose current snapshot, of version 0, has
+        // the specified 'value', and whose replaced snapshots are reclaimed
+        // by the specified 'epochManager'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  If
+        // 'epochManager' is 0, this object creates its own epoch manager.
+        // See {Sharing an Epoch Manager}.
+
+    ~SnapshotHolder();
+        // Destroy this object and its current snapshot.  If this object owns
+        // its epoch manager, also destroy all of its replaced snapshots;
+        // otherwise, the replaced snapshots not yet reclaimed are destroyed
+        // by the epoch manager supplied at construction.  The behavior is
+        // undefined unless no guard of this object exists.
+
+    // MANIPULATORS
+    template <class MODIFIER>
+    void modifyValue(const MODIFIER& modifier);
+        // Publish, as the current snapshot of this object, a copy of the
+        // current snapshot to which the specified 'modifier' has been applied
+        // by invoking it with a 'TYPE *' argument addressing the copy.  The
+        // version of the new snapshot is one more than the version of the
+        // snapshot it replaces.  If 'modifier' throws an exception, this
+        // method has no effect.  Note that no other writer can publish a
+        // snapshot between the copy and its publication.
+
+    bsl::size_t reclaim();
+        // Destroy the replaced snapshots of this object that no guard refers
+        // to any longer.  Return the number of snapshots destroyed.  Note that
+        // if the epoch manager of this object is shared, the objects retired
+        // to it by its other users are also destroyed, and counted, if no
+        // thread refers to them.
+
+    void setValue(const TYPE& value);
+        // Publish a snapshot having the specified 'value' as the current
+        // snapshot of this object.  The version of the new snapshot is one
+        // more than the version of the snapshot it replaces.
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    EpochManager *epochManager() const;
+        // Return the address of the epoch manager that reclaims the replaced
+        // snapshots of this object.
+
+    void getValue(TYPE *value) const;
+        // Load into the specified 'value' the value of the current snapshot of
+        // this object.
+
+    bsl::size_t numRetiredSnapshots() const;
+        // Return a snapshot of the number of snapshots of this object that
+        // have been replaced but not yet destroyed.  Note that if the epoch
+        // manager of this object is shared, the number of objects retired to
+        // it by its other users is included.
+
+    bsls::Types::Uint64 version() const;
+        // Return the version of the current snapshot of this object.
+};
+
+                         // =========================
+                         // class SnapshotHolderGuard
+                         // =========================
+
+template <class TYPE>
+class SnapshotHolderGuard {
+    // This class template implements a guard that gives access, for its
+    // lifetime, to the snapshot of a 'SnapshotHolder' that was current when
+    // the guard was created.  The snapshot is not destroyed while the guard
+    // exists.
+
+    // DATA
+    EpochGuard                           d_epochGuard;  // keeps the snapshot
+                                                        // from being
+                                                        // destroyed
+
+    const SnapshotHolder_Snapshot<TYPE> *d_snapshot_p;  // guarded snapshot
+
+    // NOT IMPLEMENTED
+    SnapshotHolderGuard(const SnapshotHolderGuard&);
+    SnapshotHolderGuard& operator=(const SnapshotHolderGuard&);
+
+  public:
+    // CREATORS
+    explicit SnapshotHolderGuard(const SnapshotHolder<TYPE> *holder);
+        // Create a guard giving access to the current snapshot of the
+        // specified 'holder'.
+
+    //! ~SnapshotHolderGuard() = default;
+        // Release the guarded snapshot, then destroy this object.
+
+    // ACCESSORS
+    const TYPE& operator*() const;
+        // Return a reference providing non-modifiable access to the value of
+        // the guarded snapshot.
+
+    const TYPE *operator->() const;
+        // Return the address providing non-modifiable access to the value of
+        // the guarded snapshot.
+
+    const TYPE& value() const;
+        // Return a reference providing non-modifiable access to the value of
+        // the guarded snapshot.
+
+    bsls::Types::Uint64 version() const;
+        // Return the version of the guarded snapshot.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // -----------------------------
+                       // class SnapshotHolder_Snapshot
+                       // -----------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SnapshotHolder_Snapshot<TYPE>::SnapshotHolder_Snapshot(
+                                   bsls::Types::Uint64  version,
+                                   bslma::Allocator    *basicAllocator)
+: d_version(version)
+{
+    bslalg::ScalarPrimitives::defaultConstruct(d_value.address(),
+                                               basicAllocator);
+}
+
+template <class TYPE>
+inline
+SnapshotHolder_Snapshot<TYPE>::SnapshotHolder_Snapshot(
+                                   const TYPE&          value,
+                                   bsls::Types::Uint64  version,
+                                   bslma::Allocator    *basicAllocator)
+: d_version(version)
+{
+    bslalg::ScalarPrimitives::copyConstruct(d_value.address(),
+                                            value,
+                                            basicAllocator);
+}
+
+template <class TYPE>
+inline
+SnapshotHolder_Snapshot<TYPE>::~SnapshotHolder_Snapshot()
+{
+    d_value.object().~TYPE();
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+TYPE& SnapshotHolder_Snapshot<TYPE>::value()
+{
+    return d_value.object();
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& SnapshotHolder_Snapshot<TYPE>::value() const
+{
+    return d_value.object();
+}
+
+template <class TYPE>
+inline
+bsls::Types::Uint64 SnapshotHolder_Snapshot<TYPE>::version() const
+{
+    return d_version;
+}
+
+                            // --------------------
+                            // class SnapshotHolder
+                            // --------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+void SnapshotHolder<TYPE>::initialize(Snapshot *snapshot)
+{
+    bslma::RawDeleterProctor<Snapshot, bslma::Allocator> proctor(
+                                                                snapshot,
+                                                                d_allocator_p);
+    if (!d_epochManager_p) {
+        d_epochManager_p = new (d_ownedEpochManager.buffer())
+                                                   EpochManager(d_allocator_p);
+    }
+    proctor.release();
+
+    d_current = snapshot;
+}
+
+template <class TYPE>
+void SnapshotHolder<TYPE>::publish(Snapshot *snapshot)
+{
+    Snapshot *previous = d_current.swap(snapshot);
+
+    d_epochManager_p->retireObject(previous, d_allocator_p);
+    d_epochManager_p->reclaim();
+}
+
+// CREATORS
+template <class TYPE>
+SnapshotHolder<TYPE>::SnapshotHolder(bslma::Allocator *basicAllocator)
+: d_epochManager_p(0)
+, d_current(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(new (*d_allocator_p) Snapshot(0, d_allocator_p));
+}
+
+template <class TYPE>
+SnapshotHolder<TYPE>::SnapshotHolder(EpochManager     *epochManager,
+                                     bslma::Allocator *basicAllocator)
+: d_epochManager_p(epochManager)
+, d_current(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(new (*d_allocator_p) Snapshot(0, d_allocator_p));
+}
+
+template <class TYPE>
+SnapshotHolder<TYPE>::SnapshotHolder(const TYPE&       value,
+                                     bslma::Allocator *basicAllocator)
+: d_epochManager_p(0)
+, d_current(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(new (*d_allocator_p) Snapshot(value, 0, d_allocator_p));
+}
+
+template <class TYPE>
+SnapshotHolder<TYPE>::SnapshotHolder(const TYPE&       value,
+                                     EpochManager     *epochManager,
+                                     bslma::Allocator *basicAllocator)
+: d_epochManager_p(epochManager)
+, d_current(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(new (*d_allocator_p) Snapshot(value, 0, d_allocator_p));
+}
+
+template <class TYPE>
+SnapshotHolder<TYPE>::~SnapshotHolder()
+{
+    d_allocator_p->deleteObject(d_current.load());
+
+    if (d_epochManager_p == &d_ownedEpochManager.object()) {
+        // The replaced snapshots not yet reclaimed are destroyed by the
+        // destructor of the epoch manager.
+
+        d_ownedEpochManager.object().~EpochManager();
+    }
+    else {
+        d_epochManager_p->reclaim();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+template <class MODIFIER>
+void SnapshotHolder<TYPE>::modifyValue(const MODIFIER& modifier)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_writeLock);
+
+    const Snapshot *current = d_current.loadRelaxed();
+
+    Snapshot *snapshot = new (*d_allocator_p) Snapshot(current->value(),
+                                                       current->version() + 1,
+                                                       d_allocator_p);
+    bslma::RawDeleterProctor<Snapshot, bslma::Allocator> proctor(
+                                                                snapshot,
+                                                                d_allocator_p);
+    modifier(&snapshot->value());
+    proctor.release();
+
+    publish(snapshot);
+}
+
+template <class TYPE>
+inline
+bsl::size_t SnapshotHolder<TYPE>::reclaim()
+{
+    return d_epochManager_p->reclaim();
+}
+
+template <class TYPE>
+void SnapshotHolder<TYPE>::setValue(const TYPE& value)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_writeLock);
+
+    Snapshot *snapshot = new (*d_allocator_p) Snapshot(
+                                       value,
+                                       d_current.loadRelaxed()->version() + 1,
+                                       d_allocator_p);
+    publish(snapshot);
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+bslma::Allocator *SnapshotHolder<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE>
+inline
+EpochManager *SnapshotHolder<TYPE>::epochManager() const
+{
+    return d_epochManager_p;
+}
+
+template <class TYPE>
+void SnapshotHolder<TYPE>::getValue(TYPE *value) const
+{
+    BSLS_ASSERT(value);
+
+    EpochGuard guard(d_epochManager_p);
+
+    *value = d_current.loadAcquire()->value();
+}
+
+template <class TYPE>
+inline
+bsl::size_t SnapshotHolder<TYPE>::numRetiredSnapshots() const
+{
+    return d_epochManager_p->numRetired();
+}
+
+template <class TYPE>
+bsls::Types::Uint64 SnapshotHolder<TYPE>::version() const
+{
+    EpochGuard guard(d_epochManager_p);
+
+    return d_current.loadAcquire()->version();
+}
+
+                         // -------------------------
+                         // class SnapshotHolderGuard
+                         // -------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+SnapshotHolderGuard<TYPE>::SnapshotHolderGuard(
+                                            const SnapshotHolder<TYPE> *holder)
+: d_epochGuard(holder->d_epochManager_p)
+, d_snapshot_p(holder->d_current.loadAcquire())
+{
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+const TYPE& SnapshotHolderGuard<TYPE>::operator*() const
+{
+    return d_snapshot_p->value();
+}
+
+template <class TYPE>
+inline
+const TYPE *SnapshotHolderGuard<TYPE>::operator->() const
+{
+    return &d_snapshot_p->value();
+}
+
+template <class TYPE>
+inline
+const TYPE& SnapshotHolderGuard<TYPE>::value() const
+{
+    return d_snapshot_p->value();
+}
+
+template <class TYPE>
+inline
+bsls::Types::Uint64 SnapshotHolderGuard<TYPE>::version() const
+{
+    return d_snapshot_p->version();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,880 @@
+// bdlcc_snapshotholder.t.cpp                                         -*-C++-*-
+
+#include <bdlcc_snapshotholder.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_readerwriterlock.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test holds a value published as immutable snapshots
+// that are read without locking.  We first verify the basic manipulators and
+// accessors, and the reclamation of replaced snapshots.  We then verify
+// 'modifyValue', including its exception safety, and the propagation of the
+// allocator to the value.  Next, we verify that readers always observe
+// complete snapshots, in non-decreasing version order, while writers replace
+// the value.  Finally, we verify that many holders can coexist, and that
+// holders can share an epoch manager.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] SnapshotHolder(bslma::Allocator *basicAllocator = 0);
+// [ 4] SnapshotHolder(EpochManager *epochManager, *bA = 0);
+// [ 1] SnapshotHolder(const TYPE& value, bslma::Allocator *bA = 0);
+// [ 4] SnapshotHolder(const TYPE& value, EpochManager *eM, *bA = 0);
+// [ 1] ~SnapshotHolder();
+//
+// MANIPULATORS
+// [ 2] void modifyValue(const MODIFIER& modifier);
+// [ 1] bsl::size_t reclaim();
+// [ 1] void setValue(const TYPE& value);
+//
+// ACCESSORS
+// [ 1] bslma::Allocator *allocator() const;
+// [ 4] EpochManager *epochManager() const;
+// [ 1] void getValue(TYPE *value) const;
+// [ 1] bsl::size_t numRetiredSnapshots() const;
+// [ 1] bsls::Types::Uint64 version() const;
+//
+// 'SnapshotHolderGuard'
+// [ 1] SnapshotHolderGuard(const SnapshotHolder<TYPE> *holder);
+// [ 1] ~SnapshotHolderGuard();
+// [ 1] const TYPE& operator*() const;
+// [ 1] const TYPE *operator->() const;
+// [ 1] const TYPE& value() const;
+// [ 1] bsls::Types::Uint64 version() const;
+// ----------------------------------------------------------------------------
+// [ 3] CONCURRENCY TEST
+// [ 4] MANY HOLDERS AND SHARED EPOCH MANAGERS
+// [ 5] USAGE EXAMPLE
+// [-1] READ THROUGHPUT BENCHMARK
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Uint64                     Uint64;
+
+typedef bdlcc::SnapshotHolder<bsl::string>      Obj;
+typedef bdlcc::SnapshotHolderGuard<bsl::string> Guard;
+
+typedef bsl::vector<int>                        Table;
+typedef bdlcc::SnapshotHolder<Table>            TableObj;
+typedef bdlcc::SnapshotHolderGuard<Table>       TableGuard;
+
+// ============================================================================
+//                          CASE 2 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace SNAPSHOTHOLDER_CASE_2 {
+
+struct Appender {
+    // This functor appends a string to a string.
+
+    // DATA
+    const char *d_suffix_p;
+
+    // ACCESSORS
+    void operator()(bsl::string *value) const
+        // Append 'd_suffix_p' to the specified 'value'.
+    {
+        value->append(d_suffix_p);
+    }
+};
+
+struct Thrower {
+    // This functor modifies a string, then throws an exception.
+
+    // ACCESSORS
+    void operator()(bsl::string *value) const
+        // Modify the specified 'value', then throw an 'int'.
+    {
+        value->append(" -- discarded");
+        throw 1;
+    }
+};
+
+}  // close namespace SNAPSHOTHOLDER_CASE_2
+
+// ============================================================================
+//                          CASE 3 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace SNAPSHOTHOLDER_CASE_3 {
+
+enum {
+    k_NUM_READERS = 4,
+    k_NUM_WRITERS = 2,
+    k_NUM_UPDATES = 2000,  // per writer
+    k_TABLE_SIZE  = 64
+};
+
+bsls::AtomicBool s_done(false);
+bsls::AtomicInt  s_numErrors(0);
+
+void fill(Table *table)
+    // Set every element of the specified 'table' to one more than its first
+    // element.
+{
+    const int value = (*table)[0] + 1;
+    for (Table::iterator it = table->begin(); it != table->end(); ++it) {
+        *it = value;
+    }
+}
+
+void reader(const TableObj *holder, bslmt::Barrier *barrier)
+    // Repeatedly read the current snapshot of the specified 'holder', after
+    // waiting on the specified 'barrier', until 's_done' is set, incrementing
+    // 's_numErrors' if a snapshot is incomplete, or older than a snapshot
+    // read previously.
+{
+    barrier->wait();
+
+    Uint64 previous = 0;
+    while (!s_done) {
+        TableGuard guard(holder);
+
+        const Table& table = *guard;
+        for (int i = 0; i < k_TABLE_SIZE; ++i) {
+            if (static_cast<Uint64>(table[i]) != guard.version()) {
+                ++s_numErrors;
+                break;
+            }
+        }
+        if (guard.version() < previous) {
+            ++s_numErrors;
+        }
+        previous = guard.version();
+    }
+}
+
+void writer(TableObj *holder, bslmt::Barrier *barrier)
+    // Replace the value of the specified 'holder' 'k_NUM_UPDATES' times,
+    // after waiting on the specified 'barrier'.
+{
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_UPDATES; ++i) {
+        holder->modifyValue(&fill);
+        if (0 == i % 100) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+}
+
+}  // close namespace SNAPSHOTHOLDER_CASE_3
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace SNAPSHOTHOLDER_CASE_MINUS_1 {
+
+typedef bsl::map<int, int> Map;
+
+bsls::AtomicBool  s_stop(false);
+bsls::AtomicInt64 s_numReads(0);
+
+void snapshotReader(const bdlcc::SnapshotHolder<Map> *holder)
+    // Look up keys in the current snapshot of the specified 'holder' until
+    // 's_stop' is set, and add the number of lookups to 's_numReads'.
+{
+    bsls::Types::Int64 numReads = 0;
+    int                sum      = 0;
+    while (!s_stop) {
+        bdlcc::SnapshotHolderGuard<Map> guard(holder);
+
+        Map::const_iterator it = guard->find(static_cast<int>(numReads % 100));
+        sum += it->second;
+        ++numReads;
+    }
+    s_numReads += numReads + (sum & 0);
+}
+
+void lockedReader(const bsl::shared_ptr<Map> *map,
+                  bslmt::ReaderWriterLock    *lock)
+    // Look up keys in the map held by the specified 'map', guarded by the
+    // specified 'lock', until 's_stop' is set, and add the number of lookups
+    // to 's_numReads'.
+{
+    bsls::Types::Int64 numReads = 0;
+    int                sum      = 0;
+    while (!s_stop) {
+        bsl::shared_ptr<Map> current;
+        {
+            bslmt::ReadLockGuard<bslmt::ReaderWriterLock> guard(lock);
+            current = *map;
+        }
+
+        Map::const_iterator it = current->find(
+                                           static_cast<int>(numReads % 100));
+        sum += it->second;
+        ++numReads;
+    }
+    s_numReads += numReads + (sum & 0);
+}
+
+}  // close namespace SNAPSHOTHOLDER_CASE_MINUS_1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Routing Table
+///- - - - - - - - - - - - -
+// Suppose that the threads of a message router look up, for each message,
+// the destination of its topic in a routing table that is occasionally
+// replaced by an administrative thread.
+//
+// First, we define the routing table type and create its holder:
+//..
+    typedef bsl::map<bsl::string, int> RoutingTable;  // topic -> destination
+
+    bdlcc::SnapshotHolder<RoutingTable> routes;
+//..
+// Then, the administrative thread publishes an initial table:
+//..
+    RoutingTable table;
+    table["prices"] = 1;
+    table["trades"] = 2;
+
+    routes.setValue(table);
+    ASSERT(1 == routes.version());
+//..
+// Next, a router thread looks up a destination, holding the snapshot only for
+// the duration of the lookup:
+//..
+    {
+        bdlcc::SnapshotHolderGuard<RoutingTable> guard(&routes);
+
+        RoutingTable::const_iterator it = guard->find("trades");
+        ASSERT(guard->end() != it);
+        ASSERT(2            == it->second);
+    }
+//..
+// Then, we define a function that adds a route to a table:
+//..
+    struct AddRoute {
+        static void add(RoutingTable *table)
+        {
+            (*table)["orders"] = 3;
+        }
+    };
+//..
+// Finally, the administrative thread adds the route by copying the current
+// snapshot, modifying the copy, and publishing it.  A router thread that
+// pinned the previous snapshot continues to see it, while a new reader sees
+// the new table:
+//..
+    {
+        bdlcc::SnapshotHolderGuard<RoutingTable> before(&routes);
+
+        routes.modifyValue(&AddRoute::add);
+        ASSERT(2 == routes.version());
+
+        bdlcc::SnapshotHolderGuard<RoutingTable> after(&routes);
+
+        ASSERT(2 == before->size());
+        ASSERT(1 == before.version());
+        ASSERT(3 == after->size());
+        ASSERT(2 == after.version());
+    }
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANY HOLDERS AND SHARED EPOCH MANAGERS
+        //
+        // Concerns:
+        //: 1 Several thousand holders, each owning its epoch manager, can
+        //:   exist simultaneously and be read by the same thread.
+        //:
+        //: 2 A holder created with an epoch manager uses it to reclaim its
+        //:   replaced snapshots, and a holder created without one owns its
+        //:   own.
+        //:
+        //: 3 The replaced snapshots of a destroyed holder that shares an
+        //:   epoch manager are destroyed by that epoch manager, and all
+        //:   memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Create several thousand holders, replace and read the value of
+        //:   each, and destroy them.  (C-1)
+        //:
+        //: 2 Create holders, with and without a value, sharing an epoch
+        //:   manager, and verify 'epochManager' and 'numRetiredSnapshots'
+        //:   after replacing their values.  Destroy the holders while a guard
+        //:   pins a replaced snapshot, then the epoch manager, and verify that
+        //:   all memory is returned.  (C-2..3)
+        //
+        // Testing:
+        //   SnapshotHolder(EpochManager *epochManager, *bA = 0);
+        //   SnapshotHolder(const TYPE& value, EpochManager *eM, *bA = 0);
+        //   EpochManager *epochManager() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANY HOLDERS AND SHARED EPOCH MANAGERS" << endl
+                          << "======================================" << endl;
+
+        typedef bdlcc::SnapshotHolder<int> IntObj;
+
+        enum { k_NUM_HOLDERS = 5000 };
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\tHolders owning their epoch manager." << endl;
+        {
+            bsl::vector<IntObj *> holders(&ta);
+            for (int i = 0; i < k_NUM_HOLDERS; ++i) {
+                holders.push_back(new (ta) IntObj(i, &ta));
+            }
+            for (int i = 0; i < k_NUM_HOLDERS; ++i) {
+                holders[i]->setValue(i + 1);
+
+                bdlcc::SnapshotHolderGuard<int> guard(holders[i]);
+                ASSERTV(i, *guard, i + 1 == *guard);
+                ASSERTV(i, 1 == guard.version());
+            }
+            ASSERT(holders[0]->epochManager() !=
+                                                holders[1]->epochManager());
+            for (int i = 0; i < k_NUM_HOLDERS; ++i) {
+                ta.deleteObject(holders[i]);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tHolders sharing an epoch manager." << endl;
+        {
+            bdlcc::EpochManager epochManager(&ta);
+            {
+                Obj mX(&epochManager, &ta);         const Obj& X = mX;
+                Obj mY("y", &epochManager, &ta);    const Obj& Y = mY;
+                Obj mZ("z", 0, &ta);                const Obj& Z = mZ;
+
+                ASSERT(&epochManager == X.epochManager());
+                ASSERT(&epochManager == Y.epochManager());
+                ASSERT(0             != Z.epochManager());
+                ASSERT(&epochManager != Z.epochManager());
+                ASSERT(""  == Guard(&X).value());
+                ASSERT("y" == Guard(&Y).value());
+                ASSERT("z" == Guard(&Z).value());
+
+                Guard guard(&Y);
+
+                mX.setValue("x1");
+                mY.setValue("y1");
+                mZ.setValue("z1");
+
+                ASSERTV(Y.numRetiredSnapshots(),
+                        1 <= Y.numRetiredSnapshots());
+                ASSERTV(epochManager.numRetired(),
+                        X.numRetiredSnapshots() == epochManager.numRetired());
+                ASSERT("x1" == Guard(&X).value());
+                ASSERT("y"  == guard.value());
+                ASSERT("y1" == Guard(&Y).value());
+            }
+
+            // The guard is released, so the replaced snapshots of the
+            // destroyed holders can be reclaimed.
+
+            epochManager.reclaim();
+            epochManager.reclaim();
+            ASSERTV(epochManager.numRetired(),
+                    0 == epochManager.numRetired());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Readers always observe a complete snapshot, whose value
+        //:   corresponds to its version.
+        //:
+        //: 2 A reader observes versions in non-decreasing order.
+        //:
+        //: 3 Concurrent calls to 'modifyValue' are serialized: each applies
+        //:   its modifier to the snapshot published by the previous one.
+        //:
+        //: 4 Every snapshot is destroyed, and its memory returned, and no
+        //:   snapshot is accessed after its destruction.
+        //
+        // Plan:
+        //: 1 Run several reader threads that check that every element of the
+        //:   current table equals the version of its snapshot, and several
+        //:   writer threads that repeatedly increment every element of the
+        //:   table with 'modifyValue'.  Verify that no reader observed an
+        //:   inconsistency, and that the final version and value reflect every
+        //:   update.  (C-1..3)
+        //:
+        //: 2 Verify that all memory is returned to the allocator when the
+        //:   holder is destroyed (and, when built with a sanitizer, that no
+        //:   freed memory is accessed).  (C-4)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace SNAPSHOTHOLDER_CASE_3;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            TableObj mX(Table(k_TABLE_SIZE, 0, &ta), &ta);
+            const TableObj& X = mX;
+
+            bslmt::Barrier     barrier(k_NUM_READERS + k_NUM_WRITERS);
+            bslmt::ThreadGroup readers(&ta);
+            bslmt::ThreadGroup writers(&ta);
+
+            for (int i = 0; i < k_NUM_READERS; ++i) {
+                readers.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &reader,
+                                                        &X,
+                                                        &barrier));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                writers.addThread(bdlf::BindUtil::bindS(&ta,
+                                                        &writer,
+                                                        &mX,
+                                                        &barrier));
+            }
+            writers.joinAll();
+            s_done = true;
+            readers.joinAll();
+
+            ASSERTV(s_numErrors, 0 == s_numErrors);
+
+            const Uint64 NUM_UPDATES = k_NUM_WRITERS * k_NUM_UPDATES;
+            ASSERTV(X.version(), NUM_UPDATES == X.version());
+
+            Table table(&ta);
+            X.getValue(&table);
+            ASSERT(NUM_UPDATES == static_cast<Uint64>(table.front()));
+            ASSERT(NUM_UPDATES == static_cast<Uint64>(table.back()));
+
+            if (veryVerbose) {
+                P(X.numRetiredSnapshots());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'modifyValue'
+        //
+        // Concerns:
+        //: 1 'modifyValue' publishes a copy of the current value to which the
+        //:   modifier was applied, with the next version, and leaves the
+        //:   snapshots held by guards unchanged.
+        //:
+        //: 2 If the modifier throws, the current snapshot is unchanged, and
+        //:   no memory is leaked.
+        //:
+        //: 3 The value of each snapshot uses the allocator of the holder.
+        //
+        // Plan:
+        //: 1 Modify a string value while a guard holds the previous snapshot,
+        //:   and verify the values and versions of both snapshots.  (C-1)
+        //:
+        //: 2 Invoke 'modifyValue' with a modifier that throws, and verify the
+        //:   state of the holder and of its allocator.  (C-2)
+        //:
+        //: 3 Use values too long for the short-string buffer, and verify that
+        //:   no memory comes from the default allocator.  (C-3)
+        //
+        // Testing:
+        //   void modifyValue(const MODIFIER& modifier);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'modifyValue'" << endl
+                          << "=====================" << endl;
+
+        using namespace SNAPSHOTHOLDER_CASE_2;
+
+        const char *const LONG = "a string too long for the short-string"
+                                 " buffer";
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(bsl::string(LONG, &ta), &ta);  const Obj& X = mX;
+
+            bsl::string expected(LONG, &ta);
+            expected.append(", and a suffix");
+
+            {
+                Guard before(&X);
+
+                Appender appender = { ", and a suffix" };
+                mX.modifyValue(appender);
+
+                Guard after(&X);
+
+                ASSERT(0    == before.version());
+                ASSERT(LONG == before.value());
+                ASSERT(1    == after.version());
+                ASSERT(expected == *after);
+            }
+
+            if (verbose) cout << "\tException safety." << endl;
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.modifyValue(Thrower());
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+            ASSERT(1 == X.version());
+            ASSERTV(numBlocks, ta.numBlocksInUse(),
+                    numBlocks == ta.numBlocksInUse());
+
+            Guard guard(&X);
+            ASSERT(expected == *guard);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 A holder is created with a default or supplied value, of version
+        //:   0.
+        //:
+        //: 2 'setValue' publishes a new snapshot with the next version, and a
+        //:   guard gives access to the snapshot that was current when it was
+        //:   created.
+        //:
+        //: 3 A replaced snapshot is not destroyed while a guard refers to it,
+        //:   and is destroyed by 'reclaim' (or a later 'setValue') once no
+        //:   guard refers to it, or else by the destructor.
+        //:
+        //: 4 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Perform a few operations, verifying the state of the holder and
+        //:   of its guards after each.  (C-1..4)
+        //
+        // Testing:
+        //   SnapshotHolder(bslma::Allocator *basicAllocator = 0);
+        //   SnapshotHolder(const TYPE& value, bslma::Allocator *bA = 0);
+        //   ~SnapshotHolder();
+        //   bsl::size_t reclaim();
+        //   void setValue(const TYPE& value);
+        //   bslma::Allocator *allocator() const;
+        //   void getValue(TYPE *value) const;
+        //   bsl::size_t numRetiredSnapshots() const;
+        //   bsls::Types::Uint64 version() const;
+        //   SnapshotHolderGuard(const SnapshotHolder<TYPE> *holder);
+        //   ~SnapshotHolderGuard();
+        //   const TYPE& operator*() const;
+        //   const TYPE *operator->() const;
+        //   const TYPE& value() const;
+        //   bsls::Types::Uint64 version() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0   == X.version());
+            ASSERT(0   == X.numRetiredSnapshots());
+
+            bsl::string value(&ta);
+            X.getValue(&value);
+            ASSERT(value.empty());
+
+            mX.setValue("first");
+            ASSERT(1 == X.version());
+            X.getValue(&value);
+            ASSERT("first" == value);
+
+            {
+                Guard guard(&X);
+
+                ASSERT(1       == guard.version());
+                ASSERT("first" == guard.value());
+                ASSERT("first" == *guard);
+                ASSERT(5       == guard->size());
+
+                mX.setValue("second");
+                ASSERT(2 == X.version());
+
+                ASSERT(1       == guard.version());
+                ASSERT("first" == guard.value());
+
+                for (int i = 0; i < 5; ++i) {
+                    mX.reclaim();
+                }
+                ASSERTV(X.numRetiredSnapshots(),
+                        1 == X.numRetiredSnapshots());
+                ASSERT("first" == guard.value());
+            }
+
+            mX.reclaim();
+            mX.reclaim();
+            ASSERTV(X.numRetiredSnapshots(), 0 == X.numRetiredSnapshots());
+
+            mX.setValue("third");
+            ASSERT(3 == X.version());
+            ASSERT(1 == X.numRetiredSnapshots());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            Obj mX(bsl::string("initial", &ta), &ta);  const Obj& X = mX;
+
+            Guard guard(&X);
+            ASSERT(0         == guard.version());
+            ASSERT("initial" == guard.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // READ THROUGHPUT BENCHMARK
+        //   Compare the throughput of lookups in a map held by a
+        //   'bdlcc::SnapshotHolder' and in a map held by a 'bsl::shared_ptr'
+        //   guarded by a 'bslmt::ReaderWriterLock'.  Command line parameters:
+        //   2nd parameter: number of threads (default: 4)
+        //   3rd parameter: duration of each sample in milliseconds
+        //                  (default: 500)
+        //
+        // Concerns:
+        //: 1 Readers of a snapshot holder do not contend with each other.
+        //
+        // Plan:
+        //: 1 Run the readers of each kind of holder for the same duration,
+        //:   and report the number of lookups per second.  (C-1)
+        //
+        // Testing:
+        //   READ THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "READ THROUGHPUT BENCHMARK" << endl
+             << "=========================" << endl;
+
+        using namespace SNAPSHOTHOLDER_CASE_MINUS_1;
+
+        const int numThreads = argc > 2 ? atoi(argv[2]) : 4;
+        const int millis     = argc > 3 ? atoi(argv[3]) : 500;
+
+        Map map;
+        for (int i = 0; i < 100; ++i) {
+            map[i] = i;
+        }
+
+        bdlcc::SnapshotHolder<Map> holder(map);
+        bsl::shared_ptr<Map>       shared = bsl::make_shared<Map>(map);
+        bslmt::ReaderWriterLock    lock;
+
+        for (int ti = 0; ti < 2; ++ti) {
+            s_stop     = false;
+            s_numReads = 0;
+
+            bslmt::ThreadGroup threadGroup;
+            for (int i = 0; i < numThreads; ++i) {
+                if (0 == ti) {
+                    threadGroup.addThread(bdlf::BindUtil::bind(
+                                                           &snapshotReader,
+                                                           &holder));
+                }
+                else {
+                    threadGroup.addThread(bdlf::BindUtil::bind(&lockedReader,
+                                                               &shared,
+                                                               &lock));
+                }
+            }
+
+            bsls::Stopwatch stopwatch;
+            stopwatch.start();
+            bslmt::ThreadUtil::microSleep(millis * 1000);
+            s_stop = true;
+            threadGroup.joinAll();
+            stopwatch.stop();
+
+            cout << (0 == ti ? "SnapshotHolder:        "
+                             : "shared_ptr and RWLock: ")
+                 << static_cast<double>(s_numReads)
+                                                / stopwatch.elapsedTime()
+                 << " reads/s" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (test >= 0) {
+        // CONCERN: In no case does memory come from the global allocator.
+
+        LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                    0 == globalAllocator.numBlocksTotal());
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
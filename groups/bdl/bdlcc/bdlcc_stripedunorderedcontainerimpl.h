@@ -81,12 +81,49 @@ BSLS_IDENT("$Id: $")
 //: o The 'maxLoadFactor(newMaxLoadFactor)' method.
 //: o The 'rehash' method.
 //
+// The rehash is incremental: the elements are migrated to the new array of
+// buckets one stripe at a time, and each stripe is write-locked only while its
+// own elements are being moved.  Since the stripe of an element depends only
+// on its hash value (and not on the number of buckets), operations on a stripe
+// that has already been migrated use the new array of buckets, operations on a
+// stripe that has not yet been migrated use the old one, and neither has to
+// wait for the rehash to complete.  'bucketCount' reports the new number of
+// buckets once every stripe has been migrated.
+//
 ///Rehash Control
 /// - - - - - - -
 // 'enableRehash' and 'disableRehash' methods are provided to control the
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Optimistic Reads
+///----------------
+// Each stripe maintains a sequence number that is incremented when the stripe
+// is write-locked and again when it is unlocked (i.e., a "seqlock").  If
+// 'enableOptimisticRead' has been called and 'VALUE' is trivially copyable
+// (see 'bslmf_istriviallycopyable'), 'getValue(VALUE *, const KEY&)' does not
+// lock the stripe: it reads the sequence number, copies the value of the
+// element found (if any), and accepts the result only if the sequence number
+// is even and unchanged, falling back to a read-locked look-up after a few
+// failed attempts.  A reader therefore never writes to the (shared) cache line
+// of a stripe, which removes the contention on the reader-writer lock of a
+// stripe that is frequently read.
+//
+// Since an optimistic reader may still be traversing a node that a concurrent
+// writer unlinks, once optimistic reads are enabled erased nodes (and the
+// array of buckets replaced by a rehash) are retired to a
+// 'bdlcc::EpochManager' and reclaimed only after every reader that might
+// observe them has left.  Optimistic reads are available only when the
+// standard library provides 'atomic_thread_fence', which is needed to order
+// the reads against the validation of the sequence number; otherwise,
+// 'enableOptimisticRead' has no effect.
+//
+// By default, 'enableOptimisticRead' creates an epoch manager owned by the
+// hash map.  Hash maps read by the same threads may instead share an epoch
+// manager supplied to 'enableOptimisticRead', in which case the epoch
+// manager must outlive the hash maps, and the allocator of each hash map must
+// remain valid until the elements retired by that hash map are reclaimed.
+//
 ///Usage
 ///-----
 // There is no usage example for this component since it is not meant for
@@ -94,6 +131,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_epochmanager.h>
+
 #include <bslalg_hashtableimputil.h>
 
 #include <bslim_printer.h>
@@ -105,6 +144,8 @@ BSLS_IDENT("$Id: $")
 #include <bslma_destructorproctor.h>
 #include <bslma_usesbslmaallocator.h>
 
+#include <bslmf_integralconstant.h>
+#include <bslmf_istriviallycopyable.h>
 #include <bslmf_movableref.h>
 #include <bslmf_nestedtraitdeclaration.h>
 
@@ -114,6 +155,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_libraryfeatures.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>   // BSLS_PLATFORM_CPU_X86_64
 
@@ -122,12 +164,17 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>     // 'NULL'
+#include <bsl_cstring.h>     // 'memcpy'
 #include <bsl_functional.h>
 #include <bsl_list.h>
 #include <bsl_vector.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+#include <bsl_atomic.h>      // 'atomic_thread_fence'
+#endif
+
 namespace BloombergLP {
 namespace bdlcc {
 
@@ -428,9 +475,29 @@ class StripedUnorderedContainerImpl {
         k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
                                             bslmt::Platform::e_CACHE_LINE_SIZE,
         // Cacheline size to use; may be 1 or 2 cachelines
-        k_INT_PADDING = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt)
+        k_INT_PADDING = k_EFFECTIVE_CACHELINE_SIZE - sizeof(bsls::AtomicInt),
+
+        k_MAX_OPTIMISTIC_READS = 4
+        // Number of optimistic reads attempted by 'getValue' before it falls
+        // back to read-locking the stripe
     };
 
+    typedef StripedUnorderedContainerImpl_Bucket<KEY, VALUE> Bucket;
+        // Bucket in the hash table.
+
+    typedef bsl::vector<Bucket>                              BucketArray;
+        // Array of buckets of the hash table.
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    typedef bsl::integral_constant<bool,
+                                   bsl::is_trivially_copyable<VALUE>::value>
+                                                       OptimisticReadSupported;
+#else
+    typedef bsl::false_type                            OptimisticReadSupported;
+#endif
+        // 'bsl::true_type' if 'getValue' can copy a 'VALUE' without locking
+        // the stripe, and 'bsl::false_type' otherwise.
+
     enum Multiplicity {
         // Enumeration to differentiate between inserting only unique keys and
         // inserting multiple values for the same key.
@@ -490,9 +557,26 @@ class StripedUnorderedContainerImpl {
     const char                        d_numElementsPad[k_INT_PADDING];
         // padding, so that 'd_numElements' will have its own cache line
 
-    bsl::vector<StripedUnorderedContainerImpl_Bucket<KEY,VALUE> >
-                                      d_buckets;
-        // hash table data, storing key-value pairs
+    BucketArray                       d_evenBuckets;
+        // hash table data, storing key-value pairs, of the stripes having an
+        // even generation (see 'generation' in 'LockElement')
+
+    BucketArray                       d_oddBuckets;
+        // hash table data of the stripes having an odd generation; unless a
+        // rehash is in progress, one of 'd_evenBuckets' and 'd_oddBuckets' is
+        // empty
+
+    int                               d_generation;
+        // generation of every stripe when no rehash is in progress; modified
+        // only by the thread performing a rehash
+
+    bsls::AtomicPointer<EpochManager> d_epochManager_p;
+        // reclaims erased nodes and replaced bucket arrays once optimistic
+        // reads are enabled, and null otherwise (held, and owned if
+        // 'd_ownsEpochManager')
+
+    bool                              d_ownsEpochManager;
+        // 'true' if 'd_epochManager_p' was created by this object
 
     LockElement                      *d_locks_p;
         // Pointer to an array of locks for the stripes.  Note that mutex can't
@@ -526,10 +610,25 @@ class StripedUnorderedContainerImpl {
         // Return the nearest higher power of 2 for the specified 'num'.
 
     // PRIVATE MANIPULATORS
+    BucketArray& bucketArray(int generation);
+        // Return a reference providing modifiable access to the array of
+        // buckets of the stripes having the specified 'generation'.
+
     void checkRehash();
         // Perform a rehash if the 'loadFactor() > maxLoadFactor()', and
         // 'true == canRehash()'.
 
+    void clearBucket(Bucket *bucket);
+        // Remove all elements from the specified 'bucket'.  The behavior is
+        // undefined unless the stripe of 'bucket' is locked for write.
+
+    void deleteNode(Node *node);
+        // Destroy the specified 'node' and deallocate its memory.  If
+        // optimistic reads are enabled, defer this until no optimistic reader
+        // can be accessing 'node'.  The behavior is undefined unless 'node'
+        // has been unlinked from its bucket and the stripe of 'node' is locked
+        // for write.
+
     bsl::size_t erase(const KEY& key, Scope scope);
         // Remove from this hash map the element, if any, having the specified
         // 'key'.  If there a multiple elements having 'key' and the specified
@@ -650,6 +749,10 @@ class StripedUnorderedContainerImpl {
         // is a single element in the bucket having 'key'.
 
     // PRIVATE ACCESSORS
+    const BucketArray& bucketArray(int generation) const;
+        // Return a reference providing non-modifiable access to the array of
+        // buckets of the stripes having the specified 'generation'.
+
     bsl::size_t bucketIndex(const KEY& key, bsl::size_t numBuckets) const;
         // Return the index of the bucket, in the array of buckets maintained
         // by this hash map, where values having a key equivalent to the
@@ -660,18 +763,37 @@ class StripedUnorderedContainerImpl {
 
     bsl::size_t bucketToStripe(bsl::size_t bucketIndex) const;
         // Return the stripe index associated with the specified 'bucketIndex'.
-
-    LockElement *lockRead(bsl::size_t *bucketIdx, const KEY& key) const;
-        // Lock for read the stripe related to the specified 'key', setting the
-        // specified 'bucketIdx' to the bucket index associated with 'key'.
-        // Return the address to the lock-element associated with the returned
-        // 'bucketIdx'.
-
-    LockElement *lockWrite(bsl::size_t *bucketIdx, const KEY& key) const;
-        // Lock for write the stripe related to the specified 'key', setting
-        // the specified 'bucketIdx' to the bucket index associated with 'key'.
-        // Return the address to the lock-element associated with the returned
-        // 'bucketIdx'.
+        // Note that, since the number of buckets is a power of 2 that is not
+        // less than the number of stripes, the stripe index associated with a
+        // hash value is also the stripe index of every bucket index computed
+        // from that hash value.
+
+    LockElement *lockRead(const Bucket **bucket, const KEY& key) const;
+        // Lock for read the stripe related to the specified 'key', loading
+        // into the specified 'bucket' the address of the bucket associated
+        // with 'key'.  Return the address to the lock-element of the stripe.
+
+    LockElement *lockWrite(Bucket **bucket, const KEY& key);
+        // Lock for write the stripe related to the specified 'key', loading
+        // into the specified 'bucket' the address of the bucket associated
+        // with 'key'.  Return the address to the lock-element of the stripe.
+
+    int tryGetValue(bsl::size_t *numFound,
+                    VALUE       *value,
+                    const KEY&   key,
+                    bsl::true_type) const;
+    int tryGetValue(bsl::size_t *numFound,
+                    VALUE       *value,
+                    const KEY&   key,
+                    bsl::false_type) const;
+        // Attempt to load, into the specified '*value', the value attribute
+        // of the first element found in this hash map having the specified
+        // 'key' without locking its stripe, and load into the specified
+        // '*numFound' the number of values loaded (0 or 1).  Return 0 on
+        // success, and a non-zero value (with no effect on '*numFound' or
+        // '*value') if a consistent snapshot of the stripe could not be
+        // read, or if optimistic reads are not supported for 'VALUE'.  The
+        // behavior is undefined unless optimistic reads are enabled.
 
   public:
     // CREATORS
@@ -693,8 +815,7 @@ class StripedUnorderedContainerImpl {
 
     // MANIPULATORS
     void clear();
-        // Remove all elements from this striped hash map.  If rehash is in
-        // progress, block until it completes.
+        // Remove all elements from this striped hash map.
 
     void disableRehash();
         // Prevent rehash until the 'enableRehash' method is called.
@@ -707,6 +828,18 @@ class StripedUnorderedContainerImpl {
         // factor to its current value) will trigger a rehash if needed but
         // otherwise does not change the hash map.
 
+    void enableOptimisticRead(EpochManager *epochManager = 0);
+        // Allow 'getValue(VALUE *, const KEY&)' to read without locking the
+        // stripe of the key (see {Optimistic Reads}).  From this call on, the
+        // memory of erased elements is reclaimed, only after the optimistic
+        // readers that may access it have completed, by the optionally
+        // specified 'epochManager', or, if 'epochManager' is 0, by an epoch
+        // manager created by this object.  This operation has no effect if
+        // optimistic reads are already enabled, if 'VALUE' is not trivially
+        // copyable, or if optimistic reads are not supported by the platform.
+        // The behavior is undefined unless 'epochManager' is 0 or outlives
+        // this object.  Note that optimistic reads cannot be disabled.
+
     bsl::size_t eraseAll(const KEY& key);
         // Erase from this hash map the elements having the specified 'key'.
         // Return the number of elements erased.
@@ -804,7 +937,9 @@ class StripedUnorderedContainerImpl {
         // Recreate this hash map to one having at least the specified
         // 'numBuckets'.  This operation is a no-op if *any* of the following
         // are true: 1) rehash is disabled; 2) 'numBuckets' less or equals the
-        // current number of buckets.  See {Rehash}.
+        // current number of buckets.  The elements are migrated one stripe at
+        // a time, so that operations on other stripes are not blocked.  See
+        // {Rehash}.
 
     int setComputedValueAll(const KEY&             key,
                             const VisitorFunction& visitor);
@@ -951,10 +1086,12 @@ class StripedUnorderedContainerImpl {
         // Load, into the specified '*value', the value attribute of the first
         // element (of possibly many elements) found in this hash map having
         // the specified 'key'.  Return 1 on success, and 0 if 'key' does not
-        // exist in this hash.  Note that the return value equals the number of
-        // values returned.  Also note that, when there are multiple elements
-        // having 'key', the selection of "first" is implementation specific
-        // and subject to change.
+        // exist in this hash.  If optimistic reads are enabled, the stripe of
+        // 'key' is not locked unless a concurrent writer prevents a consistent
+        // read (see {Optimistic Reads}).  Note that the return value equals
+        // the number of values returned.  Also note that, when there are
+        // multiple elements having 'key', the selection of "first" is
+        // implementation specific and subject to change.
 
     bsl::size_t getValue(bsl::vector<VALUE> *valuesPtr, const KEY& key) const;
         // Load, into the specified '*valuesPtr', the value attributes of every
@@ -966,6 +1103,9 @@ class StripedUnorderedContainerImpl {
         // Return (a copy of) the unary hash functor used by this hash map to
         // generate a hash value (of type 'std::size_t') for a 'KEY' object.
 
+    bool isOptimisticReadEnabled() const;
+        // Return 'true' if optimistic reads are enabled, or 'false' otherwise.
+
     bool isRehashEnabled() const;
         // Return 'true' if rehash is enabled, or 'false' otherwise.
 
@@ -1049,7 +1189,11 @@ class StripedUnorderedContainerImpl_TestUtil {
                 // ===============================================
 
 class StripedUnorderedContainerImpl_LockElement {
-    // A mutex + support info; padded to cacheline size, one per stripe
+    // A mutex + support info; padded to cacheline size, one per stripe.  The
+    // support info consists of a sequence number, odd while the stripe is
+    // locked for write, that validates optimistic (unlocked) reads, and the
+    // generation of the array of buckets holding the elements of the stripe,
+    // that is incremented when the stripe is migrated by a rehash.
 
   private:
     // PRIVATE TYPES
@@ -1066,13 +1210,17 @@ class StripedUnorderedContainerImpl_LockElement {
         k_EFFECTIVE_CACHELINE_SIZE = (1 + k_PREFETCH_ENABLED) *
                                             bslmt::Platform::e_CACHE_LINE_SIZE,
         // Cacheline size to use; may be 1 or 2 cachelines
-        k_LOCK_PADDING = k_EFFECTIVE_CACHELINE_SIZE >= sizeof(LockType) ?
-                         k_EFFECTIVE_CACHELINE_SIZE -  sizeof(LockType) :
-                     2 * k_EFFECTIVE_CACHELINE_SIZE -  sizeof(LockType)
+        k_DATA_SIZE = sizeof(LockType) + 2 * sizeof(bsls::AtomicInt),
+        // Size of the data members
+        k_LOCK_PADDING = k_EFFECTIVE_CACHELINE_SIZE > k_DATA_SIZE ?
+                         k_EFFECTIVE_CACHELINE_SIZE -  k_DATA_SIZE :
+                     2 * k_EFFECTIVE_CACHELINE_SIZE -  k_DATA_SIZE
     };
 
     // DATA
     LockType        d_lock;
+    bsls::AtomicInt d_sequence;    // odd while locked for write
+    bsls::AtomicInt d_generation;  // generation of the stripe's buckets
     const char      d_pad[k_LOCK_PADDING];
 
   public:
@@ -1085,13 +1233,35 @@ class StripedUnorderedContainerImpl_LockElement {
         // Read lock the lock element.
 
     void lockW();
-        // Write lock the lock element.
+        // Write lock the lock element, and make the sequence number odd.
+
+    void setGeneration(int value);
+        // Set the generation of the stripe to the specified 'value'.  The
+        // behavior is undefined unless this lock element is write locked.
 
     void unlockR();
         // Read unlock the lock element.
 
     void unlockW();
-        // Write unlock the lock element.
+        // Make the sequence number even (and different from the value it had
+        // before 'lockW'), and write unlock the lock element.
+
+    // ACCESSORS
+    int generation() const;
+        // Return the generation of the stripe.  Note that, unless this lock
+        // element is locked, the value returned is valid only if a subsequent
+        // call to 'validate' succeeds.
+
+    int sequence() const;
+        // Return the sequence number of this lock element, to be passed to
+        // 'validate' after an optimistic read.  Note that the read must be
+        // abandoned if the value returned is odd.
+
+    bool validate(int sequenceNumber) const;
+        // Return 'true' if no writer has locked this lock element since the
+        // specified 'sequenceNumber' was returned by 'sequence', and 'false'
+        // otherwise.  Note that the reads performed before this call (and
+        // after 'sequence') are consistent if this method returns 'true'.
 };
 
 
@@ -1546,7 +1716,9 @@ bslma::Allocator *StripedUnorderedContainerImpl_Bucket<KEY, VALUE>::allocator()
 inline
 StripedUnorderedContainerImpl_LockElement::
                                     StripedUnorderedContainerImpl_LockElement()
-: d_pad()
+: d_sequence(0)
+, d_generation(0)
+, d_pad()
 {
     (void)d_pad;
 }
@@ -1562,6 +1734,22 @@ inline
 void StripedUnorderedContainerImpl_LockElement::lockW()
 {
     d_lock.lockWrite();
+
+    // Only the writer modifies 'd_sequence', so no atomic read-modify-write is
+    // needed.  The fence orders the modifications made while the lock is held
+    // after the (odd) sequence number, so that an optimistic reader observing
+    // any of them fails 'validate'.
+
+    d_sequence.storeRelaxed(d_sequence.loadRelaxed() + 1);
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    bsl::atomic_thread_fence(bsl::memory_order_release);
+#endif
+}
+
+inline
+void StripedUnorderedContainerImpl_LockElement::setGeneration(int value)
+{
+    d_generation.storeRelaxed(value);
 }
 
 inline
@@ -1573,9 +1761,33 @@ void StripedUnorderedContainerImpl_LockElement::unlockR()
 inline
 void StripedUnorderedContainerImpl_LockElement::unlockW()
 {
+    d_sequence.storeRelease(d_sequence.loadRelaxed() + 1);
     d_lock.unlockWrite();
 }
 
+// ACCESSORS
+inline
+int StripedUnorderedContainerImpl_LockElement::generation() const
+{
+    return d_generation.loadRelaxed();
+}
+
+inline
+int StripedUnorderedContainerImpl_LockElement::sequence() const
+{
+    return d_sequence.loadAcquire();
+}
+
+inline
+bool StripedUnorderedContainerImpl_LockElement::validate(
+                                                     int sequenceNumber) const
+{
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    bsl::atomic_thread_fence(bsl::memory_order_acquire);
+#endif
+    return sequenceNumber == d_sequence.loadRelaxed();
+}
+
          // --------------------------------------------------------
          // class StripedUnorderedContainerImpl_LockElementReadGuard
          // --------------------------------------------------------
@@ -1677,6 +1889,15 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::powerCeil(
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::BucketArray&
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketArray(
+                                                                int generation)
+{
+    return generation & 1 ? d_oddBuckets : d_evenBuckets;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
@@ -1693,28 +1914,65 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::checkRehash()
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clearBucket(
+                                                                Bucket *bucket)
+{
+    if (NULL == d_epochManager_p.loadRelaxed()) {
+        bucket->clear();
+        return;                                                       // RETURN
+    }
+
+    for (Node *curNode = bucket->head(); curNode != NULL;) {
+        Node *nextPtr = curNode->next();
+        deleteNode(curNode);
+        curNode = nextPtr;
+    }
+    bucket->setHead(NULL);
+    bucket->setTail(NULL);
+    bucket->setSize(0);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::deleteNode(
+                                                                    Node *node)
+{
+    // 'd_epochManager_p' is set with every stripe locked for write, so that a
+    // relaxed load suffices under the (write) lock of a stripe.
+
+    EpochManager *epochManager = d_epochManager_p.loadRelaxed();
+    if (epochManager) {
+        epochManager->retireObject(node, d_allocator_p);
+    }
+    else {
+        d_allocator_p->deleteObject(node);
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
                                                               const KEY& key,
                                                               Scope      scope)
 {
-    bool        eraseAll = scope == e_SCOPE_ALL;
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    bool      eraseAll = scope == e_SCOPE_ALL;
+    Bucket   *bucketPtr;
+    LEWGuard  guard(lockWrite(&bucketPtr, key));
 
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                          d_buckets[bucketIdx];
-
-    typedef StripedUnorderedContainerImpl_Node<KEY, VALUE> Node;
+    StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket = *bucketPtr;
 
     bsl::size_t count = 0;
 
     Node **prevNodeAddress = bucket.headAddress();
+    Node  *prevNode        = NULL;
     while (*prevNodeAddress) {
         if (d_comparator((*prevNodeAddress)->key(), key)) {
             Node *node = *prevNodeAddress;
             *prevNodeAddress = node->next();
-            d_allocator_p->deleteObject(node);
+            if (bucket.tail() == node) {
+                bucket.setTail(prevNode);
+            }
+            deleteNode(node);
             bucket.incrementSize(-1);
             d_numElements.addRelaxed(-1);
             ++count;
@@ -1723,7 +1981,8 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::erase(
             }
         }
         else {
-            prevNodeAddress = (*prevNodeAddress)->nextAddress();
+            prevNode        = *prevNodeAddress;
+            prevNodeAddress = prevNode->nextAddress();
         }
     }
     return count;
@@ -1747,10 +2006,8 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
                         sortIdxs(dataSize, bslma::Default::defaultAllocator());
     for (int i = 0; i < dataSize; ++i) {
         sortIdxs[i].d_hashVal   = d_hasher(first[i]);
-        bsl::size_t bucketIdx   =
-            bslalg::HashTableImpUtil::computeBucketIndex(sortIdxs[i].d_hashVal,
-                                                         d_numBuckets);
-        sortIdxs[i].d_stripeIdx = static_cast<int>(bucketToStripe(bucketIdx));
+        sortIdxs[i].d_stripeIdx =
+                      static_cast<int>(bucketToStripe(sortIdxs[i].d_hashVal));
         sortIdxs[i].d_dataIdx   = i;
     }
     // Sort it by stripe, and location
@@ -1764,51 +2021,32 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
         LockElement& lockElement = d_locks_p[curStripeIdx];
         lockElement.lockW();
         LEWGuard guard(&lockElement);
+
+        // The stripe may have been migrated by a rehash before it was locked.
+        BucketArray& buckets = bucketArray(lockElement.generation());
         for (; j < dataSize && sortIdxs[j].d_stripeIdx == curStripeIdx; ++j) {
             int          dataIdx   = sortIdxs[j].d_dataIdx;
             bsl::size_t  bucketIdx =
                 bslalg::HashTableImpUtil::computeBucketIndex(
                                                          sortIdxs[j].d_hashVal,
-                                                         d_numBuckets);
+                                                         buckets.size());
 
             StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                          d_buckets[bucketIdx];
-            if (bucket.head() == NULL) {
-                continue;
-            }
+                                                            buckets[bucketIdx];
 
             const KEY&   key   = first[dataIdx];
 
-            bool continueFlag = false;
-            while (d_comparator(bucket.head()->key(), key)) {
-                StripedUnorderedContainerImpl_Node<KEY, VALUE> *nextNode =
-                                                         bucket.head()->next();
-                d_allocator_p->deleteObject(bucket.head());
-                bucket.setHead(nextNode);
-                bucket.incrementSize(-1);
-                ++count;
-                d_numElements.addRelaxed(-1);
-                if (false == eraseAll || bucket.head() == NULL) {
-                    continueFlag = true;
-                    break;
-                }
-            }
-            if (continueFlag) {
-                continue;
-            }
             // Loop on the elements in the list
-            StripedUnorderedContainerImpl_Node<KEY, VALUE> *prevNode =
-                                                                 bucket.head();
-            StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
-                                                         bucket.head()->next();
-            if (curNode == NULL) {
-                continue;
-            }
-            for (; curNode->next() != NULL;
-                               prevNode = curNode, curNode = curNode->next()) {
+            Node **prevNodeAddress = bucket.headAddress();
+            Node  *prevNode        = NULL;
+            while (*prevNodeAddress) {
+                Node *curNode = *prevNodeAddress;
                 if (d_comparator(curNode->key(), key)) {
-                    prevNode->setNext(curNode->next());
-                    d_allocator_p->deleteObject(curNode);
+                    *prevNodeAddress = curNode->next();
+                    if (bucket.tail() == curNode) {
+                        bucket.setTail(prevNode);
+                    }
+                    deleteNode(curNode);
                     bucket.incrementSize(-1);
                     ++count;
                     d_numElements.addRelaxed(-1);
@@ -1816,6 +2054,10 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::eraseBulk(
                         break;
                     }
                 }
+                else {
+                    prevNode        = curNode;
+                    prevNodeAddress = curNode->nextAddress();
+                }
             }
         }
     }
@@ -1832,8 +2074,8 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
 {
     bool insertAlways = multiplicity == e_INSERT_ALWAYS;
 
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    Bucket   *bucket;
+    LEWGuard  guard(lockWrite(&bucket, key));
 
     bsl::size_t ret = 0;
     if (insertAlways) {
@@ -1843,11 +2085,11 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
                                                                 value,
                                                                 NULL,
                                                                 d_allocator_p);
-        d_buckets[bucketIdx].addNode(node);
+        bucket->addNode(node);
     }
     else {
         // Update only the first value if key exists.  Use only in hash map.
-        ret = d_buckets[bucketIdx].setValue(
+        ret = bucket->setValue(
         key,
         d_comparator,
         value,
@@ -1871,22 +2113,21 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insert(
 {
     bool insertAlways = multiplicity == e_INSERT_ALWAYS;
 
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    Bucket   *bucket;
+    LEWGuard  guard(lockWrite(&bucket, key));
 
     bsl::size_t ret = 0;
     if (insertAlways) {
         // Insert, ignoring an existing value if any.  Use only in multimap.
         Node *node = new (*d_allocator_p)
             Node(key, bslmf::MovableRefUtil::move(value), NULL, d_allocator_p);
-        d_buckets[bucketIdx].addNode(node);
+        bucket->addNode(node);
     }
     else {
         // Update only the first value if key exists.  Use only in hash map.
-        ret = d_buckets[bucketIdx].setValue(
-                                           key,
-                                           d_comparator,
-                                           bslmf::MovableRefUtil::move(value));
+        ret = bucket->setValue(key,
+                               d_comparator,
+                               bslmf::MovableRefUtil::move(value));
     }
     if (ret == 1) {
         return 0;                                                     // RETURN
@@ -1916,10 +2157,8 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
     // For each key, store in a vector its stripe, location, and hash value.
     for (int i = 0; i < dataSize; ++i) {
         sortIdxs[i].d_hashVal   = d_hasher(first[i].first);
-        bsl::size_t bucketIdx =
-           bslalg::HashTableImpUtil::computeBucketIndex(sortIdxs[i].d_hashVal,
-                                                        d_numBuckets);
-        sortIdxs[i].d_stripeIdx = static_cast<int>(bucketToStripe(bucketIdx));
+        sortIdxs[i].d_stripeIdx =
+                      static_cast<int>(bucketToStripe(sortIdxs[i].d_hashVal));
         sortIdxs[i].d_dataIdx   = i;
     }
     // Sort it by stripe, and location
@@ -1933,12 +2172,15 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
         LockElement& lockElement = d_locks_p[curStripeIdx];
         lockElement.lockW();
         LEWGuard guard(&lockElement);
+
+        // The stripe may have been migrated by a rehash before it was locked.
+        BucketArray& buckets = bucketArray(lockElement.generation());
         for (; j < dataSize && sortIdxs[j].d_stripeIdx == curStripeIdx; ++j) {
             int          dataIdx   = sortIdxs[j].d_dataIdx;
             bsl::size_t  bucketIdx =
                 bslalg::HashTableImpUtil::computeBucketIndex(
                                                          sortIdxs[j].d_hashVal,
-                                                         d_numBuckets);
+                                                         buckets.size());
             const KEY&   key   = first[dataIdx].first;
             const VALUE& value = first[dataIdx].second;
 
@@ -1952,11 +2194,11 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::insertBulk(
                                                                 value,
                                                                 NULL,
                                                                 d_allocator_p);
-                d_buckets[bucketIdx].addNode(node);
+                buckets[bucketIdx].addNode(node);
                 ++count;
                 d_numElements.addRelaxed(1);
             } else {
-                bsl::size_t ret = d_buckets[bucketIdx].setValue(
+                bsl::size_t ret = buckets[bucketIdx].setValue(
                     key,
                     d_comparator,
                     value,
@@ -1984,11 +2226,10 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setComputedValue(
                                             ? BucketClass::e_BUCKETSCOPE_ALL
                                             : BucketClass::e_BUCKETSCOPE_FIRST;
 
-    bsl::size_t                bucketIdx;
-    LEWGuard                   guard(lockWrite(&bucketIdx, key));
+    Bucket                    *bucketPtr;
+    LEWGuard                   guard(lockWrite(&bucketPtr, key));
 
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = *bucketPtr;
     // Loop on the elements in the list
     int                                             count = 0;
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode = bucket.head();
@@ -2046,11 +2287,10 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
                                             ? BucketClass::e_BUCKETSCOPE_ALL
                                             : BucketClass::e_BUCKETSCOPE_FIRST;
 
-    bsl::size_t                bucketIdx;
-    LEWGuard                   guard(lockWrite(&bucketIdx, key));
+    Bucket                    *bucketPtr;
+    LEWGuard                   guard(lockWrite(&bucketPtr, key));
 
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = *bucketPtr;
 
     bsl::size_t count = bucket.setValue(key, d_comparator, value, setAll);
     if (count == 0) {
@@ -2062,6 +2302,16 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValue(
 }
 
 // PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const typename StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                                                                   BucketArray&
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketArray(
+                                                          int generation) const
+{
+    return generation & 1 ? d_oddBuckets : d_evenBuckets;
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t
@@ -2088,23 +2338,20 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 StripedUnorderedContainerImpl_LockElement *
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockRead(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
-{
-    // From key, get hash value, and current number of buckets.
-    bsl::size_t  hashVal    = d_hasher(key);
-    bsl::size_t  numBuckets = d_numBuckets;
-    bsl::size_t  bucketIndex  =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    bsl::size_t  stripeIdx = bucketToStripe(bucketIndex);
-    LockElement& lockElement = d_locks_p[stripeIdx];
+                                                    const Bucket **bucket,
+                                                    const KEY&     key) const
+{
+    // The stripe depends only on the hash value, hence it is not affected by
+    // a concurrent rehash.  The array of buckets of the stripe is selected
+    // once the stripe is locked.
+    bsl::size_t  hashVal     = d_hasher(key);
+    LockElement& lockElement = d_locks_p[bucketToStripe(hashVal)];
     lockElement.lockR();
-    // When we get the lock, did the number of buckets change?
-    if (numBuckets != d_numBuckets) {
-        bucketIndex =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    }
-    *bucketIdx = bucketIndex;
+
+    const BucketArray& buckets = bucketArray(lockElement.generation());
+    *bucket = &buckets[bslalg::HashTableImpUtil::computeBucketIndex(
+                                                              hashVal,
+                                                              buckets.size())];
     return &lockElement;
 }
 
@@ -2112,27 +2359,107 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 StripedUnorderedContainerImpl_LockElement *
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::lockWrite(
-                                                       bsl::size_t  *bucketIdx,
-                                                       const KEY&    key) const
-{
-    // From key, get hash value, and current number of buckets.
-    bsl::size_t  hashVal      = d_hasher(key);
-    bsl::size_t  numBuckets   = d_numBuckets;
-    bsl::size_t  bucketIndex  =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    bsl::size_t  stripeIdx   = bucketToStripe(bucketIndex);
-    LockElement& lockElement = d_locks_p[stripeIdx];
+                                                          Bucket     **bucket,
+                                                          const KEY&   key)
+{
+    // The stripe depends only on the hash value, hence it is not affected by
+    // a concurrent rehash.  The array of buckets of the stripe is selected
+    // once the stripe is locked.
+    bsl::size_t  hashVal     = d_hasher(key);
+    LockElement& lockElement = d_locks_p[bucketToStripe(hashVal)];
     lockElement.lockW();
 
-    // When we get the lock, did the number of buckets change?
-    if (numBuckets != d_numBuckets) {
-        bucketIndex =
-           bslalg::HashTableImpUtil::computeBucketIndex(hashVal, d_numBuckets);
-    }
-    *bucketIdx = bucketIndex;
+    BucketArray& buckets = bucketArray(lockElement.generation());
+    *bucket = &buckets[bslalg::HashTableImpUtil::computeBucketIndex(
+                                                              hashVal,
+                                                              buckets.size())];
     return &lockElement;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                                 bsl::size_t    *numFound,
+                                                 VALUE          *value,
+                                                 const KEY&      key,
+                                                 bsl::true_type) const
+{
+    // Pin the current epoch, so that the nodes and the arrays of buckets that
+    // are reachable now are not reclaimed before this read completes, even
+    // if a writer concurrently retires them.
+
+    EpochGuard epochGuard(d_epochManager_p.loadRelaxed());
+
+    bsl::size_t        hashVal     = d_hasher(key);
+    const LockElement& lockElement = d_locks_p[bucketToStripe(hashVal)];
+
+    for (int attempt = 0; attempt < k_MAX_OPTIMISTIC_READS; ++attempt) {
+        int sequenceNumber = lockElement.sequence();
+        if (sequenceNumber & 1) {
+            continue;  // A writer holds the stripe.
+        }
+
+        // Each address is validated before it is dereferenced: once the
+        // sequence number is found unchanged, the address was read while no
+        // writer held the stripe, and therefore refers to a fully constructed
+        // bucket or node.
+
+        const BucketArray& buckets    = bucketArray(lockElement.generation());
+        const Bucket      *data       = buckets.data();
+        bsl::size_t        numBuckets = buckets.size();
+        if (!lockElement.validate(sequenceNumber) || 0 == numBuckets) {
+            continue;
+        }
+
+        const Node *curNode =
+            data[bslalg::HashTableImpUtil::computeBucketIndex(hashVal,
+                                                              numBuckets)]
+                                                                       .head();
+        bsls::ObjectBuffer<VALUE> buffer;
+        bsl::size_t               count = 0;
+        bool                      valid = true;
+        for (;;) {
+            if (!lockElement.validate(sequenceNumber)) {
+                valid = false;
+                break;
+            }
+            if (NULL == curNode) {
+                break;
+            }
+            if (d_comparator(curNode->key(), key)) {
+                bsl::memcpy(buffer.buffer(),
+                            static_cast<const void *>(&curNode->value()),
+                            sizeof(VALUE));
+                count = 1;
+                break;
+            }
+            curNode = curNode->next();
+        }
+
+        // The copy of the value is consistent only if no writer locked the
+        // stripe while it was being made.
+
+        if (valid && lockElement.validate(sequenceNumber)) {
+            if (count) {
+                *value = buffer.object();
+            }
+            *numFound = count;
+            return 0;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                                 bsl::size_t    *,
+                                                 VALUE          *,
+                                                 const KEY&      ,
+                                                 bsl::false_type) const
+{
+    return -1;
+}
+
 // CREATORS
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
@@ -2149,7 +2476,11 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
 , d_comparator()
 , d_statePad()
 , d_numElementsPad()
-, d_buckets(d_numBuckets, basicAllocator)
+, d_evenBuckets(d_numBuckets, basicAllocator)
+, d_oddBuckets(basicAllocator)
+, d_generation(0)
+, d_epochManager_p(0)
+, d_ownsEpochManager(false)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     d_state       = k_REHASH_ENABLED; // Rehash enabled, not in progress
@@ -2168,6 +2499,16 @@ inline
 StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
                                                ~StripedUnorderedContainerImpl()
 {
+    // Destroying the epoch manager reclaims the retired nodes and arrays of
+    // buckets; a shared epoch manager reclaims them once no reader refers to
+    // them.
+    EpochManager *epochManager = d_epochManager_p.loadRelaxed();
+    if (d_ownsEpochManager) {
+        d_allocator_p->deleteObject(epochManager);
+    }
+    else if (epochManager) {
+        epochManager->reclaim();
+    }
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         bslma::DestructionUtil::destroy(&d_locks_p[i]);
     }
@@ -2179,12 +2520,16 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::clear()
 {
-    // Locking all stripes will inherently block until a rehash will complete
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
     }
-    for (bsl::size_t j = 0; j < d_numBuckets; ++j) {
-        d_buckets[j].clear();
+    // A concurrent rehash may have migrated some of the stripes, so each
+    // stripe is cleared in its own array of buckets.
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        BucketArray& buckets = bucketArray(d_locks_p[i].generation());
+        for (bsl::size_t j = i; j < buckets.size(); j += d_numStripes) {
+            clearBucket(&buckets[j]);
+        }
     }
     d_numElements = 0;
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
@@ -2205,6 +2550,43 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::disableRehash()
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void
+StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::enableOptimisticRead(
+                                                    EpochManager *epochManager)
+{
+    if (!OptimisticReadSupported::value || d_epochManager_p.loadAcquire()) {
+        return;                                                       // RETURN
+    }
+
+    EpochManager *ownedEpochManager = NULL;
+    if (!epochManager) {
+        ownedEpochManager = new (*d_allocator_p) EpochManager(d_allocator_p);
+        epochManager      = ownedEpochManager;
+    }
+
+    // Install the epoch manager with every stripe locked for write, so that a
+    // writer either completes before optimistic reads are enabled, or
+    // observes the epoch manager and retires (instead of deleting) the nodes
+    // it erases.
+
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].lockW();
+    }
+    if (NULL == d_epochManager_p.loadRelaxed()) {
+        d_ownsEpochManager = NULL != ownedEpochManager;
+        d_epochManager_p.storeRelease(epochManager);
+        ownedEpochManager  = NULL;
+    }
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        d_locks_p[i].unlockW();
+    }
+
+    if (ownedEpochManager) {  // Another thread enabled optimistic reads first.
+        d_allocator_p->deleteObject(ownedEpochManager);
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::enableRehash()
@@ -2363,21 +2745,31 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
         return;                                                       // RETURN
     }
 
-    // Allocate a new data vector
-    bsl::vector<StripedUnorderedContainerImpl_Bucket<KEY,VALUE> > newBuckets(
-                                                                numBuckets,
-                                                                d_allocator_p);
+    // Allocate the new array of buckets, of the next generation.  No stripe
+    // refers to that generation yet, hence no other thread accesses the array.
+    int          oldGeneration = d_generation;
+    int          newGeneration = oldGeneration + 1;
+    BucketArray& oldBuckets    = bucketArray(oldGeneration);
+    BucketArray& newBuckets    = bucketArray(newGeneration);
+    {
+        BucketArray buckets(numBuckets, d_allocator_p);
+        newBuckets.swap(buckets);
+    }
 
-    // Main loop on stripes: lock a stripe and process all buckets in it
+    // Main loop on stripes: lock a stripe, migrate all buckets in it to the
+    // new array of buckets, and unlock it.  Once a stripe is unlocked,
+    // operations on it use the new array of buckets, while the stripes that
+    // are not yet migrated remain fully available in the old one.
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
-        d_locks_p[i].lockW();
+        LockElement& lockElement = d_locks_p[i];
+        lockElement.lockW();
         // Loop on the buckets of the current stripe.  This is simple, as the
         // stripe is the last bits in a bucket index.  We start with the
         // current stripe as the first bucket, and add 'd_numStripes' for the
         // next bucket, until 'd_numBuckets'.
-        for (bsl::size_t j = i; j < d_numBuckets; j += d_numStripes) {
+        for (bsl::size_t j = i; j < oldBuckets.size(); j += d_numStripes) {
             StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                                  d_buckets[j];
+                                                                 oldBuckets[j];
             // Process the nodes in the bucket.  Note that we do not need to
             // delete the old node and allocate a new one, but can simply move
             // it.
@@ -2396,17 +2788,26 @@ void StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::rehash(
             bucket.setTail(NULL);
             bucket.setSize(0);
         }
+        lockElement.setGeneration(newGeneration);
+        lockElement.unlockW();
     }
-    // Swap 'newBuckets' and 'd_buckets'.  This requires the same allocator.
-    d_buckets.swap(newBuckets);
 
-    // Update number of buckets.
-    d_numBuckets = numBuckets;
+    // Every stripe is migrated; update number of buckets.
+    d_numBuckets  = numBuckets;
+    d_generation  = newGeneration;
 
-    // Unlock all stripes.  This could not be done on the spot, as we store the
-    /// rehashed data in a new set of buckets.
-    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
-        d_locks_p[i].unlockW();
+    // Release the (now empty) old array of buckets.  No stripe refers to it
+    // anymore, but an optimistic reader may still be accessing it.
+    EpochManager *epochManager = d_epochManager_p.loadAcquire();
+    if (epochManager) {
+        BucketArray *retired = new (*d_allocator_p) BucketArray(
+                                                                d_allocator_p);
+        retired->swap(oldBuckets);
+        epochManager->retireObject(retired, d_allocator_p);
+    }
+    else {
+        BucketArray buckets(d_allocator_p);
+        oldBuckets.swap(buckets);
     }
 
     // Rehash no longer in progress
@@ -2460,11 +2861,10 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::setValueFirst(
                                                 const KEY&               key,
                                                 bslmf::MovableRef<VALUE> value)
 {
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    Bucket   *bucketPtr;
+    LEWGuard  guard(lockWrite(&bucketPtr, key));
 
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = *bucketPtr;
 
     bsl::size_t count = bucket.setValue(key,
                                         d_comparator,
@@ -2483,11 +2883,10 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::update(
                                                 const KEY&             key,
                                                 const VisitorFunction& visitor)
 {
-    bsl::size_t bucketIdx;
-    LEWGuard    guard(lockWrite(&bucketIdx, key));
+    Bucket   *bucketPtr;
+    LEWGuard  guard(lockWrite(&bucketPtr, key));
 
-    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
-                                                          d_buckets[bucketIdx];
+    StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = *bucketPtr;
 
     // Loop on the elements in the list
     int                                             count = 0;
@@ -2512,13 +2911,14 @@ int StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::visit(
     int count = 0;
     for (bsl::size_t i = 0; i < d_numStripes; ++i) {
         d_locks_p[i].lockW();
+        BucketArray& buckets = bucketArray(d_locks_p[i].generation());
         // Loop on the buckets of the current stripe.  This is simple, as the
         // stripe is the last bits in a bucket index.  We start with the
         // current stripe as the first bucket, and add 'd_numStripes' for the
-        // next bucket, until 'd_numBuckets'.
-        for (bsl::size_t j = i; j < d_numBuckets; j += d_numStripes) {
+        // next bucket, until the number of buckets.
+        for (bsl::size_t j = i; j < buckets.size(); j += d_numStripes) {
             StripedUnorderedContainerImpl_Bucket<KEY, VALUE> &bucket =
-                                                                  d_buckets[j];
+                                                                    buckets[j];
             // Loop on the nodes in the bucket.
             for (StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode =
                                                 bucket.head(); curNode != NULL;
@@ -2562,7 +2962,14 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::bucketSize(
     BSLS_ASSERT(0 <= index);
     BSLS_ASSERT(index < bucketCount());
 
-    return d_buckets[index].size();
+    // During a rehash, the stripe of 'index' may already have been migrated
+    // to an array of buckets of a different size.
+    LockElement& lockElement = d_locks_p[bucketToStripe(index)];
+    lockElement.lockR();
+    LERGuard guard(&lockElement);
+
+    const BucketArray& buckets = bucketArray(lockElement.generation());
+    return index < buckets.size() ? buckets[index].size() : 0;
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -2576,9 +2983,16 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::empty() const
 {
-    for (bsl::size_t i = 0; i < d_numBuckets; ++i) {
-        if (!d_buckets[i].empty()) {
-            return false;                                             // RETURN
+    for (bsl::size_t i = 0; i < d_numStripes; ++i) {
+        LockElement& lockElement = d_locks_p[i];
+        lockElement.lockR();
+        LERGuard guard(&lockElement);
+
+        const BucketArray& buckets = bucketArray(lockElement.generation());
+        for (bsl::size_t j = i; j < buckets.size(); j += d_numStripes) {
+            if (!buckets[j].empty()) {
+                return false;                                         // RETURN
+            }
         }
     }
     return true;
@@ -2600,11 +3014,21 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
 {
     BSLS_ASSERT(NULL != value);
 
-    bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    if (d_epochManager_p.loadAcquire()) {
+        bsl::size_t numFound;
+        if (0 == tryGetValue(&numFound,
+                             value,
+                             key,
+                             OptimisticReadSupported())) {
+            return numFound;                                          // RETURN
+        }
+    }
+
+    const Bucket *bucketPtr;
+    LERGuard      guard(lockRead(&bucketPtr, key));
 
-    const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = d_buckets[
-                                                                    bucketIdx];
+    const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
+                                                                    *bucketPtr;
     // Loop on the elements in the list
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode  = bucket.head();
     for (; curNode != NULL; curNode = curNode->next()) {
@@ -2626,12 +3050,12 @@ bsl::size_t StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::getValue(
 
     valuesPtr->clear();
 
-    bsl::size_t bucketIdx;
-    LERGuard    guard(lockRead(&bucketIdx, key));
+    const Bucket *bucketPtr;
+    LERGuard      guard(lockRead(&bucketPtr, key));
 
     bsl::size_t                                             count  = 0;
-    const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket = d_buckets[
-                                                                    bucketIdx];
+    const StripedUnorderedContainerImpl_Bucket<KEY, VALUE>& bucket =
+                                                                    *bucketPtr;
     // Loop on the elements in the list
     StripedUnorderedContainerImpl_Node<KEY, VALUE> *curNode  = bucket.head();
     for (; curNode != NULL; curNode = curNode->next()) {
@@ -2651,6 +3075,14 @@ StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::hashFunction() const
     return d_hasher;
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool StripedUnorderedContainerImpl<KEY, VALUE, HASH, EQUAL>::
+                                                isOptimisticReadEnabled() const
+{
+    return NULL != d_epochManager_p.loadAcquire();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool
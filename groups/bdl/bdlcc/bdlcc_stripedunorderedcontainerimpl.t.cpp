@@ -39,6 +39,7 @@
 
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
+#include <bsls_libraryfeatures.h>
 #include <bsls_nameof.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>     // 'BloombergLP::bsls::Types::Int64'
@@ -84,8 +85,9 @@ using namespace bsl;
 // defined in the 'BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR' macro and
 // other types in special cases.
 //
-// Single-threaded behavior is tested in test cases [1 .. 18].  Multi-threaded
-// issues are addressed in test cases [19 .. 21].  Two techniques are used:
+// Single-threaded behavior is tested in test cases [1 .. 18] and [22].
+// Multi-threaded issues are addressed in test cases [19 .. 21] and [23].  Two
+// techniques are used:
 //
 //: 1 The component defines a component "private" class, a 'friend' of the hash
 //:   map, that allows users to explicitly lock and unlock specified stripes.
@@ -111,6 +113,7 @@ using namespace bsl;
 // MANIPULATORS
 // [ 9] void clear();
 // [15] void disableRehash();
+// [22] void enableOptimisticRead(EpochManager *epochManager = 0);
 // [15] void enableRehash();
 // [ 7] bsl::size_t eraseAll(const KEY& key);
 // [ 7] bsl::size_t eraseFirst(const KEY& key);
@@ -142,6 +145,7 @@ using namespace bsl;
 // [ 5] bsl::size_t getValue(VALUE *value, const KEY& key) const;
 // [ 6] bsl::size_t getValue(*valuesVector, const KEY& key) const;
 // [ 4] HASH hashFunction() const;
+// [22] bool isOptimisticReadEnabled() const;
 // [15] bool isRehashEnabled() const;
 // [15] float loadFactor() const;
 // [15] float maxLoadFactor() const;
@@ -155,6 +159,7 @@ using namespace bsl;
 // [19] LOCKING TEST UTIL
 // [20] LOCKING
 // [21] MULTI-THREADED STRESS TEST
+// [23] MULTI-THREADED OPTIMISTIC READ STRESS TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -7607,6 +7612,372 @@ void TestDriver<KEY, VALUE, HASH, EQUAL>::testCase1()
 
 }  // close unnamed namespace
 
+namespace optimisticRead {
+
+typedef bdlcc::StripedUnorderedContainerImpl<int, int> Obj;
+
+const int k_NUM_ITEMS = 256;
+
+struct ThreadArg {
+    Obj             *d_obj_p;
+    bsls::AtomicInt *d_stop_p;
+    bsls::AtomicInt *d_numFound_p;
+    int              d_workerId;
+    int              d_numWorkers;
+};
+
+extern "C" void *readerThread(void *v_arg)
+    // Repeatedly look up random keys in the hash map of the specified 'v_arg'
+    // until told to stop, and verify that every value found is one that a
+    // writer stored for the key.
+{
+    ThreadArg *arg  = static_cast<ThreadArg *>(v_arg);
+    int        seed = arg->d_workerId;
+
+    while (0 == *arg->d_stop_p) {
+        int key   = bdlb::Random::generate15(&seed) % k_NUM_ITEMS;
+        int value = -1;
+
+        bsl::size_t rc = arg->d_obj_p->getValue(&value, key);
+
+        ASSERTV(rc, 0 == rc || 1 == rc);
+        if (1 == rc) {
+            ASSERTV(key, value, key == value % k_NUM_ITEMS);
+            ++*arg->d_numFound_p;
+        }
+    }
+    return v_arg;
+}
+
+extern "C" void *writerThread(void *v_arg)
+    // Repeatedly insert, update, and erase the keys owned by the worker of the
+    // specified 'v_arg' until told to stop.  Every value stored for a key 'K'
+    // is congruent to 'K' modulo 'k_NUM_ITEMS'.
+{
+    ThreadArg *arg  = static_cast<ThreadArg *>(v_arg);
+    int        seed = arg->d_workerId;
+
+    while (0 == *arg->d_stop_p) {
+        int key = bdlb::Random::generate15(&seed) % k_NUM_ITEMS;
+        if (key % arg->d_numWorkers != arg->d_workerId) {
+            continue;
+        }
+        int value;
+        if (1 != arg->d_obj_p->getValue(&value, key)) {
+            arg->d_obj_p->insertUnique(key, key);
+        }
+        else if (0 == bdlb::Random::generate15(&seed) % 8) {
+            ASSERTV(key, 1 == arg->d_obj_p->eraseFirst(key));
+        }
+        else {
+            arg->d_obj_p->setValueFirst(key, value + k_NUM_ITEMS);
+        }
+    }
+    return v_arg;
+}
+
+extern "C" void *rehashThread(void *v_arg)
+    // Alternately grow and shrink the number of buckets of the hash map of the
+    // specified 'v_arg' until told to stop.
+{
+    ThreadArg *arg = static_cast<ThreadArg *>(v_arg);
+
+    for (int i = 0; 0 == *arg->d_stop_p; ++i) {
+        arg->d_obj_p->rehash(i % 2 ? 16 : 1024);
+        bslmt::ThreadUtil::yield();
+    }
+    return v_arg;
+}
+
+void testOptimisticRead()
+{
+    // ------------------------------------------------------------------------
+    // OPTIMISTIC READS
+    //
+    // Concerns:
+    //: 1 Optimistic reads are disabled by default, and 'enableOptimisticRead'
+    //:   enables them exactly once, and only for a trivially copyable 'VALUE'.
+    //:
+    //: 2 With optimistic reads enabled, 'getValue' returns the same results
+    //:   as without, for present and absent keys, after updates, erasures,
+    //:   and a rehash in either direction.
+    //:
+    //: 3 Nodes and arrays of buckets retired while optimistic reads are
+    //:   enabled are reclaimed, and all memory comes from the allocator
+    //:   supplied at construction.
+    //:
+    //: 4 Several hash maps can share an epoch manager supplied to
+    //:   'enableOptimisticRead', which they do not destroy, and which
+    //:   reclaims their retired nodes and arrays of buckets.
+    //
+    // Plan:
+    //: 1 Check 'isOptimisticReadEnabled' before and after (repeated) calls to
+    //:   'enableOptimisticRead', for 'int' and 'bsl::string' values.  (C-1)
+    //:
+    //: 2 Populate a hash map, enable optimistic reads, and verify the value of
+    //:   each key after each manipulator of the hash map.  (C-2)
+    //:
+    //: 3 Use test allocators to verify that memory is returned on destruction
+    //:   and that the default allocator is not used.  (C-3)
+    //:
+    //: 4 Enable optimistic reads on two hash maps with one epoch manager,
+    //:   erase elements and rehash both hash maps, and verify their values.
+    //:   Destroy the hash maps, verify that the epoch manager is still
+    //:   usable, and that all memory is returned once it is destroyed.  (C-4)
+    //
+    // Testing:
+    //   void enableOptimisticRead(EpochManager *epochManager = 0);
+    //   bool isOptimisticReadEnabled() const;
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "OPTIMISTIC READS" << endl
+                      << "----------------" << endl;
+
+    bslma::TestAllocator        supplied("supplied", veryVeryVeryVerbose);
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    if (verbose) cout << "Enable optimistic reads." << endl;
+    {
+        bdlcc::StripedUnorderedContainerImpl<int, bsl::string> mX(16,
+                                                                  4,
+                                                                  &supplied);
+        ASSERT(false == mX.isOptimisticReadEnabled());
+        mX.enableOptimisticRead();
+        ASSERT(false == mX.isOptimisticReadEnabled());
+    }
+    {
+        Obj mX(16, 4, &supplied);  const Obj& X = mX;
+        ASSERT(false == X.isOptimisticReadEnabled());
+
+        mX.enableOptimisticRead();
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+        ASSERT(true  == X.isOptimisticReadEnabled());
+#endif
+
+        bsls::Types::Int64 numBlocks = supplied.numBlocksInUse();
+        mX.enableOptimisticRead();
+        ASSERTV(numBlocks, supplied.numBlocksInUse(),
+                numBlocks == supplied.numBlocksInUse());
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+
+    if (verbose) cout << "Read after each manipulator." << endl;
+    {
+        const int k_NUM_KEYS = 100;
+
+        Obj mX(4, 4, &supplied);  const Obj& X = mX;
+        mX.disableRehash();
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            ASSERTV(i, 1 == mX.insertUnique(i, 3 * i));
+        }
+        mX.enableOptimisticRead();
+
+        for (int i = 0; i < 2 * k_NUM_KEYS; ++i) {
+            int         value = -1;
+            bsl::size_t rc    = X.getValue(&value, i);
+            if (i < k_NUM_KEYS) {
+                ASSERTV(i, rc,    1     == rc);
+                ASSERTV(i, value, 3 * i == value);
+            }
+            else {
+                ASSERTV(i, rc,    0  == rc);
+                ASSERTV(i, value, -1 == value);
+            }
+        }
+
+        for (int i = 0; i < k_NUM_KEYS; i += 2) {
+            ASSERTV(i, 1 == mX.setValueFirst(i, 5 * i));
+        }
+        for (int i = 0; i < k_NUM_KEYS; i += 3) {
+            ASSERTV(i, 1 == mX.eraseFirst(i));
+        }
+
+        mX.enableRehash();
+        const bsl::size_t NUM_BUCKETS[] = { 256, 8, 64 };
+        for (bsl::size_t j = 0; j < sizeof NUM_BUCKETS / sizeof *NUM_BUCKETS;
+                                                                         ++j) {
+            mX.rehash(NUM_BUCKETS[j]);
+            ASSERTV(j, X.bucketCount(), NUM_BUCKETS[j] == X.bucketCount());
+
+            bsl::size_t total = 0;
+            for (bsl::size_t k = 0; k < X.bucketCount(); ++k) {
+                total += X.bucketSize(k);
+            }
+            ASSERTV(j, total, X.size(), total == X.size());
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                int         value = -1;
+                bsl::size_t rc    = X.getValue(&value, i);
+                if (0 == i % 3) {
+                    ASSERTV(j, i, rc, 0 == rc);
+                }
+                else {
+                    ASSERTV(j, i, rc,    1 == rc);
+                    ASSERTV(j, i, value, (i % 2 ? 3 : 5) * i == value);
+                }
+            }
+        }
+
+        mX.insertAlways(1, 7);
+        int value;
+        ASSERT(1 == X.getValue(&value, 1));
+        ASSERTV(value, 3 == value);
+
+        mX.clear();
+        ASSERT(X.empty());
+        ASSERT(0 == X.getValue(&value, 1));
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+
+    if (verbose) cout << "Share an epoch manager." << endl;
+    {
+        bslma::TestAllocator ea("epoch", veryVeryVeryVerbose);
+        {
+            bdlcc::EpochManager manager(&ea);
+            {
+                const int k_NUM_KEYS = 64;
+
+                Obj mX(4, 4, &supplied);  const Obj& X = mX;
+                Obj mY(4, 4, &supplied);  const Obj& Y = mY;
+
+                mX.enableOptimisticRead(&manager);
+                mY.enableOptimisticRead(&manager);
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+                ASSERT(true == X.isOptimisticReadEnabled());
+                ASSERT(true == Y.isOptimisticReadEnabled());
+#endif
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    ASSERTV(i, 1 == mX.insertUnique(i, i));
+                    ASSERTV(i, 1 == mY.insertUnique(i, -i));
+                }
+                for (int i = 0; i < k_NUM_KEYS; i += 2) {
+                    ASSERTV(i, 1 == mX.eraseFirst(i));
+                    ASSERTV(i, 1 == mY.eraseFirst(i + 1));
+                }
+                mX.rehash(256);
+                mY.rehash(256);
+
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    int value = 0;
+                    ASSERTV(i, (i % 2) == int(X.getValue(&value, i)));
+                    if (i % 2) {
+                        ASSERTV(i, value, i == value);
+                    }
+                    ASSERTV(i, int(0 == i % 2) == int(Y.getValue(&value, i)));
+                    if (!(i % 2)) {
+                        ASSERTV(i, value, -i == value);
+                    }
+                }
+            }
+
+            // The epoch manager survives the hash maps, and reclaims their
+            // retired nodes once its epoch has advanced.
+
+            manager.enter();
+            manager.leave();
+            manager.reclaim();
+            manager.reclaim();
+            ASSERTV(manager.numRetired(), 0 == manager.numRetired());
+            ASSERTV(supplied.numBlocksInUse(),
+                    0 == supplied.numBlocksInUse());
+        }
+        ASSERTV(ea.numBlocksInUse(), 0 == ea.numBlocksInUse());
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+    ASSERT(dam.isTotalSame());
+}
+
+void testOptimisticReadStress()
+{
+    // ------------------------------------------------------------------------
+    // MULTI-THREADED OPTIMISTIC READ STRESS TEST
+    //
+    // Concerns:
+    //: 1 An optimistic read never returns a value that was not stored for the
+    //:   key, even while writers update and erase the key, and while the hash
+    //:   map is being rehashed.
+    //:
+    //: 2 Nodes and arrays of buckets retired during the test are reclaimed.
+    //
+    // Plan:
+    //: 1 With optimistic reads enabled, run reader threads, writer threads
+    //:   that store, for each key 'K', only values congruent to 'K' modulo
+    //:   'k_NUM_ITEMS', and a thread that repeatedly rehashes the hash map.
+    //:   Verify each value found by a reader.  (C-1)
+    //:
+    //: 2 Verify that all memory is returned on destruction.  (C-2)
+    //
+    // Testing:
+    //   MULTI-THREADED OPTIMISTIC READ STRESS TEST
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "MULTI-THREADED OPTIMISTIC READ STRESS TEST" << endl
+                      << "------------------------------------------" << endl;
+
+    const int k_NUM_READERS = 4;
+    const int k_NUM_WRITERS = 4;
+    const int k_NUM_THREADS = k_NUM_READERS + k_NUM_WRITERS + 1;
+
+    bslma::TestAllocator supplied("supplied", veryVeryVeryVerbose);
+    {
+        Obj             mX(16, 8, &supplied);
+        bsls::AtomicInt stop(0);
+        bsls::AtomicInt numFound(0);
+
+        mX.enableOptimisticRead();
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        ThreadArg                 args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ThreadArg arg = { &mX, &stop, &numFound, 0, 0 };
+            args[i] = arg;
+
+            if (i < k_NUM_READERS) {
+                args[i].d_workerId = i + 1;
+                bslmt::ThreadUtil::create(&handles[i],
+                                          readerThread,
+                                          &args[i]);
+            }
+            else if (i < k_NUM_READERS + k_NUM_WRITERS) {
+                args[i].d_workerId   = i - k_NUM_READERS;
+                args[i].d_numWorkers = k_NUM_WRITERS;
+                bslmt::ThreadUtil::create(&handles[i],
+                                          writerThread,
+                                          &args[i]);
+            }
+            else {
+                bslmt::ThreadUtil::create(&handles[i],
+                                          rehashThread,
+                                          &args[i]);
+            }
+        }
+
+        bslmt::ThreadUtil::microSleep(0, 2);
+
+        stop = 1;
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(numFound, 0 < numFound);
+
+        for (int i = 0; i < k_NUM_ITEMS; ++i) {
+            int value;
+            if (1 == mX.getValue(&value, i)) {
+                ASSERTV(i, value, i == value % k_NUM_ITEMS);
+            }
+        }
+    }
+    ASSERTV(supplied.numBlocksInUse(), 0 == supplied.numBlocksInUse());
+}
+
+}  // close namespace optimisticRead
+
 int main(int argc, char *argv[])
 {
     int            test = argc > 1 ? atoi(argv[1]) : 0;
@@ -7629,6 +8000,12 @@ int main(int argc, char *argv[])
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
+      case 23: {
+        optimisticRead::testOptimisticReadStress();
+      } break;
+      case 22: {
+        optimisticRead::testOptimisticRead();
+      } break;
       case 21: {
         threaded::threadedTest1();
       } break;
@@ -105,12 +105,35 @@ BSLS_IDENT("$Id: $")
 //: o The 'maxLoadFactor(newMaxLoadFactor)' method.
 //: o The 'rehash' method.
 //
+// The rehash is incremental: elements are migrated to the new set of buckets
+// one stripe at a time, and only the stripe being migrated is locked.
+// Operations on the other stripes proceed while the rehash is in progress.
+//
 ///Rehash Control
 /// - - - - - - -
 // 'enableRehash' and 'disableRehash' methods are provided to control the
 // rehash enable flag.  Note that disabling rehash does not impact a rehash in
 // progress.
 //
+///Optimistic Reads
+///----------------
+// For a hash map that is read far more often than it is modified, calling
+// 'enableOptimisticRead' allows 'getValue' to look up an element without
+// acquiring the (shared) lock of its stripe, provided that 'VALUE' is
+// trivially copyable.  The value is copied optimistically and the copy is
+// discarded, and the look-up retried, if a writer modified the stripe in the
+// meantime; after a few failed attempts, 'getValue' falls back to a locked
+// look-up.  Once optimistic reads are enabled, the memory of erased elements
+// is reclaimed only after all concurrent readers have completed, and they
+// cannot be disabled again.  Calling 'enableOptimisticRead' has no effect if
+// 'VALUE' is not trivially copyable, or on platforms lacking the C++11
+// standard library; 'isOptimisticReadEnabled' reports whether it took effect.
+//
+// Each hash map enabling optimistic reads creates its own
+// 'bdlcc::EpochManager' unless one is supplied to 'enableOptimisticRead'.
+// Applications holding many hash maps read by the same threads should share
+// one epoch manager among them, which must then outlive the hash maps.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -342,6 +365,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlcc_epochmanager.h>
 #include <bdlcc_stripedunorderedcontainerimpl.h>
 
 #include <bslmf_movableref.h>
@@ -435,12 +459,20 @@ class StripedUnorderedMap {
 
     // MANIPULATORS
     void clear();
-        // Remove all elements from this hash map.  If rehash is in progress,
-        // block until it completes.
+        // Remove all elements from this hash map.
 
     void disableRehash();
         // Prevent future rehash until 'enableRehash' is called.
 
+    void enableOptimisticRead(EpochManager *epochManager = 0);
+        // Allow 'getValue' to load the value of an element without locking
+        // if 'VALUE' is trivially copyable, and have no effect otherwise (see
+        // {Optimistic Reads}).  Reclaim the memory of erased elements using
+        // the optionally specified 'epochManager', or, if 'epochManager' is 0,
+        // using an epoch manager owned by this hash map.  The behavior is
+        // undefined unless 'epochManager' is 0 or outlives this hash map.
+        // Note that optimistic reads cannot be disabled once enabled.
+
     void enableRehash();
         // Allow rehash.  If conditions warrant, rehash will be started by the
         // *next* method call that observes the load factor is exceeded (see
@@ -613,13 +645,18 @@ class StripedUnorderedMap {
         // Load, into the specified '*value', the value attribute of the
         // element in this hash map having the specified 'key'.  Return 1 on
         // success and 0 if 'key' does not exist in this hash map.  Note that
-        // the return value equals the number of values returned.
+        // the return value equals the number of values returned.  Also note
+        // that if optimistic reads are enabled, this method does not lock
+        // (see {Optimistic Reads}).
 
     HASH hashFunction() const;
         // Return (a copy of) the unary hash functor used by this hash map.
         // The return function will generate a hash value (of type
         // 'std::size_t') for a 'KEY' object.
 
+    bool isOptimisticReadEnabled() const;
+        // Return 'true' if optimistic reads are enabled, or 'false' otherwise.
+
     bool isRehashEnabled() const;
         // Return 'true' if rehash is enabled, or 'false' otherwise.
 
@@ -685,6 +722,14 @@ void StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::disableRehash()
     d_imp.disableRehash();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::enableOptimisticRead(
+                                                    EpochManager *epochManager)
+{
+    d_imp.enableOptimisticRead(epochManager);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 void StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::enableRehash()
@@ -860,6 +905,14 @@ HASH StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
     return d_imp.hashFunction();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool
+StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::isOptimisticReadEnabled() const
+{
+    return d_imp.isOptimisticReadEnabled();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool StripedUnorderedMap<KEY, VALUE, HASH, EQUAL>::isRehashEnabled() const
@@ -41,8 +41,10 @@
 #include <bsltf_uniontesttype.h>
 
 #include <bslmf_assert.h>
+#include <bslmf_istriviallycopyable.h>
 #include <bsls_asserttest.h>
 #include <bsls_atomic.h>
+#include <bsls_libraryfeatures.h>
 #include <bsls_nameof.h>
 #include <bsls_performancehint.h>
 #include <bsls_timeutil.h>  // 'HashPerformance'
@@ -117,6 +119,7 @@ using namespace bsl;
 // MANIPULATORS
 // [ 8] void clear();
 // [14] void disableRehash();
+// [ 5] void enableOptimisticRead();
 // [14] void enableRehash();
 // [ 6] bsl::size_t erase(const KEY& key);
 // [ 7] bsl::size_t eraseBulk(RANDOMIT first, last);
@@ -139,6 +142,7 @@ using namespace bsl;
 // [ 4] EQUAL equalFunction() const;
 // [ 5] bsl::size_t getValue(VALUE *value, const KEY& key) const;
 // [ 4] HASH hashFunction() const;
+// [ 5] bool isOptimisticReadEnabled() const;
 // [14] bool isRehashEnabled() const;
 // [14] float loadFactor() const;
 // [14] float maxLoadFactor() const;
@@ -4691,9 +4695,14 @@ void TestDriver<KEY, VALUE, HASH, EQUAL>::testCase5()
     //:     expected values).
     //:
     //: 5 'getValue' is called using a 'const' alias to the object under test.
+    //:
+    //: 6 Repeat P-2 with optimistic reads enabled, and confirm that they take
+    //:   effect only for a trivially copyable 'VALUE'.
     //
     // Testing:
     //   bsl::size_t getValue(VALUE *value, key) const;
+    //   void enableOptimisticRead();
+    //   bool isOptimisticReadEnabled() const;
     // ------------------------------------------------------------------------
 
     // This is similar to portion of 'testCase5' in 'StripedUnorderedImpl'.
@@ -4795,6 +4804,40 @@ void TestDriver<KEY, VALUE, HASH, EQUAL>::testCase5()
         }
     }
 
+    // Test with optimistic reads enabled.  Note that optimistic reads take
+    // effect only for a trivially copyable 'VALUE'.
+    {
+        for (bsl::size_t ti = 0; ti < MAX_LENGTH - 1; ++ti) {
+            // Small number of buckets
+            Obj mX(8, 2, &supplied);  const Obj& X = mX;
+
+            ASSERT(false == X.isOptimisticReadEnabled());
+            mX.enableOptimisticRead();
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+            ASSERTV(bsl::is_trivially_copyable<VALUE>::value ==
+                                                 X.isOptimisticReadEnabled());
+#else
+            ASSERT(false == X.isOptimisticReadEnabled());
+#endif
+
+            for (bsl::size_t tj = 0; tj <= ti; ++tj) {
+                mX.insert(VALUES[tj].first, VALUES[tj].second);
+            }
+            for (bsl::size_t tj = 0; tj <= ti; ++tj) {
+                bsl::size_t rc = X.getValue(&value, VALUES[tj].first);
+                ASSERTV(ti, tj, 1 == rc);
+                ASSERTV(ti, tj, areEqual(value, VALUES[tj].second));
+            }
+
+            bsl::size_t rc = X.getValue(&value, VALUES[ti + 1].first);
+            ASSERTV(ti, 0 == rc);
+
+            ASSERTV(ti, 1 == mX.erase(VALUES[ti].first));
+            rc = X.getValue(&value, VALUES[ti].first);
+            ASSERTV(ti, 0 == rc);
+        }
+    }
+
     // CONCERN: In no case does memory come from the default allocator.
     ASSERT(dam.isTotalSame());
 }
@@ -283,8 +283,7 @@ class StripedUnorderedMultiMap {
 
     // MANIPULATORS
     void clear();
-        // Remove all elements from this hash map.  If rehash is in progress,
-        // block until it completes.
+        // Remove all elements from this hash map.
 
     void disableRehash();
         // Prevent future rehash until 'enableRehash' is called.
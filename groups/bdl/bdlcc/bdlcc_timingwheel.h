@@ -0,0 +1,1163 @@
+// bdlcc_timingwheel.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#define INCLUDED_BDLCC_TIMINGWHEEL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe hierarchical timing wheel.
+//
+//@CLASSES:
+//  bdlcc::TimingWheel: thread-safe hierarchical timing wheel
+//  bdlcc::TimingWheelPair: opaque reference to an item in a timing wheel
+//  bdlcc::TimingWheelPairHandle: managed reference to an item
+//
+//@SEE_ALSO: bdlcc_skiplist, bdlmt_eventscheduler
+//
+//@DESCRIPTION: This component provides a thread-safe container,
+// 'bdlcc::TimingWheel', of items each associating an integral *key* (a time,
+// in some unit, from some epoch) with a value of the parameterized 'DATA'
+// type.  Unlike an ordered container such as 'bdlcc::SkipList', a timing
+// wheel does not maintain its items in key order; instead, it arranges its
+// items into "slots" by time, so that adding, removing, and rescheduling an
+// item are O(1) operations regardless of the number of items in the wheel.
+// Items are retrieved by *advancing* the wheel to the current time, which
+// makes *due* every item whose key is not greater than the current time.
+//
+// The interface of 'bdlcc::TimingWheel' mirrors that of 'bdlcc::SkipList':
+// items are referred to by 'bdlcc::TimingWheelPair' pointers (the "Raw" API),
+// which are reference-counted and must be released using
+// 'releaseReferenceRaw', or by 'bdlcc::TimingWheelPairHandle' objects, which
+// release their references when they go out of scope.  A reference to an item
+// remains valid after the item is removed from the wheel, until the reference
+// is released.
+//
+///Resolution and Structure
+///------------------------
+// A timing wheel is constructed with a *resolution*, the number of key units
+// in one *tick* of the wheel.  Items are arranged by the tick at which they
+// become due (their key divided by the resolution and rounded up), so an item
+// is never due before its key, but may become due up to one resolution after
+// it.  Within one tick, the order in which due items are presented is not
+// specified.
+//
+// The wheel is hierarchical: it comprises 11 levels of 64 slots, the slots of
+// level 'N' each spanning '64^N' ticks, which together cover the full range of
+// 64-bit keys.  An item is added to the lowest level whose slots are coarse
+// enough to hold its tick relative to the current tick, and, as the wheel
+// advances into a slot of a higher level, the items of that slot are
+// redistributed ("cascaded") into lower levels.  Each item is therefore moved
+// at most 11 times during its lifetime, and an occupancy bitmap per level
+// allows the wheel to advance over any number of empty ticks in constant time.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::TimingWheel' is fully thread-safe, meaning that all non-creator
+// operations on an object can be safely invoked simultaneously from multiple
+// threads.  All operations are guarded by a single mutex, which is held only
+// for O(1) work, except by 'advanceRaw' (which performs any pending cascades)
+// and 'removeAll'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Expiring Connections
+///- - - - - - - - - - - - - - - -
+// Suppose that we maintain a large number of connections, each of which is to
+// be closed if it is idle for 30 seconds, and that most connections are active
+// enough that their idle timers are rescheduled long before they expire.  A
+// timing wheel having a resolution of one millisecond (with keys in
+// microseconds) makes each reschedule an O(1) operation.
+//
+// First, we create a wheel whose items are connection identifiers, starting at
+// (the arbitrary) time 0:
+//..
+//  bdlcc::TimingWheel<int> wheel(1000,  // resolution: 1000 microseconds
+//                                0);    // current time
+//..
+// Then, we add an idle timer for each of three connections:
+//..
+//  bdlcc::TimingWheel<int>::PairHandle timers[3];
+//  for (int i = 0; i < 3; ++i) {
+//      wheel.add(&timers[i], 30 * 1000 * 1000, i);
+//  }
+//  assert(3 == wheel.length());
+//..
+// Next, at time 10 seconds, we observe activity on connections 0 and 2, and
+// reschedule their timers:
+//..
+//  assert(0 == wheel.update(timers[0], 40 * 1000 * 1000));
+//  assert(0 == wheel.update(timers[2], 40 * 1000 * 1000));
+//..
+// Then, at time 30 seconds, we advance the wheel, and find that the timer of
+// connection 1 is due:
+//..
+//  bdlcc::TimingWheel<int>::Pair *front;
+//  bsls::Types::Int64             nextKey;
+//
+//  nextKey = wheel.advanceRaw(&front, 30 * 1000 * 1000);
+//  assert(0                == wheel.remove(front));
+//  assert(1                == front->data());
+//  assert(30 * 1000 * 1000 == nextKey);
+//  wheel.releaseReferenceRaw(front);
+//..
+// Now, no other timer is due, and the wheel indicates a time, no later than
+// the next key, at which the caller should advance it again:
+//..
+//  nextKey = wheel.advanceRaw(&front, 30 * 1000 * 1000);
+//  assert(0                 == front);
+//  assert(30 * 1000 * 1000  <  nextKey);
+//  assert(40 * 1000 * 1000  >= nextKey);
+//..
+// Finally, connection 0 is closed, so we cancel its timer:
+//..
+//  assert(0 == wheel.remove(timers[0]));
+//  assert(1 == wheel.length());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bslalg_scalarprimitives.h>
+
+#include <bslma_allocator.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdint.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+template <class DATA>
+class TimingWheel;
+
+                          // =======================
+                          // struct TimingWheel_Node
+                          // =======================
+
+template <class DATA>
+struct TimingWheel_Node {
+    // This component-private 'struct' describes an item of a 'TimingWheel'.
+
+    // DATA
+    TimingWheel_Node         *d_next_p;    // next node in the containing list
+
+    TimingWheel_Node         *d_prev_p;    // previous node in the containing
+                                           // list
+
+    bsls::Types::Int64        d_key;       // key of the item
+
+    bsl::uint64_t             d_tick;      // tick at which the item is due,
+                                           // offset so that unsigned
+                                           // comparison is chronological
+
+    bsls::AtomicInt           d_refCount;  // number of references, including
+                                           // the one held by the wheel
+
+    int                       d_list;      // index of the containing list, or
+                                           // -1 if not in the wheel
+
+    bsls::ObjectBuffer<DATA>  d_data;      // value of the item
+};
+
+                           // =====================
+                           // class TimingWheelPair
+                           // =====================
+
+template <class DATA>
+class TimingWheelPair {
+    // This class provides an opaque reference to an item in a 'TimingWheel'.
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheelPair();
+    TimingWheelPair(const TimingWheelPair&);
+    TimingWheelPair& operator=(const TimingWheelPair&);
+
+  public:
+    // ACCESSORS
+    DATA& data() const;
+        // Return a reference to the "data" value of this item.
+
+    const bsls::Types::Int64& key() const;
+        // Return a reference to the non-modifiable "key" value of this item.
+};
+
+                        // ===========================
+                        // class TimingWheelPairHandle
+                        // ===========================
+
+template <class DATA>
+class TimingWheelPairHandle {
+    // Objects of this class refer to an item in a 'TimingWheel'.  A
+    // 'bdlcc::TimingWheelPairHandle' is implicitly convertible to a
+    // 'const Pair*' and thus may be used anywhere in the 'TimingWheel' API
+    // that a 'const Pair*' is expected.
+
+    // PRIVATE TYPES
+    typedef TimingWheelPair<DATA> Pair;
+
+    // DATA
+    TimingWheel<DATA> *d_wheel_p;
+    Pair              *d_node_p;
+
+    // FRIENDS
+    friend class TimingWheel<DATA>;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void reset(const TimingWheel<DATA> *wheel, Pair *reference);
+        // Release the reference (if any) managed by this handle, and make this
+        // handle manage the specified 'reference' to an item in the specified
+        // 'wheel'.  Note that it is assumed that the calling scope already
+        // owns the 'reference'.
+
+  public:
+    // CREATORS
+    TimingWheelPairHandle();
+        // Create a handle that does not refer to an item.
+
+    TimingWheelPairHandle(const TimingWheelPairHandle& original);
+        // Create a handle referring to the same item as the specified
+        // 'original' handle.
+
+    ~TimingWheelPairHandle();
+        // Destroy this handle, releasing the reference it manages, if any.
+
+    // MANIPULATORS
+    TimingWheelPairHandle& operator=(const TimingWheelPairHandle& rhs);
+        // Release the reference (if any) managed by this handle, and make this
+        // handle refer to the same item as the specified 'rhs' handle.
+        // Return a reference providing modifiable access to this handle.
+
+    void release();
+        // Release the reference (if any) managed by this handle.
+
+    // ACCESSORS
+    operator const Pair*() const;
+        // Return the address of the item referred to by this handle, or 0 if
+        // this handle does not manage a reference.
+
+    DATA& data() const;
+        // Return a reference to the "data" value of the item referred to by
+        // this handle.  The behavior is undefined unless 'isValid' returns
+        // 'true'.
+
+    const bsls::Types::Int64& key() const;
+        // Return a reference to the non-modifiable "key" value of the item
+        // referred to by this handle.  The behavior is undefined unless
+        // 'isValid' returns 'true'.
+
+    bool isValid() const;
+        // Return 'true' if this handle refers to an item, and 'false'
+        // otherwise.
+};
+
+                             // =================
+                             // class TimingWheel
+                             // =================
+
+template <class DATA>
+class TimingWheel {
+    // This class provides a thread-safe hierarchical timing wheel of items,
+    // each associating a key with a 'DATA' value, supporting O(1) addition,
+    // removal, and rescheduling of items.
+
+  public:
+    // CONSTANTS
+    enum {
+        e_SUCCESS   = 0,
+        e_NOT_FOUND = 1,
+        e_INVALID   = 3
+    };
+
+    // TYPES
+    typedef TimingWheelPair<DATA>       Pair;
+    typedef TimingWheelPairHandle<DATA> PairHandle;
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_BITS_PER_LEVEL  = 6,
+        k_SLOTS_PER_LEVEL = 1 << k_BITS_PER_LEVEL,
+        k_NUM_LEVELS      = (64 + k_BITS_PER_LEVEL - 1) / k_BITS_PER_LEVEL,
+        k_DUE_LIST        = k_NUM_LEVELS * k_SLOTS_PER_LEVEL,
+        k_NUM_LISTS       = k_DUE_LIST + 1,
+        k_NOT_IN_WHEEL    = -1
+    };
+
+    // PRIVATE TYPES
+    typedef TimingWheel_Node<DATA>         Node;
+    typedef bslmt::LockGuard<bslmt::Mutex> LockGuard;
+
+    // DATA
+    Node                  *d_lists[k_NUM_LISTS];
+                                         // circular lists of the items of
+                                         // each slot, followed by the list of
+                                         // due items
+
+    bsl::uint64_t          d_occupied[k_NUM_LEVELS];
+                                         // bitmap of the non-empty slots of
+                                         // each level
+
+    const bsls::Types::Int64
+                           d_resolution; // key units per tick
+
+    bsl::uint64_t          d_currentTick;
+                                         // current tick, offset as for
+                                         // 'Node::d_tick'
+
+    bsls::Types::Int64     d_nextKey;    // key most recently returned by
+                                         // 'advanceRaw', or 'LLONG_MIN' after
+                                         // an earlier item was added, or
+                                         // 'LLONG_MAX' initially
+
+    int                    d_length;     // number of items in the wheel
+
+    mutable bslmt::Mutex   d_lock;       // guards all of the above
+
+    bdlma::ConcurrentPool  d_pool;       // supplies nodes
+
+    bslma::Allocator      *d_allocator_p;
+                                         // memory allocator (held, not owned)
+
+    // FRIENDS
+    friend class TimingWheelPair<DATA>;
+    friend class TimingWheelPairHandle<DATA>;
+
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&);
+    TimingWheel& operator=(const TimingWheel&);
+
+    // PRIVATE CLASS METHODS
+    static DATA& data(const Pair *reference);
+        // Return a reference to the "data" value of the item identified by
+        // the specified 'reference'.
+
+    static const bsls::Types::Int64& key(const Pair *reference);
+        // Return a reference to the non-modifiable "key" value of the item
+        // identified by the specified 'reference'.
+
+    static Node *pairToNode(const Pair *reference);
+        // Return the node identified by the specified 'reference'.
+
+    // PRIVATE MANIPULATORS
+    Node *allocateNode(bsls::Types::Int64 key, const DATA& data);
+        // Return a new node, having a reference count of 1, that associates
+        // the specified 'key' with the specified 'data'.  Note that this
+        // method neither acquires nor requires the lock.
+
+    void cascade(int list);
+        // Remove all nodes from the specified 'list', and insert each of them
+        // again relative to the current tick.  This method must be called
+        // under the lock.
+
+    void insertNode(Node *node);
+        // Insert the specified 'node' into the list appropriate for its tick
+        // relative to the current tick.  This method must be called under the
+        // lock.
+
+    void insertNodeIntoList(Node *node, int list);
+        // Insert the specified 'node' at the back of the specified 'list'.
+        // This method must be called under the lock.
+
+    void releaseNode(Node *node);
+        // Decrement the reference count of the specified 'node', and if it
+        // reaches 0, destroy 'node' and return it to the pool.  Note that this
+        // method neither acquires nor requires the lock.
+
+    void removeNodeFromList(Node *node);
+        // Remove the specified 'node' from the list containing it.  This
+        // method must be called under the lock.
+
+    // PRIVATE ACCESSORS
+    bool findNextSlot(int *list, bsl::uint64_t *startTick) const;
+        // Load into the specified 'list' the index of the earliest non-empty
+        // slot of this wheel, and into the specified 'startTick' the first
+        // tick spanned by that slot, and return 'true'; return 'false', with
+        // no effect on 'list' or 'startTick', if every slot is empty.  Note
+        // that the list of due items is not considered.  This method must be
+        // called under the lock.
+
+    bsl::uint64_t keyToTick(bsls::Types::Int64 key) const;
+        // Return the (offset) tick at which an item having the specified 'key'
+        // is due, i.e., 'key' divided by the resolution and rounded up, or
+        // the last tick reachable by a key if that is later.
+
+    bsl::uint64_t reachedTick(bsls::Types::Int64 key) const;
+        // Return the (offset) last tick reached at the specified 'key', i.e.,
+        // 'key' divided by the resolution and rounded down.
+
+    bsls::Types::Int64 tickToKey(bsl::uint64_t tick) const;
+        // Return the smallest key at which the specified (offset) 'tick' is
+        // reached.  The behavior is undefined unless 'tick' is reachable by a
+        // key.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TimingWheel, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    TimingWheel(bsls::Types::Int64  resolution,
+                bsls::Types::Int64  currentKey,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create an empty timing wheel having the specified 'resolution' (the
+        // number of key units per tick) whose current time is the specified
+        // 'currentKey'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= resolution'.
+
+    ~TimingWheel();
+        // Remove all items from this timing wheel and destroy it.  The
+        // behavior is undefined unless every reference to an item of this
+        // wheel has been released.
+
+    // MANIPULATORS
+    void add(PairHandle         *result,
+             bsls::Types::Int64  key,
+             const DATA&         data,
+             bool               *newFrontFlag = 0);
+        // Add to this wheel an item associating the specified 'key' with the
+        // specified 'data', and load into the specified 'result' a handle
+        // referring to the item.  If the optionally specified 'newFrontFlag'
+        // is not 0, load into it 'true' if 'key' is earlier than the key most
+        // recently returned by 'advanceRaw' (i.e., if a consumer waiting until
+        // that key must be woken), and 'false' otherwise.
+
+    void addRaw(Pair               **result,
+                bsls::Types::Int64   key,
+                const DATA&          data,
+                bool                *newFrontFlag = 0);
+        // Add to this wheel an item associating the specified 'key' with the
+        // specified 'data', and, if the specified 'result' is not 0, load into
+        // it a reference to the item that must be released using
+        // 'releaseReferenceRaw'.  If the optionally specified 'newFrontFlag'
+        // is not 0, load into it 'true' if 'key' is earlier than the key most
+        // recently returned by 'advanceRaw' (i.e., if a consumer waiting until
+        // that key must be woken), and 'false' otherwise.
+
+    bsls::Types::Int64 advanceRaw(Pair **front, bsls::Types::Int64 now);
+        // Advance the current time of this wheel to the specified 'now', if
+        // 'now' is later than the current time, making due every item whose
+        // tick has been reached.  If any item is due, load into the specified
+        // 'front' a reference to a due item, which must be released using
+        // 'releaseReferenceRaw', and return its key; otherwise, load 0 into
+        // 'front' and return a time, later than 'now', to which this wheel
+        // must next be advanced (which is not later than the time at which
+        // the earliest item in the wheel becomes due), or 'LLONG_MAX' if this
+        // wheel is empty.  Note that the due item is *not* removed from the
+        // wheel.
+
+    int remove(const Pair *reference);
+        // Remove the item identified by the specified 'reference' from this
+        // wheel.  Return 0 on success, 'e_NOT_FOUND' if the item is no longer
+        // in the wheel, and 'e_INVALID' if 'reference' is 0.  Note that
+        // 'reference' remains valid, and must still be released.
+
+    int removeAll();
+        // Remove all items from this wheel, and return the number of items
+        // removed.
+
+    int update(const Pair         *reference,
+               bsls::Types::Int64  newKey,
+               bool               *newFrontFlag = 0);
+        // Change the key of the item identified by the specified 'reference'
+        // to the specified 'newKey'.  If the optionally specified
+        // 'newFrontFlag' is not 0, load into it 'true' if 'newKey' is earlier
+        // than the key most recently returned by 'advanceRaw', and 'false'
+        // otherwise.  Return 0 on success, 'e_NOT_FOUND' if the item is no
+        // longer in the wheel, and 'e_INVALID' if 'reference' is 0.
+
+    void releaseReferenceRaw(const Pair *reference);
+        // Release the specified 'reference'.  The behavior is undefined if
+        // 'reference' is used for any purpose after being released.
+
+    // ACCESSORS
+    Pair *addPairReferenceRaw(const Pair *reference) const;
+        // Increment the reference count of the item identified by the
+        // specified 'reference', and return 'reference'.  There must be a
+        // corresponding call to 'releaseReferenceRaw' when the reference is
+        // no longer needed.
+
+    bool isEmpty() const;
+        // Return 'true' if this wheel has no items, and 'false' otherwise.
+
+    int length() const;
+        // Return the number of items in this wheel.
+
+    bsls::Types::Int64 resolution() const;
+        // Return the number of key units per tick of this wheel.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class TimingWheelPair
+                           // ---------------------
+
+// ACCESSORS
+template <class DATA>
+inline
+DATA& TimingWheelPair<DATA>::data() const
+{
+    return TimingWheel<DATA>::data(this);
+}
+
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheelPair<DATA>::key() const
+{
+    return TimingWheel<DATA>::key(this);
+}
+
+                        // ---------------------------
+                        // class TimingWheelPairHandle
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+inline
+void TimingWheelPairHandle<DATA>::reset(const TimingWheel<DATA> *wheel,
+                                        Pair                    *reference)
+{
+    release();
+    d_wheel_p = const_cast<TimingWheel<DATA> *>(wheel);
+    d_node_p  = reference;
+}
+
+// CREATORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::TimingWheelPairHandle()
+: d_wheel_p(0)
+, d_node_p(0)
+{
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::TimingWheelPairHandle(
+                                         const TimingWheelPairHandle& original)
+: d_wheel_p(original.d_wheel_p)
+, d_node_p(original.d_node_p
+           ? d_wheel_p->addPairReferenceRaw(original.d_node_p)
+           : 0)
+{
+}
+
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::~TimingWheelPairHandle()
+{
+    release();
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>&
+TimingWheelPairHandle<DATA>::operator=(const TimingWheelPairHandle& rhs)
+{
+    if (this != &rhs) {
+        reset(rhs.d_wheel_p, 0);
+        d_node_p = rhs.d_node_p
+                   ? d_wheel_p->addPairReferenceRaw(rhs.d_node_p)
+                   : 0;
+    }
+    return *this;
+}
+
+template <class DATA>
+inline
+void TimingWheelPairHandle<DATA>::release()
+{
+    if (d_node_p) {
+        BSLS_ASSERT(0 != d_wheel_p);
+
+        d_wheel_p->releaseReferenceRaw(d_node_p);
+        d_node_p = 0;
+    }
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+TimingWheelPairHandle<DATA>::operator const Pair*() const
+{
+    return d_node_p;
+}
+
+template <class DATA>
+inline
+DATA& TimingWheelPairHandle<DATA>::data() const
+{
+    BSLS_ASSERT_SAFE(isValid());
+
+    return TimingWheel<DATA>::data(d_node_p);
+}
+
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheelPairHandle<DATA>::key() const
+{
+    BSLS_ASSERT_SAFE(isValid());
+
+    return TimingWheel<DATA>::key(d_node_p);
+}
+
+template <class DATA>
+inline
+bool TimingWheelPairHandle<DATA>::isValid() const
+{
+    return 0 != d_node_p && 0 != d_wheel_p;
+}
+
+                             // -----------------
+                             // class TimingWheel
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class DATA>
+inline
+DATA& TimingWheel<DATA>::data(const Pair *reference)
+{
+    return pairToNode(reference)->d_data.object();
+}
+
+template <class DATA>
+inline
+const bsls::Types::Int64& TimingWheel<DATA>::key(const Pair *reference)
+{
+    return pairToNode(reference)->d_key;
+}
+
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Node *
+TimingWheel<DATA>::pairToNode(const Pair *reference)
+{
+    return static_cast<Node *>(const_cast<void *>(
+                                      static_cast<const void *>(reference)));
+}
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+typename TimingWheel<DATA>::Node *
+TimingWheel<DATA>::allocateNode(bsls::Types::Int64 key, const DATA& data)
+{
+    Node *node = static_cast<Node *>(d_pool.allocate());
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(node, &d_pool);
+
+    bslalg::ScalarPrimitives::copyConstruct(node->d_data.address(),
+                                            data,
+                                            d_allocator_p);
+    proctor.release();
+
+    node->d_next_p = 0;
+    node->d_prev_p = 0;
+    node->d_key    = key;
+    node->d_tick   = keyToTick(key);
+    node->d_list   = k_NOT_IN_WHEEL;
+    ::new (&node->d_refCount) bsls::AtomicInt(1);
+
+    return node;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::cascade(int list)
+{
+    Node *head = d_lists[list];
+    if (0 == head) {
+        return;                                                       // RETURN
+    }
+
+    d_lists[list] = 0;
+    d_occupied[list / k_SLOTS_PER_LEVEL] &=
+                  ~(static_cast<bsl::uint64_t>(1) << list % k_SLOTS_PER_LEVEL);
+
+    // Break the circle, so that the nodes can be inserted again in order.
+
+    head->d_prev_p->d_next_p = 0;
+
+    Node *node = head;
+    while (node) {
+        Node *next = node->d_next_p;
+        insertNode(node);
+        node = next;
+    }
+}
+
+template <class DATA>
+void TimingWheel<DATA>::insertNode(Node *node)
+{
+    if (node->d_tick <= d_currentTick) {
+        insertNodeIntoList(node, k_DUE_LIST);
+        return;                                                       // RETURN
+    }
+
+    // The level of the node is that of the most significant group of bits in
+    // which its tick differs from the current tick.  The slot of the node at
+    // that level is, therefore, later than the slot of the current tick.
+
+    const int level = (63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                             node->d_tick ^ d_currentTick))
+                    / k_BITS_PER_LEVEL;
+    const int slot  = static_cast<int>((node->d_tick
+                                        >> (level * k_BITS_PER_LEVEL))
+                                       & (k_SLOTS_PER_LEVEL - 1));
+
+    insertNodeIntoList(node, level * k_SLOTS_PER_LEVEL + slot);
+    d_occupied[level] |= static_cast<bsl::uint64_t>(1) << slot;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::insertNodeIntoList(Node *node, int list)
+{
+    Node *head = d_lists[list];
+    if (0 == head) {
+        node->d_next_p = node;
+        node->d_prev_p = node;
+        d_lists[list]  = node;
+    }
+    else {
+        node->d_next_p           = head;
+        node->d_prev_p           = head->d_prev_p;
+        head->d_prev_p->d_next_p = node;
+        head->d_prev_p           = node;
+    }
+    node->d_list = list;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::releaseNode(Node *node)
+{
+    BSLS_ASSERT(node);
+
+    if (0 == --node->d_refCount) {
+        node->d_data.object().~DATA();
+        d_pool.deallocate(node);
+    }
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::removeNodeFromList(Node *node)
+{
+    const int list = node->d_list;
+
+    BSLS_ASSERT(k_NOT_IN_WHEEL != list);
+
+    if (node->d_next_p == node) {
+        d_lists[list] = 0;
+        if (k_DUE_LIST != list) {
+            d_occupied[list / k_SLOTS_PER_LEVEL] &=
+                  ~(static_cast<bsl::uint64_t>(1) << list % k_SLOTS_PER_LEVEL);
+        }
+    }
+    else {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+        if (d_lists[list] == node) {
+            d_lists[list] = node->d_next_p;
+        }
+    }
+
+    node->d_next_p = 0;
+    node->d_prev_p = 0;
+    node->d_list   = k_NOT_IN_WHEEL;
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+bool TimingWheel<DATA>::findNextSlot(int           *list,
+                                     bsl::uint64_t *startTick) const
+{
+    // The slots of each level span the current slot of the next level, so the
+    // earliest non-empty slot is the first one, after the slot of the current
+    // tick, of the lowest level having any non-empty slot.
+
+    for (int level = 0; level < k_NUM_LEVELS; ++level) {
+        if (0 == d_occupied[level]) {
+            continue;
+        }
+
+        const int shift   = level * k_BITS_PER_LEVEL;
+        const int current = static_cast<int>((d_currentTick >> shift)
+                                             & (k_SLOTS_PER_LEVEL - 1));
+
+        const bsl::uint64_t later =
+                  current == k_SLOTS_PER_LEVEL - 1
+                  ? 0
+                  : d_occupied[level]
+                  & (~static_cast<bsl::uint64_t>(0) << (current + 1));
+
+        BSLS_ASSERT(0 != later);  // slots before the current one are empty
+
+        const int slot = bdlb::BitUtil::numTrailingUnsetBits(later);
+
+        // The start of the slot has the bits of the current tick above this
+        // level, 'slot' at this level, and zeros below.
+
+        const int           aboveShift = shift + k_BITS_PER_LEVEL;
+        const bsl::uint64_t above      =
+                                 aboveShift >= 64
+                                 ? 0
+                                 : (d_currentTick >> aboveShift) << aboveShift;
+
+        *list      = level * k_SLOTS_PER_LEVEL + slot;
+        *startTick = above | (static_cast<bsl::uint64_t>(slot) << shift);
+        return true;                                                  // RETURN
+    }
+
+    return false;
+}
+
+template <class DATA>
+inline
+bsl::uint64_t TimingWheel<DATA>::keyToTick(bsls::Types::Int64 key) const
+{
+    // Round up, so that an item is never due before its key, but not past the
+    // last tick that can be reached.
+
+    bsls::Types::Int64 tick = key / d_resolution;
+    if (key % d_resolution > 0 && tick < LLONG_MAX / d_resolution) {
+        ++tick;
+    }
+
+    return static_cast<bsl::uint64_t>(tick)
+         ^ (static_cast<bsl::uint64_t>(1) << 63);
+}
+
+template <class DATA>
+inline
+bsl::uint64_t
+TimingWheel<DATA>::reachedTick(bsls::Types::Int64 key) const
+{
+    bsls::Types::Int64 tick = key / d_resolution;
+    if (key % d_resolution < 0) {
+        --tick;
+    }
+
+    return static_cast<bsl::uint64_t>(tick)
+         ^ (static_cast<bsl::uint64_t>(1) << 63);
+}
+
+template <class DATA>
+inline
+bsls::Types::Int64 TimingWheel<DATA>::tickToKey(bsl::uint64_t tick) const
+{
+    return static_cast<bsls::Types::Int64>(
+                          tick ^ (static_cast<bsl::uint64_t>(1) << 63))
+         * d_resolution;
+}
+
+// CREATORS
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(bsls::Types::Int64  resolution,
+                               bsls::Types::Int64  currentKey,
+                               bslma::Allocator   *basicAllocator)
+: d_resolution(resolution)
+, d_currentTick(0)
+, d_nextKey(LLONG_MAX)
+, d_length(0)
+, d_pool(sizeof(Node), basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= resolution);
+
+    for (int i = 0; i < k_NUM_LISTS; ++i) {
+        d_lists[i] = 0;
+    }
+    for (int i = 0; i < k_NUM_LEVELS; ++i) {
+        d_occupied[i] = 0;
+    }
+
+    d_currentTick = reachedTick(currentKey);
+}
+
+template <class DATA>
+TimingWheel<DATA>::~TimingWheel()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class DATA>
+inline
+void TimingWheel<DATA>::add(PairHandle         *result,
+                            bsls::Types::Int64  key,
+                            const DATA&         data,
+                            bool               *newFrontFlag)
+{
+    BSLS_ASSERT(result);
+
+    Pair *reference;
+    addRaw(&reference, key, data, newFrontFlag);
+    result->reset(this, reference);
+}
+
+template <class DATA>
+void TimingWheel<DATA>::addRaw(Pair               **result,
+                               bsls::Types::Int64   key,
+                               const DATA&          data,
+                               bool                *newFrontFlag)
+{
+    Node *node = allocateNode(key, data);
+    if (result) {
+        ++node->d_refCount;
+        *result = reinterpret_cast<Pair *>(node);
+    }
+
+    LockGuard guard(&d_lock);
+
+    insertNode(node);
+    ++d_length;
+
+    const bool isNewFront = key < d_nextKey;
+    if (isNewFront) {
+        d_nextKey = LLONG_MIN;
+    }
+    if (newFrontFlag) {
+        *newFrontFlag = isNewFront;
+    }
+}
+
+template <class DATA>
+bsls::Types::Int64 TimingWheel<DATA>::advanceRaw(Pair               **front,
+                                                 bsls::Types::Int64   now)
+{
+    BSLS_ASSERT(front);
+
+    const bsl::uint64_t nowTick = reachedTick(now);
+
+    LockGuard guard(&d_lock);
+
+    if (nowTick > d_currentTick) {
+        int           list;
+        bsl::uint64_t startTick;
+
+        while (findNextSlot(&list, &startTick) && startTick <= nowTick) {
+            d_currentTick = startTick;
+            cascade(list);
+        }
+        d_currentTick = nowTick;
+    }
+
+    Node *due = d_lists[k_DUE_LIST];
+    if (due) {
+        ++due->d_refCount;
+        *front    = reinterpret_cast<Pair *>(due);
+        d_nextKey = due->d_key;
+        return d_nextKey;                                             // RETURN
+    }
+
+    *front = 0;
+
+    int           list;
+    bsl::uint64_t startTick;
+
+    d_nextKey = findNextSlot(&list, &startTick)
+                ? tickToKey(startTick)
+                : LLONG_MAX;
+
+    return d_nextKey;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::remove(const Pair *reference)
+{
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = pairToNode(reference);
+    {
+        LockGuard guard(&d_lock);
+
+        if (k_NOT_IN_WHEEL == node->d_list) {
+            return e_NOT_FOUND;                                       // RETURN
+        }
+
+        removeNodeFromList(node);
+        --d_length;
+    }
+
+    releaseNode(node);
+    return e_SUCCESS;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::removeAll()
+{
+    Node *removed = 0;
+    int   numRemoved;
+    {
+        LockGuard guard(&d_lock);
+
+        for (int i = 0; i < k_NUM_LISTS; ++i) {
+            Node *head = d_lists[i];
+            if (0 == head) {
+                continue;
+            }
+            d_lists[i] = 0;
+
+            // Chain the nodes of this list onto 'removed'.
+
+            head->d_prev_p->d_next_p = removed;
+            removed = head;
+        }
+        for (int i = 0; i < k_NUM_LEVELS; ++i) {
+            d_occupied[i] = 0;
+        }
+
+        for (Node *node = removed; node; node = node->d_next_p) {
+            node->d_prev_p = 0;
+            node->d_list   = k_NOT_IN_WHEEL;
+        }
+
+        numRemoved = d_length;
+        d_length   = 0;
+    }
+
+    while (removed) {
+        Node *next = removed->d_next_p;
+        removed->d_next_p = 0;
+        releaseNode(removed);
+        removed = next;
+    }
+
+    return numRemoved;
+}
+
+template <class DATA>
+int TimingWheel<DATA>::update(const Pair         *reference,
+                              bsls::Types::Int64  newKey,
+                              bool               *newFrontFlag)
+{
+    if (0 == reference) {
+        return e_INVALID;                                             // RETURN
+    }
+
+    Node *node = pairToNode(reference);
+
+    LockGuard guard(&d_lock);
+
+    if (k_NOT_IN_WHEEL == node->d_list) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    removeNodeFromList(node);
+    node->d_key  = newKey;
+    node->d_tick = keyToTick(newKey);
+    insertNode(node);
+
+    const bool isNewFront = newKey < d_nextKey;
+    if (isNewFront) {
+        d_nextKey = LLONG_MIN;
+    }
+    if (newFrontFlag) {
+        *newFrontFlag = isNewFront;
+    }
+
+    return e_SUCCESS;
+}
+
+template <class DATA>
+inline
+void TimingWheel<DATA>::releaseReferenceRaw(const Pair *reference)
+{
+    releaseNode(pairToNode(reference));
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Pair *
+TimingWheel<DATA>::addPairReferenceRaw(const Pair *reference) const
+{
+    ++pairToNode(reference)->d_refCount;
+    return const_cast<Pair *>(reference);
+}
+
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isEmpty() const
+{
+    LockGuard guard(&d_lock);
+
+    return 0 == d_length;
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::length() const
+{
+    LockGuard guard(&d_lock);
+
+    return d_length;
+}
+
+template <class DATA>
+inline
+bsls::Types::Int64 TimingWheel<DATA>::resolution() const
+{
+    return d_resolution;
+}
+
+                                  // Aspects
+
+template <class DATA>
+inline
+bslma::Allocator *TimingWheel<DATA>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,901 @@
+// bdlcc_timingwheel.t.cpp                                            -*-C++-*-
+
+#include <bdlcc_timingwheel.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread-safe container whose items are
+// retrieved, in tick order, by advancing the container to a time.  We first
+// verify the basic manipulators and accessors on a small number of items.  We
+// then verify, against a simple model, that advancing the wheel over randomly
+// generated keys of widely varying magnitude never presents an item before its
+// tick, and presents every item whose tick has been reached.  Finally, we
+// verify rescheduling, reference counting, allocator use, and concurrent
+// access.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 1] TimingWheel(Int64 resolution, Int64 currentKey, Allocator *bA = 0);
+// [ 1] ~TimingWheel();
+//
+// MANIPULATORS
+// [ 1] void add(PairHandle *, Int64 key, const DATA&, bool * = 0);
+// [ 1] void addRaw(Pair **, Int64 key, const DATA&, bool * = 0);
+// [ 2] Int64 advanceRaw(Pair **front, Int64 now);
+// [ 1] int remove(const Pair *reference);
+// [ 4] int removeAll();
+// [ 3] int update(const Pair *reference, Int64 newKey, bool * = 0);
+// [ 1] void releaseReferenceRaw(const Pair *reference);
+//
+// ACCESSORS
+// [ 4] Pair *addPairReferenceRaw(const Pair *reference) const;
+// [ 1] bool isEmpty() const;
+// [ 1] int length() const;
+// [ 1] Int64 resolution() const;
+// [ 4] bslma::Allocator *allocator() const;
+//
+// 'TimingWheelPairHandle'
+// [ 4] TimingWheelPairHandle();
+// [ 4] TimingWheelPairHandle(const TimingWheelPairHandle& original);
+// [ 4] TimingWheelPairHandle& operator=(const TimingWheelPairHandle&);
+// [ 4] void release();
+// [ 1] operator const Pair*() const;
+// [ 1] DATA& data() const;
+// [ 1] const Int64& key() const;
+// [ 4] bool isValid() const;
+// ----------------------------------------------------------------------------
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Int64             Int64;
+typedef bsls::Types::Uint64            Uint64;
+
+typedef bdlcc::TimingWheel<int>        Obj;
+typedef Obj::Pair                      Pair;
+typedef Obj::PairHandle                PairHandle;
+
+typedef bdlcc::TimingWheel<bsl::string> StringObj;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of a pseudo-random sequence whose state is the
+    // specified 'state'.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state >> 11;
+}
+
+Int64 floorTick(Int64 key, Int64 resolution)
+    // Return the specified 'key' divided by the specified 'resolution',
+    // rounded towards negative infinity.
+{
+    return key / resolution - (key % resolution < 0 ? 1 : 0);
+}
+
+Int64 dueTick(Int64 key, Int64 resolution)
+    // Return the specified 'key' divided by the specified 'resolution',
+    // rounded towards positive infinity, or the last tick reachable by a key
+    // if that is earlier.
+{
+    const Int64 tick = key / resolution + (key % resolution > 0 ? 1 : 0);
+    const Int64 last = LLONG_MAX / resolution;
+
+    return tick < last ? tick : last;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                          CASE 5 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace TIMINGWHEEL_CASE_5 {
+
+enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 2000 };
+
+bsls::AtomicInt  s_numRemoved(0);
+bsls::AtomicBool s_done(false);
+
+void producer(Obj *wheel, bslmt::Barrier *barrier, int id)
+    // Repeatedly add items to the specified 'wheel', rescheduling and removing
+    // most of them, after waiting on the specified 'barrier'.  Use the
+    // specified 'id' to seed the keys.
+{
+    Uint64 state = id;
+
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const Int64 key = static_cast<Int64>(nextRandom(&state) % 100000);
+
+        PairHandle handle;
+        wheel->add(&handle, key, id);
+
+        if (0 == i % 3) {
+            continue;  // leave it for the consumer
+        }
+        // The consumer may remove the item between these two calls.
+
+        wheel->update(handle, key + 50);
+        if (0 == wheel->remove(handle)) {
+            ++s_numRemoved;
+        }
+    }
+}
+
+void consumer(Obj *wheel, bslmt::Barrier *barrier)
+    // Advance the specified 'wheel', removing due items, until all producers
+    // have finished and the wheel is empty, after waiting on the specified
+    // 'barrier'.
+{
+    barrier->wait();
+
+    Int64 now = 0;
+    while (!s_done || !wheel->isEmpty()) {
+        Pair *front;
+        wheel->advanceRaw(&front, now);
+        if (front) {
+            ASSERTV(front->key(), now, front->key() <= now);
+            if (0 == wheel->remove(front)) {
+                ++s_numRemoved;
+            }
+            wheel->releaseReferenceRaw(front);
+        }
+        else {
+            now += 97;
+        }
+    }
+}
+
+}  // close namespace TIMINGWHEEL_CASE_5
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Expiring Connections
+///- - - - - - - - - - - - - - - -
+// Suppose that we maintain a large number of connections, each of which is to
+// be closed if it is idle for 30 seconds, and that most connections are active
+// enough that their idle timers are rescheduled long before they expire.  A
+// timing wheel having a resolution of one millisecond (with keys in
+// microseconds) makes each reschedule an O(1) operation.
+//
+// First, we create a wheel whose items are connection identifiers, starting at
+// (the arbitrary) time 0:
+//..
+    bdlcc::TimingWheel<int> wheel(1000,  // resolution: 1000 microseconds
+                                  0);    // current time
+//..
+// Then, we add an idle timer for each of three connections:
+//..
+    bdlcc::TimingWheel<int>::PairHandle timers[3];
+    for (int i = 0; i < 3; ++i) {
+        wheel.add(&timers[i], 30 * 1000 * 1000, i);
+    }
+    ASSERT(3 == wheel.length());
+//..
+// Next, at time 10 seconds, we observe activity on connections 0 and 2, and
+// reschedule their timers:
+//..
+    ASSERT(0 == wheel.update(timers[0], 40 * 1000 * 1000));
+    ASSERT(0 == wheel.update(timers[2], 40 * 1000 * 1000));
+//..
+// Then, at time 30 seconds, we advance the wheel, and find that the timer of
+// connection 1 is due:
+//..
+    bdlcc::TimingWheel<int>::Pair *front;
+    bsls::Types::Int64             nextKey;
+
+    nextKey = wheel.advanceRaw(&front, 30 * 1000 * 1000);
+    ASSERT(0                == wheel.remove(front));
+    ASSERT(1                == front->data());
+    ASSERT(30 * 1000 * 1000 == nextKey);
+    wheel.releaseReferenceRaw(front);
+//..
+// Now, no other timer is due, and the wheel indicates a time, no later than
+// the next key, at which the caller should advance it again:
+//..
+    nextKey = wheel.advanceRaw(&front, 30 * 1000 * 1000);
+    ASSERT(0                 == front);
+    ASSERT(30 * 1000 * 1000  <  nextKey);
+    ASSERT(40 * 1000 * 1000  >= nextKey);
+//..
+// Finally, connection 0 is closed, so we cancel its timer:
+//..
+    ASSERT(0 == wheel.remove(timers[0]));
+    ASSERT(1 == wheel.length());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Items may be added, rescheduled, and removed by several threads
+        //:   while another thread advances the wheel and removes due items.
+        //:
+        //: 2 No item is presented before its key.
+        //:
+        //: 3 Every item is removed exactly once, and no memory is leaked.
+        //
+        // Plan:
+        //: 1 Run several producer threads, each of which adds items, and
+        //:   reschedules and removes two thirds of them, and a consumer thread
+        //:   that advances the wheel and removes due items until the wheel is
+        //:   empty.  Verify that the number of successful removals equals the
+        //:   number of items added.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace TIMINGWHEEL_CASE_5;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj wheel(10, 0, &ta);
+
+            bslmt::Barrier     barrier(k_NUM_THREADS + 1);
+            bslmt::ThreadGroup threadGroup(&ta);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bindS(&ta,
+                                                            &producer,
+                                                            &wheel,
+                                                            &barrier,
+                                                            i + 1));
+            }
+
+            bslmt::ThreadGroup consumerGroup(&ta);
+            consumerGroup.addThread(bdlf::BindUtil::bindS(&ta,
+                                                          &consumer,
+                                                          &wheel,
+                                                          &barrier));
+
+            threadGroup.joinAll();
+            s_done = true;
+            consumerGroup.joinAll();
+
+            ASSERTV(s_numRemoved,
+                    k_NUM_THREADS * k_NUM_ITERATIONS == s_numRemoved);
+            ASSERT(wheel.isEmpty());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING REFERENCES AND 'removeAll'
+        //
+        // Concerns:
+        //: 1 A reference to an item remains valid after the item is removed,
+        //:   and the item is destroyed when the last reference is released.
+        //:
+        //: 2 Handles may be default constructed, copied, assigned, and
+        //:   released, and 'isValid' reflects whether a handle refers to an
+        //:   item.
+        //:
+        //: 3 'removeAll' removes every item, including due items, and returns
+        //:   the number of items removed.
+        //:
+        //: 4 The allocator supplied at construction is used for nodes and
+        //:   passed to the 'DATA' values, and the default allocator is not
+        //:   used.
+        //
+        // Plan:
+        //: 1 Using a wheel of 'bsl::string' values and a test allocator,
+        //:   add items, hold references to some of them, remove all items,
+        //:   and verify the values remain accessible until the references are
+        //:   released.  Verify the allocator's blocks in use throughout.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   int removeAll();
+        //   Pair *addPairReferenceRaw(const Pair *reference) const;
+        //   bslma::Allocator *allocator() const;
+        //   TimingWheelPairHandle();
+        //   TimingWheelPairHandle(const TimingWheelPairHandle& original);
+        //   TimingWheelPairHandle& operator=(const TimingWheelPairHandle&);
+        //   void release();
+        //   bool isValid() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING REFERENCES AND 'removeAll'" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            const bsl::string LONG_STRING(
+                             "a string long enough to allocate memory", &ta);
+
+            StringObj wheel(1, 0, &ta);
+            ASSERT(&ta == wheel.allocator());
+
+            StringObj::PairHandle h1;
+            ASSERT(!h1.isValid());
+            ASSERT(0 == static_cast<const StringObj::Pair *>(h1));
+
+            wheel.add(&h1, 5, LONG_STRING);
+            ASSERT(h1.isValid());
+            ASSERT(&ta == h1.data().get_allocator().mechanism());
+
+            StringObj::PairHandle h2(h1);
+            ASSERT(h2.isValid());
+            ASSERT(static_cast<const StringObj::Pair *>(h1) ==
+                   static_cast<const StringObj::Pair *>(h2));
+
+            StringObj::PairHandle h3;
+            h3 = h2;
+            ASSERT(h3.isValid());
+            h3 = h3;
+            ASSERT(h3.isValid());
+
+            StringObj::Pair *raw;
+            wheel.addRaw(&raw, -100, LONG_STRING);
+            StringObj::Pair *raw2 = wheel.addPairReferenceRaw(raw);
+            ASSERT(raw == raw2);
+
+            for (int i = 0; i < 100; ++i) {
+                wheel.addRaw(0, i * 1000, LONG_STRING);
+            }
+            ASSERT(102 == wheel.length());
+
+            // Make the item at key -100 due.
+
+            StringObj::Pair *front;
+            ASSERT(-100 == wheel.advanceRaw(&front, 0));
+            ASSERT(raw  == front);
+            wheel.releaseReferenceRaw(front);
+
+            const Int64 inUse = ta.numBlocksInUse();
+
+            ASSERT(102 == wheel.removeAll());
+            ASSERT(0   == wheel.length());
+            ASSERT(wheel.isEmpty());
+            ASSERT(0   == wheel.removeAll());
+
+            ASSERTV(inUse, ta.numBlocksInUse(), inUse > ta.numBlocksInUse());
+
+            ASSERT(LONG_STRING == h1.data());
+            ASSERT(5           == h3.key());
+            ASSERT(LONG_STRING == raw->data());
+            ASSERT(StringObj::e_NOT_FOUND == wheel.remove(h1));
+            ASSERT(StringObj::e_NOT_FOUND == wheel.remove(raw));
+            ASSERT(StringObj::e_NOT_FOUND == wheel.update(raw, 7));
+
+            const Int64 inUse2 = ta.numBlocksInUse();
+
+            h1.release();
+            ASSERT(!h1.isValid());
+            h2.release();
+            ASSERT(inUse2 == ta.numBlocksInUse());
+            h3.release();
+            ASSERT(inUse2 >  ta.numBlocksInUse());
+
+            const Int64 inUse3 = ta.numBlocksInUse();
+
+            wheel.releaseReferenceRaw(raw);
+            ASSERT(inUse3 == ta.numBlocksInUse());
+            wheel.releaseReferenceRaw(raw2);
+            ASSERT(inUse3 >  ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'update'
+        //
+        // Concerns:
+        //: 1 'update' moves an item to the tick of its new key, whether the
+        //:   new key is earlier or later, and whether or not the item is due.
+        //:
+        //: 2 'newFrontFlag' is 'true' exactly when the new key is earlier than
+        //:   the key most recently returned by 'advanceRaw', and only for the
+        //:   first such change after that call.
+        //:
+        //: 3 'update' and 'remove' return 'e_INVALID' for a null reference.
+        //
+        // Plan:
+        //: 1 Add items, reschedule them, and advance the wheel, verifying the
+        //:   items presented and the flags loaded.  (C-1..3)
+        //
+        // Testing:
+        //   int update(const Pair *reference, Int64 newKey, bool * = 0);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'update'" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj wheel(10, 0, &ta);
+
+            ASSERT(Obj::e_INVALID == wheel.update(0, 5));
+            ASSERT(Obj::e_INVALID == wheel.remove(0));
+
+            bool newFront;
+
+            PairHandle h1, h2;
+            wheel.add(&h1, 1000, 1, &newFront);
+            ASSERT(newFront);   // the wheel has never been advanced
+            wheel.add(&h2, 2000, 2, &newFront);
+
+            Pair *front;
+            Int64 next = wheel.advanceRaw(&front, 0);
+            ASSERT(0 == front);
+            ASSERTV(next, 0 < next && next <= 1000);
+
+            // Move 'h2' earlier than the returned key.
+
+            ASSERT(0 == wheel.update(h2, -5, &newFront));
+            ASSERT(newFront);
+            ASSERT(0 == wheel.update(h1, -7, &newFront));
+            ASSERT(!newFront);  // consumer already to be woken
+
+            next = wheel.advanceRaw(&front, 0);
+            ASSERT(0 != front);
+            ASSERT(next == front->key());
+            wheel.releaseReferenceRaw(front);
+
+            // Both are due; move 'h1' later, and it is no longer due.
+
+            ASSERT(0 == wheel.update(h1, 55, &newFront));
+            ASSERT(!newFront);
+
+            next = wheel.advanceRaw(&front, 0);
+            ASSERT(h2 == front);
+            ASSERT(-5 == next);
+            ASSERT(0 == wheel.remove(front));
+            wheel.releaseReferenceRaw(front);
+
+            // The item is due at the next tick boundary, 60.
+
+            next = wheel.advanceRaw(&front, 50);
+            ASSERT(0 == front);
+            ASSERTV(next, 50 < next && next <= 60);
+
+            next = wheel.advanceRaw(&front, 59);
+            ASSERT(0 == front);
+
+            next = wheel.advanceRaw(&front, 60);
+            ASSERT(h1 == front);
+            ASSERT(55 == next);
+            wheel.releaseReferenceRaw(front);
+
+            // Move a due item far into the future.
+
+            const Int64 FAR_KEY = 1000LL * 1000 * 1000 * 1000 * 1000 * 1000;
+
+            ASSERT(0 == wheel.update(h1, FAR_KEY));
+            next = wheel.advanceRaw(&front, 1000 * 1000);
+            ASSERT(0 == front);
+            ASSERTV(next, 1000 * 1000 < next && next <= FAR_KEY);
+
+            next = wheel.advanceRaw(&front, FAR_KEY - 1);
+            ASSERT(0 == front);
+
+            next = wheel.advanceRaw(&front, FAR_KEY);
+            ASSERT(h1 == front);
+            wheel.releaseReferenceRaw(front);
+
+            ASSERT(0 == wheel.remove(h1));
+            ASSERT(Obj::e_NOT_FOUND == wheel.remove(h1));
+            ASSERT(Obj::e_NOT_FOUND == wheel.update(h1, 5));
+            ASSERT(LLONG_MAX == wheel.advanceRaw(&front, FAR_KEY));
+            ASSERT(0 == front);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'advanceRaw'
+        //
+        // Concerns:
+        //: 1 No item is presented before the tick of its key has been reached.
+        //:
+        //: 2 Every item whose tick has been reached is presented.
+        //:
+        //: 3 When no item is due, the returned key is later than the current
+        //:   time and not later than the time at which the earliest item in
+        //:   the wheel becomes due, or is 'LLONG_MAX' if the wheel is empty.
+        //:
+        //: 4 The above hold for negative keys, keys at the extremes of the
+        //:   range, large and small advances, and several resolutions,
+        //:   including across the boundaries of every level.
+        //:
+        //: 5 Advancing to an earlier time has no effect.
+        //
+        // Plan:
+        //: 1 For each of several resolutions and starting keys, add items with
+        //:   keys of randomly chosen magnitude relative to the start, and
+        //:   advance the wheel by randomly chosen amounts, removing each
+        //:   presented item.  Model the wheel with a vector of the keys of
+        //:   the items not yet removed, and verify each result against the
+        //:   model.  (C-1..5)
+        //
+        // Testing:
+        //   Int64 advanceRaw(Pair **front, Int64 now);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'advanceRaw'" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int   d_line;        // source line number
+            Int64 d_resolution;  // resolution of the wheel
+            Int64 d_start;       // starting key
+        } DATA[] = {
+            //LINE  RESOLUTION       START
+            //----  ----------  -------------------
+            { L_,            1,                    0 },
+            { L_,            1,                  -10 },
+            { L_,            7,                 1000 },
+            { L_,         1000,               -12345 },
+            { L_,         1000,    1234567890123LL   },
+            { L_,           64,    (1LL << 36) - 100 },
+            { L_,            1,  -(1LL << 62)        },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        enum { k_NUM_ITEMS = 500 };
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE       = DATA[ti].d_line;
+            const Int64 RESOLUTION = DATA[ti].d_resolution;
+            const Int64 START      = DATA[ti].d_start;
+
+            if (veryVerbose) { P_(LINE) P_(RESOLUTION) P(START) }
+
+            Uint64 state = ti + 1;
+
+            Obj wheel(RESOLUTION, START, &ta);
+            ASSERT(RESOLUTION == wheel.resolution());
+
+            bsl::vector<Int64> model(&ta);  // index is the item's data
+            bsl::vector<bool>  removed(&ta);
+
+            for (int i = 0; i < k_NUM_ITEMS; ++i) {
+                // Choose a magnitude of up to 2^42 ticks, so that every level
+                // up to 7 is exercised, and some keys before 'START'.
+
+                const int   bits   = static_cast<int>(nextRandom(&state) % 43);
+                const Int64 offset = static_cast<Int64>(
+                                       nextRandom(&state) % (1ULL << bits));
+                const Int64 key    = 0 == i % 10
+                                     ? START - offset
+                                     : START + offset * RESOLUTION
+                                             + offset % RESOLUTION;
+
+                wheel.addRaw(0, key, i);
+                model.push_back(key);
+                removed.push_back(false);
+            }
+
+            // One item at each extreme of the range.
+
+            wheel.addRaw(0, LLONG_MAX, k_NUM_ITEMS);
+            model.push_back(LLONG_MAX);
+            removed.push_back(false);
+            wheel.addRaw(0, LLONG_MIN, k_NUM_ITEMS + 1);
+            model.push_back(LLONG_MIN);
+            removed.push_back(false);
+
+            int   numRemaining = static_cast<int>(model.size());
+            Int64 now          = START;
+
+            while (0 < numRemaining) {
+                const Int64 reached = floorTick(now, RESOLUTION);
+
+                Pair  *front;
+                Int64  next = wheel.advanceRaw(&front, now);
+
+                if (front) {
+                    const int   id  = front->data();
+                    const Int64 key = front->key();
+
+                    ASSERTV(LINE, id, !removed[id]);
+                    ASSERTV(LINE, id, key, model[id] == key);
+                    ASSERTV(LINE, key, next, key == next);
+                    ASSERTV(LINE, key, now,
+                            dueTick(key, RESOLUTION) <= reached);
+
+                    ASSERT(0 == wheel.remove(front));
+                    wheel.releaseReferenceRaw(front);
+
+                    removed[id] = true;
+                    --numRemaining;
+                    ASSERT(numRemaining == wheel.length());
+                    continue;
+                }
+
+                // Nothing is due: every remaining item is in the future.
+
+                Int64 earliest = LLONG_MAX;  // earliest due tick
+                for (int i = 0; i < static_cast<int>(model.size()); ++i) {
+                    if (removed[i]) {
+                        continue;
+                    }
+                    const Int64 tick = dueTick(model[i], RESOLUTION);
+
+                    ASSERTV(LINE, i, model[i], now, tick > reached);
+                    if (tick < earliest) {
+                        earliest = tick;
+                    }
+                }
+                ASSERTV(LINE, next, earliest,
+                        LLONG_MAX == earliest
+                     || next <= earliest * RESOLUTION);
+                ASSERTV(LINE, next, now, next > now);
+
+                // Advancing to an earlier time has no effect.
+
+                Int64 again = wheel.advanceRaw(&front, now - 1000);
+                ASSERTV(LINE, 0 == front);
+                ASSERTV(LINE, again, next, again == next);
+
+                // Advance either to the returned key, or part of the way.
+
+                if (LLONG_MAX == next || 0 == nextRandom(&state) % 2) {
+                    now = next;
+                }
+                else {
+                    const Uint64 distance = static_cast<Uint64>(next)
+                                          - static_cast<Uint64>(now);
+                    now += static_cast<Int64>(nextRandom(&state) % distance);
+                }
+            }
+
+            Pair *front;
+            ASSERT(wheel.isEmpty());
+            ASSERT(LLONG_MAX == wheel.advanceRaw(&front, now));
+            ASSERT(0         == front);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add, access, advance, and remove a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   TimingWheel(Int64 resolution, Int64 currentKey, Allocator *bA);
+        //   ~TimingWheel();
+        //   void add(PairHandle *, Int64 key, const DATA&, bool * = 0);
+        //   void addRaw(Pair **, Int64 key, const DATA&, bool * = 0);
+        //   int remove(const Pair *reference);
+        //   void releaseReferenceRaw(const Pair *reference);
+        //   bool isEmpty() const;
+        //   int length() const;
+        //   Int64 resolution() const;
+        //   operator const Pair*() const;
+        //   DATA& data() const;
+        //   const Int64& key() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            Obj wheel(1, 0, &ta);
+            ASSERT(wheel.isEmpty());
+            ASSERT(0 == wheel.length());
+            ASSERT(1 == wheel.resolution());
+
+            PairHandle h1;
+            wheel.add(&h1, 10, 1);
+            ASSERT(10 == h1.key());
+            ASSERT(1  == h1.data());
+
+            Pair *raw;
+            wheel.addRaw(&raw, 5, 2);
+            ASSERT(5 == raw->key());
+            ASSERT(2 == raw->data());
+
+            ASSERT(!wheel.isEmpty());
+            ASSERT(2 == wheel.length());
+
+            Pair  *front;
+            Int64  next = wheel.advanceRaw(&front, 4);
+            ASSERT(0 == front);
+            ASSERTV(next, 5 == next);
+
+            next = wheel.advanceRaw(&front, 5);
+            ASSERT(raw == front);
+            ASSERT(5   == next);
+            ASSERT(0   == wheel.remove(front));
+            wheel.releaseReferenceRaw(front);
+            ASSERT(1   == wheel.length());
+
+            next = wheel.advanceRaw(&front, 9);
+            ASSERT(0  == front);
+            ASSERT(10 == next);
+
+            ASSERT(0 == wheel.remove(h1));
+            ASSERT(wheel.isEmpty());
+
+            next = wheel.advanceRaw(&front, 100);
+            ASSERT(0         == front);
+            ASSERT(LLONG_MAX == next);
+
+            wheel.releaseReferenceRaw(raw);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
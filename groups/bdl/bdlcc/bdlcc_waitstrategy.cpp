@@ -0,0 +1,47 @@
+// bdlcc_waitstrategy.cpp                                             -*-C++-*-
+#include <bdlcc_waitstrategy.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_waitstrategy_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                            // -------------------
+                            // struct WaitStrategy
+                            // -------------------
+
+// CLASS METHODS
+const char *WaitStrategy::toAscii(Enum value)
+{
+#define CASE(X) case(e_ ## X): return #X;
+
+    switch (value) {
+      CASE(BLOCK)
+      CASE(SPIN)
+      CASE(SPIN_THEN_YIELD)
+      CASE(SPIN_THEN_BLOCK)
+      default: return "(* UNKNOWN *)";
+    }
+
+#undef CASE
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
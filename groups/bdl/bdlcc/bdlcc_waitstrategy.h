@@ -0,0 +1,222 @@
+// bdlcc_waitstrategy.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_WAITSTRATEGY
+#define INCLUDED_BDLCC_WAITSTRATEGY
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an enumeration of the ways a queue may wait for elements.
+//
+//@CLASSES:
+//  bdlcc::WaitStrategy: namespace for strategies of waiting consumers
+//
+//@SEE_ALSO: bdlcc_fixedqueue, bdlcc_singleconsumerqueue,
+//           bdlcc_singleproducersingleconsumerboundedqueue
+//
+//@DESCRIPTION: This component provides a namespace, 'bdlcc::WaitStrategy',
+// for enumerating the ways in which a consumer of a 'bdlcc' queue may wait
+// for an element to become available, along with a function, 'pause', that
+// implements one step of that waiting, and a function, 'toAscii', that
+// converts each enumerator to its string representation.
+//
+///Wait Strategies
+///---------------
+// By default, a consumer blocked on an empty queue is parked on a condition
+// variable or semaphore, so that it consumes no processor time while it waits,
+// but each wake-up costs a system call and a context switch.  Latency-critical
+// consumers may instead choose to poll the queue, trading processor time for
+// wake-up latency.  The supported strategies are:
+//..
+//  Strategy             Behavior of a consumer of an empty queue
+//  -------------------  ------------------------------------------------------
+//  e_BLOCK              block until an element is available (the default)
+//
+//  e_SPIN               poll the queue continuously, executing a processor
+//                       "pause" instruction (where available) between polls,
+//                       and never block
+//
+//  e_SPIN_THEN_YIELD    poll the queue 'k_NUM_SPINS' times as for 'e_SPIN',
+//                       then poll the queue continuously, yielding the
+//                       processor between polls, and never block
+//
+//  e_SPIN_THEN_BLOCK    poll the queue 'k_NUM_SPINS' times as for 'e_SPIN',
+//                       then block as for 'e_BLOCK'
+//..
+// Note that, on Linux, blocking is implemented by the underlying
+// synchronization primitives with a 'futex' system call, so
+// 'e_SPIN_THEN_BLOCK' is the classic "spin, then futex" strategy.  Also note
+// that a consumer using 'e_SPIN' or 'e_SPIN_THEN_YIELD' occupies a processor
+// for as long as the queue is empty, and should be used only when there are
+// at least as many processors as polling threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Polling a Flag
+///- - - - - - - - - - - - -
+// Suppose we have a flag that is set by another thread, and we want to wait
+// until it is set, blocking on a semaphore only if the wait strategy calls for
+// it.
+//
+// First, we define the function that waits, where the thread setting the flag
+// also posts the semaphore:
+//..
+//  void waitForFlag(bsls::AtomicBool          *flag,
+//                   bslmt::Semaphore          *semaphore,
+//                   bdlcc::WaitStrategy::Enum  strategy)
+//      // Return when the specified 'flag' is 'true', waiting according to
+//      // the specified 'strategy' and blocking on the specified 'semaphore'
+//      // if 'strategy' calls for blocking.
+//  {
+//      int numWaits = 0;
+//
+//      while (!*flag) {
+//          if (!bdlcc::WaitStrategy::pause(strategy, &numWaits)) {
+//              semaphore->wait();
+//              numWaits = 0;
+//          }
+//      }
+//  }
+//..
+// Then, we set the flag, and post the semaphore, from another thread:
+//..
+//  void setFlag(bsls::AtomicBool *flag, bslmt::Semaphore *semaphore)
+//      // Set the specified 'flag' to 'true' and post the specified
+//      // 'semaphore'.
+//  {
+//      *flag = true;
+//      semaphore->post();
+//  }
+//..
+// Finally, we wait for the flag with the spin-then-block strategy:
+//..
+//  bsls::AtomicBool flag(false);
+//  bslmt::Semaphore semaphore;
+//
+//  bslmt::ThreadGroup threadGroup;
+//  threadGroup.addThread(bdlf::BindUtil::bind(&setFlag, &flag, &semaphore));
+//
+//  waitForFlag(&flag, &semaphore, bdlcc::WaitStrategy::e_SPIN_THEN_BLOCK);
+//  assert(flag);
+//
+//  threadGroup.joinAll();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                            // ===================
+                            // struct WaitStrategy
+                            // ===================
+
+struct WaitStrategy {
+    // This 'struct' provides a namespace for enumerating the ways in which a
+    // consumer of a queue may wait for an element to become available.
+
+    // TYPES
+    enum Enum {
+        e_BLOCK,            // block (the default)
+        e_SPIN,             // spin, never block
+        e_SPIN_THEN_YIELD,  // spin, then yield, never block
+        e_SPIN_THEN_BLOCK   // spin, then block
+    };
+
+    // CONSTANTS
+    enum {
+        k_NUM_SPINS = 1024  // number of spins before yielding or blocking
+    };
+
+    // CLASS METHODS
+    static bool pause(Enum strategy, int *numWaits);
+        // Wait briefly, as specified by the specified 'strategy' for the
+        // waiting step indicated by the specified 'numWaits', and update
+        // 'numWaits' to indicate the next step.  Return 'true' if the caller
+        // should poll again, and 'false', without waiting or modifying
+        // 'numWaits', if the caller should block instead.  The behavior is
+        // undefined unless '0 <= *numWaits'.  Note that '*numWaits' should be
+        // 0 before the first invocation of a sequence of waits, and that
+        // '*numWaits' never exceeds 'k_NUM_SPINS'.
+
+    static const char *toAscii(Enum value);
+        // Return the non-modifiable string representation corresponding to
+        // the specified enumeration 'value', if it exists, and a unique
+        // (error) string otherwise.  The string representation of 'value'
+        // matches its corresponding enumerator name with the "e_" prefix
+        // elided.  For example:
+        //..
+        //  bsl::cout << WaitStrategy::toAscii(WaitStrategy::e_SPIN);
+        //..
+        // will print the following on standard output:
+        //..
+        //  SPIN
+        //..
+        // Note that specifying a 'value' that does not match any of the
+        // enumerators will result in a string representation that is distinct
+        // from any of those corresponding to the enumerators, but is otherwise
+        // unspecified.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct WaitStrategy
+                            // -------------------
+
+// CLASS METHODS
+inline
+bool WaitStrategy::pause(Enum strategy, int *numWaits)
+{
+    if (k_NUM_SPINS > *numWaits) {
+        if (e_BLOCK == strategy) {
+            return false;                                             // RETURN
+        }
+        ++*numWaits;
+    }
+    else if (e_SPIN_THEN_YIELD == strategy) {
+        bslmt::ThreadUtil::yield();
+        return true;                                                  // RETURN
+    }
+    else if (e_SPIN != strategy) {
+        return false;                                                 // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    _mm_pause();
+#endif
+
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
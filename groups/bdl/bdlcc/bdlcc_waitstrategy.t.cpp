@@ -0,0 +1,347 @@
+// bdlcc_waitstrategy.t.cpp                                           -*-C++-*-
+
+#include <bdlcc_waitstrategy.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides an enumeration, and a function, 'pause',
+// that implements one step of waiting according to an enumerator.  We verify
+// the string representation of each enumerator, and then verify the sequence
+// of results returned by 'pause' for each enumerator.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool pause(Enum strategy, int *numWaits);
+// [ 1] const char *toAscii(Enum value);
+// ----------------------------------------------------------------------------
+// [ 3] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::WaitStrategy Obj;
+typedef Obj::Enum           Enum;
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Polling a Flag
+///- - - - - - - - - - - - -
+// Suppose we have a flag that is set by another thread, and we want to wait
+// until it is set, blocking on a semaphore only if the wait strategy calls for
+// it.
+//
+// First, we define the function that waits, where the thread setting the flag
+// also posts the semaphore:
+//..
+    void waitForFlag(bsls::AtomicBool          *flag,
+                     bslmt::Semaphore          *semaphore,
+                     bdlcc::WaitStrategy::Enum  strategy)
+        // Return when the specified 'flag' is 'true', waiting according to
+        // the specified 'strategy' and blocking on the specified 'semaphore'
+        // if 'strategy' calls for blocking.
+    {
+        int numWaits = 0;
+
+        while (!*flag) {
+            if (!bdlcc::WaitStrategy::pause(strategy, &numWaits)) {
+                semaphore->wait();
+                numWaits = 0;
+            }
+        }
+    }
+//..
+// Then, we set the flag, and post the semaphore, from another thread:
+//..
+    void setFlag(bsls::AtomicBool *flag, bslmt::Semaphore *semaphore)
+        // Set the specified 'flag' to 'true' and post the specified
+        // 'semaphore'.
+    {
+        *flag = true;
+        semaphore->post();
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Finally, we wait for the flag with the spin-then-block strategy:
+//..
+    bsls::AtomicBool flag(false);
+    bslmt::Semaphore semaphore;
+
+    bslmt::ThreadGroup threadGroup;
+    threadGroup.addThread(bdlf::BindUtil::bind(&setFlag, &flag, &semaphore));
+
+    waitForFlag(&flag, &semaphore, bdlcc::WaitStrategy::e_SPIN_THEN_BLOCK);
+    ASSERT(flag);
+
+    threadGroup.joinAll();
+//..
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'pause'
+        //
+        // Concerns:
+        //: 1 'pause' returns 'false', with no effect on 'numWaits', for
+        //:   'e_BLOCK'.
+        //:
+        //: 2 'pause' returns 'true' 'k_NUM_SPINS' times, incrementing
+        //:   'numWaits' each time, for every other strategy.
+        //:
+        //: 3 Once 'numWaits' is 'k_NUM_SPINS', 'pause' returns 'true' for
+        //:   'e_SPIN' and 'e_SPIN_THEN_YIELD' and 'false' for
+        //:   'e_SPIN_THEN_BLOCK', with no effect on 'numWaits'.
+        //
+        // Plan:
+        //: 1 For each enumerator, invoke 'pause' repeatedly, starting with
+        //:   'numWaits' of 0, and verify the result and 'numWaits' after each
+        //:   invocation.  (C-1..3)
+        //
+        // Testing:
+        //   bool pause(Enum strategy, int *numWaits);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'pause'" << endl
+                          << "===============" << endl;
+
+        static const struct {
+            int  d_line;      // source line number
+            Enum d_strategy;  // strategy
+            bool d_spins;     // 'true' if 'pause' spins initially
+            bool d_polls;     // 'true' if 'pause' never returns 'false'
+        } DATA[] = {
+            //LINE  STRATEGY                SPINS  POLLS
+            //----  ----------------------  -----  -----
+            { L_,   Obj::e_BLOCK,           false, false },
+            { L_,   Obj::e_SPIN,            true,  true  },
+            { L_,   Obj::e_SPIN_THEN_YIELD, true,  true  },
+            { L_,   Obj::e_SPIN_THEN_BLOCK, true,  false },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE     = DATA[ti].d_line;
+            const Enum STRATEGY = DATA[ti].d_strategy;
+            const bool SPINS    = DATA[ti].d_spins;
+            const bool POLLS    = DATA[ti].d_polls;
+
+            if (veryVerbose) { P_(LINE) P(Obj::toAscii(STRATEGY)) }
+
+            int numWaits = 0;
+
+            if (!SPINS) {
+                ASSERTV(LINE, false == Obj::pause(STRATEGY, &numWaits));
+                ASSERTV(LINE, numWaits, 0 == numWaits);
+                continue;
+            }
+
+            for (int i = 0; i < Obj::k_NUM_SPINS; ++i) {
+                ASSERTV(LINE, i, true == Obj::pause(STRATEGY, &numWaits));
+                ASSERTV(LINE, i, numWaits, i + 1 == numWaits);
+            }
+
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(LINE, i, POLLS == Obj::pause(STRATEGY, &numWaits));
+                ASSERTV(LINE, i, numWaits, Obj::k_NUM_SPINS == numWaits);
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // TESTING 'toAscii'
+        //
+        // Concerns:
+        //: 1 The string representation of each enumerator is its name without
+        //:   the "e_" prefix.
+        //:
+        //: 2 The string representation of a value that is not an enumerator
+        //:   is distinct from those of the enumerators.
+        //
+        // Plan:
+        //: 1 Verify the string representation of each enumerator, and of
+        //:   values that are not enumerators, using a table.  (C-1..2)
+        //
+        // Testing:
+        //   const char *toAscii(Enum value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'toAscii'" << endl
+                          << "=================" << endl;
+
+        static const struct {
+            int         d_line;   // source line number
+            int         d_value;  // enumerator value
+            const char *d_exp;    // expected result
+        } DATA[] = {
+            //LINE  VALUE                   EXPECTED
+            //----  ----------------------  -----------------
+            { L_,   Obj::e_BLOCK,           "BLOCK"           },
+            { L_,   Obj::e_SPIN,            "SPIN"            },
+            { L_,   Obj::e_SPIN_THEN_YIELD, "SPIN_THEN_YIELD" },
+            { L_,   Obj::e_SPIN_THEN_BLOCK, "SPIN_THEN_BLOCK" },
+            { L_,   4,                      "(* UNKNOWN *)"   },
+            { L_,   -1,                     "(* UNKNOWN *)"   },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE  = DATA[ti].d_line;
+            const Enum  VALUE = static_cast<Enum>(DATA[ti].d_value);
+            const char *EXP   = DATA[ti].d_exp;
+
+            const char *result = Obj::toAscii(VALUE);
+
+            if (veryVerbose) { P_(LINE) P(result) }
+
+            ASSERTV(LINE, result, EXP, 0 == bsl::strcmp(EXP, result));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
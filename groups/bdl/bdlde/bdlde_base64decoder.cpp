@@ -13,9 +13,12 @@
 BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bdlde_base64encoder.h>  // for testing only
+#include <bdlde_base64util.h>
 
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 
                 // ======================
@@ -93,6 +96,11 @@ static const char decoding[256] = {
        ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
 };
 
+static const int k_BULK_THRESHOLD = 64;
+    // minimum number of input characters for which 'convert' uses
+    // 'Base64Util::decodeQuanta'; below this, the character-at-a-time loop is
+    // faster
+
 namespace bdlde {
 
                          // -------------------
@@ -106,6 +114,62 @@ const bool *const Base64Decoder::s_ignorableRelaxed_p =
                                             charsThatCanBeIgnoredInRelaxedMode;
 const char *const Base64Decoder::s_decoding_p = decoding;
 
+// PRIVATE MANIPULATORS
+int Base64Decoder::decodeBulk(int         *numOut,
+                              char       **out,
+                              const char **begin,
+                              const char  *end)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin);
+
+    if (end - *begin < k_BULK_THRESHOLD
+     || 0 != d_bitsInStack
+     || 0 != (d_outputLength + *numOut) % 3) {
+        return 0;                                                     // RETURN
+    }
+
+    const char *input = *begin;
+
+    while (true) {
+        const bsl::size_t numQuanta = Base64Util::decodeQuanta(
+                                                           *out,
+                                                           input,
+                                                           (end - input) / 4);
+
+        input   += 4 * numQuanta;
+        *out    += 3 * numQuanta;
+        *numOut += static_cast<int>(3 * numQuanta);
+
+        // Skip ignorable characters (e.g., soft line breaks) between groups.
+
+        const char *next = input;
+        while (next != end
+            && d_ignorable_p[static_cast<unsigned char>(*next)]) {
+            ++next;
+        }
+
+        if (0 == numQuanta && next == input) {
+            break;
+        }
+        input = next;
+    }
+
+    const int numIn = static_cast<int>(input - *begin);
+
+    *begin = input;
+    return numIn;
+}
+
+int Base64Decoder::decodeBulk(int *numOut, char **out, char **begin, char *end)
+{
+    const char *constBegin = *begin;
+    const int   numIn      = decodeBulk(numOut, out, &constBegin, end);
+
+    *begin += numIn;
+    return numIn;
+}
 
 // CREATORS
 
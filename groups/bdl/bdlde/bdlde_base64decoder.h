@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlde::Base64Decoder: automata performing Base64 decoding operations
 //
-//@SEE_ALSO: 'bdlde_base64encoder'
+//@SEE_ALSO: 'bdlde_base64encoder', 'bdlde_base64util'
 //
 //@DESCRIPTION: This component a 'class', 'bdlde::Base64Decoder', which
 // provides a pair of template functions (each parameterized separately on both
@@ -153,6 +153,17 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Performance
+///-----------
+// When 'convert' is supplied a large input as a range of 'char' pointers, and
+// an output 'char' pointer with no output limit, whole groups of 4 characters
+// are decoded using the vector implementations of 'bdlde_base64util'.
+// Ignorable characters between groups (e.g., the soft line breaks produced by
+// 'bdlde::Base64Encoder' for a maximum line length that is a multiple of 4)
+// are skipped without leaving this fast path.  Supplying the data in as few
+// calls as possible, through pointers, therefore yields the highest
+// throughput.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Decoder' object to
@@ -453,6 +464,35 @@ class Base64Decoder {
     Base64Decoder(const Base64Decoder&);
     Base64Decoder& operator=(const Base64Decoder&);
 
+    // PRIVATE MANIPULATORS
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int decodeBulk(int             *numOut,
+                   OUTPUT_ITERATOR *out,
+                   INPUT_ITERATOR  *begin,
+                   INPUT_ITERATOR   end);
+    int decodeBulk(int         *numOut,
+                   char       **out,
+                   const char **begin,
+                   const char  *end);
+    int decodeBulk(int *numOut, char **out, char **begin, char *end);
+        // Decode, using 'Base64Util::decodeQuanta', as many complete groups
+        // of 4 Base64 characters (skipping ignorable characters between
+        // groups) as possible from the input sequence starting at the
+        // specified 'begin' position up to the specified 'end' position,
+        // writing the output to the specified 'out', advance 'begin' and
+        // 'out' past the input consumed and the output produced, add the
+        // number of bytes produced to the specified 'numOut', and return the
+        // number of input characters consumed.  Stop before the first group
+        // that contains a character that is neither in the Base64 alphabet
+        // nor ignorable (including '='), or that is interrupted by an
+        // ignorable character, leaving it to the character-at-a-time
+        // automaton.  Consume no input (and return 0) unless 'out' and
+        // 'begin' are pointers, the input is long enough to benefit from bulk
+        // conversion, and the input consumed so far (including the output
+        // counted by 'numOut') ends on a group boundary.  The behavior is
+        // undefined unless this decoder is in the input state and no limit is
+        // imposed on the number of output bytes.
+
   public:
     // CLASS METHODS
     static int maxDecodedLength(int inputLength);
@@ -579,6 +619,15 @@ class Base64Decoder {
                             // class Base64Decoder
                             // -------------------
 
+// PRIVATE MANIPULATORS
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int Base64Decoder::decodeBulk(int *, OUTPUT_ITERATOR *, INPUT_ITERATOR *,
+                              INPUT_ITERATOR)
+{
+    return 0;
+}
+
 // CLASS METHODS
 inline
 int Base64Decoder::maxDecodedLength(int inputLength)
@@ -647,6 +696,10 @@ int Base64Decoder::convert(OUTPUT_ITERATOR  out,
     *numIn = 0;
 
     if (e_INPUT_STATE == d_state) {
+        if (maxNumOut < 0) {
+            *numIn = decodeBulk(&numEmitted, &out, &begin, end);
+        }
+
         while (18 >= d_bitsInStack && begin != end) {
             const unsigned char byte = static_cast<unsigned char>(*begin);
 
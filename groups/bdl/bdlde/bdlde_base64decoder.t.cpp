@@ -190,6 +190,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
 //*[11] USAGE EXAMPLE
+// [12] BULK CONVERSION
 // [ ?] That the input iterator can have *minimal* functionality.
 // [ ?] That the output iterator can have *minimal* functionality.
 // [ ?] That there is no default constructor.
@@ -1209,6 +1210,141 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(12)
+{
+        (void)veryVerbose;
+        (void)veryVeryVerbose;
+        (void)veryVeryVeryVerbose;
+
+        // --------------------------------------------------------------------
+        // BULK CONVERSION
+        //
+        // Concerns:
+        //: 1 When 'convert' is given pointers to a large input and an
+        //:   unlimited output (so that whole groups are decoded using
+        //:   'bdlde::Base64Util'), the output, return value, number of
+        //:   characters consumed and produced, and the resulting state are
+        //:   the same as those produced by the character-at-a-time automaton.
+        //:
+        //: 2 Soft line breaks of any length, ignorable characters anywhere,
+        //:   padding, and invalid characters are handled as by the automaton.
+        //:
+        //: 3 Bulk conversion resumes correctly after a partial group has
+        //:   been supplied in a previous call.
+        //
+        // Plan:
+        //: 1 Encode pseudo-random data of various lengths with various
+        //:   maximum line lengths; optionally replace one character with each
+        //:   of several special characters.  For each such input, in both
+        //:   error-reporting modes, and after first supplying a prefix of
+        //:   0 to 5 characters, decode the rest in one call into a 'char *'
+        //:   buffer, and also (disabling the bulk path) into a
+        //:   'bsl::back_insert_iterator', and compare all observable
+        //:   results.  (C-1..3)
+        //
+        // Testing:
+        //   BULK CONVERSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK CONVERSION" << endl
+                          << "===============" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 4, 8, 76, 3, 5, 77 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                   / sizeof *LINE_LENGTHS;
+
+        static const char SPECIALS[] = { ' ', '\n', '=', '*', '\x80' };
+        const int NUM_SPECIALS = sizeof SPECIALS / sizeof *SPECIALS;
+
+        bsl::string data;
+        unsigned int seed = 1;
+        for (int i = 0; i < 400; ++i) {
+            seed = seed * 1103515245 + 12345;
+            data.push_back(static_cast<char>(seed >> 16));
+        }
+
+        for (int length = 0; length <= 400; length += 7) {
+        for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+            bdlde::Base64Encoder encoder(LINE_LENGTHS[li]);
+            bsl::string          encoded;
+
+            encoder.convert(bsl::back_inserter(encoded),
+                            data.data(),
+                            data.data() + length);
+            encoder.endConvert(bsl::back_inserter(encoded));
+
+            const int ENCODED_LENGTH = static_cast<int>(encoded.length());
+
+            for (int si = -1; si < NUM_SPECIALS; ++si) {
+            for (int pos = 0; pos < ENCODED_LENGTH; pos += 11) {
+                bsl::string input(encoded);
+                if (0 <= si) {
+                    input[pos] = SPECIALS[si];
+                }
+                else if (pos) {
+                    break;
+                }
+
+            for (int strict = 0; strict < 2; ++strict) {
+            for (int prefix = 0; prefix <= 5 && prefix <= ENCODED_LENGTH;
+                                                                   ++prefix) {
+                const char *BEGIN = input.data();
+                const char *END   = input.data() + input.length();
+
+                Obj         x(strict);
+                Obj         y(strict);
+                bsl::string expected;
+                char        buffer[512];
+                char       *out = buffer;
+                int         numOutX, numInX, numOutY, numInY;
+
+                int rcX = x.convert(out, &numOutX, &numInX,
+                                    BEGIN, BEGIN + prefix);
+                int rcY = y.convert(bsl::back_inserter(expected),
+                                    &numOutY, &numInY,
+                                    BEGIN, BEGIN + prefix);
+                out += numOutX;
+
+                LOOP4_ASSERT(length, li, si, pos, rcY == rcX);
+
+                rcX = x.convert(out, &numOutX, &numInX, BEGIN + prefix, END);
+                rcY = y.convert(bsl::back_inserter(expected),
+                                &numOutY, &numInY,
+                                BEGIN + prefix, END);
+                out += numOutX;
+
+                LOOP4_ASSERT(length, li, si, pos, rcY     == rcX);
+                LOOP4_ASSERT(length, li, si, pos, numOutY == numOutX);
+                LOOP4_ASSERT(length, li, si, pos, numInY  == numInX);
+
+                rcX = x.endConvert(out, &numOutX);
+                rcY = y.endConvert(bsl::back_inserter(expected), &numOutY);
+                out += numOutX;
+
+                LOOP4_ASSERT(length, li, si, pos, rcY     == rcX);
+                LOOP4_ASSERT(length, li, si, pos, numOutY == numOutX);
+                LOOP4_ASSERT(length, li, si, pos,
+                             y.outputLength() == x.outputLength());
+                LOOP4_ASSERT(length, li, si, pos,
+                             y.isAcceptable() == x.isAcceptable());
+                LOOP4_ASSERT(length, li, si, pos,
+                             y.isError() == x.isError());
+                LOOP4_ASSERT(length, li, si, pos,
+                             expected == bsl::string(buffer, out));
+
+                if (-1 == si) {
+                    LOOP3_ASSERT(length, li, prefix,
+                                 bsl::string(data.data(), length) == expected);
+                }
+            }
+            }
+            }
+            }
+        }
+        }
+}
+
 DEFINE_TEST_CASE(11)
 {
         (void)veryVeryVerbose;
@@ -5616,6 +5752,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(12);
         CASE(11);
         CASE(10);
         CASE(9);
@@ -12,8 +12,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
+#include <bdlde_base64util.h>
+
 #include <bsls_assert.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 
                 // ======================
@@ -35,6 +39,11 @@ static const char enc[] = {
     '4', '5', '6', '7', '8', '9', '+', '/',  // 070
 };
 
+static const int k_BULK_THRESHOLD = 48;
+    // minimum number of input bytes for which 'convert' uses
+    // 'Base64Util::encodeQuanta'; below this, the byte-at-a-time loop is
+    // faster
+
 namespace bdlde {
 
                          // -------------------
@@ -56,6 +65,65 @@ Base64Encoder::~Base64Encoder()
     BSLS_ASSERT(0 <= d_outputLength);
 }
 
+// PRIVATE MANIPULATORS
+int Base64Encoder::encodeBulk(char **out, const char **begin, const char *end)
+{
+    BSLS_ASSERT(out);
+    BSLS_ASSERT(begin);
+
+    if (end - *begin < k_BULK_THRESHOLD
+     || 0 != d_bitsInStack
+     || 0 != d_maxLineLength % 4
+     || 0 != d_lineLength % 4) {
+        return 0;                                                     // RETURN
+    }
+
+    // Since both 'd_lineLength' and 'd_maxLineLength' are multiples of 4, soft
+    // line breaks fall between groups, and 'd_lineLength' never exceeds
+    // 'd_maxLineLength' (i.e., no '\r' without its '\n' has been emitted).
+
+    bsl::size_t numQuanta = (end - *begin) / 3;
+    const int   numIn     = static_cast<int>(3 * numQuanta);
+
+    while (numQuanta) {
+        bsl::size_t numLineQuanta = numQuanta;
+
+        if (d_maxLineLength) {
+            if (d_lineLength == d_maxLineLength) {
+                (*out)[0]       = '\r';
+                (*out)[1]       = '\n';
+                *out           += 2;
+                d_outputLength += 2;
+                d_lineLength    = 0;
+            }
+
+            const bsl::size_t room = (d_maxLineLength - d_lineLength) / 4;
+            if (room < numLineQuanta) {
+                numLineQuanta = room;
+            }
+        }
+
+        Base64Util::encodeQuanta(*out, *begin, numLineQuanta);
+
+        *out           += 4 * numLineQuanta;
+        *begin         += 3 * numLineQuanta;
+        d_outputLength += static_cast<int>(4 * numLineQuanta);
+        d_lineLength   += static_cast<int>(4 * numLineQuanta);
+        numQuanta      -= numLineQuanta;
+    }
+
+    return numIn;
+}
+
+int Base64Encoder::encodeBulk(char **out, char **begin, char *end)
+{
+    const char *constBegin = *begin;
+    const int   numIn      = encodeBulk(out, &constBegin, end);
+
+    *begin += numIn;
+    return numIn;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -18,7 +18,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  bdlde::Base64Encoder: automata performing Base64 encoding operations
 //
-//@SEE_ALSO: bdlde_base64decoder
+//@SEE_ALSO: bdlde_base64decoder, bdlde_base64util
 //
 //@DESCRIPTION: This component provides a 'class', 'bdlde::Base64Encoder',
 // which provides a pair of template functions (each parameterized separately
@@ -153,6 +153,16 @@ BSLS_IDENT("$Id: $")
 // bytes) of the initial input data sequence before encoding was evenly
 // divisible by 3.
 //
+///Performance
+///-----------
+// When 'convert' is supplied a large input as a range of 'char' pointers, and
+// an output 'char' pointer with no output limit, whole groups of 3 bytes are
+// encoded using the vector implementations of 'bdlde_base64util', provided
+// that the maximum line length is a multiple of 4 (as is the default, 76).
+// Supplying the data in as few calls as possible, through pointers, therefore
+// yields the highest throughput.  Use 'bdlde::Base64Util::encode' directly to
+// encode a complete buffer without soft line breaks.
+//
 ///Usage
 ///-----
 // The following example shows how to use a 'bdlde::Base64Encoder' object to
@@ -454,6 +464,25 @@ class Base64Encoder {
         // does not equal 'maxLength' at entry to this method and the internal
         // buffer contains at least one character of output.
 
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int encodeBulk(OUTPUT_ITERATOR *out,
+                   INPUT_ITERATOR  *begin,
+                   INPUT_ITERATOR   end);
+    int encodeBulk(char **out, const char **begin, const char *end);
+    int encodeBulk(char **out, char **begin, char *end);
+        // Encode, using 'Base64Util::encodeQuanta', as many complete 3-byte
+        // groups as possible from the input sequence starting at the
+        // specified 'begin' position up to the specified 'end' position,
+        // appending the output (including soft line breaks) to the specified
+        // 'out', advance 'begin' and 'out' past the input consumed and the
+        // output produced, and return the number of input bytes consumed.
+        // Consume no input (and return 0) unless 'out' and 'begin' are
+        // pointers, the input is long enough to benefit from bulk conversion,
+        // no output is retained by this encoder, and both the maximum line
+        // length and the current line length are multiples of 4.  The
+        // behavior is undefined unless this encoder is in the initial state
+        // and no limit is imposed on the number of output characters.
+
   public:
     // CLASS METHODS
     static int encodedLength(int inputLength);
@@ -679,6 +708,14 @@ void Base64Encoder::encode(OUTPUT_ITERATOR *out, int maxLength)
     ++d_lineLength;
 }
 
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int Base64Encoder::encodeBulk(OUTPUT_ITERATOR *, INPUT_ITERATOR *,
+                              INPUT_ITERATOR)
+{
+    return 0;
+}
+
 // CLASS METHODS
 inline
 int Base64Encoder::encodedLength(int inputLength, int maxLineLength)
@@ -806,10 +843,15 @@ int Base64Encoder::convert(OUTPUT_ITERATOR  out,
         encode(&out, maxLength);
     }
 
-    // Consume as many input bytes as possible.
+    // Consume as many input bytes as possible, converting whole groups in
+    // bulk when the iterators allow it.
 
     int tmpNumIn = 0;
 
+    if (maxNumOut < 0) {
+        tmpNumIn = encodeBulk(&out, &begin, end);
+    }
+
     while (4 >= d_bitsInStack && begin != end) {
         const unsigned char byte = static_cast<unsigned char>(*begin);
 
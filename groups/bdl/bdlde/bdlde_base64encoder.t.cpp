@@ -113,6 +113,7 @@ using namespace bsl;  // automatically added by script
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST -- (developer's sandbox)
 //*[11] USAGE EXAMPLE
+// [14] BULK CONVERSION
 // [ ?] That the input iterator can have *minimal* functionality.
 // [ ?] That the output iterator can have *minimal* functionality.
 // [ 1] ::myMin(const T& a, const T& b);
@@ -1220,6 +1221,99 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 14: {
+        // --------------------------------------------------------------------
+        // BULK CONVERSION
+        //
+        // Concerns:
+        //: 1 When 'convert' is given pointers to a large input and an
+        //:   unlimited output (so that whole groups are encoded using
+        //:   'bdlde::Base64Util'), the output (including soft line breaks),
+        //:   the number of characters consumed and produced, and the
+        //:   resulting state are the same as those produced by the
+        //:   character-at-a-time automaton.
+        //:
+        //: 2 Bulk conversion resumes correctly after a partial group or a
+        //:   partial line has been supplied in a previous call.
+        //
+        // Plan:
+        //: 1 For inputs of various lengths and various maximum line lengths,
+        //:   after first supplying a prefix of 0 to 9 bytes, encode the rest
+        //:   in one call into a 'char *' buffer, and also (disabling the bulk
+        //:   path) into a 'bsl::back_insert_iterator', and compare all
+        //:   observable results.  (C-1..2)
+        //
+        // Testing:
+        //   BULK CONVERSION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BULK CONVERSION" << endl
+                          << "===============" << endl;
+
+        static const int LINE_LENGTHS[] = { 0, 4, 8, 76, 1, 3, 5, 77 };
+        const int NUM_LINE_LENGTHS = sizeof LINE_LENGTHS
+                                   / sizeof *LINE_LENGTHS;
+
+        bsl::string data;
+        unsigned int seed = 1;
+        for (int i = 0; i < 400; ++i) {
+            seed = seed * 1103515245 + 12345;
+            data.push_back(static_cast<char>(seed >> 16));
+        }
+
+        for (int length = 0; length <= 400; length += 3) {
+        for (int li = 0; li < NUM_LINE_LENGTHS; ++li) {
+        for (int prefix = 0; prefix <= 9 && prefix <= length; ++prefix) {
+            const int   LINE_LENGTH = LINE_LENGTHS[li];
+            const char *BEGIN       = data.data();
+            const char *END         = data.data() + length;
+
+            Obj         x(LINE_LENGTH);
+            Obj         y(LINE_LENGTH);
+            bsl::string expected;
+            char        buffer[2048];
+            char       *out = buffer;
+            int         numOutX, numInX, numOutY, numInY;
+
+            int rcX = x.convert(out, &numOutX, &numInX,
+                                BEGIN, BEGIN + prefix);
+            int rcY = y.convert(bsl::back_inserter(expected),
+                                &numOutY, &numInY,
+                                BEGIN, BEGIN + prefix);
+            out += numOutX;
+
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix, rcY == rcX);
+
+            rcX = x.convert(out, &numOutX, &numInX, BEGIN + prefix, END);
+            rcY = y.convert(bsl::back_inserter(expected),
+                            &numOutY, &numInY,
+                            BEGIN + prefix, END);
+            out += numOutX;
+
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix, rcY     == rcX);
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix, numOutY == numOutX);
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix, numInY  == numInX);
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix,
+                         y.outputLength() == x.outputLength());
+
+            rcX = x.endConvert(out, &numOutX);
+            rcY = y.endConvert(bsl::back_inserter(expected), &numOutY);
+            out += numOutX;
+
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix, rcY     == rcX);
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix, numOutY == numOutX);
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix,
+                         y.isDone() == x.isDone());
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix,
+                         expected == bsl::string(buffer, out));
+            LOOP3_ASSERT(length, LINE_LENGTH, prefix,
+                         Obj::encodedLength(length, LINE_LENGTH) ==
+                                             static_cast<int>(out - buffer));
+        }
+        }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING OPTIONAL NUMIN, NUMOUT
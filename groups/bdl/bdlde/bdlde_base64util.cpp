@@ -0,0 +1,717 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bdlde_cpufeatures.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The vector implementations follow Mula and Lemire, "Faster Base64 Encoding
+// and Decoding Using AVX2 Instructions" (see the component documentation).
+//
+// Encoding: each 128-bit lane is loaded with (at least) 12 input bytes, which
+// are shuffled so that every 32-bit element holds the 3 bytes of one quantum
+// in big-endian order ('b1 b0 b2 b1' as bytes).  Two multiplications (one
+// keeping the high and one the low 16 bits of each product) then move the
+// four 6-bit indices of each quantum into the low 6 bits of its four bytes.
+// Finally, each index is translated to its character by adding an offset that
+// depends only on the range the index falls into ('A'-'Z', 'a'-'z', '0'-'9',
+// '+', or '/'); the offset is selected by a 16-entry 'PSHUFB' lookup keyed on
+// a saturated reduction of the index.
+//
+// Decoding: each input character is classified by two 16-entry lookups keyed
+// on its low and high nibbles; a character is in the Base64 alphabet if and
+// only if the bitwise AND of its two classification bytes is zero.  The 6-bit
+// value of each character is obtained by adding an offset selected by its
+// high nibble (with a correction for '/', which shares its high nibble with
+// '+').  Two multiply-add instructions then pack the four 6-bit values of
+// each quantum into 24 bits, which are shuffled into place.  If any character
+// of a vector is not in the alphabet, the vector is handed to the scalar
+// implementation, which stops at the first offending quantum.
+//
+// The vector loops never read or write beyond the arrays described by their
+// arguments: the number of quanta remaining is checked against the (larger)
+// number of bytes loaded and stored by each step.
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_BASE64UTIL_X86
+#include <immintrin.h>
+#endif
+#endif
+
+namespace BloombergLP {
+namespace bdlde {
+
+namespace {
+
+const char k_ENCODING[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                          "abcdefghijklmnopqrstuvwxyz"
+                          "0123456789+/";
+    // The Base64 alphabet, indexed by 6-bit value.
+
+const unsigned char k_XX = 0xff;
+
+const unsigned char k_DECODING[256] = {
+    // The 6-bit value of each character of the Base64 alphabet, and 'k_XX'
+    // for every other character.
+
+    //  0     1     2     3     4     5     6     7
+    //  8     9     A     B     C     D     E     F
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // 00
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // 10
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // 20
+    k_XX, k_XX, k_XX,   62, k_XX, k_XX, k_XX,   63,
+      52,   53,   54,   55,   56,   57,   58,   59,  // 30
+      60,   61, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX,    0,    1,    2,    3,    4,    5,    6,  // 40
+       7,    8,    9,   10,   11,   12,   13,   14,
+      15,   16,   17,   18,   19,   20,   21,   22,  // 50
+      23,   24,   25, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX,   26,   27,   28,   29,   30,   31,   32,  // 60
+      33,   34,   35,   36,   37,   38,   39,   40,
+      41,   42,   43,   44,   45,   46,   47,   48,  // 70
+      49,   50,   51, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // 80
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // 90
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // A0
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // B0
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // C0
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // D0
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // E0
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX,  // F0
+    k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX, k_XX
+};
+
+                        // ---------------------
+                        // Scalar Implementation
+                        // ---------------------
+
+void encodeQuantaScalar(char *out, const char *in, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' groups of 3 bytes at the specified
+    // 'in' address into groups of 4 characters at the specified 'out' address.
+{
+    const unsigned char *input = reinterpret_cast<const unsigned char *>(in);
+
+    for (; numQuanta; --numQuanta, input += 3, out += 4) {
+        const unsigned int quantum =
+                                   (static_cast<unsigned int>(input[0]) << 16)
+                                 | (static_cast<unsigned int>(input[1]) <<  8)
+                                 |  static_cast<unsigned int>(input[2]);
+
+        out[0] = k_ENCODING[ quantum >> 18        ];
+        out[1] = k_ENCODING[(quantum >> 12) & 0x3f];
+        out[2] = k_ENCODING[(quantum >>  6) & 0x3f];
+        out[3] = k_ENCODING[ quantum        & 0x3f];
+    }
+}
+
+bsl::size_t decodeQuantaScalar(char        *out,
+                               const char  *in,
+                               bsl::size_t  numQuanta)
+    // Decode at most the specified 'numQuanta' groups of 4 characters at the
+    // specified 'in' address into groups of 3 bytes at the specified 'out'
+    // address, stopping before the first group containing a character outside
+    // the Base64 alphabet, and return the number of groups decoded.
+{
+    const unsigned char *input = reinterpret_cast<const unsigned char *>(in);
+
+    bsl::size_t i = 0;
+    for (; i < numQuanta; ++i, input += 4, out += 3) {
+        const unsigned int a = k_DECODING[input[0]];
+        const unsigned int b = k_DECODING[input[1]];
+        const unsigned int c = k_DECODING[input[2]];
+        const unsigned int d = k_DECODING[input[3]];
+
+        if ((a | b | c | d) & 0x80) {
+            break;
+        }
+
+        const unsigned int quantum = (a << 18) | (b << 12) | (c << 6) | d;
+
+        out[0] = static_cast<char>(quantum >> 16);
+        out[1] = static_cast<char>(quantum >>  8);
+        out[2] = static_cast<char>(quantum);
+    }
+
+    return i;
+}
+
+#ifdef BDLDE_BASE64UTIL_X86
+
+                        // -------------------
+                        // SSE4 Implementation
+                        // -------------------
+
+#define BDLDE_BASE64UTIL_SSE4_TARGET __attribute__((target("ssse3,sse4.1")))
+    // Enable the SSSE3 and SSE4.1 instructions in the annotated function,
+    // which must be invoked only if the running CPU supports them.
+
+#define BDLDE_BASE64UTIL_AVX2_TARGET __attribute__((target("avx2")))
+    // Enable the AVX2 instructions in the annotated function, which must be
+    // invoked only if the running CPU (and operating system) supports them.
+
+BDLDE_BASE64UTIL_SSE4_TARGET
+inline
+__m128i encodeIndices128(__m128i input)
+    // Return the 6-bit indices of the 4 quanta held in the first 12 bytes of
+    // each 128-bit lane of the specified 'input' (the last 4 bytes of which
+    // are ignored), with the 4 indices of each quantum in the low 6 bits of
+    // the bytes of the corresponding 32-bit element.
+{
+    input = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1,
+                                                  4, 3, 5, 4,
+                                                  7, 6, 8, 7,
+                                                  10, 9, 11, 10));
+
+    const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+    return _mm_or_si128(t1, t3);
+}
+
+BDLDE_BASE64UTIL_SSE4_TARGET
+inline
+__m128i encodeCharacters128(__m128i indices)
+    // Return the Base64 characters corresponding to the 6-bit values in the
+    // bytes of the specified 'indices'.
+{
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A', 0, 0);
+
+    // Map [0 .. 25] to 13, [26 .. 51] to 0, and [52 .. 63] to [1 .. 12].
+
+    __m128i key = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    key = _mm_or_si128(key,
+                       _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                    indices),
+                                     _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, key));
+}
+
+BDLDE_BASE64UTIL_SSE4_TARGET
+void encodeQuantaSse4(char *out, const char *in, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' groups of 3 bytes at the specified
+    // 'in' address into groups of 4 characters at the specified 'out' address
+    // using SSSE3 and SSE4.1 instructions.
+{
+    // Each step loads 16 bytes and encodes the first 12 of them.
+
+    for (; numQuanta >= 6; numQuanta -= 4, in += 12, out += 16) {
+        const __m128i input = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(in));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         encodeCharacters128(encodeIndices128(input)));
+    }
+
+    encodeQuantaScalar(out, in, numQuanta);
+}
+
+BDLDE_BASE64UTIL_SSE4_TARGET
+inline
+bool decodeValues128(__m128i *values, __m128i input)
+    // Load into the specified 'values' the 6-bit values of the Base64
+    // characters in the specified 'input' and return 'true' if every
+    // character of 'input' is in the Base64 alphabet, and return 'false'
+    // (leaving 'values' unspecified) otherwise.
+{
+    const __m128i lowNibbleClasses  = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                                    0x11, 0x11, 0x11, 0x11,
+                                                    0x11, 0x11, 0x13, 0x1a,
+                                                    0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i highNibbleClasses = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                                    0x04, 0x08, 0x04, 0x08,
+                                                    0x10, 0x10, 0x10, 0x10,
+                                                    0x10, 0x10, 0x10, 0x10);
+    const __m128i offsets           = _mm_setr_epi8(0, 16, 19, 4,
+                                                    -65, -65, -71, -71,
+                                                    0, 0, 0, 0,
+                                                    0, 0, 0, 0);
+    const __m128i nibbleMask        = _mm_set1_epi8(0x0f);
+
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(input, 4),
+                                              nibbleMask);
+    const __m128i lowNibbles  = _mm_and_si128(input, nibbleMask);
+
+    if (!_mm_testz_si128(_mm_shuffle_epi8(lowNibbleClasses, lowNibbles),
+                         _mm_shuffle_epi8(highNibbleClasses, highNibbles))) {
+        return false;                                                 // RETURN
+    }
+
+    // '/' (0x2f) shares its high nibble with '+' (0x2b); subtracting one from
+    // its key selects the offset for '/' (16), at index 1.
+
+    const __m128i isSlash = _mm_cmpeq_epi8(input, _mm_set1_epi8(0x2f));
+
+    *values = _mm_add_epi8(input,
+                           _mm_shuffle_epi8(offsets,
+                                            _mm_add_epi8(isSlash,
+                                                         highNibbles)));
+    return true;
+}
+
+BDLDE_BASE64UTIL_SSE4_TARGET
+inline
+__m128i packValues128(__m128i values)
+    // Return the 3 bytes decoded from each group of 4 6-bit values in the
+    // specified 'values', packed into the first 12 bytes of each 128-bit lane
+    // (the remaining 4 bytes of which are zero).
+{
+    const __m128i pairs = _mm_maddubs_epi16(values,
+                                            _mm_set1_epi32(0x01400140));
+    const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+    return _mm_shuffle_epi8(words, _mm_setr_epi8(2, 1, 0,
+                                                 6, 5, 4,
+                                                 10, 9, 8,
+                                                 14, 13, 12,
+                                                 -1, -1, -1, -1));
+}
+
+BDLDE_BASE64UTIL_SSE4_TARGET
+bsl::size_t decodeQuantaSse4(char        *out,
+                             const char  *in,
+                             bsl::size_t  numQuanta)
+    // Decode at most the specified 'numQuanta' groups of 4 characters at the
+    // specified 'in' address into groups of 3 bytes at the specified 'out'
+    // address using SSSE3 and SSE4.1 instructions, stopping before the first
+    // group containing a character outside the Base64 alphabet, and return
+    // the number of groups decoded.
+{
+    const bsl::size_t total = numQuanta;
+
+    // Each step decodes 16 characters and stores 16 bytes, the first 12 of
+    // which are valid.
+
+    for (; numQuanta >= 6; numQuanta -= 4, in += 16, out += 12) {
+        __m128i values;
+        if (!decodeValues128(&values,
+                             _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(in)))) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                         packValues128(values));
+    }
+
+    return total - numQuanta + decodeQuantaScalar(out, in, numQuanta);
+}
+
+                        // -------------------
+                        // AVX2 Implementation
+                        // -------------------
+
+BDLDE_BASE64UTIL_AVX2_TARGET
+void encodeQuantaAvx2(char *out, const char *in, bsl::size_t numQuanta)
+    // Encode the specified 'numQuanta' groups of 3 bytes at the specified
+    // 'in' address into groups of 4 characters at the specified 'out' address
+    // using AVX2 instructions.
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1,
+                                             4, 3, 5, 4,
+                                             7, 6, 8, 7,
+                                             10, 9, 11, 10,
+                                             1, 0, 2, 1,
+                                             4, 3, 5, 4,
+                                             7, 6, 8, 7,
+                                             10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0);
+
+    // Each step loads 16 bytes at 'in' and at 'in + 12', encoding the first 12
+    // bytes of each into one 128-bit lane.
+
+    for (; numQuanta >= 10; numQuanta -= 8, in += 24, out += 32) {
+        const __m128i low  = _mm_loadu_si128(
+                                       reinterpret_cast<const __m128i *>(in));
+        const __m128i high = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(in + 12));
+
+        __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(low),
+                                                high,
+                                                1);
+
+        input = _mm256_shuffle_epi8(input, shuffle);
+
+        const __m256i t0 = _mm256_and_si256(input,
+                                            _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0,
+                                              _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(input,
+                                            _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2,
+                                              _mm256_set1_epi32(0x01000010));
+
+        const __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i key = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        key = _mm256_or_si256(key,
+                              _mm256_and_si256(
+                                       _mm256_cmpgt_epi8(_mm256_set1_epi8(26),
+                                                         indices),
+                                       _mm256_set1_epi8(13)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out),
+                            _mm256_add_epi8(indices,
+                                            _mm256_shuffle_epi8(offsets,
+                                                                key)));
+    }
+
+    // Clear the upper halves of the 'ymm' registers to avoid the penalty for
+    // mixing AVX and legacy SSE instructions in the remainder and the caller.
+
+    _mm256_zeroupper();
+
+    encodeQuantaSse4(out, in, numQuanta);
+}
+
+BDLDE_BASE64UTIL_AVX2_TARGET
+bsl::size_t decodeQuantaAvx2(char        *out,
+                             const char  *in,
+                             bsl::size_t  numQuanta)
+    // Decode at most the specified 'numQuanta' groups of 4 characters at the
+    // specified 'in' address into groups of 3 bytes at the specified 'out'
+    // address using AVX2 instructions, stopping before the first group
+    // containing a character outside the Base64 alphabet, and return the
+    // number of groups decoded.
+{
+    const __m256i lowNibbleClasses  = _mm256_setr_epi8(
+                                        0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+                                        0x1b, 0x1b, 0x1b, 0x1a,
+                                        0x15, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                        0x11, 0x11, 0x11, 0x11, 0x13, 0x1a,
+                                        0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i highNibbleClasses = _mm256_setr_epi8(
+                                        0x10, 0x10, 0x01, 0x02, 0x04, 0x08,
+                                        0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                        0x10, 0x10, 0x10, 0x10,
+                                        0x10, 0x10, 0x01, 0x02, 0x04, 0x08,
+                                        0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                        0x10, 0x10, 0x10, 0x10);
+    const __m256i offsets           = _mm256_setr_epi8(
+                                        0, 16, 19, 4, -65, -65, -71, -71,
+                                        0, 0, 0, 0, 0, 0, 0, 0,
+                                        0, 16, 19, 4, -65, -65, -71, -71,
+                                        0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i pack              = _mm256_setr_epi8(
+                                        2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                        14, 13, 12, -1, -1, -1, -1,
+                                        2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                        14, 13, 12, -1, -1, -1, -1);
+    const __m256i nibbleMask        = _mm256_set1_epi8(0x0f);
+
+    const bsl::size_t total = numQuanta;
+
+    // Each step decodes 32 characters and stores 32 bytes, the first 24 of
+    // which are valid.
+
+    for (; numQuanta >= 11; numQuanta -= 8, in += 32, out += 24) {
+        const __m256i input = _mm256_loadu_si256(
+                                       reinterpret_cast<const __m256i *>(in));
+
+        const __m256i highNibbles = _mm256_and_si256(
+                                                   _mm256_srli_epi32(input, 4),
+                                                   nibbleMask);
+        const __m256i lowNibbles  = _mm256_and_si256(input, nibbleMask);
+
+        if (!_mm256_testz_si256(
+                        _mm256_shuffle_epi8(lowNibbleClasses, lowNibbles),
+                        _mm256_shuffle_epi8(highNibbleClasses, highNibbles))) {
+            break;
+        }
+
+        const __m256i isSlash = _mm256_cmpeq_epi8(input,
+                                                  _mm256_set1_epi8(0x2f));
+        const __m256i values  = _mm256_add_epi8(
+                                   input,
+                                   _mm256_shuffle_epi8(
+                                         offsets,
+                                         _mm256_add_epi8(isSlash,
+                                                         highNibbles)));
+
+        const __m256i pairs = _mm256_maddubs_epi16(
+                                               values,
+                                               _mm256_set1_epi32(0x01400140));
+        const __m256i words = _mm256_madd_epi16(
+                                               pairs,
+                                               _mm256_set1_epi32(0x00011000));
+
+        // Pack the 12 valid bytes of each lane into the low 24 bytes.
+
+        const __m256i bytes = _mm256_permutevar8x32_epi32(
+                                   _mm256_shuffle_epi8(words, pack),
+                                   _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), bytes);
+    }
+
+    _mm256_zeroupper();
+
+    return total - numQuanta + decodeQuantaSse4(out, in, numQuanta);
+}
+
+Base64Util_Impl::Implementation detectImplementation()
+    // Return the widest implementation supported by the running CPU.
+{
+    if (!CpuFeatures::hasSsse3() || !CpuFeatures::hasSse41()) {
+        return Base64Util_Impl::e_SCALAR;                             // RETURN
+    }
+
+    return CpuFeatures::hasAvx2() ? Base64Util_Impl::e_AVX2
+                                  : Base64Util_Impl::e_SSE4;
+}
+
+#else
+
+Base64Util_Impl::Implementation detectImplementation()
+    // Return the widest implementation supported by the running CPU.
+{
+    return Base64Util_Impl::e_SCALAR;
+}
+
+#endif  // BDLDE_BASE64UTIL_X86
+
+const Base64Util_Impl::Implementation s_implementation =
+                                                        detectImplementation();
+    // The implementation used by 'Base64Util'.  Note that 's_implementation'
+    // is 'e_SCALAR' (zero) if 'Base64Util' is used during static
+    // initialization before this variable is initialized.
+
+}  // close unnamed namespace
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+int Base64Util::decode(char        *out,
+                       bsl::size_t *numOut,
+                       const char  *in,
+                       bsl::size_t  numIn)
+{
+    BSLS_ASSERT(out || 0 == numIn);
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(in  || 0 == numIn);
+
+    *numOut = 0;
+
+    if (0 != numIn % 4) {
+        return -1;                                                    // RETURN
+    }
+
+    if (0 == numIn) {
+        return 0;                                                     // RETURN
+    }
+
+    // All quanta but the last are decoded in bulk; the last quantum may be
+    // padded.
+
+    const bsl::size_t numQuanta = numIn / 4 - 1;
+
+    if (numQuanta != decodeQuanta(out, in, numQuanta)) {
+        return -1;                                                    // RETURN
+    }
+
+    const unsigned char *last = reinterpret_cast<const unsigned char *>(
+                                                         in + 4 * numQuanta);
+    char                *dst  = out + 3 * numQuanta;
+
+    const unsigned int a = k_DECODING[last[0]];
+    const unsigned int b = k_DECODING[last[1]];
+
+    if ((a | b) & 0x80) {
+        return -1;                                                    // RETURN
+    }
+
+    if ('=' == last[2]) {
+        // "xx==": one byte, and the low 4 bits of 'b' must be zero.
+
+        if ('=' != last[3] || (b & 0xf)) {
+            return -1;                                                // RETURN
+        }
+        dst[0]  = static_cast<char>((a << 2) | (b >> 4));
+        *numOut = 3 * numQuanta + 1;
+        return 0;                                                     // RETURN
+    }
+
+    const unsigned int c = k_DECODING[last[2]];
+
+    if (c & 0x80) {
+        return -1;                                                    // RETURN
+    }
+
+    if ('=' == last[3]) {
+        // "xxx=": two bytes, and the low 2 bits of 'c' must be zero.
+
+        if (c & 0x3) {
+            return -1;                                                // RETURN
+        }
+        dst[0]  = static_cast<char>((a << 2) | (b >> 4));
+        dst[1]  = static_cast<char>(((b & 0xf) << 4) | (c >> 2));
+        *numOut = 3 * numQuanta + 2;
+        return 0;                                                     // RETURN
+    }
+
+    if (1 != decodeQuantaScalar(dst, reinterpret_cast<const char *>(last), 1))
+    {
+        return -1;                                                    // RETURN
+    }
+
+    *numOut = 3 * numQuanta + 3;
+    return 0;
+}
+
+bsl::size_t Base64Util::decodeQuanta(char        *out,
+                                     const char  *in,
+                                     bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out || 0 == numQuanta);
+    BSLS_ASSERT(in  || 0 == numQuanta);
+
+    return Base64Util_Impl::decodeQuanta(s_implementation,
+                                         out,
+                                         in,
+                                         numQuanta);
+}
+
+void Base64Util::encode(char *out, const char *in, bsl::size_t numIn)
+{
+    BSLS_ASSERT(out || 0 == numIn);
+    BSLS_ASSERT(in  || 0 == numIn);
+
+    const bsl::size_t numQuanta = numIn / 3;
+
+    encodeQuanta(out, in, numQuanta);
+
+    const unsigned char *tail = reinterpret_cast<const unsigned char *>(
+                                                         in + 3 * numQuanta);
+    char                *dst  = out + 4 * numQuanta;
+
+    switch (numIn % 3) {
+      case 1: {
+        dst[0] = k_ENCODING[tail[0] >> 2];
+        dst[1] = k_ENCODING[(tail[0] & 0x3) << 4];
+        dst[2] = '=';
+        dst[3] = '=';
+      } break;
+      case 2: {
+        dst[0] = k_ENCODING[tail[0] >> 2];
+        dst[1] = k_ENCODING[((tail[0] & 0x3) << 4) | (tail[1] >> 4)];
+        dst[2] = k_ENCODING[(tail[1] & 0xf) << 2];
+        dst[3] = '=';
+      } break;
+    }
+}
+
+void Base64Util::encodeQuanta(char        *out,
+                              const char  *in,
+                              bsl::size_t  numQuanta)
+{
+    BSLS_ASSERT(out || 0 == numQuanta);
+    BSLS_ASSERT(in  || 0 == numQuanta);
+
+    Base64Util_Impl::encodeQuanta(s_implementation, out, in, numQuanta);
+}
+
+                           // ----------------------
+                           // struct Base64Util_Impl
+                           // ----------------------
+
+// CLASS METHODS
+bsl::size_t Base64Util_Impl::decodeQuanta(Implementation  implementation,
+                                          char           *out,
+                                          const char     *in,
+                                          bsl::size_t     numQuanta)
+{
+    BSLS_ASSERT_SAFE(isAvailable(implementation));
+
+    switch (implementation) {
+#ifdef BDLDE_BASE64UTIL_X86
+      case e_AVX2: {
+        return decodeQuantaAvx2(out, in, numQuanta);                  // RETURN
+      }
+      case e_SSE4: {
+        return decodeQuantaSse4(out, in, numQuanta);                  // RETURN
+      }
+#endif
+      default: {
+        return decodeQuantaScalar(out, in, numQuanta);                // RETURN
+      }
+    }
+}
+
+void Base64Util_Impl::encodeQuanta(Implementation  implementation,
+                                   char           *out,
+                                   const char     *in,
+                                   bsl::size_t     numQuanta)
+{
+    BSLS_ASSERT_SAFE(isAvailable(implementation));
+
+    switch (implementation) {
+#ifdef BDLDE_BASE64UTIL_X86
+      case e_AVX2: {
+        encodeQuantaAvx2(out, in, numQuanta);
+      } break;
+      case e_SSE4: {
+        encodeQuantaSse4(out, in, numQuanta);
+      } break;
+#endif
+      default: {
+        encodeQuantaScalar(out, in, numQuanta);
+      }
+    }
+}
+
+bool Base64Util_Impl::isAvailable(Implementation implementation)
+{
+    return implementation <= detectImplementation();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
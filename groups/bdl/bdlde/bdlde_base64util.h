@@ -0,0 +1,259 @@
+// bdlde_base64util.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLDE_BASE64UTIL
+#define INCLUDED_BDLDE_BASE64UTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide bulk functions to convert buffers to and from Base64.
+//
+//@CLASSES:
+//  bdlde::Base64Util: namespace for bulk Base64 conversion functions
+//  bdlde::Base64Util_Impl: alternative implementations for testing
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::Base64Util', that
+// serves as a namespace for functions that convert an entire buffer to or from
+// the Base64 representation described in Section 6.8 "Base64 Content Transfer
+// Encoding" of RFC 2045 (see 'bdlde_base64encoder' for details of the
+// encoding).  Unlike the 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder'
+// automata, which process one character at a time and can resume on segmented
+// input, the functions in this component require the whole input to be
+// available in contiguous memory, do not insert or skip line breaks, and
+// process many bytes per step.
+//
+// Two levels of interface are provided:
+//
+//: o 'encode' and 'decode' convert a complete buffer, including the trailing
+//:   '=' padding characters of the encoded representation.
+//:
+//: o 'encodeQuanta' and 'decodeQuanta' convert a whole number of "quanta"
+//:   (i.e., groups of 3 bytes, which are encoded as 4 characters) and never
+//:   produce or accept padding.  'decodeQuanta' stops at the first quantum
+//:   that contains a character outside the Base64 alphabet, allowing the
+//:   caller (e.g., 'bdlde::Base64Decoder') to handle line breaks, padding,
+//:   and errors itself.  These functions are the building blocks that the
+//:   'bdlde::Base64Encoder' and 'bdlde::Base64Decoder' automata use when a
+//:   large input is supplied to them in a single call.
+//
+// This component additionally defines the 'struct' 'bdlde::Base64Util_Impl'
+// to expose the individual implementations of the quanta functions; it should
+// not be used other than to test and benchmark.
+//
+///Support for SIMD Instructions
+///-----------------------------
+// On x86 platforms (with GCC or clang), the quanta functions use the
+// "lookup-and-shuffle" vector algorithms described by Wojciech Mula and
+// Daniel Lemire ("Faster Base64 Encoding and Decoding Using AVX2
+// Instructions", ACM Transactions on the Web, 12(3), 2018).  The widest
+// implementation supported by the running CPU is selected at runtime:
+//: o AVX2: 24 bytes are encoded (and 32 characters decoded) per step
+//: o SSE4.1: 12 bytes are encoded (and 16 characters decoded) per step
+//: o otherwise, a portable table-driven implementation is used
+//
+// All implementations produce identical results.
+//
+///Thread Safety
+///-------------
+// The functions in this component are thread safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting a Binary Attachment
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to embed a binary attachment in a text document and
+// later recover it.  First, we compute the length of the encoded
+// representation and encode the attachment in a single call:
+//..
+//  const char        attachment[] = { 'B', 'D', 'E', '\x00', '\xff' };
+//  const bsl::size_t length       = sizeof attachment;
+//
+//  bsl::string encoded(bdlde::Base64Util::encodedLength(length), '\0');
+//  bdlde::Base64Util::encode(&encoded[0], attachment, length);
+//
+//  assert("QkRFAP8=" == encoded);
+//..
+// Then, we decode the text back into a buffer large enough to hold the
+// maximum number of bytes that the text could represent:
+//..
+//  bsl::vector<char> decoded(
+//                bdlde::Base64Util::maxDecodedLength(encoded.length()));
+//  bsl::size_t       numDecoded;
+//
+//  int rc = bdlde::Base64Util::decode(decoded.data(),
+//                                     &numDecoded,
+//                                     encoded.data(),
+//                                     encoded.length());
+//  assert(0      == rc);
+//  assert(length == numDecoded);
+//  assert(0      == bsl::memcmp(attachment, decoded.data(), length));
+//..
+// Finally, we observe that input that is not a valid, canonical Base64
+// encoding is rejected:
+//..
+//  rc = bdlde::Base64Util::decode(decoded.data(), &numDecoded, "QkRF*P8=", 8);
+//  assert(0 != rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_review.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                             // =================
+                             // struct Base64Util
+                             // =================
+
+struct Base64Util {
+    // This 'struct' provides a namespace for functions that convert entire
+    // buffers to and from the Base64 representation.
+
+    // CLASS METHODS
+    static int decode(char        *out,
+                      bsl::size_t *numOut,
+                      const char  *in,
+                      bsl::size_t  numIn);
+        // Decode the specified 'numIn' Base64 characters at the specified 'in'
+        // address into the array of bytes at the specified 'out' address, and
+        // load into the specified 'numOut' the number of bytes written.
+        // Return 0 on success, and a non-zero value if the input is not a
+        // canonical Base64 encoding, i.e., if 'numIn' is not a multiple of 4,
+        // if any character other than one or two trailing '=' characters is
+        // not in the Base64 alphabet, or if the bits discarded by the padding
+        // are not zero.  On failure, the contents of 'out' are unspecified.
+        // The behavior is undefined unless 'out' refers to an array of at
+        // least 'maxDecodedLength(numIn)' bytes.  Note that line breaks and
+        // other whitespace are *not* accepted; use 'bdlde::Base64Decoder' to
+        // decode text that may contain them.
+
+    static bsl::size_t decodeQuanta(char        *out,
+                                    const char  *in,
+                                    bsl::size_t  numQuanta);
+        // Decode, from the specified 'in' address, at most the specified
+        // 'numQuanta' groups of 4 Base64 characters into groups of 3 bytes at
+        // the specified 'out' address, stopping before the first group that
+        // contains a character that is not in the Base64 alphabet (including
+        // '=').  Return the number of groups decoded.  The behavior is
+        // undefined unless 'in' refers to an array of at least '4 * numQuanta'
+        // characters and 'out' refers to an array of at least '3 * numQuanta'
+        // bytes.
+
+    static void encode(char *out, const char *in, bsl::size_t numIn);
+        // Encode the specified 'numIn' bytes at the specified 'in' address
+        // into 'encodedLength(numIn)' Base64 characters, padded with '=' as
+        // necessary and without line breaks, at the specified 'out' address.
+        // The behavior is undefined unless 'out' refers to an array of at
+        // least 'encodedLength(numIn)' characters.
+
+    static void encodeQuanta(char        *out,
+                             const char  *in,
+                             bsl::size_t  numQuanta);
+        // Encode the specified 'numQuanta' groups of 3 bytes at the specified
+        // 'in' address into groups of 4 Base64 characters at the specified
+        // 'out' address.  The behavior is undefined unless 'in' refers to an
+        // array of at least '3 * numQuanta' bytes and 'out' refers to an array
+        // of at least '4 * numQuanta' characters.
+
+    static bsl::size_t encodedLength(bsl::size_t numIn);
+        // Return the number of characters in the padded Base64 encoding,
+        // without line breaks, of a sequence of the specified 'numIn' bytes.
+
+    static bsl::size_t maxDecodedLength(bsl::size_t numIn);
+        // Return the maximum number of bytes that can result from decoding a
+        // sequence of the specified 'numIn' Base64 characters.
+};
+
+                           // ======================
+                           // struct Base64Util_Impl
+                           // ======================
+
+struct Base64Util_Impl {
+    // This 'struct' provides a namespace for the individual implementations
+    // of the 'Base64Util' quanta functions.  The functions in this 'struct'
+    // should not be used other than to test and benchmark.
+
+    // TYPES
+    enum Implementation {
+        // Enumerate the implementations of the quanta functions.
+
+        e_SCALAR,  // portable, table-driven implementation
+        e_SSE4,    // SSSE3 and SSE4.1 instructions
+        e_AVX2     // AVX2 instructions
+    };
+
+    // CLASS METHODS
+    static bsl::size_t decodeQuanta(Implementation  implementation,
+                                    char           *out,
+                                    const char     *in,
+                                    bsl::size_t     numQuanta);
+        // Decode the specified 'numQuanta' groups of Base64 characters at the
+        // specified 'in' address into the specified 'out' array using the
+        // specified 'implementation', as described for
+        // 'Base64Util::decodeQuanta', and return the number of groups
+        // decoded.  The behavior is undefined unless
+        // 'isAvailable(implementation)' is 'true'.
+
+    static void encodeQuanta(Implementation  implementation,
+                             char           *out,
+                             const char     *in,
+                             bsl::size_t     numQuanta);
+        // Encode the specified 'numQuanta' groups of 3 bytes at the specified
+        // 'in' address into the specified 'out' array using the specified
+        // 'implementation', as described for 'Base64Util::encodeQuanta'.  The
+        // behavior is undefined unless 'isAvailable(implementation)' is
+        // 'true'.
+
+    static bool isAvailable(Implementation implementation);
+        // Return 'true' if the specified 'implementation' is supported by
+        // this build and by the running CPU, and 'false' otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // struct Base64Util
+                             // -----------------
+
+// CLASS METHODS
+inline
+bsl::size_t Base64Util::encodedLength(bsl::size_t numIn)
+{
+    return (numIn + 2) / 3 * 4;
+}
+
+inline
+bsl::size_t Base64Util::maxDecodedLength(bsl::size_t numIn)
+{
+    return (numIn + 3) / 4 * 3;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,863 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a namespace for bulk Base64 conversion
+// functions, whose quanta functions have a portable implementation and (on
+// x86) vector implementations selected at runtime.  We verify the quanta
+// functions of every implementation available on the test machine against a
+// simple bit-at-a-time reference encoder, and then verify the padding and
+// error handling of 'encode' and 'decode'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t encodedLength(bsl::size_t numIn);
+// [ 2] bsl::size_t maxDecodedLength(bsl::size_t numIn);
+// [ 3] void encodeQuanta(char *, const char *, bsl::size_t);
+// [ 4] bsl::size_t decodeQuanta(char *, const char *, bsl::size_t);
+// [ 5] void encode(char *out, const char *in, bsl::size_t numIn);
+// [ 5] int decode(char *, bsl::size_t *, const char *, bsl::size_t);
+// [ 3] Impl::encodeQuanta(Implementation, char *, const char *, size_t);
+// [ 4] Impl::decodeQuanta(Implementation, char *, const char *, size_t);
+// [ 3] bool Impl::isAvailable(Implementation);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] THROUGHPUT TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util      Util;
+typedef bdlde::Base64Util_Impl Impl;
+
+static const Impl::Implementation IMPLEMENTATIONS[] = {
+    Impl::e_SCALAR,
+    Impl::e_SSE4,
+    Impl::e_AVX2
+};
+static const int NUM_IMPLEMENTATIONS = sizeof IMPLEMENTATIONS
+                                     / sizeof *IMPLEMENTATIONS;
+
+static const char *const IMPLEMENTATION_NAMES[] = { "Scalar", "SSE4", "AVX2" };
+
+// ============================================================================
+//                          HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+static
+void fillRandom(bsl::vector<char> *buffer, unsigned int seed)
+    // Fill the specified 'buffer' with pseudo-random bytes generated from the
+    // specified 'seed'.
+{
+    for (bsl::size_t i = 0; i < buffer->size(); ++i) {
+        seed         = seed * 1103515245 + 12345;
+        (*buffer)[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+static
+bsl::string oracleEncode(const char *in, bsl::size_t numIn)
+    // Return the padded Base64 encoding, without line breaks, of the
+    // specified 'numIn' bytes at the specified 'in' address, computed one bit
+    // at a time.
+{
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                   "abcdefghijklmnopqrstuvwxyz"
+                                   "0123456789+/";
+
+    bsl::string result;
+
+    const bsl::size_t numBits = 8 * numIn;
+    for (bsl::size_t bit = 0; bit < numBits; bit += 6) {
+        int value = 0;
+        for (bsl::size_t i = bit; i < bit + 6; ++i) {
+            const int b = i < numBits
+                          ? (static_cast<unsigned char>(in[i / 8])
+                                                          >> (7 - i % 8)) & 1
+                          : 0;
+            value = (value << 1) | b;
+        }
+        result.push_back(ALPHABET[value]);
+    }
+    while (0 != result.length() % 4) {
+        result.push_back('=');
+    }
+
+    return result;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool             verbose = argc > 2;
+    const bool         veryVerbose = argc > 3;
+    const bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting a Binary Attachment
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need to embed a binary attachment in a text document and
+// later recover it.  First, we compute the length of the encoded
+// representation and encode the attachment in a single call:
+//..
+    const char        attachment[] = { 'B', 'D', 'E', '\x00', '\xff' };
+    const bsl::size_t length       = sizeof attachment;
+
+    bsl::string encoded(bdlde::Base64Util::encodedLength(length), '\0');
+    bdlde::Base64Util::encode(&encoded[0], attachment, length);
+
+    ASSERT("QkRFAP8=" == encoded);
+//..
+// Then, we decode the text back into a buffer large enough to hold the
+// maximum number of bytes that the text could represent:
+//..
+    bsl::vector<char> decoded(
+                  bdlde::Base64Util::maxDecodedLength(encoded.length()));
+    bsl::size_t       numDecoded;
+
+    int rc = bdlde::Base64Util::decode(decoded.data(),
+                                       &numDecoded,
+                                       encoded.data(),
+                                       encoded.length());
+    ASSERT(0      == rc);
+    ASSERT(length == numDecoded);
+    ASSERT(0      == bsl::memcmp(attachment, decoded.data(), length));
+//..
+// Finally, we observe that input that is not a valid, canonical Base64
+// encoding is rejected:
+//..
+    rc = bdlde::Base64Util::decode(decoded.data(), &numDecoded, "QkRF*P8=", 8);
+    ASSERT(0 != rc);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode' AND 'decode'
+        //
+        // Concerns:
+        //: 1 'encode' produces the padded encoding of inputs of every length,
+        //:   including the test vectors of RFC 4648.
+        //:
+        //: 2 'decode' inverts 'encode' and reports the number of bytes
+        //:   decoded.
+        //:
+        //: 3 'decode' rejects input whose length is not a multiple of 4,
+        //:   characters outside the alphabet (including whitespace), '='
+        //:   anywhere other than the last two positions, a single '='
+        //:   followed by a non-'=' character, and non-zero padding bits.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the RFC 4648 test vectors in both directions.  (C-1..2)
+        //:
+        //: 2 For every length in '[0 .. 300]', encode pseudo-random data,
+        //:   compare with the oracle, decode, and compare with the data.
+        //:   (C-1..2)
+        //:
+        //: 3 Using a table of invalid inputs, verify that 'decode' returns a
+        //:   non-zero value; then corrupt each character of a long valid
+        //:   encoding in turn and verify the same.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   void encode(char *out, const char *in, bsl::size_t numIn);
+        //   int decode(char *, bsl::size_t *, const char *, bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encode' AND 'decode'" << endl
+                          << "=============================" << endl;
+
+        if (verbose) cout << "\nRFC 4648 test vectors." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_data_p;
+                const char *d_encoded_p;
+            } DATA[] = {
+                //LINE  DATA       ENCODED
+                //----  ---------  ----------
+                { L_,   "",        ""         },
+                { L_,   "f",       "Zg=="     },
+                { L_,   "fo",      "Zm8="     },
+                { L_,   "foo",     "Zm9v"     },
+                { L_,   "foob",    "Zm9vYg==" },
+                { L_,   "fooba",   "Zm9vYmE=" },
+                { L_,   "foobar",  "Zm9vYmFy" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE    = DATA[ti].d_line;
+                const char        *INPUT   = DATA[ti].d_data_p;
+                const bsl::string  EXP     = DATA[ti].d_encoded_p;
+                const bsl::size_t  LENGTH  = bsl::strlen(INPUT);
+
+                ASSERTV(LINE, EXP.length() == Util::encodedLength(LENGTH));
+
+                bsl::string encoded(Util::encodedLength(LENGTH), '\0');
+                Util::encode(&encoded[0], INPUT, LENGTH);
+
+                ASSERTV(LINE, encoded, EXP == encoded);
+
+                char        decoded[8];
+                bsl::size_t numDecoded = 99;
+
+                ASSERTV(LINE, 0 == Util::decode(decoded,
+                                                &numDecoded,
+                                                EXP.data(),
+                                                EXP.length()));
+                ASSERTV(LINE, numDecoded, LENGTH == numDecoded);
+                ASSERTV(LINE, 0 == bsl::memcmp(decoded, INPUT, LENGTH));
+            }
+        }
+
+        if (verbose) cout << "\nRound trip against the oracle." << endl;
+        {
+            bsl::vector<char> data(300);
+            fillRandom(&data, 5);
+
+            for (bsl::size_t length = 0; length <= data.size(); ++length) {
+                const bsl::string EXP = oracleEncode(data.data(), length);
+
+                bsl::string encoded(Util::encodedLength(length), '\0');
+                Util::encode(&encoded[0], data.data(), length);
+
+                ASSERTV(length, EXP == encoded);
+
+                bsl::vector<char> decoded(Util::maxDecodedLength(
+                                                            encoded.length()));
+                bsl::size_t       numDecoded = 0;
+
+                ASSERTV(length, 0 == Util::decode(decoded.data(),
+                                                  &numDecoded,
+                                                  encoded.data(),
+                                                  encoded.length()));
+                ASSERTV(length, numDecoded, length == numDecoded);
+                ASSERTV(length, 0 == bsl::memcmp(decoded.data(),
+                                                 data.data(),
+                                                 length));
+            }
+        }
+
+        if (verbose) cout << "\nInvalid input." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input_p;
+            } DATA[] = {
+                //LINE  INPUT
+                //----  ----------
+                { L_,   "Z"        },
+                { L_,   "Zg="      },
+                { L_,   "Zm9vY"    },
+                { L_,   "Zg==="    },
+                { L_,   "===="     },
+                { L_,   "Z==="     },
+                { L_,   "Zg=a"     },
+                { L_,   "Zm=v"     },
+                { L_,   "=m9v"     },
+                { L_,   "Zh=="     },  // non-zero padding bits
+                { L_,   "Zm9="     },  // non-zero padding bits
+                { L_,   "Zg==Zm9v" },
+                { L_,   "Zm9 "     },
+                { L_,   "Zm9\n"    },
+                { L_,   "Zm9v\r\n" },
+                { L_,   "Zm-v"     },
+                { L_,   "Zm_v"     },
+                { L_,   "Zm9\xc3"  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int          LINE   = DATA[ti].d_line;
+                const char        *INPUT  = DATA[ti].d_input_p;
+                const bsl::size_t  LENGTH = bsl::strlen(INPUT);
+
+                char        decoded[16];
+                bsl::size_t numDecoded;
+
+                ASSERTV(LINE, 0 != Util::decode(decoded,
+                                                &numDecoded,
+                                                INPUT,
+                                                LENGTH));
+            }
+
+            bsl::vector<char> data(3 * 100);
+            fillRandom(&data, 11);
+
+            bsl::string encoded(Util::encodedLength(data.size()), '\0');
+            Util::encode(&encoded[0], data.data(), data.size());
+
+            bsl::vector<char> decoded(data.size());
+
+            for (bsl::size_t i = 0; i < encoded.size(); ++i) {
+                bsl::string corrupted(encoded);
+                corrupted[i] = i % 2 ? '=' : '*';
+
+                bsl::size_t numDecoded;
+
+                ASSERTV(i, 0 != Util::decode(decoded.data(),
+                                             &numDecoded,
+                                             corrupted.data(),
+                                             corrupted.size()));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        buffer[8];
+            bsl::size_t numDecoded;
+
+            ASSERT_PASS(Util::encode(buffer, "a", 1));
+            ASSERT_PASS(Util::encode(0, 0, 0));
+            ASSERT_FAIL(Util::encode(0, "a", 1));
+            ASSERT_FAIL(Util::encode(buffer, 0, 1));
+
+            ASSERT_PASS(Util::decode(buffer, &numDecoded, "Zg==", 4));
+            ASSERT_PASS(Util::decode(0, &numDecoded, 0, 0));
+            ASSERT_FAIL(Util::decode(buffer, 0, "Zg==", 4));
+            ASSERT_FAIL(Util::decode(0, &numDecoded, "Zg==", 4));
+            ASSERT_FAIL(Util::decode(buffer, &numDecoded, 0, 4));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'decodeQuanta'
+        //
+        // Concerns:
+        //: 1 Every available implementation decodes every valid input
+        //:   correctly, for any number of quanta and any alignment.
+        //:
+        //: 2 Decoding stops before the first quantum containing a character
+        //:   outside the alphabet, wherever that character appears, and the
+        //:   quanta before it are decoded.
+        //:
+        //: 3 No implementation writes beyond '3 * numQuanta' bytes.
+        //:
+        //: 4 Every one of the 256 character values is classified correctly.
+        //
+        // Plan:
+        //: 1 For each available implementation, for each number of quanta in
+        //:   '[0 .. 100]' and 4 offsets, decode the encoding of pseudo-random
+        //:   data into a buffer filled with a sentinel value, and verify the
+        //:   result, the return value, and that the sentinel bytes after the
+        //:   output are intact.  (C-1, 3)
+        //:
+        //: 2 For each available implementation, replace each character of
+        //:   the encoding of 40 quanta with each value not in the alphabet,
+        //:   and verify the return value and the decoded prefix.  (C-2, 4)
+        //:
+        //: 3 Verify that 'Base64Util::decodeQuanta' matches the scalar
+        //:   implementation.  (C-1)
+        //
+        // Testing:
+        //   bsl::size_t decodeQuanta(char *, const char *, bsl::size_t);
+        //   Impl::decodeQuanta(Implementation, char *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decodeQuanta'" << endl
+                          << "======================" << endl;
+
+        const char SENTINEL = '\xa5';
+
+        bsl::vector<char> data(3 * 100);
+        fillRandom(&data, 3);
+
+        const bsl::string ENCODED = oracleEncode(data.data(), data.size());
+
+        for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+            const Impl::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+            if (!Impl::isAvailable(IMPL)) {
+                if (verbose) cout << IMPLEMENTATION_NAMES[ii]
+                                  << " is not available." << endl;
+                continue;
+            }
+
+            if (verbose) cout << "\nValid input: "
+                              << IMPLEMENTATION_NAMES[ii] << endl;
+
+            for (bsl::size_t numQuanta = 0; numQuanta <= 100; ++numQuanta) {
+                for (bsl::size_t offset = 0; offset < 4; ++offset) {
+                    const bsl::string input = bsl::string(offset, 'A')
+                                            + ENCODED.substr(0, 4 * numQuanta);
+
+                    bsl::vector<char> out(3 * numQuanta + offset + 32,
+                                          SENTINEL);
+
+                    const bsl::size_t n = Impl::decodeQuanta(
+                                                        IMPL,
+                                                        out.data() + offset,
+                                                        input.data() + offset,
+                                                        numQuanta);
+
+                    ASSERTV(ii, numQuanta, offset, numQuanta == n);
+                    ASSERTV(ii, numQuanta, offset,
+                            0 == bsl::memcmp(out.data() + offset,
+                                             data.data(),
+                                             3 * numQuanta));
+
+                    for (bsl::size_t i = offset + 3 * numQuanta;
+                                                       i < out.size(); ++i) {
+                        ASSERTV(ii, numQuanta, offset, i,
+                                SENTINEL == out[i]);
+                    }
+                }
+            }
+
+            if (verbose) cout << "\nInvalid input: "
+                              << IMPLEMENTATION_NAMES[ii] << endl;
+
+            const bsl::size_t NUM_QUANTA = 40;
+
+            bsl::string alphabet =
+                         "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                         "0123456789+/";
+
+            for (int c = 0; c < 256; ++c) {
+                if (bsl::string::npos != alphabet.find(static_cast<char>(c))) {
+                    continue;
+                }
+
+                for (bsl::size_t pos = 0; pos < 4 * NUM_QUANTA; ++pos) {
+                    bsl::string input = ENCODED.substr(0, 4 * NUM_QUANTA);
+                    input[pos] = static_cast<char>(c);
+
+                    bsl::vector<char> out(3 * NUM_QUANTA);
+
+                    const bsl::size_t n = Impl::decodeQuanta(IMPL,
+                                                             out.data(),
+                                                             input.data(),
+                                                             NUM_QUANTA);
+
+                    ASSERTV(ii, c, pos, pos / 4 == n);
+                    ASSERTV(ii, c, pos, 0 == bsl::memcmp(out.data(),
+                                                         data.data(),
+                                                         3 * n));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nDefault implementation." << endl;
+        {
+            bsl::vector<char> out(data.size());
+
+            ASSERT(100 == Util::decodeQuanta(out.data(),
+                                             ENCODED.data(),
+                                             100));
+            ASSERT(data == out);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodeQuanta'
+        //
+        // Concerns:
+        //: 1 Every available implementation encodes every input correctly,
+        //:   for any number of quanta and any alignment.
+        //:
+        //: 2 No implementation writes beyond '4 * numQuanta' characters.
+        //:
+        //: 3 The scalar implementation is always available.
+        //
+        // Plan:
+        //: 1 Verify that the scalar implementation is available.  (C-3)
+        //:
+        //: 2 For each available implementation, for each number of quanta in
+        //:   '[0 .. 100]' and 4 offsets, encode pseudo-random data into a
+        //:   buffer filled with a sentinel value, and compare with the
+        //:   oracle; verify that the sentinel characters after the output are
+        //:   intact.  (C-1..2)
+        //:
+        //: 3 For each available implementation, encode quanta holding every
+        //:   6-bit value in every position and compare with the oracle.
+        //:   (C-1)
+        //
+        // Testing:
+        //   void encodeQuanta(char *, const char *, bsl::size_t);
+        //   Impl::encodeQuanta(Implementation, char *, const char *, size_t);
+        //   bool Impl::isAvailable(Implementation);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encodeQuanta'" << endl
+                          << "======================" << endl;
+
+        ASSERT(Impl::isAvailable(Impl::e_SCALAR));
+
+        const char SENTINEL = '\xa5';
+
+        bsl::vector<char> data(3 * 100 + 4);
+        fillRandom(&data, 7);
+
+        // 64 quanta holding the 6-bit values 'i', 'i + 1', 'i + 2', 'i + 3'
+        // (modulo 64), for each 'i'.
+
+        bsl::vector<char> allValues;
+        for (unsigned int i = 0; i < 64; ++i) {
+            const unsigned int quantum = ( i           << 18)
+                                       | (((i + 1) & 63) << 12)
+                                       | (((i + 2) & 63) <<  6)
+                                       |  ((i + 3) & 63);
+            allValues.push_back(static_cast<char>(quantum >> 16));
+            allValues.push_back(static_cast<char>(quantum >>  8));
+            allValues.push_back(static_cast<char>(quantum));
+        }
+        const bsl::string ALL_VALUES_ENCODED = oracleEncode(allValues.data(),
+                                                            allValues.size());
+
+        for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+            const Impl::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+            if (!Impl::isAvailable(IMPL)) {
+                if (verbose) cout << IMPLEMENTATION_NAMES[ii]
+                                  << " is not available." << endl;
+                continue;
+            }
+
+            if (verbose) cout << IMPLEMENTATION_NAMES[ii] << endl;
+
+            for (bsl::size_t numQuanta = 0; numQuanta <= 100; ++numQuanta) {
+                for (bsl::size_t offset = 0; offset < 4; ++offset) {
+                    const char        *INPUT = data.data() + offset;
+                    const bsl::string  EXP   = oracleEncode(INPUT,
+                                                            3 * numQuanta);
+
+                    bsl::vector<char> out(4 * numQuanta + offset + 32,
+                                          SENTINEL);
+
+                    Impl::encodeQuanta(IMPL,
+                                       out.data() + offset,
+                                       INPUT,
+                                       numQuanta);
+
+                    ASSERTV(ii, numQuanta, offset,
+                            EXP == bsl::string(out.data() + offset,
+                                               4 * numQuanta));
+
+                    for (bsl::size_t i = offset + 4 * numQuanta;
+                                                       i < out.size(); ++i) {
+                        ASSERTV(ii, numQuanta, offset, i,
+                                SENTINEL == out[i]);
+                    }
+                }
+            }
+
+            bsl::string out(ALL_VALUES_ENCODED.size(), '\0');
+            Impl::encodeQuanta(IMPL, &out[0], allValues.data(), 64);
+            ASSERTV(ii, ALL_VALUES_ENCODED == out);
+        }
+
+        if (verbose) cout << "\nDefault implementation." << endl;
+        {
+            bsl::string out(ALL_VALUES_ENCODED.size(), '\0');
+            Util::encodeQuanta(&out[0], allValues.data(), 64);
+            ASSERT(ALL_VALUES_ENCODED == out);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodedLength' AND 'maxDecodedLength'
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the length of the padded encoding.
+        //:
+        //: 2 'maxDecodedLength' returns the number of bytes that a padded
+        //:   encoding of that length can hold at most.
+        //
+        // Plan:
+        //: 1 For lengths in '[0 .. 300]', compare 'encodedLength' with the
+        //:   length of the oracle encoding, and verify that
+        //:   'maxDecodedLength' of that encoding is at least the input length
+        //:   and less than the input length plus 3.  (C-1..2)
+        //
+        // Testing:
+        //   bsl::size_t encodedLength(bsl::size_t numIn);
+        //   bsl::size_t maxDecodedLength(bsl::size_t numIn);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "TESTING 'encodedLength' AND 'maxDecodedLength'" << endl
+                  << "==============================================" << endl;
+
+        bsl::vector<char> data(300);
+        fillRandom(&data, 1);
+
+        for (bsl::size_t length = 0; length <= data.size(); ++length) {
+            const bsl::size_t ENCODED_LENGTH =
+                                    oracleEncode(data.data(), length).length();
+
+            ASSERTV(length, ENCODED_LENGTH == Util::encodedLength(length));
+
+            const bsl::size_t maxLength =
+                                        Util::maxDecodedLength(ENCODED_LENGTH);
+
+            ASSERTV(length, maxLength, length <= maxLength);
+            ASSERTV(length, maxLength, maxLength < length + 3);
+            ASSERTV(length, maxLength, 0 == maxLength % 3);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode a short string.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char  INPUT[] = "Many hands make light work.";
+        const char  EXP[]   = "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu";
+        const bsl::size_t LENGTH = sizeof INPUT - 1;
+
+        char encoded[64];
+        Util::encode(encoded, INPUT, LENGTH);
+        ASSERT(sizeof EXP - 1 == Util::encodedLength(LENGTH));
+        ASSERT(0 == bsl::memcmp(EXP, encoded, sizeof EXP - 1));
+
+        char        decoded[64];
+        bsl::size_t numDecoded;
+        ASSERT(0 == Util::decode(decoded,
+                                 &numDecoded,
+                                 encoded,
+                                 Util::encodedLength(LENGTH)));
+        ASSERT(LENGTH == numDecoded);
+        ASSERT(0 == bsl::memcmp(INPUT, decoded, LENGTH));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 We want to compare the throughput of the implementations of the
+        //:   quanta functions.
+        //
+        // Plan:
+        //: 1 For buffer sizes from 96 bytes to 12MB, repeatedly encode and
+        //:   decode a buffer of pseudo-random data with each available
+        //:   implementation, processing about 256MB of data for each, and
+        //:   report the throughput in GB/s of unencoded data.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "THROUGHPUT TEST" << endl
+                          << "===============" << endl;
+
+        const double GB = 1024.0 * 1024.0 * 1024.0;
+
+        const bsl::size_t MAX_LENGTH = 12 * 1024 * 1024;
+
+        bsl::vector<char> data(MAX_LENGTH);
+        fillRandom(&data, 13);
+
+        bsl::string encoded(Util::encodedLength(MAX_LENGTH), '\0');
+        Util::encode(&encoded[0], data.data(), MAX_LENGTH);
+
+        bsl::vector<char> decoded(MAX_LENGTH);
+
+        cout << "      size  implementation  encode (GB/s)  decode (GB/s)"
+             << endl;
+
+        for (bsl::size_t length = 96; length <= MAX_LENGTH; length *= 8) {
+            const bsl::size_t numQuanta  = length / 3;
+            const int         ITERATIONS = static_cast<int>(GB / 4 / length)
+                                         + 1;
+
+            for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+                const Impl::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+                if (!Impl::isAvailable(IMPL)) {
+                    continue;
+                }
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    Impl::encodeQuanta(IMPL,
+                                       &encoded[0],
+                                       data.data(),
+                                       numQuanta);
+                }
+                timer.stop();
+                const double encodeRate = ITERATIONS * double(length)
+                                        / GB / timer.elapsedTime();
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    Impl::decodeQuanta(IMPL,
+                                       decoded.data(),
+                                       encoded.data(),
+                                       numQuanta);
+                }
+                timer.stop();
+                const double decodeRate = ITERATIONS * double(length)
+                                        / GB / timer.elapsedTime();
+
+                cout << setw(10) << length << "  "
+                     << left << setw(14) << IMPLEMENTATION_NAMES[ii] << right
+                     << setw(15) << encodeRate
+                     << setw(15) << decodeRate << endl;
+            }
+        }
+
+        if (veryVerbose) {
+            P(encoded.substr(0, 16));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,6 +13,7 @@
 BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
+#include <bdlde_utf8util.h>
 
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
@@ -332,6 +333,16 @@ struct Capacity {
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t numWords) const
+        // Return the lesser of the specified 'numWords' and the number of
+        // words that can be written while leaving room for the terminating
+        // null word.  The behavior is undefined unless '1 <= d_capacity'.
+    {
+        BSLS_ASSERT(1 <= d_capacity);
+
+        return bsl::min(numWords, d_capacity - 1);
+    }
 };
 
 struct NoOpCapacity {
@@ -351,6 +362,9 @@ struct NoOpCapacity {
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t limit(bsl::size_t numWords) const { return numWords; }
+        // Return the specified 'numWords'.
 };
 
 // LOCAL HELPER STRUCT
@@ -418,6 +432,28 @@ struct Utf8 {
             }
         }
 
+        bsl::size_t numAsciiOctets(const OctetType *position) const
+            // Return the number of consecutive single-octet (i.e., ASCII)
+            // code points beginning at the specified 'position' and prior to
+            // 'd_end'.  The behavior is undefined unless 'position < d_end'
+            // and 'position' refers to a single-octet code point.
+        {
+            BSLS_ASSERT(position < d_end);
+            BSLS_ASSERT(0 == (*position & ONE_OCTET_MASK));
+
+            // Look for a longer run only if the next octet is also a
+            // single-octet code point, so that isolated ASCII in other text
+            // costs little extra.
+
+            if (position + 1 == d_end || 0 != (position[1] & ONE_OCTET_MASK)) {
+                return 1;                                             // RETURN
+            }
+
+            return BloombergLP::bdlde::Utf8Util::numLeadingAsciiBytes(
+                                   reinterpret_cast<const char *>(position),
+                                   d_end - position);
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets' that are prior to
@@ -479,6 +515,16 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        bsl::size_t numAsciiOctets(const OctetType *) const
+            // Return 1.  Note that runs of single-octet code points are not
+            // measured ahead when the end of input is marked by a null octet,
+            // since that would read past the end.  The behavior is undefined
+            // unless the specified position refers to a single-octet code
+            // point.
+        {
+            return 1;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets'.  The behavior is
@@ -1176,11 +1222,21 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
-            *dstBuffer = SWAPPER::encodeSingleWord(*octets);
-            ++octets;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            // Translate, in one step, as much of the run of single-octet code
+            // points beginning at 'octets' as will fit in the output.
+
+            const bsl::size_t numAscii = bsl::min<bsl::size_t>(
+                          dstCapacity.limit(endFunctor.numAsciiOctets(octets)),
+                          INT_MAX);
+
+            for (bsl::size_t i = 0; i < numAscii; ++i) {
+                dstBuffer[i] = SWAPPER::encodeSingleWord(octets[i]);
+            }
+
+            octets      += numAscii;
+            dstBuffer   += numAscii;
+            dstCapacity -= static_cast<int>(numAscii);
+            nCodePoints += numAscii;
             continue;
         }
 
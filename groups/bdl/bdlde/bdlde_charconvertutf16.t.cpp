@@ -128,8 +128,9 @@ using namespace bsl;
 // Exercise boundary cases for both of the conversion mappings as well as
 // handling of buffer capacity issues.
 //-----------------------------------------------------------------------------
-// [15] USAGE EXAMPLE 2
-// [14] USAGE EXAMPLE 1
+// [16] USAGE EXAMPLE 2
+// [15] USAGE EXAMPLE 1
+// [14] ASCII RUNS TEST
 // [13] BACKWARDS BYTE ORDER TEST
 // [12] EMBEDDED ZEROES TEST
 // [11] UTF-16 -> UTF-8: THOROUGH BROKEN GLASS TEST
@@ -144,6 +145,7 @@ using namespace bsl;
 // [ 2] SINGLE-VALUE, LEGAL VALUE TEST
 // [ 1] BREATHING/USAGE TEST
 //-----------------------------------------------------------------------------
+// [14] utf8ToUtf16 (fixed-length buffer overloads)
 // [13] utf8ToUtf16 (all container overloads)
 // [13] utf16ToUtf8 (all container overloads)
 // [12] utf8ToUtf16 (single container overload)
@@ -4448,7 +4450,7 @@ int main(int argc, char**argv)
     bslma::DefaultAllocatorGuard daGuard(&da);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         // --------------------------------------------------------------------
@@ -4574,7 +4576,7 @@ int main(int argc, char**argv)
     ASSERT(utf16CodePointsWritten       == uf8CodePointsWritten);
 //..
       } break;
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         // --------------------------------------------------------------------
@@ -4667,6 +4669,114 @@ int main(int argc, char**argv)
     ASSERT(0    == secondUtf16String[5]);
 //..
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // ASCII RUNS TEST
+        //
+        // Concerns:
+        //: 1 Runs of single-octet code points in UTF-8 input of explicit
+        //:   length, which are translated many octets per step, are translated
+        //:   identically to the same runs in null-terminated input, which are
+        //:   translated one octet per step.
+        //:
+        //: 2 A run is cut short exactly where the output buffer is full
+        //:   (leaving room for the terminating null word), and no word beyond
+        //:   the capacity of the buffer is written.
+        //
+        // Plan:
+        //: 1 Build strings of runs of ASCII of random lengths separated by
+        //:   multi-octet sequences and invalid octets.
+        //:
+        //: 2 Translate each string to UTF-16 with every capacity from 1 to
+        //:   more than is needed, with both byte orders, from both the
+        //:   null-terminated and the 'StringRef' forms of the input, into
+        //:   buffers filled with a sentinel value, and verify that the return
+        //:   values, the numbers of code points and words written, and the
+        //:   contents of the buffers are identical.  (C-1..2)
+        //
+        // Testing:
+        //   utf8ToUtf16 (fixed-length buffer overloads)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "ASCII RUNS TEST\n"
+                             "===============\n";
+
+        bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+        const unsigned short SENTINEL = 0xbeef;
+
+        const char *const SEPARATORS[] = {
+            "\xc3\xa9",            // 2-octet code point
+            "\xe4\xb8\xad",        // 3-octet code point
+            "\xf0\x9f\x98\x80",    // 4-octet code point (surrogate pair)
+            "\x80",                // lone continuation
+            "\xff",                // invalid octet
+            "\xe4\xb8",            // truncated 3-octet code point
+        };
+        enum { NUM_SEPARATORS = sizeof SEPARATORS / sizeof *SEPARATORS };
+
+        const bdlde::ByteOrder::Enum ORDERS[] = {
+                                              bdlde::ByteOrder::e_HOST,
+                                              bdlde::ByteOrder::e_BIG_ENDIAN,
+                                              bdlde::ByteOrder::e_LITTLE_ENDIAN
+        };
+        enum { NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS };
+
+        unsigned int seed = 12345;
+        for (int ti = 0; ti < 100; ++ti) {
+            bsl::string input(&ta);
+            while (input.length() < 64 + static_cast<size_t>(ti)) {
+                seed = seed * 1103515245 + 12345;
+                for (unsigned runLength = (seed >> 16) % 40; runLength;
+                                                                --runLength) {
+                    seed = seed * 1103515245 + 12345;
+                    input += static_cast<char>(' ' + (seed >> 16) % 95);
+                }
+                seed = seed * 1103515245 + 12345;
+                input += SEPARATORS[(seed >> 16) % NUM_SEPARATORS];
+            }
+
+            const size_t MAX_CAPACITY = 2 * input.length() + 2;
+
+            for (size_t capacity = 1; capacity <= MAX_CAPACITY; ++capacity) {
+                for (int tj = 0; tj < NUM_ORDERS; ++tj) {
+                    const bdlde::ByteOrder::Enum ORDER = ORDERS[tj];
+
+                    bsl::vector<unsigned short> expected(MAX_CAPACITY + 1,
+                                                         SENTINEL,
+                                                         &ta);
+                    bsl::vector<unsigned short> result(  MAX_CAPACITY + 1,
+                                                         SENTINEL,
+                                                         &ta);
+                    size_t expNumCodePoints = -1, expNumWords = -1;
+                    size_t numCodePoints    = -2, numWords    = -2;
+
+                    const int EXP_RC = Util::utf8ToUtf16(&expected[0],
+                                                         capacity,
+                                                         input.c_str(),
+                                                         &expNumCodePoints,
+                                                         &expNumWords,
+                                                         '?',
+                                                         ORDER);
+                    const int RC     = Util::utf8ToUtf16(
+                                                      &result[0],
+                                                      capacity,
+                                                      bslstl::StringRef(input),
+                                                      &numCodePoints,
+                                                      &numWords,
+                                                      '?',
+                                                      ORDER);
+
+                    ASSERTV(ti, capacity, tj, EXP_RC == RC);
+                    ASSERTV(ti, capacity, tj,
+                            expNumCodePoints == numCodePoints);
+                    ASSERTV(ti, capacity, tj, expNumWords == numWords);
+                    ASSERTV(ti, capacity, tj, expected == result);
+                    ASSERTV(ti, capacity, tj, SENTINEL == result[capacity]);
+                }
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // BACKWARDS BYTE ORDER TEST
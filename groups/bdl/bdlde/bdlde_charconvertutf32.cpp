@@ -8,7 +8,7 @@
 // ----------------------------------------------------------------------------
 
 #include <bdlde_charconvertutf32.h>
-#include <bdlde_utf8util.h>    // for testing only
+#include <bdlde_utf8util.h>
 
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
@@ -193,6 +193,11 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t limit(bsl::size_t numWords) const;
+        // Return the lesser of the specified 'numWords' and the number of
+        // words that can be written while leaving room for the terminating
+        // null word.  The behavior is undefined unless '1 <= d_capacity'.
 };
 
                            // ---------------------
@@ -237,6 +242,14 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::limit(bsl::size_t numWords) const
+{
+    BSLS_ASSERT(1 <= d_capacity);
+
+    return bsl::min(numWords, d_capacity - 1);
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -266,6 +279,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t limit(bsl::size_t numWords) const;
+        // Return the specified 'numWords'.
 };
 
                          // -------------------------
@@ -304,6 +320,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::limit(bsl::size_t numWords) const
+    // Return 'numWords'.
+{
+    return numWords;
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -370,6 +393,12 @@ class Utf8PtrBasedEnd {
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
 
+    bsl::size_t numAsciiOctets(const OctetType *position) const;
+        // Return the number of consecutive single-octet (i.e., ASCII) code
+        // points beginning at the specified 'position' and prior to 'd_end'.
+        // The behavior is undefined unless 'position < d_end' and 'position'
+        // refers to a single-octet code point.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after the specified 'skipBy' consecutive
@@ -425,6 +454,24 @@ const OctetType *Utf8PtrBasedEnd::skipContinuations(
     return octets;
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numAsciiOctets(const OctetType *position) const
+{
+    BSLS_ASSERT(position < d_end);
+    BSLS_ASSERT(0 == (*position & k_ONE_OCTET_MASK));
+
+    // Look for a longer run only if the next octet is also a single-octet
+    // code point, so that isolated ASCII in other text costs little extra.
+
+    if (position + 1 == d_end || 0 != (position[1] & k_ONE_OCTET_MASK)) {
+        return 1;                                                     // RETURN
+    }
+
+    return BloombergLP::bdlde::Utf8Util::numLeadingAsciiBytes(
+                                   reinterpret_cast<const char *>(position),
+                                   d_end - position);
+}
+
 inline
 bool Utf8PtrBasedEnd::verifyContinuations(const OctetType *octets,
                                           int              n) const
@@ -462,6 +509,12 @@ struct Utf8ZeroBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
 
+    bsl::size_t numAsciiOctets(const OctetType *position) const;
+        // Return 1.  Note that runs of single-octet code points are not
+        // measured ahead when the end of input is marked by a null octet,
+        // since that would read past the end.  The behavior is undefined
+        // unless 'position' refers to a single-octet code point.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after up to the specified 'skipBy' consecutive
@@ -493,6 +546,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numAsciiOctets(const OctetType *) const
+{
+    return 1;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -1005,7 +1064,8 @@ class Utf8ToUtf32Translator {
         // is undefined unless 'd_capacity >= 2'.
 
     int decodeCodePoint();
-        // Read one Unicode code point of UTF-8 from the input stream
+        // Read one Unicode code point of UTF-8 (or, if the end of input is
+        // known, a run of single-octet code points) from the input stream
         // 'd_input', and update the output and the state of this object
         // accordingly.  Return a non-zero value if there was insufficient
         // capacity for the output, and 0 otherwise.  The behavior is undefined
@@ -1082,12 +1142,26 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint()
         return -1;                                                    // RETURN
     }
 
-    if      (isSingleOctet(     firstOctet)) {
-        len = 1;
-        good = true;
-        decodedCodePoint = firstOctet;
+    if (isSingleOctet(firstOctet)) {
+        // Translate, in one step, as much of the run of single-octet code
+        // points beginning at 'd_input' as will fit in the output.
+
+        const bsl::size_t numAscii = bsl::min<bsl::size_t>(
+                    d_capacity.limit(d_endFunctor.numAsciiOctets(d_input)),
+                    INT_MAX);
+
+        for (bsl::size_t i = 0; i < numAscii; ++i) {
+            d_output[i] = SWAPPER::swapBytes(d_input[i]);
+        }
+
+        d_input    += numAscii;
+        d_output   += numAscii;
+        d_capacity -= static_cast<int>(numAscii);
+
+        return 0;                                                     // RETURN
     }
-    else if (isTwoOctetHeader(  firstOctet)) {
+
+    if      (isTwoOctetHeader(  firstOctet)) {
         len = 2;
         good = d_endFunctor.verifyContinuations(d_input + 1, 1) &&
               ! fitsInSingleOctet(decodedCodePoint = decodeTwoOctets(d_input));
@@ -74,7 +74,9 @@ using bsl::size_t;
 //:   capacity specified was adequate, and is never set on translations with
 //:   STL container output destinations.
 // ----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [19] USAGE EXAMPLE
+// [18] UTF-32 <- UTF-8 ASCII runs, limited capacity
+// [17] UTF-32 <- UTF-8 Random table driven sequences with embedded nulls
 // [16] UTF-32 <- UTF-8 Random garbage input, random error word
 // [15] UTF-32 <- UTF-8 Table generated random sequences, random error word
 // [14] UTF-8 <- UTF-32 Random garbage input, random error byte
@@ -2742,7 +2744,7 @@ int main(int argc, char **argv)
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Simple example illustrating how one might use the 'utf8ToUtf32'
@@ -2872,6 +2874,103 @@ int main(int argc, char **argv)
     ASSERT(v32.size()                   == codePointsWritten);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // ASCII RUNS TEST
+        //
+        // Concerns:
+        //: 1 Runs of single-octet code points in UTF-8 input of explicit
+        //:   length, which are translated many octets per step, are translated
+        //:   identically to the same runs in null-terminated input, which are
+        //:   translated one octet per step.
+        //:
+        //: 2 A run is cut short exactly where the output buffer is full
+        //:   (leaving room for the terminating null word), and no word beyond
+        //:   the capacity of the buffer is written.
+        //
+        // Plan:
+        //: 1 Build strings of runs of ASCII of random lengths separated by
+        //:   multi-octet sequences and invalid octets.
+        //:
+        //: 2 Translate each string to UTF-32 with every capacity from 1 to
+        //:   more than is needed, with both byte orders, from both the
+        //:   null-terminated and the 'StringRef' forms of the input, into
+        //:   buffers filled with a sentinel value, and verify that the return
+        //:   values, the numbers of code points written, and the contents of
+        //:   the buffers are identical.  (C-1..2)
+        //
+        // Testing:
+        //   ASCII RUNS TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "ASCII RUNS TEST\n"
+                             "===============\n";
+
+        const unsigned int SENTINEL = 0xdeadbeef;
+
+        const char *const SEPARATORS[] = {
+            "\xc3\xa9",            // 2-octet code point
+            "\xe4\xb8\xad",        // 3-octet code point
+            "\xf0\x9f\x98\x80",    // 4-octet code point
+            "\x80",                // lone continuation
+            "\xff",                // invalid octet
+            "\xe4\xb8",            // truncated 3-octet code point
+        };
+        enum { NUM_SEPARATORS = sizeof SEPARATORS / sizeof *SEPARATORS };
+
+        const bdlde::ByteOrder::Enum ORDERS[] = {
+                                              bdlde::ByteOrder::e_HOST,
+                                              bdlde::ByteOrder::e_BIG_ENDIAN,
+                                              bdlde::ByteOrder::e_LITTLE_ENDIAN
+        };
+        enum { NUM_ORDERS = sizeof ORDERS / sizeof *ORDERS };
+
+        for (int ti = 0; ti < 100; ++ti) {
+            bsl::string input;
+            while (input.length() < 64 + static_cast<size_t>(ti)) {
+                for (int runLength = myRand15() % 40; runLength; --runLength) {
+                    input += static_cast<char>(' ' + myRand15() % 95);
+                }
+                input += SEPARATORS[myRand15() % NUM_SEPARATORS];
+            }
+
+            const size_t MAX_CAPACITY = input.length() + 2;
+
+            for (size_t capacity = 1; capacity <= MAX_CAPACITY; ++capacity) {
+                for (int tj = 0; tj < NUM_ORDERS; ++tj) {
+                    const bdlde::ByteOrder::Enum ORDER = ORDERS[tj];
+
+                    bsl::vector<unsigned int> expected(MAX_CAPACITY + 1,
+                                                       SENTINEL);
+                    bsl::vector<unsigned int> result(  MAX_CAPACITY + 1,
+                                                       SENTINEL);
+                    size_t expNumCodePoints = -1;
+                    size_t numCodePoints    = -2;
+
+                    const int EXP_RC = Util::utf8ToUtf32(&expected[0],
+                                                         capacity,
+                                                         input.c_str(),
+                                                         &expNumCodePoints,
+                                                         '?',
+                                                         ORDER);
+                    const int RC     = Util::utf8ToUtf32(
+                                                      &result[0],
+                                                      capacity,
+                                                      bslstl::StringRef(input),
+                                                      &numCodePoints,
+                                                      '?',
+                                                      ORDER);
+
+                    LOOP3_ASSERT(ti, capacity, tj, EXP_RC == RC);
+                    LOOP3_ASSERT(ti, capacity, tj,
+                                 expNumCodePoints == numCodePoints);
+                    LOOP3_ASSERT(ti, capacity, tj, expected == result);
+                    LOOP3_ASSERT(ti, capacity, tj,
+                                 SENTINEL == result[capacity]);
+                }
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // RANDOM TABLE DRIVEN UTF-8 -> UTF-32 TEST PLUS EMBEDDED NULLS
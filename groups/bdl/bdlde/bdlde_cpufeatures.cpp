@@ -0,0 +1,212 @@
+// bdlde_cpufeatures.cpp                                              -*-C++-*-
+#include <bdlde_cpufeatures.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_cpufeatures_cpp,"$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_CPUFEATURES_X86
+#include <cpuid.h>
+#endif
+#endif
+
+namespace BloombergLP {
+namespace bdlde {
+
+#ifdef BDLDE_CPUFEATURES_X86
+
+namespace {
+
+// 'CPUID' leaf 1, register 'ECX'
+const unsigned int k_CPUID1_ECX_PCLMULQDQ = 1U << 1;
+const unsigned int k_CPUID1_ECX_SSSE3     = 1U << 9;
+const unsigned int k_CPUID1_ECX_SSE4_1    = 1U << 19;
+const unsigned int k_CPUID1_ECX_SSE4_2    = 1U << 20;
+const unsigned int k_CPUID1_ECX_POPCNT    = 1U << 23;
+const unsigned int k_CPUID1_ECX_OSXSAVE   = 1U << 27;
+const unsigned int k_CPUID1_ECX_AVX       = 1U << 28;
+
+// 'CPUID' leaf 7 (sub-leaf 0), registers 'EBX' and 'ECX'
+const unsigned int k_CPUID7_EBX_AVX2       = 1U << 5;
+const unsigned int k_CPUID7_EBX_AVX512F    = 1U << 16;
+const unsigned int k_CPUID7_EBX_SHA        = 1U << 29;
+const unsigned int k_CPUID7_ECX_VPCLMULQDQ = 1U << 10;
+
+// 'XCR0' state components
+const unsigned int k_XCR0_SSE_AVX = 0x6;   // XMM and YMM registers
+const unsigned int k_XCR0_AVX512  = 0xE6;  // also opmask and ZMM registers
+
+enum Register { e_EBX, e_ECX };
+
+bool hasLeaf1Ecx(unsigned int mask)
+    // Return 'true' if all of the bits in the specified 'mask' are set in the
+    // 'ECX' register returned by 'CPUID' leaf 1, and 'false' otherwise.
+{
+    unsigned int eax, ebx, ecx, edx;
+
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && mask == (ecx & mask);
+}
+
+bool hasLeaf7(Register reg, unsigned int mask)
+    // Return 'true' if all of the bits in the specified 'mask' are set in the
+    // specified 'reg' returned by 'CPUID' leaf 7, sub-leaf 0, and 'false'
+    // otherwise (including if leaf 7 is not supported).
+{
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    return mask == ((e_EBX == reg ? ebx : ecx) & mask);
+}
+
+bool isOsStateEnabled(unsigned int xcr0Mask)
+    // Return 'true' if the CPU supports AVX, the operating system has enabled
+    // 'XSAVE', and all of the state components in the specified 'xcr0Mask'
+    // are enabled in 'XCR0', and 'false' otherwise.
+{
+    if (!hasLeaf1Ecx(k_CPUID1_ECX_OSXSAVE | k_CPUID1_ECX_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    unsigned int xcr0Low, xcr0High;
+    __asm__ __volatile__("xgetbv"
+                         : "=a"(xcr0Low), "=d"(xcr0High)
+                         : "c"(0));
+    (void)xcr0High;
+
+    return xcr0Mask == (xcr0Low & xcr0Mask);
+}
+
+}  // close unnamed namespace
+
+                            // ------------------
+                            // struct CpuFeatures
+                            // ------------------
+
+// CLASS METHODS
+bool CpuFeatures::hasAvx2()
+{
+    return isOsStateEnabled(k_XCR0_SSE_AVX)
+        && hasLeaf7(e_EBX, k_CPUID7_EBX_AVX2);
+}
+
+bool CpuFeatures::hasAvx512F()
+{
+    return isOsStateEnabled(k_XCR0_AVX512)
+        && hasLeaf7(e_EBX, k_CPUID7_EBX_AVX512F);
+}
+
+bool CpuFeatures::hasPclmulqdq()
+{
+    return hasLeaf1Ecx(k_CPUID1_ECX_PCLMULQDQ);
+}
+
+bool CpuFeatures::hasPopcnt()
+{
+    return hasLeaf1Ecx(k_CPUID1_ECX_POPCNT);
+}
+
+bool CpuFeatures::hasSha()
+{
+    return hasLeaf7(e_EBX, k_CPUID7_EBX_SHA);
+}
+
+bool CpuFeatures::hasSse41()
+{
+    return hasLeaf1Ecx(k_CPUID1_ECX_SSE4_1);
+}
+
+bool CpuFeatures::hasSse42()
+{
+    return hasLeaf1Ecx(k_CPUID1_ECX_SSE4_2);
+}
+
+bool CpuFeatures::hasSsse3()
+{
+    return hasLeaf1Ecx(k_CPUID1_ECX_SSSE3);
+}
+
+bool CpuFeatures::hasVpclmulqdq()
+{
+    return isOsStateEnabled(k_XCR0_SSE_AVX)
+        && hasLeaf7(e_ECX, k_CPUID7_ECX_VPCLMULQDQ);
+}
+
+#else
+
+                            // ------------------
+                            // struct CpuFeatures
+                            // ------------------
+
+// CLASS METHODS
+bool CpuFeatures::hasAvx2()
+{
+    return false;
+}
+
+bool CpuFeatures::hasAvx512F()
+{
+    return false;
+}
+
+bool CpuFeatures::hasPclmulqdq()
+{
+    return false;
+}
+
+bool CpuFeatures::hasPopcnt()
+{
+    return false;
+}
+
+bool CpuFeatures::hasSha()
+{
+    return false;
+}
+
+bool CpuFeatures::hasSse41()
+{
+    return false;
+}
+
+bool CpuFeatures::hasSse42()
+{
+    return false;
+}
+
+bool CpuFeatures::hasSsse3()
+{
+    return false;
+}
+
+bool CpuFeatures::hasVpclmulqdq()
+{
+    return false;
+}
+
+#endif  // BDLDE_CPUFEATURES_X86
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
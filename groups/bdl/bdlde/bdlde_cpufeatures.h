@@ -0,0 +1,155 @@
+// bdlde_cpufeatures.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLDE_CPUFEATURES
+#define INCLUDED_BDLDE_CPUFEATURES
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide runtime detection of the x86 instruction-set extensions.
+//
+//@CLASSES:
+//  bdlde::CpuFeatures: namespace for querying instruction-set extensions
+//
+//@SEE_ALSO: bdlde_base64util, bdlde_crc32c, bdlde_sha2, bdlde_utf8util
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::CpuFeatures', that
+// serves as a namespace for functions reporting whether the running CPU, and
+// the operating system it runs under, support the instruction-set extensions
+// used by the vector implementations of the 'bdlde' package.  The functions
+// are intended for use by the components of 'bdlde' when they select an
+// implementation, and should not be used outside of this package.
+//
+// Each function returns 'true' only if the corresponding instructions can be
+// executed by the calling thread, i.e.:
+//
+//: o the processor advertises the extension through the 'CPUID' instruction,
+//:   and
+//:
+//: o for the extensions that operate on the 256-bit or 512-bit registers
+//:   (AVX2, AVX-512F, and VPCLMULQDQ), the operating system has enabled the
+//:   'XSAVE' feature ('CPUID.1:ECX.OSXSAVE') and saves the corresponding
+//:   register state on a context switch (as reported in the 'XCR0' register
+//:   by the 'XGETBV' instruction).
+//
+// The checks are performed on x86 and x86-64 platforms when building with GCC
+// or clang; on all other platforms every function returns 'false'.
+//
+// Note that the functions execute 'CPUID' (and 'XGETBV') on every call, and
+// do not depend on any static data, so they may be called during static
+// initialization.  Callers that select an implementation frequently should
+// cache the result.
+//
+///Thread Safety
+///-------------
+// The functions in this component are thread safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting an Implementation at Startup
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a function having a portable implementation and
+// implementations using SSE4.1 and AVX2, and that we want to select the widest
+// implementation that can run on the current machine.  First, we enumerate
+// the implementations:
+//..
+//  enum Implementation { e_SCALAR, e_SSE4, e_AVX2 };
+//..
+// Then, we write a function that selects one of them:
+//..
+//  Implementation detectImplementation()
+//      // Return the widest implementation supported by the running CPU.
+//  {
+//      if (!bdlde::CpuFeatures::hasSsse3() ||
+//          !bdlde::CpuFeatures::hasSse41()) {
+//          return e_SCALAR;                                          // RETURN
+//      }
+//      return bdlde::CpuFeatures::hasAvx2() ? e_AVX2 : e_SSE4;
+//  }
+//..
+// Finally, we cache the selected implementation:
+//..
+//  static const Implementation s_implementation = detectImplementation();
+//  assert(e_SCALAR == s_implementation
+//      || e_SSE4   == s_implementation
+//      || e_AVX2   == s_implementation);
+//..
+
+#include <bdlscm_version.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                            // ==================
+                            // struct CpuFeatures
+                            // ==================
+
+struct CpuFeatures {
+    // This 'struct' provides a namespace for functions that report whether
+    // the instruction-set extensions used by the 'bdlde' package are available
+    // to the calling thread.
+
+    // CLASS METHODS
+    static bool hasAvx2();
+        // Return 'true' if the AVX and AVX2 instructions are supported by the
+        // CPU and the operating system saves the 256-bit register state, and
+        // 'false' otherwise.
+
+    static bool hasAvx512F();
+        // Return 'true' if the AVX-512 Foundation instructions are supported
+        // by the CPU and the operating system saves the 512-bit and opmask
+        // register state, and 'false' otherwise.
+
+    static bool hasPclmulqdq();
+        // Return 'true' if the 'PCLMULQDQ' (carry-less multiplication)
+        // instruction is supported by the CPU, and 'false' otherwise.
+
+    static bool hasPopcnt();
+        // Return 'true' if the 'POPCNT' instruction is supported by the CPU,
+        // and 'false' otherwise.
+
+    static bool hasSha();
+        // Return 'true' if the SHA extensions are supported by the CPU, and
+        // 'false' otherwise.
+
+    static bool hasSse41();
+        // Return 'true' if the SSE4.1 instructions are supported by the CPU,
+        // and 'false' otherwise.
+
+    static bool hasSse42();
+        // Return 'true' if the SSE4.2 instructions are supported by the CPU,
+        // and 'false' otherwise.
+
+    static bool hasSsse3();
+        // Return 'true' if the SSSE3 instructions are supported by the CPU,
+        // and 'false' otherwise.
+
+    static bool hasVpclmulqdq();
+        // Return 'true' if the VEX-encoded 'VPCLMULQDQ' instruction operating
+        // on 256-bit registers is supported by the CPU and the operating
+        // system saves the 256-bit register state, and 'false' otherwise.
+        // Note that using the 512-bit form additionally requires
+        // 'hasAvx512F()'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
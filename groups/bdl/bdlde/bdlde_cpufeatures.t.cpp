@@ -0,0 +1,349 @@
+// bdlde_cpufeatures.t.cpp                                            -*-C++-*-
+#include <bdlde_cpufeatures.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides a namespace for functions that query the
+// running CPU, whose results depend on the test machine.  We verify that the
+// results are stable, that they respect the dependencies between the
+// extensions, and (when building with GCC or clang on x86) that they agree
+// with the compiler's own runtime detection.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool hasAvx2();
+// [ 2] bool hasAvx512F();
+// [ 2] bool hasPclmulqdq();
+// [ 2] bool hasPopcnt();
+// [ 2] bool hasSha();
+// [ 2] bool hasSse41();
+// [ 2] bool hasSse42();
+// [ 2] bool hasSsse3();
+// [ 2] bool hasVpclmulqdq();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::CpuFeatures Obj;
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define U_X86
+#endif
+#endif
+
+// ============================================================================
+//                              USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting an Implementation at Startup
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have a function having a portable implementation and
+// implementations using SSE4.1 and AVX2, and that we want to select the widest
+// implementation that can run on the current machine.  First, we enumerate
+// the implementations:
+//..
+    enum Implementation { e_SCALAR, e_SSE4, e_AVX2 };
+//..
+// Then, we write a function that selects one of them:
+//..
+    Implementation detectImplementation()
+        // Return the widest implementation supported by the running CPU.
+    {
+        if (!bdlde::CpuFeatures::hasSsse3() ||
+            !bdlde::CpuFeatures::hasSse41()) {
+            return e_SCALAR;                                          // RETURN
+        }
+        return bdlde::CpuFeatures::hasAvx2() ? e_AVX2 : e_SSE4;
+    }
+//..
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int  test = argc > 1 ? atoi(argv[1]) : 0;
+    const bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Finally, we cache the selected implementation:
+//..
+    static const Implementation s_implementation = detectImplementation();
+    ASSERT(e_SCALAR == s_implementation
+        || e_SSE4   == s_implementation
+        || e_AVX2   == s_implementation);
+//..
+
+        if (verbose) P(s_implementation);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS
+        //
+        // Concerns:
+        //: 1 Each function returns the same value on every call.
+        //:
+        //: 2 An extension is not reported unless the extensions it depends on
+        //:   are also reported.
+        //:
+        //: 3 On x86 platforms, with GCC or clang, the functions agree with the
+        //:   runtime detection of the compiler, which checks the same 'CPUID'
+        //:   and 'XCR0' bits.
+        //:
+        //: 4 On other platforms, every function returns 'false'.
+        //
+        // Plan:
+        //: 1 Call each function twice and compare the results.  (C-1)
+        //:
+        //: 2 Verify that, e.g., 'hasAvx2()' implies 'hasSse41()'.  (C-2)
+        //:
+        //: 3 On x86 platforms, with GCC or clang, compare each function with
+        //:   '__builtin_cpu_supports'.  (C-3)
+        //:
+        //: 4 On other platforms, verify that every function returns 'false'.
+        //:   (C-4)
+        //
+        // Testing:
+        //   bool hasAvx2();
+        //   bool hasAvx512F();
+        //   bool hasPclmulqdq();
+        //   bool hasPopcnt();
+        //   bool hasSha();
+        //   bool hasSse41();
+        //   bool hasSse42();
+        //   bool hasSsse3();
+        //   bool hasVpclmulqdq();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS" << endl
+                          << "=============" << endl;
+
+        const bool AVX2       = Obj::hasAvx2();
+        const bool AVX512F    = Obj::hasAvx512F();
+        const bool PCLMULQDQ  = Obj::hasPclmulqdq();
+        const bool POPCNT     = Obj::hasPopcnt();
+        const bool SHA        = Obj::hasSha();
+        const bool SSE41      = Obj::hasSse41();
+        const bool SSE42      = Obj::hasSse42();
+        const bool SSSE3      = Obj::hasSsse3();
+        const bool VPCLMULQDQ = Obj::hasVpclmulqdq();
+
+        if (verbose) {
+            P_(AVX2) P_(AVX512F) P_(PCLMULQDQ) P_(POPCNT) P(SHA)
+            P_(SSE41) P_(SSE42) P_(SSSE3) P(VPCLMULQDQ)
+        }
+
+        if (verbose) cout << "\nStability." << endl;
+
+        ASSERT(AVX2       == Obj::hasAvx2());
+        ASSERT(AVX512F    == Obj::hasAvx512F());
+        ASSERT(PCLMULQDQ  == Obj::hasPclmulqdq());
+        ASSERT(POPCNT     == Obj::hasPopcnt());
+        ASSERT(SHA        == Obj::hasSha());
+        ASSERT(SSE41      == Obj::hasSse41());
+        ASSERT(SSE42      == Obj::hasSse42());
+        ASSERT(SSSE3      == Obj::hasSsse3());
+        ASSERT(VPCLMULQDQ == Obj::hasVpclmulqdq());
+
+        if (verbose) cout << "\nDependencies." << endl;
+
+        ASSERT(!SSE42   || SSE41);
+        ASSERT(!SSE41   || SSSE3);
+        ASSERT(!AVX2    || SSE42);
+        ASSERT(!AVX512F || AVX2);
+
+#ifdef U_X86
+        if (verbose) cout << "\nCompiler runtime detection." << endl;
+
+        __builtin_cpu_init();
+
+        ASSERT(AVX2       == !!__builtin_cpu_supports("avx2"));
+        ASSERT(AVX512F    == !!__builtin_cpu_supports("avx512f"));
+        ASSERT(PCLMULQDQ  == !!__builtin_cpu_supports("pclmul"));
+        ASSERT(POPCNT     == !!__builtin_cpu_supports("popcnt"));
+        ASSERT(SHA        == !!__builtin_cpu_supports("sha"));
+        ASSERT(SSE41      == !!__builtin_cpu_supports("sse4.1"));
+        ASSERT(SSE42      == !!__builtin_cpu_supports("sse4.2"));
+        ASSERT(SSSE3      == !!__builtin_cpu_supports("ssse3"));
+        ASSERT(VPCLMULQDQ == !!__builtin_cpu_supports("vpclmulqdq"));
+#else
+        if (verbose) cout << "\nNon-x86 platform." << endl;
+
+        ASSERT(!AVX2);
+        ASSERT(!AVX512F);
+        ASSERT(!PCLMULQDQ);
+        ASSERT(!POPCNT);
+        ASSERT(!SHA);
+        ASSERT(!SSE41);
+        ASSERT(!SSE42);
+        ASSERT(!SSSE3);
+        ASSERT(!VPCLMULQDQ);
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Call each function and print the results in verbose mode.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bool features[] = {
+            Obj::hasAvx2(),
+            Obj::hasAvx512F(),
+            Obj::hasPclmulqdq(),
+            Obj::hasPopcnt(),
+            Obj::hasSha(),
+            Obj::hasSse41(),
+            Obj::hasSse42(),
+            Obj::hasSsse3(),
+            Obj::hasVpclmulqdq()
+        };
+
+        static const char *const NAMES[] = {
+            "AVX2", "AVX-512F", "PCLMULQDQ", "POPCNT", "SHA", "SSE4.1",
+            "SSE4.2", "SSSE3", "VPCLMULQDQ"
+        };
+
+        const int NUM_FEATURES = sizeof features / sizeof *features;
+        ASSERT(NUM_FEATURES == sizeof NAMES / sizeof *NAMES);
+
+        if (verbose) {
+            for (int i = 0; i < NUM_FEATURES; ++i) {
+                cout << NAMES[i] << ": " << features[i] << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
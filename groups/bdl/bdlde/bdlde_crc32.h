@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// The 'update' method processes eight bytes at a time using "slicing-by-8"
+// table lookups.  On x86-64 platforms (with GCC or clang) whose CPU supports
+// the 'PCLMULQDQ' instruction, buffers of at least 64 bytes are instead folded
+// using carry-less multiplication, which is more than an order of magnitude
+// faster than the byte-at-a-time algorithm for large buffers.  The choice of
+// implementation is made at runtime and does not affect the checksum.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -5,6 +5,8 @@
 BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 
 // BDE
+#include <bdlde_cpufeatures.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_iostream.h>
@@ -31,6 +33,37 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 
 #if defined(LIKE_X86_GCC)
 #include <cpuid.h>
+#  ifdef BSLS_PLATFORM_CPU_64_BIT
+#include <immintrin.h>
+#  endif
+#endif
+
+// 'BDLDE_CRC32C_VPCLMULQDQ' is defined if the compiler supports the
+// 'vpclmulqdq' target attribute and the corresponding AVX-512 intrinsics.
+#if defined(LIKE_X86_GCC) && defined(BSLS_PLATFORM_CPU_64_BIT)
+#  if defined(BSLS_PLATFORM_CMP_GNU)
+#    if BSLS_PLATFORM_CMP_VERSION >= 80000
+#define BDLDE_CRC32C_VPCLMULQDQ
+#    endif
+#  elif defined(__APPLE_CC__)
+#    if BSLS_PLATFORM_CMP_VERSION >= 100000
+#define BDLDE_CRC32C_VPCLMULQDQ
+#    endif
+#  elif BSLS_PLATFORM_CMP_VERSION >= 60000
+#define BDLDE_CRC32C_VPCLMULQDQ
+#  endif
+#endif
+
+// Note that 'bsls_platform' does not (yet) identify the 64-bit ARM
+// architecture, so we rely on the compiler-defined macro.
+#if defined(__aarch64__)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define LIKE_ARM64_GCC
+#endif
+#endif
+
+#if defined(LIKE_ARM64_GCC) && defined(BSLS_PLATFORM_OS_LINUX)
+#include <sys/auxv.h>
 #endif
 
 // #define BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION
@@ -666,6 +699,153 @@ const unsigned int k_CRC_TABLE_IL8_O88[256] =
     0xC451B7CC, 0x8D6DCAEB, 0x56294D82, 0x1F1530A5
 };
 
+#if (defined(LIKE_X86_GCC) && defined(BSLS_PLATFORM_CPU_64_BIT)) \
+ ||  defined(LIKE_ARM64_GCC)
+
+const unsigned int k_MUL_TABLE1_336[256] =
+    // Lookup table used to shift the CRC32-C value of the second of three
+    // interleaved streams of a 1024-byte block past the third stream (336
+    // bytes) when recombining them.
+{
+    0x00000000, 0x8F158014, 0x1BC776D9, 0x94D2F6CD,
+    0x378EEDB2, 0xB89B6DA6, 0x2C499B6B, 0xA35C1B7F,
+    0x6F1DDB64, 0xE0085B70, 0x74DAADBD, 0xFBCF2DA9,
+    0x589336D6, 0xD786B6C2, 0x4354400F, 0xCC41C01B,
+    0xDE3BB6C8, 0x512E36DC, 0xC5FCC011, 0x4AE94005,
+    0xE9B55B7A, 0x66A0DB6E, 0xF2722DA3, 0x7D67ADB7,
+    0xB1266DAC, 0x3E33EDB8, 0xAAE11B75, 0x25F49B61,
+    0x86A8801E, 0x09BD000A, 0x9D6FF6C7, 0x127A76D3,
+    0xB99B1B61, 0x368E9B75, 0xA25C6DB8, 0x2D49EDAC,
+    0x8E15F6D3, 0x010076C7, 0x95D2800A, 0x1AC7001E,
+    0xD686C005, 0x59934011, 0xCD41B6DC, 0x425436C8,
+    0xE1082DB7, 0x6E1DADA3, 0xFACF5B6E, 0x75DADB7A,
+    0x67A0ADA9, 0xE8B52DBD, 0x7C67DB70, 0xF3725B64,
+    0x502E401B, 0xDF3BC00F, 0x4BE936C2, 0xC4FCB6D6,
+    0x08BD76CD, 0x87A8F6D9, 0x137A0014, 0x9C6F8000,
+    0x3F339B7F, 0xB0261B6B, 0x24F4EDA6, 0xABE16DB2,
+    0x76DA4033, 0xF9CFC027, 0x6D1D36EA, 0xE208B6FE,
+    0x4154AD81, 0xCE412D95, 0x5A93DB58, 0xD5865B4C,
+    0x19C79B57, 0x96D21B43, 0x0200ED8E, 0x8D156D9A,
+    0x2E4976E5, 0xA15CF6F1, 0x358E003C, 0xBA9B8028,
+    0xA8E1F6FB, 0x27F476EF, 0xB3268022, 0x3C330036,
+    0x9F6F1B49, 0x107A9B5D, 0x84A86D90, 0x0BBDED84,
+    0xC7FC2D9F, 0x48E9AD8B, 0xDC3B5B46, 0x532EDB52,
+    0xF072C02D, 0x7F674039, 0xEBB5B6F4, 0x64A036E0,
+    0xCF415B52, 0x4054DB46, 0xD4862D8B, 0x5B93AD9F,
+    0xF8CFB6E0, 0x77DA36F4, 0xE308C039, 0x6C1D402D,
+    0xA05C8036, 0x2F490022, 0xBB9BF6EF, 0x348E76FB,
+    0x97D26D84, 0x18C7ED90, 0x8C151B5D, 0x03009B49,
+    0x117AED9A, 0x9E6F6D8E, 0x0ABD9B43, 0x85A81B57,
+    0x26F40028, 0xA9E1803C, 0x3D3376F1, 0xB226F6E5,
+    0x7E6736FE, 0xF172B6EA, 0x65A04027, 0xEAB5C033,
+    0x49E9DB4C, 0xC6FC5B58, 0x522EAD95, 0xDD3B2D81,
+    0xEDB48066, 0x62A10072, 0xF673F6BF, 0x796676AB,
+    0xDA3A6DD4, 0x552FEDC0, 0xC1FD1B0D, 0x4EE89B19,
+    0x82A95B02, 0x0DBCDB16, 0x996E2DDB, 0x167BADCF,
+    0xB527B6B0, 0x3A3236A4, 0xAEE0C069, 0x21F5407D,
+    0x338F36AE, 0xBC9AB6BA, 0x28484077, 0xA75DC063,
+    0x0401DB1C, 0x8B145B08, 0x1FC6ADC5, 0x90D32DD1,
+    0x5C92EDCA, 0xD3876DDE, 0x47559B13, 0xC8401B07,
+    0x6B1C0078, 0xE409806C, 0x70DB76A1, 0xFFCEF6B5,
+    0x542F9B07, 0xDB3A1B13, 0x4FE8EDDE, 0xC0FD6DCA,
+    0x63A176B5, 0xECB4F6A1, 0x7866006C, 0xF7738078,
+    0x3B324063, 0xB427C077, 0x20F536BA, 0xAFE0B6AE,
+    0x0CBCADD1, 0x83A92DC5, 0x177BDB08, 0x986E5B1C,
+    0x8A142DCF, 0x0501ADDB, 0x91D35B16, 0x1EC6DB02,
+    0xBD9AC07D, 0x328F4069, 0xA65DB6A4, 0x294836B0,
+    0xE509F6AB, 0x6A1C76BF, 0xFECE8072, 0x71DB0066,
+    0xD2871B19, 0x5D929B0D, 0xC9406DC0, 0x4655EDD4,
+    0x9B6EC055, 0x147B4041, 0x80A9B68C, 0x0FBC3698,
+    0xACE02DE7, 0x23F5ADF3, 0xB7275B3E, 0x3832DB2A,
+    0xF4731B31, 0x7B669B25, 0xEFB46DE8, 0x60A1EDFC,
+    0xC3FDF683, 0x4CE87697, 0xD83A805A, 0x572F004E,
+    0x4555769D, 0xCA40F689, 0x5E920044, 0xD1878050,
+    0x72DB9B2F, 0xFDCE1B3B, 0x691CEDF6, 0xE6096DE2,
+    0x2A48ADF9, 0xA55D2DED, 0x318FDB20, 0xBE9A5B34,
+    0x1DC6404B, 0x92D3C05F, 0x06013692, 0x8914B686,
+    0x22F5DB34, 0xADE05B20, 0x3932ADED, 0xB6272DF9,
+    0x157B3686, 0x9A6EB692, 0x0EBC405F, 0x81A9C04B,
+    0x4DE80050, 0xC2FD8044, 0x562F7689, 0xD93AF69D,
+    0x7A66EDE2, 0xF5736DF6, 0x61A19B3B, 0xEEB41B2F,
+    0xFCCE6DFC, 0x73DBEDE8, 0xE7091B25, 0x681C9B31,
+    0xCB40804E, 0x4455005A, 0xD087F697, 0x5F927683,
+    0x93D3B698, 0x1CC6368C, 0x8814C041, 0x07014055,
+    0xA45D5B2A, 0x2B48DB3E, 0xBF9A2DF3, 0x308FADE7
+};
+
+const unsigned int k_MUL_TABLE1_672[256] =
+    // Lookup table used to shift the CRC32-C value of the first of three
+    // interleaved streams of a 1024-byte block past the other two streams
+    // (672 bytes) when recombining them.
+{
+    0x00000000, 0xE417F38A, 0xCDC391E5, 0x29D4626F,
+    0x9E6B553B, 0x7A7CA6B1, 0x53A8C4DE, 0xB7BF3754,
+    0x393ADC87, 0xDD2D2F0D, 0xF4F94D62, 0x10EEBEE8,
+    0xA75189BC, 0x43467A36, 0x6A921859, 0x8E85EBD3,
+    0x7275B90E, 0x96624A84, 0xBFB628EB, 0x5BA1DB61,
+    0xEC1EEC35, 0x08091FBF, 0x21DD7DD0, 0xC5CA8E5A,
+    0x4B4F6589, 0xAF589603, 0x868CF46C, 0x629B07E6,
+    0xD52430B2, 0x3133C338, 0x18E7A157, 0xFCF052DD,
+    0xE4EB721C, 0x00FC8196, 0x2928E3F9, 0xCD3F1073,
+    0x7A802727, 0x9E97D4AD, 0xB743B6C2, 0x53544548,
+    0xDDD1AE9B, 0x39C65D11, 0x10123F7E, 0xF405CCF4,
+    0x43BAFBA0, 0xA7AD082A, 0x8E796A45, 0x6A6E99CF,
+    0x969ECB12, 0x72893898, 0x5B5D5AF7, 0xBF4AA97D,
+    0x08F59E29, 0xECE26DA3, 0xC5360FCC, 0x2121FC46,
+    0xAFA41795, 0x4BB3E41F, 0x62678670, 0x867075FA,
+    0x31CF42AE, 0xD5D8B124, 0xFC0CD34B, 0x181B20C1,
+    0xCC3A92C9, 0x282D6143, 0x01F9032C, 0xE5EEF0A6,
+    0x5251C7F2, 0xB6463478, 0x9F925617, 0x7B85A59D,
+    0xF5004E4E, 0x1117BDC4, 0x38C3DFAB, 0xDCD42C21,
+    0x6B6B1B75, 0x8F7CE8FF, 0xA6A88A90, 0x42BF791A,
+    0xBE4F2BC7, 0x5A58D84D, 0x738CBA22, 0x979B49A8,
+    0x20247EFC, 0xC4338D76, 0xEDE7EF19, 0x09F01C93,
+    0x8775F740, 0x636204CA, 0x4AB666A5, 0xAEA1952F,
+    0x191EA27B, 0xFD0951F1, 0xD4DD339E, 0x30CAC014,
+    0x28D1E0D5, 0xCCC6135F, 0xE5127130, 0x010582BA,
+    0xB6BAB5EE, 0x52AD4664, 0x7B79240B, 0x9F6ED781,
+    0x11EB3C52, 0xF5FCCFD8, 0xDC28ADB7, 0x383F5E3D,
+    0x8F806969, 0x6B979AE3, 0x4243F88C, 0xA6540B06,
+    0x5AA459DB, 0xBEB3AA51, 0x9767C83E, 0x73703BB4,
+    0xC4CF0CE0, 0x20D8FF6A, 0x090C9D05, 0xED1B6E8F,
+    0x639E855C, 0x878976D6, 0xAE5D14B9, 0x4A4AE733,
+    0xFDF5D067, 0x19E223ED, 0x30364182, 0xD421B208,
+    0x9D995363, 0x798EA0E9, 0x505AC286, 0xB44D310C,
+    0x03F20658, 0xE7E5F5D2, 0xCE3197BD, 0x2A266437,
+    0xA4A38FE4, 0x40B47C6E, 0x69601E01, 0x8D77ED8B,
+    0x3AC8DADF, 0xDEDF2955, 0xF70B4B3A, 0x131CB8B0,
+    0xEFECEA6D, 0x0BFB19E7, 0x222F7B88, 0xC6388802,
+    0x7187BF56, 0x95904CDC, 0xBC442EB3, 0x5853DD39,
+    0xD6D636EA, 0x32C1C560, 0x1B15A70F, 0xFF025485,
+    0x48BD63D1, 0xACAA905B, 0x857EF234, 0x616901BE,
+    0x7972217F, 0x9D65D2F5, 0xB4B1B09A, 0x50A64310,
+    0xE7197444, 0x030E87CE, 0x2ADAE5A1, 0xCECD162B,
+    0x4048FDF8, 0xA45F0E72, 0x8D8B6C1D, 0x699C9F97,
+    0xDE23A8C3, 0x3A345B49, 0x13E03926, 0xF7F7CAAC,
+    0x0B079871, 0xEF106BFB, 0xC6C40994, 0x22D3FA1E,
+    0x956CCD4A, 0x717B3EC0, 0x58AF5CAF, 0xBCB8AF25,
+    0x323D44F6, 0xD62AB77C, 0xFFFED513, 0x1BE92699,
+    0xAC5611CD, 0x4841E247, 0x61958028, 0x858273A2,
+    0x51A3C1AA, 0xB5B43220, 0x9C60504F, 0x7877A3C5,
+    0xCFC89491, 0x2BDF671B, 0x020B0574, 0xE61CF6FE,
+    0x68991D2D, 0x8C8EEEA7, 0xA55A8CC8, 0x414D7F42,
+    0xF6F24816, 0x12E5BB9C, 0x3B31D9F3, 0xDF262A79,
+    0x23D678A4, 0xC7C18B2E, 0xEE15E941, 0x0A021ACB,
+    0xBDBD2D9F, 0x59AADE15, 0x707EBC7A, 0x94694FF0,
+    0x1AECA423, 0xFEFB57A9, 0xD72F35C6, 0x3338C64C,
+    0x8487F118, 0x60900292, 0x494460FD, 0xAD539377,
+    0xB548B3B6, 0x515F403C, 0x788B2253, 0x9C9CD1D9,
+    0x2B23E68D, 0xCF341507, 0xE6E07768, 0x02F784E2,
+    0x8C726F31, 0x68659CBB, 0x41B1FED4, 0xA5A60D5E,
+    0x12193A0A, 0xF60EC980, 0xDFDAABEF, 0x3BCD5865,
+    0xC73D0AB8, 0x232AF932, 0x0AFE9B5D, 0xEEE968D7,
+    0x59565F83, 0xBD41AC09, 0x9495CE66, 0x70823DEC,
+    0xFE07D63F, 0x1A1025B5, 0x33C447DA, 0xD7D3B450,
+    0x606C8304, 0x847B708E, 0xADAF12E1, 0x49B8E16B
+};
+
+#endif  // (LIKE_X86_GCC && BSLS_PLATFORM_CPU_64_BIT) || LIKE_ARM64_GCC
+
                         //=======================
                         // class Crc32cCalculator
                         //=======================
@@ -674,7 +854,9 @@ class Crc32cCalculator {
     // This class represents a singleton that detects if the current processor
     // supports hardware instructions to help calculate CRC32-C and initializes
     // a global variable with a pointer to a function that uses those
-    // instructions, or provides software implementation otherwise.
+    // instructions, or provides software implementation otherwise.  Pointers
+    // to the best available function implementing each alternative
+    // algorithm exposed by 'Crc32c_Impl' are initialized likewise.
 
     // TYPES
     typedef unsigned int (*Crc32cFn)(const unsigned char *data,
@@ -687,6 +869,18 @@ class Crc32cCalculator {
     static Crc32cFn s_crc32cFn;
         // A global CRC32-C calculator function to compute CRC32-C checksum.
 
+    static Crc32cFn s_serialFn;
+        // The function used by 'Crc32c_Impl::calculateHardwareSerial'.
+
+    static Crc32cFn s_interleavedFn;
+        // The function used by 'Crc32c_Impl::calculateHardwareInterleaved'.
+
+    static Crc32cFn s_foldingFn;
+        // The function used by 'Crc32c_Impl::calculateHardwareFolding'.
+
+    static Crc32cFn s_wideFoldingFn;
+        // The function used by 'Crc32c_Impl::calculateHardwareWideFolding'.
+
     // CREATORS
     Crc32cCalculator();
         // Create an instance of this class.
@@ -706,6 +900,23 @@ class Crc32cCalculator {
         // Invoke the global function that calculates CRC3-C passing to this
         // function the specified 'data', 'length' and 'crc' parameters.  Note
         // that if 'data' is 0, then 'length' must also be 0.
+
+    unsigned int folding(const unsigned char *data,
+                         bsl::size_t          length,
+                         unsigned int         crc) const;
+    unsigned int interleaved(const unsigned char *data,
+                             bsl::size_t          length,
+                             unsigned int         crc) const;
+    unsigned int serial(const unsigned char *data,
+                        bsl::size_t          length,
+                        unsigned int         crc) const;
+    unsigned int wideFolding(const unsigned char *data,
+                             bsl::size_t          length,
+                             unsigned int         crc) const;
+        // Invoke the function implementing the corresponding alternative
+        // algorithm exposed by 'Crc32c_Impl', passing to this function the
+        // specified 'data', 'length' and 'crc' parameters.  Note that if
+        // 'data' is 0, then 'length' must also be 0.
 };
 
 inline
@@ -943,140 +1154,6 @@ unsigned int crc32c1024SseInt(const unsigned char *data,
 
     // Compute CRC32-C for 1024 bytes using SSE & recombine using lookup tables
 
-    static const unsigned int k_MUL_TABLE1_336[256] = {
-        0x00000000, 0x8F158014, 0x1BC776D9, 0x94D2F6CD,
-        0x378EEDB2, 0xB89B6DA6, 0x2C499B6B, 0xA35C1B7F,
-        0x6F1DDB64, 0xE0085B70, 0x74DAADBD, 0xFBCF2DA9,
-        0x589336D6, 0xD786B6C2, 0x4354400F, 0xCC41C01B,
-        0xDE3BB6C8, 0x512E36DC, 0xC5FCC011, 0x4AE94005,
-        0xE9B55B7A, 0x66A0DB6E, 0xF2722DA3, 0x7D67ADB7,
-        0xB1266DAC, 0x3E33EDB8, 0xAAE11B75, 0x25F49B61,
-        0x86A8801E, 0x09BD000A, 0x9D6FF6C7, 0x127A76D3,
-        0xB99B1B61, 0x368E9B75, 0xA25C6DB8, 0x2D49EDAC,
-        0x8E15F6D3, 0x010076C7, 0x95D2800A, 0x1AC7001E,
-        0xD686C005, 0x59934011, 0xCD41B6DC, 0x425436C8,
-        0xE1082DB7, 0x6E1DADA3, 0xFACF5B6E, 0x75DADB7A,
-        0x67A0ADA9, 0xE8B52DBD, 0x7C67DB70, 0xF3725B64,
-        0x502E401B, 0xDF3BC00F, 0x4BE936C2, 0xC4FCB6D6,
-        0x08BD76CD, 0x87A8F6D9, 0x137A0014, 0x9C6F8000,
-        0x3F339B7F, 0xB0261B6B, 0x24F4EDA6, 0xABE16DB2,
-        0x76DA4033, 0xF9CFC027, 0x6D1D36EA, 0xE208B6FE,
-        0x4154AD81, 0xCE412D95, 0x5A93DB58, 0xD5865B4C,
-        0x19C79B57, 0x96D21B43, 0x0200ED8E, 0x8D156D9A,
-        0x2E4976E5, 0xA15CF6F1, 0x358E003C, 0xBA9B8028,
-        0xA8E1F6FB, 0x27F476EF, 0xB3268022, 0x3C330036,
-        0x9F6F1B49, 0x107A9B5D, 0x84A86D90, 0x0BBDED84,
-        0xC7FC2D9F, 0x48E9AD8B, 0xDC3B5B46, 0x532EDB52,
-        0xF072C02D, 0x7F674039, 0xEBB5B6F4, 0x64A036E0,
-        0xCF415B52, 0x4054DB46, 0xD4862D8B, 0x5B93AD9F,
-        0xF8CFB6E0, 0x77DA36F4, 0xE308C039, 0x6C1D402D,
-        0xA05C8036, 0x2F490022, 0xBB9BF6EF, 0x348E76FB,
-        0x97D26D84, 0x18C7ED90, 0x8C151B5D, 0x03009B49,
-        0x117AED9A, 0x9E6F6D8E, 0x0ABD9B43, 0x85A81B57,
-        0x26F40028, 0xA9E1803C, 0x3D3376F1, 0xB226F6E5,
-        0x7E6736FE, 0xF172B6EA, 0x65A04027, 0xEAB5C033,
-        0x49E9DB4C, 0xC6FC5B58, 0x522EAD95, 0xDD3B2D81,
-        0xEDB48066, 0x62A10072, 0xF673F6BF, 0x796676AB,
-        0xDA3A6DD4, 0x552FEDC0, 0xC1FD1B0D, 0x4EE89B19,
-        0x82A95B02, 0x0DBCDB16, 0x996E2DDB, 0x167BADCF,
-        0xB527B6B0, 0x3A3236A4, 0xAEE0C069, 0x21F5407D,
-        0x338F36AE, 0xBC9AB6BA, 0x28484077, 0xA75DC063,
-        0x0401DB1C, 0x8B145B08, 0x1FC6ADC5, 0x90D32DD1,
-        0x5C92EDCA, 0xD3876DDE, 0x47559B13, 0xC8401B07,
-        0x6B1C0078, 0xE409806C, 0x70DB76A1, 0xFFCEF6B5,
-        0x542F9B07, 0xDB3A1B13, 0x4FE8EDDE, 0xC0FD6DCA,
-        0x63A176B5, 0xECB4F6A1, 0x7866006C, 0xF7738078,
-        0x3B324063, 0xB427C077, 0x20F536BA, 0xAFE0B6AE,
-        0x0CBCADD1, 0x83A92DC5, 0x177BDB08, 0x986E5B1C,
-        0x8A142DCF, 0x0501ADDB, 0x91D35B16, 0x1EC6DB02,
-        0xBD9AC07D, 0x328F4069, 0xA65DB6A4, 0x294836B0,
-        0xE509F6AB, 0x6A1C76BF, 0xFECE8072, 0x71DB0066,
-        0xD2871B19, 0x5D929B0D, 0xC9406DC0, 0x4655EDD4,
-        0x9B6EC055, 0x147B4041, 0x80A9B68C, 0x0FBC3698,
-        0xACE02DE7, 0x23F5ADF3, 0xB7275B3E, 0x3832DB2A,
-        0xF4731B31, 0x7B669B25, 0xEFB46DE8, 0x60A1EDFC,
-        0xC3FDF683, 0x4CE87697, 0xD83A805A, 0x572F004E,
-        0x4555769D, 0xCA40F689, 0x5E920044, 0xD1878050,
-        0x72DB9B2F, 0xFDCE1B3B, 0x691CEDF6, 0xE6096DE2,
-        0x2A48ADF9, 0xA55D2DED, 0x318FDB20, 0xBE9A5B34,
-        0x1DC6404B, 0x92D3C05F, 0x06013692, 0x8914B686,
-        0x22F5DB34, 0xADE05B20, 0x3932ADED, 0xB6272DF9,
-        0x157B3686, 0x9A6EB692, 0x0EBC405F, 0x81A9C04B,
-        0x4DE80050, 0xC2FD8044, 0x562F7689, 0xD93AF69D,
-        0x7A66EDE2, 0xF5736DF6, 0x61A19B3B, 0xEEB41B2F,
-        0xFCCE6DFC, 0x73DBEDE8, 0xE7091B25, 0x681C9B31,
-        0xCB40804E, 0x4455005A, 0xD087F697, 0x5F927683,
-        0x93D3B698, 0x1CC6368C, 0x8814C041, 0x07014055,
-        0xA45D5B2A, 0x2B48DB3E, 0xBF9A2DF3, 0x308FADE7
-    };
-
-    static const unsigned int k_MUL_TABLE1_672[256] = {
-        0x00000000, 0xE417F38A, 0xCDC391E5, 0x29D4626F,
-        0x9E6B553B, 0x7A7CA6B1, 0x53A8C4DE, 0xB7BF3754,
-        0x393ADC87, 0xDD2D2F0D, 0xF4F94D62, 0x10EEBEE8,
-        0xA75189BC, 0x43467A36, 0x6A921859, 0x8E85EBD3,
-        0x7275B90E, 0x96624A84, 0xBFB628EB, 0x5BA1DB61,
-        0xEC1EEC35, 0x08091FBF, 0x21DD7DD0, 0xC5CA8E5A,
-        0x4B4F6589, 0xAF589603, 0x868CF46C, 0x629B07E6,
-        0xD52430B2, 0x3133C338, 0x18E7A157, 0xFCF052DD,
-        0xE4EB721C, 0x00FC8196, 0x2928E3F9, 0xCD3F1073,
-        0x7A802727, 0x9E97D4AD, 0xB743B6C2, 0x53544548,
-        0xDDD1AE9B, 0x39C65D11, 0x10123F7E, 0xF405CCF4,
-        0x43BAFBA0, 0xA7AD082A, 0x8E796A45, 0x6A6E99CF,
-        0x969ECB12, 0x72893898, 0x5B5D5AF7, 0xBF4AA97D,
-        0x08F59E29, 0xECE26DA3, 0xC5360FCC, 0x2121FC46,
-        0xAFA41795, 0x4BB3E41F, 0x62678670, 0x867075FA,
-        0x31CF42AE, 0xD5D8B124, 0xFC0CD34B, 0x181B20C1,
-        0xCC3A92C9, 0x282D6143, 0x01F9032C, 0xE5EEF0A6,
-        0x5251C7F2, 0xB6463478, 0x9F925617, 0x7B85A59D,
-        0xF5004E4E, 0x1117BDC4, 0x38C3DFAB, 0xDCD42C21,
-        0x6B6B1B75, 0x8F7CE8FF, 0xA6A88A90, 0x42BF791A,
-        0xBE4F2BC7, 0x5A58D84D, 0x738CBA22, 0x979B49A8,
-        0x20247EFC, 0xC4338D76, 0xEDE7EF19, 0x09F01C93,
-        0x8775F740, 0x636204CA, 0x4AB666A5, 0xAEA1952F,
-        0x191EA27B, 0xFD0951F1, 0xD4DD339E, 0x30CAC014,
-        0x28D1E0D5, 0xCCC6135F, 0xE5127130, 0x010582BA,
-        0xB6BAB5EE, 0x52AD4664, 0x7B79240B, 0x9F6ED781,
-        0x11EB3C52, 0xF5FCCFD8, 0xDC28ADB7, 0x383F5E3D,
-        0x8F806969, 0x6B979AE3, 0x4243F88C, 0xA6540B06,
-        0x5AA459DB, 0xBEB3AA51, 0x9767C83E, 0x73703BB4,
-        0xC4CF0CE0, 0x20D8FF6A, 0x090C9D05, 0xED1B6E8F,
-        0x639E855C, 0x878976D6, 0xAE5D14B9, 0x4A4AE733,
-        0xFDF5D067, 0x19E223ED, 0x30364182, 0xD421B208,
-        0x9D995363, 0x798EA0E9, 0x505AC286, 0xB44D310C,
-        0x03F20658, 0xE7E5F5D2, 0xCE3197BD, 0x2A266437,
-        0xA4A38FE4, 0x40B47C6E, 0x69601E01, 0x8D77ED8B,
-        0x3AC8DADF, 0xDEDF2955, 0xF70B4B3A, 0x131CB8B0,
-        0xEFECEA6D, 0x0BFB19E7, 0x222F7B88, 0xC6388802,
-        0x7187BF56, 0x95904CDC, 0xBC442EB3, 0x5853DD39,
-        0xD6D636EA, 0x32C1C560, 0x1B15A70F, 0xFF025485,
-        0x48BD63D1, 0xACAA905B, 0x857EF234, 0x616901BE,
-        0x7972217F, 0x9D65D2F5, 0xB4B1B09A, 0x50A64310,
-        0xE7197444, 0x030E87CE, 0x2ADAE5A1, 0xCECD162B,
-        0x4048FDF8, 0xA45F0E72, 0x8D8B6C1D, 0x699C9F97,
-        0xDE23A8C3, 0x3A345B49, 0x13E03926, 0xF7F7CAAC,
-        0x0B079871, 0xEF106BFB, 0xC6C40994, 0x22D3FA1E,
-        0x956CCD4A, 0x717B3EC0, 0x58AF5CAF, 0xBCB8AF25,
-        0x323D44F6, 0xD62AB77C, 0xFFFED513, 0x1BE92699,
-        0xAC5611CD, 0x4841E247, 0x61958028, 0x858273A2,
-        0x51A3C1AA, 0xB5B43220, 0x9C60504F, 0x7877A3C5,
-        0xCFC89491, 0x2BDF671B, 0x020B0574, 0xE61CF6FE,
-        0x68991D2D, 0x8C8EEEA7, 0xA55A8CC8, 0x414D7F42,
-        0xF6F24816, 0x12E5BB9C, 0x3B31D9F3, 0xDF262A79,
-        0x23D678A4, 0xC7C18B2E, 0xEE15E941, 0x0A021ACB,
-        0xBDBD2D9F, 0x59AADE15, 0x707EBC7A, 0x94694FF0,
-        0x1AECA423, 0xFEFB57A9, 0xD72F35C6, 0x3338C64C,
-        0x8487F118, 0x60900292, 0x494460FD, 0xAD539377,
-        0xB548B3B6, 0x515F403C, 0x788B2253, 0x9C9CD1D9,
-        0x2B23E68D, 0xCF341507, 0xE6E07768, 0x02F784E2,
-        0x8C726F31, 0x68659CBB, 0x41B1FED4, 0xA5A60D5E,
-        0x12193A0A, 0xF60EC980, 0xDFDAABEF, 0x3BCD5865,
-        0xC73D0AB8, 0x232AF932, 0x0AFE9B5D, 0xEEE968D7,
-        0x59565F83, 0xBD41AC09, 0x9495CE66, 0x70823DEC,
-        0xFE07D63F, 0x1A1025B5, 0x33C447DA, 0xD7D3B450,
-        0x606C8304, 0x847B708E, 0xADAF12E1, 0x49B8E16B
-    };
-
 #define C(i)                                \
     c1 = __builtin_ia32_crc32di(c1, b1[i]); \
     c2 = __builtin_ia32_crc32di(c2, b2[i]); \
@@ -1154,6 +1231,214 @@ unsigned int crc32cSse64bit(const unsigned char *data,
     return ~crc;
 }
 
+#define BDLDE_CRC32C_PCLMUL_TARGET __attribute__((target("sse4.2,pclmul")))
+    // Enable the 'PCLMULQDQ' instruction in the annotated function, which
+    // must be invoked only if the running CPU supports it.
+
+BDLDE_CRC32C_PCLMUL_TARGET
+inline
+__m128i fold128(__m128i value, __m128i constants, __m128i next)
+    // Return the sum (XOR) of the specified 'next' 128 bits of a message and
+    // the specified 'value' 128 bits preceding them, folded forward using the
+    // specified 'constants'.  The low and high 64 bits of 'constants' must
+    // hold the bit-reflected values of 'x^(D + 32)' and 'x^(D - 32)' modulo
+    // the generator polynomial (shifted left by one bit), respectively, where
+    // 'D' is the distance, in bits, between 'value' and 'next' in the
+    // message.  See Intel White Paper for details: "Fast CRC Computation for
+    // Generic Polynomials Using PCLMULQDQ Instruction".
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value,
+                                                             constants,
+                                                             0x00),
+                                       _mm_clmulepi64_si128(value,
+                                                             constants,
+                                                             0x11)),
+                         next);
+}
+
+BDLDE_CRC32C_PCLMUL_TARGET
+unsigned int crc32cFoldTail(__m128i              value,
+                            const unsigned char *data,
+                            bsl::size_t          length)
+    // Return the (non-inverted) CRC32-C register value for the message made
+    // of the specified 'value' (holding the previously folded bytes of the
+    // message, including the initial register value) followed by the
+    // specified 'length' bytes of the specified 'data'.
+{
+    const __m128i k_FOLD_128 = _mm_set_epi64x(0x14cd00bd6LL, 0xf20c0dfeLL);
+
+    for (; length >= 16; length -= 16, data += 16) {
+        value = fold128(value,
+                        k_FOLD_128,
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                                      data)));
+    }
+
+    // Reduce the remaining 128 bits using the CRC32 instruction, then process
+    // the trailing bytes.
+
+    unsigned int crc = static_cast<unsigned int>(
+                   __builtin_ia32_crc32di(0, _mm_cvtsi128_si64(value)));
+    crc = static_cast<unsigned int>(
+                 __builtin_ia32_crc32di(crc, _mm_extract_epi64(value, 1)));
+
+    return crc32c8s(data, length, crc);
+}
+
+BDLDE_CRC32C_PCLMUL_TARGET
+unsigned int crc32cFolding(const unsigned char *data,
+                           bsl::size_t          length,
+                           unsigned int         crc)
+    // Calculate the CRC32-C value for the specified 'data' over the specified
+    // 'length' number of bytes, using the specified 'crc' value as the
+    // starting point for the calculation.  Buffers of at least
+    // 'Crc32c::k_FOLDING_THRESHOLD' bytes are processed by folding four
+    // 128-bit lanes over 64-byte blocks using carry-less multiplication
+    // ('PCLMULQDQ'), and shorter buffers are delegated to 'crc32cSse64bit'.
+    // The behavior is undefined unless the running CPU supports the
+    // 'PCLMULQDQ' and SSE4.2 instructions.  Note that the 'data' is permitted
+    // to be null if the 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    if (length < Crc32c::k_FOLDING_THRESHOLD) {
+        return crc32cSse64bit(data, length, crc);                     // RETURN
+    }
+
+    const __m128i k_FOLD_512 = _mm_set_epi64x(0x9e4addf8LL, 0x740eef02LL);
+    const __m128i k_FOLD_128 = _mm_set_epi64x(0x14cd00bd6LL, 0xf20c0dfeLL);
+
+    const __m128i *block = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(block),
+                               _mm_cvtsi32_si128(static_cast<int>(~crc)));
+    __m128i x1 = _mm_loadu_si128(block + 1);
+    __m128i x2 = _mm_loadu_si128(block + 2);
+    __m128i x3 = _mm_loadu_si128(block + 3);
+
+    block  += 4;
+    length -= 64;
+
+    for (; length >= 64; length -= 64, block += 4) {
+        x0 = fold128(x0, k_FOLD_512, _mm_loadu_si128(block));
+        x1 = fold128(x1, k_FOLD_512, _mm_loadu_si128(block + 1));
+        x2 = fold128(x2, k_FOLD_512, _mm_loadu_si128(block + 2));
+        x3 = fold128(x3, k_FOLD_512, _mm_loadu_si128(block + 3));
+    }
+
+    x0 = fold128(x0, k_FOLD_128, x1);
+    x0 = fold128(x0, k_FOLD_128, x2);
+    x0 = fold128(x0, k_FOLD_128, x3);
+
+    return ~crc32cFoldTail(x0,
+                           reinterpret_cast<const unsigned char *>(block),
+                           length);
+}
+
+#    if defined(BDLDE_CRC32C_VPCLMULQDQ)
+
+#define BDLDE_CRC32C_VPCLMUL_TARGET                                           \
+                    __attribute__((target("sse4.2,pclmul,avx512f,vpclmulqdq")))
+    // Enable the 'VPCLMULQDQ' and AVX-512F instructions in the annotated
+    // function, which must be invoked only if the running CPU supports them.
+
+BDLDE_CRC32C_VPCLMUL_TARGET
+inline
+__m512i fold512(__m512i value, __m512i constants, __m512i next)
+    // Return the result of folding each of the four 128-bit lanes of the
+    // specified 'value' into the corresponding lane of the specified 'next'
+    // using the specified 'constants', as described for 'fold128'.
+{
+    return _mm512_ternarylogic_epi64(
+                            _mm512_clmulepi64_epi128(value, constants, 0x00),
+                            _mm512_clmulepi64_epi128(value, constants, 0x11),
+                            next,
+                            0x96);  // 'a ^ b ^ c'
+}
+
+BDLDE_CRC32C_VPCLMUL_TARGET
+unsigned int crc32cWideFolding(const unsigned char *data,
+                               bsl::size_t          length,
+                               unsigned int         crc)
+    // Calculate the CRC32-C value for the specified 'data' over the specified
+    // 'length' number of bytes, using the specified 'crc' value as the
+    // starting point for the calculation.  Buffers of at least
+    // 'Crc32c::k_FOLDING_THRESHOLD' bytes are processed by folding four
+    // 512-bit lanes over 256-byte blocks using carry-less multiplication
+    // ('VPCLMULQDQ'), and shorter buffers are delegated to 'crc32cSse64bit'.
+    // The behavior is undefined unless the running CPU supports the
+    // 'VPCLMULQDQ', AVX-512F, 'PCLMULQDQ' and SSE4.2 instructions, and the
+    // operating system saves the AVX-512 state.  Note that the 'data' is
+    // permitted to be null if the 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    if (length < Crc32c::k_FOLDING_THRESHOLD || length < 256) {
+        return crc32cSse64bit(data, length, crc);                     // RETURN
+    }
+
+    const __m512i k_FOLD_2048 = _mm512_set_epi64(0xb9e02b86LL, 0xdcb17aa4LL,
+                                                 0xb9e02b86LL, 0xdcb17aa4LL,
+                                                 0xb9e02b86LL, 0xdcb17aa4LL,
+                                                 0xb9e02b86LL, 0xdcb17aa4LL);
+    const __m512i k_FOLD_512  = _mm512_set_epi64(0x9e4addf8LL, 0x740eef02LL,
+                                                 0x9e4addf8LL, 0x740eef02LL,
+                                                 0x9e4addf8LL, 0x740eef02LL,
+                                                 0x9e4addf8LL, 0x740eef02LL);
+    const __m128i k_FOLD_384  = _mm_set_epi64x(0x1d82c63daLL, 0x1c291d04LL);
+    const __m128i k_FOLD_256  = _mm_set_epi64x(0xba4fc28eLL, 0x1384aa63aLL);
+    const __m128i k_FOLD_128  = _mm_set_epi64x(0x14cd00bd6LL, 0xf20c0dfeLL);
+
+    const __m512i *block = reinterpret_cast<const __m512i *>(data);
+
+    __m512i z0 = _mm512_xor_si512(
+                     _mm512_loadu_si512(block),
+                     _mm512_inserti32x4(
+                              _mm512_setzero_si512(),
+                              _mm_cvtsi32_si128(static_cast<int>(~crc)),
+                              0));
+    __m512i z1 = _mm512_loadu_si512(block + 1);
+    __m512i z2 = _mm512_loadu_si512(block + 2);
+    __m512i z3 = _mm512_loadu_si512(block + 3);
+
+    block  += 4;
+    length -= 256;
+
+    for (; length >= 256; length -= 256, block += 4) {
+        z0 = fold512(z0, k_FOLD_2048, _mm512_loadu_si512(block));
+        z1 = fold512(z1, k_FOLD_2048, _mm512_loadu_si512(block + 1));
+        z2 = fold512(z2, k_FOLD_2048, _mm512_loadu_si512(block + 2));
+        z3 = fold512(z3, k_FOLD_2048, _mm512_loadu_si512(block + 3));
+    }
+
+    z0 = fold512(z0, k_FOLD_512, z1);
+    z0 = fold512(z0, k_FOLD_512, z2);
+    z0 = fold512(z0, k_FOLD_512, z3);
+
+    // Fold the four 128-bit lanes of 'z0' into the last one.
+
+    __m128i lanes[4];
+    _mm512_storeu_si512(lanes, z0);
+
+    __m128i x = fold128(lanes[0], k_FOLD_384, lanes[3]);
+    x = fold128(lanes[1], k_FOLD_256, x);
+    x = fold128(lanes[2], k_FOLD_128, x);
+
+    return ~crc32cFoldTail(x,
+                           reinterpret_cast<const unsigned char *>(block),
+                           length);
+}
+
+bool isWideFoldingAvailable()
+    // Return 'true' if the running CPU supports the 'VPCLMULQDQ' and AVX-512F
+    // instructions and the operating system saves the AVX-512 state on
+    // context switches, and 'false' otherwise.
+{
+    return CpuFeatures::hasAvx512F() && CpuFeatures::hasVpclmulqdq();
+}
+
+#    endif // BDLDE_CRC32C_VPCLMULQDQ
+
 #  endif // BSLS_PLATFORM_CPU_64_BIT
 
 unsigned int crc32cHardwareSerial(const unsigned char *data,
@@ -1205,14 +1490,212 @@ unsigned int crc32cHardwareSerial(const unsigned char *data,
 
 #endif  // LIKE_X86_GCC
 
+#if defined(LIKE_ARM64_GCC)
+
+#  if defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_CRC32C_ARMV8_TARGET __attribute__((target("crc")))
+#define BDLDE_CRC32C_ARMV8_CRC32CB(crc, value)                                \
+                                             __builtin_arm_crc32cb(crc, value)
+#define BDLDE_CRC32C_ARMV8_CRC32CD(crc, value)                                \
+                                             __builtin_arm_crc32cd(crc, value)
+#  else
+#define BDLDE_CRC32C_ARMV8_TARGET __attribute__((target("+crc")))
+#define BDLDE_CRC32C_ARMV8_CRC32CB(crc, value)                                \
+                                          __builtin_aarch64_crc32cb(crc, value)
+#define BDLDE_CRC32C_ARMV8_CRC32CD(crc, value)                                \
+                                          __builtin_aarch64_crc32cx(crc, value)
+#  endif
+    // 'BDLDE_CRC32C_ARMV8_TARGET' enables the ARMv8 CRC32 instructions in the
+    // annotated function, which must be invoked only if the running CPU
+    // supports them.  'BDLDE_CRC32C_ARMV8_CRC32CB' and
+    // 'BDLDE_CRC32C_ARMV8_CRC32CD' update the specified 'crc' with the
+    // specified 1-byte and 8-byte 'value', respectively.
+
+bool isArmv8CrcAvailable()
+    // Return 'true' if the running CPU supports the ARMv8 CRC32 instructions,
+    // and 'false' otherwise.
+{
+#  if defined(__ARM_FEATURE_CRC32)
+    // The target architecture mandates the CRC32 instructions.
+
+    return true;
+#  elif defined(BSLS_PLATFORM_OS_LINUX)
+    const unsigned long k_HWCAP_CRC32 = 1UL << 7;
+        // 'HWCAP_CRC32' as defined by the Linux kernel for arm64
+
+    return 0 != (getauxval(AT_HWCAP) & k_HWCAP_CRC32);
+#  else
+    return false;
+#  endif
+}
+
+BDLDE_CRC32C_ARMV8_TARGET
+unsigned int armv8CrcUpdate(const unsigned char *data,
+                            bsl::size_t          length,
+                            unsigned int         crc)
+    // Calculate the (non-inverted) CRC32-C register value using the ARMv8
+    // CRC32 instructions for the specified 'data' over the specified 'length'
+    // number of bytes, using the specified (non-inverted) 'crc' register
+    // value as the starting point for the calculation.  Note that the 'data'
+    // is permitted to be null if the 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    // Process bytes one at a time until we reach an 8-byte boundary (or until
+    // we reach the end of the buffer, whichever is sooner).
+
+    while (length &&
+           0 != (reinterpret_cast<bsls::Types::UintPtr>(data) & 7)) {
+        crc = BDLDE_CRC32C_ARMV8_CRC32CB(crc, *data++);
+        --length;
+    }
+
+    // Process 8 bytes at a time doing aligned 64-bit reads.
+
+    const bsls::Types::Uint64 *i =
+                           reinterpret_cast<const bsls::Types::Uint64 *>(data);
+    const bsls::Types::Uint64 *e = i + (length / 8);
+
+    for (; i < e; ++i) {
+        crc = BDLDE_CRC32C_ARMV8_CRC32CD(crc, *i);
+    }
+
+    // Process the last 7 (or less) bytes.
+
+    data    = reinterpret_cast<const unsigned char *>(e);
+    length %= 8;
+    while (length--) {
+        crc = BDLDE_CRC32C_ARMV8_CRC32CB(crc, *data++);
+    }
+
+    return crc;
+}
+
+BDLDE_CRC32C_ARMV8_TARGET
+unsigned int crc32c1024Armv8Int(const unsigned char *data,
+                                unsigned int         crc)
+    // Calculate the (non-inverted) CRC32-C register value using the ARMv8
+    // CRC32 instructions for the specified 'data' over exactly 1024 bytes,
+    // using the specified (non-inverted) 'crc' register value as the starting
+    // point for the calculation.  Behavior is undefined unless the buffer
+    // pointed to by 'data' contains at least 1024 bytes.  Note that this is
+    // the same three-stream algorithm as 'crc32c1024SseInt', as the ARMv8
+    // 'crc32cx' instruction has the same semantics as the SSE4.2 'crc32'
+    // instruction.
+{
+    BSLS_ASSERT(data);
+
+#define C(i)                                         \
+    c1 = BDLDE_CRC32C_ARMV8_CRC32CD(c1, b1[i]);      \
+    c2 = BDLDE_CRC32C_ARMV8_CRC32CD(c2, b2[i]);      \
+    c3 = BDLDE_CRC32C_ARMV8_CRC32CD(c3, b3[i]);      \
+
+    unsigned int        c1, c2, c3;
+    bsls::Types::Uint64 tmp;
+
+    const bsls::Types::Uint64 *b8 =
+                           reinterpret_cast<const bsls::Types::Uint64 *>(data);
+    const bsls::Types::Uint64 *b1 = &b8[1];
+    const bsls::Types::Uint64 *b2 = &b8[43];
+    const bsls::Types::Uint64 *b3 = &b8[85];
+
+    c2 = c3 = 0;
+    c1 = BDLDE_CRC32C_ARMV8_CRC32CD(crc, b8[0]);
+
+    C(0);  C(1);  C(2);  C(3);  C(4);  C(5);  C(6);  C(7);  C(8);  C(9);
+    C(10); C(11); C(12); C(13); C(14); C(15); C(16); C(17); C(18); C(19);
+    C(20); C(21); C(22); C(23); C(24); C(25); C(26); C(27); C(28); C(29);
+    C(30); C(31); C(32); C(33); C(34); C(35); C(36); C(37); C(38); C(39);
+    C(40); C(41);
+
+    // merge in c2
+    tmp  = b8[127];
+    tmp ^= k_MUL_TABLE1_336[c2 & 0xFF];
+    tmp ^= static_cast<bsls::Types::Uint64>(
+                                    k_MUL_TABLE1_336[(c2 >> 8) & 0xFF])  << 8;
+    tmp ^= static_cast<bsls::Types::Uint64>(
+                                    k_MUL_TABLE1_336[(c2 >> 16) & 0xFF]) << 16;
+    tmp ^= static_cast<bsls::Types::Uint64>(
+                                    k_MUL_TABLE1_336[(c2 >> 24) & 0xFF]) << 24;
+
+    // merge in c1
+    tmp ^= k_MUL_TABLE1_672[c1 & 0xFF];
+    tmp ^= static_cast<bsls::Types::Uint64>(
+                                    k_MUL_TABLE1_672[(c1 >> 8) & 0xFF])  << 8;
+    tmp ^= static_cast<bsls::Types::Uint64>(
+                                    k_MUL_TABLE1_672[(c1 >> 16) & 0xFF]) << 16;
+    tmp ^= static_cast<bsls::Types::Uint64>(
+                                    k_MUL_TABLE1_672[(c1 >> 24) & 0xFF]) << 24;
+
+    return BDLDE_CRC32C_ARMV8_CRC32CD(c3, tmp);
+#undef C
+}
+
+unsigned int crc32cArmv8Serial(const unsigned char *data,
+                               bsl::size_t          length,
+                               unsigned int         crc)
+    // Calculate the CRC32-C value using the ARMv8 CRC32 instructions for the
+    // specified 'data' over the specified 'length' number of bytes, using the
+    // specified 'crc' value as the starting point for the calculation.  The
+    // behavior is undefined unless the running CPU supports the ARMv8 CRC32
+    // instructions.  Note that the 'data' is permitted to be null if the
+    // 'length' is 0.
+{
+    return ~armv8CrcUpdate(data, length, ~crc);
+}
+
+unsigned int crc32cArmv8(const unsigned char *data,
+                         bsl::size_t          length,
+                         unsigned int         crc)
+    // Calculate the CRC32-C value using the ARMv8 CRC32 instructions for the
+    // specified 'data' over the specified 'length' number of bytes, using the
+    // specified 'crc' value as the starting point for the calculation.
+    // Processing is 8 or 1024 bytes at a time, depending on 'length', and
+    // lookup tables are used for recombination.  The behavior is undefined
+    // unless the running CPU supports the ARMv8 CRC32 instructions.  Note
+    // that the 'data' is permitted to be null if the 'length' is 0.
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    crc = ~crc;
+
+    // Process ('length' mod 1024) bytes
+    const bsl::size_t head = length % 1024;
+    crc     = armv8CrcUpdate(data, head, crc);
+    data   += head;
+    length -= head;
+
+    // Process remaining 'k' chunks of 1024 bytes each
+    for (; length; length -= 1024, data += 1024) {
+        crc = crc32c1024Armv8Int(data, crc);
+    }
+
+    return ~crc;
+}
+
+#endif  // LIKE_ARM64_GCC
+
                         //-----------------------
                         // class Crc32cCalculator
                         //-----------------------
 
-Crc32cCalculator::Crc32cFn Crc32cCalculator::s_crc32cFn = 0;
+Crc32cCalculator::Crc32cFn Crc32cCalculator::s_crc32cFn      = 0;
+Crc32cCalculator::Crc32cFn Crc32cCalculator::s_serialFn      = 0;
+Crc32cCalculator::Crc32cFn Crc32cCalculator::s_interleavedFn = 0;
+Crc32cCalculator::Crc32cFn Crc32cCalculator::s_foldingFn     = 0;
+Crc32cCalculator::Crc32cFn Crc32cCalculator::s_wideFoldingFn = 0;
 
 Crc32cCalculator::Crc32cCalculator()
 {
+    // Each alternative algorithm falls back to the next simpler one that is
+    // supported, and ultimately to the software implementation.
+
+    s_crc32cFn      = crc32cSoftware;
+    s_serialFn      = crc32cSoftware;
+    s_interleavedFn = crc32cSoftware;
+    s_foldingFn     = crc32cSoftware;
+    s_wideFoldingFn = crc32cSoftware;
+
 #if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
 
 #if defined(BSLS_PLATFORM_CMP_CLANG)
@@ -1226,32 +1709,70 @@ Crc32cCalculator::Crc32cCalculator()
     __cpuid(1, eax, ebx, ecx, edx);
 
     if (ecx & BDLDE_SSE4_2) { // SSE 4.2 Support for CRC32-C
+        s_serialFn = crc32cHardwareSerial;
 
 #ifdef BSLS_PLATFORM_CPU_64_BIT
-        BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
-                      "(SSE4.2 instructions available, 64-bit mode)");
-        s_crc32cFn = crc32cSse64bit;
+        s_interleavedFn = crc32cSse64bit;
+
+        if (!CpuFeatures::hasPclmulqdq()) {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 instructions available, 64-bit mode)");
+            s_foldingFn     = crc32cSse64bit;
+            s_wideFoldingFn = crc32cSse64bit;
+        }
+#ifdef BDLDE_CRC32C_VPCLMULQDQ
+        else if (isWideFoldingAvailable()) {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2, PCLMULQDQ and VPCLMULQDQ instructions "
+                          "available, 64-bit mode)");
+            s_foldingFn     = crc32cFolding;
+            s_wideFoldingFn = crc32cWideFolding;
+        }
+#endif  // BDLDE_CRC32C_VPCLMULQDQ
+        else {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 and PCLMULQDQ instructions available, "
+                          "64-bit mode)");
+            s_foldingFn     = crc32cFolding;
+            s_wideFoldingFn = crc32cFolding;
+        }
+        s_crc32cFn = s_wideFoldingFn;
 
 #else
         BSLS_LOG_INFO("Using hardware version (serial) for CRC32-C "
                       "computation (SSE4.2 instructions available, "
                       "32-bit mode)");
-        s_crc32cFn = crc32cHardwareSerial;
+        s_crc32cFn      = crc32cHardwareSerial;
+        s_interleavedFn = crc32cHardwareSerial;
+        s_foldingFn     = crc32cHardwareSerial;
+        s_wideFoldingFn = crc32cHardwareSerial;
 #endif  // BSLS_PLATFORM_CPU_64_BIT
 #undef BDLDE_SSE4_2
     }
     else {
         BSLS_LOG_INFO("Using software version for CRC32-C computation "
                       "(SSE4.2 instructions not available)");
-        s_crc32cFn = crc32cSoftware;
     }
 #else  // BDLDE_SSE4_2.  Unsupported compiler.  Note that Windows hardware
        // implementation will be chosen here when supported.
     BSLS_LOG_INFO("Using software version for CRC32-C computation "
                   "(unsupported compiler)");
-    s_crc32cFn = crc32cSoftware;
 #endif
 
+#elif defined(LIKE_ARM64_GCC)
+    if (isArmv8CrcAvailable()) {
+        BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                      "(ARMv8 CRC32 instructions available, 64-bit mode)");
+        s_crc32cFn      = crc32cArmv8;
+        s_serialFn      = crc32cArmv8Serial;
+        s_interleavedFn = crc32cArmv8;
+        s_foldingFn     = crc32cArmv8;
+        s_wideFoldingFn = crc32cArmv8;
+    }
+    else {
+        BSLS_LOG_INFO("Using software version for CRC32-C computation "
+                      "(ARMv8 CRC32 instructions not available)");
+    }
 #elif defined(BSLS_PLATFORM_CPU_SPARC) && \
       defined(BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION)
     if (is_sparc_crc32c_avail()) {
@@ -1261,14 +1782,12 @@ Crc32cCalculator::Crc32cCalculator()
     } else {
         BSLS_LOG_INFO("Using software version for CRC32-C computation "
                       "(sparc hardware not available)");
-        s_crc32cFn = crc32cSoftware;
     }
 #else  // BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
        // Not supported architecture.  Note that IBM AIX hardware
        // implementation will be chosen here when supported.
     BSLS_LOG_INFO("Using software version for CRC32-C computation "
-                  "(neither an x86 nor SPARC architecture)");
-    s_crc32cFn = crc32cSoftware;
+                  "(neither an x86, ARMv8 nor SPARC architecture)");
 #endif // BSLS_PLATFORM_CPU_X86 || BSLS_PLATFORM_CPU_X86_64
 }
 
@@ -1291,6 +1810,42 @@ unsigned int Crc32cCalculator::operator()(const unsigned char *data,
     return s_crc32cFn(data, length, crc);
 }
 
+inline
+unsigned int Crc32cCalculator::folding(const unsigned char *data,
+                                       bsl::size_t          length,
+                                       unsigned int         crc) const
+{
+    BSLS_ASSERT(data || 0 == length);
+    return s_foldingFn(data, length, crc);
+}
+
+inline
+unsigned int Crc32cCalculator::interleaved(const unsigned char *data,
+                                           bsl::size_t          length,
+                                           unsigned int         crc) const
+{
+    BSLS_ASSERT(data || 0 == length);
+    return s_interleavedFn(data, length, crc);
+}
+
+inline
+unsigned int Crc32cCalculator::serial(const unsigned char *data,
+                                      bsl::size_t          length,
+                                      unsigned int         crc) const
+{
+    BSLS_ASSERT(data || 0 == length);
+    return s_serialFn(data, length, crc);
+}
+
+inline
+unsigned int Crc32cCalculator::wideFolding(const unsigned char *data,
+                                           bsl::size_t          length,
+                                           unsigned int         crc) const
+{
+    BSLS_ASSERT(data || 0 == length);
+    return s_wideFoldingFn(data, length, crc);
+}
+
 }  // close unnamed namespace
 
 
@@ -1350,12 +1905,67 @@ unsigned int Crc32c_Impl::calculateHardwareSerial(const void   *data,
         return crc;                                                   // RETURN
     }
 
-    const unsigned char *dataUchar = static_cast<const unsigned char *>(data);
-#if defined(LIKE_X86_GCC)
-    return crc32cHardwareSerial(dataUchar, length, crc);
-#else
-    return crc32cSoftware(dataUchar, length, crc);
-#endif // BSLS_PLATFORM_CMP_GNU || BSLS_PLATFORM_CMP_CLANG
+    Crc32cCalculator& calculator = Crc32cCalculator::instance();
+    return calculator.serial(static_cast<const unsigned char *>(data),
+                             length,
+                             crc);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareInterleaved(const void   *data,
+                                                       bsl::size_t   length,
+                                                       unsigned int  crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(   (data || !length)
+                     && "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;                                                   // RETURN
+    }
+
+    Crc32cCalculator& calculator = Crc32cCalculator::instance();
+    return calculator.interleaved(static_cast<const unsigned char *>(data),
+                                   length,
+                                   crc);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareFolding(const void   *data,
+                                                   bsl::size_t   length,
+                                                   unsigned int  crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(   (data || !length)
+                     && "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;                                                   // RETURN
+    }
+
+    Crc32cCalculator& calculator = Crc32cCalculator::instance();
+    return calculator.folding(static_cast<const unsigned char *>(data),
+                               length,
+                               crc);
+}
+
+unsigned int Crc32c_Impl::calculateHardwareWideFolding(const void   *data,
+                                                       bsl::size_t   length,
+                                                       unsigned int  crc)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(   (data || !length)
+                     && "If 'data' is 0, then 'length' also must be 0");
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(length == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;                                                   // RETURN
+    }
+
+    Crc32cCalculator& calculator = Crc32cCalculator::instance();
+    return calculator.wideFolding(static_cast<const unsigned char *>(data),
+                                   length,
+                                   crc);
 }
 
 }  // close package namespace
@@ -35,10 +35,22 @@ BSLS_IDENT("$Id$")
 // on a supported architecture with a compatible compiler.  In addition,
 // runtime checks are performed to detect whether the running platform has the
 // required hardware support:
-//: o x86:   SSE4.2 instructions are required
+//: o x86:   SSE4.2 instructions are required.  On 64-bit builds, buffers of
+//:   at least 'k_FOLDING_THRESHOLD' bytes are additionally processed by
+//:   folding 64-byte blocks using carry-less multiplication if the
+//:   'PCLMULQDQ' instruction is available, and by folding 256-byte blocks
+//:   in 512-bit registers if the 'VPCLMULQDQ' and AVX-512F instructions are
+//:   available and enabled by the operating system
+//: o aarch64: ARMv8 CRC32 instructions are required; the runtime check is
+//:   performed using 'getauxval(AT_HWCAP)' on Linux, and is elided when the
+//:   target architecture is known to provide the instructions (e.g., Apple
+//:   silicon)
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
+// The implementation selected at runtime is reported once, at the
+// 'bsls::LogSeverity::e_INFO' level, using 'bsls::Log'.
+//
 ///Performance
 ///-----------
 // See the test driver for this component in the '.t.cpp' to compare
@@ -98,6 +110,11 @@ struct Crc32c {
         // CRC32-C value for a 0 length input.  Note that a buffer with this
         // CRC32-C value need not be a 0 length input.
 
+    static const bsl::size_t k_FOLDING_THRESHOLD = 256;
+        // Minimum length of a buffer for which an implementation based on
+        // carry-less multiplication is used, if available.  Shorter buffers
+        // are processed using the CRC32 instructions alone.
+
     // CLASS METHODS
     static unsigned int calculate(const void   *data,
                                   bsl::size_t   length,
@@ -143,6 +160,54 @@ struct Crc32c_Impl {
         // fall back to the software version when running on unsupported
         // platforms.  Also note that if 'data' is 0, then 'length' must also
         // be 0.
+
+    static
+    unsigned int calculateHardwareInterleaved(
+                                    const void   *data,
+                                    bsl::size_t   length,
+                                    unsigned int  crc = Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the specified 'data' over
+        // the specified 'length' number of bytes, using the optionally
+        // specified 'crc' value as the starting point for the calculation.
+        // This utilizes a hardware-based implementation that calculates the
+        // CRC32-C of three interleaved streams of each 1024-byte block (using
+        // the SSE4.2 or ARMv8 CRC32 instructions) and recombines them using
+        // lookup tables.  Note that this function will fall back to the
+        // implementation used by 'calculateHardwareSerial' when running on
+        // unsupported platforms.  Also note that if 'data' is 0, then
+        // 'length' must also be 0.
+
+    static
+    unsigned int calculateHardwareFolding(
+                                    const void   *data,
+                                    bsl::size_t   length,
+                                    unsigned int  crc = Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the specified 'data' over
+        // the specified 'length' number of bytes, using the optionally
+        // specified 'crc' value as the starting point for the calculation.
+        // This utilizes a hardware-based implementation that, for buffers of
+        // at least 'Crc32c::k_FOLDING_THRESHOLD' bytes, folds four 128-bit
+        // lanes over 64-byte blocks using the 'PCLMULQDQ' carry-less
+        // multiplication instruction.  Note that this function will fall back
+        // to 'calculateHardwareInterleaved' when running on unsupported
+        // platforms and for shorter buffers.  Also note that if 'data' is 0,
+        // then 'length' must also be 0.
+
+    static
+    unsigned int calculateHardwareWideFolding(
+                                    const void   *data,
+                                    bsl::size_t   length,
+                                    unsigned int  crc = Crc32c::k_NULL_CRC32C);
+        // Return the CRC32-C value calculated for the specified 'data' over
+        // the specified 'length' number of bytes, using the optionally
+        // specified 'crc' value as the starting point for the calculation.
+        // This utilizes a hardware-based implementation that, for buffers of
+        // at least 'Crc32c::k_FOLDING_THRESHOLD' bytes, folds four 512-bit
+        // lanes over 256-byte blocks using the 'VPCLMULQDQ' carry-less
+        // multiplication instruction.  Note that this function will fall back
+        // to 'calculateHardwareFolding' when running on unsupported platforms,
+        // and to 'calculateHardwareInterleaved' for shorter buffers.  Also
+        // note that if 'data' is 0, then 'length' must also be 0.
 };
 
 }  // close package namespace
@@ -208,6 +208,32 @@ using namespace bsl;
 //  |    64 Mi|           7147904|         11091230|                   1.552
 //..
 //
+// Throughput by implementation and size
+// - - - - - - - - - - - - - - - - - - -
+// Below is the throughput (in GB per second) reported by test case -6 on a
+// virtualized Intel Xeon machine supporting the SSE4.2, 'PCLMULQDQ' and
+// 'VPCLMULQDQ' instructions (hence 'Default' is 'WideFolding').  Note that,
+// below 1024 bytes, 'Interleaved' processes the buffer in "serial", and that
+// both folding implementations delegate buffers shorter than
+// 'Crc32c::k_FOLDING_THRESHOLD' bytes to 'Interleaved'.  Also note that the
+// measurements are noisy on such a machine ('Default' and 'WideFolding' run
+// the same code).
+//..
+//  ==========================================================================
+//  |  Size(B) |Software| Serial |Interleaved| Folding |WideFolding| Default
+//  ==========================================================================
+//  |       64 |  1.360 |  3.016 |     1.540 |   2.220 |     2.105 |   1.947
+//  |      256 |  1.312 |  4.527 |     4.683 |   6.750 |     8.629 |   5.146
+//  |     1 Ki |  1.424 |  4.772 |    16.838 |  12.121 |    25.268 |  22.385
+//  |     4 Ki |  1.356 |  4.953 |    18.028 |  18.084 |    56.501 |  48.871
+//  |    16 Ki |  1.441 |  4.807 |    18.345 |  18.277 |    77.447 |  45.982
+//  |    64 Ki |  1.474 |  5.033 |    18.507 |  19.649 |    61.221 |  61.434
+//  |   256 Ki |  1.490 |  4.977 |    17.338 |  18.074 |    61.397 |  64.390
+//  |     1 Mi |  1.477 |  5.266 |    17.825 |  17.514 |    50.776 |  43.590
+//  |     4 Mi |  1.474 |  5.279 |    17.454 |  15.642 |    23.191 |  24.196
+//  |    16 Mi |  1.411 |  5.198 |    17.437 |  16.348 |    21.856 |  23.069
+//..
+//
 ///Performance (sparc)
 ///-------------------
 // Below are software vs hardware performance comparison for different sparc
@@ -229,14 +255,19 @@ using namespace bsl;
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
+// [7] int Crc32c_Impl::calculateHardwareInterleaved(const void *, size_t, u);
+// [7] int Crc32c_Impl::calculateHardwareFolding(const void *, size_t, uint);
+// [7] int Crc32c_Impl::calculateHardwareWideFolding(const void *, size_t, u);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
 // [-4] DEFAULT & FOLLY PERFORMANCE TEST
 // [-5] PERFORMANCE TEST ON USER INPUT
+// [-6] THROUGHPUT BY IMPLEMENTATION AND SIZE BENCHMARK
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -306,6 +337,30 @@ static bslma::TestAllocator *pa;
 //-----------------------------------------------------------------------------
 namespace {
 
+typedef unsigned int (*Crc32cFunction)(const void   *data,
+                                       bsl::size_t   length,
+                                       unsigned int  crc);
+    // 'Crc32cFunction' is an alias for the signature shared by all the
+    // implementations of CRC32-C under test.
+
+struct Implementation {
+    // Struct associating an implementation of CRC32-C with its name.
+    const char     *d_name;
+    Crc32cFunction  d_function;
+};
+
+const Implementation k_IMPLEMENTATIONS[] = {
+    { "Software",     &Crc32c_Impl::calculateSoftware            },
+    { "Serial",       &Crc32c_Impl::calculateHardwareSerial      },
+    { "Interleaved",  &Crc32c_Impl::calculateHardwareInterleaved },
+    { "Folding",      &Crc32c_Impl::calculateHardwareFolding     },
+    { "WideFolding",  &Crc32c_Impl::calculateHardwareWideFolding },
+    { "Default",      &Crc32c::calculate                         }
+};
+
+const bsl::size_t k_NUM_IMPLEMENTATIONS = sizeof(k_IMPLEMENTATIONS)
+                                        / sizeof(*k_IMPLEMENTATIONS);
+
 struct TableRecord {
     // Struct representing a record in a table of performance statistics.
     bsls::Types::Int64 d_size;
@@ -1311,6 +1366,137 @@ void test6_multithreadedCrc32cSoftware()
     }
 }
 
+void test7_alternativeImplementations()
+    // ------------------------------------------------------------------------
+    // CALCULATE CRC32-C USING ALTERNATIVE IMPLEMENTATIONS
+    //
+    // Concerns:
+    //: 1 Every implementation calculates the same CRC32-C as the software
+    //:   implementation, in particular for lengths around the sizes of the
+    //:   blocks processed by the interleaved (1024 bytes) and folding (16, 64
+    //:   and 256 bytes) implementations, and around
+    //:   'Crc32c::k_FOLDING_THRESHOLD'.
+    //:
+    //: 2 The result does not depend on the alignment of the buffer.
+    //:
+    //: 3 The specified 'crc' is taken into account as the starting point.
+    //:
+    //: 4 Calculating the CRC32-C of a buffer in two chunks (passing the
+    //:   CRC32-C of the first chunk as the starting point of the second) gives
+    //:   the same result as calculating it in one go.
+    //
+    // Plan:
+    //: 1 Fill a buffer with pseudo-random data.  For every length up to 2100
+    //:   bytes and for a selection of larger lengths, and for several offsets
+    //:   from an alignment boundary, calculate the CRC32-C of the data using
+    //:   each implementation with a pseudo-random starting 'crc', and compare
+    //:   it to the result of the software implementation.  (C-1..3)
+    //:
+    //: 2 For a selection of lengths and split points, calculate the CRC32-C
+    //:   of the data in two chunks using each implementation, and compare it
+    //:   to the result of the software implementation over the whole data.
+    //:   (C-4)
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
+    //   bdlde::Crc32c_Impl::calculateHardwareSerial(const void *,size_t,uint);
+    //   Crc32c_Impl::calculateHardwareInterleaved(const void *,size_t,uint);
+    //   Crc32c_Impl::calculateHardwareFolding(const void *, size_t, uint);
+    //   Crc32c_Impl::calculateHardwareWideFolding(const void *,size_t,uint);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+         << bsl::endl
+         << "CALCULATE CRC32-C USING ALTERNATIVE IMPLEMENTATIONS" << bsl::endl
+         << "===================================================" << bsl::endl;
+
+    const bsl::size_t k_MAX_LENGTH = 70000;
+    const bsl::size_t k_MAX_OFFSET = 64;
+
+    const bsl::size_t LARGE_LENGTHS[] = {
+        4095, 4096, 4097, 4099, 5000, 8191, 8192, 8200, 16383, 16384, 16400,
+        65535, 65536, 65537, 65599, k_MAX_LENGTH
+    };
+    const bsl::size_t NUM_LARGE_LENGTHS = sizeof(LARGE_LENGTHS)
+                                        / sizeof(*LARGE_LENGTHS);
+
+    const bsl::size_t OFFSETS[] = { 0, 1, 3, 7, 8, 13, 32, 63 };
+    const bsl::size_t NUM_OFFSETS = sizeof(OFFSETS) / sizeof(*OFFSETS);
+
+    char *buffer = static_cast<char *>(pa->allocate(k_MAX_LENGTH
+                                                    + k_MAX_OFFSET));
+    bsl::srand(0xC0FFEE);
+    bsl::generate_n(buffer, k_MAX_LENGTH + k_MAX_OFFSET, bsl::rand);
+
+    bsl::vector<bsl::size_t> lengths(pa);
+    for (bsl::size_t length = 0; length <= 2100; ++length) {
+        lengths.push_back(length);
+    }
+    lengths.insert(lengths.end(),
+                   LARGE_LENGTHS,
+                   LARGE_LENGTHS + NUM_LARGE_LENGTHS);
+
+    if (verbose) cout << "\nComparing each implementation to software."
+                      << endl;
+    for (bsl::size_t li = 0; li < lengths.size(); ++li) {
+        const bsl::size_t LENGTH = lengths[li];
+
+        for (bsl::size_t oi = 0; oi < NUM_OFFSETS; ++oi) {
+            const char         *DATA = buffer + OFFSETS[oi];
+            const unsigned int  CRC  = static_cast<unsigned int>(
+                                                 LENGTH * 2654435761U + oi);
+            const unsigned int  EXPECTED =
+                           Crc32c_Impl::calculateSoftware(DATA, LENGTH, CRC);
+
+            for (bsl::size_t ii = 0; ii < k_NUM_IMPLEMENTATIONS; ++ii) {
+                const Implementation& IMPL = k_IMPLEMENTATIONS[ii];
+
+                const unsigned int result = IMPL.d_function(DATA,
+                                                            LENGTH,
+                                                            CRC);
+                ASSERTV(IMPL.d_name, LENGTH, OFFSETS[oi], result, EXPECTED,
+                        result == EXPECTED);
+            }
+        }
+    }
+
+    if (verbose) cout << "\nCalculating in two chunks." << endl;
+
+    const bsl::size_t SPLIT_LENGTHS[] = { 1024, 3000, 4096, 65536 };
+    const bsl::size_t NUM_SPLIT_LENGTHS = sizeof(SPLIT_LENGTHS)
+                                        / sizeof(*SPLIT_LENGTHS);
+
+    const bsl::size_t SPLITS[] = {
+        0, 1, 7, 15, 16, 17, 63, 64, 65, 255, 256, 257, 1000, 1023, 1024, 1025
+    };
+    const bsl::size_t NUM_SPLITS = sizeof(SPLITS) / sizeof(*SPLITS);
+
+    for (bsl::size_t li = 0; li < NUM_SPLIT_LENGTHS; ++li) {
+        const bsl::size_t  LENGTH   = SPLIT_LENGTHS[li];
+        const unsigned int EXPECTED = Crc32c_Impl::calculateSoftware(buffer,
+                                                                     LENGTH);
+
+        for (bsl::size_t si = 0;
+             si < NUM_SPLITS && SPLITS[si] <= LENGTH;
+             ++si) {
+            const bsl::size_t SPLIT = SPLITS[si];
+
+            for (bsl::size_t ii = 0; ii < k_NUM_IMPLEMENTATIONS; ++ii) {
+                const Implementation& IMPL = k_IMPLEMENTATIONS[ii];
+
+                unsigned int result = IMPL.d_function(buffer, SPLIT, 0);
+                result = IMPL.d_function(buffer + SPLIT,
+                                         LENGTH - SPLIT,
+                                         result);
+                ASSERTV(IMPL.d_name, LENGTH, SPLIT, result, EXPECTED,
+                        result == EXPECTED);
+            }
+        }
+    }
+
+    pa->deallocate(buffer);
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1831,6 +2017,87 @@ void testN5_performanceDefaultUserInput()
          << "\n\n";
 }
 
+void testN6_throughputByImplementation()
+    // ------------------------------------------------------------------------
+    // BENCHMARK: CALCULATE CRC32-C THROUGHPUT BY IMPLEMENTATION AND SIZE
+    //
+    // Concerns:
+    //: 1 Report the throughput (GB/s) of each implementation for buffer sizes
+    //:   ranging from 64 bytes to 16 MiB, in a single thread environment, to
+    //:   validate the choice of the default implementation and of
+    //:   'Crc32c::k_FOLDING_THRESHOLD' on the running platform.
+    //
+    // Plan:
+    //: 1 For each buffer size (in powers of 4 from 64 bytes to 16 MiB) and
+    //:   each implementation, time repeated CRC32-C calculations over about
+    //:   256 MiB of pseudo-random data in total, and report the throughput.
+    //:   Note that implementations not supported by the running platform fall
+    //:   back to simpler ones (see the component documentation).
+    //
+    // Testing:
+    //   BENCHMARK: CALCULATE CRC32-C THROUGHPUT BY IMPLEMENTATION AND SIZE
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout
+        << bsl::endl
+        << "BENCHMARK: CALCULATE CRC32-C THROUGHPUT BY IMPLEMENTATION AND SIZE"
+        << bsl::endl
+        << "=================================================================="
+        << bsl::endl;
+
+    const bsl::size_t k_MIN_SIZE           = 64;
+    const bsl::size_t k_MAX_SIZE           = 16 * 1024 * 1024;
+    const double      k_BYTES_PER_MEASURE  = 256.0 * 1024 * 1024;
+
+    char *buffer = static_cast<char *>(pa->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    printf("%10s", "Size(B)");
+    for (bsl::size_t ii = 0; ii < k_NUM_IMPLEMENTATIONS; ++ii) {
+        printf(" | %12s", k_IMPLEMENTATIONS[ii].d_name);
+    }
+    printf("   (GB/s)\n");
+
+    unsigned int checksum = 0;
+    for (bsl::size_t size = k_MIN_SIZE; size <= k_MAX_SIZE; size *= 4) {
+        const bsl::size_t numIterations = static_cast<bsl::size_t>(
+                   bsl::max(1.0, k_BYTES_PER_MEASURE / static_cast<double>(
+                                                                      size)));
+
+        printf("%10llu", static_cast<unsigned long long>(size));
+        for (bsl::size_t ii = 0; ii < k_NUM_IMPLEMENTATIONS; ++ii) {
+            const Implementation& IMPL = k_IMPLEMENTATIONS[ii];
+
+            unsigned int crc = IMPL.d_function(buffer, size, 0);
+
+            // <time>
+            bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+            for (bsl::size_t i = 0; i < numIterations; ++i) {
+                crc = IMPL.d_function(buffer, size, crc);
+            }
+            bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer()
+                                       - startTime;
+            // </time>
+
+            checksum ^= crc;
+
+            const double bytes = static_cast<double>(size)
+                               * static_cast<double>(numIterations);
+            printf(" | %12.3f",
+                   bytes / static_cast<double>(bsl::max<bsls::Types::Int64>(
+                                                                   elapsed,
+                                                                   1)));
+        }
+        printf("\n");
+    }
+
+    if (veryVerbose) {
+        P(checksum);
+    }
+
+    pa->deallocate(buffer);
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1864,7 +2131,7 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1907,6 +2174,9 @@ int main(int argc, char* argv[])
                                             checksum);
 //..
       } break;
+      case  7: {
+        test7_alternativeImplementations();
+      } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
       } break;
@@ -1940,6 +2210,9 @@ int main(int argc, char* argv[])
       case -5: {
         testN5_performanceDefaultUserInput();
       } break;
+      case -6: {
+        testN6_throughputByImplementation();
+      } break;
       default: {
         cerr << "WARNING: CASE '" << test << "' NOT FOUND." << endl;
         testStatus = -1;
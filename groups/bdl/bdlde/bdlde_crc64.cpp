@@ -6,11 +6,33 @@
 // This implements the CRC-64 defined in ECMA 182 (with reversed polynomial
 // 0xC96C5795D7870F42), in the usual manner:
 //   http://en.wikipedia.org/wiki/Cyclic_redundancy_check
+//
+// Eight bytes are processed per iteration using the "slicing-by-8" technique
+// (see Kounavis, M.E. and Berry, F.L., "A Systematic Approach to Building High
+// Performance Software-Based CRC Generators", ISCC 2005), where
+// 'CRC_SLICE_TABLES[k - 1][b]' is the CRC register resulting from processing
+// the byte 'b' followed by 'k' zero bytes, starting with a zero register.
+//
+// On x86-64 platforms, buffers of at least 'k_FOLDING_THRESHOLD' bytes are
+// processed, if the CPU supports the 'PCLMULQDQ' instruction, by folding four
+// 128-bit lanes over 64-byte blocks using carry-less multiplication, as
+// described in the Intel White Paper "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction".  The folded 128 bits are then
+// reduced by running them through the slicing-by-8 loop with a zero register.
+
+#include <bdlde_cpufeatures.h>
 
 #include <bsl_ostream.h>
-#include <bsls_annotation.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_CRC64_PCLMUL
+#include <immintrin.h>
+#endif
+#endif
+
 namespace BloombergLP {
 
 // STATIC DATA
@@ -274,6 +296,752 @@ static const bsls::Types::Uint64 CRC_TABLE[256] = {
     0xe0ada17364673f59ULL
 };
 
+static const bsls::Types::Uint64 CRC_SLICE_TABLES[7][256] = {
+    {
+        0x0000000000000000ULL, 0x54e979925cd0f10dULL, 0xa9d2f324b9a1e21aULL,
+        0xfd3b8ab6e5711317ULL, 0xc17d4962dc4ddab1ULL, 0x959430f0809d2bbcULL,
+        0x68afba4665ec38abULL, 0x3c46c3d4393cc9a6ULL, 0x10223dee1795abe7ULL,
+        0x44cb447c4b455aeaULL, 0xb9f0cecaae3449fdULL, 0xed19b758f2e4b8f0ULL,
+        0xd15f748ccbd87156ULL, 0x85b60d1e9708805bULL, 0x788d87a87279934cULL,
+        0x2c64fe3a2ea96241ULL, 0x20447bdc2f2b57ceULL, 0x74ad024e73fba6c3ULL,
+        0x899688f8968ab5d4ULL, 0xdd7ff16aca5a44d9ULL, 0xe13932bef3668d7fULL,
+        0xb5d04b2cafb67c72ULL, 0x48ebc19a4ac76f65ULL, 0x1c02b80816179e68ULL,
+        0x3066463238befc29ULL, 0x648f3fa0646e0d24ULL, 0x99b4b516811f1e33ULL,
+        0xcd5dcc84ddcfef3eULL, 0xf11b0f50e4f32698ULL, 0xa5f276c2b823d795ULL,
+        0x58c9fc745d52c482ULL, 0x0c2085e60182358fULL, 0x4088f7b85e56af9cULL,
+        0x14618e2a02865e91ULL, 0xe95a049ce7f74d86ULL, 0xbdb37d0ebb27bc8bULL,
+        0x81f5beda821b752dULL, 0xd51cc748decb8420ULL, 0x28274dfe3bba9737ULL,
+        0x7cce346c676a663aULL, 0x50aaca5649c3047bULL, 0x0443b3c41513f576ULL,
+        0xf9783972f062e661ULL, 0xad9140e0acb2176cULL, 0x91d78334958edecaULL,
+        0xc53efaa6c95e2fc7ULL, 0x380570102c2f3cd0ULL, 0x6cec098270ffcdddULL,
+        0x60cc8c64717df852ULL, 0x3425f5f62dad095fULL, 0xc91e7f40c8dc1a48ULL,
+        0x9df706d2940ceb45ULL, 0xa1b1c506ad3022e3ULL, 0xf558bc94f1e0d3eeULL,
+        0x086336221491c0f9ULL, 0x5c8a4fb0484131f4ULL, 0x70eeb18a66e853b5ULL,
+        0x2407c8183a38a2b8ULL, 0xd93c42aedf49b1afULL, 0x8dd53b3c839940a2ULL,
+        0xb193f8e8baa58904ULL, 0xe57a817ae6757809ULL, 0x18410bcc03046b1eULL,
+        0x4ca8725e5fd49a13ULL, 0x8111ef70bcad5f38ULL, 0xd5f896e2e07dae35ULL,
+        0x28c31c54050cbd22ULL, 0x7c2a65c659dc4c2fULL, 0x406ca61260e08589ULL,
+        0x1485df803c307484ULL, 0xe9be5536d9416793ULL, 0xbd572ca48591969eULL,
+        0x9133d29eab38f4dfULL, 0xc5daab0cf7e805d2ULL, 0x38e121ba129916c5ULL,
+        0x6c0858284e49e7c8ULL, 0x504e9bfc77752e6eULL, 0x04a7e26e2ba5df63ULL,
+        0xf99c68d8ced4cc74ULL, 0xad75114a92043d79ULL, 0xa15594ac938608f6ULL,
+        0xf5bced3ecf56f9fbULL, 0x088767882a27eaecULL, 0x5c6e1e1a76f71be1ULL,
+        0x6028ddce4fcbd247ULL, 0x34c1a45c131b234aULL, 0xc9fa2eeaf66a305dULL,
+        0x9d135778aabac150ULL, 0xb177a9428413a311ULL, 0xe59ed0d0d8c3521cULL,
+        0x18a55a663db2410bULL, 0x4c4c23f46162b006ULL, 0x700ae020585e79a0ULL,
+        0x24e399b2048e88adULL, 0xd9d81304e1ff9bbaULL, 0x8d316a96bd2f6ab7ULL,
+        0xc19918c8e2fbf0a4ULL, 0x9570615abe2b01a9ULL, 0x684bebec5b5a12beULL,
+        0x3ca2927e078ae3b3ULL, 0x00e451aa3eb62a15ULL, 0x540d28386266db18ULL,
+        0xa936a28e8717c80fULL, 0xfddfdb1cdbc73902ULL, 0xd1bb2526f56e5b43ULL,
+        0x85525cb4a9beaa4eULL, 0x7869d6024ccfb959ULL, 0x2c80af90101f4854ULL,
+        0x10c66c44292381f2ULL, 0x442f15d675f370ffULL, 0xb9149f60908263e8ULL,
+        0xedfde6f2cc5292e5ULL, 0xe1dd6314cdd0a76aULL, 0xb5341a8691005667ULL,
+        0x480f903074714570ULL, 0x1ce6e9a228a1b47dULL, 0x20a02a76119d7ddbULL,
+        0x744953e44d4d8cd6ULL, 0x8972d952a83c9fc1ULL, 0xdd9ba0c0f4ec6eccULL,
+        0xf1ff5efada450c8dULL, 0xa51627688695fd80ULL, 0x582dadde63e4ee97ULL,
+        0x0cc4d44c3f341f9aULL, 0x308217980608d63cULL, 0x646b6e0a5ad82731ULL,
+        0x9950e4bcbfa93426ULL, 0xcdb99d2ee379c52bULL, 0x90fb71cad654a0f5ULL,
+        0xc41208588a8451f8ULL, 0x392982ee6ff542efULL, 0x6dc0fb7c3325b3e2ULL,
+        0x518638a80a197a44ULL, 0x056f413a56c98b49ULL, 0xf854cb8cb3b8985eULL,
+        0xacbdb21eef686953ULL, 0x80d94c24c1c10b12ULL, 0xd43035b69d11fa1fULL,
+        0x290bbf007860e908ULL, 0x7de2c69224b01805ULL, 0x41a405461d8cd1a3ULL,
+        0x154d7cd4415c20aeULL, 0xe876f662a42d33b9ULL, 0xbc9f8ff0f8fdc2b4ULL,
+        0xb0bf0a16f97ff73bULL, 0xe4567384a5af0636ULL, 0x196df93240de1521ULL,
+        0x4d8480a01c0ee42cULL, 0x71c2437425322d8aULL, 0x252b3ae679e2dc87ULL,
+        0xd810b0509c93cf90ULL, 0x8cf9c9c2c0433e9dULL, 0xa09d37f8eeea5cdcULL,
+        0xf4744e6ab23aadd1ULL, 0x094fc4dc574bbec6ULL, 0x5da6bd4e0b9b4fcbULL,
+        0x61e07e9a32a7866dULL, 0x350907086e777760ULL, 0xc8328dbe8b066477ULL,
+        0x9cdbf42cd7d6957aULL, 0xd073867288020f69ULL, 0x849affe0d4d2fe64ULL,
+        0x79a1755631a3ed73ULL, 0x2d480cc46d731c7eULL, 0x110ecf10544fd5d8ULL,
+        0x45e7b682089f24d5ULL, 0xb8dc3c34edee37c2ULL, 0xec3545a6b13ec6cfULL,
+        0xc051bb9c9f97a48eULL, 0x94b8c20ec3475583ULL, 0x698348b826364694ULL,
+        0x3d6a312a7ae6b799ULL, 0x012cf2fe43da7e3fULL, 0x55c58b6c1f0a8f32ULL,
+        0xa8fe01dafa7b9c25ULL, 0xfc177848a6ab6d28ULL, 0xf037fdaea72958a7ULL,
+        0xa4de843cfbf9a9aaULL, 0x59e50e8a1e88babdULL, 0x0d0c771842584bb0ULL,
+        0x314ab4cc7b648216ULL, 0x65a3cd5e27b4731bULL, 0x989847e8c2c5600cULL,
+        0xcc713e7a9e159101ULL, 0xe015c040b0bcf340ULL, 0xb4fcb9d2ec6c024dULL,
+        0x49c73364091d115aULL, 0x1d2e4af655cde057ULL, 0x216889226cf129f1ULL,
+        0x7581f0b03021d8fcULL, 0x88ba7a06d550cbebULL, 0xdc53039489803ae6ULL,
+        0x11ea9eba6af9ffcdULL, 0x4503e72836290ec0ULL, 0xb8386d9ed3581dd7ULL,
+        0xecd1140c8f88ecdaULL, 0xd097d7d8b6b4257cULL, 0x847eae4aea64d471ULL,
+        0x794524fc0f15c766ULL, 0x2dac5d6e53c5366bULL, 0x01c8a3547d6c542aULL,
+        0x5521dac621bca527ULL, 0xa81a5070c4cdb630ULL, 0xfcf329e2981d473dULL,
+        0xc0b5ea36a1218e9bULL, 0x945c93a4fdf17f96ULL, 0x6967191218806c81ULL,
+        0x3d8e608044509d8cULL, 0x31aee56645d2a803ULL, 0x65479cf41902590eULL,
+        0x987c1642fc734a19ULL, 0xcc956fd0a0a3bb14ULL, 0xf0d3ac04999f72b2ULL,
+        0xa43ad596c54f83bfULL, 0x59015f20203e90a8ULL, 0x0de826b27cee61a5ULL,
+        0x218cd888524703e4ULL, 0x7565a11a0e97f2e9ULL, 0x885e2bacebe6e1feULL,
+        0xdcb7523eb73610f3ULL, 0xe0f191ea8e0ad955ULL, 0xb418e878d2da2858ULL,
+        0x492362ce37ab3b4fULL, 0x1dca1b5c6b7bca42ULL, 0x5162690234af5051ULL,
+        0x058b1090687fa15cULL, 0xf8b09a268d0eb24bULL, 0xac59e3b4d1de4346ULL,
+        0x901f2060e8e28ae0ULL, 0xc4f659f2b4327bedULL, 0x39cdd344514368faULL,
+        0x6d24aad60d9399f7ULL, 0x414054ec233afbb6ULL, 0x15a92d7e7fea0abbULL,
+        0xe892a7c89a9b19acULL, 0xbc7bde5ac64be8a1ULL, 0x803d1d8eff772107ULL,
+        0xd4d4641ca3a7d00aULL, 0x29efeeaa46d6c31dULL, 0x7d0697381a063210ULL,
+        0x712612de1b84079fULL, 0x25cf6b4c4754f692ULL, 0xd8f4e1faa225e585ULL,
+        0x8c1d9868fef51488ULL, 0xb05b5bbcc7c9dd2eULL, 0xe4b2222e9b192c23ULL,
+        0x1989a8987e683f34ULL, 0x4d60d10a22b8ce39ULL, 0x61042f300c11ac78ULL,
+        0x35ed56a250c15d75ULL, 0xc8d6dc14b5b04e62ULL, 0x9c3fa586e960bf6fULL,
+        0xa0796652d05c76c9ULL, 0xf4901fc08c8c87c4ULL, 0x09ab957669fd94d3ULL,
+        0x5d42ece4352d65deULL
+    },
+    {
+        0x0000000000000000ULL, 0x3f0be14a916a6dcbULL, 0x7e17c29522d4db96ULL,
+        0x411c23dfb3beb65dULL, 0xfc2f852a45a9b72cULL, 0xc3246460d4c3dae7ULL,
+        0x823847bf677d6cbaULL, 0xbd33a6f5f6170171ULL, 0x6a87a57f245d70ddULL,
+        0x558c4435b5371d16ULL, 0x149067ea0689ab4bULL, 0x2b9b86a097e3c680ULL,
+        0x96a8205561f4c7f1ULL, 0xa9a3c11ff09eaa3aULL, 0xe8bfe2c043201c67ULL,
+        0xd7b4038ad24a71acULL, 0xd50f4afe48bae1baULL, 0xea04abb4d9d08c71ULL,
+        0xab18886b6a6e3a2cULL, 0x94136921fb0457e7ULL, 0x2920cfd40d135696ULL,
+        0x162b2e9e9c793b5dULL, 0x57370d412fc78d00ULL, 0x683cec0bbeade0cbULL,
+        0xbf88ef816ce79167ULL, 0x80830ecbfd8dfcacULL, 0xc19f2d144e334af1ULL,
+        0xfe94cc5edf59273aULL, 0x43a76aab294e264bULL, 0x7cac8be1b8244b80ULL,
+        0x3db0a83e0b9afdddULL, 0x02bb49749af09016ULL, 0x38c63ad73e7bddf1ULL,
+        0x07cddb9daf11b03aULL, 0x46d1f8421caf0667ULL, 0x79da19088dc56bacULL,
+        0xc4e9bffd7bd26addULL, 0xfbe25eb7eab80716ULL, 0xbafe7d685906b14bULL,
+        0x85f59c22c86cdc80ULL, 0x52419fa81a26ad2cULL, 0x6d4a7ee28b4cc0e7ULL,
+        0x2c565d3d38f276baULL, 0x135dbc77a9981b71ULL, 0xae6e1a825f8f1a00ULL,
+        0x9165fbc8cee577cbULL, 0xd079d8177d5bc196ULL, 0xef72395dec31ac5dULL,
+        0xedc9702976c13c4bULL, 0xd2c29163e7ab5180ULL, 0x93deb2bc5415e7ddULL,
+        0xacd553f6c57f8a16ULL, 0x11e6f50333688b67ULL, 0x2eed1449a202e6acULL,
+        0x6ff1379611bc50f1ULL, 0x50fad6dc80d63d3aULL, 0x874ed556529c4c96ULL,
+        0xb845341cc3f6215dULL, 0xf95917c370489700ULL, 0xc652f689e122facbULL,
+        0x7b61507c1735fbbaULL, 0x446ab136865f9671ULL, 0x057692e935e1202cULL,
+        0x3a7d73a3a48b4de7ULL, 0x718c75ae7cf7bbe2ULL, 0x4e8794e4ed9dd629ULL,
+        0x0f9bb73b5e236074ULL, 0x30905671cf490dbfULL, 0x8da3f084395e0cceULL,
+        0xb2a811cea8346105ULL, 0xf3b432111b8ad758ULL, 0xccbfd35b8ae0ba93ULL,
+        0x1b0bd0d158aacb3fULL, 0x2400319bc9c0a6f4ULL, 0x651c12447a7e10a9ULL,
+        0x5a17f30eeb147d62ULL, 0xe72455fb1d037c13ULL, 0xd82fb4b18c6911d8ULL,
+        0x9933976e3fd7a785ULL, 0xa6387624aebdca4eULL, 0xa4833f50344d5a58ULL,
+        0x9b88de1aa5273793ULL, 0xda94fdc5169981ceULL, 0xe59f1c8f87f3ec05ULL,
+        0x58acba7a71e4ed74ULL, 0x67a75b30e08e80bfULL, 0x26bb78ef533036e2ULL,
+        0x19b099a5c25a5b29ULL, 0xce049a2f10102a85ULL, 0xf10f7b65817a474eULL,
+        0xb01358ba32c4f113ULL, 0x8f18b9f0a3ae9cd8ULL, 0x322b1f0555b99da9ULL,
+        0x0d20fe4fc4d3f062ULL, 0x4c3cdd90776d463fULL, 0x73373cdae6072bf4ULL,
+        0x494a4f79428c6613ULL, 0x7641ae33d3e60bd8ULL, 0x375d8dec6058bd85ULL,
+        0x08566ca6f132d04eULL, 0xb565ca530725d13fULL, 0x8a6e2b19964fbcf4ULL,
+        0xcb7208c625f10aa9ULL, 0xf479e98cb49b6762ULL, 0x23cdea0666d116ceULL,
+        0x1cc60b4cf7bb7b05ULL, 0x5dda28934405cd58ULL, 0x62d1c9d9d56fa093ULL,
+        0xdfe26f2c2378a1e2ULL, 0xe0e98e66b212cc29ULL, 0xa1f5adb901ac7a74ULL,
+        0x9efe4cf390c617bfULL, 0x9c4505870a3687a9ULL, 0xa34ee4cd9b5cea62ULL,
+        0xe252c71228e25c3fULL, 0xdd592658b98831f4ULL, 0x606a80ad4f9f3085ULL,
+        0x5f6161e7def55d4eULL, 0x1e7d42386d4beb13ULL, 0x2176a372fc2186d8ULL,
+        0xf6c2a0f82e6bf774ULL, 0xc9c941b2bf019abfULL, 0x88d5626d0cbf2ce2ULL,
+        0xb7de83279dd54129ULL, 0x0aed25d26bc24058ULL, 0x35e6c498faa82d93ULL,
+        0x74fae74749169bceULL, 0x4bf1060dd87cf605ULL, 0xe318eb5cf9ef77c4ULL,
+        0xdc130a1668851a0fULL, 0x9d0f29c9db3bac52ULL, 0xa204c8834a51c199ULL,
+        0x1f376e76bc46c0e8ULL, 0x203c8f3c2d2cad23ULL, 0x6120ace39e921b7eULL,
+        0x5e2b4da90ff876b5ULL, 0x899f4e23ddb20719ULL, 0xb694af694cd86ad2ULL,
+        0xf7888cb6ff66dc8fULL, 0xc8836dfc6e0cb144ULL, 0x75b0cb09981bb035ULL,
+        0x4abb2a430971ddfeULL, 0x0ba7099cbacf6ba3ULL, 0x34ace8d62ba50668ULL,
+        0x3617a1a2b155967eULL, 0x091c40e8203ffbb5ULL, 0x4800633793814de8ULL,
+        0x770b827d02eb2023ULL, 0xca382488f4fc2152ULL, 0xf533c5c265964c99ULL,
+        0xb42fe61dd628fac4ULL, 0x8b2407574742970fULL, 0x5c9004dd9508e6a3ULL,
+        0x639be59704628b68ULL, 0x2287c648b7dc3d35ULL, 0x1d8c270226b650feULL,
+        0xa0bf81f7d0a1518fULL, 0x9fb460bd41cb3c44ULL, 0xdea84362f2758a19ULL,
+        0xe1a3a228631fe7d2ULL, 0xdbded18bc794aa35ULL, 0xe4d530c156fec7feULL,
+        0xa5c9131ee54071a3ULL, 0x9ac2f254742a1c68ULL, 0x27f154a1823d1d19ULL,
+        0x18fab5eb135770d2ULL, 0x59e69634a0e9c68fULL, 0x66ed777e3183ab44ULL,
+        0xb15974f4e3c9dae8ULL, 0x8e5295be72a3b723ULL, 0xcf4eb661c11d017eULL,
+        0xf045572b50776cb5ULL, 0x4d76f1dea6606dc4ULL, 0x727d1094370a000fULL,
+        0x3361334b84b4b652ULL, 0x0c6ad20115dedb99ULL, 0x0ed19b758f2e4b8fULL,
+        0x31da7a3f1e442644ULL, 0x70c659e0adfa9019ULL, 0x4fcdb8aa3c90fdd2ULL,
+        0xf2fe1e5fca87fca3ULL, 0xcdf5ff155bed9168ULL, 0x8ce9dccae8532735ULL,
+        0xb3e23d8079394afeULL, 0x64563e0aab733b52ULL, 0x5b5ddf403a195699ULL,
+        0x1a41fc9f89a7e0c4ULL, 0x254a1dd518cd8d0fULL, 0x9879bb20eeda8c7eULL,
+        0xa7725a6a7fb0e1b5ULL, 0xe66e79b5cc0e57e8ULL, 0xd96598ff5d643a23ULL,
+        0x92949ef28518cc26ULL, 0xad9f7fb81472a1edULL, 0xec835c67a7cc17b0ULL,
+        0xd388bd2d36a67a7bULL, 0x6ebb1bd8c0b17b0aULL, 0x51b0fa9251db16c1ULL,
+        0x10acd94de265a09cULL, 0x2fa73807730fcd57ULL, 0xf8133b8da145bcfbULL,
+        0xc718dac7302fd130ULL, 0x8604f9188391676dULL, 0xb90f185212fb0aa6ULL,
+        0x043cbea7e4ec0bd7ULL, 0x3b375fed7586661cULL, 0x7a2b7c32c638d041ULL,
+        0x45209d785752bd8aULL, 0x479bd40ccda22d9cULL, 0x789035465cc84057ULL,
+        0x398c1699ef76f60aULL, 0x0687f7d37e1c9bc1ULL, 0xbbb45126880b9ab0ULL,
+        0x84bfb06c1961f77bULL, 0xc5a393b3aadf4126ULL, 0xfaa872f93bb52cedULL,
+        0x2d1c7173e9ff5d41ULL, 0x121790397895308aULL, 0x530bb3e6cb2b86d7ULL,
+        0x6c0052ac5a41eb1cULL, 0xd133f459ac56ea6dULL, 0xee3815133d3c87a6ULL,
+        0xaf2436cc8e8231fbULL, 0x902fd7861fe85c30ULL, 0xaa52a425bb6311d7ULL,
+        0x9559456f2a097c1cULL, 0xd44566b099b7ca41ULL, 0xeb4e87fa08dda78aULL,
+        0x567d210ffecaa6fbULL, 0x6976c0456fa0cb30ULL, 0x286ae39adc1e7d6dULL,
+        0x176102d04d7410a6ULL, 0xc0d5015a9f3e610aULL, 0xffdee0100e540cc1ULL,
+        0xbec2c3cfbdeaba9cULL, 0x81c922852c80d757ULL, 0x3cfa8470da97d626ULL,
+        0x03f1653a4bfdbbedULL, 0x42ed46e5f8430db0ULL, 0x7de6a7af6929607bULL,
+        0x7f5deedbf3d9f06dULL, 0x40560f9162b39da6ULL, 0x014a2c4ed10d2bfbULL,
+        0x3e41cd0440674630ULL, 0x83726bf1b6704741ULL, 0xbc798abb271a2a8aULL,
+        0xfd65a96494a49cd7ULL, 0xc26e482e05cef11cULL, 0x15da4ba4d78480b0ULL,
+        0x2ad1aaee46eeed7bULL, 0x6bcd8931f5505b26ULL, 0x54c6687b643a36edULL,
+        0xe9f5ce8e922d379cULL, 0xd6fe2fc403475a57ULL, 0x97e20c1bb0f9ec0aULL,
+        0xa8e9ed51219381c1ULL
+    },
+    {
+        0x0000000000000000ULL, 0x1dee8a5e222ca1dcULL, 0x3bdd14bc445943b8ULL,
+        0x26339ee26675e264ULL, 0x77ba297888b28770ULL, 0x6a54a326aa9e26acULL,
+        0x4c673dc4ccebc4c8ULL, 0x5189b79aeec76514ULL, 0xef7452f111650ee0ULL,
+        0xf29ad8af3349af3cULL, 0xd4a9464d553c4d58ULL, 0xc947cc137710ec84ULL,
+        0x98ce7b8999d78990ULL, 0x8520f1d7bbfb284cULL, 0xa3136f35dd8eca28ULL,
+        0xbefde56bffa26bf4ULL, 0x4c300ac98dc40345ULL, 0x51de8097afe8a299ULL,
+        0x77ed1e75c99d40fdULL, 0x6a03942bebb1e121ULL, 0x3b8a23b105768435ULL,
+        0x2664a9ef275a25e9ULL, 0x0057370d412fc78dULL, 0x1db9bd5363036651ULL,
+        0xa34458389ca10da5ULL, 0xbeaad266be8dac79ULL, 0x98994c84d8f84e1dULL,
+        0x8577c6dafad4efc1ULL, 0xd4fe714014138ad5ULL, 0xc910fb1e363f2b09ULL,
+        0xef2365fc504ac96dULL, 0xf2cdefa2726668b1ULL, 0x986015931b88068aULL,
+        0x858e9fcd39a4a756ULL, 0xa3bd012f5fd14532ULL, 0xbe538b717dfde4eeULL,
+        0xefda3ceb933a81faULL, 0xf234b6b5b1162026ULL, 0xd4072857d763c242ULL,
+        0xc9e9a209f54f639eULL, 0x771447620aed086aULL, 0x6afacd3c28c1a9b6ULL,
+        0x4cc953de4eb44bd2ULL, 0x5127d9806c98ea0eULL, 0x00ae6e1a825f8f1aULL,
+        0x1d40e444a0732ec6ULL, 0x3b737aa6c606cca2ULL, 0x269df0f8e42a6d7eULL,
+        0xd4501f5a964c05cfULL, 0xc9be9504b460a413ULL, 0xef8d0be6d2154677ULL,
+        0xf26381b8f039e7abULL, 0xa3ea36221efe82bfULL, 0xbe04bc7c3cd22363ULL,
+        0x9837229e5aa7c107ULL, 0x85d9a8c0788b60dbULL, 0x3b244dab87290b2fULL,
+        0x26cac7f5a505aaf3ULL, 0x00f95917c3704897ULL, 0x1d17d349e15ce94bULL,
+        0x4c9e64d30f9b8c5fULL, 0x5170ee8d2db72d83ULL, 0x7743706f4bc2cfe7ULL,
+        0x6aadfa3169ee6e3bULL, 0xa218840d981e1391ULL, 0xbff60e53ba32b24dULL,
+        0x99c590b1dc475029ULL, 0x842b1aeffe6bf1f5ULL, 0xd5a2ad7510ac94e1ULL,
+        0xc84c272b3280353dULL, 0xee7fb9c954f5d759ULL, 0xf391339776d97685ULL,
+        0x4d6cd6fc897b1d71ULL, 0x50825ca2ab57bcadULL, 0x76b1c240cd225ec9ULL,
+        0x6b5f481eef0eff15ULL, 0x3ad6ff8401c99a01ULL, 0x273875da23e53bddULL,
+        0x010beb384590d9b9ULL, 0x1ce5616667bc7865ULL, 0xee288ec415da10d4ULL,
+        0xf3c6049a37f6b108ULL, 0xd5f59a785183536cULL, 0xc81b102673aff2b0ULL,
+        0x9992a7bc9d6897a4ULL, 0x847c2de2bf443678ULL, 0xa24fb300d931d41cULL,
+        0xbfa1395efb1d75c0ULL, 0x015cdc3504bf1e34ULL, 0x1cb2566b2693bfe8ULL,
+        0x3a81c88940e65d8cULL, 0x276f42d762cafc50ULL, 0x76e6f54d8c0d9944ULL,
+        0x6b087f13ae213898ULL, 0x4d3be1f1c854dafcULL, 0x50d56bafea787b20ULL,
+        0x3a78919e8396151bULL, 0x27961bc0a1bab4c7ULL, 0x01a58522c7cf56a3ULL,
+        0x1c4b0f7ce5e3f77fULL, 0x4dc2b8e60b24926bULL, 0x502c32b8290833b7ULL,
+        0x761fac5a4f7dd1d3ULL, 0x6bf126046d51700fULL, 0xd50cc36f92f31bfbULL,
+        0xc8e24931b0dfba27ULL, 0xeed1d7d3d6aa5843ULL, 0xf33f5d8df486f99fULL,
+        0xa2b6ea171a419c8bULL, 0xbf586049386d3d57ULL, 0x996bfeab5e18df33ULL,
+        0x848574f57c347eefULL, 0x76489b570e52165eULL, 0x6ba611092c7eb782ULL,
+        0x4d958feb4a0b55e6ULL, 0x507b05b56827f43aULL, 0x01f2b22f86e0912eULL,
+        0x1c1c3871a4cc30f2ULL, 0x3a2fa693c2b9d296ULL, 0x27c12ccde095734aULL,
+        0x993cc9a61f3718beULL, 0x84d243f83d1bb962ULL, 0xa2e1dd1a5b6e5b06ULL,
+        0xbf0f57447942fadaULL, 0xee86e0de97859fceULL, 0xf3686a80b5a93e12ULL,
+        0xd55bf462d3dcdc76ULL, 0xc8b57e3cf1f07daaULL, 0xd6e9a7309f3239a7ULL,
+        0xcb072d6ebd1e987bULL, 0xed34b38cdb6b7a1fULL, 0xf0da39d2f947dbc3ULL,
+        0xa1538e481780bed7ULL, 0xbcbd041635ac1f0bULL, 0x9a8e9af453d9fd6fULL,
+        0x876010aa71f55cb3ULL, 0x399df5c18e573747ULL, 0x24737f9fac7b969bULL,
+        0x0240e17dca0e74ffULL, 0x1fae6b23e822d523ULL, 0x4e27dcb906e5b037ULL,
+        0x53c956e724c911ebULL, 0x75fac80542bcf38fULL, 0x6814425b60905253ULL,
+        0x9ad9adf912f63ae2ULL, 0x873727a730da9b3eULL, 0xa104b94556af795aULL,
+        0xbcea331b7483d886ULL, 0xed6384819a44bd92ULL, 0xf08d0edfb8681c4eULL,
+        0xd6be903dde1dfe2aULL, 0xcb501a63fc315ff6ULL, 0x75adff0803933402ULL,
+        0x6843755621bf95deULL, 0x4e70ebb447ca77baULL, 0x539e61ea65e6d666ULL,
+        0x0217d6708b21b372ULL, 0x1ff95c2ea90d12aeULL, 0x39cac2cccf78f0caULL,
+        0x24244892ed545116ULL, 0x4e89b2a384ba3f2dULL, 0x536738fda6969ef1ULL,
+        0x7554a61fc0e37c95ULL, 0x68ba2c41e2cfdd49ULL, 0x39339bdb0c08b85dULL,
+        0x24dd11852e241981ULL, 0x02ee8f674851fbe5ULL, 0x1f0005396a7d5a39ULL,
+        0xa1fde05295df31cdULL, 0xbc136a0cb7f39011ULL, 0x9a20f4eed1867275ULL,
+        0x87ce7eb0f3aad3a9ULL, 0xd647c92a1d6db6bdULL, 0xcba943743f411761ULL,
+        0xed9add965934f505ULL, 0xf07457c87b1854d9ULL, 0x02b9b86a097e3c68ULL,
+        0x1f5732342b529db4ULL, 0x3964acd64d277fd0ULL, 0x248a26886f0bde0cULL,
+        0x7503911281ccbb18ULL, 0x68ed1b4ca3e01ac4ULL, 0x4ede85aec595f8a0ULL,
+        0x53300ff0e7b9597cULL, 0xedcdea9b181b3288ULL, 0xf02360c53a379354ULL,
+        0xd610fe275c427130ULL, 0xcbfe74797e6ed0ecULL, 0x9a77c3e390a9b5f8ULL,
+        0x879949bdb2851424ULL, 0xa1aad75fd4f0f640ULL, 0xbc445d01f6dc579cULL,
+        0x74f1233d072c2a36ULL, 0x691fa96325008beaULL, 0x4f2c37814375698eULL,
+        0x52c2bddf6159c852ULL, 0x034b0a458f9ead46ULL, 0x1ea5801badb20c9aULL,
+        0x38961ef9cbc7eefeULL, 0x257894a7e9eb4f22ULL, 0x9b8571cc164924d6ULL,
+        0x866bfb923465850aULL, 0xa05865705210676eULL, 0xbdb6ef2e703cc6b2ULL,
+        0xec3f58b49efba3a6ULL, 0xf1d1d2eabcd7027aULL, 0xd7e24c08daa2e01eULL,
+        0xca0cc656f88e41c2ULL, 0x38c129f48ae82973ULL, 0x252fa3aaa8c488afULL,
+        0x031c3d48ceb16acbULL, 0x1ef2b716ec9dcb17ULL, 0x4f7b008c025aae03ULL,
+        0x52958ad220760fdfULL, 0x74a614304603edbbULL, 0x69489e6e642f4c67ULL,
+        0xd7b57b059b8d2793ULL, 0xca5bf15bb9a1864fULL, 0xec686fb9dfd4642bULL,
+        0xf186e5e7fdf8c5f7ULL, 0xa00f527d133fa0e3ULL, 0xbde1d8233113013fULL,
+        0x9bd246c15766e35bULL, 0x863ccc9f754a4287ULL, 0xec9136ae1ca42cbcULL,
+        0xf17fbcf03e888d60ULL, 0xd74c221258fd6f04ULL, 0xcaa2a84c7ad1ced8ULL,
+        0x9b2b1fd69416abccULL, 0x86c59588b63a0a10ULL, 0xa0f60b6ad04fe874ULL,
+        0xbd188134f26349a8ULL, 0x03e5645f0dc1225cULL, 0x1e0bee012fed8380ULL,
+        0x383870e3499861e4ULL, 0x25d6fabd6bb4c038ULL, 0x745f4d278573a52cULL,
+        0x69b1c779a75f04f0ULL, 0x4f82599bc12ae694ULL, 0x526cd3c5e3064748ULL,
+        0xa0a13c6791602ff9ULL, 0xbd4fb639b34c8e25ULL, 0x9b7c28dbd5396c41ULL,
+        0x8692a285f715cd9dULL, 0xd71b151f19d2a889ULL, 0xcaf59f413bfe0955ULL,
+        0xecc601a35d8beb31ULL, 0xf1288bfd7fa74aedULL, 0x4fd56e9680052119ULL,
+        0x523be4c8a22980c5ULL, 0x74087a2ac45c62a1ULL, 0x69e6f074e670c37dULL,
+        0x386f47ee08b7a669ULL, 0x2581cdb02a9b07b5ULL, 0x03b253524ceee5d1ULL,
+        0x1e5cd90c6ec2440dULL
+    },
+    {
+        0x0000000000000000ULL, 0x5c2d776033c4205eULL, 0xb85aeec0678840bcULL,
+        0xe47799a0544c60e2ULL, 0xe26d72ab601e9ffdULL, 0xbe4005cb53dabfa3ULL,
+        0x5a379c6b0796df41ULL, 0x061aeb0b3452ff1fULL, 0x56024a7d6f33217fULL,
+        0x0a2f3d1d5cf70121ULL, 0xee58a4bd08bb61c3ULL, 0xb275d3dd3b7f419dULL,
+        0xb46f38d60f2dbe82ULL, 0xe8424fb63ce99edcULL, 0x0c35d61668a5fe3eULL,
+        0x5018a1765b61de60ULL, 0xac0494fade6642feULL, 0xf029e39aeda262a0ULL,
+        0x145e7a3ab9ee0242ULL, 0x48730d5a8a2a221cULL, 0x4e69e651be78dd03ULL,
+        0x124491318dbcfd5dULL, 0xf6330891d9f09dbfULL, 0xaa1e7ff1ea34bde1ULL,
+        0xfa06de87b1556381ULL, 0xa62ba9e7829143dfULL, 0x425c3047d6dd233dULL,
+        0x1e714727e5190363ULL, 0x186bac2cd14bfc7cULL, 0x4446db4ce28fdc22ULL,
+        0xa03142ecb6c3bcc0ULL, 0xfc1c358c85079c9eULL, 0xcad186de13c29b79ULL,
+        0x96fcf1be2006bb27ULL, 0x728b681e744adbc5ULL, 0x2ea61f7e478efb9bULL,
+        0x28bcf47573dc0484ULL, 0x74918315401824daULL, 0x90e61ab514544438ULL,
+        0xcccb6dd527906466ULL, 0x9cd3cca37cf1ba06ULL, 0xc0febbc34f359a58ULL,
+        0x248922631b79fabaULL, 0x78a4550328bddae4ULL, 0x7ebebe081cef25fbULL,
+        0x2293c9682f2b05a5ULL, 0xc6e450c87b676547ULL, 0x9ac927a848a34519ULL,
+        0x66d51224cda4d987ULL, 0x3af86544fe60f9d9ULL, 0xde8ffce4aa2c993bULL,
+        0x82a28b8499e8b965ULL, 0x84b8608fadba467aULL, 0xd89517ef9e7e6624ULL,
+        0x3ce28e4fca3206c6ULL, 0x60cff92ff9f62698ULL, 0x30d75859a297f8f8ULL,
+        0x6cfa2f399153d8a6ULL, 0x888db699c51fb844ULL, 0xd4a0c1f9f6db981aULL,
+        0xd2ba2af2c2896705ULL, 0x8e975d92f14d475bULL, 0x6ae0c432a50127b9ULL,
+        0x36cdb35296c507e7ULL, 0x077ba297888b2877ULL, 0x5b56d5f7bb4f0829ULL,
+        0xbf214c57ef0368cbULL, 0xe30c3b37dcc74895ULL, 0xe516d03ce895b78aULL,
+        0xb93ba75cdb5197d4ULL, 0x5d4c3efc8f1df736ULL, 0x0161499cbcd9d768ULL,
+        0x5179e8eae7b80908ULL, 0x0d549f8ad47c2956ULL, 0xe923062a803049b4ULL,
+        0xb50e714ab3f469eaULL, 0xb3149a4187a696f5ULL, 0xef39ed21b462b6abULL,
+        0x0b4e7481e02ed649ULL, 0x576303e1d3eaf617ULL, 0xab7f366d56ed6a89ULL,
+        0xf752410d65294ad7ULL, 0x1325d8ad31652a35ULL, 0x4f08afcd02a10a6bULL,
+        0x491244c636f3f574ULL, 0x153f33a60537d52aULL, 0xf148aa06517bb5c8ULL,
+        0xad65dd6662bf9596ULL, 0xfd7d7c1039de4bf6ULL, 0xa1500b700a1a6ba8ULL,
+        0x452792d05e560b4aULL, 0x190ae5b06d922b14ULL, 0x1f100ebb59c0d40bULL,
+        0x433d79db6a04f455ULL, 0xa74ae07b3e4894b7ULL, 0xfb67971b0d8cb4e9ULL,
+        0xcdaa24499b49b30eULL, 0x91875329a88d9350ULL, 0x75f0ca89fcc1f3b2ULL,
+        0x29ddbde9cf05d3ecULL, 0x2fc756e2fb572cf3ULL, 0x73ea2182c8930cadULL,
+        0x979db8229cdf6c4fULL, 0xcbb0cf42af1b4c11ULL, 0x9ba86e34f47a9271ULL,
+        0xc7851954c7beb22fULL, 0x23f280f493f2d2cdULL, 0x7fdff794a036f293ULL,
+        0x79c51c9f94640d8cULL, 0x25e86bffa7a02dd2ULL, 0xc19ff25ff3ec4d30ULL,
+        0x9db2853fc0286d6eULL, 0x61aeb0b3452ff1f0ULL, 0x3d83c7d376ebd1aeULL,
+        0xd9f45e7322a7b14cULL, 0x85d9291311639112ULL, 0x83c3c21825316e0dULL,
+        0xdfeeb57816f54e53ULL, 0x3b992cd842b92eb1ULL, 0x67b45bb8717d0eefULL,
+        0x37acface2a1cd08fULL, 0x6b818dae19d8f0d1ULL, 0x8ff6140e4d949033ULL,
+        0xd3db636e7e50b06dULL, 0xd5c188654a024f72ULL, 0x89ecff0579c66f2cULL,
+        0x6d9b66a52d8a0fceULL, 0x31b611c51e4e2f90ULL, 0x0ef7452f111650eeULL,
+        0x52da324f22d270b0ULL, 0xb6adabef769e1052ULL, 0xea80dc8f455a300cULL,
+        0xec9a37847108cf13ULL, 0xb0b740e442ccef4dULL, 0x54c0d94416808fafULL,
+        0x08edae242544aff1ULL, 0x58f50f527e257191ULL, 0x04d878324de151cfULL,
+        0xe0afe19219ad312dULL, 0xbc8296f22a691173ULL, 0xba987df91e3bee6cULL,
+        0xe6b50a992dffce32ULL, 0x02c2933979b3aed0ULL, 0x5eefe4594a778e8eULL,
+        0xa2f3d1d5cf701210ULL, 0xfedea6b5fcb4324eULL, 0x1aa93f15a8f852acULL,
+        0x468448759b3c72f2ULL, 0x409ea37eaf6e8dedULL, 0x1cb3d41e9caaadb3ULL,
+        0xf8c44dbec8e6cd51ULL, 0xa4e93adefb22ed0fULL, 0xf4f19ba8a043336fULL,
+        0xa8dcecc893871331ULL, 0x4cab7568c7cb73d3ULL, 0x10860208f40f538dULL,
+        0x169ce903c05dac92ULL, 0x4ab19e63f3998cccULL, 0xaec607c3a7d5ec2eULL,
+        0xf2eb70a39411cc70ULL, 0xc426c3f102d4cb97ULL, 0x980bb4913110ebc9ULL,
+        0x7c7c2d31655c8b2bULL, 0x20515a515698ab75ULL, 0x264bb15a62ca546aULL,
+        0x7a66c63a510e7434ULL, 0x9e115f9a054214d6ULL, 0xc23c28fa36863488ULL,
+        0x9224898c6de7eae8ULL, 0xce09feec5e23cab6ULL, 0x2a7e674c0a6faa54ULL,
+        0x7653102c39ab8a0aULL, 0x7049fb270df97515ULL, 0x2c648c473e3d554bULL,
+        0xc81315e76a7135a9ULL, 0x943e628759b515f7ULL, 0x6822570bdcb28969ULL,
+        0x340f206bef76a937ULL, 0xd078b9cbbb3ac9d5ULL, 0x8c55ceab88fee98bULL,
+        0x8a4f25a0bcac1694ULL, 0xd66252c08f6836caULL, 0x3215cb60db245628ULL,
+        0x6e38bc00e8e07676ULL, 0x3e201d76b381a816ULL, 0x620d6a1680458848ULL,
+        0x867af3b6d409e8aaULL, 0xda5784d6e7cdc8f4ULL, 0xdc4d6fddd39f37ebULL,
+        0x806018bde05b17b5ULL, 0x6417811db4177757ULL, 0x383af67d87d35709ULL,
+        0x098ce7b8999d7899ULL, 0x55a190d8aa5958c7ULL, 0xb1d60978fe153825ULL,
+        0xedfb7e18cdd1187bULL, 0xebe19513f983e764ULL, 0xb7cce273ca47c73aULL,
+        0x53bb7bd39e0ba7d8ULL, 0x0f960cb3adcf8786ULL, 0x5f8eadc5f6ae59e6ULL,
+        0x03a3daa5c56a79b8ULL, 0xe7d443059126195aULL, 0xbbf93465a2e23904ULL,
+        0xbde3df6e96b0c61bULL, 0xe1cea80ea574e645ULL, 0x05b931aef13886a7ULL,
+        0x599446cec2fca6f9ULL, 0xa588734247fb3a67ULL, 0xf9a50422743f1a39ULL,
+        0x1dd29d8220737adbULL, 0x41ffeae213b75a85ULL, 0x47e501e927e5a59aULL,
+        0x1bc87689142185c4ULL, 0xffbfef29406de526ULL, 0xa392984973a9c578ULL,
+        0xf38a393f28c81b18ULL, 0xafa74e5f1b0c3b46ULL, 0x4bd0d7ff4f405ba4ULL,
+        0x17fda09f7c847bfaULL, 0x11e74b9448d684e5ULL, 0x4dca3cf47b12a4bbULL,
+        0xa9bda5542f5ec459ULL, 0xf590d2341c9ae407ULL, 0xc35d61668a5fe3e0ULL,
+        0x9f701606b99bc3beULL, 0x7b078fa6edd7a35cULL, 0x272af8c6de138302ULL,
+        0x213013cdea417c1dULL, 0x7d1d64add9855c43ULL, 0x996afd0d8dc93ca1ULL,
+        0xc5478a6dbe0d1cffULL, 0x955f2b1be56cc29fULL, 0xc9725c7bd6a8e2c1ULL,
+        0x2d05c5db82e48223ULL, 0x7128b2bbb120a27dULL, 0x773259b085725d62ULL,
+        0x2b1f2ed0b6b67d3cULL, 0xcf68b770e2fa1ddeULL, 0x9345c010d13e3d80ULL,
+        0x6f59f59c5439a11eULL, 0x337482fc67fd8140ULL, 0xd7031b5c33b1e1a2ULL,
+        0x8b2e6c3c0075c1fcULL, 0x8d34873734273ee3ULL, 0xd119f05707e31ebdULL,
+        0x356e69f753af7e5fULL, 0x69431e97606b5e01ULL, 0x395bbfe13b0a8061ULL,
+        0x6576c88108cea03fULL, 0x810151215c82c0ddULL, 0xdd2c26416f46e083ULL,
+        0xdb36cd4a5b141f9cULL, 0x871bba2a68d03fc2ULL, 0x636c238a3c9c5f20ULL,
+        0x3f4154ea0f587f7eULL
+    },
+    {
+        0x0000000000000000ULL, 0x6184d55f721267c6ULL, 0xc309aabee424cf8cULL,
+        0xa28d7fe19636a84aULL, 0x14cbfa566747819dULL, 0x754f2f091555e65bULL,
+        0xd7c250e883634e11ULL, 0xb64685b7f17129d7ULL, 0x2997f4acce8f033aULL,
+        0x481321f3bc9d64fcULL, 0xea9e5e122aabccb6ULL, 0x8b1a8b4d58b9ab70ULL,
+        0x3d5c0efaa9c882a7ULL, 0x5cd8dba5dbdae561ULL, 0xfe55a4444dec4d2bULL,
+        0x9fd1711b3ffe2aedULL, 0x532fe9599d1e0674ULL, 0x32ab3c06ef0c61b2ULL,
+        0x902643e7793ac9f8ULL, 0xf1a296b80b28ae3eULL, 0x47e4130ffa5987e9ULL,
+        0x2660c650884be02fULL, 0x84edb9b11e7d4865ULL, 0xe5696cee6c6f2fa3ULL,
+        0x7ab81df55391054eULL, 0x1b3cc8aa21836288ULL, 0xb9b1b74bb7b5cac2ULL,
+        0xd8356214c5a7ad04ULL, 0x6e73e7a334d684d3ULL, 0x0ff732fc46c4e315ULL,
+        0xad7a4d1dd0f24b5fULL, 0xccfe9842a2e02c99ULL, 0xa65fd2b33a3c0ce8ULL,
+        0xc7db07ec482e6b2eULL, 0x6556780dde18c364ULL, 0x04d2ad52ac0aa4a2ULL,
+        0xb29428e55d7b8d75ULL, 0xd310fdba2f69eab3ULL, 0x719d825bb95f42f9ULL,
+        0x10195704cb4d253fULL, 0x8fc8261ff4b30fd2ULL, 0xee4cf34086a16814ULL,
+        0x4cc18ca11097c05eULL, 0x2d4559fe6285a798ULL, 0x9b03dc4993f48e4fULL,
+        0xfa870916e1e6e989ULL, 0x580a76f777d041c3ULL, 0x398ea3a805c22605ULL,
+        0xf5703beaa7220a9cULL, 0x94f4eeb5d5306d5aULL, 0x367991544306c510ULL,
+        0x57fd440b3114a2d6ULL, 0xe1bbc1bcc0658b01ULL, 0x803f14e3b277ecc7ULL,
+        0x22b26b022441448dULL, 0x4336be5d5653234bULL, 0xdce7cf4669ad09a6ULL,
+        0xbd631a191bbf6e60ULL, 0x1fee65f88d89c62aULL, 0x7e6ab0a7ff9ba1ecULL,
+        0xc82c35100eea883bULL, 0xa9a8e04f7cf8effdULL, 0x0b259faeeace47b7ULL,
+        0x6aa14af198dc2071ULL, 0xde670a4ddb760755ULL, 0xbfe3df12a9646093ULL,
+        0x1d6ea0f33f52c8d9ULL, 0x7cea75ac4d40af1fULL, 0xcaacf01bbc3186c8ULL,
+        0xab282544ce23e10eULL, 0x09a55aa558154944ULL, 0x68218ffa2a072e82ULL,
+        0xf7f0fee115f9046fULL, 0x96742bbe67eb63a9ULL, 0x34f9545ff1ddcbe3ULL,
+        0x557d810083cfac25ULL, 0xe33b04b772be85f2ULL, 0x82bfd1e800ace234ULL,
+        0x2032ae09969a4a7eULL, 0x41b67b56e4882db8ULL, 0x8d48e31446680121ULL,
+        0xeccc364b347a66e7ULL, 0x4e4149aaa24cceadULL, 0x2fc59cf5d05ea96bULL,
+        0x99831942212f80bcULL, 0xf807cc1d533de77aULL, 0x5a8ab3fcc50b4f30ULL,
+        0x3b0e66a3b71928f6ULL, 0xa4df17b888e7021bULL, 0xc55bc2e7faf565ddULL,
+        0x67d6bd066cc3cd97ULL, 0x065268591ed1aa51ULL, 0xb014edeeefa08386ULL,
+        0xd19038b19db2e440ULL, 0x731d47500b844c0aULL, 0x1299920f79962bccULL,
+        0x7838d8fee14a0bbdULL, 0x19bc0da193586c7bULL, 0xbb317240056ec431ULL,
+        0xdab5a71f777ca3f7ULL, 0x6cf322a8860d8a20ULL, 0x0d77f7f7f41fede6ULL,
+        0xaffa8816622945acULL, 0xce7e5d49103b226aULL, 0x51af2c522fc50887ULL,
+        0x302bf90d5dd76f41ULL, 0x92a686eccbe1c70bULL, 0xf32253b3b9f3a0cdULL,
+        0x4564d6044882891aULL, 0x24e0035b3a90eedcULL, 0x866d7cbaaca64696ULL,
+        0xe7e9a9e5deb42150ULL, 0x2b1731a77c540dc9ULL, 0x4a93e4f80e466a0fULL,
+        0xe81e9b199870c245ULL, 0x899a4e46ea62a583ULL, 0x3fdccbf11b138c54ULL,
+        0x5e581eae6901eb92ULL, 0xfcd5614fff3743d8ULL, 0x9d51b4108d25241eULL,
+        0x0280c50bb2db0ef3ULL, 0x63041054c0c96935ULL, 0xc1896fb556ffc17fULL,
+        0xa00dbaea24eda6b9ULL, 0x164b3f5dd59c8f6eULL, 0x77cfea02a78ee8a8ULL,
+        0xd54295e331b840e2ULL, 0xb4c640bc43aa2724ULL, 0x2e16bbb019e2102fULL,
+        0x4f926eef6bf077e9ULL, 0xed1f110efdc6dfa3ULL, 0x8c9bc4518fd4b865ULL,
+        0x3add41e67ea591b2ULL, 0x5b5994b90cb7f674ULL, 0xf9d4eb589a815e3eULL,
+        0x98503e07e89339f8ULL, 0x07814f1cd76d1315ULL, 0x66059a43a57f74d3ULL,
+        0xc488e5a23349dc99ULL, 0xa50c30fd415bbb5fULL, 0x134ab54ab02a9288ULL,
+        0x72ce6015c238f54eULL, 0xd0431ff4540e5d04ULL, 0xb1c7caab261c3ac2ULL,
+        0x7d3952e984fc165bULL, 0x1cbd87b6f6ee719dULL, 0xbe30f85760d8d9d7ULL,
+        0xdfb42d0812cabe11ULL, 0x69f2a8bfe3bb97c6ULL, 0x08767de091a9f000ULL,
+        0xaafb0201079f584aULL, 0xcb7fd75e758d3f8cULL, 0x54aea6454a731561ULL,
+        0x352a731a386172a7ULL, 0x97a70cfbae57daedULL, 0xf623d9a4dc45bd2bULL,
+        0x40655c132d3494fcULL, 0x21e1894c5f26f33aULL, 0x836cf6adc9105b70ULL,
+        0xe2e823f2bb023cb6ULL, 0x8849690323de1cc7ULL, 0xe9cdbc5c51cc7b01ULL,
+        0x4b40c3bdc7fad34bULL, 0x2ac416e2b5e8b48dULL, 0x9c82935544999d5aULL,
+        0xfd06460a368bfa9cULL, 0x5f8b39eba0bd52d6ULL, 0x3e0fecb4d2af3510ULL,
+        0xa1de9dafed511ffdULL, 0xc05a48f09f43783bULL, 0x62d737110975d071ULL,
+        0x0353e24e7b67b7b7ULL, 0xb51567f98a169e60ULL, 0xd491b2a6f804f9a6ULL,
+        0x761ccd476e3251ecULL, 0x179818181c20362aULL, 0xdb66805abec01ab3ULL,
+        0xbae25505ccd27d75ULL, 0x186f2ae45ae4d53fULL, 0x79ebffbb28f6b2f9ULL,
+        0xcfad7a0cd9879b2eULL, 0xae29af53ab95fce8ULL, 0x0ca4d0b23da354a2ULL,
+        0x6d2005ed4fb13364ULL, 0xf2f174f6704f1989ULL, 0x9375a1a9025d7e4fULL,
+        0x31f8de48946bd605ULL, 0x507c0b17e679b1c3ULL, 0xe63a8ea017089814ULL,
+        0x87be5bff651affd2ULL, 0x2533241ef32c5798ULL, 0x44b7f141813e305eULL,
+        0xf071b1fdc294177aULL, 0x91f564a2b08670bcULL, 0x33781b4326b0d8f6ULL,
+        0x52fcce1c54a2bf30ULL, 0xe4ba4baba5d396e7ULL, 0x853e9ef4d7c1f121ULL,
+        0x27b3e11541f7596bULL, 0x4637344a33e53eadULL, 0xd9e645510c1b1440ULL,
+        0xb862900e7e097386ULL, 0x1aefefefe83fdbccULL, 0x7b6b3ab09a2dbc0aULL,
+        0xcd2dbf076b5c95ddULL, 0xaca96a58194ef21bULL, 0x0e2415b98f785a51ULL,
+        0x6fa0c0e6fd6a3d97ULL, 0xa35e58a45f8a110eULL, 0xc2da8dfb2d9876c8ULL,
+        0x6057f21abbaede82ULL, 0x01d32745c9bcb944ULL, 0xb795a2f238cd9093ULL,
+        0xd61177ad4adff755ULL, 0x749c084cdce95f1fULL, 0x1518dd13aefb38d9ULL,
+        0x8ac9ac0891051234ULL, 0xeb4d7957e31775f2ULL, 0x49c006b67521ddb8ULL,
+        0x2844d3e90733ba7eULL, 0x9e02565ef64293a9ULL, 0xff8683018450f46fULL,
+        0x5d0bfce012665c25ULL, 0x3c8f29bf60743be3ULL, 0x562e634ef8a81b92ULL,
+        0x37aab6118aba7c54ULL, 0x9527c9f01c8cd41eULL, 0xf4a31caf6e9eb3d8ULL,
+        0x42e599189fef9a0fULL, 0x23614c47edfdfdc9ULL, 0x81ec33a67bcb5583ULL,
+        0xe068e6f909d93245ULL, 0x7fb997e2362718a8ULL, 0x1e3d42bd44357f6eULL,
+        0xbcb03d5cd203d724ULL, 0xdd34e803a011b0e2ULL, 0x6b726db451609935ULL,
+        0x0af6b8eb2372fef3ULL, 0xa87bc70ab54456b9ULL, 0xc9ff1255c756317fULL,
+        0x05018a1765b61de6ULL, 0x64855f4817a47a20ULL, 0xc60820a98192d26aULL,
+        0xa78cf5f6f380b5acULL, 0x11ca704102f19c7bULL, 0x704ea51e70e3fbbdULL,
+        0xd2c3daffe6d553f7ULL, 0xb3470fa094c73431ULL, 0x2c967ebbab391edcULL,
+        0x4d12abe4d92b791aULL, 0xef9fd4054f1dd150ULL, 0x8e1b015a3d0fb696ULL,
+        0x385d84edcc7e9f41ULL, 0x59d951b2be6cf887ULL, 0xfb542e53285a50cdULL,
+        0x9ad0fb0c5a48370bULL
+    },
+    {
+        0x0000000000000000ULL, 0x22ef0d5934f964ecULL, 0x45de1ab269f2c9d8ULL,
+        0x673117eb5d0bad34ULL, 0x8bbc3564d3e593b0ULL, 0xa953383de71cf75cULL,
+        0xce622fd6ba175a68ULL, 0xec8d228f8eee3e84ULL, 0x85a0c5e208c539e5ULL,
+        0xa74fc8bb3c3c5d09ULL, 0xc07edf506137f03dULL, 0xe291d20955ce94d1ULL,
+        0x0e1cf086db20aa55ULL, 0x2cf3fddfefd9ceb9ULL, 0x4bc2ea34b2d2638dULL,
+        0x692de76d862b0761ULL, 0x999924efbe846d4fULL, 0xbb7629b68a7d09a3ULL,
+        0xdc473e5dd776a497ULL, 0xfea83304e38fc07bULL, 0x1225118b6d61feffULL,
+        0x30ca1cd259989a13ULL, 0x57fb0b3904933727ULL, 0x75140660306a53cbULL,
+        0x1c39e10db64154aaULL, 0x3ed6ec5482b83046ULL, 0x59e7fbbfdfb39d72ULL,
+        0x7b08f6e6eb4af99eULL, 0x9785d46965a4c71aULL, 0xb56ad930515da3f6ULL,
+        0xd25bcedb0c560ec2ULL, 0xf0b4c38238af6a2eULL, 0xa1eae6f4d206c41bULL,
+        0x8305ebade6ffa0f7ULL, 0xe434fc46bbf40dc3ULL, 0xc6dbf11f8f0d692fULL,
+        0x2a56d39001e357abULL, 0x08b9dec9351a3347ULL, 0x6f88c92268119e73ULL,
+        0x4d67c47b5ce8fa9fULL, 0x244a2316dac3fdfeULL, 0x06a52e4fee3a9912ULL,
+        0x619439a4b3313426ULL, 0x437b34fd87c850caULL, 0xaff6167209266e4eULL,
+        0x8d191b2b3ddf0aa2ULL, 0xea280cc060d4a796ULL, 0xc8c70199542dc37aULL,
+        0x3873c21b6c82a954ULL, 0x1a9ccf42587bcdb8ULL, 0x7dadd8a90570608cULL,
+        0x5f42d5f031890460ULL, 0xb3cff77fbf673ae4ULL, 0x9120fa268b9e5e08ULL,
+        0xf611edcdd695f33cULL, 0xd4fee094e26c97d0ULL, 0xbdd307f9644790b1ULL,
+        0x9f3c0aa050bef45dULL, 0xf80d1d4b0db55969ULL, 0xdae21012394c3d85ULL,
+        0x366f329db7a20301ULL, 0x14803fc4835b67edULL, 0x73b1282fde50cad9ULL,
+        0x515e2576eaa9ae35ULL, 0xd10d62c20b0396b3ULL, 0xf3e26f9b3ffaf25fULL,
+        0x94d3787062f15f6bULL, 0xb63c752956083b87ULL, 0x5ab157a6d8e60503ULL,
+        0x785e5affec1f61efULL, 0x1f6f4d14b114ccdbULL, 0x3d80404d85eda837ULL,
+        0x54ada72003c6af56ULL, 0x7642aa79373fcbbaULL, 0x1173bd926a34668eULL,
+        0x339cb0cb5ecd0262ULL, 0xdf119244d0233ce6ULL, 0xfdfe9f1de4da580aULL,
+        0x9acf88f6b9d1f53eULL, 0xb82085af8d2891d2ULL, 0x4894462db587fbfcULL,
+        0x6a7b4b74817e9f10ULL, 0x0d4a5c9fdc753224ULL, 0x2fa551c6e88c56c8ULL,
+        0xc32873496662684cULL, 0xe1c77e10529b0ca0ULL, 0x86f669fb0f90a194ULL,
+        0xa41964a23b69c578ULL, 0xcd3483cfbd42c219ULL, 0xefdb8e9689bba6f5ULL,
+        0x88ea997dd4b00bc1ULL, 0xaa059424e0496f2dULL, 0x4688b6ab6ea751a9ULL,
+        0x6467bbf25a5e3545ULL, 0x0356ac1907559871ULL, 0x21b9a14033acfc9dULL,
+        0x70e78436d90552a8ULL, 0x5208896fedfc3644ULL, 0x35399e84b0f79b70ULL,
+        0x17d693dd840eff9cULL, 0xfb5bb1520ae0c118ULL, 0xd9b4bc0b3e19a5f4ULL,
+        0xbe85abe0631208c0ULL, 0x9c6aa6b957eb6c2cULL, 0xf54741d4d1c06b4dULL,
+        0xd7a84c8de5390fa1ULL, 0xb0995b66b832a295ULL, 0x9276563f8ccbc679ULL,
+        0x7efb74b00225f8fdULL, 0x5c1479e936dc9c11ULL, 0x3b256e026bd73125ULL,
+        0x19ca635b5f2e55c9ULL, 0xe97ea0d967813fe7ULL, 0xcb91ad8053785b0bULL,
+        0xaca0ba6b0e73f63fULL, 0x8e4fb7323a8a92d3ULL, 0x62c295bdb464ac57ULL,
+        0x402d98e4809dc8bbULL, 0x271c8f0fdd96658fULL, 0x05f38256e96f0163ULL,
+        0x6cde653b6f440602ULL, 0x4e3168625bbd62eeULL, 0x29007f8906b6cfdaULL,
+        0x0bef72d0324fab36ULL, 0xe762505fbca195b2ULL, 0xc58d5d068858f15eULL,
+        0xa2bc4aedd5535c6aULL, 0x805347b4e1aa3886ULL, 0x30c26aafb90933e3ULL,
+        0x122d67f68df0570fULL, 0x751c701dd0fbfa3bULL, 0x57f37d44e4029ed7ULL,
+        0xbb7e5fcb6aeca053ULL, 0x999152925e15c4bfULL, 0xfea04579031e698bULL,
+        0xdc4f482037e70d67ULL, 0xb562af4db1cc0a06ULL, 0x978da21485356eeaULL,
+        0xf0bcb5ffd83ec3deULL, 0xd253b8a6ecc7a732ULL, 0x3ede9a29622999b6ULL,
+        0x1c31977056d0fd5aULL, 0x7b00809b0bdb506eULL, 0x59ef8dc23f223482ULL,
+        0xa95b4e40078d5eacULL, 0x8bb4431933743a40ULL, 0xec8554f26e7f9774ULL,
+        0xce6a59ab5a86f398ULL, 0x22e77b24d468cd1cULL, 0x0008767de091a9f0ULL,
+        0x67396196bd9a04c4ULL, 0x45d66ccf89636028ULL, 0x2cfb8ba20f486749ULL,
+        0x0e1486fb3bb103a5ULL, 0x6925911066baae91ULL, 0x4bca9c495243ca7dULL,
+        0xa747bec6dcadf4f9ULL, 0x85a8b39fe8549015ULL, 0xe299a474b55f3d21ULL,
+        0xc076a92d81a659cdULL, 0x91288c5b6b0ff7f8ULL, 0xb3c781025ff69314ULL,
+        0xd4f696e902fd3e20ULL, 0xf6199bb036045accULL, 0x1a94b93fb8ea6448ULL,
+        0x387bb4668c1300a4ULL, 0x5f4aa38dd118ad90ULL, 0x7da5aed4e5e1c97cULL,
+        0x148849b963cace1dULL, 0x366744e05733aaf1ULL, 0x5156530b0a3807c5ULL,
+        0x73b95e523ec16329ULL, 0x9f347cddb02f5dadULL, 0xbddb718484d63941ULL,
+        0xdaea666fd9dd9475ULL, 0xf8056b36ed24f099ULL, 0x08b1a8b4d58b9ab7ULL,
+        0x2a5ea5ede172fe5bULL, 0x4d6fb206bc79536fULL, 0x6f80bf5f88803783ULL,
+        0x830d9dd0066e0907ULL, 0xa1e2908932976debULL, 0xc6d387626f9cc0dfULL,
+        0xe43c8a3b5b65a433ULL, 0x8d116d56dd4ea352ULL, 0xaffe600fe9b7c7beULL,
+        0xc8cf77e4b4bc6a8aULL, 0xea207abd80450e66ULL, 0x06ad58320eab30e2ULL,
+        0x2442556b3a52540eULL, 0x437342806759f93aULL, 0x619c4fd953a09dd6ULL,
+        0xe1cf086db20aa550ULL, 0xc320053486f3c1bcULL, 0xa41112dfdbf86c88ULL,
+        0x86fe1f86ef010864ULL, 0x6a733d0961ef36e0ULL, 0x489c30505516520cULL,
+        0x2fad27bb081dff38ULL, 0x0d422ae23ce49bd4ULL, 0x646fcd8fbacf9cb5ULL,
+        0x4680c0d68e36f859ULL, 0x21b1d73dd33d556dULL, 0x035eda64e7c43181ULL,
+        0xefd3f8eb692a0f05ULL, 0xcd3cf5b25dd36be9ULL, 0xaa0de25900d8c6ddULL,
+        0x88e2ef003421a231ULL, 0x78562c820c8ec81fULL, 0x5ab921db3877acf3ULL,
+        0x3d883630657c01c7ULL, 0x1f673b695185652bULL, 0xf3ea19e6df6b5bafULL,
+        0xd10514bfeb923f43ULL, 0xb6340354b6999277ULL, 0x94db0e0d8260f69bULL,
+        0xfdf6e960044bf1faULL, 0xdf19e43930b29516ULL, 0xb828f3d26db93822ULL,
+        0x9ac7fe8b59405cceULL, 0x764adc04d7ae624aULL, 0x54a5d15de35706a6ULL,
+        0x3394c6b6be5cab92ULL, 0x117bcbef8aa5cf7eULL, 0x4025ee99600c614bULL,
+        0x62cae3c054f505a7ULL, 0x05fbf42b09fea893ULL, 0x2714f9723d07cc7fULL,
+        0xcb99dbfdb3e9f2fbULL, 0xe976d6a487109617ULL, 0x8e47c14fda1b3b23ULL,
+        0xaca8cc16eee25fcfULL, 0xc5852b7b68c958aeULL, 0xe76a26225c303c42ULL,
+        0x805b31c9013b9176ULL, 0xa2b43c9035c2f59aULL, 0x4e391e1fbb2ccb1eULL,
+        0x6cd613468fd5aff2ULL, 0x0be704add2de02c6ULL, 0x290809f4e627662aULL,
+        0xd9bcca76de880c04ULL, 0xfb53c72fea7168e8ULL, 0x9c62d0c4b77ac5dcULL,
+        0xbe8ddd9d8383a130ULL, 0x5200ff120d6d9fb4ULL, 0x70eff24b3994fb58ULL,
+        0x17dee5a0649f566cULL, 0x3531e8f950663280ULL, 0x5c1c0f94d64d35e1ULL,
+        0x7ef302cde2b4510dULL, 0x19c21526bfbffc39ULL, 0x3b2d187f8b4698d5ULL,
+        0xd7a03af005a8a651ULL, 0xf54f37a93151c2bdULL, 0x927e20426c5a6f89ULL,
+        0xb0912d1b58a30b65ULL
+    },
+    {
+        0x0000000000000000ULL, 0xdabe95afc7875f40ULL, 0x27a584742000a005ULL,
+        0xfd1b11dbe787ff45ULL, 0x4f4b08e84001400aULL, 0x95f59d4787861f4aULL,
+        0x68ee8c9c6001e00fULL, 0xb2501933a786bf4fULL, 0x9e9611d080028014ULL,
+        0x4428847f4785df54ULL, 0xb93395a4a0022011ULL, 0x638d000b67857f51ULL,
+        0xd1dd1938c003c01eULL, 0x0b638c9707849f5eULL, 0xf6789d4ce003601bULL,
+        0x2cc608e327843f5bULL, 0xaff48c8aaf0b1eadULL, 0x754a1925688c41edULL,
+        0x885108fe8f0bbea8ULL, 0x52ef9d51488ce1e8ULL, 0xe0bf8462ef0a5ea7ULL,
+        0x3a0111cd288d01e7ULL, 0xc71a0016cf0afea2ULL, 0x1da495b9088da1e2ULL,
+        0x31629d5a2f099eb9ULL, 0xebdc08f5e88ec1f9ULL, 0x16c7192e0f093ebcULL,
+        0xcc798c81c88e61fcULL, 0x7e2995b26f08deb3ULL, 0xa497001da88f81f3ULL,
+        0x598c11c64f087eb6ULL, 0x83328469888f21f6ULL, 0xcd31b63ef11823dfULL,
+        0x178f2391369f7c9fULL, 0xea94324ad11883daULL, 0x302aa7e5169fdc9aULL,
+        0x827abed6b11963d5ULL, 0x58c42b79769e3c95ULL, 0xa5df3aa29119c3d0ULL,
+        0x7f61af0d569e9c90ULL, 0x53a7a7ee711aa3cbULL, 0x89193241b69dfc8bULL,
+        0x7402239a511a03ceULL, 0xaebcb635969d5c8eULL, 0x1cecaf06311be3c1ULL,
+        0xc6523aa9f69cbc81ULL, 0x3b492b72111b43c4ULL, 0xe1f7beddd69c1c84ULL,
+        0x62c53ab45e133d72ULL, 0xb87baf1b99946232ULL, 0x4560bec07e139d77ULL,
+        0x9fde2b6fb994c237ULL, 0x2d8e325c1e127d78ULL, 0xf730a7f3d9952238ULL,
+        0x0a2bb6283e12dd7dULL, 0xd0952387f995823dULL, 0xfc532b64de11bd66ULL,
+        0x26edbecb1996e226ULL, 0xdbf6af10fe111d63ULL, 0x01483abf39964223ULL,
+        0xb318238c9e10fd6cULL, 0x69a6b6235997a22cULL, 0x94bda7f8be105d69ULL,
+        0x4e03325779970229ULL, 0x08bbc3564d3e593bULL, 0xd20556f98ab9067bULL,
+        0x2f1e47226d3ef93eULL, 0xf5a0d28daab9a67eULL, 0x47f0cbbe0d3f1931ULL,
+        0x9d4e5e11cab84671ULL, 0x60554fca2d3fb934ULL, 0xbaebda65eab8e674ULL,
+        0x962dd286cd3cd92fULL, 0x4c9347290abb866fULL, 0xb18856f2ed3c792aULL,
+        0x6b36c35d2abb266aULL, 0xd966da6e8d3d9925ULL, 0x03d84fc14abac665ULL,
+        0xfec35e1aad3d3920ULL, 0x247dcbb56aba6660ULL, 0xa74f4fdce2354796ULL,
+        0x7df1da7325b218d6ULL, 0x80eacba8c235e793ULL, 0x5a545e0705b2b8d3ULL,
+        0xe8044734a234079cULL, 0x32bad29b65b358dcULL, 0xcfa1c3408234a799ULL,
+        0x151f56ef45b3f8d9ULL, 0x39d95e0c6237c782ULL, 0xe367cba3a5b098c2ULL,
+        0x1e7cda7842376787ULL, 0xc4c24fd785b038c7ULL, 0x769256e422368788ULL,
+        0xac2cc34be5b1d8c8ULL, 0x5137d2900236278dULL, 0x8b89473fc5b178cdULL,
+        0xc58a7568bc267ae4ULL, 0x1f34e0c77ba125a4ULL, 0xe22ff11c9c26dae1ULL,
+        0x389164b35ba185a1ULL, 0x8ac17d80fc273aeeULL, 0x507fe82f3ba065aeULL,
+        0xad64f9f4dc279aebULL, 0x77da6c5b1ba0c5abULL, 0x5b1c64b83c24faf0ULL,
+        0x81a2f117fba3a5b0ULL, 0x7cb9e0cc1c245af5ULL, 0xa6077563dba305b5ULL,
+        0x14576c507c25bafaULL, 0xcee9f9ffbba2e5baULL, 0x33f2e8245c251affULL,
+        0xe94c7d8b9ba245bfULL, 0x6a7ef9e2132d6449ULL, 0xb0c06c4dd4aa3b09ULL,
+        0x4ddb7d96332dc44cULL, 0x9765e839f4aa9b0cULL, 0x2535f10a532c2443ULL,
+        0xff8b64a594ab7b03ULL, 0x0290757e732c8446ULL, 0xd82ee0d1b4abdb06ULL,
+        0xf4e8e832932fe45dULL, 0x2e567d9d54a8bb1dULL, 0xd34d6c46b32f4458ULL,
+        0x09f3f9e974a81b18ULL, 0xbba3e0dad32ea457ULL, 0x611d757514a9fb17ULL,
+        0x9c0664aef32e0452ULL, 0x46b8f10134a95b12ULL, 0x117786ac9a7cb276ULL,
+        0xcbc913035dfbed36ULL, 0x36d202d8ba7c1273ULL, 0xec6c97777dfb4d33ULL,
+        0x5e3c8e44da7df27cULL, 0x84821beb1dfaad3cULL, 0x79990a30fa7d5279ULL,
+        0xa3279f9f3dfa0d39ULL, 0x8fe1977c1a7e3262ULL, 0x555f02d3ddf96d22ULL,
+        0xa84413083a7e9267ULL, 0x72fa86a7fdf9cd27ULL, 0xc0aa9f945a7f7268ULL,
+        0x1a140a3b9df82d28ULL, 0xe70f1be07a7fd26dULL, 0x3db18e4fbdf88d2dULL,
+        0xbe830a263577acdbULL, 0x643d9f89f2f0f39bULL, 0x99268e5215770cdeULL,
+        0x43981bfdd2f0539eULL, 0xf1c802ce7576ecd1ULL, 0x2b769761b2f1b391ULL,
+        0xd66d86ba55764cd4ULL, 0x0cd3131592f11394ULL, 0x20151bf6b5752ccfULL,
+        0xfaab8e5972f2738fULL, 0x07b09f8295758ccaULL, 0xdd0e0a2d52f2d38aULL,
+        0x6f5e131ef5746cc5ULL, 0xb5e086b132f33385ULL, 0x48fb976ad574ccc0ULL,
+        0x924502c512f39380ULL, 0xdc4630926b6491a9ULL, 0x06f8a53dace3cee9ULL,
+        0xfbe3b4e64b6431acULL, 0x215d21498ce36eecULL, 0x930d387a2b65d1a3ULL,
+        0x49b3add5ece28ee3ULL, 0xb4a8bc0e0b6571a6ULL, 0x6e1629a1cce22ee6ULL,
+        0x42d02142eb6611bdULL, 0x986eb4ed2ce14efdULL, 0x6575a536cb66b1b8ULL,
+        0xbfcb30990ce1eef8ULL, 0x0d9b29aaab6751b7ULL, 0xd725bc056ce00ef7ULL,
+        0x2a3eadde8b67f1b2ULL, 0xf08038714ce0aef2ULL, 0x73b2bc18c46f8f04ULL,
+        0xa90c29b703e8d044ULL, 0x5417386ce46f2f01ULL, 0x8ea9adc323e87041ULL,
+        0x3cf9b4f0846ecf0eULL, 0xe647215f43e9904eULL, 0x1b5c3084a46e6f0bULL,
+        0xc1e2a52b63e9304bULL, 0xed24adc8446d0f10ULL, 0x379a386783ea5050ULL,
+        0xca8129bc646daf15ULL, 0x103fbc13a3eaf055ULL, 0xa26fa520046c4f1aULL,
+        0x78d1308fc3eb105aULL, 0x85ca2154246cef1fULL, 0x5f74b4fbe3ebb05fULL,
+        0x19cc45fad742eb4dULL, 0xc372d05510c5b40dULL, 0x3e69c18ef7424b48ULL,
+        0xe4d7542130c51408ULL, 0x56874d129743ab47ULL, 0x8c39d8bd50c4f407ULL,
+        0x7122c966b7430b42ULL, 0xab9c5cc970c45402ULL, 0x875a542a57406b59ULL,
+        0x5de4c18590c73419ULL, 0xa0ffd05e7740cb5cULL, 0x7a4145f1b0c7941cULL,
+        0xc8115cc217412b53ULL, 0x12afc96dd0c67413ULL, 0xefb4d8b637418b56ULL,
+        0x350a4d19f0c6d416ULL, 0xb638c9707849f5e0ULL, 0x6c865cdfbfceaaa0ULL,
+        0x919d4d04584955e5ULL, 0x4b23d8ab9fce0aa5ULL, 0xf973c1983848b5eaULL,
+        0x23cd5437ffcfeaaaULL, 0xded645ec184815efULL, 0x0468d043dfcf4aafULL,
+        0x28aed8a0f84b75f4ULL, 0xf2104d0f3fcc2ab4ULL, 0x0f0b5cd4d84bd5f1ULL,
+        0xd5b5c97b1fcc8ab1ULL, 0x67e5d048b84a35feULL, 0xbd5b45e77fcd6abeULL,
+        0x4040543c984a95fbULL, 0x9afec1935fcdcabbULL, 0xd4fdf3c4265ac892ULL,
+        0x0e43666be1dd97d2ULL, 0xf35877b0065a6897ULL, 0x29e6e21fc1dd37d7ULL,
+        0x9bb6fb2c665b8898ULL, 0x41086e83a1dcd7d8ULL, 0xbc137f58465b289dULL,
+        0x66adeaf781dc77ddULL, 0x4a6be214a6584886ULL, 0x90d577bb61df17c6ULL,
+        0x6dce66608658e883ULL, 0xb770f3cf41dfb7c3ULL, 0x0520eafce659088cULL,
+        0xdf9e7f5321de57ccULL, 0x22856e88c659a889ULL, 0xf83bfb2701def7c9ULL,
+        0x7b097f4e8951d63fULL, 0xa1b7eae14ed6897fULL, 0x5cacfb3aa951763aULL,
+        0x86126e956ed6297aULL, 0x344277a6c9509635ULL, 0xeefce2090ed7c975ULL,
+        0x13e7f3d2e9503630ULL, 0xc959667d2ed76970ULL, 0xe59f6e9e0953562bULL,
+        0x3f21fb31ced4096bULL, 0xc23aeaea2953f62eULL, 0x18847f45eed4a96eULL,
+        0xaad4667649521621ULL, 0x706af3d98ed54961ULL, 0x8d71e2026952b624ULL,
+        0x57cf77adaed5e964ULL
+    }
+};
+
+static const bsl::size_t k_FOLDING_THRESHOLD = 64;
+    // The minimum length of a buffer to be processed using carry-less
+    // multiplication.
+
+static
+bsls::Types::Uint64 updateSlicing(bsls::Types::Uint64  crc,
+                                  const unsigned char *data,
+                                  bsl::size_t          length)
+    // Return the CRC register resulting from processing the specified
+    // 'length' bytes of the specified 'data' starting with the specified 'crc'
+    // register, using the slicing-by-8 technique.
+{
+    typedef bsls::Types::Uint64 Uint64;
+
+    for (; length >= 8; length -= 8, data += 8) {
+        const Uint64 word = crc
+                          ^  static_cast<Uint64>(data[0])
+                          ^ (static_cast<Uint64>(data[1]) <<  8)
+                          ^ (static_cast<Uint64>(data[2]) << 16)
+                          ^ (static_cast<Uint64>(data[3]) << 24)
+                          ^ (static_cast<Uint64>(data[4]) << 32)
+                          ^ (static_cast<Uint64>(data[5]) << 40)
+                          ^ (static_cast<Uint64>(data[6]) << 48)
+                          ^ (static_cast<Uint64>(data[7]) << 56);
+
+        crc = CRC_SLICE_TABLES[6][ word        & 0xff]
+            ^ CRC_SLICE_TABLES[5][(word >>  8) & 0xff]
+            ^ CRC_SLICE_TABLES[4][(word >> 16) & 0xff]
+            ^ CRC_SLICE_TABLES[3][(word >> 24) & 0xff]
+            ^ CRC_SLICE_TABLES[2][(word >> 32) & 0xff]
+            ^ CRC_SLICE_TABLES[1][(word >> 40) & 0xff]
+            ^ CRC_SLICE_TABLES[0][(word >> 48) & 0xff]
+            ^ CRC_TABLE[           word >> 56        ];
+    }
+
+    for (; length; --length) {
+        crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#if defined(BDLDE_CRC64_PCLMUL)
+
+#define BDLDE_CRC64_PCLMUL_TARGET __attribute__((target("pclmul")))
+    // Enable the 'PCLMULQDQ' instruction in the annotated function, which
+    // must be invoked only if the running CPU supports it.
+
+BDLDE_CRC64_PCLMUL_TARGET
+static inline
+__m128i fold128(__m128i value, __m128i constants, __m128i next)
+    // Return the sum (XOR) of the specified 'next' 128 bits of a message and
+    // the specified 'value' 128 bits preceding them, folded forward using the
+    // specified 'constants'.  The low and high 64 bits of 'constants' must
+    // hold the bit-reflected values of 'x^(D + 63)' and 'x^(D - 1)' modulo
+    // the generator polynomial, respectively, where 'D' is the distance, in
+    // bits, between 'value' and 'next' in the message.
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value,
+                                                             constants,
+                                                             0x00),
+                                       _mm_clmulepi64_si128(value,
+                                                             constants,
+                                                             0x11)),
+                         next);
+}
+
+BDLDE_CRC64_PCLMUL_TARGET
+static
+bsls::Types::Uint64 updateFolding(bsls::Types::Uint64  crc,
+                                  const unsigned char *data,
+                                  bsl::size_t          length)
+    // Return the CRC register resulting from processing the specified
+    // 'length' bytes of the specified 'data' starting with the specified 'crc'
+    // register, using carry-less multiplication.  The behavior is undefined
+    // unless '64 <= length' and the running CPU supports the 'PCLMULQDQ'
+    // instruction.
+{
+    const __m128i k_FOLD_512 = _mm_set_epi64x(0x081f6054a7842df4LL,
+                                              0x6ae3efbb9dd441f3LL);
+    const __m128i k_FOLD_128 = _mm_set_epi64x(0xdabe95afc7875f40LL,
+                                              0xe05dd497ca393ae4LL);
+
+    const __m128i *block = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(block),
+                               _mm_cvtsi64_si128(static_cast<long long>(crc)));
+    __m128i x1 = _mm_loadu_si128(block + 1);
+    __m128i x2 = _mm_loadu_si128(block + 2);
+    __m128i x3 = _mm_loadu_si128(block + 3);
+
+    block  += 4;
+    length -= 64;
+
+    for (; length >= 64; length -= 64, block += 4) {
+        x0 = fold128(x0, k_FOLD_512, _mm_loadu_si128(block));
+        x1 = fold128(x1, k_FOLD_512, _mm_loadu_si128(block + 1));
+        x2 = fold128(x2, k_FOLD_512, _mm_loadu_si128(block + 2));
+        x3 = fold128(x3, k_FOLD_512, _mm_loadu_si128(block + 3));
+    }
+
+    x0 = fold128(x0, k_FOLD_128, x1);
+    x0 = fold128(x0, k_FOLD_128, x2);
+    x0 = fold128(x0, k_FOLD_128, x3);
+
+    for (; length >= 16; length -= 16, ++block) {
+        x0 = fold128(x0, k_FOLD_128, _mm_loadu_si128(block));
+    }
+
+    // The folded 128 bits already include the initial register value, so
+    // their CRC register is computed starting with a zero register.
+
+    unsigned char folded[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(folded), x0);
+
+    return updateSlicing(updateSlicing(0, folded, sizeof folded),
+                         reinterpret_cast<const unsigned char *>(block),
+                         length);
+}
+
+static const bool s_isFoldingAvailable = bdlde::CpuFeatures::hasPclmulqdq();
+    // Note that 's_isFoldingAvailable' is 'false' (and the slicing-by-8
+    // implementation is used) if 'update' is called during static
+    // initialization before this variable is initialized.
+
+#endif  // BDLDE_CRC64_PCLMUL
+
 namespace bdlde {
                                 // -----------
                                 // class Crc64
@@ -284,48 +1052,16 @@ void Crc64::update(const void *data, bsl::size_t length)
 {
     BSLS_ASSERT(data || !length);
 
-    const unsigned char *d = (const unsigned char *)data;
-    bsls::Types::Uint64 tmp = d_crc;
-
-    switch (length % 8) {
-      case 7:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 6:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 5:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 4:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 3:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 2:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 1:
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        BSLS_ANNOTATION_FALLTHROUGH;
-      case 0: ;
-    }
+    const unsigned char *d = static_cast<const unsigned char *>(data);
 
-    bsl::size_t n = length / 8;
-    while (n) {
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        --n;
+#if defined(BDLDE_CRC64_PCLMUL)
+    if (length >= k_FOLDING_THRESHOLD && s_isFoldingAvailable) {
+        d_crc = updateFolding(d_crc, d, length);
+        return;                                                       // RETURN
     }
+#endif
 
-    d_crc = tmp;
+    d_crc = updateSlicing(d_crc, d, length);
 }
 
 // ACCESSORS
@@ -10,6 +10,7 @@
 #include <bsl_algorithm.h>   // sort()
 #include <bsl_cstdlib.h>     // atoi()
 #include <bsl_cstring.h>     // atoi()
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_vector.h>
@@ -89,10 +90,12 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] void update(const void *data, int length);  // large buffers
 // [-1] PERFORMANCE TEST
+// [-2] THROUGHPUT TEST
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc64& gg(bdlde::Crc64 *object, const char *spec);
@@ -484,7 +487,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -514,6 +517,103 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'update' ON LARGE BUFFERS
+        //
+        // Concerns:
+        //: 1 'update' computes the same checksum as the oracle for buffers of
+        //:   any length, including buffers long enough to be processed by the
+        //:   carry-less multiplication ('PCLMULQDQ') implementation, if
+        //:   available, and buffers whose length is not a multiple of the
+        //:   block size of either implementation.
+        //:
+        //: 2 The checksum does not depend on the alignment of the data.
+        //:
+        //: 3 The checksum does not depend on how the data is split among
+        //:   calls to 'update'.
+        //
+        // Plan:
+        //: 1 Fill a buffer with pseudo-random bytes.  For each length in the
+        //:   range '[0 .. 1100]' and a few larger lengths, and for each of 16
+        //:   offsets into the buffer, verify that 'update' computes the same
+        //:   checksum as the oracle 'crc'.  (C-1..2)
+        //:
+        //: 2 For a selection of lengths and split points, call 'update' on
+        //:   both parts of the data and verify that the checksum is the same
+        //:   as the oracle 'crc' of the entire data.  (C-3)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'update' ON LARGE BUFFERS"
+                          << "\n=================================" << endl;
+
+        const int MAX_LENGTH = (1 << 20) + 64;
+
+        bsl::vector<char> buffer(MAX_LENGTH + 16);
+        unsigned int      seed = 0x12345678;
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\tCompare with the oracle." << endl;
+
+        for (int length = 0; length <= 1100; ++length) {
+            for (int offset = 0; offset < 16; ++offset) {
+                const char *DATA = &buffer[offset];
+
+                Obj mX;  const Obj& X = mX;
+                mX.update(DATA, length);
+
+                LOOP2_ASSERT(length, offset,
+                             crc(DATA, length) == X.checksum());
+            }
+        }
+
+        static const int LENGTHS[] = {
+            4096, 4097, 4111, 65536 + 13, 1 << 20, MAX_LENGTH - 1
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            for (int offset = 0; offset < 4; ++offset) {
+                const char *DATA = &buffer[offset];
+
+                Obj mX;  const Obj& X = mX;
+                mX.update(DATA, LENGTH);
+
+                LOOP2_ASSERT(LENGTH, offset,
+                             crc(DATA, LENGTH) == X.checksum());
+            }
+        }
+
+        if (verbose) cout << "\tSplit the data among calls." << endl;
+
+        static const int SPLIT_LENGTHS[] = { 255, 256, 257, 1000, 4099 };
+        const int NUM_SPLIT_LENGTHS = sizeof SPLIT_LENGTHS
+                                    / sizeof *SPLIT_LENGTHS;
+
+        for (int ti = 0; ti < NUM_SPLIT_LENGTHS; ++ti) {
+            const int   LENGTH = SPLIT_LENGTHS[ti];
+            const char *DATA   = &buffer[3];
+
+            const bsls::Types::Uint64 EXP = crc(DATA, LENGTH);
+
+            for (int split = 0; split <= LENGTH; ++split) {
+                Obj mX;  const Obj& X = mX;
+                mX.update(DATA, split);
+                mX.update(DATA + split, LENGTH - split);
+
+                LOOP2_ASSERT(LENGTH, split, EXP == X.checksum());
+            }
+        }
+
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2658,6 +2758,72 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 We want to measure the throughput of the 'update' method over a
+        //:   range of buffer sizes, compared with the byte-at-a-time oracle.
+        //
+        // Plan:
+        //: 1 For buffer sizes from 64 bytes to 16MB, repeatedly checksum the
+        //:   buffer using 'update' and the oracle 'update_crc', processing
+        //:   about 1GB of data with 'update' (and 64MB with the oracle) for
+        //:   each size, and report the throughput in GB/s.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST"
+                          << "\n===============" << endl;
+
+        const int MAX_LENGTH = 16 * 1024 * 1024;
+
+        bsl::vector<char> buffer(MAX_LENGTH);
+        for (int i = 0; i < MAX_LENGTH; ++i) {
+            buffer[i] = static_cast<char>(i * 7 + (i >> 8));
+        }
+
+        const double GB = 1024.0 * 1024.0 * 1024.0;
+
+        cout << "      size   update (GB/s)   oracle (GB/s)" << endl;
+
+        for (int length = 64; length <= MAX_LENGTH; length *= 4) {
+            const int ITERATIONS = static_cast<int>(GB / length);
+
+            bsls::Types::Uint64 sum = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                Obj mX(buffer.data(), length);
+                sum ^= mX.checksum();
+            }
+            timer.stop();
+            const double updateRate = ITERATIONS * double(length)
+                                    / GB / timer.elapsedTime();
+
+            const int ORACLE_ITERATIONS = ITERATIONS / 16 + 1;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ORACLE_ITERATIONS; ++i) {
+                sum ^= update_crc(0, buffer.data(), length);
+            }
+            timer.stop();
+            const double oracleRate = ORACLE_ITERATIONS * double(length)
+                                    / GB / timer.elapsedTime();
+
+            cout << setw(10) << length
+                 << setw(16) << updateRate
+                 << setw(16) << oracleRate << endl;
+
+            if (veryVerbose) { P(sum); }
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
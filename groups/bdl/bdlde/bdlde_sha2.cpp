@@ -1,10 +1,59 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bdlde_cpufeatures.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+///IMPLEMENTATION NOTES
+///--------------------
+// The SHA-256 and SHA-512 block functions have a portable implementation and,
+// where the compiler and the running CPU support them, implementations using
+// the x86 SHA extensions ('SHA256RNDS2', 'SHA256MSG1', and 'SHA256MSG2') and
+// the ARMv8 cryptographic extensions ('SHA256H', 'SHA256H2', 'SHA256SU0',
+// 'SHA256SU1' and, from ARMv8.2, the corresponding 'SHA512' instructions).
+// The implementation used is selected once, when this component is
+// initialized, by querying the CPU.
+//
+// The multi-buffer function 'loadDigests' additionally has an AVX2
+// implementation that runs the portable algorithm on 8 independent messages
+// at once, each message occupying one 32-bit element of every vector.  The
+// first 64 bytes of the 8 current blocks are loaded as 16 vectors and
+// transposed so that each vector holds the same message word of every
+// message.  This implementation is used only if no dedicated SHA
+// instructions are available, as those process a single message faster than
+// the AVX2 implementation processes 8.  With the x86 SHA extensions,
+// 'loadDigests' instead hashes the messages in pairs, interleaving the blocks
+// of the two messages to hide the latency of the 'SHA256RNDS2' instruction.
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_SHA2_X86
+#include <immintrin.h>
+#endif
+#endif
+
+// Note that 'bsls_platform' does not (yet) identify the 64-bit ARM
+// architecture, so we rely on the compiler-defined macro.
+#if defined(__aarch64__)
+#if defined(BSLS_PLATFORM_CMP_CLANG) ||                                       \
+   (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 60000)
+#define BDLDE_SHA2_ARMV8
+#include <arm_neon.h>
+#if defined(BSLS_PLATFORM_CMP_CLANG) || BSLS_PLATFORM_CMP_VERSION >= 80000
+#define BDLDE_SHA2_ARMV8_SHA512
+#endif
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <sys/auxv.h>
+#endif
+#endif
+#endif
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -196,12 +245,24 @@ const bsl::uint64_t sha512Constants[80] =
              0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
+// Second 32 bits of the fractional parts of the square root of the 9th through
+// 16th primes.
+const bsl::uint32_t sha224InitialState[8] =
+            {0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+             0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4};
+
+// First 32 bits of the fractional part of the square root of the first 8
+// primes.
+const bsl::uint32_t sha256InitialState[8] =
+            {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
-               const unsigned char *message,
-               bsl::uint64_t        numberOfBuffers,
-               bsl::uint64_t        bufferSize,
-               const INTEGER      (&constants)[ARRAY_SIZE])
+void transformScalar(INTEGER             *state,
+                     const unsigned char *message,
+                     bsl::uint64_t        numberOfBuffers,
+                     bsl::uint64_t        bufferSize,
+                     const INTEGER      (&constants)[ARRAY_SIZE])
     // Update the specified 'state' with the hashed contents of the specified
     // 'message' having a length equal to the specified 'bufferSize' times the
     // specified 'numberOfBuffers', mixing it with the values in the specified
@@ -247,6 +308,971 @@ void transform(INTEGER             *state,
     }
 }
 
+void loadFinalBlocks256(unsigned char        (&finalBlocks)[128],
+                        bsl::size_t          *numFinalBlocks,
+                        const unsigned char  *tail,
+                        bsl::size_t           tailSize,
+                        bsl::uint64_t         totalSize)
+    // Load into the specified 'finalBlocks' the specified 'tail' having the
+    // specified 'tailSize' (less than 64) bytes, followed by the SHA-256
+    // padding of a message having the specified 'totalSize' bytes, and load
+    // into the specified 'numFinalBlocks' the number (1 or 2) of 64-byte
+    // blocks so populated.
+{
+    bsl::fill(finalBlocks, finalBlocks + 128, static_cast<unsigned char>(0));
+    bsl::copy(tail, tail + tailSize, finalBlocks);
+    finalBlocks[tailSize] = 1 << 7;
+    *numFinalBlocks = tailSize + 1 + 8 <= 64 ? 1 : 2;
+    unpack(totalSize * 8, finalBlocks + *numFinalBlocks * 64 - 8);
+}
+
+void storeDigest256(unsigned char       *result,
+                    bsl::size_t          digestSize,
+                    const bsl::uint32_t *state)
+    // Store into the specified 'result' the first specified 'digestSize'
+    // bytes of the big-endian representation of the specified 'state'.
+{
+    for (bsl::size_t index = 0; index != digestSize / 4; ++index) {
+        unpack(state[index], result + index * 4);
+    }
+}
+
+#ifdef BDLDE_SHA2_X86
+
+                        // ---------------------
+                        // SHA-NI Implementation
+                        // ---------------------
+
+#define BDLDE_SHA2_SHANI_TARGET __attribute__((target("sha,ssse3,sse4.1")))
+    // Enable the SHA, SSSE3, and SSE4.1 instructions in the annotated
+    // function, which must be invoked only if the running CPU supports them.
+
+#define BDLDE_SHA2_AVX2_TARGET __attribute__((target("avx2")))
+    // Enable the AVX2 instructions in the annotated function, which must be
+    // invoked only if the running CPU (and operating system) supports them.
+
+BDLDE_SHA2_SHANI_TARGET
+inline
+__m128i nextWordsShaNi(__m128i w0, __m128i w1, __m128i w2, __m128i w3)
+    // Return the 4 message schedule words following the 16 words held, in
+    // order, by the specified 'w0', 'w1', 'w2', and 'w3'.
+{
+    return _mm_sha256msg2_epu32(
+                          _mm_add_epi32(_mm_sha256msg1_epu32(w0, w1),
+                                        _mm_alignr_epi8(w3, w2, 4)),
+                          w3);
+}
+
+BDLDE_SHA2_SHANI_TARGET
+inline
+void roundsShaNi(__m128i *abef, __m128i *cdgh, __m128i words, int index)
+    // Perform the 4 SHA-256 rounds starting at the specified 'index' on the
+    // working variables held in the specified 'abef' and 'cdgh' using the
+    // specified message schedule 'words'.
+{
+    const __m128i kw = _mm_add_epi32(
+                        words,
+                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                   sha256Constants + index)));
+
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, kw);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, _mm_shuffle_epi32(kw, 0x0E));
+}
+
+BDLDE_SHA2_SHANI_TARGET
+inline
+void loadStateShaNi(__m128i *abef, __m128i *cdgh, const bsl::uint32_t *state)
+    // Load the specified 8-word 'state' into the specified 'abef' and 'cdgh'
+    // in the layout expected by the 'SHA256RNDS2' instruction, i.e., with the
+    // working variables 'A', 'B', 'E', and 'F' (from the most significant
+    // element) in 'abef', and 'C', 'D', 'G', and 'H' in 'cdgh'.
+{
+    const __m128i *words = reinterpret_cast<const __m128i *>(state);
+    const __m128i  cdab  = _mm_shuffle_epi32(_mm_loadu_si128(words),     0xB1);
+    const __m128i  efgh  = _mm_shuffle_epi32(_mm_loadu_si128(words + 1), 0x1B);
+
+    *abef = _mm_alignr_epi8(cdab, efgh, 8);
+    *cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+}
+
+BDLDE_SHA2_SHANI_TARGET
+inline
+void storeStateShaNi(bsl::uint32_t *state, __m128i abef, __m128i cdgh)
+    // Store into the specified 8-word 'state' the working variables held in
+    // the specified 'abef' and 'cdgh' (see 'loadStateShaNi').
+{
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+
+BDLDE_SHA2_SHANI_TARGET
+inline
+void blockShaNi(__m128i *abef, __m128i *cdgh, const unsigned char *message)
+    // Update the working variables held in the specified 'abef' and 'cdgh'
+    // (see 'loadStateShaNi') with the hashed contents of the 64-byte block at
+    // the specified 'message' address.
+{
+    const __m128i swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                        0x0405060700010203ULL);
+
+    const __m128i  abefSaved = *abef;
+    const __m128i  cdghSaved = *cdgh;
+    const __m128i *block     = reinterpret_cast<const __m128i *>(message);
+
+    __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(block + 0), swap);
+    __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(block + 1), swap);
+    __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(block + 2), swap);
+    __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(block + 3), swap);
+
+    roundsShaNi(abef, cdgh, w0,  0);
+    roundsShaNi(abef, cdgh, w1,  4);
+    roundsShaNi(abef, cdgh, w2,  8);
+    roundsShaNi(abef, cdgh, w3, 12);
+
+    for (int index = 16; index != 64; index += 16) {
+        w0 = nextWordsShaNi(w0, w1, w2, w3);
+        roundsShaNi(abef, cdgh, w0, index);
+        w1 = nextWordsShaNi(w1, w2, w3, w0);
+        roundsShaNi(abef, cdgh, w1, index + 4);
+        w2 = nextWordsShaNi(w2, w3, w0, w1);
+        roundsShaNi(abef, cdgh, w2, index + 8);
+        w3 = nextWordsShaNi(w3, w0, w1, w2);
+        roundsShaNi(abef, cdgh, w3, index + 12);
+    }
+
+    *abef = _mm_add_epi32(*abef, abefSaved);
+    *cdgh = _mm_add_epi32(*cdgh, cdghSaved);
+}
+
+BDLDE_SHA2_SHANI_TARGET
+void transformShaNi(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::size_t          numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 64-byte blocks at the specified 'message' address using the
+    // x86 SHA extensions.
+{
+    __m128i abef, cdgh;
+    loadStateShaNi(&abef, &cdgh, state);
+
+    for (; numBlocks; --numBlocks, message += 64) {
+        blockShaNi(&abef, &cdgh, message);
+    }
+
+    storeStateShaNi(state, abef, cdgh);
+}
+
+BDLDE_SHA2_SHANI_TARGET
+void transformShaNi(bsl::uint32_t       *state0,
+                    const unsigned char *message0,
+                    bsl::uint32_t       *state1,
+                    const unsigned char *message1,
+                    bsl::size_t          numBlocks)
+    // Update the specified 'state0' and 'state1' with the hashed contents of
+    // the specified 'numBlocks' 64-byte blocks at the specified 'message0'
+    // and 'message1' addresses, respectively, using the x86 SHA extensions.
+    // Note that, as each 'SHA256RNDS2' instruction depends on the result of
+    // the previous one, hashing two independent messages in the same loop
+    // hides much of the latency of that instruction.
+{
+    __m128i abef0, cdgh0, abef1, cdgh1;
+    loadStateShaNi(&abef0, &cdgh0, state0);
+    loadStateShaNi(&abef1, &cdgh1, state1);
+
+    for (; numBlocks; --numBlocks, message0 += 64, message1 += 64) {
+        blockShaNi(&abef0, &cdgh0, message0);
+        blockShaNi(&abef1, &cdgh1, message1);
+    }
+
+    storeStateShaNi(state0, abef0, cdgh0);
+    storeStateShaNi(state1, abef1, cdgh1);
+}
+
+                        // -------------------------------
+                        // AVX2 Multi-Buffer Implementation
+                        // -------------------------------
+
+BDLDE_SHA2_AVX2_TARGET
+inline
+__m256i rotateRight8x(__m256i value, int shift)
+    // Return the specified 'value' with each of its 32-bit elements rotated
+    // right by the specified 'shift' bits.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+BDLDE_SHA2_AVX2_TARGET
+inline
+void roundAvx2(__m256i  a,
+               __m256i  b,
+               __m256i  c,
+               __m256i *d,
+               __m256i  e,
+               __m256i  f,
+               __m256i  g,
+               __m256i *h,
+               __m256i  word,
+               int      index)
+    // Perform the SHA-256 round having the specified 'index' on the working
+    // variables 'a' through 'h' of 8 independent messages (one per 32-bit
+    // element) using the specified message schedule 'word'.  Note that the
+    // caller rotates the roles of the working variables between rounds, so
+    // that only 'd' and 'h' are modified.
+{
+    const __m256i t1 = _mm256_add_epi32(
+            _mm256_add_epi32(*h,
+                             _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8x(e, 6),
+                                                  rotateRight8x(e, 11)),
+                                 rotateRight8x(e, 25))),
+            _mm256_add_epi32(
+                _mm256_xor_si256(_mm256_and_si256(e, f),
+                                 _mm256_andnot_si256(e, g)),
+                _mm256_add_epi32(
+                    word,
+                    _mm256_set1_epi32(static_cast<int>(
+                                                  sha256Constants[index])))));
+    const __m256i t2 = _mm256_add_epi32(
+            _mm256_xor_si256(_mm256_xor_si256(rotateRight8x(a, 2),
+                                              rotateRight8x(a, 13)),
+                             rotateRight8x(a, 22)),
+            _mm256_or_si256(_mm256_and_si256(a, b),
+                            _mm256_and_si256(c, _mm256_or_si256(a, b))));
+
+    *d = _mm256_add_epi32(*d, t1);
+    *h = _mm256_add_epi32(t1, t2);
+}
+
+BDLDE_SHA2_AVX2_TARGET
+inline
+void transposeAvx2(__m256i *rows)
+    // Transpose the 8x8 matrix of 32-bit elements held in the 8 vectors at
+    // the specified 'rows' address.
+{
+    const __m256i t0 = _mm256_unpacklo_epi32(rows[0], rows[1]);
+    const __m256i t1 = _mm256_unpackhi_epi32(rows[0], rows[1]);
+    const __m256i t2 = _mm256_unpacklo_epi32(rows[2], rows[3]);
+    const __m256i t3 = _mm256_unpackhi_epi32(rows[2], rows[3]);
+    const __m256i t4 = _mm256_unpacklo_epi32(rows[4], rows[5]);
+    const __m256i t5 = _mm256_unpackhi_epi32(rows[4], rows[5]);
+    const __m256i t6 = _mm256_unpacklo_epi32(rows[6], rows[7]);
+    const __m256i t7 = _mm256_unpackhi_epi32(rows[6], rows[7]);
+
+    const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+
+    rows[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    rows[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    rows[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    rows[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    rows[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    rows[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    rows[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    rows[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+BDLDE_SHA2_AVX2_TARGET
+void transformAvx2(bsl::uint32_t              (*state)[8],
+                   const unsigned char *const *blocks)
+    // Update the specified 'state', holding the 8 working variables of 8
+    // independent messages (such that 'state[i][j]' is the working variable
+    // 'i' of message 'j'), with the hashed contents of the 8 64-byte blocks
+    // at the addresses in the specified 'blocks' array.
+{
+    const __m256i swap = _mm256_setr_epi8( 3,  2,  1,  0,  7,  6,  5,  4,
+                                          11, 10,  9,  8, 15, 14, 13, 12,
+                                           3,  2,  1,  0,  7,  6,  5,  4,
+                                          11, 10,  9,  8, 15, 14, 13, 12);
+
+    __m256i w[16];
+    for (int half = 0; half != 2; ++half) {
+        __m256i *rows = w + half * 8;
+        for (int lane = 0; lane != 8; ++lane) {
+            rows[lane] = _mm256_loadu_si256(
+                  reinterpret_cast<const __m256i *>(blocks[lane] + half * 32));
+        }
+        transposeAvx2(rows);
+        for (int index = 0; index != 8; ++index) {
+            rows[index] = _mm256_shuffle_epi8(rows[index], swap);
+        }
+    }
+
+    __m256i v[8];
+    for (int index = 0; index != 8; ++index) {
+        v[index] = _mm256_loadu_si256(
+                              reinterpret_cast<const __m256i *>(state[index]));
+    }
+
+    __m256i a = v[0], b = v[1], c = v[2], d = v[3];
+    __m256i e = v[4], f = v[5], g = v[6], h = v[7];
+
+    for (int index = 0; index != 64; index += 8) {
+        __m256i *words = w + (index & 15);
+        if (16 <= index) {
+            for (int j = 0; j != 8; ++j) {
+                const int     t   = index + j;
+                const __m256i w2  = w[(t -  2) & 15];
+                const __m256i w15 = w[(t - 15) & 15];
+                const __m256i s1  = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight8x(w2, 17),
+                                                   rotateRight8x(w2, 19)),
+                                  _mm256_srli_epi32(w2, 10));
+                const __m256i s0  = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight8x(w15, 7),
+                                                   rotateRight8x(w15, 18)),
+                                  _mm256_srli_epi32(w15, 3));
+
+                words[j] = _mm256_add_epi32(
+                                  _mm256_add_epi32(words[j], s0),
+                                  _mm256_add_epi32(w[(t - 7) & 15], s1));
+            }
+        }
+
+        roundAvx2(a, b, c, &d, e, f, g, &h, words[0], index + 0);
+        roundAvx2(h, a, b, &c, d, e, f, &g, words[1], index + 1);
+        roundAvx2(g, h, a, &b, c, d, e, &f, words[2], index + 2);
+        roundAvx2(f, g, h, &a, b, c, d, &e, words[3], index + 3);
+        roundAvx2(e, f, g, &h, a, b, c, &d, words[4], index + 4);
+        roundAvx2(d, e, f, &g, h, a, b, &c, words[5], index + 5);
+        roundAvx2(c, d, e, &f, g, h, a, &b, words[6], index + 6);
+        roundAvx2(b, c, d, &e, f, g, h, &a, words[7], index + 7);
+    }
+
+    v[0] = _mm256_add_epi32(v[0], a);
+    v[1] = _mm256_add_epi32(v[1], b);
+    v[2] = _mm256_add_epi32(v[2], c);
+    v[3] = _mm256_add_epi32(v[3], d);
+    v[4] = _mm256_add_epi32(v[4], e);
+    v[5] = _mm256_add_epi32(v[5], f);
+    v[6] = _mm256_add_epi32(v[6], g);
+    v[7] = _mm256_add_epi32(v[7], h);
+
+    for (int index = 0; index != 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            v[index]);
+    }
+
+    _mm256_zeroupper();
+}
+
+bool isShaNiSupported()
+    // Return 'true' if the running CPU supports the x86 SHA extensions (and
+    // the SSSE3 and SSE4.1 instructions used with them), and 'false'
+    // otherwise.
+{
+    return CpuFeatures::hasSsse3()
+        && CpuFeatures::hasSse41()
+        && CpuFeatures::hasSha();
+}
+
+bool isAvx2Supported()
+    // Return 'true' if the running CPU and operating system support the AVX2
+    // instructions, and 'false' otherwise.
+{
+    return CpuFeatures::hasAvx2();
+}
+
+#else
+
+bool isShaNiSupported()
+    // Return 'true' if the running CPU supports the x86 SHA extensions, and
+    // 'false' otherwise.
+{
+    return false;
+}
+
+bool isAvx2Supported()
+    // Return 'true' if the running CPU and operating system support the AVX2
+    // instructions, and 'false' otherwise.
+{
+    return false;
+}
+
+#endif  // BDLDE_SHA2_X86
+
+#ifdef BDLDE_SHA2_ARMV8
+
+                        // --------------------
+                        // ARMv8 Implementation
+                        // --------------------
+
+#  if defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_SHA2_ARMV8_SHA256_TARGET __attribute__((target("crypto")))
+#define BDLDE_SHA2_ARMV8_SHA512_TARGET __attribute__((target("sha3")))
+#  else
+#define BDLDE_SHA2_ARMV8_SHA256_TARGET __attribute__((target("+crypto")))
+#define BDLDE_SHA2_ARMV8_SHA512_TARGET                                        \
+                                 __attribute__((target("arch=armv8.2-a+sha3")))
+#  endif
+    // 'BDLDE_SHA2_ARMV8_SHA256_TARGET' enables the ARMv8 SHA-256 instructions,
+    // and 'BDLDE_SHA2_ARMV8_SHA512_TARGET' the ARMv8.2 SHA-512 instructions,
+    // in the annotated function, which must be invoked only if the running
+    // CPU supports them.
+
+bool isArmv8Sha256Supported()
+    // Return 'true' if the running CPU supports the ARMv8 SHA-256
+    // instructions, and 'false' otherwise.
+{
+#  if defined(__ARM_FEATURE_SHA2)
+    // The target architecture mandates the SHA-256 instructions.
+
+    return true;
+#  elif defined(BSLS_PLATFORM_OS_LINUX)
+    const unsigned long k_HWCAP_SHA2 = 1UL << 6;
+        // 'HWCAP_SHA2' as defined by the Linux kernel for arm64
+
+    return 0 != (getauxval(AT_HWCAP) & k_HWCAP_SHA2);
+#  else
+    return false;
+#  endif
+}
+
+bool isArmv8Sha512Supported()
+    // Return 'true' if the running CPU supports the ARMv8.2 SHA-512
+    // instructions, and 'false' otherwise.
+{
+#  if !defined(BDLDE_SHA2_ARMV8_SHA512)
+    return false;
+#  elif defined(__ARM_FEATURE_SHA512)
+    // The target architecture mandates the SHA-512 instructions.
+
+    return true;
+#  elif defined(BSLS_PLATFORM_OS_LINUX)
+    const unsigned long k_HWCAP_SHA512 = 1UL << 21;
+        // 'HWCAP_SHA512' as defined by the Linux kernel for arm64
+
+    return 0 != (getauxval(AT_HWCAP) & k_HWCAP_SHA512);
+#  else
+    return false;
+#  endif
+}
+
+BDLDE_SHA2_ARMV8_SHA256_TARGET
+inline
+void roundsArmv8(uint32x4_t *abcd,
+                 uint32x4_t *efgh,
+                 uint32x4_t  words,
+                 int         index)
+    // Perform the 4 SHA-256 rounds starting at the specified 'index' on the
+    // working variables held in the specified 'abcd' and 'efgh' using the
+    // specified message schedule 'words'.
+{
+    const uint32x4_t kw   = vaddq_u32(words,
+                                      vld1q_u32(sha256Constants + index));
+    const uint32x4_t prev = *abcd;
+
+    *abcd = vsha256hq_u32(*abcd, *efgh, kw);
+    *efgh = vsha256h2q_u32(*efgh, prev, kw);
+}
+
+BDLDE_SHA2_ARMV8_SHA256_TARGET
+inline
+uint32x4_t nextWordsArmv8(uint32x4_t w0,
+                          uint32x4_t w1,
+                          uint32x4_t w2,
+                          uint32x4_t w3)
+    // Return the 4 message schedule words following the 16 words held, in
+    // order, by the specified 'w0', 'w1', 'w2', and 'w3'.
+{
+    return vsha256su1q_u32(vsha256su0q_u32(w0, w1), w2, w3);
+}
+
+BDLDE_SHA2_ARMV8_SHA256_TARGET
+void transformArmv8(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::size_t          numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 64-byte blocks at the specified 'message' address using the
+    // ARMv8 SHA-256 instructions.
+{
+    uint32x4_t abcd = vld1q_u32(state);
+    uint32x4_t efgh = vld1q_u32(state + 4);
+
+    for (; numBlocks; --numBlocks, message += 64) {
+        const uint32x4_t abcdSaved = abcd;
+        const uint32x4_t efghSaved = efgh;
+
+        uint32x4_t w0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(message)));
+        uint32x4_t w1 = vreinterpretq_u32_u8(
+                                          vrev32q_u8(vld1q_u8(message + 16)));
+        uint32x4_t w2 = vreinterpretq_u32_u8(
+                                          vrev32q_u8(vld1q_u8(message + 32)));
+        uint32x4_t w3 = vreinterpretq_u32_u8(
+                                          vrev32q_u8(vld1q_u8(message + 48)));
+
+        roundsArmv8(&abcd, &efgh, w0,  0);
+        roundsArmv8(&abcd, &efgh, w1,  4);
+        roundsArmv8(&abcd, &efgh, w2,  8);
+        roundsArmv8(&abcd, &efgh, w3, 12);
+
+        for (int index = 16; index != 64; index += 16) {
+            w0 = nextWordsArmv8(w0, w1, w2, w3);
+            roundsArmv8(&abcd, &efgh, w0, index);
+            w1 = nextWordsArmv8(w1, w2, w3, w0);
+            roundsArmv8(&abcd, &efgh, w1, index + 4);
+            w2 = nextWordsArmv8(w2, w3, w0, w1);
+            roundsArmv8(&abcd, &efgh, w2, index + 8);
+            w3 = nextWordsArmv8(w3, w0, w1, w2);
+            roundsArmv8(&abcd, &efgh, w3, index + 12);
+        }
+
+        abcd = vaddq_u32(abcd, abcdSaved);
+        efgh = vaddq_u32(efgh, efghSaved);
+    }
+
+    vst1q_u32(state,     abcd);
+    vst1q_u32(state + 4, efgh);
+}
+
+#  ifdef BDLDE_SHA2_ARMV8_SHA512
+
+BDLDE_SHA2_ARMV8_SHA512_TARGET
+void transformArmv8(bsl::uint64_t       *state,
+                    const unsigned char *message,
+                    bsl::size_t          numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 128-byte blocks at the specified 'message' address using
+    // the ARMv8.2 SHA-512 instructions.
+{
+    uint64x2_t ab = vld1q_u64(state);
+    uint64x2_t cd = vld1q_u64(state + 2);
+    uint64x2_t ef = vld1q_u64(state + 4);
+    uint64x2_t gh = vld1q_u64(state + 6);
+
+    for (; numBlocks; --numBlocks, message += 128) {
+        const uint64x2_t abSaved = ab;
+        const uint64x2_t cdSaved = cd;
+        const uint64x2_t efSaved = ef;
+        const uint64x2_t ghSaved = gh;
+
+        uint64x2_t w[8];
+        for (int index = 0; index != 8; ++index) {
+            w[index] = vreinterpretq_u64_u8(
+                                 vrev64q_u8(vld1q_u8(message + index * 16)));
+        }
+
+        // Each iteration performs 2 rounds.
+
+        for (int index = 0; index != 40; ++index) {
+            uint64x2_t& words = w[index & 7];
+            if (8 <= index) {
+                words = vsha512su1q_u64(
+                             vsha512su0q_u64(words, w[(index + 1) & 7]),
+                             w[(index + 7) & 7],
+                             vextq_u64(w[(index + 4) & 7],
+                                       w[(index + 5) & 7],
+                                       1));
+            }
+
+            uint64x2_t kw = vaddq_u64(words,
+                                      vld1q_u64(sha512Constants + 2 * index));
+            kw = vextq_u64(kw, kw, 1);
+
+            uint64x2_t t = vsha512hq_u64(vaddq_u64(gh, kw),
+                                         vextq_u64(ef, gh, 1),
+                                         vextq_u64(cd, ef, 1));
+            const uint64x2_t efNext = vaddq_u64(cd, t);
+            t = vsha512h2q_u64(t, cd, ab);
+
+            gh = ef;
+            ef = efNext;
+            cd = ab;
+            ab = t;
+        }
+
+        ab = vaddq_u64(ab, abSaved);
+        cd = vaddq_u64(cd, cdSaved);
+        ef = vaddq_u64(ef, efSaved);
+        gh = vaddq_u64(gh, ghSaved);
+    }
+
+    vst1q_u64(state,     ab);
+    vst1q_u64(state + 2, cd);
+    vst1q_u64(state + 4, ef);
+    vst1q_u64(state + 6, gh);
+}
+
+#  endif  // BDLDE_SHA2_ARMV8_SHA512
+
+#else
+
+bool isArmv8Sha256Supported()
+    // Return 'true' if the running CPU supports the ARMv8 SHA-256
+    // instructions, and 'false' otherwise.
+{
+    return false;
+}
+
+bool isArmv8Sha512Supported()
+    // Return 'true' if the running CPU supports the ARMv8.2 SHA-512
+    // instructions, and 'false' otherwise.
+{
+    return false;
+}
+
+#endif  // BDLDE_SHA2_ARMV8
+
+                        // --------
+                        // Dispatch
+                        // --------
+
+Sha2_Impl::Implementation detectSha256Implementation()
+    // Return the fastest implementation of the SHA-256 block function
+    // supported by the running CPU.
+{
+    return isShaNiSupported()       ? Sha2_Impl::e_SHA_NI
+         : isArmv8Sha256Supported() ? Sha2_Impl::e_ARMV8_SHA256
+         :                            Sha2_Impl::e_SCALAR;
+}
+
+Sha2_Impl::Implementation detectSha512Implementation()
+    // Return the fastest implementation of the SHA-512 block function
+    // supported by the running CPU.
+{
+    return isArmv8Sha512Supported() ? Sha2_Impl::e_ARMV8_SHA512
+                                    : Sha2_Impl::e_SCALAR;
+}
+
+Sha2_Impl::Implementation detectMultiBufferImplementation()
+    // Return the fastest implementation of the SHA-256 multi-buffer function
+    // supported by the running CPU.  Note that a single stream using
+    // dedicated SHA instructions outperforms 8 AVX2 lanes.
+{
+    const Sha2_Impl::Implementation implementation =
+                                                  detectSha256Implementation();
+
+    return Sha2_Impl::e_SCALAR == implementation && isAvx2Supported()
+           ? Sha2_Impl::e_AVX2
+           : implementation;
+}
+
+const Sha2_Impl::Implementation s_sha256Implementation =
+                                                  detectSha256Implementation();
+const Sha2_Impl::Implementation s_sha512Implementation =
+                                                  detectSha512Implementation();
+const Sha2_Impl::Implementation s_multiBufferImplementation =
+                                             detectMultiBufferImplementation();
+    // The implementations used by the 'Sha224', 'Sha256', 'Sha384', and
+    // 'Sha512' classes.  Note that these variables are 'e_SCALAR' (zero) if
+    // those classes are used during static initialization before these
+    // variables are initialized.
+
+void transform256(Sha2_Impl::Implementation  implementation,
+                  bsl::uint32_t             *state,
+                  const unsigned char       *message,
+                  bsl::uint64_t              numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 64-byte blocks at the specified 'message' address using the
+    // specified SHA-256 'implementation'.
+{
+    switch (implementation) {
+#ifdef BDLDE_SHA2_X86
+      case Sha2_Impl::e_SHA_NI: {
+        transformShaNi(state, message, numBlocks);
+      } break;
+#endif
+#ifdef BDLDE_SHA2_ARMV8
+      case Sha2_Impl::e_ARMV8_SHA256: {
+        transformArmv8(state, message, numBlocks);
+      } break;
+#endif
+      default: {
+        transformScalar(state, message, numBlocks, 64, sha256Constants);
+      }
+    }
+}
+
+void transform512(Sha2_Impl::Implementation  implementation,
+                  bsl::uint64_t             *state,
+                  const unsigned char       *message,
+                  bsl::uint64_t              numBlocks)
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'numBlocks' 128-byte blocks at the specified 'message' address using
+    // the specified SHA-512 'implementation'.
+{
+    switch (implementation) {
+#ifdef BDLDE_SHA2_ARMV8_SHA512
+      case Sha2_Impl::e_ARMV8_SHA512: {
+        transformArmv8(state, message, numBlocks);
+      } break;
+#endif
+      default: {
+        transformScalar(state, message, numBlocks, 128, sha512Constants);
+      }
+    }
+}
+
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&constants)[64])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' (which
+    // must be 64) times the specified 'numberOfBuffers' using the SHA-256
+    // 'constants' and the fastest implementation supported by the running
+    // CPU.
+{
+    (void)bufferSize;
+    (void)constants;
+
+    transform256(s_sha256Implementation, state, message, numberOfBuffers);
+}
+
+void transform(bsl::uint64_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint64_t (&constants)[80])
+    // Update the specified 'state' with the hashed contents of the specified
+    // 'message' having a length equal to the specified 'bufferSize' (which
+    // must be 128) times the specified 'numberOfBuffers' using the SHA-512
+    // 'constants' and the fastest implementation supported by the running
+    // CPU.
+{
+    (void)bufferSize;
+    (void)constants;
+
+    transform512(s_sha512Implementation, state, message, numberOfBuffers);
+}
+
+void loadDigests256(Sha2_Impl::Implementation   implementation,
+                    unsigned char              *results,
+                    bsl::size_t                 digestSize,
+                    const bsl::uint32_t       (&initialState)[8],
+                    const void *const          *messages,
+                    const bsl::size_t          *lengths,
+                    bsl::size_t                 numMessages)
+    // Load into the specified 'results' the first specified 'digestSize'
+    // bytes of the digests, computed by the SHA-256 compression function
+    // starting from the specified 'initialState', of the specified
+    // 'numMessages' messages at the addresses in the specified 'messages'
+    // array having the lengths in the specified 'lengths' array, using the
+    // specified 'implementation'.
+{
+#ifdef BDLDE_SHA2_X86
+    if (Sha2_Impl::e_AVX2 == implementation) {
+        // Hash the messages in 8 lanes, one block per lane at a time.  When a
+        // lane finishes its message, it picks up the next one.  Once no
+        // messages are waiting and too few lanes remain busy to pay for the
+        // vector step, the remaining lanes are finished one at a time.
+
+        const int k_NUM_LANES = 8;
+        const int k_MIN_LANES = 3;
+
+        struct Lane {
+            const unsigned char *d_next_p;         // next block of message
+            bsl::size_t          d_numBlocks;      // blocks left in message
+            unsigned char        d_final[128];     // padded final blocks
+            bsl::size_t          d_numFinal;       // number of final blocks
+            bsl::size_t          d_finalIndex;     // next final block
+            bsl::size_t          d_message;        // index of message
+        };
+
+        Lane                 lanes[k_NUM_LANES];
+        bool                 busy[k_NUM_LANES] = {};
+        bsl::uint32_t        state[8][8];
+        const unsigned char  idle[64] = {};
+        const unsigned char *blocks[k_NUM_LANES];
+        bsl::size_t          next    = 0;
+        int                  numBusy = 0;
+
+        while (true) {
+            for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+                if (busy[lane] || next == numMessages) {
+                    continue;
+                }
+
+                Lane&                l       = lanes[lane];
+                const unsigned char *message =
+                        static_cast<const unsigned char *>(messages[next]);
+                const bsl::size_t    length  = lengths[next];
+
+                l.d_next_p     = message;
+                l.d_numBlocks  = length / 64;
+                l.d_finalIndex = 0;
+                l.d_message    = next;
+                loadFinalBlocks256(l.d_final,
+                                   &l.d_numFinal,
+                                   message + length / 64 * 64,
+                                   length % 64,
+                                   length);
+                for (int word = 0; word != 8; ++word) {
+                    state[word][lane] = initialState[word];
+                }
+
+                busy[lane] = true;
+                ++numBusy;
+                ++next;
+            }
+
+            if (numBusy < k_MIN_LANES && next == numMessages) {
+                break;
+            }
+
+            for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+                Lane& l = lanes[lane];
+                if (!busy[lane]) {
+                    blocks[lane] = idle;
+                }
+                else if (l.d_numBlocks) {
+                    blocks[lane] = l.d_next_p;
+                    l.d_next_p  += 64;
+                    --l.d_numBlocks;
+                }
+                else {
+                    blocks[lane] = l.d_final + 64 * l.d_finalIndex++;
+                }
+            }
+
+            transformAvx2(state, blocks);
+
+            for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+                const Lane& l = lanes[lane];
+                if (busy[lane] && l.d_finalIndex == l.d_numFinal) {
+                    bsl::uint32_t digest[8];
+                    for (int word = 0; word != 8; ++word) {
+                        digest[word] = state[word][lane];
+                    }
+                    storeDigest256(results + l.d_message * digestSize,
+                                   digestSize,
+                                   digest);
+
+                    busy[lane] = false;
+                    --numBusy;
+                }
+            }
+        }
+
+        for (int lane = 0; lane != k_NUM_LANES; ++lane) {
+            if (!busy[lane]) {
+                continue;
+            }
+
+            const Lane&   l = lanes[lane];
+            bsl::uint32_t digest[8];
+            for (int word = 0; word != 8; ++word) {
+                digest[word] = state[word][lane];
+            }
+            transformScalar(digest,
+                            l.d_next_p,
+                            l.d_numBlocks,
+                            64,
+                            sha256Constants);
+            transformScalar(digest,
+                            l.d_final + 64 * l.d_finalIndex,
+                            l.d_numFinal - l.d_finalIndex,
+                            64,
+                            sha256Constants);
+            storeDigest256(results + l.d_message * digestSize,
+                           digestSize,
+                           digest);
+        }
+
+        return;                                                       // RETURN
+    }
+#endif
+
+    bsl::size_t index = 0;
+
+#ifdef BDLDE_SHA2_X86
+    if (Sha2_Impl::e_SHA_NI == implementation) {
+        // Hash the messages in pairs, interleaving the blocks the two messages
+        // have in common.
+
+        for (; index + 2 <= numMessages; index += 2) {
+            const unsigned char *message[2];
+            bsl::size_t          numBlocks[2];
+            bsl::uint32_t        state[2][8];
+            unsigned char        finalBlocks[2][128];
+            bsl::size_t          numFinalBlocks[2];
+
+            for (int i = 0; i != 2; ++i) {
+                const bsl::size_t length = lengths[index + i];
+
+                message[i]   = static_cast<const unsigned char *>(
+                                                        messages[index + i]);
+                numBlocks[i] = length / 64;
+                bsl::copy(initialState, initialState + 8, state[i]);
+                loadFinalBlocks256(finalBlocks[i],
+                                   &numFinalBlocks[i],
+                                   message[i] + numBlocks[i] * 64,
+                                   length % 64,
+                                   length);
+            }
+
+            const bsl::size_t numShared = bsl::min(numBlocks[0],
+                                                   numBlocks[1]);
+
+            transformShaNi(state[0],
+                           message[0],
+                           state[1],
+                           message[1],
+                           numShared);
+            for (int i = 0; i != 2; ++i) {
+                transformShaNi(state[i],
+                               message[i] + numShared * 64,
+                               numBlocks[i] - numShared);
+            }
+
+            if (numFinalBlocks[0] == numFinalBlocks[1]) {
+                transformShaNi(state[0],
+                               finalBlocks[0],
+                               state[1],
+                               finalBlocks[1],
+                               numFinalBlocks[0]);
+            }
+            else {
+                for (int i = 0; i != 2; ++i) {
+                    transformShaNi(state[i],
+                                   finalBlocks[i],
+                                   numFinalBlocks[i]);
+                }
+            }
+
+            for (int i = 0; i != 2; ++i) {
+                storeDigest256(results + (index + i) * digestSize,
+                               digestSize,
+                               state[i]);
+            }
+        }
+    }
+#endif
+
+    for (; index != numMessages; ++index) {
+        const unsigned char *message =
+                           static_cast<const unsigned char *>(messages[index]);
+        const bsl::size_t    length  = lengths[index];
+
+        bsl::uint32_t state[8];
+        bsl::copy(initialState, initialState + 8, state);
+        transform256(implementation, state, message, length / 64);
+
+        unsigned char finalBlocks[128];
+        bsl::size_t   numFinalBlocks;
+        loadFinalBlocks256(finalBlocks,
+                           &numFinalBlocks,
+                           message + length / 64 * 64,
+                           length % 64,
+                           length);
+        transform256(implementation, state, finalBlocks, numFinalBlocks);
+
+        storeDigest256(results + index * digestSize, digestSize, state);
+    }
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -346,6 +1372,43 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+// CLASS METHODS
+void Sha224::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    loadDigests256(s_multiBufferImplementation,
+                   results,
+                   k_DIGEST_SIZE,
+                   sha224InitialState,
+                   messages,
+                   lengths,
+                   numMessages);
+}
+
+void Sha256::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+    loadDigests256(s_multiBufferImplementation,
+                   results,
+                   k_DIGEST_SIZE,
+                   sha256InitialState,
+                   messages,
+                   lengths,
+                   numMessages);
+}
+
 Sha224::Sha224()
 {
     reset();
@@ -394,32 +1457,14 @@ void Sha224::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // Second 32 bits of the fractional parts of the square root of the 9th
-    // through 16th primes.
-    d_state[0] = 0xc1059ed8;
-    d_state[1] = 0x367cd507;
-    d_state[2] = 0x3070dd17;
-    d_state[3] = 0xf70e5939;
-    d_state[4] = 0xffc00b31;
-    d_state[5] = 0x68581511;
-    d_state[6] = 0x64f98fa7;
-    d_state[7] = 0xbefa4fa4;
+    bsl::copy(sha224InitialState, sha224InitialState + 8, d_state);
 }
 
 void Sha256::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 32 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667;
-    d_state[1] = 0xbb67ae85;
-    d_state[2] = 0x3c6ef372;
-    d_state[3] = 0xa54ff53a;
-    d_state[4] = 0x510e527f;
-    d_state[5] = 0x9b05688c;
-    d_state[6] = 0x1f83d9ab;
-    d_state[7] = 0x5be0cd19;
+    bsl::copy(sha256InitialState, sha256InitialState + 8, d_state);
 }
 
 void Sha384::reset()
@@ -650,6 +1695,82 @@ bsl::ostream& Sha512::print(bsl::ostream& stream) const
     return stream;
 }
 
+                              // ----------------
+                              // struct Sha2_Impl
+                              // ----------------
+
+// CLASS METHODS
+bool Sha2_Impl::isAvailable(Implementation implementation)
+{
+    switch (implementation) {
+      case e_SHA_NI: {
+        return isShaNiSupported();                                    // RETURN
+      }
+      case e_ARMV8_SHA256: {
+        return isArmv8Sha256Supported();                              // RETURN
+      }
+      case e_ARMV8_SHA512: {
+        return isArmv8Sha512Supported();                              // RETURN
+      }
+      case e_AVX2: {
+        return isAvx2Supported();                                     // RETURN
+      }
+      default: {
+        return true;                                                  // RETURN
+      }
+    }
+}
+
+void Sha2_Impl::loadSha256Digests(Implementation     implementation,
+                                  unsigned char     *results,
+                                  const void *const *messages,
+                                  const bsl::size_t *lengths,
+                                  bsl::size_t        numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+    BSLS_ASSERT(e_ARMV8_SHA512 != implementation);
+    BSLS_ASSERT_SAFE(isAvailable(implementation));
+
+    loadDigests256(implementation,
+                   results,
+                   Sha256::k_DIGEST_SIZE,
+                   sha256InitialState,
+                   messages,
+                   lengths,
+                   numMessages);
+}
+
+void Sha2_Impl::transformSha256(Implementation       implementation,
+                                bsl::uint32_t       *state,
+                                const unsigned char *blocks,
+                                bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(e_SCALAR       == implementation ||
+                e_SHA_NI       == implementation ||
+                e_ARMV8_SHA256 == implementation);
+    BSLS_ASSERT_SAFE(isAvailable(implementation));
+
+    transform256(implementation, state, blocks, numBlocks);
+}
+
+void Sha2_Impl::transformSha512(Implementation       implementation,
+                                bsl::uint64_t       *state,
+                                const unsigned char *blocks,
+                                bsl::size_t          numBlocks)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(blocks || 0 == numBlocks);
+    BSLS_ASSERT(e_SCALAR       == implementation ||
+                e_ARMV8_SHA512 == implementation);
+    BSLS_ASSERT_SAFE(isAvailable(implementation));
+
+    transform512(implementation, state, blocks, numBlocks);
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //  bdlde::Sha256: value-semantic type representing a SHA-256 digest
 //  bdlde::Sha384: value-semantic type representing a SHA-384 digest
 //  bdlde::Sha512: value-semantic type representing a SHA-512 digest
+//  bdlde::Sha2_Impl: alternative implementations for testing
 //
 //@SEE_ALSO: bdlde_md5
 //
@@ -25,6 +26,34 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+// 'Sha224' and 'Sha256' also provide a class method, 'loadDigests', that
+// computes the digests of many independent messages in a single call.  When
+// many small messages are to be hashed, 'loadDigests' can be substantially
+// faster than hashing each message with its own object (see
+// {Hardware Acceleration}).
+//
+// This component additionally defines the 'struct' 'bdlde::Sha2_Impl' to
+// expose the individual implementations of the SHA-2 block functions; it
+// should not be used other than to test and benchmark.
+//
+///Hardware Acceleration
+///---------------------
+// Where the compiler supports them (GCC and clang), implementations using
+// dedicated CPU instructions are selected at runtime if the running CPU
+// supports them:
+//: o On x86, SHA-224 and SHA-256 use the SHA extensions ("SHA-NI"), and
+//:   'loadDigests' hashes 2 messages at once to hide instruction latency.
+//:
+//: o On 64-bit ARM, SHA-224 and SHA-256 use the ARMv8 cryptographic
+//:   extensions, and SHA-384 and SHA-512 use the ARMv8.2 SHA-512
+//:   extensions.
+//:
+//: o On x86 CPUs that support AVX2 but not the SHA extensions, 'loadDigests'
+//:   hashes 8 messages at once, one per 32-bit vector element.
+//
+// Otherwise, a portable implementation is used.  All implementations produce
+// identical results.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -121,6 +150,22 @@ class Sha224 {
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the SHA-224 digests of the
+        // specified 'numMessages' messages, where message 'i' has the address
+        // 'messages[i]' and the length (in bytes) 'lengths[i]', such that the
+        // digest of message 'i' is stored at 'results + i * k_DIGEST_SIZE'.
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths'
+        // refer to arrays of at least 'numMessages' elements, and each range
+        // '[messages[i], messages[i] + lengths[i])' is valid.  Note that this
+        // function produces the same digests as hashing each message with a
+        // separate object, but may hash several messages in parallel.
+
     // CREATORS
     Sha224();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -201,6 +246,22 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages, where message 'i' has the address
+        // 'messages[i]' and the length (in bytes) 'lengths[i]', such that the
+        // digest of message 'i' is stored at 'results + i * k_DIGEST_SIZE'.
+        // The behavior is undefined unless 'results' refers to an array of at
+        // least 'numMessages * k_DIGEST_SIZE' bytes, 'messages' and 'lengths'
+        // refer to arrays of at least 'numMessages' elements, and each range
+        // '[messages[i], messages[i] + lengths[i])' is valid.  Note that this
+        // function produces the same digests as hashing each message with a
+        // separate object, but may hash several messages in parallel.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -403,6 +464,65 @@ class Sha512 {
         // output 'stream' and return a reference to the modifiable 'stream'.
 };
 
+                              // ================
+                              // struct Sha2_Impl
+                              // ================
+
+struct Sha2_Impl {
+    // This 'struct' provides a namespace for the individual implementations
+    // of the SHA-2 block functions.  The functions in this 'struct' should not
+    // be used other than to test and benchmark.
+
+    // TYPES
+    enum Implementation {
+        // Enumerate the implementations of the SHA-2 block functions.
+
+        e_SCALAR,        // portable implementation
+        e_SHA_NI,        // x86 SHA extensions (SHA-256 only)
+        e_ARMV8_SHA256,  // ARMv8 cryptographic extensions (SHA-256 only)
+        e_ARMV8_SHA512,  // ARMv8.2 SHA-512 extensions (SHA-512 only)
+        e_AVX2           // 8-lane AVX2 ('loadSha256Digests' only)
+    };
+
+    // CLASS METHODS
+    static bool isAvailable(Implementation implementation);
+        // Return 'true' if the specified 'implementation' is supported by this
+        // build and by the running CPU, and 'false' otherwise.
+
+    static void loadSha256Digests(Implementation     implementation,
+                                  unsigned char     *results,
+                                  const void *const *messages,
+                                  const bsl::size_t *lengths,
+                                  bsl::size_t        numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' messages having the addresses in the
+        // specified 'messages' and the lengths in the specified 'lengths'
+        // using the specified 'implementation', as described for
+        // 'Sha256::loadDigests'.  The behavior is undefined unless
+        // 'isAvailable(implementation)' is 'true' and 'implementation' is not
+        // 'e_ARMV8_SHA512'.
+
+    static void transformSha256(Implementation       implementation,
+                                bsl::uint32_t       *state,
+                                const unsigned char *blocks,
+                                bsl::size_t          numBlocks);
+        // Update the specified 8-word 'state' with the SHA-256 compression of
+        // the specified 'numBlocks' 64-byte blocks at the specified 'blocks'
+        // address using the specified 'implementation'.  The behavior is
+        // undefined unless 'isAvailable(implementation)' is 'true' and
+        // 'implementation' is 'e_SCALAR', 'e_SHA_NI', or 'e_ARMV8_SHA256'.
+
+    static void transformSha512(Implementation       implementation,
+                                bsl::uint64_t       *state,
+                                const unsigned char *blocks,
+                                bsl::size_t          numBlocks);
+        // Update the specified 8-word 'state' with the SHA-512 compression of
+        // the specified 'numBlocks' 128-byte blocks at the specified 'blocks'
+        // address using the specified 'implementation'.  The behavior is
+        // undefined unless 'isAvailable(implementation)' is 'true' and
+        // 'implementation' is 'e_SCALAR' or 'e_ARMV8_SHA512'.
+};
+
 // FREE OPERATORS
 bool operator==(const Sha224& lhs, const Sha224& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' SHA digests have the same
@@ -5,11 +5,13 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
@@ -86,6 +88,14 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [27] void Sha224::loadDigests(uchar *, const void *const *, ...);
+// [27] void Sha256::loadDigests(uchar *, const void *const *, ...);
+// [26] bool Sha2_Impl::isAvailable(Implementation);
+// [27] void Sha2_Impl::loadSha256Digests(Impl, uchar *, ...);
+// [26] void Sha2_Impl::transformSha256(Impl, uint32_t *, ...);
+// [26] void Sha2_Impl::transformSha512(Impl, uint64_t *, ...);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +145,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -495,6 +506,124 @@ void testTwoArgumentConstructor(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+typedef bdlde::Sha2_Impl Impl;
+
+const Impl::Implementation IMPLEMENTATIONS[] = {
+    // All implementations of the SHA-2 block functions.
+
+    Impl::e_SCALAR,
+    Impl::e_SHA_NI,
+    Impl::e_ARMV8_SHA256,
+    Impl::e_ARMV8_SHA512,
+    Impl::e_AVX2
+};
+
+const char *implementationName(Impl::Implementation implementation)
+    // Return the name of the specified 'implementation'.
+{
+    switch (implementation) {
+      case Impl::e_SCALAR:       return "scalar";                     // RETURN
+      case Impl::e_SHA_NI:       return "SHA-NI";                     // RETURN
+      case Impl::e_ARMV8_SHA256: return "ARMv8 SHA-256";              // RETURN
+      case Impl::e_ARMV8_SHA512: return "ARMv8 SHA-512";              // RETURN
+      case Impl::e_AVX2:         return "AVX2";                       // RETURN
+    }
+    return "unknown";
+}
+
+void fillRandom(unsigned char *buffer, bsl::size_t length, unsigned *seed)
+    // Load into the specified 'buffer' having the specified 'length'
+    // pseudo-random bytes generated from the specified 'seed', and update
+    // 'seed'.
+{
+    for (bsl::size_t index = 0; index != length; ++index) {
+        *seed = *seed * 1103515245 + 12345;
+        buffer[index] = static_cast<unsigned char>(*seed >> 16);
+    }
+}
+
+template<class HASHER>
+void testLoadDigests(Impl::Implementation implementation)
+    // Verify that 'HASHER::loadDigests' produces the same digests as separate
+    // 'HASHER' objects for assorted sets of messages and, if 'HASHER' is
+    // 'bdlde::Sha256', that 'bdlde::Sha2_Impl::loadSha256Digests' does so
+    // when using the specified 'implementation'.
+{
+    const bool        useImpl = 32 == HASHER::k_DIGEST_SIZE;
+    const bsl::size_t k_SIZE  = HASHER::k_DIGEST_SIZE;
+
+    bsl::vector<unsigned char> data(20000);
+    unsigned                   seed = 7;
+    fillRandom(data.data(), data.size(), &seed);
+
+    for (int set = 0; set != 200; ++set) {
+        // Set 0 holds one message of each length from 0 to 300, set 1 mixes
+        // one long message with many short ones, and the remaining sets are
+        // random.
+
+        bsl::vector<const void *> messages;
+        bsl::vector<bsl::size_t>  lengths;
+
+        if (0 == set) {
+            for (bsl::size_t length = 0; length <= 300; ++length) {
+                messages.push_back(data.data() + length);
+                lengths.push_back(length);
+            }
+        }
+        else if (1 == set) {
+            messages.push_back(data.data());
+            lengths.push_back(data.size());
+            for (bsl::size_t index = 0; index != 40; ++index) {
+                messages.push_back(data.data() + index * 3);
+                lengths.push_back(index * 7);
+            }
+        }
+        else {
+            const int numMessages = set % 20;
+            for (int index = 0; index != numMessages; ++index) {
+                seed = seed * 1103515245 + 12345;
+                const bsl::size_t length = (seed >> 8) % (set < 100
+                                                          ? 200
+                                                          : 2000);
+                seed = seed * 1103515245 + 12345;
+                const bsl::size_t offset = (seed >> 8)
+                                         % (data.size() - length + 1);
+                messages.push_back(0 == length && 0 == index % 2
+                                   ? 0
+                                   : data.data() + offset);
+                lengths.push_back(length);
+            }
+        }
+
+        const bsl::size_t          NUM = messages.size();
+        bsl::vector<unsigned char> expected(NUM * k_SIZE + 1, 0xA5);
+        bsl::vector<unsigned char> results(NUM * k_SIZE + 1, 0xA5);
+
+        for (bsl::size_t index = 0; index != NUM; ++index) {
+            HASHER hasher(messages[index], lengths[index]);
+            hasher.loadDigest(&expected[index * k_SIZE]);
+        }
+
+        HASHER::loadDigests(results.data(),
+                            messages.data(),
+                            lengths.data(),
+                            NUM);
+        ASSERTV(set, expected == results);
+
+        if (useImpl) {
+            bsl::fill(results.begin(), results.end(), 0xA5);
+            Impl::loadSha256Digests(implementation,
+                                    results.data(),
+                                    messages.data(),
+                                    lengths.data(),
+                                    NUM);
+            ASSERTV(implementationName(implementation),
+                    set,
+                    expected == results);
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -509,7 +638,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +660,224 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //
+        // Concerns:
+        //: 1 'loadDigests' stores, for each message, the digest that a
+        //:   separate object hashing that message would produce, at the
+        //:   position corresponding to the message.
+        //:
+        //: 2 'loadDigests' does not write beyond the end of 'results'.
+        //:
+        //: 3 Any number of messages (including none), messages of any length
+        //:   (including messages longer than all the others and empty messages
+        //:   having a null address), and unaligned messages are supported.
+        //:
+        //: 4 Every available implementation of 'loadSha256Digests' produces
+        //:   the same digests.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For 'bdlde::Sha224' and 'bdlde::Sha256' and for each available
+        //:   implementation, hash a set of messages having every length from 0
+        //:   to 300, a set mixing one long message with many short ones, and
+        //:   many sets of random messages at random offsets, and compare the
+        //:   results (followed by a guard byte) with the digests obtained from
+        //:   separate objects.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha256::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha2_Impl::loadSha256Digests(Impl, uchar *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'loadDigests'" "\n"
+                             "=====================" "\n";
+
+        for (bsl::size_t i = 0; i != arraySize(IMPLEMENTATIONS); ++i) {
+            const Impl::Implementation IMPL = IMPLEMENTATIONS[i];
+
+            if (Impl::e_ARMV8_SHA512 == IMPL || !Impl::isAvailable(IMPL)) {
+                continue;
+            }
+
+            if (verbose) cout << implementationName(IMPL) << "\n";
+
+            testLoadDigests<bdlde::Sha224>(IMPL);
+            testLoadDigests<bdlde::Sha256>(IMPL);
+        }
+
+        if (verbose) cout << "\nNegative Testing." "\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            unsigned char     result[bdlde::Sha256::k_DIGEST_SIZE];
+            const void       *message = "abc";
+            const bsl::size_t length  = 3;
+
+            ASSERT_PASS(bdlde::Sha256::loadDigests(result,
+                                                   &message,
+                                                   &length,
+                                                   1));
+            ASSERT_PASS(bdlde::Sha256::loadDigests(0, 0, 0, 0));
+            ASSERT_FAIL(bdlde::Sha256::loadDigests(0, &message, &length, 1));
+            ASSERT_FAIL(bdlde::Sha256::loadDigests(result, 0, &length, 1));
+            ASSERT_FAIL(bdlde::Sha256::loadDigests(result, &message, 0, 1));
+
+            ASSERT_PASS(bdlde::Sha224::loadDigests(result,
+                                                   &message,
+                                                   &length,
+                                                   1));
+            ASSERT_FAIL(bdlde::Sha224::loadDigests(0, &message, &length, 1));
+
+            ASSERT_FAIL(Impl::loadSha256Digests(Impl::e_ARMV8_SHA512,
+                                                result,
+                                                &message,
+                                                &length,
+                                                1));
+        }
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING 'Sha2_Impl' BLOCK FUNCTIONS
+        //
+        // Concerns:
+        //: 1 Every available implementation of the SHA-256 and SHA-512 block
+        //:   functions computes the same state as the portable
+        //:   implementation, for any initial state, any number of blocks, and
+        //:   unaligned blocks.
+        //:
+        //: 2 'isAvailable' returns 'true' for the portable implementation.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each available implementation of each block function, apply
+        //:   it to pseudo-random states and 0 to 9 pseudo-random blocks at
+        //:   every offset from 0 to 15, and compare the resulting state with
+        //:   that computed by the portable implementation.  (C-1..2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-3)
+        //
+        // Testing:
+        //   bool Sha2_Impl::isAvailable(Implementation);
+        //   void Sha2_Impl::transformSha256(Impl, uint32_t *, ...);
+        //   void Sha2_Impl::transformSha512(Impl, uint64_t *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'Sha2_Impl' BLOCK FUNCTIONS" "\n"
+                             "===================================" "\n";
+
+        ASSERT(Impl::isAvailable(Impl::e_SCALAR));
+
+        unsigned      seed = 1;
+        unsigned char data[16 + 9 * 128];
+
+        for (bsl::size_t i = 0; i != arraySize(IMPLEMENTATIONS); ++i) {
+            const Impl::Implementation IMPL      = IMPLEMENTATIONS[i];
+            const bool                 AVAILABLE = Impl::isAvailable(IMPL);
+
+            if (verbose) {
+                cout << implementationName(IMPL) << ": "
+                     << (AVAILABLE ? "available" : "not available") << "\n";
+            }
+
+            if (!AVAILABLE || Impl::e_AVX2 == IMPL) {
+                continue;
+            }
+
+            for (bsl::size_t offset = 0; offset != 16; ++offset) {
+                for (bsl::size_t numBlocks = 0; numBlocks != 10; ++numBlocks) {
+                    fillRandom(data, sizeof data, &seed);
+
+                    if (Impl::e_ARMV8_SHA512 != IMPL) {
+                        bsl::uint32_t expected[8];
+                        bsl::uint32_t state[8];
+                        fillRandom(reinterpret_cast<unsigned char *>(expected),
+                                   sizeof expected,
+                                   &seed);
+                        bsl::copy(expected, expected + 8, state);
+
+                        Impl::transformSha256(Impl::e_SCALAR,
+                                              expected,
+                                              data + offset,
+                                              numBlocks);
+                        Impl::transformSha256(IMPL,
+                                              state,
+                                              data + offset,
+                                              numBlocks);
+                        ASSERTV(implementationName(IMPL),
+                                offset,
+                                numBlocks,
+                                bsl::equal(expected, expected + 8, state));
+                    }
+
+                    if (Impl::e_SCALAR       == IMPL ||
+                        Impl::e_ARMV8_SHA512 == IMPL) {
+                        bsl::uint64_t expected[8];
+                        bsl::uint64_t state[8];
+                        fillRandom(reinterpret_cast<unsigned char *>(expected),
+                                   sizeof expected,
+                                   &seed);
+                        bsl::copy(expected, expected + 8, state);
+
+                        Impl::transformSha512(Impl::e_SCALAR,
+                                              expected,
+                                              data + offset,
+                                              numBlocks);
+                        Impl::transformSha512(IMPL,
+                                              state,
+                                              data + offset,
+                                              numBlocks);
+                        ASSERTV(implementationName(IMPL),
+                                offset,
+                                numBlocks,
+                                bsl::equal(expected, expected + 8, state));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." "\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::uint32_t state256[8] = {};
+            bsl::uint64_t state512[8] = {};
+
+            ASSERT_PASS(Impl::transformSha256(Impl::e_SCALAR,
+                                              state256,
+                                              data,
+                                              1));
+            ASSERT_PASS(Impl::transformSha256(Impl::e_SCALAR, state256, 0, 0));
+            ASSERT_FAIL(Impl::transformSha256(Impl::e_SCALAR, 0, data, 1));
+            ASSERT_FAIL(Impl::transformSha256(Impl::e_SCALAR, state256, 0, 1));
+            ASSERT_FAIL(Impl::transformSha256(Impl::e_AVX2,
+                                              state256,
+                                              data,
+                                              1));
+
+            ASSERT_PASS(Impl::transformSha512(Impl::e_SCALAR,
+                                              state512,
+                                              data,
+                                              1));
+            ASSERT_FAIL(Impl::transformSha512(Impl::e_SCALAR, 0, data, 1));
+            ASSERT_FAIL(Impl::transformSha512(Impl::e_SCALAR, state512, 0, 1));
+            ASSERT_FAIL(Impl::transformSha512(Impl::e_SHA_NI,
+                                              state512,
+                                              data,
+                                              1));
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1250,6 +1597,148 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The hardware implementations are faster than the portable one.
+        //:
+        //: 2 'loadDigests' is faster than separate objects for many small
+        //:   messages.
+        //
+        // Plan:
+        //: 1 Time each available implementation of the block functions on a
+        //:   1 MiB buffer, and report the throughput.  (C-1)
+        //:
+        //: 2 Time hashing 16 MiB of messages of several sizes with separate
+        //:   'bdlde::Sha256' objects and with each available implementation of
+        //:   'loadSha256Digests', and report the throughput.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE TEST" "\n"
+                "================" "\n";
+
+        const bsl::size_t          k_DATA_SIZE = 1 << 20;
+        const int                  k_REPS      = 64;
+        bsl::vector<unsigned char> data(k_DATA_SIZE);
+        unsigned                   seed = 3;
+        fillRandom(data.data(), data.size(), &seed);
+
+        const double k_MIB = 1024.0 * 1024.0;
+
+        cout << "\nBlock functions (MiB/s):\n";
+        for (bsl::size_t i = 0; i != arraySize(IMPLEMENTATIONS); ++i) {
+            const Impl::Implementation IMPL = IMPLEMENTATIONS[i];
+
+            if (!Impl::isAvailable(IMPL) || Impl::e_AVX2 == IMPL) {
+                continue;
+            }
+
+            bsls::Stopwatch timer;
+
+            if (Impl::e_ARMV8_SHA512 != IMPL) {
+                bsl::uint32_t state[8] = {};
+                timer.start();
+                for (int rep = 0; rep != k_REPS; ++rep) {
+                    Impl::transformSha256(IMPL,
+                                          state,
+                                          data.data(),
+                                          k_DATA_SIZE / 64);
+                }
+                timer.stop();
+                cout << "  SHA-256 " << setw(14) << left
+                     << implementationName(IMPL) << right << setw(10)
+                     << static_cast<int>(k_REPS * k_DATA_SIZE / k_MIB
+                                                      / timer.elapsedTime())
+                     << "\n";
+            }
+
+            if (Impl::e_SCALAR == IMPL || Impl::e_ARMV8_SHA512 == IMPL) {
+                bsl::uint64_t state[8] = {};
+                timer.reset();
+                timer.start();
+                for (int rep = 0; rep != k_REPS; ++rep) {
+                    Impl::transformSha512(IMPL,
+                                          state,
+                                          data.data(),
+                                          k_DATA_SIZE / 128);
+                }
+                timer.stop();
+                cout << "  SHA-512 " << setw(14) << left
+                     << implementationName(IMPL) << right << setw(10)
+                     << static_cast<int>(k_REPS * k_DATA_SIZE / k_MIB
+                                                      / timer.elapsedTime())
+                     << "\n";
+            }
+        }
+
+        const bsl::size_t SIZES[] = { 32, 64, 256, 1024, 4096 };
+
+        cout << "\nSHA-256 of many messages (MiB/s):\n"
+             << setw(8) << "size" << setw(10) << "objects";
+        for (bsl::size_t i = 0; i != arraySize(IMPLEMENTATIONS); ++i) {
+            if (Impl::e_ARMV8_SHA512 != IMPLEMENTATIONS[i] &&
+                Impl::isAvailable(IMPLEMENTATIONS[i])) {
+                cout << setw(15) << implementationName(IMPLEMENTATIONS[i]);
+            }
+        }
+        cout << "\n";
+
+        for (bsl::size_t s = 0; s != arraySize(SIZES); ++s) {
+            const bsl::size_t SIZE = SIZES[s];
+            const bsl::size_t NUM  = k_DATA_SIZE / SIZE;
+
+            bsl::vector<const void *>  messages(NUM);
+            bsl::vector<bsl::size_t>   lengths(NUM, SIZE);
+            bsl::vector<unsigned char> results(
+                                           NUM * bdlde::Sha256::k_DIGEST_SIZE);
+            for (bsl::size_t index = 0; index != NUM; ++index) {
+                messages[index] = data.data() + index * SIZE;
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int rep = 0; rep != k_REPS / 4; ++rep) {
+                for (bsl::size_t index = 0; index != NUM; ++index) {
+                    bdlde::Sha256 hasher(messages[index], SIZE);
+                    hasher.loadDigest(&results[index *
+                                               bdlde::Sha256::k_DIGEST_SIZE]);
+                }
+            }
+            timer.stop();
+            cout << setw(8) << SIZE << setw(10)
+                 << static_cast<int>(k_REPS / 4 * k_DATA_SIZE / k_MIB
+                                                      / timer.elapsedTime());
+
+            for (bsl::size_t i = 0; i != arraySize(IMPLEMENTATIONS); ++i) {
+                const Impl::Implementation IMPL = IMPLEMENTATIONS[i];
+
+                if (Impl::e_ARMV8_SHA512 == IMPL ||
+                    !Impl::isAvailable(IMPL)) {
+                    continue;
+                }
+
+                timer.reset();
+                timer.start();
+                for (int rep = 0; rep != k_REPS / 4; ++rep) {
+                    Impl::loadSha256Digests(IMPL,
+                                            results.data(),
+                                            messages.data(),
+                                            lengths.data(),
+                                            NUM);
+                }
+                timer.stop();
+                cout << setw(15)
+                     << static_cast<int>(k_REPS / 4 * k_DATA_SIZE / k_MIB
+                                                      / timer.elapsedTime());
+            }
+            cout << "\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
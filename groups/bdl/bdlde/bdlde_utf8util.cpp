@@ -12,8 +12,28 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlde_cpufeatures.h>
+
+#include <bdlb_bitutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#define BDLDE_UTF8UTIL_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+#if defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG)
+#define BDLDE_UTF8UTIL_X86
+#include <immintrin.h>
+#endif
+#endif
 
 // LOCAL MACROS
 
@@ -138,6 +158,44 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+static inline
+bsls::Types::size_type numAsciiBytes(const char             *string,
+                                     bsls::Types::size_type  length)
+    // Return the number of bytes in the longest prefix of the specified
+    // 'string' having the specified 'length' that consists only of bytes with
+    // the high-order bit clear.  Examine 16 bytes per step on x86-64, and 8
+    // bytes per step otherwise.
+{
+    const char *pc        = string;
+    const char *const end = string + length;
+
+#if defined(BDLDE_UTF8UTIL_SSE2)
+    for (; end - pc >= 16; pc += 16) {
+        const int mask = _mm_movemask_epi8(
+                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(pc)));
+        if (mask) {
+            return pc - string + bdlb::BitUtil::numTrailingUnsetBits(
+                                        static_cast<bsl::uint32_t>(mask));
+                                                                      // RETURN
+        }
+    }
+#else
+    for (; end - pc >= 8; pc += 8) {
+        bsls::Types::Uint64 word;
+        bsl::memcpy(&word, pc, sizeof word);
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+    }
+#endif
+
+    while (pc < end && 0 == (*pc & 0x80)) {
+        ++pc;
+    }
+
+    return pc - string;
+}
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -275,6 +333,16 @@ static int validateAndCountCodePoints(const char             **invalidString,
           case 6:
           case 7: {
             ++pc;
+
+            // If another ASCII byte follows, skip the rest of the run in one
+            // step.  Note that 'pc' is still short of the end of input.
+
+            if (0 == (*pc & 0x80)) {
+                const bsls::Types::size_type numAscii =
+                                       numAsciiBytes(pc, pcEnd4 + 4 - pc);
+                pc    += numAscii;
+                count += static_cast<int>(numAscii);
+            }
           } break;
           case 0xc:
           case 0xd: {
@@ -400,6 +468,549 @@ static int validateAndCountCodePoints(const char             **invalidString,
 }
 
 
+                          // -----------------------
+                          // Vectorized Validation
+                          // -----------------------
+
+// The vector validators follow the "lookup" algorithm of Keiser and Lemire
+// (see the component documentation).  Every byte of the input is classified,
+// together with the byte preceding it, by three 16-entry 'PSHUFB' lookups
+// keyed on the high nibble of the preceding byte, the low nibble of the
+// preceding byte, and the high nibble of the byte itself.  Each bit of the
+// classification identifies a kind of error that the pair of bytes can
+// witness, and a pair is invalid if the bitwise AND of its three lookups is
+// non-zero.  The only pairs so classified that are not errors are the second
+// continuation bytes of 3- and 4-byte sequences (which look like a
+// continuation byte following a continuation byte), and these are exactly the
+// bytes having a 3- or 4-byte lead 2 or 3 bytes earlier; their classification
+// is corrected by an exclusive-or.  A block consisting of ASCII bytes only is
+// valid unless the preceding block ends with an incomplete sequence.
+//
+// The number of code points is the number of bytes that are not continuation
+// bytes.  The vector loops never read beyond 'string + length': the final
+// partial block is copied into a zero-padded buffer.
+
+namespace {
+
+enum {
+    k_TOO_SHORT      = 1 << 0,  // 11______ 0_______ or 11______ 11______
+    k_TOO_LONG       = 1 << 1,  // 0_______ 10______
+    k_OVERLONG_3     = 1 << 2,  // 11100000 100_____
+    k_TOO_LARGE      = 1 << 3,  // 11110100 1001____ or 11110100 101_____
+                                // or 11110101 1001____ or ...
+    k_SURROGATE      = 1 << 4,  // 11101101 101_____
+    k_OVERLONG_2     = 1 << 5,  // 1100000_ 10______
+    k_TOO_LARGE_1000 = 1 << 6,  // 11110101 1000____ or 1111011_ 1000____
+                                // or 11111___ 1000____
+    k_OVERLONG_4     = 1 << 6,  // 11110000 1000____
+    k_TWO_CONTS      = 1 << 7,  // 10______ 10______
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+};
+
+const char k_BYTE_1_HIGH[16] = {
+    // The errors that can be witnessed by a pair of bytes, indexed by the high
+    // nibble of the first byte.
+
+    // 0_______ ________: ASCII
+
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+
+    // 10______ ________: continuation
+
+    static_cast<char>(k_TWO_CONTS), static_cast<char>(k_TWO_CONTS),
+    static_cast<char>(k_TWO_CONTS), static_cast<char>(k_TWO_CONTS),
+
+    // 1100____ ________ and 1101____ ________: 2-byte lead
+
+    k_TOO_SHORT | k_OVERLONG_2,
+    k_TOO_SHORT,
+
+    // 1110____ ________: 3-byte lead
+
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE,
+
+    // 1111____ ________: 4-byte (or invalid) lead
+
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+};
+
+const char k_BYTE_1_LOW[16] = {
+    // The errors that can be witnessed by a pair of bytes, indexed by the low
+    // nibble of the first byte.
+
+    // ____0000 ________ and ____0001 ________
+
+    static_cast<char>(k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4),
+    static_cast<char>(k_CARRY | k_OVERLONG_2),
+
+    // ____001_ ________
+
+    static_cast<char>(k_CARRY),
+    static_cast<char>(k_CARRY),
+
+    // ____0100 ________
+
+    static_cast<char>(k_CARRY | k_TOO_LARGE),
+
+    // ____0101 ________ to ____1100 ________
+
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+
+    // ____1101 ________
+
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE),
+
+    // ____111_ ________
+
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000),
+    static_cast<char>(k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000)
+};
+
+const char k_BYTE_2_HIGH[16] = {
+    // The errors that can be witnessed by a pair of bytes, indexed by the high
+    // nibble of the second byte.
+
+    // ________ 0_______: ASCII
+
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+
+    // ________ 1000____
+
+    static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                                            | k_TOO_LARGE_1000 | k_OVERLONG_4),
+
+    // ________ 1001____
+
+    static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3
+                                                               | k_TOO_LARGE),
+
+    // ________ 101_____
+
+    static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE
+                                                               | k_TOO_LARGE),
+    static_cast<char>(k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE
+                                                               | k_TOO_LARGE),
+
+    // ________ 11______: lead
+
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT
+};
+
+const bsls::Types::size_type k_BLOCK_SIZE = 64;
+    // The number of bytes examined by each step of the vector validators.
+
+const bsls::Types::size_type k_MIN_VECTOR_LENGTH = 64;
+    // The minimum length of a string for which 'isValid' and
+    // 'numCodePointsIfValid' use a vector validator.
+
+#ifdef BDLDE_UTF8UTIL_X86
+
+                          // -------------------
+                          // SSE4 Implementation
+                          // -------------------
+
+#define BDLDE_UTF8UTIL_SSE4_TARGET                                            \
+                             __attribute__((target("ssse3,sse4.1,popcnt")))
+    // Enable the SSSE3, SSE4.1, and POPCNT instructions in the annotated
+    // function, which must be invoked only if the running CPU supports them.
+
+#define BDLDE_UTF8UTIL_AVX2_TARGET __attribute__((target("avx2,popcnt")))
+    // Enable the AVX2 and POPCNT instructions in the annotated function, which
+    // must be invoked only if the running CPU (and operating system) supports
+    // them.
+
+struct State128 {
+    // This 'struct' holds the state of the SSE4 validator between vectors.
+
+    __m128i d_error;           // non-zero if an error has been found
+    __m128i d_prevInput;       // the previous vector of input
+    __m128i d_prevIncomplete;  // non-zero if 'd_prevInput' ends with an
+                               // incomplete sequence
+};
+
+BDLDE_UTF8UTIL_SSE4_TARGET
+inline
+__m128i checkVector128(__m128i input, __m128i prevInput)
+    // Return a vector having a non-zero byte for each byte of the specified
+    // 'input' that, together with the bytes preceding it in the specified
+    // 'prevInput' and 'input', is not valid UTF-8, and zero bytes otherwise.
+{
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, prevInput, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, prevInput, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prevInput, 13);
+
+    const __m128i byte1High = _mm_shuffle_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                              k_BYTE_1_HIGH)),
+                   _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+    const __m128i byte1Low  = _mm_shuffle_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                               k_BYTE_1_LOW)),
+                   _mm_and_si128(prev1, nibbleMask));
+    const __m128i byte2High = _mm_shuffle_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                                                              k_BYTE_2_HIGH)),
+                   _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+
+    const __m128i specialCases = _mm_and_si128(_mm_and_si128(byte1High,
+                                                             byte1Low),
+                                               byte2High);
+
+    // The high bit of 'must23' is set for each byte that must be the second
+    // continuation byte of a 3- or 4-byte sequence.
+
+    const __m128i must23 = _mm_or_si128(
+                    _mm_subs_epu8(prev2, _mm_set1_epi8(char(0xe0 - 0x80))),
+                    _mm_subs_epu8(prev3, _mm_set1_epi8(char(0xf0 - 0x80))));
+
+    return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8(char(0x80))),
+                         specialCases);
+}
+
+BDLDE_UTF8UTIL_SSE4_TARGET
+inline
+__m128i isIncomplete128(__m128i input)
+    // Return a vector having a non-zero byte if the specified 'input' ends
+    // with the lead byte of a sequence that it does not complete, and zero
+    // bytes otherwise.
+{
+    return _mm_subs_epu8(input, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1,
+                                              char(0xf0 - 1),
+                                              char(0xe0 - 1),
+                                              char(0xc0 - 1)));
+}
+
+BDLDE_UTF8UTIL_SSE4_TARGET
+inline
+int checkBlock128(State128 *state, const char *block)
+    // Validate the 'k_BLOCK_SIZE' bytes at the specified 'block' following
+    // the input described by the specified 'state', update 'state', and return
+    // the number of continuation bytes in 'block'.
+{
+    const __m128i *vectors = reinterpret_cast<const __m128i *>(block);
+
+    const __m128i in0 = _mm_loadu_si128(vectors + 0);
+    const __m128i in1 = _mm_loadu_si128(vectors + 1);
+    const __m128i in2 = _mm_loadu_si128(vectors + 2);
+    const __m128i in3 = _mm_loadu_si128(vectors + 3);
+
+    int numContinuations = 0;
+
+    if (0 == _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(in0, in1),
+                                            _mm_or_si128(in2, in3)))) {
+        state->d_error = _mm_or_si128(state->d_error, state->d_prevIncomplete);
+    }
+    else {
+        state->d_error = _mm_or_si128(
+                           state->d_error,
+                           _mm_or_si128(
+                               _mm_or_si128(
+                                    checkVector128(in0, state->d_prevInput),
+                                    checkVector128(in1, in0)),
+                               _mm_or_si128(checkVector128(in2, in1),
+                                            checkVector128(in3, in2))));
+        state->d_prevIncomplete = isIncomplete128(in3);
+
+        // Continuation bytes are those less than 0xc0 when compared as signed
+        // bytes (i.e., the bytes in '[-128 .. -65]').
+
+        const __m128i lowestLead = _mm_set1_epi8(char(0xc0));
+        const bsls::Types::Uint64 mask =
+            static_cast<bsls::Types::Uint64>(
+                     _mm_movemask_epi8(_mm_cmplt_epi8(in0, lowestLead)))
+          | static_cast<bsls::Types::Uint64>(
+                     _mm_movemask_epi8(_mm_cmplt_epi8(in1, lowestLead))) << 16
+          | static_cast<bsls::Types::Uint64>(
+                     _mm_movemask_epi8(_mm_cmplt_epi8(in2, lowestLead))) << 32
+          | static_cast<bsls::Types::Uint64>(
+                     _mm_movemask_epi8(_mm_cmplt_epi8(in3, lowestLead))) << 48;
+
+        numContinuations = __builtin_popcountll(mask);
+    }
+    state->d_prevInput = in3;
+
+    return numContinuations;
+}
+
+BDLDE_UTF8UTIL_SSE4_TARGET
+bsls::Types::IntPtr numCodePointsIfValidSse4(const char             *string,
+                                             bsls::Types::size_type  length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if it is valid UTF-8, and a negative value
+    // otherwise.
+{
+    State128 state;
+    state.d_error          = _mm_setzero_si128();
+    state.d_prevInput      = _mm_setzero_si128();
+    state.d_prevIncomplete = _mm_setzero_si128();
+
+    const char *pc        = string;
+    const char *const end = string + length;
+
+    bsls::Types::IntPtr numContinuations = 0;
+
+    for (; end - pc >= static_cast<bsls::Types::IntPtr>(k_BLOCK_SIZE);
+                                                          pc += k_BLOCK_SIZE) {
+        numContinuations += checkBlock128(&state, pc);
+
+        if (!_mm_testz_si128(state.d_error, state.d_error)) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    if (pc < end) {
+        char buffer[k_BLOCK_SIZE] = { 0 };
+        bsl::memcpy(buffer, pc, end - pc);
+
+        numContinuations += checkBlock128(&state, buffer);
+    }
+
+    state.d_error = _mm_or_si128(state.d_error, state.d_prevIncomplete);
+
+    return _mm_testz_si128(state.d_error, state.d_error)
+           ? static_cast<bsls::Types::IntPtr>(length) - numContinuations
+           : -1;
+}
+
+                          // -------------------
+                          // AVX2 Implementation
+                          // -------------------
+
+struct State256 {
+    // This 'struct' holds the state of the AVX2 validator between vectors.
+
+    __m256i d_error;           // non-zero if an error has been found
+    __m256i d_prevInput;       // the previous vector of input
+    __m256i d_prevIncomplete;  // non-zero if 'd_prevInput' ends with an
+                               // incomplete sequence
+};
+
+BDLDE_UTF8UTIL_AVX2_TARGET
+inline
+__m256i loadTable256(const char *table)
+    // Return a vector holding two copies of the 16 bytes at the specified
+    // 'table'.
+{
+    return _mm256_broadcastsi128_si256(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+}
+
+BDLDE_UTF8UTIL_AVX2_TARGET
+inline
+__m256i checkVector256(__m256i input, __m256i prevInput)
+    // Return a vector having a non-zero byte for each byte of the specified
+    // 'input' that, together with the bytes preceding it in the specified
+    // 'prevInput' and 'input', is not valid UTF-8, and zero bytes otherwise.
+{
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+
+    // 'shifted' holds the high lane of 'prevInput' and the low lane of
+    // 'input', so that 'alignr' can shift bytes across the lane boundary.
+
+    const __m256i shifted = _mm256_permute2x128_si256(prevInput, input, 0x21);
+    const __m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i byte1High = _mm256_shuffle_epi8(
+                    loadTable256(k_BYTE_1_HIGH),
+                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibbleMask));
+    const __m256i byte1Low  = _mm256_shuffle_epi8(
+                    loadTable256(k_BYTE_1_LOW),
+                    _mm256_and_si256(prev1, nibbleMask));
+    const __m256i byte2High = _mm256_shuffle_epi8(
+                    loadTable256(k_BYTE_2_HIGH),
+                    _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask));
+
+    const __m256i specialCases = _mm256_and_si256(
+                                         _mm256_and_si256(byte1High, byte1Low),
+                                         byte2High);
+
+    const __m256i must23 = _mm256_or_si256(
+              _mm256_subs_epu8(prev2, _mm256_set1_epi8(char(0xe0 - 0x80))),
+              _mm256_subs_epu8(prev3, _mm256_set1_epi8(char(0xf0 - 0x80))));
+
+    return _mm256_xor_si256(
+                      _mm256_and_si256(must23, _mm256_set1_epi8(char(0x80))),
+                      specialCases);
+}
+
+BDLDE_UTF8UTIL_AVX2_TARGET
+inline
+__m256i isIncomplete256(__m256i input)
+    // Return a vector having a non-zero byte if the specified 'input' ends
+    // with the lead byte of a sequence that it does not complete, and zero
+    // bytes otherwise.
+{
+    return _mm256_subs_epu8(input, _mm256_setr_epi8(
+                                              -1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1,
+                                              char(0xf0 - 1),
+                                              char(0xe0 - 1),
+                                              char(0xc0 - 1)));
+}
+
+BDLDE_UTF8UTIL_AVX2_TARGET
+inline
+int checkBlock256(State256 *state, const char *block)
+    // Validate the 'k_BLOCK_SIZE' bytes at the specified 'block' following
+    // the input described by the specified 'state', update 'state', and return
+    // the number of continuation bytes in 'block'.
+{
+    const __m256i *vectors = reinterpret_cast<const __m256i *>(block);
+
+    const __m256i in0 = _mm256_loadu_si256(vectors + 0);
+    const __m256i in1 = _mm256_loadu_si256(vectors + 1);
+
+    int numContinuations = 0;
+
+    if (0 == _mm256_movemask_epi8(_mm256_or_si256(in0, in1))) {
+        state->d_error = _mm256_or_si256(state->d_error,
+                                         state->d_prevIncomplete);
+    }
+    else {
+        state->d_error = _mm256_or_si256(
+                            state->d_error,
+                            _mm256_or_si256(
+                                    checkVector256(in0, state->d_prevInput),
+                                    checkVector256(in1, in0)));
+        state->d_prevIncomplete = isIncomplete256(in1);
+
+        const __m256i lowestLead = _mm256_set1_epi8(char(0xc0));
+        const bsls::Types::Uint64 mask =
+           static_cast<bsls::Types::Uint64>(static_cast<unsigned int>(
+                 _mm256_movemask_epi8(_mm256_cmpgt_epi8(lowestLead, in0))))
+         | static_cast<bsls::Types::Uint64>(static_cast<unsigned int>(
+                 _mm256_movemask_epi8(_mm256_cmpgt_epi8(lowestLead, in1))))
+                                                                        << 32;
+
+        numContinuations = __builtin_popcountll(mask);
+    }
+    state->d_prevInput = in1;
+
+    return numContinuations;
+}
+
+BDLDE_UTF8UTIL_AVX2_TARGET
+bsls::Types::IntPtr numCodePointsIfValidAvx2(const char             *string,
+                                             bsls::Types::size_type  length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if it is valid UTF-8, and a negative value
+    // otherwise.
+{
+    State256 state;
+    state.d_error          = _mm256_setzero_si256();
+    state.d_prevInput      = _mm256_setzero_si256();
+    state.d_prevIncomplete = _mm256_setzero_si256();
+
+    const char *pc        = string;
+    const char *const end = string + length;
+
+    bsls::Types::IntPtr numContinuations = 0;
+    bool                isValid          = true;
+
+    for (; end - pc >= static_cast<bsls::Types::IntPtr>(k_BLOCK_SIZE);
+                                                          pc += k_BLOCK_SIZE) {
+        numContinuations += checkBlock256(&state, pc);
+
+        if (!_mm256_testz_si256(state.d_error, state.d_error)) {
+            isValid = false;
+            break;
+        }
+    }
+
+    if (isValid) {
+        if (pc < end) {
+            char buffer[k_BLOCK_SIZE] = { 0 };
+            bsl::memcpy(buffer, pc, end - pc);
+
+            numContinuations += checkBlock256(&state, buffer);
+        }
+
+        state.d_error = _mm256_or_si256(state.d_error,
+                                        state.d_prevIncomplete);
+        isValid = _mm256_testz_si256(state.d_error, state.d_error);
+    }
+
+    // Avoid the penalty for mixing 256-bit and legacy SSE instructions in the
+    // caller.
+
+    _mm256_zeroupper();
+
+    return isValid
+           ? static_cast<bsls::Types::IntPtr>(length) - numContinuations
+           : -1;
+}
+
+bdlde::Utf8Util_Impl::Implementation detectImplementation()
+    // Return the widest implementation supported by the running CPU.
+{
+    if (!bdlde::CpuFeatures::hasSsse3()
+     || !bdlde::CpuFeatures::hasSse41()
+     || !bdlde::CpuFeatures::hasPopcnt()) {
+        return bdlde::Utf8Util_Impl::e_SCALAR;                        // RETURN
+    }
+
+    return bdlde::CpuFeatures::hasAvx2() ? bdlde::Utf8Util_Impl::e_AVX2
+                                         : bdlde::Utf8Util_Impl::e_SSE4;
+}
+
+#else
+
+bdlde::Utf8Util_Impl::Implementation detectImplementation()
+    // Return the widest implementation supported by the running CPU.
+{
+    return bdlde::Utf8Util_Impl::e_SCALAR;
+}
+
+#endif  // BDLDE_UTF8UTIL_X86
+
+const bdlde::Utf8Util_Impl::Implementation s_implementation =
+                                                        detectImplementation();
+    // The implementation used by 'Utf8Util'.  Note that 's_implementation' is
+    // 'e_SCALAR' (zero) if 'Utf8Util' is used during static initialization
+    // before this variable is initialized.
+
+bsls::Types::IntPtr numCodePointsIfValidImp(
+                      bdlde::Utf8Util_Impl::Implementation  implementation,
+                      const char                           *string,
+                      bsls::Types::size_type                length)
+    // Return the number of Unicode code points in the specified 'string'
+    // having the specified 'length' if it is valid UTF-8, and a negative value
+    // otherwise, using the specified 'implementation'.
+{
+    switch (implementation) {
+#ifdef BDLDE_UTF8UTIL_X86
+      case bdlde::Utf8Util_Impl::e_AVX2: {
+        return numCodePointsIfValidAvx2(string, length);              // RETURN
+      }
+      case bdlde::Utf8Util_Impl::e_SSE4: {
+        return numCodePointsIfValidSse4(string, length);              // RETURN
+      }
+#endif
+      default: {
+        const char *dummy = 0;
+        return validateAndCountCodePoints(&dummy, string, length);    // RETURN
+      }
+    }
+}
+
+}  // close unnamed namespace
+
 namespace BloombergLP {
 
 namespace bdlde {
@@ -654,6 +1265,17 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
           case 7: {
             // binary: 0xxxxxxx: ASCII and possible '\0'
 
+            // If another ASCII byte follows, skip the rest of the run (but no
+            // more than 'numCodePoints' code points) in one step.
+
+            if (next < endOfInput && 0 == (*next & 0x80)
+                                  && ret + 1 < numCodePoints) {
+                const IntPtr numAscii = bsl::min<IntPtr>(
+                                    numCodePoints - ret - 1,
+                                    numAsciiBytes(next, endOfInput - next));
+                next += numAscii;
+                ret  += numAscii;
+            }
           } continue;
 
           case 8:
@@ -1049,7 +1671,7 @@ bool Utf8Util::isValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
-    return validateAndCountCodePoints(invalidString, string, length) >= 0;
+    return numCodePointsIfValid(invalidString, string, length) >= 0;
 }
 
 Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
@@ -1069,6 +1691,18 @@ Utf8Util::IntPtr Utf8Util::numCodePointsIfValid(const char **invalidString,
     BSLS_ASSERT(string);
     BSLS_ASSERT(0 <= bsls::Types::IntPtr(length));
 
+    if (length >= k_MIN_VECTOR_LENGTH &&
+                                Utf8Util_Impl::e_SCALAR != s_implementation) {
+        const IntPtr ret = numCodePointsIfValidImp(s_implementation,
+                                                   string,
+                                                   length);
+        if (0 <= ret) {
+            return ret;                                               // RETURN
+        }
+
+        // The string is invalid; fall through to locate the error.
+    }
+
     return validateAndCountCodePoints(invalidString, string, length);
 }
 
@@ -1180,6 +1814,35 @@ Utf8Util::IntPtr Utf8Util::numBytesIfValid(
     return numBytes;
 }
 
+Utf8Util::size_type Utf8Util::numLeadingAsciiBytes(const char *string,
+                                                   size_type   length)
+{
+    BSLS_ASSERT(string || 0 == length);
+
+    return numAsciiBytes(string, length);
+}
+
+                            // --------------------
+                            // struct Utf8Util_Impl
+                            // --------------------
+
+// CLASS METHODS
+bool Utf8Util_Impl::isAvailable(Implementation implementation)
+{
+    return implementation <= detectImplementation();
+}
+
+Utf8Util_Impl::IntPtr Utf8Util_Impl::numCodePointsIfValid(
+                                             Implementation  implementation,
+                                             const char     *string,
+                                             size_type       length)
+{
+    BSLS_ASSERT(string);
+    BSLS_ASSERT_SAFE(isAvailable(implementation));
+
+    return numCodePointsIfValidImp(implementation, string, length);
+}
+
 }  // close package namespace
 
 }  // close enterprise namespace
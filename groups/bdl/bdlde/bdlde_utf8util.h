@@ -17,6 +17,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlde::Utf8Util: namespace for utilities for UTF-8 encodings
+//  bdlde::Utf8Util_Impl: alternative validators for testing
 //
 //@DESCRIPTION: This component provides, within the 'bdlde::Utf8Util' 'struct',
 // a suite of static functions supporting UTF-8 encoded strings.  Two
@@ -28,7 +29,7 @@ BSLS_IDENT("$Id: $")
 // meaning that only 1-, 2-, 3-, and 4-byte sequences are allowed.  Values
 // above 'U+10ffff' are also not allowed.
 //
-// Six types of functions are provided:
+// Seven types of functions are provided:
 //
 //: o 'isValid', which checks for validity, per RFC 3629, of a (candidate)
 //:   UTF-8 string.  "Overlong values", that is, values encoded in more bytes
@@ -49,6 +50,9 @@ BSLS_IDENT("$Id: $")
 //: o 'numBytesIfValid', which returns the number of bytes a specified number
 //:   of Unicode code points occupy in a UTF-8 string.
 //:
+//: o 'numLeadingAsciiBytes', which returns the length of the longest prefix
+//:   of a string that consists only of ASCII (i.e., 7-bit) bytes.
+//:
 //: o 'getByteSize', which returns the length of a single UTF-8 encoded
 //:   character.
 //:
@@ -68,6 +72,30 @@ BSLS_IDENT("$Id: $")
 //  http://en.wikipedia.org/wiki/Utf-8
 //..
 //
+///Performance
+///-----------
+// The functions taking an explicit length examine many bytes per step where
+// possible:
+//
+//: o Runs of ASCII bytes are skipped 16 bytes (on x86-64) or 8 bytes (on other
+//:   platforms) at a time by 'advanceIfValid', 'numLeadingAsciiBytes', and the
+//:   scalar validator.
+//:
+//: o On x86 platforms (with GCC or clang), 'isValid' and
+//:   'numCodePointsIfValid' validate strings of at least 64 bytes with the
+//:   vectorized "lookup" algorithm described by John Keiser and Daniel Lemire
+//:   ("Validating UTF-8 In Less Than One Instruction Per Byte", Software:
+//:   Practice and Experience, 51(5), 2021), using the widest of the AVX2 and
+//:   SSE4.1 instruction sets supported by the running CPU.  If such a string
+//:   is found to be invalid, it is re-examined by the scalar validator to
+//:   locate the offending byte.
+//
+// The functions taking a null-terminated string always process one code point
+// at a time, so that no byte beyond the terminating null byte is read.  The
+// results of all implementations are identical.  The struct
+// 'bdlde::Utf8Util_Impl' exposes the individual validators; it should not be
+// used other than to test and benchmark.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -485,6 +513,15 @@ struct Utf8Util {
         // characters.  The behavior is undefined unless 'string' is a valid
         // UTF-8 string.
 
+    static size_type numLeadingAsciiBytes(const char *string,
+                                          size_type   length);
+        // Return the number of bytes in the longest prefix of the specified
+        // 'string' having the specified 'length' (in bytes) that consists only
+        // of ASCII (i.e., 7-bit) bytes.  'string' need not be null-terminated
+        // and can contain embedded null bytes.  Note that every prefix of the
+        // returned length is valid UTF-8 having as many Unicode code points as
+        // bytes.
+
     static int getByteSize(const char* codepoint);
         // Return the size in bytes of the specified UTF-8 'codepoint'.  The
         // behavior is undefined unless 'codepoint' points to a valid UTF-8
@@ -499,6 +536,44 @@ struct Utf8Util {
         // non-zero value otherwise.
 };
 
+                            // ====================
+                            // struct Utf8Util_Impl
+                            // ====================
+
+struct Utf8Util_Impl {
+    // This struct provides a namespace for the individual implementations of
+    // the validator used by the 'Utf8Util' functions taking an explicit
+    // length.  The functions in this struct should not be used other than to
+    // test and benchmark.
+
+    // PUBLIC TYPES
+    typedef bsls::Types::size_type       size_type;
+    typedef bsls::Types::IntPtr          IntPtr;
+
+    enum Implementation {
+        // Enumerate the implementations of the validator.
+
+        e_SCALAR,  // portable implementation, one code point at a time
+        e_SSE4,    // SSSE3 and SSE4.1 instructions
+        e_AVX2     // AVX2 instructions
+    };
+
+    // CLASS METHODS
+    static bool isAvailable(Implementation implementation);
+        // Return 'true' if the specified 'implementation' is supported by this
+        // build and by the running CPU, and 'false' otherwise.
+
+    static IntPtr numCodePointsIfValid(Implementation  implementation,
+                                       const char     *string,
+                                       size_type       length);
+        // Return the number of Unicode code points in the specified 'string'
+        // having the specified 'length' (in bytes) if 'string' contains valid
+        // UTF-8, and a negative value otherwise, using the specified
+        // 'implementation'.  'string' need not be null-terminated and can
+        // contain embedded null bytes.  The behavior is undefined unless
+        // 'isAvailable(implementation)' is 'true'.
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -14,12 +14,14 @@
 #include <bslim_testutil.h>
 
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_string.h>
@@ -30,6 +32,9 @@ using bsl::cout;
 using bsl::cerr;
 using bsl::endl;
 using bsl::flush;
+using bsl::left;
+using bsl::right;
+using bsl::setw;
 using bsl::size_t;
 
 // Suppress some bde_verify warnings for this test driver.
@@ -57,8 +62,12 @@ using bsl::size_t;
 //: o Test case 10 Test 'numBytesIfValid'.
 //: o Test case 11 Test 'getByteSize'.
 //: o Test case 12 Test 'appendUtf8Character'.
+//: o Test case 13 Test 'numLeadingAsciiBytes' and the vector validators.
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [13] size_type numLeadingAsciiBytes(const char *, size_type);
+// [13] bool Utf8Util_Impl::isAvailable(Implementation);
+// [13] IntPtr Utf8Util_Impl::numCodePointsIfValid(I, const char *, int);
 // [12] int appendUtf8Character(bsl::string *, unsigned int);
 // [11] int getByteSize(const char *);
 // [10] IntPtr numBytesIfValid(const bslstl::StringRef&, IntPtr);
@@ -97,11 +106,12 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [13] USAGE EXAMPLE 1
-// [14] USAGE EXAMPLE 2
+// [14] USAGE EXAMPLE 1
+// [15] USAGE EXAMPLE 2
 // [ 9] 'advanceIfValid' on correct input followed by incorrect input
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] THROUGHPUT TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2802,7 +2812,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'
         //
@@ -2913,7 +2923,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' AND 'numCodePoints*'
         //
@@ -3012,6 +3022,297 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING VECTORIZED VALIDATION
+        //
+        // Concerns:
+        //: 1 'numLeadingAsciiBytes' returns the length of the longest prefix
+        //:   of its input consisting of ASCII bytes, for every alignment of
+        //:   the input and every position of the first non-ASCII byte, and
+        //:   never examines a byte beyond the specified length.
+        //:
+        //: 2 Every available implementation of the validator detects every
+        //:   kind of invalid sequence at every position relative to the
+        //:   vector and block boundaries, including sequences truncated by
+        //:   the end of input.
+        //:
+        //: 3 Every available implementation of the validator counts the code
+        //:   points of valid input correctly, and agrees with the scalar
+        //:   validator on random valid and corrupted input.
+        //:
+        //: 4 'isValid' and 'numCodePointsIfValid' taking a length, which use
+        //:   the vector validators on long input, report the same result and
+        //:   the same error position as the functions taking a null-terminated
+        //:   string, which do not.
+        //:
+        //: 5 'advanceIfValid' taking a length, which skips runs of ASCII
+        //:   bytes, produces the same results as the function taking a
+        //:   null-terminated string, which does not.
+        //
+        // Plan:
+        //: 1 Place a non-ASCII byte at every position of every prefix of up
+        //:   to 64 bytes of a buffer, at 16 different alignments, and verify
+        //:   the result of 'numLeadingAsciiBytes'.  (C-1)
+        //:
+        //: 2 Embed each of a table of valid and invalid sequences at every
+        //:   position of a string of ASCII bytes of various lengths, and
+        //:   verify the result of every available implementation, and of the
+        //:   public functions, against the expected result.  (C-2..4)
+        //:
+        //: 3 Generate random strings of valid UTF-8 with varying proportions
+        //:   of ASCII, corrupt them by overwriting a random byte or by
+        //:   truncation, and verify that every available implementation, and
+        //:   the functions taking a length, produce the same results as the
+        //:   functions taking a null-terminated string.  (C-3..5)
+        //
+        // Testing:
+        //   size_type numLeadingAsciiBytes(const char *, size_type);
+        //   bool Utf8Util_Impl::isAvailable(Implementation);
+        //   IntPtr Utf8Util_Impl::numCodePointsIfValid(I, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING VECTORIZED VALIDATION\n"
+                               "=============================\n";
+
+        typedef bdlde::Utf8Util_Impl Impl;
+
+        const Impl::Implementation IMPLEMENTATIONS[] = { Impl::e_SCALAR,
+                                                         Impl::e_SSE4,
+                                                         Impl::e_AVX2 };
+        const int NUM_IMPLEMENTATIONS = sizeof IMPLEMENTATIONS
+                                      / sizeof *IMPLEMENTATIONS;
+
+        ASSERT(Impl::isAvailable(Impl::e_SCALAR));
+
+        if (verbose) {
+            for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+                P_(ii); P(Impl::isAvailable(IMPLEMENTATIONS[ii]));
+            }
+        }
+
+        if (verbose) cout << "'numLeadingAsciiBytes'\n";
+        {
+            char buffer[16 + 64 + 1];
+
+            for (int offset = 0; offset < 16; ++offset) {
+                for (int length = 0; length <= 64; ++length) {
+                    for (int pos = 0; pos <= length; ++pos) {
+                        bsl::memset(buffer, 'a', sizeof buffer);
+                        buffer[offset + pos] = static_cast<char>(
+                                                        0x80 | (pos & 0x7f));
+
+                        ASSERTV(offset, length, pos,
+                                size_t(pos) == Obj::numLeadingAsciiBytes(
+                                                              buffer + offset,
+                                                              length));
+                    }
+                }
+            }
+
+            ASSERT(0 == Obj::numLeadingAsciiBytes(0, 0));
+        }
+
+        if (verbose) cout << "Sequences at every position\n";
+        {
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_seq_p;    // embedded sequence
+                bool        d_isValid;  // is the sequence valid
+            } SEQUENCES[] = {
+                //LINE  SEQUENCE               VALID
+                //----  ---------------------  -----
+                { L_,   "\xc2\x80",            true  },
+                { L_,   "\xdf\xbf",            true  },
+                { L_,   "\xe0\xa0\x80",        true  },
+                { L_,   "\xed\x9f\xbf",        true  },
+                { L_,   "\xee\x80\x80",        true  },
+                { L_,   "\xef\xbf\xbf",        true  },
+                { L_,   "\xf0\x90\x80\x80",    true  },
+                { L_,   "\xf4\x8f\xbf\xbf",    true  },
+
+                { L_,   "\x80",                false },  // lone continuation
+                { L_,   "\xbf",                false },
+                { L_,   "\xc2\x80\x80",        false },  // too long
+                { L_,   "\xc0\x80",            false },  // overlong 2
+                { L_,   "\xc1\xbf",            false },
+                { L_,   "\xe0\x80\x80",        false },  // overlong 3
+                { L_,   "\xe0\x9f\xbf",        false },
+                { L_,   "\xed\xa0\x80",        false },  // surrogate
+                { L_,   "\xed\xbf\xbf",        false },
+                { L_,   "\xf0\x80\x80\x80",    false },  // overlong 4
+                { L_,   "\xf0\x8f\xbf\xbf",    false },
+                { L_,   "\xf4\x90\x80\x80",    false },  // too large
+                { L_,   "\xf5\x80\x80\x80",    false },
+                { L_,   "\xf8\x88\x80\x80\x80", false },  // 5-byte
+                { L_,   "\xff",                false },
+                { L_,   "\xc2",                false },  // too short
+                { L_,   "\xe1\x80",            false },
+                { L_,   "\xf1\x80\x80",        false },
+                { L_,   "\xc2\xc2\x80",        false },
+                { L_,   "\xe1\x80\xc2\x80",    false },
+            };
+            enum { NUM_SEQUENCES = sizeof SEQUENCES / sizeof *SEQUENCES };
+
+            const int LENGTHS[] = { 63, 64, 65, 100, 128, 131, 200 };
+            enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+            for (int ti = 0; ti < NUM_SEQUENCES; ++ti) {
+                const int   LINE     = SEQUENCES[ti].d_line;
+                const char *SEQ      = SEQUENCES[ti].d_seq_p;
+                const bool  IS_VALID = SEQUENCES[ti].d_isValid;
+                const int   SEQ_LEN  = static_cast<int>(bsl::strlen(SEQ));
+
+                for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                    const int LENGTH = LENGTHS[tj];
+
+                    for (int pos = 0; pos + SEQ_LEN <= LENGTH; ++pos) {
+                        bsl::string str(LENGTH, 'a');
+                        str.replace(pos, SEQ_LEN, SEQ);
+
+                        const Obj::IntPtr EXP = IS_VALID
+                                              ? LENGTH - SEQ_LEN + 1
+                                              : -1;
+
+                        for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+                            const Impl::Implementation IMPL =
+                                                          IMPLEMENTATIONS[ii];
+
+                            if (!Impl::isAvailable(IMPL)) {
+                                continue;
+                            }
+
+                            const Obj::IntPtr ret =
+                                          Impl::numCodePointsIfValid(
+                                                                IMPL,
+                                                                str.data(),
+                                                                str.length());
+                            ASSERTV(LINE, LENGTH, pos, ii, EXP, ret,
+                                    (EXP < 0 && ret < 0) || EXP == ret);
+                        }
+
+                        // The function taking a null-terminated string
+                        // locates the error without the vector validators.
+
+                        const char *expInvalid = 0;
+                        Obj::numCodePointsIfValid(&expInvalid, str.c_str());
+
+                        const char *invalid = 0;
+                        const Obj::IntPtr ret = Obj::numCodePointsIfValid(
+                                                                &invalid,
+                                                                str.data(),
+                                                                str.length());
+                        ASSERTV(LINE, LENGTH, pos, EXP, ret,
+                                (EXP < 0 && ret < 0) || EXP == ret);
+                        ASSERTV(LINE, LENGTH, pos,
+                                IS_VALID || expInvalid == invalid);
+                        ASSERTV(LINE, LENGTH, pos,
+                                IS_VALID || str.data() + pos <= invalid);
+                        ASSERTV(LINE, LENGTH, pos, IS_VALID ==
+                                      Obj::isValid(str.data(), str.length()));
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "Random valid and corrupted strings\n";
+        {
+            for (int ti = 0; ti < 20 * 1000; ++ti) {
+                // Choose the percentage of code points that are ASCII.
+
+                const unsigned asciiPercent = 0 == ti % 4
+                                            ? 100
+                                            : randUnsigned() % 101;
+                const size_t   length       = randUnsigned() % 400;
+
+                bsl::string str;
+                while (str.length() < length) {
+                    if (randUnsigned() % 100 < asciiPercent) {
+                        appendRand1Byte(&str);
+                    }
+                    else {
+                        appendRandCorrectCodePoint(&str, false);
+                    }
+                }
+
+                for (int tj = 0; tj < 3; ++tj) {
+                    bsl::string corrupt = str;
+
+                    if (1 == tj && !corrupt.empty()) {
+                        corrupt[randUnsigned() % corrupt.length()] =
+                                  static_cast<char>(randUnsigned() % 255 + 1);
+                    }
+                    else if (2 == tj) {
+                        corrupt.resize(
+                                    randUnsigned() % (corrupt.length() + 1));
+                    }
+
+                    const char        *expInvalid = 0;
+                    const Obj::IntPtr  EXP = Obj::numCodePointsIfValid(
+                                                              &expInvalid,
+                                                              corrupt.c_str());
+                    ASSERTV(ti, 0 != tj || 0 <= EXP);
+
+                    for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+                        const Impl::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+                        if (!Impl::isAvailable(IMPL)) {
+                            continue;
+                        }
+
+                        const Obj::IntPtr ret = Impl::numCodePointsIfValid(
+                                                             IMPL,
+                                                             corrupt.data(),
+                                                             corrupt.length());
+                        ASSERTV(ti, tj, ii, EXP, ret,
+                                (EXP < 0 && ret < 0) || EXP == ret);
+                    }
+
+                    const char        *invalid = 0;
+                    const Obj::IntPtr  ret = Obj::numCodePointsIfValid(
+                                                             &invalid,
+                                                             corrupt.data(),
+                                                             corrupt.length());
+                    ASSERTV(ti, tj, EXP, ret,
+                            (EXP < 0 && ret < 0) || EXP == ret);
+                    ASSERTV(ti, tj, 0 <= EXP || expInvalid == invalid);
+
+                    const Obj::IntPtr NUM_CODE_POINTS[] = {
+                               0,
+                               1,
+                               static_cast<Obj::IntPtr>(randUnsigned() % 100),
+                               INT_MAX };
+
+                    for (int tk = 0; tk < 4; ++tk) {
+                        const Obj::IntPtr N = NUM_CODE_POINTS[tk];
+
+                        int         expStatus = 0;
+                        const char *expResult = 0;
+                        const Obj::IntPtr EXP_ADVANCED = Obj::advanceIfValid(
+                                                              &expStatus,
+                                                              &expResult,
+                                                              corrupt.c_str(),
+                                                              N);
+
+                        int         status = 0;
+                        const char *result = 0;
+                        const Obj::IntPtr advanced = Obj::advanceIfValid(
+                                                             &status,
+                                                             &result,
+                                                             corrupt.data(),
+                                                             corrupt.length(),
+                                                             N);
+
+                        ASSERTV(ti, tj, N, EXP_ADVANCED, advanced,
+                                EXP_ADVANCED == advanced);
+                        ASSERTV(ti, tj, N, expStatus, status,
+                                expStatus == status);
+                        ASSERTV(ti, tj, N, expResult == result);
+                    }
+                }
+            }
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING 'appendUtf8Character'
@@ -5059,6 +5360,165 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        //: 1 We want to compare the throughput of the implementations of the
+        //:   validator, and of 'advanceIfValid', on text dominated by ASCII,
+        //:   by CJK ideographs (3-byte sequences), and by emoji (4-byte
+        //:   sequences).
+        //
+        // Plan:
+        //: 1 Build a 1MB corpus of each kind of text, and validate and count
+        //:   the code points of each corpus with each available
+        //:   implementation, with the public functions taking a length, and
+        //:   with the public functions taking a null-terminated string,
+        //:   processing about 256MB of text for each, and report the
+        //:   throughput in GB/s.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST\n"
+                               "===============\n";
+
+        typedef bdlde::Utf8Util_Impl Impl;
+
+        const Impl::Implementation IMPLEMENTATIONS[] = { Impl::e_SCALAR,
+                                                         Impl::e_SSE4,
+                                                         Impl::e_AVX2 };
+        const char *const IMPLEMENTATION_NAMES[] = { "scalar",
+                                                     "sse4",
+                                                     "avx2" };
+        const int NUM_IMPLEMENTATIONS = sizeof IMPLEMENTATIONS
+                                      / sizeof *IMPLEMENTATIONS;
+
+        const double GB         = 1024.0 * 1024.0 * 1024.0;
+        const size_t LENGTH     = 1024 * 1024;
+        const int    ITERATIONS = static_cast<int>(GB / 4 / LENGTH);
+
+        const char *const CORPUS_NAMES[] = { "ascii", "cjk", "emoji" };
+        enum { NUM_CORPORA = sizeof CORPUS_NAMES / sizeof *CORPUS_NAMES };
+
+        bsl::string corpora[NUM_CORPORA];
+
+        // ASCII: JSON-like text with an occasional accented letter.
+
+        while (corpora[0].length() < LENGTH) {
+            corpora[0] += "{\"name\": \"caf";
+            Obj::appendUtf8Character(&corpora[0], 0xe9);
+            corpora[0] += "\", \"id\": 12345, \"tags\": [\"a\", \"b\"]}\n";
+        }
+
+        // CJK: ideographs with occasional ASCII punctuation.
+
+        while (corpora[1].length() < LENGTH) {
+            for (int i = 0; i < 20; ++i) {
+                Obj::appendUtf8Character(&corpora[1],
+                                         0x4e00 + randUnsigned() % 0x5200);
+            }
+            corpora[1] += ", ";
+        }
+
+        // Emoji: pictographs separated by spaces.
+
+        while (corpora[2].length() < LENGTH) {
+            Obj::appendUtf8Character(&corpora[2],
+                                     0x1f600 + randUnsigned() % 0x50);
+            Obj::appendUtf8Character(&corpora[2],
+                                     0x1f300 + randUnsigned() % 0x300);
+            corpora[2] += ' ';
+        }
+
+        cout << "corpus  function                    GB/s" << endl;
+
+        for (int ci = 0; ci < NUM_CORPORA; ++ci) {
+            const bsl::string& CORPUS = corpora[ci];
+            const Obj::IntPtr  EXP    = Obj::numCodePointsRaw(CORPUS.data(),
+                                                              CORPUS.length());
+
+            for (int ii = 0; ii < NUM_IMPLEMENTATIONS; ++ii) {
+                const Impl::Implementation IMPL = IMPLEMENTATIONS[ii];
+
+                if (!Impl::isAvailable(IMPL)) {
+                    continue;
+                }
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    ASSERT(EXP == Impl::numCodePointsIfValid(IMPL,
+                                                             CORPUS.data(),
+                                                             CORPUS.length()));
+                }
+                timer.stop();
+
+                cout << setw(6) << CORPUS_NAMES[ci] << "  "
+                     << left << setw(24) << IMPLEMENTATION_NAMES[ii] << right
+                     << setw(6)
+                     << ITERATIONS * double(CORPUS.length()) / GB
+                                                          / timer.elapsedTime()
+                     << endl;
+            }
+
+            {
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    ASSERT(Obj::isValid(CORPUS.data(), CORPUS.length()));
+                }
+                timer.stop();
+
+                cout << setw(6) << CORPUS_NAMES[ci] << "  "
+                     << left << setw(24) << "isValid(length)" << right
+                     << setw(6)
+                     << ITERATIONS * double(CORPUS.length()) / GB
+                                                          / timer.elapsedTime()
+                     << endl;
+            }
+
+            {
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    ASSERT(Obj::isValid(CORPUS.c_str()));
+                }
+                timer.stop();
+
+                cout << setw(6) << CORPUS_NAMES[ci] << "  "
+                     << left << setw(24) << "isValid(null-term)" << right
+                     << setw(6)
+                     << ITERATIONS * double(CORPUS.length()) / GB
+                                                          / timer.elapsedTime()
+                     << endl;
+            }
+
+            {
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    int         status;
+                    const char *result;
+                    ASSERT(EXP == Obj::advanceIfValid(&status,
+                                                      &result,
+                                                      CORPUS.data(),
+                                                      CORPUS.length(),
+                                                      EXP));
+                }
+                timer.stop();
+
+                cout << setw(6) << CORPUS_NAMES[ci] << "  "
+                     << left << setw(24) << "advanceIfValid(length)" << right
+                     << setw(6)
+                     << ITERATIONS * double(CORPUS.length()) / GB
+                                                          / timer.elapsedTime()
+                     << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
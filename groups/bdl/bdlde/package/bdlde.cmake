@@ -6,11 +6,18 @@ bde_prefixed_override(bdlde process_package)
 function(bdlde_process_package retPackage)
     process_package_base("" package ${ARGN})
     bde_struct_get_field(interfaceTarget ${package} INTERFACE_TARGET)
+    # '-msse4.2' is only meaningful (and accepted) when targeting x86.
+    if(CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|i[3-6]86)$")
+        bde_interface_target_compile_options(
+            ${interfaceTarget}
+            PRIVATE
+                $<$<PLATFORM_ID:Darwin>:-msse4.2>
+                $<$<PLATFORM_ID:Linux>:-msse4.2>
+        )
+    endif()
     bde_interface_target_compile_options(
         ${interfaceTarget}
         PRIVATE
-            $<$<PLATFORM_ID:Darwin>:-msse4.2>
-            $<$<PLATFORM_ID:Linux>:-msse4.2>
             $<$<PLATFORM_ID:SunOs>:-xarch=sparc4>
     )
     bde_return(${package})
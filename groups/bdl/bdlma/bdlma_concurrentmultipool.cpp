@@ -19,6 +19,8 @@ BSLS_IDENT_RCSID(bdema_multipool_cpp,"$Id$ $CSID$")
 #include <bslmt_barrier.h>                  // for testing only
 #include <bslmt_lockguard.h>
 #include <bslmt_condition.h>
+#include <bslmt_once.h>
+#include <bslmt_threadutil.h>
 
 #include <bslma_deallocatorproctor.h>
 #include <bslma_autodestructor.h>
@@ -26,8 +28,10 @@ BSLS_IDENT_RCSID(bdema_multipool_cpp,"$Id$ $CSID$")
 
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_performancehint.h>
 #include <bsls_log.h>
+#include <bsls_spinlock.h>
 
 #include <bsl_cstdio.h>  // 'fprintf'
 #include <bsl_cstdint.h>
@@ -45,11 +49,334 @@ enum {
 
 namespace bdlma {
 
+namespace {
+
+bsls::AtomicOperations::AtomicTypes::Uint64 s_nextCachingId = { 0 };
+    // identifier of the multipool that most recently enabled thread caching
+
+bslmt::Once s_cachesKeyOnce = BSLMT_ONCE_INITIALIZER;
+    // guards the creation of 's_cachesKey'
+
+bslmt::ThreadUtil::Key s_cachesKey;
+    // key, shared by all multipools, of the list of the caches of each thread
+
+bsls::SpinLock s_detachLock = BSLS_SPINLOCK_UNLOCKED;
+    // lock serializing the detachment of the caches of a multipool being
+    // destroyed with the release of the caches of an exiting thread (note
+    // that a 'bslmt::QLock' cannot be used by a thread-specific storage
+    // destructor, as it relies on thread-specific storage itself)
+
+}  // close unnamed namespace
+
+                     // ======================================
+                     // struct ConcurrentMultipool::ThreadCache
+                     // ======================================
+
+struct ConcurrentMultipool::ThreadCache {
+    // This 'struct' holds, for each pool of a multipool, a singly-linked list
+    // (a "magazine") of free blocks that can be allocated and deallocated by
+    // the thread owning the cache without synchronization.  The first word of
+    // each block in a magazine holds the address of the next block.  The
+    // magazines are stored immediately after this 'struct', in the same
+    // allocation.
+
+    // TYPES
+    struct Magazine {
+        void *d_head_p;     // first free block, or 0 if empty
+        int   d_numBlocks;  // number of free blocks
+    };
+
+    // DATA
+    ConcurrentMultipool *d_multipool_p;   // multipool owning this cache, or
+                                          // 0 if detached (protected by
+                                          // 's_detachLock')
+
+    bsls::Types::Uint64  d_cachingId;     // 'd_cachingId' of the multipool
+                                          // owning this cache
+
+    bslma::Allocator    *d_allocator_p;   // allocator that supplied this
+                                          // cache (held, not owned)
+
+    ThreadCache         *d_threadNext_p;  // next cache of the same thread
+    ThreadCache         *d_prev_p;        // previous cache of the multipool
+    ThreadCache         *d_next_p;        // next cache of the multipool
+    int                  d_releaseCount;  // value of 'd_releaseCount' of the
+                                          // multipool when the magazines were
+                                          // last known to be valid
+
+    // MANIPULATORS
+    Magazine *magazines()
+        // Return the address of the first element of the array of magazines
+        // of this cache.
+    {
+        return reinterpret_cast<Magazine *>(this + 1);
+    }
+};
+
                         // -------------------------
                         // class ConcurrentMultipool
                         // -------------------------
 
 // PRIVATE MANIPULATORS
+void *ConcurrentMultipool::allocateFromThreadCache(int pool)
+{
+    ThreadCache *cache = threadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return d_pools_p[pool].allocate();                            // RETURN
+    }
+
+    ThreadCache::Magazine& magazine = cache->magazines()[pool];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!magazine.d_head_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Take all but one block of a batch into the magazine, and return the
+        // last block directly.  If the pool throws, the blocks obtained so far
+        // remain in the magazine.
+
+        for (int i = 1; i < d_batchSizes_p[pool]; ++i) {
+            void *block = d_pools_p[pool].allocate();
+            *static_cast<void **>(block) = magazine.d_head_p;
+            magazine.d_head_p = block;
+            ++magazine.d_numBlocks;
+        }
+        return d_pools_p[pool].allocate();                            // RETURN
+    }
+
+    void *block = magazine.d_head_p;
+    magazine.d_head_p = *static_cast<void **>(block);
+    --magazine.d_numBlocks;
+
+    return block;
+}
+
+void ConcurrentMultipool::deallocateToThreadCache(void *block, int pool)
+{
+    ThreadCache *cache = threadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_pools_p[pool].deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    ThreadCache::Magazine& magazine  = cache->magazines()[pool];
+    const int              batchSize = d_batchSizes_p[pool];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                   2 * batchSize <= magazine.d_numBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        for (int i = 0; i < batchSize; ++i) {
+            void *next = *static_cast<void **>(magazine.d_head_p);
+            d_pools_p[pool].deallocate(magazine.d_head_p);
+            magazine.d_head_p = next;
+        }
+        magazine.d_numBlocks -= batchSize;
+    }
+
+    *static_cast<void **>(block) = magazine.d_head_p;
+    magazine.d_head_p = block;
+    ++magazine.d_numBlocks;
+}
+
+void ConcurrentMultipool::flushThreadCache(ThreadCache *cache)
+{
+    ThreadCache::Magazine *magazines = cache->magazines();
+
+    // Blocks cached before the last call to 'release' have been reclaimed
+    // along with the chunks holding them, and must not be returned.
+
+    const bool isValid = cache->d_releaseCount == d_releaseCount.load();
+
+    for (int pool = 0; pool < d_numPools; ++pool) {
+        void *block = magazines[pool].d_head_p;
+        while (isValid && block) {
+            void *next = *static_cast<void **>(block);
+            d_pools_p[pool].deallocate(block);
+            block = next;
+        }
+        magazines[pool].d_head_p    = 0;
+        magazines[pool].d_numBlocks = 0;
+    }
+    cache->d_releaseCount = d_releaseCount.load();
+}
+
+ConcurrentMultipool::ThreadCache *ConcurrentMultipool::lookupThreadCache()
+{
+    ThreadCache *caches = static_cast<ThreadCache *>(
+                                bslmt::ThreadUtil::getSpecific(s_cachesKey));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                             caches && d_cachingId == caches->d_cachingId)) {
+        return caches;                                                // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    ThreadCache *previous = caches;
+    for (ThreadCache *cache = caches ? caches->d_threadNext_p : 0;
+         cache;
+         previous = cache, cache = cache->d_threadNext_p) {
+        if (d_cachingId != cache->d_cachingId) {
+            continue;
+        }
+
+        // Move the cache to the front of the list, unless the list cannot be
+        // updated, in which case it is left unchanged.
+
+        previous->d_threadNext_p = cache->d_threadNext_p;
+        cache->d_threadNext_p    = caches;
+        if (0 != bslmt::ThreadUtil::setSpecific(s_cachesKey, cache)) {
+            cache->d_threadNext_p    = previous->d_threadNext_p;
+            previous->d_threadNext_p = cache;
+        }
+        return cache;                                                 // RETURN
+    }
+    return 0;
+}
+
+ConcurrentMultipool::ThreadCache *ConcurrentMultipool::threadCache()
+{
+    ThreadCache *cache = lookupThreadCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(cache)) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                   cache->d_releaseCount != d_releaseCount.loadRelaxed())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            flushThreadCache(cache);
+        }
+        return cache;                                                 // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    cache = static_cast<ThreadCache *>(d_allocAdapter.allocate(
+                                 sizeof(ThreadCache)
+                               + d_numPools * sizeof(ThreadCache::Magazine)));
+
+    cache->d_multipool_p  = this;
+    cache->d_cachingId    = d_cachingId;
+    cache->d_allocator_p  = d_blockList.allocator();
+    cache->d_prev_p       = 0;
+    cache->d_releaseCount = d_releaseCount.load();
+
+    ThreadCache::Magazine *magazines = cache->magazines();
+    for (int pool = 0; pool < d_numPools; ++pool) {
+        magazines[pool].d_head_p    = 0;
+        magazines[pool].d_numBlocks = 0;
+    }
+
+    // Link the cache at the front of the list of the calling thread.
+
+    cache->d_threadNext_p = static_cast<ThreadCache *>(
+                                bslmt::ThreadUtil::getSpecific(s_cachesKey));
+    if (0 != bslmt::ThreadUtil::setSpecific(s_cachesKey, cache)) {
+        d_allocAdapter.deallocate(cache);
+        return 0;                                                     // RETURN
+    }
+
+    {
+        bsls::SpinLockGuard detachGuard(&s_detachLock);
+        releaseDetachedThreadCaches();
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    cache->d_next_p = d_caches_p;
+    if (d_caches_p) {
+        d_caches_p->d_prev_p = cache;
+    }
+    d_caches_p = cache;
+
+    return cache;
+}
+
+// PRIVATE CLASS METHODS
+int ConcurrentMultipool::initializeCachesKey()
+{
+    bslmt::Once::OnceLock onceLock;
+    if (s_cachesKeyOnce.enter(&onceLock)) {
+        int rc = bslmt::ThreadUtil::createKey(
+                          &s_cachesKey,
+                          (bslmt::ThreadUtil::Destructor)&releaseThreadCaches);
+        if (0 != rc) {
+            // Let a subsequent call try again.
+
+            s_cachesKeyOnce.cancel(&onceLock);
+            return rc;                                                // RETURN
+        }
+        s_cachesKeyOnce.leave(&onceLock);
+    }
+    return 0;
+}
+
+void ConcurrentMultipool::releaseDetachedThreadCaches()
+{
+    ThreadCache *caches = static_cast<ThreadCache *>(
+                                bslmt::ThreadUtil::getSpecific(s_cachesKey));
+
+    ThreadCache  *head = caches;
+    ThreadCache **link = &head;
+    while (ThreadCache *cache = *link) {
+        if (cache->d_multipool_p) {
+            link = &cache->d_threadNext_p;
+        }
+        else {
+            *link = cache->d_threadNext_p;
+            cache->d_allocator_p->deallocate(cache);
+        }
+    }
+
+    if (head != caches) {
+        int rc = bslmt::ThreadUtil::setSpecific(s_cachesKey, head);
+        BSLS_ASSERT(0 == rc);  // The key of the thread already has a value.
+        (void)rc;
+    }
+}
+
+void ConcurrentMultipool::releaseThreadCaches(void *caches)
+{
+    ThreadCache *cache = static_cast<ThreadCache *>(caches);
+
+    while (cache) {
+        ThreadCache *next = cache->d_threadNext_p;
+
+        bsls::SpinLockGuard detachGuard(&s_detachLock);
+
+        ConcurrentMultipool *multipool = cache->d_multipool_p;
+        if (!multipool) {
+            cache->d_allocator_p->deallocate(cache);
+        }
+        else {
+            multipool->flushThreadCache(cache);
+
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&multipool->d_mutex);
+
+                if (cache->d_prev_p) {
+                    cache->d_prev_p->d_next_p = cache->d_next_p;
+                }
+                else {
+                    multipool->d_caches_p = cache->d_next_p;
+                }
+                if (cache->d_next_p) {
+                    cache->d_next_p->d_prev_p = cache->d_prev_p;
+                }
+            }
+
+            // Note that 'd_allocAdapter' locks 'd_mutex'.
+
+            multipool->d_allocAdapter.deallocate(cache);
+        }
+
+        cache = next;
+    }
+}
+
+
 void ConcurrentMultipool::initialize(
                                  bsls::BlockGrowth::Strategy growthStrategy,
                                  int                         maxBlocksPerChunk)
@@ -196,6 +523,9 @@ ConcurrentMultipool(bslma::Allocator *basicAllocator)
 : d_numPools(k_DEFAULT_NUM_POOLS)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -206,6 +536,9 @@ ConcurrentMultipool(int               numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(bsls::BlockGrowth::BSLS_GEOMETRIC, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -216,6 +549,9 @@ ConcurrentMultipool(bsls::BlockGrowth::Strategy  growthStrategy,
 : d_numPools(k_DEFAULT_NUM_POOLS)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategy, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -227,6 +563,9 @@ ConcurrentMultipool(int                          numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategy, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -238,6 +577,9 @@ ConcurrentMultipool(int                                numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategyArray, k_DEFAULT_MAX_CHUNK_SIZE);
 }
@@ -250,6 +592,9 @@ ConcurrentMultipool(int                          numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategy, maxBlocksPerChunk);
 }
@@ -262,6 +607,9 @@ ConcurrentMultipool(int                                numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategyArray, maxBlocksPerChunk);
 }
@@ -274,6 +622,9 @@ ConcurrentMultipool(int                          numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategy, maxBlocksPerChunkArray);
 }
@@ -286,12 +637,31 @@ ConcurrentMultipool(int                                numPools,
 : d_numPools(numPools)
 , d_blockList(basicAllocator)
 , d_allocAdapter(&d_mutex, basicAllocator)
+, d_batchSizes_p(0)
+, d_caches_p(0)
+, d_releaseCount(0)
 {
     initialize(growthStrategyArray, maxBlocksPerChunkArray);
 }
 
 ConcurrentMultipool::~ConcurrentMultipool()
 {
+    if (d_batchSizes_p) {
+        // Detach the caches of the threads that are still running, whose
+        // blocks are reclaimed with the pools, and reclaim the cache of the
+        // calling thread.  The caches of the other threads are reclaimed by
+        // those threads.
+
+        bsls::SpinLockGuard detachGuard(&s_detachLock);
+
+        for (ThreadCache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+            cache->d_multipool_p = 0;
+        }
+        releaseDetachedThreadCaches();
+
+        d_allocAdapter.deallocate(d_batchSizes_p);
+    }
+
     d_blockList.release();
     for (int i = 0; i < d_numPools; ++i) {
         d_pools_p[i].release();
@@ -307,7 +677,10 @@ void *ConcurrentMultipool::allocate(bsls::Types::size_type size)
         if (size <= d_maxBlockSize) {
             const int pool = findPool(size);
 
-            Header *p = static_cast<Header *>(d_pools_p[pool].allocate());
+            Header *p = static_cast<Header *>(
+                                         d_batchSizes_p
+                                         ? allocateFromThreadCache(pool)
+                                         : d_pools_p[pool].allocate());
 
             p->d_header.d_poolIdx = pool;
 
@@ -339,13 +712,77 @@ void ConcurrentMultipool::deallocate(void *address)
         bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
         d_blockList.deallocate(h);
     }
+    else if (d_batchSizes_p) {
+        deallocateToThreadCache(h, pool);
+    }
     else {
         d_pools_p[pool].deallocate(h);
     }
 }
 
+int ConcurrentMultipool::enableThreadCaching(int batchSize)
+{
+    BSLS_ASSERT(1 <= batchSize);
+    BSLS_ASSERT(!d_batchSizes_p);
+
+    int *batchSizes = static_cast<int *>(
+                          d_allocAdapter.allocate(d_numPools * sizeof(int)));
+
+    for (int i = 0; i < d_numPools; ++i) {
+        batchSizes[i] = batchSize;
+    }
+
+    if (0 != initializeCachesKey()) {
+        d_allocAdapter.deallocate(batchSizes);
+        return -1;                                                    // RETURN
+    }
+
+    d_cachingId    = bsls::AtomicOperations::addUint64Nv(&s_nextCachingId, 1);
+    d_batchSizes_p = batchSizes;
+    return 0;
+}
+
+int ConcurrentMultipool::enableThreadCaching(const int *batchSizeArray)
+{
+    BSLS_ASSERT(batchSizeArray);
+    BSLS_ASSERT(!d_batchSizes_p);
+
+    int *batchSizes = static_cast<int *>(
+                          d_allocAdapter.allocate(d_numPools * sizeof(int)));
+
+    for (int i = 0; i < d_numPools; ++i) {
+        BSLS_ASSERT(1 <= batchSizeArray[i]);
+
+        batchSizes[i] = batchSizeArray[i];
+    }
+
+    if (0 != initializeCachesKey()) {
+        d_allocAdapter.deallocate(batchSizes);
+        return -1;                                                    // RETURN
+    }
+
+    d_cachingId    = bsls::AtomicOperations::addUint64Nv(&s_nextCachingId, 1);
+    d_batchSizes_p = batchSizes;
+    return 0;
+}
+
+void ConcurrentMultipool::flushThreadCache()
+{
+    if (d_batchSizes_p) {
+        ThreadCache *cache = lookupThreadCache();
+        if (cache) {
+            flushThreadCache(cache);
+        }
+    }
+}
+
 void ConcurrentMultipool::release()
 {
+    // Invalidate the contents of all thread caches before the blocks they
+    // hold are reclaimed.
+
+    ++d_releaseCount;
+
     for (int i = 0; i < d_numPools; ++i) {
         d_pools_p[i].release();
     }
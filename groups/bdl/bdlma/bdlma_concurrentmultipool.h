@@ -112,6 +112,43 @@ BSLS_IDENT("$Id: $")
 // single value applying to all of the maintained pools, or as an array of
 // values, with the elements applying to each individually maintained pool.
 //
+///Thread Caching
+///--------------
+// By default, every allocation and deallocation request is served by the
+// shared 'bdlma::ConcurrentPool' managing blocks of the appropriate size,
+// which updates the head of its free list with an atomic operation.  When
+// many threads allocate from the same multipool, the cache line holding each
+// free-list head moves between processors on every request, which can come
+// to dominate the cost of allocation on machines with many cores.
+//
+// Calling 'enableThreadCaching' (before the multipool is used) gives each
+// thread that subsequently allocates or deallocates pooled blocks a private
+// cache holding, for each pool, a short list (or "magazine") of free blocks.
+// Pooled allocations and deallocations are then served from the magazine of
+// the calling thread without any synchronization.  A magazine that runs empty
+// is refilled with a *batch* of blocks from the shared pool, and a magazine
+// that holds two batches returns one batch to the shared pool, so that the
+// shared pools are touched only once per batch of requests.  The batch size
+// can be specified either as a single value for all pools, or as an array of
+// values for each individual pool (e.g., to cache fewer blocks of the larger
+// sizes).
+//
+// Blocks held in the cache of one thread are not available to other threads:
+// a thread may hold up to two batches of free blocks for each pool.  The
+// blocks cached by a thread are returned to the shared pools when that thread
+// exits, or earlier if the thread calls 'flushThreadCache'.  Note that a call
+// to 'release' reclaims all memory, including the blocks cached by every
+// thread, exactly as if thread caching were not enabled.
+//
+// Each thread keeps its caches, for every multipool it has used, in a list
+// that is shared by all multipools through a single thread-specific storage
+// key, created when thread caching is first enabled.  Consequently, the
+// number of multipools having thread caching enabled is not limited by the
+// number of thread-specific storage keys.  When a multipool is destroyed,
+// the cache of the calling thread is reclaimed, and the caches of the other
+// threads are detached from the multipool; a detached cache is reclaimed when
+// its thread exits or is next given a cache by any multipool, at which point
+// its memory is returned to the allocator of the (destroyed) multipool.
 //
 ///Usage
 ///-----
@@ -464,8 +501,10 @@ BSLS_IDENT("$Id: $")
 #include <bslma_deleterhelper.h>
 
 #include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_atomic.h>
 #include <bsls_blockgrowth.h>
 #include <bsls_types.h>
 
@@ -506,6 +545,10 @@ class ConcurrentMultipool {
         } d_header;
     };
 
+    struct ThreadCache;
+        // This 'struct' holds the free blocks cached by one thread for each
+        // pool of a multipool.  It is defined in the implementation file.
+
     // DATA
     ConcurrentPool   *d_pools_p;       // array of memory pools, each
                                        // dispensing fixed-size memory blocks
@@ -525,6 +568,24 @@ class ConcurrentMultipool {
     ConcurrentAllocatorAdapter
                       d_allocAdapter;  // thread-safe adapter
 
+    int              *d_batchSizes_p;  // number of blocks moved at once
+                                       // between a thread cache and each
+                                       // pool, or 0 if thread caching is not
+                                       // enabled
+
+    bsls::Types::Uint64
+                      d_cachingId;     // identifier, unique within the
+                                       // process, of the thread caches of
+                                       // this multipool; valid only if
+                                       // 'd_batchSizes_p' is not 0
+
+    ThreadCache      *d_caches_p;      // list of all thread caches (protected
+                                       // by 'd_mutex')
+
+    bsls::AtomicInt   d_releaseCount;  // number of calls to 'release', used
+                                       // to discard the contents of thread
+                                       // caches filled before the last call
+
   private:
     // NOT IMPLEMENTED
     ConcurrentMultipool(const ConcurrentMultipool&);
@@ -546,6 +607,50 @@ class ConcurrentMultipool {
         // with the corresponding growth strategy or max blocks per chunk entry
         // within the array.
 
+    void *allocateFromThreadCache(int pool);
+        // Return the address of a free block from the specified 'pool' cached
+        // by the calling thread, refilling the cache from 'pool' if it is
+        // empty.  The behavior is undefined unless thread caching is enabled.
+
+    void deallocateToThreadCache(void *block, int pool);
+        // Add the specified 'block' to the blocks of the specified 'pool'
+        // cached by the calling thread, first returning a batch of blocks to
+        // 'pool' if the cache is full.  The behavior is undefined unless
+        // thread caching is enabled and 'block' was allocated from 'pool'.
+
+    void flushThreadCache(ThreadCache *cache);
+        // Return every block held by the specified 'cache' to the pool from
+        // which it was allocated.
+
+    ThreadCache *lookupThreadCache();
+        // Return the address of the cache of the calling thread for this
+        // multipool, or 0 if the calling thread has no such cache.  The
+        // behavior is undefined unless thread caching is enabled.
+
+    ThreadCache *threadCache();
+        // Return the address of the cache of the calling thread, creating the
+        // cache if it does not exist, or 0 if the cache could not be
+        // associated with the calling thread.  The behavior is undefined
+        // unless thread caching is enabled.
+
+    // PRIVATE CLASS METHODS
+    static int initializeCachesKey();
+        // Create the thread-specific storage key, shared by all multipools,
+        // of the list of the caches of each thread, if it does not exist.
+        // Return 0 on success, and a non-zero value if the key cannot be
+        // created.
+
+    static void releaseDetachedThreadCaches();
+        // Deallocate the caches of the calling thread that have been detached
+        // from their (destroyed) multipool, and remove them from the list of
+        // the calling thread.  The behavior is undefined unless the caller
+        // holds the lock protecting the detachment of thread caches.
+
+    static void releaseThreadCaches(void *caches);
+        // Return the blocks held by each cache in the specified 'caches' list
+        // to the multipool owning it, and deallocate the caches.  Note that
+        // this function is invoked when a thread having a cache exits.
+
     // PRIVATE ACCESSORS
     int findPool(bsls::Types::size_type size) const;
         // Return the index of the memory pool in this multipool for an
@@ -652,7 +757,10 @@ class ConcurrentMultipool {
 
     ~ConcurrentMultipool();
         // Destroy this multipool.  All memory allocated from this memory pool
-        // is released.
+        // is released.  Note that, if thread caching is enabled, the caches
+        // of the threads other than the calling thread are reclaimed when
+        // those threads exit (see {Thread Caching}), so that the allocator of
+        // this object must remain valid until then.
 
     // MANIPULATORS
     void *allocate(bsls::Types::size_type size);
@@ -690,8 +798,32 @@ class ConcurrentMultipool {
         // allocated using this multipool, and has not already been
         // deallocated.
 
+    int enableThreadCaching(int batchSize);
+    int enableThreadCaching(const int *batchSizeArray);
+        // Enable caching of free pooled blocks in each thread that allocates
+        // memory from, or deallocates memory to, this multipool, moving blocks
+        // between the cache of a thread and a pool in batches of either the
+        // specified 'batchSize' blocks for all pools or, for each pool, the
+        // corresponding entry in the specified 'batchSizeArray'.  Each thread
+        // caches at most two batches of blocks for each pool.  Return 0 on
+        // success, and a non-zero value (leaving thread caching disabled) if
+        // the thread-specific storage required by the caches cannot be
+        // obtained.  The behavior is undefined unless this method is called
+        // before any memory is allocated from this multipool, is not called
+        // concurrently with any other method of this object, thread caching
+        // is not already enabled, and either '1 <= batchSize' or
+        // 'batchSizeArray' has at least 'numPools()' positive values.  See
+        // {Thread Caching}.
+
+    void flushThreadCache();
+        // Return all free blocks cached by the calling thread to the pools
+        // from which they were allocated.  This method has no effect unless
+        // thread caching is enabled.  Note that the blocks cached by a thread
+        // are returned automatically when that thread exits.
+
     void release();
-        // Relinquish all memory currently allocated via this multipool object.
+        // Relinquish all memory currently allocated via this multipool object,
+        // including free blocks held in the cache of any thread.
 
     void reserveCapacity(bsls::Types::size_type size, int numBlocks);
         // Reserve memory from this multipool to satisfy memory requests for at
@@ -701,6 +833,10 @@ class ConcurrentMultipool {
         // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.
 
     // ACCESSORS
+    bool isThreadCachingEnabled() const;
+        // Return 'true' if thread caching is enabled for this multipool, and
+        // 'false' otherwise.
+
     int numPools() const;
         // Return the number of pools managed by this multipool object.
 
@@ -746,6 +882,12 @@ void ConcurrentMultipool::deleteObjectRaw(const TYPE *object)
 }
 
 // ACCESSORS
+inline
+bool ConcurrentMultipool::isThreadCachingEnabled() const
+{
+    return 0 != d_batchSizes_p;
+}
+
 inline
 int ConcurrentMultipool::numPools() const
 {
@@ -65,11 +65,15 @@ using namespace bsl;  // automatically added by script
 // [ 9] void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(bsls::Types::size_type size, int numObjects);
+// [12] int enableThreadCaching(int batchSize);
+// [12] int enableThreadCaching(const int *batchSizeArray);
+// [12] void flushThreadCache();
+// [12] bool isThreadCachingEnabled() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] CONCURRENCY TEST
 // [11] OLD USAGE EXAMPLE
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -295,6 +299,57 @@ extern "C" void *workerThread(void *arg) {
     return arg;
 }
 
+struct CachingThreadArgs {
+    Obj *d_multipool_p;  // multipool to allocate from
+    int  d_size;         // size of each allocation
+    int  d_numBlocks;    // number of blocks to allocate and deallocate
+};
+
+extern "C" void *cachingThread(void *arg)
+    // Allocate '((CachingThreadArgs *)arg)->d_numBlocks' blocks of
+    // '((CachingThreadArgs *)arg)->d_size' bytes from
+    // '((CachingThreadArgs *)arg)->d_multipool_p', deallocate them all, and
+    // return without flushing the thread cache of the calling thread.  This
+    // function is intended to be a thread entry point.
+{
+    CachingThreadArgs *args = static_cast<CachingThreadArgs *>(arg);
+
+    bsl::vector<void *> blocks(bslma::Default::allocator(0));
+    for (int i = 0; i < args->d_numBlocks; ++i) {
+        blocks.push_back(args->d_multipool_p->allocate(args->d_size));
+    }
+    for (int i = 0; i < args->d_numBlocks; ++i) {
+        args->d_multipool_p->deallocate(blocks[i]);
+    }
+    return arg;
+}
+
+struct OutlivingThreadArgs {
+    Obj             *d_first_p;   // multipool destroyed while thread runs
+    Obj             *d_second_p;  // multipool used after 'd_first_p' is
+                                  // destroyed
+    bslmt::Barrier  *d_barrier_p; // barrier for 2 threads
+};
+
+extern "C" void *outlivingThread(void *arg)
+    // Allocate and deallocate a block from
+    // '((OutlivingThreadArgs *)arg)->d_first_p', wait twice on
+    // '((OutlivingThreadArgs *)arg)->d_barrier_p' (between which the main
+    // thread destroys the first multipool), then allocate and deallocate a
+    // block from '((OutlivingThreadArgs *)arg)->d_second_p'.  This function
+    // is intended to be a thread entry point.
+{
+    OutlivingThreadArgs *args = static_cast<OutlivingThreadArgs *>(arg);
+
+    args->d_first_p->deallocate(args->d_first_p->allocate(8));
+
+    args->d_barrier_p->wait();
+    args->d_barrier_p->wait();
+
+    args->d_second_p->deallocate(args->d_second_p->allocate(8));
+    return arg;
+}
+
 //=============================================================================
 //                                USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -661,7 +716,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -730,6 +785,377 @@ int main(int argc, char *argv[])
             // Now 'pM' and 'pBuf' are also invalid addresses.
         }
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING THREAD CACHING
+        //
+        // Concerns:
+        //: 1 Thread caching is disabled by default, and is enabled by a
+        //:   successful call to either overload of 'enableThreadCaching'.
+        //:
+        //: 2 A block deallocated by a thread is reused by the next allocation
+        //:   of the same size by that thread.
+        //:
+        //: 3 'flushThreadCache' returns the blocks cached by the calling
+        //:   thread to the shared pools, where they can be allocated by
+        //:   another thread without replenishing the pools.
+        //:
+        //: 4 The blocks cached by a thread are returned to the shared pools
+        //:   when that thread exits, and the memory of its cache is
+        //:   reclaimed.
+        //:
+        //: 5 A thread caches at most two batches of blocks per pool.
+        //:
+        //: 6 'release' reclaims the blocks held in thread caches, and a cache
+        //:   holding such blocks can be used safely afterwards.
+        //:
+        //: 7 Allocation and deallocation are thread-safe with thread caching
+        //:   enabled.
+        //:
+        //: 8 The destructor reclaims the caches of threads that have not
+        //:   exited.
+        //:
+        //: 9 The number of multipools having thread caching enabled is not
+        //:   limited by the number of thread-specific storage keys.
+        //:
+        //:10 The cache of a thread that outlives a multipool is reclaimed, and
+        //:   the thread can continue to use other multipools.
+        //
+        // Plan:
+        //: 1 Verify 'isThreadCachingEnabled' before and after calling each
+        //:   overload of 'enableThreadCaching'.  (C-1)
+        //:
+        //: 2 Deallocate and reallocate a block and verify the address is
+        //:   the same.  (C-2)
+        //:
+        //: 3 Using a batch size large enough to cache every block, allocate
+        //:   and deallocate blocks in one thread, flush or exit the thread,
+        //:   then allocate the same number of blocks in another thread and
+        //:   verify, using a test allocator, that the only memory allocated
+        //:   is the cache of the new thread.  (C-3..4)
+        //:
+        //: 4 Using a batch size of 2, allocate and deallocate a number of
+        //:   blocks, then flush the cache and verify that the blocks beyond
+        //:   the four that remained cached were returned to the shared pool
+        //:   by allocating from another thread.  (C-5)
+        //:
+        //: 5 Call 'release' while blocks are cached, then allocate and
+        //:   deallocate from the same thread.  (C-6)
+        //:
+        //: 6 Repeat the concurrency test with thread caching enabled.  (C-7)
+        //:
+        //: 7 Verify that no memory is outstanding after a multipool with a
+        //:   cache for the main thread is destroyed.  (C-8)
+        //:
+        //: 8 Enable thread caching for more multipools than there are
+        //:   thread-specific storage keys, all alive at once, and verify that
+        //:   each caches the blocks deallocated by the main thread.  (C-9)
+        //:
+        //: 9 Destroy a multipool while a thread having a cache for it is
+        //:   running, then have the thread use another multipool and exit.
+        //:   Verify that no memory is outstanding once the second multipool
+        //:   is destroyed.  (C-10)
+        //
+        // Testing:
+        //   int enableThreadCaching(int batchSize);
+        //   int enableThreadCaching(const int *batchSizeArray);
+        //   void flushThreadCache();
+        //   bool isThreadCachingEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING THREAD CACHING"
+                          << endl << "======================" << endl;
+
+        if (verbose) cout << "\nEnabling thread caching." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            {
+                Obj mX(4, &ta);  const Obj& X = mX;
+                ASSERT(false == X.isThreadCachingEnabled());
+
+                mX.flushThreadCache();  // no effect
+
+                ASSERT(0    == mX.enableThreadCaching(4));
+                ASSERT(true == X.isThreadCachingEnabled());
+            }
+            {
+                const int BATCH_SIZES[] = { 8, 4, 2, 1 };
+
+                Obj mX(4, &ta);  const Obj& X = mX;
+                ASSERT(0    == mX.enableThreadCaching(BATCH_SIZES));
+                ASSERT(true == X.isThreadCachingEnabled());
+
+                for (int size = 1; size <= 64; size *= 2) {
+                    void *p = mX.allocate(size);
+                    mX.deallocate(p);
+                    LOOP_ASSERT(size, p == mX.allocate(size));
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nReusing cached blocks." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(&ta);
+            ASSERT(0 == mX.enableThreadCaching(4));
+
+            for (int size = 1; size <= 1024; size *= 2) {
+                void *p = mX.allocate(size);
+                void *q = mX.allocate(size);
+                mX.deallocate(p);
+                LOOP_ASSERT(size, p == mX.allocate(size));
+                mX.deallocate(q);
+                LOOP_ASSERT(size, q == mX.allocate(size));
+                mX.deallocate(p);
+                mX.deallocate(q);
+            }
+        }
+
+        enum { k_NUM_BLOCKS = 100 };
+
+        if (verbose) cout << "\nFlushing the cache of a thread." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(&ta);
+            ASSERT(0 == mX.enableThreadCaching(k_NUM_BLOCKS));
+
+            // Leave every block in the cache of the main thread.
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks.push_back(mX.allocate(16));
+            }
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            mX.flushThreadCache();
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            CachingThreadArgs args = { &mX, 16, k_NUM_BLOCKS };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  cachingThread,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            // The cache of the thread was allocated and reclaimed.
+
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nExiting a thread having a cache." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(&ta);
+            ASSERT(0 == mX.enableThreadCaching(k_NUM_BLOCKS));
+
+            CachingThreadArgs args = { &mX, 16, k_NUM_BLOCKS };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  cachingThread,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks.push_back(mX.allocate(16));
+            }
+
+            // Only the cache of the main thread was allocated.
+
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS + 1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nBounding the size of a cache." << endl;
+        {
+            enum { k_BATCH_SIZE = 2 };
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(1, bsls::BlockGrowth::BSLS_CONSTANT,
+                                    k_NUM_BLOCKS, &ta);
+            ASSERT(0 == mX.enableThreadCaching(k_BATCH_SIZE));
+
+            bsl::vector<void *> blocks;
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks.push_back(mX.allocate(8));
+            }
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            // At most '2 * k_BATCH_SIZE' blocks remain cached, so another
+            // thread can allocate the rest without replenishing the pool.
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            CachingThreadArgs args = { &mX,
+                                       8,
+                                       k_NUM_BLOCKS - 2 * k_BATCH_SIZE };
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                  cachingThread,
+                                                  &args));
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nReleasing cached blocks." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+            Obj                  mX(4, &ta);
+            ASSERT(0 == mX.enableThreadCaching(4));
+
+            void *p = mX.allocate(8);
+            void *q = mX.allocate(8);
+            mX.deallocate(p);
+
+            const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+            mX.release();
+            (void)q;  // 'q' is no longer valid
+
+            ASSERTV(NUM_BLOCKS, ta.numBlocksInUse(),
+                    NUM_BLOCKS > ta.numBlocksInUse());
+
+            for (int i = 0; i < 10; ++i) {
+                void *r = mX.allocate(8);
+                memset(r, 0xa5, 8);
+                mX.deallocate(r);
+                ASSERT(r == mX.allocate(8));
+                mX.deallocate(r);
+            }
+            mX.flushThreadCache();
+        }
+
+        if (verbose) cout << "\nConcurrent use." << endl;
+        {
+            bslmt::ThreadUtil::Handle threads[k_NUM_THREADS];
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            {
+                Obj mX(4, &ta);
+                ASSERT(0 == mX.enableThreadCaching(2));
+
+                const int SIZES [] = { 1 , 2 , 4,  8, 16, 32, 64, 128, 256,
+                                       512, 1 , 2 , 4,  8, 16, 32, 64, 128,
+                                       256, 512 };
+
+                const int NUM_SIZES = sizeof (SIZES) / sizeof(*SIZES);
+
+                WorkerArgs args;
+                args.d_allocator = &mX;
+                args.d_sizes     = (const int *)&SIZES;
+                args.d_numSizes  = NUM_SIZES;
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    int rc = bslmt::ThreadUtil::create(&threads[i],
+                                                       workerThread,
+                                                       &args);
+                    LOOP_ASSERT(i, 0 == rc);
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    int rc = bslmt::ThreadUtil::join(threads[i]);
+                    LOOP_ASSERT(i, 0 == rc);
+                }
+
+                // The caches of the worker threads have been reclaimed.
+
+                mX.release();
+                ASSERTV(ta.numBlocksInUse(), 2 == ta.numBlocksInUse());
+
+                // Give the main thread a cache to be reclaimed by the
+                // destructor.
+
+                mX.deallocate(mX.allocate(8));
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nMany multipools." << endl;
+        {
+            enum { k_NUM_MULTIPOOLS = 4096 };  // more than 'PTHREAD_KEYS_MAX'
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            {
+                bsl::vector<Obj *> multipools(&ta);
+                for (int i = 0; i < k_NUM_MULTIPOOLS; ++i) {
+                    multipools.push_back(new (ta) Obj(1, &ta));
+                    Obj& mX = *multipools.back();
+
+                    LOOP_ASSERT(i, 0    == mX.enableThreadCaching(2));
+                    LOOP_ASSERT(i, true == mX.isThreadCachingEnabled());
+
+                    void *p = mX.allocate(8);
+                    mX.deallocate(p);
+                    LOOP_ASSERT(i, p == mX.allocate(8));
+                    mX.deallocate(p);
+                }
+
+                // Use the multipools again, now that the list of caches of
+                // the main thread holds every cache.
+
+                for (int i = 0; i < k_NUM_MULTIPOOLS; i += 97) {
+                    Obj& mX = *multipools[i];
+
+                    void *p = mX.allocate(8);
+                    mX.deallocate(p);
+                    LOOP_ASSERT(i, p == mX.allocate(8));
+                    mX.deallocate(p);
+                }
+
+                for (int i = 0; i < k_NUM_MULTIPOOLS; ++i) {
+                    ta.deleteObject(multipools[i]);
+                }
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nThread outliving a multipool." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            {
+                Obj mY(&ta);
+                ASSERT(0 == mY.enableThreadCaching(4));
+
+                Obj *mX = new (ta) Obj(&ta);
+                ASSERT(0 == mX->enableThreadCaching(4));
+
+                bslmt::Barrier barrier(2);
+
+                OutlivingThreadArgs args = { mX, &mY, &barrier };
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      outlivingThread,
+                                                      &args));
+
+                barrier.wait();   // the thread has a cache for 'mX'
+
+                ta.deleteObject(mX);
+
+                barrier.wait();
+
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
       case 11: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
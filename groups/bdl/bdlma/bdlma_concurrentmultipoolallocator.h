@@ -113,6 +113,17 @@ BSLS_IDENT("$Id: $")
 // single value applying to all of the maintained pools, or as an array of
 // values, with the elements applying to each individually maintained pool.
 //
+///Thread Caching
+///--------------
+// Calling 'enableThreadCaching' before the allocator is used gives each thread
+// a private cache of free blocks for each pool, so that most pooled
+// allocations and deallocations do not touch the shared pools, whose free-list
+// heads are otherwise contended by every allocating thread.  Blocks are moved
+// between a thread cache and the shared pools in batches of a configurable
+// size, and are returned to the shared pools when the thread exits or calls
+// 'flushThreadCache'.  See {'bdlma_concurrentmultipool'|Thread Caching} for
+// details.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -424,6 +435,25 @@ class ConcurrentMultipoolAllocator : public bdlma::ManagedAllocator {
         // allocator is released.
 
     // MANIPULATORS
+    int enableThreadCaching(int batchSize);
+    int enableThreadCaching(const int *batchSizeArray);
+        // Enable caching of free pooled blocks in each thread that allocates
+        // memory from, or deallocates memory to, this allocator, moving blocks
+        // between the cache of a thread and a pool in batches of either the
+        // specified 'batchSize' blocks for all pools or, for each pool, the
+        // corresponding entry in the specified 'batchSizeArray'.  Return 0 on
+        // success, and a non-zero value (leaving thread caching disabled)
+        // otherwise.  The behavior is undefined unless this method is called
+        // before any memory is allocated from this allocator, is not called
+        // concurrently with any other method of this object, thread caching
+        // is not already enabled, and either '1 <= batchSize' or
+        // 'batchSizeArray' has at least 'numPools()' positive values.
+
+    void flushThreadCache();
+        // Return all free blocks cached by the calling thread to the pools
+        // from which they were allocated.  This method has no effect unless
+        // thread caching is enabled.
+
     void reserveCapacity(bsls::Types::size_type size, int numObjects);
         // Reserve memory from this multipool allocator to satisfy memory
         // requests for at least the specified 'numObjects' having the
@@ -452,6 +482,10 @@ class ConcurrentMultipoolAllocator : public bdlma::ManagedAllocator {
         // allocator.
 
     // ACCESSORS
+    bool isThreadCachingEnabled() const;
+        // Return 'true' if thread caching is enabled for this allocator, and
+        // 'false' otherwise.
+
     int numPools() const;
         // Return the number of pools managed by this multipool allocator.
 
@@ -559,6 +593,25 @@ ConcurrentMultipoolAllocator::ConcurrentMultipoolAllocator(
 }
 
 // MANIPULATORS
+inline
+int ConcurrentMultipoolAllocator::enableThreadCaching(int batchSize)
+{
+    return d_multipool.enableThreadCaching(batchSize);
+}
+
+inline
+int ConcurrentMultipoolAllocator::enableThreadCaching(
+                                                    const int *batchSizeArray)
+{
+    return d_multipool.enableThreadCaching(batchSizeArray);
+}
+
+inline
+void ConcurrentMultipoolAllocator::flushThreadCache()
+{
+    d_multipool.flushThreadCache();
+}
+
 inline
 void ConcurrentMultipoolAllocator::reserveCapacity(
                                              bsls::Types::size_type size,
@@ -568,6 +621,12 @@ void ConcurrentMultipoolAllocator::reserveCapacity(
 }
 
 // ACCESSORS
+inline
+bool ConcurrentMultipoolAllocator::isThreadCachingEnabled() const
+{
+    return d_multipool.isThreadCachingEnabled();
+}
+
 inline
 int ConcurrentMultipoolAllocator::numPools() const
 {
@@ -68,8 +68,12 @@ using namespace bsl;  // automatically added by script
 // [2] void deallocate(address);
 // [1] void release();
 // [3] void reserveCapacity(numBytes);
+// [7] int enableThreadCaching(int batchSize);
+// [7] int enableThreadCaching(const int *batchSizeArray);
+// [7] void flushThreadCache();
+// [7] bool isThreadCachingEnabled() const;
 //-----------------------------------------------------------------------------
-// [7] USAGE EXAMPLE
+// [8] USAGE EXAMPLE
 
 //=============================================================================
 //                    STANDARD BDE ASSERT TEST MACRO
@@ -849,7 +853,7 @@ int main(int argc, char *argv[])
     bslma::Allocator     *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
 // Finally, in 'main', we can create a 'bdlma::ConcurrentMultipoolAllocator'
 // and pass it to our 'my_NamedGraphContainer'.  Since we know that the maximum
 // block size needed is 32 (comes from 'sizeof(my_Graph)'), we can calculate
@@ -869,6 +873,71 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // THREAD CACHING TEST
+        //
+        // Concerns:
+        //: 1 The thread caching methods are forwarded to the underlying
+        //:   multipool.
+        //:
+        //: 2 A thread cache is used through the 'bslma::Allocator' protocol.
+        //
+        // Plan:
+        //: 1 Enable thread caching using each overload of
+        //:   'enableThreadCaching', verify 'isThreadCachingEnabled', and
+        //:   verify that a block deallocated through a 'bslma::Allocator'
+        //:   pointer is reused by the next allocation of the same size.
+        //:   (C-1..2)
+        //:
+        //: 2 Verify that no memory is outstanding after the allocator is
+        //:   destroyed.  (C-1)
+        //
+        // Testing:
+        //   int enableThreadCaching(int batchSize);
+        //   int enableThreadCaching(const int *batchSizeArray);
+        //   void flushThreadCache();
+        //   bool isThreadCachingEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "THREAD CACHING TEST"
+                          << endl << "===================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        {
+            bdlma::ConcurrentMultipoolAllocator mX(4, &ta);
+            const bdlma::ConcurrentMultipoolAllocator& X = mX;
+            bslma::Allocator *allocator = &mX;
+
+            ASSERT(false == X.isThreadCachingEnabled());
+            ASSERT(0     == mX.enableThreadCaching(4));
+            ASSERT(true  == X.isThreadCachingEnabled());
+
+            for (int size = 1; size <= 64; size *= 2) {
+                void *p = allocator->allocate(size);
+                allocator->deallocate(p);
+                LOOP_ASSERT(size, p == allocator->allocate(size));
+                allocator->deallocate(p);
+            }
+            mX.flushThreadCache();
+        }
+        {
+            const int BATCH_SIZES[] = { 8, 4, 2, 1 };
+
+            bdlma::ConcurrentMultipoolAllocator mX(4, &ta);
+            const bdlma::ConcurrentMultipoolAllocator& X = mX;
+            bslma::Allocator *allocator = &mX;
+
+            ASSERT(0    == mX.enableThreadCaching(BATCH_SIZES));
+            ASSERT(true == X.isThreadCachingEnabled());
+
+            void *p = allocator->allocate(100);
+            allocator->deallocate(p);
+            ASSERT(p == allocator->allocate(100));
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING OLD USAGE EXAMPLE
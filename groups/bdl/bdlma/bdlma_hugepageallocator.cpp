@@ -0,0 +1,463 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_cstdio.h>
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>         // 'GetLargePageMinimum', 'GetSystemInfo',
+                             // 'VirtualAlloc', 'VirtualFree'
+#else
+
+#include <sys/mman.h>        // 'madvise', 'mmap', 'munmap'
+#include <unistd.h>          // 'sysconf'
+
+#endif
+
+///Implementation Notes
+///--------------------
+// Each region begins with a 'Region' header, which links the region into the
+// doubly-linked list of regions of the allocator and counts the blocks of the
+// region that are outstanding.  Each block is preceded by a 'BlockHeader'
+// that records the region from which the block was carved, so that
+// 'deallocate' can find the region in constant time.
+//
+// On Linux, a region that is not backed by reserved huge pages is mapped
+// 'hugePageSize()' bytes larger than needed, and the excess at either end is
+// unmapped so that the region starts on a huge page boundary; transparent huge
+// pages can back only huge-page-aligned ranges.
+
+namespace BloombergLP {
+namespace {
+
+union BlockHeader {
+    // This 'union' precedes each block supplied by a 'HugePageAllocator'.
+
+    void                                *d_region_p;  // region of the block
+
+    bsls::AlignmentUtil::MaxAlignedType  d_dummy;     // force alignment
+};
+
+BSLMF_ASSERT(static_cast<int>(sizeof(BlockHeader)) ==
+             static_cast<int>(bdlma::HugePageAllocator::k_BLOCK_OVERHEAD));
+
+// HELPER FUNCTIONS
+
+bsl::size_t getSystemPageSize()
+    // Return the size (in bytes) of a regular system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;                              // RETURN
+#else
+    return static_cast<bsl::size_t>(sysconf(_SC_PAGESIZE));           // RETURN
+#endif
+}
+
+bsl::size_t readHugePageSize()
+    // Return the size (in bytes) of a huge page as reported by the system, or
+    // 0 if the system does not report one.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    FILE *file = bsl::fopen("/proc/meminfo", "r");
+    if (!file) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t result = 0;
+    char        line[256];
+    while (bsl::fgets(line, sizeof line, file)) {
+        unsigned long kilobytes;
+        if (1 == bsl::sscanf(line, "Hugepagesize: %lu kB", &kilobytes)) {
+            result = static_cast<bsl::size_t>(kilobytes) * 1024;
+            break;
+        }
+    }
+    bsl::fclose(file);
+
+    return result;
+
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    return GetLargePageMinimum();
+
+#else
+
+    return 0;
+
+#endif
+}
+
+bsl::size_t roundUp(bsl::size_t size, bsl::size_t granularity)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'granularity'.  The behavior is undefined unless '0 < granularity'.
+{
+    BSLS_ASSERT(0 < granularity);
+
+    return (size + granularity - 1) / granularity * granularity;
+}
+
+const bsl::size_t k_REGION_HEADER_SIZE = 64;
+    // Number of bytes at the start of a region reserved for its 'Region'
+    // header.
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                      // ================================
+                      // struct HugePageAllocator::Region
+                      // ================================
+
+struct HugePageAllocator::Region {
+    // This 'struct' heads each region obtained by a 'HugePageAllocator'.
+
+    Region                 *d_prev_p;      // previous region in the list
+
+    Region                 *d_next_p;      // next region in the list
+
+    bsls::Types::size_type  d_size;        // size (in bytes) of the mapping
+
+    int                     d_numBlocks;   // number of outstanding blocks
+
+    bool                    d_isHugeTlb;   // 'true' if backed by reserved (or
+                                           // large) pages
+};
+
+                         // -----------------------
+                         // class HugePageAllocator
+                         // -----------------------
+
+// CLASS METHODS
+bsls::Types::size_type HugePageAllocator::hugePageSize()
+{
+    static bsls::AtomicUint64 size(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const bsl::size_t pageSize     = getSystemPageSize();
+        const bsl::size_t hugePageSize = readHugePageSize();
+
+        size = hugePageSize > pageSize && 0 == hugePageSize % pageSize
+             ? hugePageSize
+             : pageSize;
+    }
+
+    return static_cast<bsls::Types::size_type>(size.loadRelaxed());
+}
+
+// PRIVATE MANIPULATORS
+HugePageAllocator::Region *HugePageAllocator::mapRegion(
+                                                   bsls::Types::size_type size)
+{
+    const bsl::size_t granularity = hugePageSize();
+
+    if (size > ~static_cast<bsl::size_t>(0) - 2 * granularity) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    const bsl::size_t mappedSize = roundUp(size, granularity);
+
+    char *address   = 0;
+    bool  isHugeTlb = false;
+
+#if defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    if (d_tryHugeTlb && granularity > getSystemPageSize()) {
+        address = static_cast<char *>(VirtualAlloc(
+                                 0,
+                                 mappedSize,
+                                 MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+                                 PAGE_READWRITE));
+        if (address) {
+            isHugeTlb = true;
+        }
+        else {
+            d_tryHugeTlb = false;
+        }
+    }
+
+    if (!address) {
+        address = static_cast<char *>(VirtualAlloc(0,
+                                                   mappedSize,
+                                                   MEM_COMMIT | MEM_RESERVE,
+                                                   PAGE_READWRITE));
+        if (!address) {
+            BSLS_THROW(bsl::bad_alloc());
+        }
+    }
+
+#else
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MAP_HUGETLB)
+    if (d_tryHugeTlb && granularity > getSystemPageSize()) {
+        void *hugeTlb = mmap(0,
+                             mappedSize,
+                             PROT_READ | PROT_WRITE,
+                             MAP_ANON | MAP_PRIVATE | MAP_HUGETLB,
+                             -1,
+                             0);
+        if (MAP_FAILED != hugeTlb) {
+            address   = static_cast<char *>(hugeTlb);
+            isHugeTlb = true;
+        }
+        else {
+            d_tryHugeTlb = false;
+        }
+    }
+#endif
+
+    if (!address) {
+        const bsl::size_t alignment = granularity > getSystemPageSize()
+                                    ? granularity
+                                    : 0;
+
+        void *raw = mmap(0,
+                         mappedSize + alignment,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+        if (MAP_FAILED == raw) {
+            BSLS_THROW(bsl::bad_alloc());
+        }
+
+        address = static_cast<char *>(raw);
+
+        if (alignment) {
+            // Trim the mapping to a huge-page-aligned range.
+
+            char *aligned = static_cast<char *>(raw)
+                          + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                                raw,
+                                                static_cast<int>(alignment));
+            char *end     = static_cast<char *>(raw) + mappedSize + alignment;
+
+            if (aligned != address) {
+                munmap(address, aligned - address);
+            }
+            if (aligned + mappedSize != end) {
+                munmap(aligned + mappedSize, end - (aligned + mappedSize));
+            }
+            address = aligned;
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+            madvise(address, mappedSize, MADV_HUGEPAGE);
+#endif
+        }
+    }
+
+#endif
+
+    Region *region = reinterpret_cast<Region *>(address);
+    region->d_prev_p    = 0;
+    region->d_next_p    = d_regions_p;
+    region->d_size      = mappedSize;
+    region->d_numBlocks = 0;
+    region->d_isHugeTlb = isHugeTlb;
+
+    if (d_regions_p) {
+        d_regions_p->d_prev_p = region;
+    }
+    d_regions_p = region;
+
+    ++d_numRegions;
+    if (isHugeTlb) {
+        ++d_numHugeTlbRegions;
+    }
+
+    return region;
+}
+
+void HugePageAllocator::unmapRegion(Region *region)
+{
+    BSLS_ASSERT(region);
+
+    if (region->d_prev_p) {
+        region->d_prev_p->d_next_p = region->d_next_p;
+    }
+    else {
+        d_regions_p = region->d_next_p;
+    }
+    if (region->d_next_p) {
+        region->d_next_p->d_prev_p = region->d_prev_p;
+    }
+
+    --d_numRegions;
+    if (region->d_isHugeTlb) {
+        --d_numHugeTlbRegions;
+    }
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    VirtualFree(region, 0, MEM_RELEASE);
+#else
+    munmap(reinterpret_cast<char *>(region), region->d_size);
+#endif
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(bsls::Types::size_type regionSize)
+: d_regionSize(roundUp(regionSize, hugePageSize()))
+, d_regions_p(0)
+, d_current_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+, d_numRegions(0)
+, d_numHugeTlbRegions(0)
+, d_tryHugeTlb(true)
+{
+    BSLMF_ASSERT(sizeof(Region) <= k_REGION_HEADER_SIZE);
+
+    BSLS_ASSERT(0 < regionSize);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::size_type blockSize =
+                 bsls::AlignmentUtil::roundUpToMaximalAlignment(size)
+               + k_BLOCK_OVERHEAD;
+
+    if (blockSize < size) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Region *region;
+    char   *block;
+
+    if (blockSize > (d_regionSize - k_REGION_HEADER_SIZE) / 2) {
+        // Supply a large block from a region of its own.
+
+        region = mapRegion(k_REGION_HEADER_SIZE + blockSize);
+        block  = reinterpret_cast<char *>(region) + k_REGION_HEADER_SIZE;
+    }
+    else {
+        if (static_cast<bsls::Types::size_type>(d_end_p - d_cursor_p)
+                                                                < blockSize) {
+            Region *newRegion = mapRegion(d_regionSize);
+
+            if (d_current_p && 0 == d_current_p->d_numBlocks) {
+                unmapRegion(d_current_p);
+            }
+
+            d_current_p = newRegion;
+            d_cursor_p  = reinterpret_cast<char *>(newRegion)
+                        + k_REGION_HEADER_SIZE;
+            d_end_p     = reinterpret_cast<char *>(newRegion)
+                        + newRegion->d_size;
+        }
+
+        region      = d_current_p;
+        block       = d_cursor_p;
+        d_cursor_p += blockSize;
+    }
+
+    ++region->d_numBlocks;
+
+    reinterpret_cast<BlockHeader *>(block)->d_region_p = region;
+    return block + k_BLOCK_OVERHEAD;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    BlockHeader *header = reinterpret_cast<BlockHeader *>(
+                            static_cast<char *>(address) - k_BLOCK_OVERHEAD);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Region *region = static_cast<Region *>(header->d_region_p);
+
+    BSLS_ASSERT(0 < region->d_numBlocks);
+
+    if (0 == --region->d_numBlocks) {
+        if (region == d_current_p) {
+            d_cursor_p = reinterpret_cast<char *>(region)
+                       + k_REGION_HEADER_SIZE;
+        }
+        else {
+            unmapRegion(region);
+        }
+    }
+}
+
+void HugePageAllocator::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    while (d_regions_p) {
+        unmapRegion(d_regions_p);
+    }
+
+    d_current_p = 0;
+    d_cursor_p  = 0;
+    d_end_p     = 0;
+}
+
+// ACCESSORS
+int HugePageAllocator::numHugeTlbRegions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numHugeTlbRegions;
+}
+
+int HugePageAllocator::numRegions() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numRegions;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,317 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a block-supplying allocator backed by huge pages.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: thread-safe allocator of blocks from huge pages
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_multipool, bdlma_concurrentpool,
+//           bdlma_numaarenaallocator
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and carves blocks of memory out of large regions obtained directly
+// from virtual memory and backed, where the platform permits, by huge pages:
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//                |        ctor/dtor
+//                |        numHugeTlbRegions
+//                |        numRegions
+//                |        regionSize
+//                |        hugePageSize                (static)
+//                V
+//    ,-----------------------.
+//   ( bdlma::ManagedAllocator )
+//    `-----------------------'
+//                |        release
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                         allocate
+//                         deallocate
+//..
+// Allocators such as 'bdlma::SequentialAllocator', 'bdlma::Multipool', and
+// 'bdlma::ConcurrentPool' obtain large blocks from the allocator supplied at
+// construction (their "upstream" allocator) and subdivide them.  When the
+// memory they manage spans gigabytes, each 4K page of it needs its own entry
+// in the TLB (translation lookaside buffer) of the processor, and the cost of
+// TLB misses can dominate.  Supplying a 'bdlma::HugePageAllocator' as the
+// upstream allocator places those blocks on huge pages (typically 2M on
+// x86-64), each of which needs only one TLB entry.
+//
+// A 'bdlma::HugePageAllocator' is not intended to be used directly for small
+// allocations: each block carries a header of 'k_BLOCK_OVERHEAD' bytes, and
+// memory is returned to the system only when every block carved from a region
+// has been deallocated.
+//
+///Obtaining Huge Pages
+///--------------------
+// Each region is a multiple of the huge page size (see 'hugePageSize') in
+// length, and is obtained as follows:
+//
+//: o On Linux, a region is first requested from the pool of explicitly
+//:   reserved huge pages ('mmap' with 'MAP_HUGETLB').  If that request fails
+//:   (typically because no huge pages are reserved), the region is obtained
+//:   from regular virtual memory, aligned to a huge page boundary, and marked
+//:   with 'madvise(MADV_HUGEPAGE)' so that the kernel backs it with
+//:   transparent huge pages when it can.  After a request for reserved huge
+//:   pages fails, an allocator no longer makes such requests.
+//:
+//: o On Windows, a region is first requested with 'MEM_LARGE_PAGES', which
+//:   requires the 'SeLockMemoryPrivilege' privilege, and is otherwise obtained
+//:   from regular virtual memory.
+//:
+//: o On other platforms, regions are obtained from regular virtual memory.
+//
+// The 'numHugeTlbRegions' accessor reports how many regions are backed by
+// explicitly reserved (or, on Windows, large) pages.  Note that no accessor
+// can report whether the kernel actually backed a region with transparent
+// huge pages.
+//
+///Block Lifetime
+///--------------
+// Blocks are carved sequentially from the current region.  A block too large
+// to be carved from half of a region is given a region of its own, which is
+// returned to the system when the block is deallocated.  Each region counts
+// its outstanding blocks: when the count of a region drops to zero, the region
+// is returned to the system, unless it is the current region, in which case
+// it is reused from its start.  'release' returns every region to the system,
+// whether or not its blocks are outstanding.
+//
+///Thread Safety
+///-------------
+// 'bdlma::HugePageAllocator' is *fully thread-safe*, meaning that any
+// operation on the same object can be safely invoked from any thread, so that
+// it can be supplied to 'bdlma::ConcurrentPool' and other thread-safe
+// allocators.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Order Book Arena with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we store the orders of a large order book in memory obtained
+// from a 'bdlma::SequentialAllocator', and that profiling shows that accessing
+// the orders incurs many TLB misses.
+//
+// First, we define a simple order:
+//..
+//  struct Order {
+//      // This 'struct' describes an order.
+//
+//      bsls::Types::Int64 d_id;        // identifier of the order
+//      double             d_price;     // limit price
+//      int                d_quantity;  // number of shares
+//  };
+//..
+// Then, we create a huge-page allocator, and supply it to the sequential
+// allocator as the upstream allocator of its blocks:
+//..
+//  bdlma::HugePageAllocator   hugePageAllocator;
+//  bdlma::SequentialAllocator arena(&hugePageAllocator);
+//..
+// Next, we store a large number of orders in the arena:
+//..
+//  enum { k_NUM_ORDERS = 100 * 1000 };
+//
+//  bsl::vector<Order *> orders(&arena);
+//  orders.reserve(k_NUM_ORDERS);
+//
+//  for (int i = 0; i < k_NUM_ORDERS; ++i) {
+//      Order *order = static_cast<Order *>(arena.allocate(sizeof(Order)));
+//      order->d_id       = i;
+//      order->d_price    = 100.0 + i % 100;
+//      order->d_quantity = 100;
+//      orders.push_back(order);
+//  }
+//..
+// Now, we observe that the memory of the arena came from regions obtained by
+// the huge-page allocator:
+//..
+//  assert(1 <= hugePageAllocator.numRegions());
+//..
+// Finally, we release all of the orders at once.  The sequential allocator
+// returns its blocks to the huge-page allocator, which returns every region
+// but the current one to the system:
+//..
+//  arena.release();
+//  assert(hugePageAllocator.numRegions() <= 1);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // =======================
+                         // class HugePageAllocator
+                         // =======================
+
+class HugePageAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a
+    // thread-safe allocator of maximally-aligned blocks carved from large
+    // regions of virtual memory backed, where the platform permits, by huge
+    // pages.  It is intended to supply the blocks of other allocators.
+
+    // PRIVATE TYPES
+    struct Region;                             // implementation detail
+
+    // DATA
+    bsls::Types::size_type  d_regionSize;      // size of a region
+
+    Region                 *d_regions_p;       // head of the doubly-linked
+                                               // list of all regions
+
+    Region                 *d_current_p;       // region from which blocks are
+                                               // carved, or 0
+
+    char                   *d_cursor_p;        // next free byte of
+                                               // 'd_current_p'
+
+    char                   *d_end_p;           // end of 'd_current_p'
+
+    int                     d_numRegions;      // number of regions
+
+    int                     d_numHugeTlbRegions;
+                                               // number of regions backed by
+                                               // reserved (or large) pages
+
+    bool                    d_tryHugeTlb;      // 'false' once a request for
+                                               // reserved huge pages fails
+
+    mutable bslmt::Mutex    d_mutex;           // serializes access to this
+                                               // object
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    Region *mapRegion(bsls::Types::size_type size);
+        // Return the address of a newly obtained region of at least the
+        // specified 'size' (in bytes), linked into the list of regions, and
+        // throw 'bsl::bad_alloc' if the region cannot be obtained.  The
+        // behavior is undefined unless 'd_mutex' is locked.
+
+    void unmapRegion(Region *region);
+        // Unlink the specified 'region' from the list of regions and return
+        // it to the system.  The behavior is undefined unless 'd_mutex' is
+        // locked.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_DEFAULT_REGION_SIZE = 32 * 1024 * 1024,
+                                     // default size (in bytes) of a region
+
+        k_BLOCK_OVERHEAD      = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                                     // bytes preceding each block
+    };
+
+    // CLASS METHODS
+    static bsls::Types::size_type hugePageSize();
+        // Return the size (in bytes) of a huge page on this platform, or of a
+        // regular page if the platform does not support huge pages.
+
+    // CREATORS
+    explicit HugePageAllocator(
+                  bsls::Types::size_type regionSize = k_DEFAULT_REGION_SIZE);
+        // Create a huge-page allocator.  Optionally specify a 'regionSize'
+        // indicating the size (in bytes) of the regions from which blocks are
+        // carved, which is rounded up to a multiple of 'hugePageSize()'.  If
+        // 'regionSize' is not specified, 'k_DEFAULT_REGION_SIZE' is used.
+        // The behavior is undefined unless '0 < regionSize'.  Note that no
+        // memory is obtained until the first call to 'allocate'.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator, returning all memory allocated from it to
+        // the system.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a maximally-aligned block of memory of the
+        // specified 'size' (in bytes).  If 'size' is 0, no memory is allocated
+        // and 0 is returned.  Throw 'bsl::bad_alloc' if memory cannot be
+        // obtained from the system.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to this
+        // allocator.  If 'address' is 0, this method has no effect.  If this
+        // was the last outstanding block of its region, the region is returned
+        // to the system, or reused if it is the current region.  The behavior
+        // is undefined unless 'address' was allocated by this allocator and
+        // has not already been deallocated or released.
+
+    virtual void release();
+        // Return all memory allocated from this allocator to the system.  The
+        // allocator is left in a valid state, as if newly constructed, except
+        // that it makes no further requests for reserved huge pages if one
+        // has previously failed.
+
+    // ACCESSORS
+    int numHugeTlbRegions() const;
+        // Return the number of regions currently held by this allocator that
+        // are backed by explicitly reserved huge pages (or, on Windows, by
+        // large pages).
+
+    int numRegions() const;
+        // Return the number of regions currently held by this allocator.
+
+    bsls::Types::size_type regionSize() const;
+        // Return the size (in bytes) of the regions from which this allocator
+        // carves blocks.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -----------------------
+                         // class HugePageAllocator
+                         // -----------------------
+
+// ACCESSORS
+inline
+bsls::Types::size_type HugePageAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1029 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_concurrentpool.h>
+#include <bdlma_multipool.h>
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+  #include <sys/resource.h>         // 'getrusage'
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+  #include <linux/perf_event.h>     // 'perf_event_attr'
+  #include <sys/ioctl.h>            // 'ioctl'
+  #include <sys/syscall.h>          // 'SYS_perf_event_open'
+  #include <unistd.h>               // 'close', 'read', 'syscall'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HugePageAllocator' is a thread-safe allocator that carves blocks
+// from large regions of virtual memory backed, where possible, by huge pages.
+// Whether huge pages are available depends on the machine running the test,
+// so the primary concerns are that blocks are correctly sized, aligned, and
+// disjoint, that regions are obtained, reused, and returned to the system as
+// documented (which is observable through 'numRegions'), and that the
+// allocator can serve as the upstream allocator of the 'bdlma' allocators it
+// is intended to supply, including from multiple threads.
+//
+// The benchmark (case -1) reports, for each upstream allocator, the time, the
+// number of minor page faults, and (on Linux, where permitted) the number of
+// data TLB misses incurred by a workload that allocates and randomly accesses
+// a large arena.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bsls::Types::size_type hugePageSize();
+//
+// CREATORS
+// [ 2] explicit HugePageAllocator(bsls::Types::size_type regionSize = ...);
+// [ 3] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void release();
+//
+// ACCESSORS
+// [ 3] int numHugeTlbRegions() const;
+// [ 3] int numRegions() const;
+// [ 2] bsls::Types::size_type regionSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] CONCERN: Usable as the upstream of 'bdlma' allocators.
+// [ 4] CONCERN: 'allocate' and 'deallocate' are thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [-1] BENCHMARK: page faults and TLB misses by upstream allocator
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::UintPtr     UintPtr;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                     HELPER FUNCTIONS FOR CONCURRENCY TEST
+// ----------------------------------------------------------------------------
+
+namespace CONCURRENCY_TEST {
+
+struct ThreadArgs {
+    // This 'struct' describes the work of a thread of the concurrency test.
+
+    bdlma::ConcurrentPool *d_pool_p;       // pool shared by all threads
+
+    Obj                   *d_upstream_p;   // allocator shared by all threads
+
+    int                    d_id;           // identifier of the thread
+
+    int                    d_numErrors;    // number of corrupted blocks
+                                           // found by the thread
+};
+
+extern "C" void *workerThread(void *arg)
+    // Repeatedly allocate blocks from the pool and upstream allocator
+    // specified by the 'ThreadArgs' addressed by the specified 'arg', fill
+    // them with a pattern specific to the thread, and verify that the pattern
+    // survives until the blocks are deallocated.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+
+    enum { k_NUM_ROUNDS = 50, k_NUM_BLOCKS = 100 };
+
+    const char PATTERN = static_cast<char>('a' + args->d_id);
+
+    for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+        char *pooled[k_NUM_BLOCKS];
+        char *direct[k_NUM_BLOCKS];
+
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            const size_type size = 100 + (i * 997) % 20000;
+
+            pooled[i] = static_cast<char *>(args->d_pool_p->allocate());
+            direct[i] = static_cast<char *>(args->d_upstream_p->allocate(
+                                                                      size));
+            bsl::memset(pooled[i], PATTERN, args->d_pool_p->blockSize());
+            bsl::memset(direct[i], PATTERN, size);
+        }
+
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            const size_type size = 100 + (i * 997) % 20000;
+
+            if (PATTERN != pooled[i][0]
+             || PATTERN != pooled[i][args->d_pool_p->blockSize() - 1]
+             || PATTERN != direct[i][0]
+             || PATTERN != direct[i][size - 1]) {
+                ++args->d_numErrors;
+            }
+
+            args->d_pool_p->deallocate(pooled[i]);
+            args->d_upstream_p->deallocate(direct[i]);
+        }
+    }
+
+    return 0;
+}
+
+}  // close namespace CONCURRENCY_TEST
+
+// ============================================================================
+//                        HELPER FUNCTIONS FOR BENCHMARK
+// ----------------------------------------------------------------------------
+
+namespace BENCHMARK {
+
+struct Counters {
+    // This 'struct' holds a sample of the counters reported by the benchmark.
+
+    Int64 d_minorFaults;  // minor page faults of the process, or -1
+
+    Int64 d_tlbMisses;    // data TLB load misses of the thread, or -1
+};
+
+class CounterReader {
+    // This class provides access to the page fault count of the process and,
+    // where the platform permits, the data TLB miss count of the calling
+    // thread.
+
+    // DATA
+    int d_tlbFd;  // performance counter file descriptor, or -1
+
+  private:
+    // NOT IMPLEMENTED
+    CounterReader(const CounterReader&);
+    CounterReader& operator=(const CounterReader&);
+
+  public:
+    // CREATORS
+    CounterReader()
+        // Create a reader, opening a data TLB miss counter for the calling
+        // thread if possible.
+    : d_tlbFd(-1)
+    {
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_perf_event_open)
+        perf_event_attr attr;
+        bsl::memset(&attr, 0, sizeof attr);
+        attr.type           = PERF_TYPE_HW_CACHE;
+        attr.size           = sizeof attr;
+        attr.config         = PERF_COUNT_HW_CACHE_DTLB
+                            | PERF_COUNT_HW_CACHE_OP_READ << 8
+                            | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+
+        d_tlbFd = static_cast<int>(syscall(SYS_perf_event_open,
+                                           &attr,
+                                           0,      // calling thread
+                                           -1,     // any processor
+                                           -1,     // no group
+                                           0UL));
+#endif
+    }
+
+    ~CounterReader()
+        // Destroy this object.
+    {
+#ifdef BSLS_PLATFORM_OS_LINUX
+        if (0 <= d_tlbFd) {
+            close(d_tlbFd);
+        }
+#endif
+    }
+
+    // ACCESSORS
+    Counters sample() const
+        // Return the current values of the counters.
+    {
+        Counters result = { -1, -1 };
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        struct rusage usage;
+        if (0 == getrusage(RUSAGE_SELF, &usage)) {
+            result.d_minorFaults = usage.ru_minflt;
+        }
+#endif
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+        long long count;
+        if (0 <= d_tlbFd
+         && static_cast<ssize_t>(sizeof count) ==
+                                       read(d_tlbFd, &count, sizeof count)) {
+            result.d_tlbMisses = count;
+        }
+#endif
+
+        return result;
+    }
+};
+
+struct Order {
+    // This 'struct' is the element of the benchmark workload.
+
+    Order              *d_next_p;    // next order to visit
+    bsls::Types::Int64  d_id;        // identifier
+    double              d_price;     // price
+    int                 d_quantity;  // quantity
+};
+
+Int64 runWorkload(bslma::Allocator *arena,
+                  int               numOrders,
+                  int               numVisits)
+    // Allocate the specified 'numOrders' orders from the specified 'arena',
+    // link them in a pseudo-random order, visit the specified 'numVisits'
+    // orders following the links, and return a checksum of the visited
+    // orders.
+{
+    bsl::vector<Order *> orders(bslma::NewDeleteAllocator::allocator(0));
+    orders.reserve(numOrders);
+
+    for (int i = 0; i < numOrders; ++i) {
+        Order *order = static_cast<Order *>(arena->allocate(sizeof(Order)));
+        order->d_next_p   = 0;
+        order->d_id       = i;
+        order->d_price    = 100.0 + i % 100;
+        order->d_quantity = i % 1000;
+        orders.push_back(order);
+    }
+
+    // Link the orders in a single pseudo-random cycle (Sattolo's algorithm).
+
+    unsigned int seed = 12345;
+    for (int i = numOrders - 1; 0 < i; --i) {
+        seed = seed * 1103515245 + 12345;
+        const int j = static_cast<int>((seed >> 8) % i);
+        bsl::swap(orders[i], orders[j]);
+    }
+    for (int i = 0; i < numOrders; ++i) {
+        orders[i]->d_next_p = orders[(i + 1) % numOrders];
+    }
+
+    Int64  checksum = 0;
+    Order *order    = orders[0];
+    for (int i = 0; i < numVisits; ++i) {
+        checksum += order->d_quantity;
+        order     = order->d_next_p;
+    }
+
+    return checksum;
+}
+
+void runBenchmark(const char       *upstreamName,
+                  bslma::Allocator *upstream,
+                  int               numOrders,
+                  int               numVisits)
+    // Run the benchmark workload for the specified 'numOrders' and
+    // 'numVisits' on a 'bdlma::SequentialAllocator' supplied by the specified
+    // 'upstream' allocator, and print a line of results labelled with the
+    // specified 'upstreamName'.
+{
+    CounterReader reader;
+
+    bsls::Stopwatch timer;
+
+    const Counters before = reader.sample();
+    timer.start(true);
+
+    Int64 checksum;
+    {
+        bdlma::SequentialAllocator arena(upstream);
+        checksum = runWorkload(&arena, numOrders, numVisits);
+    }
+
+    timer.stop();
+    const Counters after = reader.sample();
+
+    cout << upstreamName
+         << ",orders=" << numOrders
+         << ",visits=" << numVisits
+         << ",seconds=" << timer.elapsedTime()
+         << ",minorFaults=";
+    if (0 <= before.d_minorFaults) {
+        cout << after.d_minorFaults - before.d_minorFaults;
+    }
+    else {
+        cout << "n/a";
+    }
+    cout << ",dtlbMisses=";
+    if (0 <= before.d_tlbMisses) {
+        cout << after.d_tlbMisses - before.d_tlbMisses;
+    }
+    else {
+        cout << "n/a";
+    }
+    cout << ",checksum=" << checksum << endl;
+}
+
+}  // close namespace BENCHMARK
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Order Book Arena with Huge Pages
+///- - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we store the orders of a large order book in memory obtained
+// from a 'bdlma::SequentialAllocator', and that profiling shows that accessing
+// the orders incurs many TLB misses.
+//
+// First, we define a simple order:
+//..
+    struct Order {
+        // This 'struct' describes an order.
+
+        bsls::Types::Int64 d_id;        // identifier of the order
+        double             d_price;     // limit price
+        int                d_quantity;  // number of shares
+    };
+//..
+// Then, we create a huge-page allocator, and supply it to the sequential
+// allocator as the upstream allocator of its blocks:
+//..
+    bdlma::HugePageAllocator   hugePageAllocator;
+    bdlma::SequentialAllocator arena(&hugePageAllocator);
+//..
+// Next, we store a large number of orders in the arena:
+//..
+    enum { k_NUM_ORDERS = 100 * 1000 };
+
+    bsl::vector<Order *> orders(&arena);
+    orders.reserve(k_NUM_ORDERS);
+
+    for (int i = 0; i < k_NUM_ORDERS; ++i) {
+        Order *order = static_cast<Order *>(arena.allocate(sizeof(Order)));
+        order->d_id       = i;
+        order->d_price    = 100.0 + i % 100;
+        order->d_quantity = 100;
+        orders.push_back(order);
+    }
+//..
+// Now, we observe that the memory of the arena came from regions obtained by
+// the huge-page allocator:
+//..
+    ASSERT(1 <= hugePageAllocator.numRegions());
+//..
+// Finally, we release all of the orders at once.  The sequential allocator
+// returns its blocks to the huge-page allocator, which returns every region
+// but the current one to the system:
+//..
+    arena.release();
+    ASSERT(hugePageAllocator.numRegions() <= 1);
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // UPSTREAM OF BDLMA ALLOCATORS AND CONCURRENCY
+        //
+        // Concerns:
+        //: 1 A 'bdlma::SequentialAllocator', 'bdlma::Multipool', and
+        //:   'bdlma::ConcurrentPool' supplied by a 'HugePageAllocator' obtain
+        //:   all of their memory from it, and return it when released.
+        //:
+        //: 2 'allocate' and 'deallocate' can be invoked concurrently, both
+        //:   directly and through a 'bdlma::ConcurrentPool'.
+        //
+        // Plan:
+        //: 1 For each of the allocators, allocate and write to many blocks of
+        //:   varying sizes, verify that no memory comes from the default
+        //:   allocator, and verify that releasing the allocator returns all
+        //:   regions but the current one.  (C-1)
+        //:
+        //: 2 Run several threads that allocate from, write to, and deallocate
+        //:   to a shared 'bdlma::ConcurrentPool' and a shared
+        //:   'HugePageAllocator', verifying that no block is corrupted.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Usable as the upstream of 'bdlma' allocators.
+        //   CONCERN: 'allocate' and 'deallocate' are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                    << "UPSTREAM OF BDLMA ALLOCATORS AND CONCURRENCY" << endl
+                    << "============================================" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\n'bdlma::SequentialAllocator'." << endl;
+        {
+            Obj mX(Obj::hugePageSize());  const Obj& X = mX;
+            {
+                bdlma::SequentialAllocator sa(&mX);
+
+                for (int i = 0; i < 10000; ++i) {
+                    const size_type SIZE = 1 + (i * 37) % 3000;
+                    bsl::memset(sa.allocate(SIZE), 'x', SIZE);
+                }
+                ASSERTV(X.numRegions(), 1 < X.numRegions());
+
+                sa.release();
+                ASSERTV(X.numRegions(), X.numRegions() <= 1);
+
+                bsl::memset(sa.allocate(100), 'y', 100);
+            }
+            ASSERTV(X.numRegions(), X.numRegions() <= 1);
+        }
+
+        if (verbose) cout << "\n'bdlma::Multipool'." << endl;
+        {
+            Obj mX(Obj::hugePageSize());  const Obj& X = mX;
+            {
+                bdlma::Multipool mp(&mX);
+
+                for (int i = 0; i < 10000; ++i) {
+                    const size_type SIZE = 1 + (i * 37) % 5000;
+                    void *p = mp.allocate(SIZE);
+                    bsl::memset(p, 'x', SIZE);
+                    if (i % 2) {
+                        mp.deallocate(p);
+                    }
+                }
+                ASSERTV(X.numRegions(), 1 <= X.numRegions());
+
+                // The multipool retains its array of pools, which may lie in
+                // a region other than the current one.
+
+                mp.release();
+                ASSERTV(X.numRegions(), X.numRegions() <= 2);
+            }
+            ASSERTV(X.numRegions(), X.numRegions() <= 1);
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\n'bdlma::ConcurrentPool' and threads." << endl;
+        {
+            using namespace CONCURRENCY_TEST;
+
+            enum { k_NUM_THREADS = 4 };
+
+            Obj mX(Obj::hugePageSize());  const Obj& X = mX;
+            {
+                bdlma::ConcurrentPool pool(200, &mX);
+
+                ThreadArgs                args[k_NUM_THREADS];
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    args[i].d_pool_p     = &pool;
+                    args[i].d_upstream_p = &mX;
+                    args[i].d_id         = i;
+                    args[i].d_numErrors  = 0;
+
+                    ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                          &workerThread,
+                                                          &args[i]));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                    ASSERTV(i, args[i].d_numErrors, 0 == args[i].d_numErrors);
+                }
+
+                pool.release();
+            }
+            ASSERTV(X.numRegions(), X.numRegions() <= 1);
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND RELEASE
+        //
+        // Concerns:
+        //: 1 'allocate' returns 0 for a size of 0, and otherwise returns a
+        //:   maximally-aligned block, disjoint from every other outstanding
+        //:   block, that can be written in full.
+        //:
+        //: 2 Blocks are carved sequentially from the current region, and a
+        //:   new region is obtained when the current region is exhausted.
+        //:
+        //: 3 A block larger than half a region is given a region of its own,
+        //:   which is returned to the system when the block is deallocated.
+        //:
+        //: 4 When the last block of a region is deallocated, the region is
+        //:   returned to the system, or reused if it is the current region.
+        //:
+        //: 5 'deallocate' accepts 0.
+        //:
+        //: 6 'release' returns every region to the system, as does the
+        //:   destructor, and the allocator remains usable.
+        //:
+        //: 7 'numHugeTlbRegions' never exceeds 'numRegions'.
+        //:
+        //: 8 No memory is obtained from the default allocator.
+        //
+        // Plan:
+        //: 1 Allocate blocks of varying sizes, verify their alignment, fill
+        //:   each block with a distinct value, verify that no block was
+        //:   overwritten, and track 'numRegions' as blocks are allocated and
+        //:   deallocated.  (C-1..8)
+        //
+        // Testing:
+        //   ~HugePageAllocator();
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void release();
+        //   int numHugeTlbRegions() const;
+        //   int numRegions() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE, DEALLOCATE, AND RELEASE" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa(veryVeryVerbose);
+
+        const size_type HUGE_PAGE = Obj::hugePageSize();
+
+        if (verbose) cout << "\nAlignment and integrity of blocks." << endl;
+        {
+            static const size_type SIZES[] = { 1, 2, 3, 7, 8, 15, 16, 17, 100,
+                                               1000, 4095, 4096, 4097, 10000,
+                                               100000 };
+            const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            Obj mX(HUGE_PAGE);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            ASSERT(0 == X.numRegions());
+
+            for (int round = 0; round < 2; ++round) {
+                bsl::vector<char *> blocks(&oa);
+
+                for (int k = 0; k < 20; ++k) {
+                    for (int si = 0; si < NUM_SIZES; ++si) {
+                        const size_type SIZE = SIZES[si];
+
+                        char *p = static_cast<char *>(mX.allocate(SIZE));
+                        ASSERTV(SIZE, p);
+                        ASSERTV(SIZE,
+                                0 == reinterpret_cast<UintPtr>(p) % MAX_ALIGN);
+
+                        bsl::memset(p,
+                                    static_cast<char>(blocks.size()),
+                                    SIZE);
+                        blocks.push_back(p);
+                    }
+                }
+
+                ASSERTV(X.numRegions(), 1 < X.numRegions());
+                ASSERTV(X.numHugeTlbRegions() <= X.numRegions());
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    const size_type SIZE = SIZES[i % NUM_SIZES];
+                    const char      FILL = static_cast<char>(i);
+
+                    bool isIntact = true;
+                    for (size_type j = 0; j < SIZE; ++j) {
+                        isIntact = isIntact && FILL == blocks[i][j];
+                    }
+                    ASSERTV(i, isIntact);
+                }
+
+                if (0 == round) {
+                    for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                        mX.deallocate(blocks[i]);
+                    }
+                    mX.deallocate(0);
+
+                    // Only the current region remains.
+
+                    ASSERTV(X.numRegions(), 1 == X.numRegions());
+                }
+                else {
+                    mX.release();
+
+                    ASSERTV(X.numRegions(), 0 == X.numRegions());
+                    ASSERTV(X.numHugeTlbRegions(),
+                            0 == X.numHugeTlbRegions());
+                }
+            }
+
+            // Leave outstanding blocks for the destructor.
+
+            bsl::memset(mX.allocate(1000), 'x', 1000);
+            bsl::memset(mX.allocate(3 * HUGE_PAGE), 'x', 3 * HUGE_PAGE);
+            ASSERTV(X.numRegions(), 2 == X.numRegions());
+        }
+
+        if (verbose) cout << "\nSequential carving and region reuse." << endl;
+        {
+            Obj mX(HUGE_PAGE);  const Obj& X = mX;
+
+            const size_type STRIDE =
+                        bsls::AlignmentUtil::roundUpToMaximalAlignment(100)
+                      + Obj::k_BLOCK_OVERHEAD;
+
+            char *p = static_cast<char *>(mX.allocate(100));
+            char *q = static_cast<char *>(mX.allocate(100));
+
+            ASSERT(1 == X.numRegions());
+            ASSERT(p + STRIDE == q);
+
+            mX.deallocate(p);
+            mX.deallocate(q);
+            ASSERT(1 == X.numRegions());
+
+            // The current region is reused from its start.
+
+            char *r = static_cast<char *>(mX.allocate(100));
+            ASSERT(p == r);
+
+            // Exhaust the current region; the new region becomes current.
+
+            const size_type SIZE = HUGE_PAGE / 3;
+
+            char *a = static_cast<char *>(mX.allocate(SIZE));
+            char *b = static_cast<char *>(mX.allocate(SIZE));
+            ASSERTV(X.numRegions(), 1 == X.numRegions());
+
+            char *c = static_cast<char *>(mX.allocate(SIZE));
+            ASSERTV(X.numRegions(), 2 == X.numRegions());
+
+            bsl::memset(a, 'a', SIZE);
+            bsl::memset(b, 'b', SIZE);
+            bsl::memset(c, 'c', SIZE);
+
+            // Deallocating every block of the old region returns it.
+
+            mX.deallocate(r);
+            mX.deallocate(a);
+            ASSERTV(X.numRegions(), 2 == X.numRegions());
+            mX.deallocate(b);
+            ASSERTV(X.numRegions(), 1 == X.numRegions());
+
+            // The current region is retained when its last block is freed.
+
+            mX.deallocate(c);
+            ASSERTV(X.numRegions(), 1 == X.numRegions());
+        }
+
+        if (verbose) cout << "\nLarge blocks." << endl;
+        {
+            Obj mX(HUGE_PAGE);  const Obj& X = mX;
+
+            char *small = static_cast<char *>(mX.allocate(100));
+            ASSERT(1 == X.numRegions());
+
+            const size_type SIZE = HUGE_PAGE;
+
+            char *large1 = static_cast<char *>(mX.allocate(SIZE));
+            ASSERT(2 == X.numRegions());
+            char *large2 = static_cast<char *>(mX.allocate(3 * SIZE + 1));
+            ASSERT(3 == X.numRegions());
+
+            bsl::memset(large1, 'x', SIZE);
+            bsl::memset(large2, 'y', 3 * SIZE + 1);
+
+            // Carving continues from the current region.
+
+            char *small2 = static_cast<char *>(mX.allocate(100));
+            ASSERT(3 == X.numRegions());
+            ASSERT(small
+                 + bsls::AlignmentUtil::roundUpToMaximalAlignment(100)
+                 + Obj::k_BLOCK_OVERHEAD == small2);
+
+            mX.deallocate(large1);
+            ASSERT(2 == X.numRegions());
+            mX.deallocate(large2);
+            ASSERT(1 == X.numRegions());
+
+            mX.deallocate(small);
+            mX.deallocate(small2);
+            ASSERT(1 == X.numRegions());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTOR, 'hugePageSize', AND 'regionSize'
+        //
+        // Concerns:
+        //: 1 'hugePageSize' returns a power of two that is a multiple of the
+        //:   regular page size, and the same value on every call.
+        //:
+        //: 2 The region size is the value supplied at construction rounded up
+        //:   to a multiple of 'hugePageSize', or 'k_DEFAULT_REGION_SIZE'
+        //:   rounded likewise by default.
+        //:
+        //: 3 No memory is obtained at construction.
+        //:
+        //: 4 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Call 'hugePageSize' repeatedly and verify its value.  (C-1)
+        //:
+        //: 2 Construct objects with a table of region sizes, and verify
+        //:   'regionSize' and 'numRegions'.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   static bsls::Types::size_type hugePageSize();
+        //   explicit HugePageAllocator(bsls::Types::size_type regionSize);
+        //   bsls::Types::size_type regionSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                   << "CONSTRUCTOR, 'hugePageSize', AND 'regionSize'" << endl
+                   << "=============================================" << endl;
+
+        const size_type HUGE_PAGE = Obj::hugePageSize();
+        if (verbose) { P(HUGE_PAGE) }
+
+        ASSERT(HUGE_PAGE == Obj::hugePageSize());
+        ASSERT(4096 <= HUGE_PAGE);
+        ASSERT(0 == (HUGE_PAGE & (HUGE_PAGE - 1)));
+
+        {
+            const Obj X;
+            ASSERT(0 == X.numRegions());
+            ASSERT(0 == X.regionSize() % HUGE_PAGE);
+            ASSERT(Obj::k_DEFAULT_REGION_SIZE <= X.regionSize());
+            ASSERT(X.regionSize() - HUGE_PAGE < Obj::k_DEFAULT_REGION_SIZE);
+        }
+
+        static const struct {
+            int       d_line;
+            size_type d_regionSize;
+            size_type d_expPages;
+        } DATA[] = {
+            //LINE  REGION SIZE          EXP PAGES
+            //----  -------------------  ---------
+            { L_,   1,                   1         },
+            { L_,   HUGE_PAGE - 1,       1         },
+            { L_,   HUGE_PAGE,           1         },
+            { L_,   HUGE_PAGE + 1,       2         },
+            { L_,   10 * HUGE_PAGE,      10        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int       LINE        = DATA[ti].d_line;
+            const size_type REGION_SIZE = DATA[ti].d_regionSize;
+            const size_type EXP         = DATA[ti].d_expPages * HUGE_PAGE;
+
+            if (veryVerbose) { T_ P_(LINE) P_(REGION_SIZE) P(EXP) }
+
+            const Obj X(REGION_SIZE);
+            ASSERTV(LINE, EXP == X.regionSize());
+            ASSERTV(LINE, 0   == X.numRegions());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(0));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate and write to some blocks,
+        //:   deallocate them, release the allocator, and allocate again.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        char *p = static_cast<char *>(mX.allocate(100));
+        ASSERT(p);
+        bsl::memset(p, 'a', 100);
+
+        char *q = static_cast<char *>(mX.allocate(64 * 1024 * 1024));
+        ASSERT(q);
+        bsl::memset(q, 'b', 64 * 1024 * 1024);
+
+        ASSERT('a' == p[99]);
+        ASSERT(2 == X.numRegions());
+
+        mX.deallocate(q);
+        ASSERT(1 == X.numRegions());
+
+        mX.release();
+        ASSERT(0 == X.numRegions());
+
+        p = static_cast<char *>(mX.allocate(100));
+        ASSERT(p);
+        bsl::memset(p, 'c', 100);
+
+        if (verbose) {
+            P(Obj::hugePageSize())
+            P(X.numHugeTlbRegions())
+        }
+
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: PAGE FAULTS AND TLB MISSES BY UPSTREAM ALLOCATOR
+        //   Report the cost of a workload that allocates a large arena of
+        //   small objects from a 'bdlma::SequentialAllocator' and visits them
+        //   in a pseudo-random order, for each upstream allocator.  Each
+        //   result is printed as a line of comma-separated 'key=value' pairs.
+        //   Data TLB misses are reported only where performance counters are
+        //   accessible (e.g., Linux with a permissive
+        //   'perf_event_paranoid').
+        //
+        //   Usage: <driver> -1 [numOrders [numVisits]]
+        //
+        // Testing:
+        //   BENCHMARK: page faults and TLB misses by upstream allocator
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+            << "BENCHMARK: PAGE FAULTS AND TLB MISSES BY UPSTREAM ALLOCATOR"
+            << endl
+            << "==========================================================="
+            << endl;
+
+        using namespace BENCHMARK;
+
+        const int numOrders = argc > 2 ? atoi(argv[2]) : 4 * 1000 * 1000;
+        const int numVisits = argc > 3 ? atoi(argv[3]) : 4 * numOrders;
+
+        bslma::NewDeleteAllocator newDelete;
+        runBenchmark("NewDeleteAllocator", &newDelete, numOrders, numVisits);
+
+        {
+            Obj hugePage;
+            runBenchmark("HugePageAllocator", &hugePage, numOrders, numVisits);
+
+            cout << "HugePageAllocator,hugePageSize=" << Obj::hugePageSize()
+                 << ",hugeTlbRegions=" << hugePage.numHugeTlbRegions()
+                 << endl;
+        }
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,523 @@
+// bdlma_numaarenaallocator.cpp                                       -*-C++-*-
+#include <bdlma_numaarenaallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_numaarenaallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_cstdio.h>
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>         // 'GetNumaHighestNodeNumber',
+                             // 'GetNumaNodeProcessorMask', 'GetSystemInfo',
+                             // 'VirtualAlloc', 'VirtualAllocExNuma',
+                             // 'VirtualFree'
+#else
+
+#include <sys/mman.h>        // 'mmap', 'munmap'
+#include <unistd.h>          // 'sysconf'
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>     // 'SYS_mbind'
+#endif
+
+#endif
+
+///Implementation Notes
+///--------------------
+// On Linux, 'mbind' is invoked through 'syscall' rather than through
+// 'libnuma', which is not installed on every machine.  The node mask passed to
+// 'mbind' has 'k_MAX_NODES' bits; the kernel reads one bit fewer than the
+// 'maxnode' argument, which is therefore 'k_MAX_NODES + 1'.  The topology of
+// the machine is read from 'sysfs', where both the online nodes and the
+// processors of each node are described by lists of ranges such as "0-3,8".
+
+namespace BloombergLP {
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)
+enum {
+    k_MPOL_BIND  = 2,     // 'MPOL_BIND' policy of 'mbind'
+
+    k_MAX_NODES  = 1024   // number of nodes representable in the node mask
+};
+#endif
+
+// HELPER FUNCTIONS
+
+bsl::size_t getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;                              // RETURN
+#else
+    return static_cast<bsl::size_t>(sysconf(_SC_PAGESIZE));           // RETURN
+#endif
+}
+
+void *mapRegion(bsl::size_t size, int node, bool bind, bool *isBound)
+    // Return the address of a newly obtained, page-aligned region of virtual
+    // memory of the specified 'size' (in bytes), or 0 if the region cannot be
+    // obtained.  If the specified 'bind' is 'true', attempt to bind the region
+    // to the specified NUMA 'node', and load into the specified 'isBound'
+    // whether the operating system bound the region; otherwise, load 'false'
+    // into 'isBound'.  The behavior is undefined unless '0 < size' and
+    // '0 <= node'.
+{
+    BSLS_ASSERT(0 < size);
+    BSLS_ASSERT(0 <= node);
+    BSLS_ASSERT(isBound);
+
+    *isBound = false;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    if (bind) {
+        void *address = VirtualAllocExNuma(GetCurrentProcess(),
+                                           0,
+                                           size,
+                                           MEM_COMMIT | MEM_RESERVE,
+                                           PAGE_READWRITE,
+                                           static_cast<DWORD>(node));
+        if (address) {
+            *isBound = true;
+            return address;                                           // RETURN
+        }
+    }
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)
+    if (bind && node < k_MAX_NODES) {
+        const int k_BITS_PER_WORD =
+                                  static_cast<int>(8 * sizeof(unsigned long));
+
+        unsigned long nodeMask[k_MAX_NODES / (8 * sizeof(unsigned long))] =
+                                                                         { 0 };
+        nodeMask[node / k_BITS_PER_WORD] = 1UL << (node % k_BITS_PER_WORD);
+
+        *isBound = 0 == syscall(SYS_mbind,
+                                address,
+                                size,
+                                static_cast<int>(k_MPOL_BIND),
+                                nodeMask,
+                                static_cast<unsigned long>(k_MAX_NODES + 1),
+                                0U);
+    }
+#else
+    (void)node;
+    (void)bind;
+#endif
+
+    return address;                                                   // RETURN
+
+#endif
+}
+
+void unmapRegion(void *address, bsl::size_t size)
+    // Return the region of virtual memory at the specified 'address' having
+    // the specified 'size' (in bytes) to the operating system.  The behavior
+    // is undefined unless 'address' and 'size' describe a region obtained
+    // from 'mapRegion' that has not already been unmapped.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+#else
+    // On some of our platforms, 'munmap' takes a 'char*' argument, while on
+    // others it takes a 'void*'.  Casting to 'char*' works in both cases.
+
+    munmap(static_cast<char *>(address), size);
+#endif
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+int readFile(char *buffer, int bufferLength, const char *path)
+    // Load into the specified 'buffer' of the specified 'bufferLength' the
+    // null-terminated contents of the file at the specified 'path'.  Return 0
+    // on success, and a non-zero value if the file cannot be read or does not
+    // fit in 'buffer'.
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < bufferLength);
+    BSLS_ASSERT(path);
+
+    FILE *file = bsl::fopen(path, "r");
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t length = bsl::fread(buffer, 1, bufferLength, file);
+    bsl::fclose(file);
+
+    if (static_cast<bsl::size_t>(bufferLength) <= length) {
+        return -2;                                                    // RETURN
+    }
+
+    buffer[length] = '\0';
+    return 0;
+}
+
+int parseList(bsl::vector<int> *result, int *maximum, const char *text)
+    // Load into the specified 'maximum' the largest of the integers described
+    // by the specified 'text', a comma-separated list of non-negative integers
+    // and ranges of integers (e.g., "0-3,8,10-11") optionally followed by
+    // white space, or -1 if 'text' describes no integers; if the specified
+    // 'result' is not 0, also load the integers into 'result'.  Return 0 on
+    // success, and a non-zero value (with no effect on 'result' and
+    // 'maximum') if 'text' is not a valid list.
+{
+    BSLS_ASSERT(maximum);
+    BSLS_ASSERT(text);
+
+    bsl::vector<int> values(result ? result->get_allocator()
+                                   : bsl::allocator<int>());
+    int              max = -1;
+
+    const char *p = text;
+    while ('0' <= *p && *p <= '9') {
+        int first = 0;
+        while ('0' <= *p && *p <= '9') {
+            first = first * 10 + (*p++ - '0');
+            if (first > 1024 * 1024) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        int last = first;
+        if ('-' == *p) {
+            ++p;
+            if (*p < '0' || '9' < *p) {
+                return -1;                                            // RETURN
+            }
+            last = 0;
+            while ('0' <= *p && *p <= '9') {
+                last = last * 10 + (*p++ - '0');
+                if (last > 1024 * 1024) {
+                    return -1;                                        // RETURN
+                }
+            }
+            if (last < first) {
+                return -1;                                            // RETURN
+            }
+        }
+
+        if (result) {
+            for (int i = first; i <= last; ++i) {
+                values.push_back(i);
+            }
+        }
+        max = bsl::max(max, last);
+
+        if (',' == *p) {
+            ++p;
+        }
+    }
+
+    while (' ' == *p || '\n' == *p) {
+        ++p;
+    }
+    if ('\0' != *p) {
+        return -1;                                                    // RETURN
+    }
+
+    if (result) {
+        result->swap(values);
+    }
+    *maximum = max;
+    return 0;
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                     // ======================================
+                     // struct NumaArenaAllocator::RegionHeader
+                     // ======================================
+
+struct NumaArenaAllocator::RegionHeader {
+    // This 'struct' heads each region obtained by a 'NumaArenaAllocator', and
+    // links it into the list of all regions of that allocator.
+
+    RegionHeader           *d_next_p;  // previously obtained region, or 0
+
+    bsls::Types::size_type  d_size;    // size (in bytes) of this region
+};
+
+                         // ------------------------
+                         // class NumaArenaAllocator
+                         // ------------------------
+
+// CLASS METHODS
+int NumaArenaAllocator::cpusOfNode(bsl::vector<int> *result, int node)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(0 <= node);
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    char buffer[8192];
+    if (0 == readFile(buffer,
+                      sizeof buffer,
+                      "/sys/devices/system/node/online")) {
+        char path[64];
+        bsl::sprintf(path, "/sys/devices/system/node/node%d/cpulist", node);
+
+        bsl::vector<int> cpus(result->get_allocator());
+        int              maxCpu;
+        if (0 != readFile(buffer, sizeof buffer, path)
+         || 0 != parseList(&cpus, &maxCpu, buffer)
+         || cpus.empty()) {
+            return -1;                                                // RETURN
+        }
+
+        result->swap(cpus);
+        return 0;                                                     // RETURN
+    }
+
+    // The kernel does not support NUMA: fall through.
+
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    ULONGLONG mask = 0;
+    if (node > 0xff
+     || !GetNumaNodeProcessorMask(static_cast<UCHAR>(node), &mask)
+     || 0 == mask) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::vector<int> cpus(result->get_allocator());
+    for (int i = 0; i < 64; ++i) {
+        if (mask & (static_cast<ULONGLONG>(1) << i)) {
+            cpus.push_back(i);
+        }
+    }
+
+    result->swap(cpus);
+    return 0;                                                         // RETURN
+
+#endif
+
+#if !defined(BSLS_PLATFORM_OS_WINDOWS)
+    if (0 != node) {
+        return -1;                                                    // RETURN
+    }
+
+    const int numCpus = static_cast<int>(
+                                   bslmt::ThreadUtil::hardwareConcurrency());
+
+    bsl::vector<int> cpus(result->get_allocator());
+    for (int i = 0; i < numCpus; ++i) {
+        cpus.push_back(i);
+    }
+
+    result->swap(cpus);
+    return 0;
+#endif
+}
+
+int NumaArenaAllocator::numNodes()
+{
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+    char buffer[8192];
+    int  maxNode;
+    if (0 == readFile(buffer,
+                      sizeof buffer,
+                      "/sys/devices/system/node/online")
+     && 0 == parseList(0, &maxNode, buffer)
+     && 0 <= maxNode) {
+        return maxNode + 1;                                           // RETURN
+    }
+
+#elif defined(BSLS_PLATFORM_OS_WINDOWS)
+
+    ULONG highestNode;
+    if (GetNumaHighestNodeNumber(&highestNode)) {
+        return static_cast<int>(highestNode) + 1;                     // RETURN
+    }
+
+#endif
+
+    return 1;
+}
+
+// PRIVATE MANIPULATORS
+void NumaArenaAllocator::replenish(bsls::Types::size_type size)
+{
+    const bsls::Types::size_type minSize =
+                   bsl::max(size + sizeof(RegionHeader)
+                                 + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT,
+                            d_regionSize);
+
+    if (minSize < size) {
+        // The requested size is too large to be represented with the header.
+
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    // Round up to a multiple of the page size.
+
+    const bsls::Types::size_type regionSize =
+                         (minSize + d_pageSize - 1) / d_pageSize * d_pageSize;
+
+    bool  isBound;
+    char *region = static_cast<char *>(mapRegion(regionSize,
+                                                 d_node,
+                                                 d_bindRegions,
+                                                 &isBound));
+    if (!region) {
+        BSLS_THROW(bsl::bad_alloc());
+    }
+
+    if (d_bindRegions && !isBound) {
+        // Fall back to first touch: touch every page from the calling thread.
+
+        for (bsls::Types::size_type offset = 0;
+             offset < regionSize;
+             offset += d_pageSize) {
+            region[offset] = 0;
+        }
+        d_isBound = false;
+    }
+
+    RegionHeader *header = reinterpret_cast<RegionHeader *>(region);
+    header->d_next_p = d_regions_p;
+    header->d_size   = regionSize;
+    d_regions_p      = header;
+
+    d_cursor_p = region + sizeof(RegionHeader);
+    d_end_p    = region + regionSize;
+}
+
+// CREATORS
+NumaArenaAllocator::NumaArenaAllocator(int node)
+: d_node(node)
+, d_isBound(true)
+, d_bindRegions(0 != node || 1 < numNodes())
+, d_pageSize(getSystemPageSize())
+, d_regionSize(k_DEFAULT_REGION_SIZE)
+, d_regions_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+{
+    BSLS_ASSERT(0 <= node);
+}
+
+NumaArenaAllocator::NumaArenaAllocator(int                    node,
+                                       bsls::Types::size_type regionSize)
+: d_node(node)
+, d_isBound(true)
+, d_bindRegions(0 != node || 1 < numNodes())
+, d_pageSize(getSystemPageSize())
+, d_regionSize(regionSize)
+, d_regions_p(0)
+, d_cursor_p(0)
+, d_end_p(0)
+{
+    BSLS_ASSERT(0 <= node);
+    BSLS_ASSERT(0 < regionSize);
+}
+
+NumaArenaAllocator::~NumaArenaAllocator()
+{
+    release();
+}
+
+// MANIPULATORS
+void *NumaArenaAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    char *address = d_cursor_p
+                  + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                    d_cursor_p,
+                                    bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                      d_end_p < address
+                   || static_cast<bsls::Types::size_type>(d_end_p - address)
+                                                                    < size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        replenish(size);
+
+        address = d_cursor_p
+                + bsls::AlignmentUtil::calculateAlignmentOffset(
+                                    d_cursor_p,
+                                    bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+    }
+
+    BSLS_ASSERT(address + size <= d_end_p);
+
+    d_cursor_p = address + size;
+    return address;
+}
+
+void NumaArenaAllocator::release()
+{
+    RegionHeader *region = d_regions_p;
+    while (region) {
+        RegionHeader *next = region->d_next_p;
+        unmapRegion(region, region->d_size);
+        region = next;
+    }
+
+    d_regions_p = 0;
+    d_cursor_p  = 0;
+    d_end_p     = 0;
+    d_isBound   = true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,351 @@
+// bdlma_numaarenaallocator.h                                         -*-C++-*-
+#ifndef INCLUDED_BDLMA_NUMAARENAALLOCATOR
+#define INCLUDED_BDLMA_NUMAARENAALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a managed allocator of memory local to a NUMA node.
+//
+//@CLASSES:
+//  bdlma::NumaArenaAllocator: managed arena of memory bound to a NUMA node
+//
+//@SEE_ALSO: bdlma_heapbypassallocator, bdlma_multipool,
+//           bdlma_sequentialallocator, bslmt_threadattributes
+//
+//@DESCRIPTION: This component provides a concrete mechanism,
+// 'bdlma::NumaArenaAllocator', that implements the 'bdlma::ManagedAllocator'
+// protocol and dispenses memory from large regions obtained directly from
+// virtual memory and placed on a NUMA (Non-Uniform Memory Access) node
+// specified at construction:
+//..
+//   ,-------------------------.
+//  ( bdlma::NumaArenaAllocator )
+//   `-------------------------'
+//                |        ctor/dtor
+//                |        isBound
+//                |        node
+//                |        regionSize
+//                |        numNodes                    (static)
+//                |        cpusOfNode                  (static)
+//                V
+//    ,-----------------------.
+//   ( bdlma::ManagedAllocator )
+//    `-----------------------'
+//                |        release
+//                V
+//       ,----------------.
+//      ( bslma::Allocator )
+//       `----------------'
+//                         allocate
+//                         deallocate                  // no-op
+//..
+// On a machine having more than one NUMA node, memory on the node to which a
+// processor is attached can be accessed considerably faster than memory on
+// other ("remote") nodes.  Operating systems typically place a page on the
+// node of the processor that first touches it, but memory allocated by one
+// thread and used by another -- or pooled memory recycled across threads --
+// frequently ends up on a remote node.  A 'bdlma::NumaArenaAllocator' binds
+// every region it obtains to its node, so that a thread pinned to the
+// processors of that node (see 'cpusOfNode' and the 'cpuAffinity' attribute of
+// 'bslmt::ThreadAttributes') always works with node-local memory.
+//
+// A 'bdlma::NumaArenaAllocator' is typically used as the allocator supplying
+// the blocks of another allocator, such as a 'bdlma::Multipool' or a
+// 'bdlma::SequentialAllocator', so that all of the memory managed by that
+// allocator is local to the node.
+//
+///Binding Memory to a Node
+///------------------------
+// Each region is a multiple of the page size in length.  The way a region is
+// bound to the node depends on the platform:
+//
+//: o On Linux, each region is bound with the 'mbind' system call, using the
+//:   'MPOL_BIND' policy.  If 'mbind' is not available (e.g., the kernel was
+//:   built without NUMA support or the call is disallowed), or the node does
+//:   not exist, every page of the region is instead touched by the thread
+//:   that obtains the region, so that the "first-touch" policy of the kernel
+//:   places the region on the node of that thread.
+//:
+//: o On Windows, each region is allocated with 'VirtualAllocExNuma', with
+//:   the node as the preferred node.
+//:
+//: o On a machine having only one node, regions for node 0 are obtained from
+//:   virtual memory without any binding, as all memory is then local.
+//:
+//: o On other platforms, regions are obtained from virtual memory and bound
+//:   by first touch, as on Linux without 'mbind'.
+//
+// The 'isBound' accessor indicates whether all of the memory of an allocator
+// is known to be local to its node.  If 'isBound' returns 'false', the memory
+// is local to the node only if the regions were obtained by a thread running
+// on the node.
+//
+///Thread Safety
+///-------------
+// 'bdlma::NumaArenaAllocator' is *const* *thread-safe*, meaning that accessors
+// may be invoked concurrently from different threads, but it is not safe to
+// invoke a manipulator concurrently with any other method on the same object.
+// A 'bdlma::NumaArenaAllocator' is intended to be owned by a single thread
+// pinned to the node, or to be protected by the thread-safe allocator that it
+// supplies.  The class methods 'numNodes' and 'cpusOfNode' are thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Node-Local Memory for a Pinned Worker Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we run a worker thread on every NUMA node of the machine, and
+// that each worker makes heavy use of a 'bdlma::Multipool'.  We want each
+// worker to run only on the processors of its node and to use only memory
+// local to that node.
+//
+// First, we define the function run by a worker, which creates an arena
+// bound to the node of the worker and supplies it to the multipool:
+//..
+//  extern "C" void *workerFunction(void *arg)
+//      // Perform work using memory local to the NUMA node specified by
+//      // 'arg'.
+//  {
+//      const int node =
+//                static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(arg));
+//
+//      bdlma::NumaArenaAllocator arena(node);
+//      bdlma::Multipool          multipool(&arena);
+//
+//      for (int i = 0; i < 1000; ++i) {
+//          char *buffer = static_cast<char *>(multipool.allocate(100));
+//          memset(buffer, 'x', 100);
+//          multipool.deallocate(buffer);
+//      }
+//
+//      return 0;
+//  }
+//..
+// Note that the multipool must be destroyed before the arena supplying its
+// memory.
+//
+// Then, in the main thread, we create one worker per node, pinning each
+// worker to the processors of its node.  If the processors of a node cannot be
+// determined, the worker inherits the affinity of the main thread:
+//..
+//  const int numNodes = bdlma::NumaArenaAllocator::numNodes();
+//
+//  bsl::vector<bslmt::ThreadUtil::Handle> workers(numNodes);
+//
+//  for (int node = 0; node < numNodes; ++node) {
+//      bslmt::ThreadAttributes attributes;
+//
+//      bsl::vector<int> cpus;
+//      if (0 == bdlma::NumaArenaAllocator::cpusOfNode(&cpus, node)) {
+//          attributes.setCpuAffinity(cpus);
+//      }
+//
+//      void *arg = reinterpret_cast<void *>(
+//                                     static_cast<bsls::Types::IntPtr>(node));
+//
+//      int rc = bslmt::ThreadUtil::create(&workers[node],
+//                                         attributes,
+//                                         &workerFunction,
+//                                         arg);
+//      assert(0 == rc);
+//  }
+//..
+// Finally, we wait for the workers to complete:
+//..
+//  for (int node = 0; node < numNodes; ++node) {
+//      int rc = bslmt::ThreadUtil::join(workers[node]);
+//      assert(0 == rc);
+//  }
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_managedallocator.h>
+
+#include <bsls_types.h>
+
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // ========================
+                         // class NumaArenaAllocator
+                         // ========================
+
+class NumaArenaAllocator : public ManagedAllocator {
+    // This class implements the 'ManagedAllocator' protocol to provide a fast
+    // arena allocator that dispenses maximally-aligned memory from regions
+    // obtained directly from virtual memory and bound to the NUMA node
+    // specified at construction.  Memory supplied by this allocator is
+    // reclaimed only when 'release' is called or the allocator is destroyed;
+    // 'deallocate' has no effect.
+
+    // PRIVATE TYPES
+    struct RegionHeader;                     // implementation detail
+
+    // DATA
+    int                     d_node;          // NUMA node of the memory
+
+    bool                    d_isBound;       // 'true' unless a region could
+                                             // not be bound to 'd_node' by
+                                             // the operating system
+
+    bool                    d_bindRegions;   // 'true' unless all memory is
+                                             // local to 'd_node'
+
+    bsls::Types::size_type  d_pageSize;      // virtual memory page size
+
+    bsls::Types::size_type  d_regionSize;    // minimum size of a region
+
+    RegionHeader           *d_regions_p;     // most recently obtained region,
+                                             // heading a linked list of all
+                                             // regions
+
+    char                   *d_cursor_p;      // next free byte of the current
+                                             // region
+
+    const char             *d_end_p;         // end of the current region
+
+  private:
+    // NOT IMPLEMENTED
+    NumaArenaAllocator(const NumaArenaAllocator&);
+    NumaArenaAllocator& operator=(const NumaArenaAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void replenish(bsls::Types::size_type size);
+        // Obtain a new region, bound to the node of this allocator and large
+        // enough to supply a block of the specified 'size' (in bytes), and
+        // make it the current region.  Throw 'bsl::bad_alloc' if the region
+        // cannot be obtained.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_DEFAULT_REGION_SIZE = 1024 * 1024  // default minimum size (in
+                                             // bytes) of a region
+    };
+
+    // CLASS METHODS
+    static int cpusOfNode(bsl::vector<int> *result, int node);
+        // Load into the specified 'result' the indices, in increasing order,
+        // of the processors attached to the specified NUMA 'node'.  Return 0
+        // on success, and a non-zero value (with no effect on 'result') if
+        // 'node' does not exist or its processors cannot be determined.  If
+        // the machine does not support NUMA, node 0 is attached to every
+        // processor.  The behavior is undefined unless '0 <= node'.  Note that
+        // the result is suitable to supply to the 'setCpuAffinity' method of
+        // 'bslmt::ThreadAttributes'.
+
+    static int numNodes();
+        // Return the number of NUMA nodes of this machine (more precisely,
+        // one more than the highest index of an online node), or 1 if the
+        // machine does not support NUMA.
+
+    // CREATORS
+    explicit NumaArenaAllocator(int node);
+    NumaArenaAllocator(int node, bsls::Types::size_type regionSize);
+        // Create an allocator dispensing memory bound to the specified NUMA
+        // 'node'.  Optionally specify a 'regionSize' indicating the minimum
+        // size (in bytes) of each region obtained from virtual memory.  If
+        // 'regionSize' is not specified, 'k_DEFAULT_REGION_SIZE' is used.  The
+        // behavior is undefined unless '0 <= node' and '0 < regionSize'.  Note
+        // that no memory is obtained until the first call to 'allocate'.
+
+    virtual ~NumaArenaAllocator();
+        // Destroy this allocator, returning all memory allocated from it to
+        // the operating system.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a maximally-aligned contiguous block of memory
+        // of the specified 'size' (in bytes) local to the node of this
+        // allocator.  If 'size' is 0, no memory is allocated and 0 is
+        // returned.  If the current region cannot supply the block, a new
+        // region of at least 'regionSize()' bytes is obtained from virtual
+        // memory; the unused remainder of the current region is not reused.
+        // Throw 'bsl::bad_alloc' if memory cannot be obtained.
+
+    virtual void deallocate(void *address);
+        // This method has no effect on the memory block at the specified
+        // 'address' as all memory allocated by this allocator is managed.
+        // The behavior is undefined unless 'address' is 0, or was allocated by
+        // this allocator and has not already been released.
+
+    virtual void release();
+        // Return all memory allocated from this allocator to the operating
+        // system, and reset the 'isBound' attribute to 'true'.  The allocator
+        // is left in a valid state, as if newly constructed.
+
+    // ACCESSORS
+    bool isBound() const;
+        // Return 'true' if all of the memory obtained by this allocator since
+        // construction, or since the last call to 'release', is known to be
+        // local to the node of this allocator, either because the machine has
+        // only that node or because every region was bound to the node by the
+        // operating system, and 'false' otherwise.
+
+    int node() const;
+        // Return the NUMA node to which the memory of this allocator is bound.
+
+    bsls::Types::size_type regionSize() const;
+        // Return the minimum size (in bytes) of each region obtained by this
+        // allocator from virtual memory.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // ------------------------
+                         // class NumaArenaAllocator
+                         // ------------------------
+
+// MANIPULATORS
+inline
+void NumaArenaAllocator::deallocate(void *)
+{
+}
+
+// ACCESSORS
+inline
+bool NumaArenaAllocator::isBound() const
+{
+    return d_isBound;
+}
+
+inline
+int NumaArenaAllocator::node() const
+{
+    return d_node;
+}
+
+inline
+bsls::Types::size_type NumaArenaAllocator::regionSize() const
+{
+    return d_regionSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
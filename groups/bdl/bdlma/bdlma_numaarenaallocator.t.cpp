@@ -0,0 +1,613 @@
+// bdlma_numaarenaallocator.t.cpp                                     -*-C++-*-
+#include <bdlma_numaarenaallocator.h>
+
+#include <bdlma_multipool.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+  #include <windows.h>  // 'GetSystemInfo'
+#else
+  #include <unistd.h>   // 'sysconf'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::NumaArenaAllocator' is an arena allocator that obtains page-multiple
+// regions from virtual memory and binds them to a NUMA node.  Whether the
+// regions are actually bound depends on the machine running the test, so the
+// primary concerns are that the memory supplied is correctly sized, aligned,
+// and disjoint, that regions are obtained and returned to the system as
+// documented, and that the topology reported by the class methods is
+// consistent on any machine, including one without NUMA support.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static int cpusOfNode(bsl::vector<int> *result, int node);
+// [ 2] static int numNodes();
+//
+// CREATORS
+// [ 3] explicit NumaArenaAllocator(int node);
+// [ 3] NumaArenaAllocator(int node, bsls::Types::size_type regionSize);
+// [ 3] ~NumaArenaAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 3] void release();
+//
+// ACCESSORS
+// [ 3] bool isBound() const;
+// [ 3] int node() const;
+// [ 3] bsls::Types::size_type regionSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [ 3] CONCERN: Precondition violations are detected when enabled.
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_FAIL(expr) BSLS_ASSERTTEST_ASSERT_FAIL(expr)
+#define ASSERT_PASS(expr) BSLS_ASSERTTEST_ASSERT_PASS(expr)
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::NumaArenaAllocator Obj;
+typedef bsls::Types::size_type    size_type;
+typedef bsls::Types::UintPtr      UintPtr;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Node-Local Memory for a Pinned Worker Thread
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we run a worker thread on every NUMA node of the machine, and
+// that each worker makes heavy use of a 'bdlma::Multipool'.  We want each
+// worker to run only on the processors of its node and to use only memory
+// local to that node.
+//
+// First, we define the function run by a worker, which creates an arena
+// bound to the node of the worker and supplies it to the multipool:
+//..
+    extern "C" void *workerFunction(void *arg)
+        // Perform work using memory local to the NUMA node specified by
+        // 'arg'.
+    {
+        const int node =
+                  static_cast<int>(reinterpret_cast<bsls::Types::IntPtr>(arg));
+
+        bdlma::NumaArenaAllocator arena(node);
+        bdlma::Multipool          multipool(&arena);
+
+        for (int i = 0; i < 1000; ++i) {
+            char *buffer = static_cast<char *>(multipool.allocate(100));
+            memset(buffer, 'x', 100);
+            multipool.deallocate(buffer);
+        }
+
+        return 0;
+    }
+//..
+// Note that the multipool must be destroyed before the arena supplying its
+// memory.
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const size_type pageSize = info.dwAllocationGranularity;
+#else
+    const size_type pageSize = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+#endif
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, in the main thread, we create one worker per node, pinning each
+// worker to the processors of its node.  If the processors of a node cannot be
+// determined, the worker inherits the affinity of the main thread:
+//..
+    const int numNodes = bdlma::NumaArenaAllocator::numNodes();
+
+    bsl::vector<bslmt::ThreadUtil::Handle> workers(numNodes);
+
+    for (int node = 0; node < numNodes; ++node) {
+        bslmt::ThreadAttributes attributes;
+
+        bsl::vector<int> cpus;
+        if (0 == bdlma::NumaArenaAllocator::cpusOfNode(&cpus, node)) {
+            attributes.setCpuAffinity(cpus);
+        }
+
+        void *arg = reinterpret_cast<void *>(
+                                       static_cast<bsls::Types::IntPtr>(node));
+
+        int rc = bslmt::ThreadUtil::create(&workers[node],
+                                           attributes,
+                                           &workerFunction,
+                                           arg);
+        ASSERT(0 == rc);
+    }
+//..
+// Finally, we wait for the workers to complete:
+//..
+    for (int node = 0; node < numNodes; ++node) {
+        int rc = bslmt::ThreadUtil::join(workers[node]);
+        ASSERT(0 == rc);
+    }
+//..
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE, DEALLOCATE, AND RELEASE
+        //
+        // Concerns:
+        //: 1 'allocate' returns 0 for a size of 0, and otherwise returns a
+        //:   maximally-aligned block, disjoint from every other outstanding
+        //:   block, that can be written in full.
+        //:
+        //: 2 Blocks larger than the region size are supplied.
+        //:
+        //: 3 'deallocate' has no effect, and accepts 0.
+        //:
+        //: 4 'release' returns all memory to the system, and the allocator
+        //:   remains usable.
+        //:
+        //: 5 The accessors return the values supplied at construction, and
+        //:   'isBound' is 'true' if the machine has a single node and the
+        //:   node of the allocator is 0.
+        //:
+        //: 6 No memory is obtained from the default allocator.
+        //:
+        //: 7 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a table of region sizes, allocate blocks of varying sizes,
+        //:   including sizes larger than the region, verify their alignment,
+        //:   fill each block with a distinct value, and verify that no block
+        //:   was overwritten.  (C-1..3, 6)
+        //:
+        //: 2 Release the allocator and repeat.  (C-4)
+        //:
+        //: 3 Verify the accessors after construction, after allocation, and
+        //:   after release.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   explicit NumaArenaAllocator(int node);
+        //   NumaArenaAllocator(int node, bsls::Types::size_type regionSize);
+        //   ~NumaArenaAllocator();
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   void release();
+        //   bool isBound() const;
+        //   int node() const;
+        //   bsls::Types::size_type regionSize() const;
+        //   CONCERN: Precondition violations are detected when enabled.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE, DEALLOCATE, AND RELEASE" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa(veryVeryVerbose);
+
+        const int  NUM_NODES   = Obj::numNodes();
+        const bool SINGLE_NODE = 1 == NUM_NODES;
+
+        if (verbose) { P(NUM_NODES) }
+
+        static const size_type REGION_SIZES[] = { 1, 100, 4096, 65536,
+                                                  Obj::k_DEFAULT_REGION_SIZE };
+        const int NUM_REGION_SIZES =
+                                   sizeof REGION_SIZES / sizeof *REGION_SIZES;
+
+        static const size_type SIZES[] = { 1, 2, 3, 7, 8, 15, 16, 17, 100,
+                                           1000, 4095, 4096, 4097, 10000,
+                                           100000, 3 * 1024 * 1024 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        enum { k_NUM_ROUNDS = 3 };
+
+        for (int ri = 0; ri < NUM_REGION_SIZES; ++ri) {
+            const size_type REGION_SIZE = REGION_SIZES[ri];
+
+            if (veryVerbose) { P(REGION_SIZE) }
+
+            Obj mX(0, REGION_SIZE);  const Obj& X = mX;
+
+            ASSERTV(REGION_SIZE, 0           == X.node());
+            ASSERTV(REGION_SIZE, REGION_SIZE == X.regionSize());
+            ASSERTV(REGION_SIZE, X.isBound());
+
+            for (int round = 0; round < 2; ++round) {
+                bsl::vector<char *> blocks(&oa);
+
+                ASSERTV(REGION_SIZE, 0 == mX.allocate(0));
+
+                for (int k = 0; k < k_NUM_ROUNDS; ++k) {
+                    for (int si = 0; si < NUM_SIZES; ++si) {
+                        const size_type SIZE = SIZES[si];
+
+                        char *p = static_cast<char *>(mX.allocate(SIZE));
+                        ASSERTV(REGION_SIZE, SIZE, p);
+                        ASSERTV(REGION_SIZE, SIZE,
+                                0 == reinterpret_cast<UintPtr>(p) % MAX_ALIGN);
+
+                        const char FILL = static_cast<char>(blocks.size());
+                        bsl::memset(p, FILL, SIZE);
+                        blocks.push_back(p);
+
+                        mX.deallocate(p);
+                    }
+                }
+                mX.deallocate(0);
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    const size_type SIZE = SIZES[i % NUM_SIZES];
+                    const char      FILL = static_cast<char>(i);
+
+                    bool isIntact = true;
+                    for (size_type j = 0; j < SIZE; ++j) {
+                        isIntact = isIntact && FILL == blocks[i][j];
+                    }
+                    ASSERTV(REGION_SIZE, i, isIntact);
+                }
+
+                if (SINGLE_NODE) {
+                    ASSERTV(REGION_SIZE, X.isBound());
+                }
+
+                mX.release();
+
+                ASSERTV(REGION_SIZE, X.isBound());
+                ASSERTV(REGION_SIZE, REGION_SIZE == X.regionSize());
+            }
+        }
+
+        if (verbose) cout << "\nTesting the default region size." << endl;
+        {
+            Obj mX(0);  const Obj& X = mX;
+
+            ASSERT(0                          == X.node());
+            ASSERT(Obj::k_DEFAULT_REGION_SIZE == X.regionSize());
+
+            // Consecutive small blocks come from the same region.
+
+            char *p = static_cast<char *>(mX.allocate(1));
+            char *q = static_cast<char *>(mX.allocate(1));
+            ASSERT(p + MAX_ALIGN == q);
+        }
+
+        if (verbose) cout << "\nTesting a node that does not exist." << endl;
+        {
+            // Memory for a node that does not exist cannot be bound, but is
+            // nevertheless supplied.
+
+            Obj mX(NUM_NODES + 100, pageSize);  const Obj& X = mX;
+
+            ASSERT(NUM_NODES + 100 == X.node());
+            ASSERT(X.isBound());
+
+            char *p = static_cast<char *>(mX.allocate(3 * pageSize));
+            ASSERT(p);
+            bsl::memset(p, 'x', 3 * pageSize);
+            ASSERT(!X.isBound());
+
+            mX.release();
+            ASSERT(X.isBound());
+        }
+
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(0));
+            ASSERT_FAIL(Obj(-1));
+            ASSERT_PASS(Obj(0, 1));
+            ASSERT_FAIL(Obj(-1, 1));
+            ASSERT_FAIL(Obj(0, 0));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS
+        //
+        // Concerns:
+        //: 1 'numNodes' returns a positive value.
+        //:
+        //: 2 'cpusOfNode' succeeds for node 0, loading a non-empty, strictly
+        //:   increasing sequence of non-negative processor indices, using the
+        //:   allocator of the result.
+        //:
+        //: 3 Every processor belongs to at most one node.
+        //:
+        //: 4 'cpusOfNode' fails for a node that does not exist, without
+        //:   modifying the result.
+        //:
+        //: 5 Precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Call 'numNodes', and call 'cpusOfNode' for every node and for
+        //:   nodes beyond the last, verifying the results.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   static int cpusOfNode(bsl::vector<int> *result, int node);
+        //   static int numNodes();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da(veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa(veryVeryVerbose);
+
+        const int NUM_NODES = Obj::numNodes();
+        if (verbose) { P(NUM_NODES) }
+
+        ASSERTV(NUM_NODES, 0 < NUM_NODES);
+
+        bsl::vector<int> allCpus(&oa);
+        int              numNodesWithCpus = 0;
+
+        for (int node = 0; node < NUM_NODES; ++node) {
+            bsl::vector<int> cpus(&oa);
+
+            const int rc = Obj::cpusOfNode(&cpus, node);
+            if (veryVerbose) { P_(node) P_(rc) P(cpus.size()) }
+
+            if (0 != rc) {
+                // Nodes may be offline or have no processors, but node 0 is
+                // always present.
+
+                ASSERTV(node, 0 != node);
+                ASSERTV(node, cpus.empty());
+                continue;
+            }
+
+            ++numNodesWithCpus;
+
+            ASSERTV(node, !cpus.empty());
+            ASSERTV(node, &oa == cpus.get_allocator().mechanism());
+
+            for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+                ASSERTV(node, i, 0 <= cpus[i]);
+                ASSERTV(node, i, 0 == i || cpus[i - 1] < cpus[i]);
+                allCpus.push_back(cpus[i]);
+            }
+        }
+
+        ASSERT(0 < numNodesWithCpus);
+
+        bsl::sort(allCpus.begin(), allCpus.end());
+        ASSERT(allCpus.end() == bsl::adjacent_find(allCpus.begin(),
+                                                   allCpus.end()));
+
+        for (int node = NUM_NODES; node < NUM_NODES + 3; ++node) {
+            bsl::vector<int> cpus(1, -1, &oa);
+
+            ASSERTV(node, 0 != Obj::cpusOfNode(&cpus, node));
+            ASSERTV(node, 1 == cpus.size() && -1 == cpus[0]);
+        }
+
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::vector<int> cpus(&oa);
+
+            ASSERT_PASS(Obj::cpusOfNode(&cpus, 0));
+            ASSERT_FAIL(Obj::cpusOfNode(0, 0));
+            ASSERT_FAIL(Obj::cpusOfNode(&cpus, -1));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator for node 0, allocate and write to some
+        //:   blocks, release the allocator, and allocate again.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(0);  const Obj& X = mX;
+
+        ASSERT(0 == X.node());
+        ASSERT(X.isBound());
+
+        char *p = static_cast<char *>(mX.allocate(100));
+        ASSERT(p);
+        bsl::memset(p, 'a', 100);
+
+        char *q = static_cast<char *>(mX.allocate(2 * 1024 * 1024));
+        ASSERT(q);
+        bsl::memset(q, 'b', 2 * 1024 * 1024);
+
+        ASSERT('a' == p[99]);
+
+        mX.deallocate(p);
+        mX.release();
+
+        p = static_cast<char *>(mX.allocate(100));
+        ASSERT(p);
+        bsl::memset(p, 'c', 100);
+
+        if (verbose) {
+            P(Obj::numNodes())
+            P(X.isBound())
+        }
+
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
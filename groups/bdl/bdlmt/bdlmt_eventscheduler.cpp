@@ -16,6 +16,8 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 
 #include <bdlt_timeunitratio.h>
 
+#include <bslma_default.h>
+
 #include <bslmt_lockguard.h>
 
 #include <bsls_assert.h>
@@ -23,6 +25,7 @@ BSLS_IDENT_RCSID(bdlmt_eventscheduler_cpp,"$Id$ $CSID$")
 #include <bsls_review.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_climits.h>
 #include <bsl_vector.h>
 
 // Implementation note: When casting, we often cast through 'void *' or
@@ -126,23 +129,34 @@ bsls::TimeInterval EventSchedulerTestTimeSource_Data::currentTime() const
 // PRIVATE MANIPULATORS
 bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
 {
-    BSLS_ASSERT(0 != d_currentRecurringEvent || 0 != d_currentEvent);
+    BSLS_ASSERT(0 != d_currentRecurringEvent
+             || 0 != d_currentEvent
+             || 0 != d_currentWheelEvent);
+
+    // At most one of 'd_currentEvent' and 'd_currentWheelEvent' is valid,
+    // depending on the backend.
+
+    const bsls::Types::Int64 *eventKey = d_currentWheelEvent
+                                       ? &d_currentWheelEvent->key()
+                                       : d_currentEvent
+                                       ? &d_currentEvent->key()
+                                       : 0;
 
     bsls::Types::Int64 t = 0;
 
     if (0 == d_currentRecurringEvent) {
-        if (*now <= (t = d_currentEvent->key())) {
+        if (*now <= (t = *eventKey)) {
             *now = d_currentTimeFunctor().totalMicroseconds();
         }
     }
-    else if (0 == d_currentEvent) {
+    else if (0 == eventKey) {
         if (*now <= (t = d_currentRecurringEvent->key())) {
             *now = d_currentTimeFunctor().totalMicroseconds();
         }
     }
     else {
         bsls::Types::Int64 recurringEventTime = d_currentRecurringEvent->key();
-        bsls::Types::Int64 eventTime          = d_currentEvent->key();
+        bsls::Types::Int64 eventTime          = *eventKey;
 
         // Prefer overdue events over overdue clocks if running behind.
 
@@ -153,8 +167,14 @@ bsls::Types::Int64 EventScheduler::chooseNextEvent(bsls::Types::Int64 *now)
             t = eventTime;
         }
         else {
-            d_eventQueue.releaseReferenceRaw(d_currentEvent);
-            d_currentEvent = 0;
+            if (d_currentWheelEvent) {
+                d_wheelEventQueue_mp->releaseReferenceRaw(d_currentWheelEvent);
+                d_currentWheelEvent = 0;
+            }
+            else {
+                d_eventQueue.releaseReferenceRaw(d_currentEvent);
+                d_currentEvent = 0;
+            }
             t = recurringEventTime;
         }
     }
@@ -186,17 +206,51 @@ void EventScheduler::dispatchEvents()
 
         BSLS_ASSERT(0 == d_currentRecurringEvent);
         BSLS_ASSERT(0 == d_currentEvent);
+        BSLS_ASSERT(0 == d_currentWheelEvent);
 
         d_recurringQueue.frontRaw(&d_currentRecurringEvent);
-        d_eventQueue.frontRaw(&d_currentEvent);
 
-        if (0 == d_currentRecurringEvent && 0 == d_currentEvent) {
-            ++d_waitCount;
-            d_queueCondition.wait(&d_mutex);
-            continue;
+        // 'wheelTime' is the time to which the timing wheel must next be
+        // advanced if it has no due event, and otherwise the time of its due
+        // event.
+
+        bsls::Types::Int64 wheelTime = LLONG_MAX;
+        if (d_wheelEventQueue_mp) {
+            now       = d_currentTimeFunctor().totalMicroseconds();
+            wheelTime = d_wheelEventQueue_mp->advanceRaw(&d_currentWheelEvent,
+                                                         now);
+        }
+        else {
+            d_eventQueue.frontRaw(&d_currentEvent);
+        }
+
+        bsls::Types::Int64 t = wheelTime;
+
+        if (d_currentRecurringEvent || d_currentEvent || d_currentWheelEvent) {
+            const bsls::Types::Int64 eventTime = chooseNextEvent(&now);
+            if (eventTime <= wheelTime) {
+                t = eventTime;
+            }
+            else {
+                releaseCurrentEvents();
+            }
         }
 
-        bsls::Types::Int64 t = chooseNextEvent(&now);
+        if (0 == d_currentRecurringEvent
+         && 0 == d_currentEvent
+         && 0 == d_currentWheelEvent) {
+            if (LLONG_MAX == t) {
+                ++d_waitCount;
+                d_queueCondition.wait(&d_mutex);
+            }
+            else if (t > now) {
+                bsls::TimeInterval w;
+                w.addMicroseconds(t);
+                ++d_waitCount;
+                d_queueCondition.timedWait(&d_mutex, w);
+            }
+            continue;
+        }
 
         if (t > now) {
             releaseCurrentEvents();
@@ -220,6 +274,14 @@ void EventScheduler::dispatchEvents()
             }
             continue;
         }
+        if (d_currentWheelEvent) {
+            int ret = d_wheelEventQueue_mp->remove(d_currentWheelEvent);
+            if (0 == ret) {
+                lock.release()->unlock();
+                d_dispatcherFunctor(d_currentWheelEvent->data());
+            }
+            continue;
+        }
         BSLS_ASSERT(0 != d_currentEvent);
         int ret = d_eventQueue.remove(d_currentEvent);
         if (0 == ret) {
@@ -241,6 +303,39 @@ void EventScheduler::releaseCurrentEvents()
         d_eventQueue.releaseReferenceRaw(d_currentEvent);
         d_currentEvent = 0;
     }
+
+    if (d_currentWheelEvent) {
+        d_wheelEventQueue_mp->releaseReferenceRaw(d_currentWheelEvent);
+        d_currentWheelEvent = 0;
+    }
+}
+
+int EventScheduler::updateEvent(const Event               *handle,
+                                const bsls::TimeInterval&  newEpochTime,
+                                bool                      *isNewTop)
+{
+    if (d_wheelEventQueue_mp) {
+        return d_wheelEventQueue_mp->update(
+                               reinterpret_cast<const WheelEventQueue::Pair *>(
+                                       reinterpret_cast<const void *>(handle)),
+                               newEpochTime.totalMicroseconds(),
+                               isNewTop);                             // RETURN
+    }
+
+    return d_eventQueue.updateR(reinterpret_cast<const EventQueue::Pair *>(
+                                       reinterpret_cast<const void *>(handle)),
+                                newEpochTime.totalMicroseconds(),
+                                isNewTop);
+}
+
+// PRIVATE ACCESSORS
+bool EventScheduler::isCurrentEvent(const Event *handle) const
+{
+    const void *current = d_currentWheelEvent
+                        ? static_cast<const void *>(d_currentWheelEvent)
+                        : static_cast<const void *>(d_currentEvent);
+
+    return 0 != current && reinterpret_cast<const void *>(handle) == current;
 }
 
 // CREATORS
@@ -257,6 +352,7 @@ EventScheduler::EventScheduler(bslma::Allocator *basicAllocator)
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 {
@@ -276,6 +372,7 @@ EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 {
@@ -296,6 +393,7 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
 {
@@ -317,11 +415,74 @@ EventScheduler::EventScheduler(
 , d_dispatcherAwaited(false)
 , d_currentRecurringEvent(0)
 , d_currentEvent(0)
+, d_currentWheelEvent(0)
 , d_waitCount(0)
 , d_clockType(clockType)
 {
 }
 
+EventScheduler::EventScheduler(bsls::SystemClockType::Enum  clockType,
+                               const bsls::TimeInterval&    timerResolution,
+                               bslma::Allocator            *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(1 <= timerResolution.totalMicroseconds());
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    d_wheelEventQueue_mp.load(new (*allocator) WheelEventQueue(
+                                           timerResolution.totalMicroseconds(),
+                                           0,
+                                           allocator),
+                              allocator);
+}
+
+EventScheduler::EventScheduler(
+                          const EventScheduler::Dispatcher&  dispatcherFunctor,
+                          bsls::SystemClockType::Enum        clockType,
+                          const bsls::TimeInterval&          timerResolution,
+                          bslma::Allocator                  *basicAllocator)
+: d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_eventQueue(basicAllocator)
+, d_recurringQueue(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      dispatcherFunctor)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_queueCondition(clockType)
+, d_running(false)
+, d_dispatcherAwaited(false)
+, d_currentRecurringEvent(0)
+, d_currentEvent(0)
+, d_currentWheelEvent(0)
+, d_waitCount(0)
+, d_clockType(clockType)
+{
+    BSLS_ASSERT(1 <= timerResolution.totalMicroseconds());
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    d_wheelEventQueue_mp.load(new (*allocator) WheelEventQueue(
+                                           timerResolution.totalMicroseconds(),
+                                           0,
+                                           allocator),
+                              allocator);
+}
+
 EventScheduler::~EventScheduler()
 {
     BSLS_ASSERT(bslmt::ThreadUtil::invalidHandle() == d_dispatcherThread);
@@ -395,10 +556,20 @@ EventScheduler::scheduleEvent(EventHandle                  *event,
 {
     bool newTop;
 
-    d_eventQueue.addR(&event->d_handle,
-                      epochTime.totalMicroseconds(),
-                      callback,
-                      &newTop);
+    if (d_wheelEventQueue_mp) {
+        event->d_handle.release();
+        d_wheelEventQueue_mp->add(&event->d_wheelHandle,
+                                  epochTime.totalMicroseconds(),
+                                  callback,
+                                  &newTop);
+    }
+    else {
+        event->d_wheelHandle.release();
+        d_eventQueue.addR(&event->d_handle,
+                          epochTime.totalMicroseconds(),
+                          callback,
+                          &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -412,10 +583,18 @@ void EventScheduler::scheduleEventRaw(Event                        **event,
 {
     bool newTop;
 
-    d_eventQueue.addRawR((EventQueue::Pair **)event,
-                         epochTime.totalMicroseconds(),
-                         callback,
-                         &newTop);
+    if (d_wheelEventQueue_mp) {
+        d_wheelEventQueue_mp->addRaw((WheelEventQueue::Pair **)event,
+                                     epochTime.totalMicroseconds(),
+                                     callback,
+                                     &newTop);
+    }
+    else {
+        d_eventQueue.addRawR((EventQueue::Pair **)event,
+                             epochTime.totalMicroseconds(),
+                             callback,
+                             &newTop);
+    }
 
     if (newTop) {
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -550,11 +729,7 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    const EventQueue::Pair *itemPtr =
-                             reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
-
-    int ret = d_eventQueue.remove(itemPtr);
+    int ret = cancelEvent(handle);
     if (EventQueue::e_NOT_FOUND != ret) {
         return ret;                                                   // RETURN
     }
@@ -565,7 +740,7 @@ int EventScheduler::cancelEventAndWait(const Event *handle)
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (d_currentEvent != itemPtr) {
+        if (!isCurrentEvent(handle)) {
             break;
         }
         else {
@@ -602,15 +777,10 @@ int EventScheduler::cancelEventAndWait(RecurringEventHandle *handle)
 int EventScheduler::rescheduleEvent(const Event               *handle,
                                     const bsls::TimeInterval&  newEpochTime)
 {
-    const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
-
     bool isNewTop;
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
 
-    int ret = d_eventQueue.updateR(h,
-                                   newEpochTime.totalMicroseconds(),
-                                   &isNewTop);
+    int ret = updateEvent(handle, newEpochTime, &isNewTop);
 
     if (0 == ret && isNewTop) {
         d_queueCondition.signal();
@@ -625,22 +795,18 @@ int EventScheduler::rescheduleEventAndWait(
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
-    const EventQueue::Pair *h = reinterpret_cast<const EventQueue::Pair *>(
-                                       reinterpret_cast<const void *>(handle));
     int ret;
 
     {
         bool isNewTop;
         bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
-        ret = d_eventQueue.updateR(h,
-                                   newEpochTime.totalMicroseconds(),
-                                   &isNewTop);
+        ret = updateEvent(handle, newEpochTime, &isNewTop);
 
         if (0 == ret) {
             if (isNewTop) {
                 d_queueCondition.signal();
             }
-            if (d_currentEvent != h) {
+            if (!isCurrentEvent(handle)) {
                 return 0;                                             // RETURN
             }
         }
@@ -650,7 +816,7 @@ int EventScheduler::rescheduleEventAndWait(
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (d_currentEvent!=h) {
+        if (!isCurrentEvent(handle)) {
             break;
         }
         else {
@@ -664,6 +830,9 @@ int EventScheduler::rescheduleEventAndWait(
 
 void EventScheduler::cancelAllEvents()
 {
+    if (d_wheelEventQueue_mp) {
+        d_wheelEventQueue_mp->removeAll();
+    }
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 }
@@ -673,12 +842,17 @@ void EventScheduler::cancelAllEventsAndWait()
     BSLS_ASSERT(!bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
                                             d_dispatcherThread));
 
+    if (d_wheelEventQueue_mp) {
+        d_wheelEventQueue_mp->removeAll();
+    }
     d_eventQueue.removeAll();
     d_recurringQueue.removeAll();
 
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
     while (1) {
-        if (0 == d_currentEvent && 0 == d_currentRecurringEvent) {
+        if (0 == d_currentEvent
+         && 0 == d_currentWheelEvent
+         && 0 == d_currentRecurringEvent) {
             break;
         }
         else {
@@ -111,6 +111,25 @@ BSLS_IDENT("$Id: $")
 // dispatcher thread becomes available; once the backlog is worked off, events
 // will be executed at or near their scheduled times.
 //
+///Timing-Wheel Backend
+///--------------------
+// By default, one-time events are kept in a skip list ordered by time, so
+// that scheduling, canceling, and rescheduling an event takes time logarithmic
+// in the number of pending events.  When an application arms a very large
+// number of timers, most of which are canceled or rescheduled before they
+// expire (e.g., request and idle timeouts), a scheduler may instead be created
+// with a *timer* *resolution*, in which case one-time events are kept in a
+// hierarchical timing wheel (see 'bdlcc_timingwheel'), and these operations
+// take constant time.  Recurring events are kept in a skip list with either
+// backend.
+//
+// With the timing-wheel backend, an event is dispatched no earlier than its
+// scheduled time, rounded up to a whole multiple of the timer resolution, and
+// events scheduled within the same period of the timer resolution may be
+// dispatched in any order.  Handles and "Raw" event pointers behave the same
+// with either backend, but must be used only with the scheduler that created
+// them.
+//
 ///Supported Clock-Types
 ///---------------------
 // The component 'bsls::SystemClockType' supplies the enumeration indicating
@@ -381,7 +400,9 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlcc_skiplist.h>
+#include <bdlcc_timingwheel.h>
 
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 
 #include <bslmf_nestedtraitdeclaration.h>
@@ -431,6 +452,8 @@ class EventScheduler {
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             bsl::function<void()> >        EventQueue;
 
+    typedef bdlcc::TimingWheel<bsl::function<void()> >     WheelEventQueue;
+
     typedef bsl::function<bsls::TimeInterval()>            CurrentTimeFunctor;
 
     // FRIENDS
@@ -467,6 +490,12 @@ class EventScheduler {
 
     EventQueue            d_eventQueue;         // events
 
+    bslma::ManagedPtr<WheelEventQueue>
+                          d_wheelEventQueue_mp; // events, if the timing-wheel
+                                                // backend is used (in which
+                                                // case 'd_eventQueue' is
+                                                // unused)
+
     RecurringEventQueue   d_recurringQueue;     // recurring events
 
     Dispatcher            d_dispatcherFunctor;  // dispatch events
@@ -509,6 +538,12 @@ class EventScheduler {
                                                 // scheduled recurring event
                                                 // being executed
 
+    WheelEventQueue::Pair
+                         *d_currentWheelEvent;  // Raw reference to the
+                                                // scheduled event being
+                                                // executed, if the
+                                                // timing-wheel backend is used
+
     unsigned int          d_waitCount;          // count of the number of waits
                                                 // performed in the main
                                                 // dispatch loop, used in
@@ -520,20 +555,20 @@ class EventScheduler {
 
     // PRIVATE MANIPULATORS
     bsls::Types::Int64 chooseNextEvent(bsls::Types::Int64 *now);
-        // Pick either 'd_currentEvent' or 'd_currentRecurringEvent' as the
-        // next event to be executed, given that the current time is the
-        // specified (absolute) 'now' interval, and return the (absolute)
-        // interval of the chosen event.  If both 'd_currentEvent' and
-        // 'd_currentRecurringEvent' are valid, release whichever one was not
-        // chosen.  If both 'd_currentEvent' and 'd_currentRecurringEvent' are
-        // scheduled before 'now', choose 'd_currentEvent'.  The behavior is
-        // undefined if neither 'd_currentEvent' nor 'd_currentRecurringEvent'
-        // is valid.  Note that the argument and return value of this method
-        // are expressed in terms of the number of microseconds elapsed since
-        // some epoch, which is determined by the clock indicated at
-        // construction (see {Supported Clock-Types} in the component
-        // documentation).  Also note that this method may update the value of
-        // 'now' with the current system time if necessary.
+        // Pick either 'd_currentEvent' (or 'd_currentWheelEvent') or
+        // 'd_currentRecurringEvent' as the next event to be executed, given
+        // that the current time is the specified (absolute) 'now' interval,
+        // and return the (absolute) interval of the chosen event.  If both a
+        // one-time event and 'd_currentRecurringEvent' are valid, release
+        // whichever one was not chosen.  If both are scheduled before 'now',
+        // choose the one-time event.  The behavior is undefined if neither a
+        // one-time event nor 'd_currentRecurringEvent' is valid.  Note that
+        // the argument and return value of this method are expressed in terms
+        // of the number of microseconds elapsed since some epoch, which is
+        // determined by the clock indicated at construction (see {Supported
+        // Clock-Types} in the component documentation).  Also note that this
+        // method may update the value of 'now' with the current system time if
+        // necessary.
 
     void dispatchEvents();
         // While d_running is true, execute events in the event and recurring
@@ -541,8 +576,22 @@ class EventScheduler {
         // implements the dispatching thread.
 
     void releaseCurrentEvents();
-        // Release 'd_currentRecurringEvent' and 'd_currentEvent', if they
-        // refer to valid events.
+        // Release 'd_currentRecurringEvent', 'd_currentEvent', and
+        // 'd_currentWheelEvent', if they refer to valid events.
+
+    int updateEvent(const Event               *handle,
+                    const bsls::TimeInterval&  newEpochTime,
+                    bool                      *isNewTop);
+        // Change the time of the one-time event referred to by the specified
+        // 'handle' to the specified 'newEpochTime', loading into the specified
+        // 'isNewTop' whether the dispatcher thread must be woken.  Return 0 on
+        // success, and a non-zero value if the event is no longer pending.
+
+    // PRIVATE ACCESSORS
+    bool isCurrentEvent(const Event *handle) const;
+        // Return 'true' if the specified 'handle' refers to the one-time event
+        // currently held by the dispatcher thread, and 'false' otherwise.
+        // The behavior is undefined unless 'd_mutex' is locked.
 
   public:
     // TRAITS
@@ -589,6 +638,35 @@ class EventScheduler {
         // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
         // the currently installed default allocator is used.
 
+    EventScheduler(bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timerResolution,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the default dispatcher functor
+        // (see the "The dispatcher thread and the dispatcher functor" section
+        // in component-level doc) and the timing-wheel backend having the
+        // specified 'timerResolution' (see {Timing-Wheel Backend} in the
+        // component documentation), and use the specified 'clockType' to
+        // indicate the epoch used for all time intervals (see {Supported
+        // Clock-Types} in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'timerResolution' is at least one microsecond.
+
+    EventScheduler(const Dispatcher&            dispatcherFunctor,
+                   bsls::SystemClockType::Enum  clockType,
+                   const bsls::TimeInterval&    timerResolution,
+                   bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler using the specified 'dispatcherFunctor'
+        // (see "The dispatcher thread and the dispatcher functor" section in
+        // component-level doc) and the timing-wheel backend having the
+        // specified 'timerResolution' (see {Timing-Wheel Backend} in the
+        // component documentation), and use the specified 'clockType' to
+        // indicate the epoch used for all time intervals (see {Supported
+        // Clock-Types} in the component documentation).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'timerResolution' is at least one microsecond.
+
     ~EventScheduler();
         // Discard all unprocessed events and destroy this object.  The
         // behavior is undefined unless the scheduler is stopped.
@@ -822,6 +900,11 @@ class EventScheduler {
         // Return the number of recurring events registered with this
         // scheduler.
 
+    bsls::TimeInterval timerResolution() const;
+        // Return the timer resolution of this scheduler if it uses the
+        // timing-wheel backend, and 0 otherwise (see {Timing-Wheel Backend}
+        // in the component documentation).
+
                                   // Aspects
 
     bslma::Allocator *allocator() const;
@@ -842,8 +925,15 @@ class EventSchedulerEventHandle
     typedef bdlcc::SkipList<bsls::Types::Int64,
                             bsl::function<void()> > EventQueue;
 
+    typedef bdlcc::TimingWheel<bsl::function<void()> >
+                                                    WheelEventQueue;
+
     // DATA
-    EventQueue::PairHandle  d_handle;
+    EventQueue::PairHandle       d_handle;       // reference to an event of
+                                                 // the skip-list backend
+
+    WheelEventQueue::PairHandle  d_wheelHandle;  // reference to an event of
+                                                 // the timing-wheel backend
 
     // FRIENDS
     friend class EventScheduler;
@@ -1002,6 +1092,7 @@ inline
 EventSchedulerEventHandle::EventSchedulerEventHandle(
                                      const EventSchedulerEventHandle& original)
 : d_handle(original.d_handle)
+, d_wheelHandle(original.d_wheelHandle)
 {
 }
 
@@ -1015,7 +1106,8 @@ inline
 EventSchedulerEventHandle&
 EventSchedulerEventHandle::operator=(const EventSchedulerEventHandle& rhs)
 {
-    d_handle = rhs.d_handle;
+    d_handle      = rhs.d_handle;
+    d_wheelHandle = rhs.d_wheelHandle;
     return *this;
 }
 
@@ -1023,6 +1115,7 @@ inline
 void EventSchedulerEventHandle::release()
 {
     d_handle.release();
+    d_wheelHandle.release();
 }
 }  // close package namespace
 
@@ -1034,6 +1127,10 @@ inline
 bdlmt::EventSchedulerEventHandle::
 operator const bdlmt::EventSchedulerEventHandle::Event*() const
 {
+    if (d_wheelHandle.isValid()) {
+        return (const Event*)((const WheelEventQueue::Pair*)d_wheelHandle);
+                                                                      // RETURN
+    }
     return (const Event*)((const EventQueue::Pair*)d_handle);
 }
 
@@ -1099,6 +1196,13 @@ namespace bdlmt {
 inline
 int EventScheduler::cancelEvent(const Event *handle)
 {
+    if (d_wheelEventQueue_mp) {
+        return d_wheelEventQueue_mp->remove(
+                        reinterpret_cast<const WheelEventQueue::Pair*>(
+                                      reinterpret_cast<const void*>(handle)));
+                                                                      // RETURN
+    }
+
     const EventQueue::Pair *itemPtr =
                         reinterpret_cast<const EventQueue::Pair*>(
                                         reinterpret_cast<const void*>(handle));
@@ -1126,6 +1230,12 @@ void EventScheduler::scheduleEvent(const bsls::TimeInterval&    epochTime,
 inline
 void EventScheduler::releaseEventRaw(Event *handle)
 {
+    if (d_wheelEventQueue_mp) {
+        d_wheelEventQueue_mp->releaseReferenceRaw(
+                              reinterpret_cast<WheelEventQueue::Pair*>(
+                                            reinterpret_cast<void*>(handle)));
+        return;                                                       // RETURN
+    }
     d_eventQueue.releaseReferenceRaw(reinterpret_cast<EventQueue::Pair*>(
                                              reinterpret_cast<void*>(handle)));
 }
@@ -1152,6 +1262,14 @@ inline
 EventScheduler::Event*
 EventScheduler::addEventRefRaw(Event *handle) const
 {
+    if (d_wheelEventQueue_mp) {
+        WheelEventQueue::Pair *h = reinterpret_cast<WheelEventQueue::Pair*>(
+                                              reinterpret_cast<void*>(handle));
+        return reinterpret_cast<Event*>(
+                                 d_wheelEventQueue_mp->addPairReferenceRaw(h));
+                                                                      // RETURN
+    }
+
     EventQueue::Pair *h = reinterpret_cast<EventQueue::Pair*>(
                                               reinterpret_cast<void*>(handle));
     return reinterpret_cast<Event*>(d_eventQueue.addPairReferenceRaw(h));
@@ -1183,7 +1301,8 @@ bsls::TimeInterval EventScheduler::now() const
 inline
 int EventScheduler::numEvents() const
 {
-    return d_eventQueue.length();
+    return d_wheelEventQueue_mp ? d_wheelEventQueue_mp->length()
+                                : d_eventQueue.length();
 }
 
 inline
@@ -1192,6 +1311,16 @@ int EventScheduler::numRecurringEvents() const
     return d_recurringQueue.length();
 }
 
+inline
+bsls::TimeInterval EventScheduler::timerResolution() const
+{
+    bsls::TimeInterval result;
+    if (d_wheelEventQueue_mp) {
+        result.addMicroseconds(d_wheelEventQueue_mp->resolution());
+    }
+    return result;
+}
+
                                   // Aspects
 
 inline
@@ -24,6 +24,8 @@
 #include <bslma_testallocator.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 #include <bslmt_threadutil.h>
 #include <bslmt_timedsemaphore.h>
@@ -52,6 +54,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;  // automatically added by script
@@ -93,9 +96,11 @@ using namespace bsl;  // automatically added by script
 // CREATORS
 // [01] bdlmt::EventScheduler(allocator = 0);
 // [19] bdlmt::EventScheduler(clockType, allocator = 0);
+// [27] bdlmt::EventScheduler(clockType, timerResolution, allocator = 0);
 //
 // [08] bdlmt::EventScheduler(dispatcher, allocator = 0);
 // [20] bdlmt::EventScheduler(disp, clockType, alloc = 0);
+// [27] bdlmt::EventScheduler(disp, clockType, timerResolution, alloc);
 //
 // [01] ~bdlmt::EventScheduler();
 //
@@ -118,6 +123,7 @@ using namespace bsl;  // automatically added by script
 // [21] bsls::SystemClockType::Enum clockType() const;
 // [23] bsls::TimeInterval now() const;
 // [24] bslma::Allocator *allocator() const;
+// [27] bsls::TimeInterval timerResolution() const;
 //-----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [25] DRQS 150355963: 'advanceTime' WITH UNDER A MICROSECOND
@@ -126,7 +132,8 @@ using namespace bsl;  // automatically added by script
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [22] CLOCK REPLACEMENT BREATHING TEST
-// [27] USAGE EXAMPLE
+// [27] TESTING THE TIMING-WHEEL BACKEND
+// [28] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -942,6 +949,91 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 27 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_27 {
+
+class Recorder {
+    // This class records the identifiers of the events it is called back for,
+    // and verifies that no event is executed before its scheduled time.
+
+    // DATA
+    bdlmt::EventScheduler *d_scheduler_p;  // scheduler executing the events
+    bslmt::Mutex           d_mutex;        // guards 'd_ids'
+    bsl::vector<int>       d_ids;          // identifiers, in execution order
+
+  public:
+    // CREATORS
+    explicit Recorder(bdlmt::EventScheduler *scheduler)
+        // Create a recorder for events executed by the specified 'scheduler'.
+    : d_scheduler_p(scheduler)
+    {
+    }
+
+    // MANIPULATORS
+    void record(int id, const bsls::TimeInterval& scheduledTime)
+        // Record the specified 'id', and verify that the current time of the
+        // scheduler is not earlier than the specified 'scheduledTime'.
+    {
+        const bsls::TimeInterval now = d_scheduler_p->now();
+
+        LOOP3_ASSERTT(id, now, scheduledTime, scheduledTime <= now);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_ids.push_back(id);
+    }
+
+    // ACCESSORS
+    bsl::vector<int> ids()
+        // Return the identifiers recorded so far, in execution order.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_ids;
+    }
+
+    int numRecorded()
+        // Return the number of identifiers recorded so far.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return static_cast<int>(d_ids.size());
+    }
+};
+
+void alignTime(bdlmt::EventSchedulerTestTimeSource *timeSource,
+               const bsls::TimeInterval&            resolution)
+    // Advance the specified 'timeSource' to the next whole multiple of the
+    // specified timer 'resolution', so that the periods of the resolution
+    // start at whole multiples of 'resolution' from its current time.  The
+    // behavior is undefined unless 'resolution' is a positive whole number of
+    // microseconds.
+{
+    const bsls::Types::Int64 resolutionNs = resolution.totalNanoseconds();
+    const bsls::Types::Int64 remainder    =
+                           timeSource->now().totalNanoseconds() % resolutionNs;
+
+    bsls::TimeInterval interval;
+    interval.addNanoseconds(resolutionNs - remainder);
+    timeSource->advanceTime(interval);
+}
+
+bsls::TimeInterval ms(int numMilliseconds)
+    // Return an interval of the specified 'numMilliseconds'.
+{
+    return bsls::TimeInterval(0, numMilliseconds * 1000 * 1000);
+}
+
+void countingDispatcher(bsls::AtomicInt              *count,
+                        const bsl::function<void()>&  callback)
+    // Increment the specified 'count' and invoke the specified 'callback'.
+{
+    ++*count;
+    callback();
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_27
+
 // ============================================================================
 //                         CASE 25 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2252,6 +2344,57 @@ struct TestPrintClass {
 
 }  // close namespace EVENTSCHEDULER_TEST_CASE_MINUS_1
 
+// ============================================================================
+//                         CASE -2 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace EVENTSCHEDULER_TEST_CASE_MINUS_2 {
+
+enum {
+    k_NUM_TIMERS  = 1000 * 1000,  // number of timers armed
+    k_CANCEL_RATE = 99            // percentage of the timers canceled
+};
+
+double armAndCancel(bdlmt::EventScheduler *scheduler)
+    // Arm 'k_NUM_TIMERS' timers, expiring in 10 to 70 seconds, on the
+    // specified 'scheduler', and cancel 'k_CANCEL_RATE' percent of them, and
+    // return the elapsed time in seconds.  Cancel the remaining timers before
+    // returning.
+{
+    bsl::vector<Event *> timers(k_NUM_TIMERS);
+    unsigned int         state = 1;
+
+    const bsls::TimeInterval now = scheduler->now();
+
+    bsls::Stopwatch sw;
+    sw.start();
+
+    for (int i = 0; i < k_NUM_TIMERS; ++i) {
+        state = state * 1103515245 + 12345;
+
+        bsls::TimeInterval expiry(now);
+        expiry.addSeconds(10);
+        expiry.addMicroseconds((state >> 4) % (60 * 1000 * 1000));
+
+        scheduler->scheduleEventRaw(&timers[i], expiry, &noop);
+    }
+
+    for (int i = 0; i < k_NUM_TIMERS; ++i) {
+        if (i % 100 < k_CANCEL_RATE) {
+            scheduler->cancelEvent(timers[i]);
+        }
+        scheduler->releaseEventRaw(timers[i]);
+    }
+
+    sw.stop();
+
+    scheduler->cancelAllEvents();
+
+    return sw.elapsedTime();
+}
+
+}  // close namespace EVENTSCHEDULER_TEST_CASE_MINUS_2
+
 // ============================================================================
 //                        CASE -100 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2365,7 +2508,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 27: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLES:
         //
@@ -2425,6 +2568,363 @@ int main(int argc, char *argv[])
         ASSERT(0 < ta.numAllocations());
         ASSERT(0 == ta.numBytesInUse());
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING THE TIMING-WHEEL BACKEND
+        //
+        // Concerns:
+        //: 1 A scheduler constructed with a timer resolution reports that
+        //:   resolution, and one constructed without reports 0.
+        //:
+        //: 2 One-time events are dispatched no earlier than their scheduled
+        //:   times, and no later than the end of the period of the timer
+        //:   resolution containing their scheduled times.
+        //:
+        //: 3 Events may be canceled and rescheduled, using handles or "Raw"
+        //:   pointers, with the same results as with the skip-list backend.
+        //:
+        //: 4 Recurring events are dispatched as with the skip-list backend,
+        //:   interleaved with one-time events.
+        //:
+        //: 5 'cancelEventAndWait', 'rescheduleEventAndWait', and
+        //:   'cancelAllEventsAndWait' behave as with the skip-list backend.
+        //:
+        //: 6 The user-supplied dispatcher functor is used.
+        //:
+        //: 7 No memory is leaked, and the default allocator is not used.
+        //
+        // Plan:
+        //: 1 Using a test time source, schedule, cancel, and reschedule events
+        //:   with handles and "Raw" pointers, advance the time, and verify the
+        //:   events dispatched, and that none is dispatched early.  (C-1..6)
+        //:
+        //: 2 Schedule many events at random times, cancel most of them, and
+        //:   advance the time in random steps, verifying that exactly the
+        //:   events not canceled are dispatched.  (C-2..3)
+        //:
+        //: 3 Use a test allocator, and verify that the default allocator is
+        //:   not used.  (C-7)
+        //
+        // Testing:
+        //   bdlmt::EventScheduler(clockType, timerResolution, allocator = 0);
+        //   bdlmt::EventScheduler(disp, clockType, timerResolution, alloc);
+        //   bsls::TimeInterval timerResolution() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING THE TIMING-WHEEL BACKEND" << endl
+                          << "================================" << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_27;
+
+        typedef bsls::SystemClockType SCT;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard defaultAllocatorGuard(&da);
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+
+        if (verbose) cout << "\tResolution accessor." << endl;
+        {
+            Obj mX(SCT::e_MONOTONIC, &oa);
+            ASSERT(bsls::TimeInterval() == mX.timerResolution());
+
+            Obj mY(SCT::e_MONOTONIC, ms(1), &oa);
+            ASSERT(ms(1) == mY.timerResolution());
+            ASSERT(0  == mY.numEvents());
+            ASSERT(&oa == mY.allocator());
+        }
+
+        if (verbose) cout << "\tUser-supplied dispatcher." << endl;
+        {
+            bsls::AtomicInt count(0);
+
+            Obj mX(bdlf::BindUtil::bind(&countingDispatcher,
+                                        &count,
+                                        bdlf::PlaceHolders::_1),
+                   SCT::e_MONOTONIC,
+                   ms(2),
+                   &oa);
+            ASSERT(ms(2) == mX.timerResolution());
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+            alignTime(&timeSource, mX.timerResolution());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            Recorder recorder(&mX);
+
+            mX.scheduleEvent(T0 + ms(3),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  1,
+                                                  T0 + ms(3)));
+            mX.start();
+
+            // With a resolution of 2ms, and 'T0' a multiple of 2ms, the event
+            // is dispatched at 4ms.
+
+            timeSource.advanceTime(ms(3));
+            ASSERT(0 == count);
+
+            timeSource.advanceTime(ms(1));
+            ASSERT(1 == count);
+            ASSERT(1 == recorder.numRecorded());
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tSchedule, cancel, and reschedule." << endl;
+        {
+            Obj mX(SCT::e_MONOTONIC, ms(1), &oa);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+            alignTime(&timeSource, mX.timerResolution());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            Recorder recorder(&mX);
+
+            EventHandle h1, h3;
+            Event      *e2;
+
+            mX.scheduleEvent(&h1,
+                             T0 + ms(5),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  1,
+                                                  T0 + ms(5)));
+            mX.scheduleEventRaw(&e2,
+                                T0 + ms(10),
+                                bdlf::BindUtil::bind(&Recorder::record,
+                                                     &recorder,
+                                                     2,
+                                                     T0 + ms(10)));
+            mX.scheduleEvent(&h3,
+                             T0 + ms(20),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  3,
+                                                  T0 + ms(8)));
+            const bsls::TimeInterval T4 = T0 + ms(15)
+                                        + bsls::TimeInterval(0, 500 * 1000);
+            mX.scheduleEvent(T4,
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  4,
+                                                  T4));
+            ASSERT(4 == mX.numEvents());
+
+            mX.start();
+
+            timeSource.advanceTime(ms(4));
+            ASSERT(0 == recorder.numRecorded());
+
+            timeSource.advanceTime(ms(1));
+            ASSERT(1 == recorder.numRecorded());
+            ASSERT(3 == mX.numEvents());
+            ASSERT(0 != mX.cancelEvent(h1));
+
+            ASSERT(0 == mX.cancelEvent(e2));
+            ASSERT(0 != mX.cancelEvent(e2));
+            mX.releaseEventRaw(e2);
+
+            ASSERT(0 == mX.rescheduleEvent(h3, T0 + ms(8)));
+            ASSERT(2 == mX.numEvents());
+
+            timeSource.advanceTime(ms(2));
+            ASSERT(1 == recorder.numRecorded());
+
+            timeSource.advanceTime(ms(1));
+            ASSERT(2 == recorder.numRecorded());
+            ASSERT(0 != mX.rescheduleEvent(h3, T0 + ms(30)));
+
+            // Event 4 is due at 15.5ms, and so is dispatched at 16ms.
+
+            timeSource.advanceTime(ms(7));
+            ASSERT(2 == recorder.numRecorded());
+
+            timeSource.advanceTime(ms(1));
+            ASSERT(3 == recorder.numRecorded());
+            ASSERT(0 == mX.numEvents());
+
+            const bsl::vector<int> ids = recorder.ids();
+            ASSERT(3 == ids.size());
+            ASSERT(1 == ids[0]);
+            ASSERT(3 == ids[1]);
+            ASSERT(4 == ids[2]);
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tRecurring and one-time events." << endl;
+        {
+            Obj mX(SCT::e_MONOTONIC, ms(1), &oa);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+            alignTime(&timeSource, mX.timerResolution());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            Recorder recorder(&mX);
+
+            RecurringEventHandle r;
+            mX.scheduleRecurringEvent(&r,
+                                      ms(3),
+                                      bdlf::BindUtil::bind(&Recorder::record,
+                                                           &recorder,
+                                                           0,
+                                                           T0));
+            for (int i = 1; i <= 10; ++i) {
+                mX.scheduleEvent(T0 + ms(i) + ms(1),
+                                 bdlf::BindUtil::bind(&Recorder::record,
+                                                      &recorder,
+                                                      i,
+                                                      T0 + ms(i)));
+            }
+
+            mX.start();
+
+            for (int i = 0; i < 12; ++i) {
+                timeSource.advanceTime(ms(1));
+            }
+
+            // 4 recurring events (at 3, 6, 9, and 12ms) and 10 one-time
+            // events.
+
+            const bsl::vector<int> ids = recorder.ids();
+            ASSERTV(ids.size(), 14 == ids.size());
+
+            int numRecurring = 0;
+            int lastId       = 0;
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                if (0 == ids[i]) {
+                    ++numRecurring;
+                }
+                else {
+                    ASSERTV(ids[i], lastId, lastId < ids[i]);
+                    lastId = ids[i];
+                }
+            }
+            ASSERTV(numRecurring, 4 == numRecurring);
+
+            ASSERT(0 == mX.cancelEventAndWait(&r));
+            mX.stop();
+        }
+
+        if (verbose) cout << "\t'AndWait' methods." << endl;
+        {
+            Obj mX(SCT::e_MONOTONIC, ms(1), &oa);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+            alignTime(&timeSource, mX.timerResolution());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            Recorder recorder(&mX);
+
+            EventHandle h1, h2, h3;
+            mX.scheduleEvent(&h1,
+                             T0 + ms(10),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  1,
+                                                  T0 + ms(10)));
+            mX.scheduleEvent(&h2,
+                             T0 + ms(20),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  2,
+                                                  T0 + ms(10)));
+            mX.scheduleEvent(&h3,
+                             T0 + ms(30),
+                             bdlf::BindUtil::bind(&Recorder::record,
+                                                  &recorder,
+                                                  3,
+                                                  T0 + ms(30)));
+            mX.start();
+
+            ASSERT(0 == mX.cancelEventAndWait(&h1));
+            ASSERT(!h1);
+            ASSERT(0 == mX.rescheduleEventAndWait(h2, T0 + ms(10)));
+
+            timeSource.advanceTime(ms(11));
+            ASSERT(1 == recorder.numRecorded());
+            ASSERT(0 != mX.cancelEventAndWait(h2));
+
+            mX.cancelAllEventsAndWait();
+            ASSERT(0 == mX.numEvents());
+            ASSERT(0 != mX.cancelEvent(h3));
+
+            timeSource.advanceTime(ms(30));
+            ASSERT(1 == recorder.numRecorded());
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\tMany events, mostly canceled." << endl;
+        {
+            enum { k_NUM_EVENTS = 5000 };
+
+            Obj mX(SCT::e_MONOTONIC, ms(1), &oa);
+
+            bdlmt::EventSchedulerTestTimeSource timeSource(&mX);
+            alignTime(&timeSource, mX.timerResolution());
+
+            const bsls::TimeInterval T0 = timeSource.now();
+
+            Recorder recorder(&mX);
+
+            bsl::vector<Event *> events(k_NUM_EVENTS, &oa);
+            unsigned int         state = 7;
+            int                  numExpected = 0;
+
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                state = state * 1103515245 + 12345;
+
+                bsls::TimeInterval T(T0);
+                T.addMicroseconds((state >> 4) % (100 * 1000));
+
+                mX.scheduleEventRaw(&events[i],
+                                    T,
+                                    bdlf::BindUtil::bind(&Recorder::record,
+                                                         &recorder,
+                                                         i,
+                                                         T));
+            }
+            for (int i = 0; i < k_NUM_EVENTS; ++i) {
+                if (0 == i % 10) {
+                    ++numExpected;
+                }
+                else {
+                    ASSERT(0 == mX.cancelEvent(events[i]));
+                }
+                mX.releaseEventRaw(events[i]);
+            }
+            ASSERT(numExpected == mX.numEvents());
+
+            mX.start();
+
+            for (int i = 0; i < 40; ++i) {
+                state = state * 1103515245 + 12345;
+                timeSource.advanceTime(bsls::TimeInterval(
+                                     0, 1 + (state >> 4) % (5 * 1000 * 1000)));
+            }
+            timeSource.advanceTime(ms(100));
+
+            ASSERTV(numExpected, recorder.numRecorded(),
+                    numExpected == recorder.numRecorded());
+
+            const bsl::vector<int> ids = recorder.ids();
+            for (bsl::size_t i = 0; i < ids.size(); ++i) {
+                ASSERTV(ids[i], 0 == ids[i] % 10);
+            }
+
+            mX.stop();
+        }
+
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -6105,6 +6605,50 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: ARMING AND CANCELING MANY TIMERS
+        //
+        // Concerns:
+        //: 1 The timing-wheel backend arms and cancels a large number of
+        //:   timers faster than the skip-list backend.
+        //
+        // Plan:
+        //: 1 For each backend, arm 1M timers using the "Raw" API, cancel 99%
+        //:   of them, and report the elapsed time.  (C-1)
+        //
+        // Testing:
+        //   BENCHMARK: ARMING AND CANCELING MANY TIMERS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BENCHMARK: ARMING AND CANCELING MANY TIMERS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        using namespace EVENTSCHEDULER_TEST_CASE_MINUS_2;
+
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC);
+            mX.start();
+
+            const double elapsed = armAndCancel(&mX);
+            cout << "skip list:    " << elapsed << "s" << endl;
+
+            mX.stop();
+        }
+        {
+            Obj mX(bsls::SystemClockType::e_MONOTONIC,
+                   bsls::TimeInterval(0, 1000 * 1000));
+            mX.start();
+
+            const double elapsed = armAndCancel(&mX);
+            cout << "timing wheel: " << elapsed << "s" << endl;
+
+            mX.stop();
+        }
+      } break;
       case -100: {
         // --------------------------------------------------------------------
         // The router simulation (kind of) test
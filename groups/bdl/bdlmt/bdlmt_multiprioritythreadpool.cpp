@@ -38,6 +38,17 @@ BSLS_IDENT_RCSID(bdlmt_multiprioritythreadpool_cpp,"$Id$ $CSID$")
 // suspended.  When starting a thread pool that is suspended, it is important
 // that the threads all wait before processing any jobs, and similarly, when
 // stopping, they must stop before processing any other jobs.
+//
+// In 'e_DEADLINE' mode, pending jobs are held in 'd_scheduledJobs', a heap
+// ordered by effective deadline, and for each job added to the heap a copy of
+// 'd_dispatchJob' is pushed (after the job is added) to 'd_queue' with
+// priority 0.  The worker threads, the stop and suspend logic, and
+// 'drainJobs' operate on 'd_queue' exactly as in 'e_PRIORITY' mode, and each
+// dispatch job, when executed, removes and executes the earliest job in the
+// heap.  Since a dispatch job is pushed only after its job is added to the
+// heap, the number of dispatch jobs in 'd_queue' is never less than the number
+// of jobs in the heap; extra dispatch jobs may be left by a concurrent
+// 'removeJobs', and do nothing when executed.
 
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
@@ -46,9 +57,14 @@ BSLS_IDENT_RCSID(bdlmt_multiprioritythreadpool_cpp,"$Id$ $CSID$")
 #include <bslmt_lockguard.h>
 
 #include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_rawdeleterguard.h>
+#include <bslma_rawdeleterproctor.h>
 
 #include <bsls_assert.h>
+#include <bsls_systemtime.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_csignal.h>
 
 namespace BloombergLP {
@@ -69,14 +85,223 @@ enum SuspendState {     // type of 'd_threadSuspendState'
     e_RESUMED
 };
 
+typedef bdlmt::MultipriorityThreadPool_Job Job;
+
+struct LaterJob {
+    // This 'struct' provides an ordering of pending jobs under which the heap
+    // algorithms keep the job having the earliest effective deadline at the
+    // front of the heap.
+
+    bool operator()(const Job *lhs, const Job *rhs) const
+        // Return 'true' if the specified 'lhs' job should be executed after
+        // the specified 'rhs' job, and 'false' otherwise.
+    {
+        return lhs->d_sortKey > rhs->d_sortKey
+            || (lhs->d_sortKey == rhs->d_sortKey
+             && lhs->d_sequenceNum > rhs->d_sequenceNum);
+    }
+};
+
+inline
+bsls::Types::Int64 now()
+    // Return the current time, in nanoseconds, on the monotonic system clock.
+{
+    return bsls::SystemTime::nowMonotonicClock().totalNanoseconds();
+}
+
 }  // close unnamed namespace
 
 namespace bdlmt {
+                     // ---------------------------------
+                     // class MultipriorityThreadPool_Job
+                     // ---------------------------------
+
+// CREATORS
+MultipriorityThreadPool_Job::MultipriorityThreadPool_Job(
+                                              bslma::Allocator *basicAllocator)
+: d_functor(bsl::allocator_arg, basicAllocator)
+, d_enqueueTime(0)
+, d_deadline(LLONG_MAX)
+, d_sortKey(0)
+, d_sequenceNum(0)
+, d_priority(-1)
+{
+}
+
+MultipriorityThreadPool_Job::MultipriorityThreadPool_Job(
+                            const MultipriorityThreadPool_Job&  original,
+                            bslma::Allocator                   *basicAllocator)
+: d_functor(bsl::allocator_arg, basicAllocator, original.d_functor)
+, d_enqueueTime(original.d_enqueueTime)
+, d_deadline(original.d_deadline)
+, d_sortKey(original.d_sortKey)
+, d_sequenceNum(original.d_sequenceNum)
+, d_priority(original.d_priority)
+{
+}
+
+// MANIPULATORS
+MultipriorityThreadPool_Job& MultipriorityThreadPool_Job::operator=(
+                                        const MultipriorityThreadPool_Job& rhs)
+{
+    d_functor     = rhs.d_functor;
+    d_enqueueTime = rhs.d_enqueueTime;
+    d_deadline    = rhs.d_deadline;
+    d_sortKey     = rhs.d_sortKey;
+    d_sequenceNum = rhs.d_sequenceNum;
+    d_priority    = rhs.d_priority;
+
+    return *this;
+}
+
                        // -----------------------------
                        // class MultipriorityThreadPool
                        // -----------------------------
 
 // PRIVATE MANIPULATORS
+void MultipriorityThreadPool::dispatchScheduledJob()
+{
+    Job *job;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduleMutex);
+
+        if (d_scheduledJobs.empty()) {
+            // The job was removed by 'removeJobs'.
+
+            return;                                                   // RETURN
+        }
+
+        bsl::pop_heap(d_scheduledJobs.begin(),
+                      d_scheduledJobs.end(),
+                      LaterJob());
+        job = d_scheduledJobs.back();
+        d_scheduledJobs.pop_back();
+
+        --d_numPendingJobs[job->d_priority];
+    }
+
+    bslma::RawDeleterGuard<Job, bslma::Allocator> guard(job, d_allocator_p);
+
+    recordJobStart(*job);
+    job->d_functor();                                                 // INVOKE
+}
+
+int MultipriorityThreadPool::pushJob(const ThreadFunctor& job,
+                                     int                  priority,
+                                     bsls::Types::Int64   deadline)
+{
+    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
+    // checks '0 <= priority < numPriorities()'
+
+    const bsls::Types::Int64 enqueueTime = now();
+
+    if (e_PRIORITY == d_schedulingPolicy) {
+        Job item(d_allocator_p);
+        item.d_functor     = job;
+        item.d_enqueueTime = enqueueTime;
+        item.d_deadline    = deadline;
+        item.d_priority    = priority;
+
+        // Count the job before pushing it, so that the count never becomes
+        // negative when a worker thread pops the job.
+
+        ++d_numPendingJobs[priority];
+
+        const int rc = d_queue.pushBack(item, priority);
+        if (0 != rc) {
+            --d_numPendingJobs[priority];
+        }
+        return rc;                                                    // RETURN
+    }
+
+    Job *item = new (*d_allocator_p) Job(d_allocator_p);
+    bslma::RawDeleterProctor<Job, bslma::Allocator> proctor(item,
+                                                            d_allocator_p);
+
+    item->d_functor     = job;
+    item->d_enqueueTime = enqueueTime;
+    item->d_deadline    = deadline;
+    item->d_sortKey     = enqueueTime + (priority + 1) * d_agingInterval;
+    item->d_priority    = priority;
+    if (deadline < item->d_sortKey) {
+        item->d_sortKey = deadline;
+    }
+
+    bsls::Types::Uint64 sequenceNum;
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduleMutex);
+
+        sequenceNum = d_nextSequenceNum++;
+        item->d_sequenceNum = sequenceNum;
+
+        d_scheduledJobs.push_back(item);
+        proctor.release();
+
+        bsl::push_heap(d_scheduledJobs.begin(),
+                       d_scheduledJobs.end(),
+                       LaterJob());
+
+        ++d_numPendingJobs[priority];
+    }
+
+    const int rc = d_queue.pushBack(d_dispatchJob, 0);
+    if (0 == rc) {
+        return 0;                                                     // RETURN
+    }
+
+    // The queue is disabled; withdraw the job, unless a dispatch job left by
+    // 'removeJobs' has already executed it.
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduleMutex);
+
+        bsl::vector<Job *>::iterator it = d_scheduledJobs.begin();
+        while (d_scheduledJobs.end() != it
+            && (item != *it || sequenceNum != (*it)->d_sequenceNum)) {
+            ++it;
+        }
+        if (d_scheduledJobs.end() == it) {
+            return 0;                                                 // RETURN
+        }
+
+        *it = d_scheduledJobs.back();
+        d_scheduledJobs.pop_back();
+        bsl::make_heap(d_scheduledJobs.begin(),
+                       d_scheduledJobs.end(),
+                       LaterJob());
+
+        --d_numPendingJobs[priority];
+    }
+
+    d_allocator_p->deleteObject(item);
+
+    return rc;
+}
+
+void MultipriorityThreadPool::recordJobStart(const Job& job)
+{
+    const bsls::Types::Int64 startTime = now();
+    const bsls::Types::Int64 waitTime  = startTime - job.d_enqueueTime;
+    const int                priority  = job.d_priority;
+
+    ++d_numStartedJobs[priority];
+    d_totalWaitTime[priority] += waitTime;
+
+    bsls::Types::Int64 maxWaitTime = d_maxWaitTime[priority];
+    while (waitTime > maxWaitTime) {
+        const bsls::Types::Int64 prevMaxWaitTime =
+                   d_maxWaitTime[priority].testAndSwap(maxWaitTime, waitTime);
+        if (prevMaxWaitTime == maxWaitTime) {
+            break;
+        }
+        maxWaitTime = prevMaxWaitTime;
+    }
+
+    if (startTime > job.d_deadline) {
+        ++d_numMissedDeadlines[priority];
+    }
+}
+
 void MultipriorityThreadPool::worker()
 {
     {
@@ -136,15 +361,23 @@ void MultipriorityThreadPool::worker()
         }  // release mutex
 
         {
-            ThreadFunctor job;
+            Job job(d_allocator_p);
 
             // Retrieve the next job, blocking until one is available.
             d_queue.popFront(&job);
 
-            if (job) {
+            if (job.d_functor) {
+                if (0 <= job.d_priority) {
+                    // This is a user job, rather than a dispatch job or a
+                    // barrier job.
+
+                    --d_numPendingJobs[job.d_priority];
+                    recordJobStart(job);
+                }
+
                 // Run the job.
                 ++d_numActiveThreads;
-                job();                                                // INVOKE
+                job.d_functor();                                      // INVOKE
                 --d_numActiveThreads;
             }
         }
@@ -157,6 +390,12 @@ MultipriorityThreadPool::MultipriorityThreadPool(
                                               int               numPriorities,
                                               bslma::Allocator *basicAllocator)
 : d_queue(numPriorities, basicAllocator)
+, d_schedulingPolicy(e_PRIORITY)
+, d_agingInterval(0)
+, d_dispatchJob(basicAllocator)
+, d_scheduledJobs(basicAllocator)
+, d_nextSequenceNum(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_threadAttributes(basicAllocator)
 , d_threadGroup(basicAllocator)
 , d_numThreads(numThreads)
@@ -177,6 +416,12 @@ MultipriorityThreadPool::MultipriorityThreadPool(
                               const bslmt::ThreadAttributes&  threadAttributes,
                               bslma::Allocator               *basicAllocator)
 : d_queue(numPriorities, basicAllocator)
+, d_schedulingPolicy(e_PRIORITY)
+, d_agingInterval(0)
+, d_dispatchJob(basicAllocator)
+, d_scheduledJobs(basicAllocator)
+, d_nextSequenceNum(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_threadAttributes(threadAttributes, basicAllocator)
 , d_threadGroup(basicAllocator)
 , d_numThreads(numThreads)
@@ -195,19 +440,92 @@ MultipriorityThreadPool::MultipriorityThreadPool(
                                    bslmt::ThreadAttributes::e_CREATE_JOINABLE);
 }
 
+MultipriorityThreadPool::MultipriorityThreadPool(
+                                     int                        numThreads,
+                                     int                        numPriorities,
+                                     const bsls::TimeInterval&  agingInterval,
+                                     bslma::Allocator          *basicAllocator)
+: d_queue(numPriorities, basicAllocator)
+, d_schedulingPolicy(e_DEADLINE)
+, d_agingInterval(agingInterval.totalNanoseconds())
+, d_dispatchJob(basicAllocator)
+, d_scheduledJobs(basicAllocator)
+, d_nextSequenceNum(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadAttributes(basicAllocator)
+, d_threadGroup(basicAllocator)
+, d_numThreads(numThreads)
+, d_threadStartState(e_STOPPED)
+, d_threadSuspendState(e_RESUMED)
+, d_numStartedThreads(0)
+, d_numSuspendedThreads(0)
+, d_numActiveThreads(0)
+{
+    BSLS_ASSERT(k_MAX_NUM_PRIORITIES >= numPriorities);
+    BSLS_ASSERT(1 <= numPriorities);
+    BSLS_ASSERT(1 <= numThreads);
+    BSLS_ASSERT(bsls::TimeInterval() <= agingInterval);
+
+    d_dispatchJob.d_functor = bdlf::MemFnUtil::memFn(
+                        &MultipriorityThreadPool::dispatchScheduledJob, this);
+}
+
+MultipriorityThreadPool::MultipriorityThreadPool(
+                              int                             numThreads,
+                              int                             numPriorities,
+                              const bsls::TimeInterval&       agingInterval,
+                              const bslmt::ThreadAttributes&  threadAttributes,
+                              bslma::Allocator               *basicAllocator)
+: d_queue(numPriorities, basicAllocator)
+, d_schedulingPolicy(e_DEADLINE)
+, d_agingInterval(agingInterval.totalNanoseconds())
+, d_dispatchJob(basicAllocator)
+, d_scheduledJobs(basicAllocator)
+, d_nextSequenceNum(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_threadGroup(basicAllocator)
+, d_numThreads(numThreads)
+, d_threadStartState(e_STOPPED)
+, d_threadSuspendState(e_RESUMED)
+, d_numStartedThreads(0)
+, d_numSuspendedThreads(0)
+, d_numActiveThreads(0)
+{
+    BSLS_ASSERT(k_MAX_NUM_PRIORITIES >= numPriorities);
+    BSLS_ASSERT(1 <= numPriorities);
+    BSLS_ASSERT(1 <= numThreads);
+    BSLS_ASSERT(bsls::TimeInterval() <= agingInterval);
+
+    // Force all threads to be joinable.
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+    d_dispatchJob.d_functor = bdlf::MemFnUtil::memFn(
+                        &MultipriorityThreadPool::dispatchScheduledJob, this);
+}
+
 MultipriorityThreadPool::~MultipriorityThreadPool()
 {
     BSLS_ASSERT(e_STOPPED == d_threadStartState);
+
+    for (bsl::size_t i = 0; i < d_scheduledJobs.size(); ++i) {
+        d_allocator_p->deleteObject(d_scheduledJobs[i]);
+    }
 }
 
 // MANIPULATORS
 int MultipriorityThreadPool::enqueueJob(const ThreadFunctor& job,
                                         int                  priority)
 {
-    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
-    // checks '0 <= priority < numPriorities()'
+    return pushJob(job, priority, LLONG_MAX);
+}
 
-    return d_queue.pushBack(job, priority);
+int MultipriorityThreadPool::enqueueJob(const ThreadFunctor&      job,
+                                        int                       priority,
+                                        const bsls::TimeInterval& deadline)
+{
+    return pushJob(job, priority, deadline.totalNanoseconds());
 }
 
 int MultipriorityThreadPool::enqueueJob(bslmt_ThreadFunction  jobFunction,
@@ -351,7 +669,7 @@ void MultipriorityThreadPool::stopThreads()
         d_resumeCondition.broadcast();
     }
     else {
-        const ThreadFunctor nullJob;
+        const Job nullJob(d_allocator_p);
         // Push high-priority null jobs into multi-priority queue, in case
         // threads are already blocking on pops of the queue for input.
         // 'worker' will do a no-op when it encounters these jobs.  There might
@@ -392,7 +710,7 @@ void MultipriorityThreadPool::suspendProcessing()
 
     d_threadSuspendState = e_SUSPENDING;
 
-    const ThreadFunctor nullJob;
+    const Job nullJob(d_allocator_p);
 
     // Push high-priority null jobs into multi-priority queue, in case threads
     // are already blocking on pops of the queue for input.  'worker' will do a
@@ -431,8 +749,9 @@ void MultipriorityThreadPool::drainJobs()
     BSLS_ASSERT(e_RESUMED == d_threadSuspendState);
 
     bslmt::Barrier barrier(d_numThreads + 1);
-    const ThreadFunctor barrierJob =
-                       bdlf::MemFnUtil::memFn(&bslmt::Barrier::wait, &barrier);
+    Job barrierJob(d_allocator_p);
+    barrierJob.d_functor = bdlf::MemFnUtil::memFn(&bslmt::Barrier::wait,
+                                                  &barrier);
 
     d_queue.pushBackMultipleRaw(barrierJob,
                                 d_queue.numPriorities() - 1,
@@ -445,7 +764,44 @@ void MultipriorityThreadPool::removeJobs()
 {
     bslmt::LockGuard<bslmt::Mutex> metaLock(&d_metaMutex);
 
+    if (e_PRIORITY == d_schedulingPolicy) {
+        // Pop the jobs one at a time, so that the number of pending jobs of
+        // each priority can be maintained.
+
+        Job job(d_allocator_p);
+        while (0 == d_queue.tryPopFront(&job)) {
+            if (0 <= job.d_priority) {
+                --d_numPendingJobs[job.d_priority];
+            }
+        }
+        return;                                                       // RETURN
+    }
+
     d_queue.removeAll();
+
+    bsl::vector<Job *> removedJobs(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduleMutex);
+
+        removedJobs.swap(d_scheduledJobs);
+        for (bsl::size_t i = 0; i < removedJobs.size(); ++i) {
+            --d_numPendingJobs[removedJobs[i]->d_priority];
+        }
+    }
+
+    for (bsl::size_t i = 0; i < removedJobs.size(); ++i) {
+        d_allocator_p->deleteObject(removedJobs[i]);
+    }
+}
+
+void MultipriorityThreadPool::resetStatistics()
+{
+    for (int i = 0; i < k_MAX_NUM_PRIORITIES; ++i) {
+        d_numStartedJobs[i]     = 0;
+        d_totalWaitTime[i]      = 0;
+        d_maxWaitTime[i]        = 0;
+        d_numMissedDeadlines[i] = 0;
+    }
 }
 
 void MultipriorityThreadPool::shutdown()
@@ -456,6 +812,13 @@ void MultipriorityThreadPool::shutdown()
 }
 
 // ACCESSORS
+bsls::TimeInterval MultipriorityThreadPool::agingInterval() const
+{
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(d_agingInterval);
+    return result;
+}
+
 bool MultipriorityThreadPool::isEnabled() const
 {
     return d_queue.isEnabled();
@@ -471,11 +834,28 @@ bool MultipriorityThreadPool::isSuspended() const
     return e_SUSPENDED == d_threadSuspendState;
 }
 
+bsls::TimeInterval MultipriorityThreadPool::maxWaitTime(int priority) const
+{
+    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
+
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(d_maxWaitTime[priority]);
+    return result;
+}
+
 int MultipriorityThreadPool::numActiveThreads() const
 {
     return d_numActiveThreads;
 }
 
+bsls::Types::Int64
+MultipriorityThreadPool::numMissedDeadlines(int priority) const
+{
+    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
+
+    return d_numMissedDeadlines[priority];
+}
+
 int MultipriorityThreadPool::numPriorities() const
 {
     return d_queue.numPriorities();
@@ -483,7 +863,27 @@ int MultipriorityThreadPool::numPriorities() const
 
 int MultipriorityThreadPool::numPendingJobs() const
 {
-    return d_queue.length();
+    if (e_PRIORITY == d_schedulingPolicy) {
+        return d_queue.length();                                      // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_scheduleMutex);
+
+    return static_cast<int>(d_scheduledJobs.size());
+}
+
+int MultipriorityThreadPool::numPendingJobs(int priority) const
+{
+    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
+
+    return d_numPendingJobs[priority];
+}
+
+bsls::Types::Int64 MultipriorityThreadPool::numStartedJobs(int priority) const
+{
+    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
+
+    return d_numStartedJobs[priority];
 }
 
 int MultipriorityThreadPool::numStartedThreads() const
@@ -495,6 +895,22 @@ int MultipriorityThreadPool::numThreads() const
 {
     return d_numThreads;
 }
+
+MultipriorityThreadPool::SchedulingPolicy
+MultipriorityThreadPool::schedulingPolicy() const
+{
+    return d_schedulingPolicy;
+}
+
+bsls::TimeInterval
+MultipriorityThreadPool::totalWaitTime(int priority) const
+{
+    BSLS_ASSERT((unsigned) priority < (unsigned) d_queue.numPriorities());
+
+    bsls::TimeInterval result;
+    result.setTotalNanoseconds(d_totalWaitTime[priority]);
+    return result;
+}
 }  // close package namespace
 
 }  // close enterprise namespace
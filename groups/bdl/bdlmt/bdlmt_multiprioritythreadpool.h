@@ -38,9 +38,10 @@ BSLS_IDENT("$Id: $")
 //
 // The associated priority of a job is relevant only while that job is pending;
 // once a job has begun executing, it will not be interrupted or suspended to
-// make way for a another job regardless of their relative priorities.  While
-// processing jobs, worker threads will always choose a more urgent job (lower
-// integer value for priority) over a less urgent one.  Given two jobs having
+// make way for a another job regardless of their relative priorities.  By
+// default, while processing jobs, worker threads will always choose a more
+// urgent job (lower integer value for priority) over a less urgent one (but
+// see {Deadline Scheduling and Priority Aging}).  Given two jobs having
 // the same priority value, the one that has been in the thread pool's queue
 // the longest is selected (FIFO order).  Note that the number of active worker
 // threads does not increase or decrease depending on load.  If no jobs remain
@@ -57,9 +58,10 @@ BSLS_IDENT("$Id: $")
 // be invoked with the specified argument by the processing (worker) thread.
 // The functor-based interface allows for flexible job execution by copying the
 // passed functor and executing its (invokable) 'operator()' method.  Note that
-// the functor gets copied twice before it is executed, once when pushed into
-// the queue, and once when popped out of it, something to keep in mind if the
-// object is going to be expensive to copy.  (See the 'bdef' package-level
+// the functor may be copied up to three times before it is executed, once into
+// the record describing the pending job, once when pushed into the queue, and
+// once when popped out of it, something to keep in mind if the object is going
+// to be expensive to copy.  (See the 'bdef' package-level
 // documentation for more information on functors and their use.)
 //
 // Note that except in the case where 'numThreads() == 1', we cannot guarantee
@@ -72,6 +74,43 @@ BSLS_IDENT("$Id: $")
 // 'bslmt::ThreadAttributes' class.)  Note that the field pertaining to whether
 // the worker threads should be detached or joinable is ignored.
 //
+///Deadline Scheduling and Priority Aging
+///---------------------------------------
+// Strict priority ordering means that, under sustained load of more urgent
+// jobs, less urgent jobs may never execute.  A thread pool constructed with an
+// 'agingInterval' instead uses the 'e_DEADLINE' scheduling policy, in which
+// each pending job has an *effective* *deadline*, and worker threads always
+// choose the pending job having the earliest effective deadline (jobs having
+// the same effective deadline are executed in FIFO order).  The effective
+// deadline of a job enqueued at time 'T' with priority 'P' is:
+//..
+//  T + (P + 1) * agingInterval
+//..
+// or, if the job was enqueued with an explicit 'deadline' (the time by which
+// the job should begin executing) that is earlier than that, the explicit
+// 'deadline'.  Therefore, a job of priority 'P' is preferred over any job of
+// priority 0 enqueued more than 'P * agingInterval' after it, so that less
+// urgent jobs "age" into more urgent ones and are never starved, while a job
+// having an explicit deadline is executed in earliest-deadline-first (EDF)
+// order with respect to all other jobs.  All times are measured on the
+// monotonic system clock (see 'bsls::SystemTime::nowMonotonicClock').
+//
+// Note that, in 'e_DEADLINE' mode, explicit deadlines should be chosen with
+// enough slack for jobs of the most urgent priority enqueued during that
+// slack to be executed first: a job having deadline 'D' may be preceded by
+// priority-0 jobs enqueued up to 'D - agingInterval'.
+//
+///Statistics
+///----------
+// A multi-priority thread pool maintains, for each priority, the number of
+// pending jobs ('numPendingJobs(priority)'), the number of jobs that have
+// begun executing ('numStartedJobs'), the total and maximum time those jobs
+// waited in the queue before executing ('totalWaitTime' and 'maxWaitTime'),
+// and the number of jobs enqueued with an explicit deadline that began
+// executing after that deadline ('numMissedDeadlines').  These statistics are
+// maintained in both scheduling modes, and all but the number of pending jobs
+// may be reset with 'resetStatistics'.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlmt::MultipriorityThreadPool' class is both *fully thread-safe*
@@ -384,6 +423,8 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_threadgroup.h>
 
 #include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bslma_allocator.h>
 
@@ -395,10 +436,62 @@ BSLS_IDENT("$Id: $")
     #include <bsl_c_signal.h>
 #endif
 #include <bsl_functional.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 
 namespace bdlmt {
+                     // =================================
+                     // class MultipriorityThreadPool_Job
+                     // =================================
+
+struct MultipriorityThreadPool_Job {
+    // This component-private 'struct' describes a job pending in a
+    // 'MultipriorityThreadPool', along with the information needed to
+    // schedule it and to maintain the statistics of the pool.
+
+    // DATA
+    bsl::function<void()> d_functor;      // job to execute
+
+    bsls::Types::Int64    d_enqueueTime;  // nanoseconds, monotonic clock
+
+    bsls::Types::Int64    d_deadline;     // explicit deadline, in nanoseconds
+                                          // on the monotonic clock, or
+                                          // 'LLONG_MAX' if none
+
+    bsls::Types::Int64    d_sortKey;      // effective deadline ('e_DEADLINE'
+                                          // mode only)
+
+    bsls::Types::Uint64   d_sequenceNum;  // breaks ties of 'd_sortKey'
+
+    int                   d_priority;     // priority of the job, or -1 for
+                                          // jobs internal to the pool
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MultipriorityThreadPool_Job,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    MultipriorityThreadPool_Job(bslma::Allocator *basicAllocator = 0);
+        // Create an internal job having a null functor.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    MultipriorityThreadPool_Job(
+                       const MultipriorityThreadPool_Job&  original,
+                       bslma::Allocator                   *basicAllocator = 0);
+        // Create a job having the value of the specified 'original' job.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+    // MANIPULATORS
+    MultipriorityThreadPool_Job& operator=(
+                                       const MultipriorityThreadPool_Job& rhs);
+        // Assign to this job the value of the specified 'rhs' job, and return
+        // a reference providing modifiable access to this job.
+};
+
                        // =============================
                        // class MultipriorityThreadPool
                        // =============================
@@ -426,7 +519,21 @@ class MultipriorityThreadPool {
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
     };
 
+    enum SchedulingPolicy {
+        // Enumerate the ways in which worker threads choose the next pending
+        // job to execute.
+
+        e_PRIORITY,  // most urgent priority first, FIFO within a priority
+                     // (the default)
+
+        e_DEADLINE   // earliest effective deadline first, with priority
+                     // aging
+    };
+
   private:
+    // PRIVATE TYPES
+    typedef MultipriorityThreadPool_Job Job;
+
     // DATA
     bslmt::Mutex            d_mutex;      // mutex for worker threads as they
                                           // analyze state, and for methods
@@ -439,8 +546,41 @@ class MultipriorityThreadPool {
                                           // 'd_mutex', but for longer periods
                                           // of time
 
-    bdlcc::MultipriorityQueue<ThreadFunctor>
-                            d_queue;      // pending job queue
+    bdlcc::MultipriorityQueue<Job>
+                            d_queue;      // pending job queue; in
+                                          // 'e_DEADLINE' mode, holds one
+                                          // copy of 'd_dispatchJob' for each
+                                          // job in 'd_scheduledJobs'
+
+    const SchedulingPolicy  d_schedulingPolicy;
+                                          // how the next job is chosen
+
+    const bsls::Types::Int64
+                            d_agingInterval;
+                                          // nanoseconds of waiting per level
+                                          // of priority ('e_DEADLINE' mode
+                                          // only)
+
+    Job                     d_dispatchJob;
+                                          // internal job that executes the
+                                          // earliest job in 'd_scheduledJobs'
+
+    mutable bslmt::Mutex    d_scheduleMutex;
+                                          // mutex for 'd_scheduledJobs' and
+                                          // 'd_nextSequenceNum'
+
+    bsl::vector<Job *>      d_scheduledJobs;
+                                          // heap of pending jobs ordered by
+                                          // effective deadline ('e_DEADLINE'
+                                          // mode only), owned
+
+    bsls::Types::Uint64     d_nextSequenceNum;
+                                          // sequence number of the next job
+                                          // added to 'd_scheduledJobs'
+
+    bslma::Allocator       *d_allocator_p;
+                                          // memory allocator (held, not
+                                          // owned)
 
     bslmt::ThreadAttributes d_threadAttributes;
                                           // user-supplied attributes of all
@@ -489,12 +629,52 @@ class MultipriorityThreadPool {
                                           // broadcast when suspended threads
                                           // are to resume
 
+    bsls::AtomicInt         d_numPendingJobs[k_MAX_NUM_PRIORITIES];
+                                          // number of pending jobs of each
+                                          // priority
+
+    bsls::AtomicInt64       d_numStartedJobs[k_MAX_NUM_PRIORITIES];
+                                          // number of jobs of each priority
+                                          // that have begun executing
+
+    bsls::AtomicInt64       d_totalWaitTime[k_MAX_NUM_PRIORITIES];
+                                          // total nanoseconds waited by the
+                                          // jobs of each priority that have
+                                          // begun executing
+
+    bsls::AtomicInt64       d_maxWaitTime[k_MAX_NUM_PRIORITIES];
+                                          // maximum nanoseconds waited by a
+                                          // job of each priority
+
+    bsls::AtomicInt64       d_numMissedDeadlines[k_MAX_NUM_PRIORITIES];
+                                          // number of jobs of each priority
+                                          // that began executing after their
+                                          // explicit deadlines
+
   private:
     // NOT IMPLEMENTED
     MultipriorityThreadPool(const MultipriorityThreadPool&);
     MultipriorityThreadPool& operator=(const MultipriorityThreadPool&);
 
     // PRIVATE MANIPULATORS
+    void dispatchScheduledJob();
+        // Remove the job having the earliest effective deadline from the heap
+        // of scheduled jobs of this multi-priority thread pool, if any, and
+        // execute it.  This method is the functor of 'd_dispatchJob'.
+
+    int pushJob(const ThreadFunctor& job,
+                int                  priority,
+                bsls::Types::Int64   deadline);
+        // Add the specified 'job' to the queue of this multi-priority thread
+        // pool, assigning it the specified 'priority' and the specified
+        // 'deadline', in nanoseconds on the monotonic system clock.  Return 0
+        // if the job was enqueued successfully, and a non-zero value
+        // otherwise.
+
+    void recordJobStart(const Job& job);
+        // Update the statistics of this multi-priority thread pool to reflect
+        // that the specified 'job' is about to begin executing.
+
     void worker();
         // This method runs in each thread of this multi-priority thread pool,
         // processing jobs until commanded to stop, in which case the thread
@@ -526,7 +706,36 @@ class MultipriorityThreadPool {
         // created thread pool will initially be enabled for enqueuing jobs,
         // but with no worker threads created.  The behavior is undefined
         // unless '1 <= numThreads' and
-        // '1 <= numPriorities <= k_MAX_NUM_PRIORITIES'.
+        // '1 <= numPriorities <= k_MAX_NUM_PRIORITIES'.  Note that the newly
+        // created thread pool uses the 'e_PRIORITY' scheduling policy.
+
+    MultipriorityThreadPool(int                        numThreads,
+                            int                        numPriorities,
+                            const bsls::TimeInterval&  agingInterval,
+                            bslma::Allocator          *basicAllocator = 0);
+    MultipriorityThreadPool(
+                           int                             numThreads,
+                           int                             numPriorities,
+                           const bsls::TimeInterval&       agingInterval,
+                           const bslmt::ThreadAttributes&  threadAttributes,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create a multi-priority thread pool that uses the 'e_DEADLINE'
+        // scheduling policy, capable of concurrently executing the specified
+        // 'numThreads' "jobs" with associated integer priorities in the
+        // specified range '[0 .. numPriorities - 1]', 0 being the most urgent,
+        // where each level of priority delays the effective deadline of a job
+        // by the specified 'agingInterval' (see {Deadline Scheduling and
+        // Priority Aging}).  Optionally specify 'threadAttributes' used to
+        // customize each worker thread created by this thread pool, in which
+        // case the attribute pertaining to whether the worker threads are
+        // created in the detached state is ignored.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The newly
+        // created thread pool will initially be enabled for enqueuing jobs,
+        // but with no worker threads created.  The behavior is undefined
+        // unless '1 <= numThreads',
+        // '1 <= numPriorities <= k_MAX_NUM_PRIORITIES', and
+        // 'bsls::TimeInterval() <= agingInterval'.
 
     ~MultipriorityThreadPool();
         // Remove (cancel) all pending jobs and destroy this multi-priority
@@ -541,6 +750,19 @@ class MultipriorityThreadPool {
         // that the queue was in the disabled state).  The behavior is
         // undefined unless '0 <= priority < numPriorities()'.
 
+    int enqueueJob(const ThreadFunctor&      job,
+                   int                       priority,
+                   const bsls::TimeInterval& deadline);
+        // Add the specified 'job' to the queue of this multi-priority thread
+        // pool, assigning it the specified 'priority' and the specified
+        // 'deadline', the time, measured on the monotonic system clock, by
+        // which 'job' should begin executing.  Return 0 if the job was
+        // enqueued successfully, and a non-zero value otherwise (implying
+        // that the queue was in the disabled state).  The behavior is
+        // undefined unless '0 <= priority < numPriorities()'.  Note that, if
+        // this thread pool uses the 'e_PRIORITY' scheduling policy,
+        // 'deadline' affects only the 'numMissedDeadlines' statistic.
+
     int enqueueJob(bslmt_ThreadFunction  jobFunction,
                    void                 *jobData,
                    int                   priority);
@@ -636,11 +858,23 @@ class MultipriorityThreadPool {
         // Note that, in this case, such undefined behavior may include
         // deadlock.
 
+    void resetStatistics();
+        // Reset to 0 the number of started jobs, the total and maximum wait
+        // times, and the number of missed deadlines of every priority of this
+        // multi-priority thread pool.  Note that the numbers of pending jobs
+        // are not affected.
+
     void shutdown();
         // Disable the enqueuing of new jobs to this multi-priority thread
         // pool, cancel all pending jobs, and stop all worker threads.
 
     // ACCESSORS
+    bsls::TimeInterval agingInterval() const;
+        // Return the interval, specified at construction, by which each level
+        // of priority delays the effective deadline of a job enqueued to this
+        // multi-priority thread pool if it uses the 'e_DEADLINE' scheduling
+        // policy, and a zero interval otherwise.
+
     bool isEnabled() const;
         // Return 'true' if the enqueuing of new jobs is enabled for this
         // multi-priority thread pool, and 'false' otherwise.
@@ -654,21 +888,47 @@ class MultipriorityThreadPool {
         // Return 'true' if the threads of this multi-priority thread pool are
         // currently suspended from processing jobs, and 'false' otherwise.
 
+    bsls::TimeInterval maxWaitTime(int priority) const;
+        // Return the longest time that a job having the specified 'priority'
+        // waited in the queue of this multi-priority thread pool before
+        // beginning to execute, since this thread pool was created or its
+        // statistics were last reset.  The behavior is undefined unless
+        // '0 <= priority < numPriorities()'.
+
     int numActiveThreads() const;
         // Return a snapshot of the number of threads that are actively
         // processing jobs for this multi-priority thread pool.  Note that
         // '0 <= numActiveThreads() <= numThreads()' is an invariant of this
         // class.
 
+    bsls::Types::Int64 numMissedDeadlines(int priority) const;
+        // Return the number of jobs having the specified 'priority' and an
+        // explicit deadline that began executing after that deadline since
+        // this multi-priority thread pool was created or its statistics were
+        // last reset.  The behavior is undefined unless
+        // '0 <= priority < numPriorities()'.
+
     int numPendingJobs() const;
         // Return a snapshot of the number of jobs currently enqueued to be
         // processed by this multi-priority thread pool, but are not yet
         // running.
 
+    int numPendingJobs(int priority) const;
+        // Return a snapshot of the number of jobs having the specified
+        // 'priority' currently enqueued to be processed by this multi-priority
+        // thread pool, but not yet running.  The behavior is undefined unless
+        // '0 <= priority < numPriorities()'.
+
     int numPriorities() const;
         // Return the fixed number of priorities, specified at construction,
         // that this multi-priority thread pool supports.
 
+    bsls::Types::Int64 numStartedJobs(int priority) const;
+        // Return the number of jobs having the specified 'priority' that have
+        // begun executing since this multi-priority thread pool was created or
+        // its statistics were last reset.  The behavior is undefined unless
+        // '0 <= priority < numPriorities()'.
+
     int numStartedThreads() const;
         // Return the number of threads that have been started for this
         // multi-priority thread pool.  Note that they may be currently
@@ -677,6 +937,17 @@ class MultipriorityThreadPool {
     int numThreads() const;
         // Returns the fixed number of threads, specified at construction, that
         // are started by this multi-priority thread pool.
+
+    SchedulingPolicy schedulingPolicy() const;
+        // Return the scheduling policy of this multi-priority thread pool.
+
+    bsls::TimeInterval totalWaitTime(int priority) const;
+        // Return the total time that the jobs having the specified 'priority'
+        // that have begun executing waited in the queue of this multi-priority
+        // thread pool, since this thread pool was created or its statistics
+        // were last reset.  The behavior is undefined unless
+        // '0 <= priority < numPriorities()'.  Note that the mean wait time is
+        // 'totalWaitTime(priority) / numStartedJobs(priority)'.
 };
 
 }  // close package namespace
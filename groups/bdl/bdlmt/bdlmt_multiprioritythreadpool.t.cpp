@@ -30,6 +30,7 @@
 #include <bsl_iostream.h>
 #include <bsl_list.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bslma_default.h>
 #include <bslma_defaultallocatorguard.h>
@@ -38,6 +39,7 @@
 #include <bslma_testallocator.h>       // for testing only
 
 #include <bsls_atomic.h>
+#include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 
 #include <sys/stat.h>
@@ -57,22 +59,33 @@ using namespace bsl;  // automatically added by script
 //
 // CREATORS
 // [ 4] all constructors, destructor
+// [12] MultipriorityThreadPool(int, int, const TimeInterval&, *ba);
+// [12] MultipriorityThreadPool(int, int, const TimeInterval&, attr, *ba);
 //
 // MANIPULATORS
 // [ 2] enqueueJob(void (*)(), void *)
 // [ 6] enqueueJob(ThreadFunctor)
+// [12] enqueueJob(ThreadFunctor, int, const TimeInterval&)
 // [ 3] drainJobs()
 // [ 5] enableQueue(), disableQueue(), isEnabled()
 // [ 5] startThreads(), stopThreads(), isStarted(), numStartedThreads()
 // [ 5] suspendProcessing(), resumeProcessing(), isSuspended()
 // [ 9] removeJobs()
 // [ 9] shutdown()
+// [12] resetStatistics()
 //
 // ACCESSORS
 // [ 4] numThreads()
 // [ 4] numPriorities()
 // [ 6] numPendingJobs()
 // [ 8] numActiveThreads()
+// [12] agingInterval()
+// [12] schedulingPolicy()
+// [12] numPendingJobs(int)
+// [12] numStartedJobs(int)
+// [12] numMissedDeadlines(int)
+// [12] totalWaitTime(int)
+// [12] maxWaitTime(int)
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
@@ -81,8 +94,9 @@ using namespace bsl;  // automatically added by script
 // [ 7] // queue sorting
 // [10] stress test
 // [11] ignoring 'joinable' trait of attributes passed
-// [12] usage example 2
-// [13] usage example 1
+// [12] deadline scheduling, priority aging, and statistics
+// [13] usage example 2
+// [14] usage example 1
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -153,10 +167,10 @@ int veryVeryVeryVerbose;
 }  // close unnamed namespace
 
 // ============================================================================
-//                Classes for test case 13 -- usage example 1
+//                Classes for test case 14 -- usage example 1
 // ============================================================================
 
-namespace MULTIPRIORITYTHREADPOOL_CASE_13 {
+namespace MULTIPRIORITYTHREADPOOL_CASE_14 {
 
 // The idea here is we have a large number of jobs submitted in too little time
 // for all of them to be completed.  All jobs take the same amount of time to
@@ -190,10 +204,10 @@ extern "C" void *lessUrgentJob(void *)
     return 0;
 }
 
-}  // close namespace MULTIPRIORITYTHREADPOOL_CASE_13
+}  // close namespace MULTIPRIORITYTHREADPOOL_CASE_14
 
 // ============================================================================
-//                Classes for test case 12 -- usage example 2
+//                Classes for test case 13 -- usage example 2
 // ============================================================================
 
 // The idea here is to have a multithreaded algorithm for calculating prime
@@ -211,7 +225,7 @@ extern "C" void *lessUrgentJob(void *)
 // discover bigger and bigger primes until we have covered an entire range, in
 // this example all ints below TOP_NUMBER == 2000.
 
-namespace MULTIPRIORITYTHREADPOOL_CASE_12 {
+namespace MULTIPRIORITYTHREADPOOL_CASE_13 {
 
 enum {
     TOP_NUMBER = 2000,
@@ -361,6 +375,46 @@ struct Functor {
 };
 bslmt::Mutex Functor::s_mutex;
 
+}  // close namespace MULTIPRIORITYTHREADPOOL_CASE_13
+
+// ============================================================================
+//                         Classes for test case 12
+// ============================================================================
+
+namespace MULTIPRIORITYTHREADPOOL_CASE_12 {
+
+struct RecordJob {
+    // Append 'd_id' to '*d_order_p' when invoked.
+
+    bsl::vector<int> *d_order_p;
+    bslmt::Mutex     *d_mutex_p;
+    int               d_id;
+
+    void operator()()
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(d_mutex_p);
+
+        d_order_p->push_back(d_id);
+    }
+};
+
+Obj::ThreadFunctor recordJob(bsl::vector<int> *order,
+                             bslmt::Mutex     *mutex,
+                             int               id)
+    // Return a functor that appends the specified 'id' to the specified
+    // 'order', under the specified 'mutex', when invoked.
+{
+    RecordJob job = { order, mutex, id };
+
+    return Obj::ThreadFunctor(bsl::allocator_arg, &ta, job);
+}
+
+bsls::TimeInterval monotonicNow()
+    // Return the current time on the monotonic system clock.
+{
+    return bsls::SystemTime::nowMonotonicClock();
+}
+
 }  // close namespace MULTIPRIORITYTHREADPOOL_CASE_12
 
 // ============================================================================
@@ -660,7 +714,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -674,7 +728,7 @@ int main(int argc, char *argv[])
                     "===============\n";
         }
 
-        using namespace MULTIPRIORITYTHREADPOOL_CASE_13;
+        using namespace MULTIPRIORITYTHREADPOOL_CASE_14;
 
         bdlmt::MultipriorityThreadPool pool(20,  // threads
                                             2,   // priorities
@@ -699,7 +753,7 @@ int main(int argc, char *argv[])
                           ", less urgent: " << lessUrgentJobsDone << bsl::endl;
         }
       }  break;
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -707,7 +761,7 @@ int main(int argc, char *argv[])
         //   That usage example 2 compiles and links.
         // --------------------------------------------------------------------
 
-        using namespace MULTIPRIORITYTHREADPOOL_CASE_12;
+        using namespace MULTIPRIORITYTHREADPOOL_CASE_13;
 
         double startTime = bdlt::CurrentTime::now().totalSecondsAsDouble();
 
@@ -756,6 +810,259 @@ int main(int argc, char *argv[])
             printf("\n");
         }
       }  break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // DEADLINE SCHEDULING, PRIORITY AGING, AND STATISTICS
+        //
+        // Concerns:
+        //: 1 A pool constructed with an aging interval uses the 'e_DEADLINE'
+        //:   policy and reports its aging interval; a pool constructed without
+        //:   one uses the 'e_PRIORITY' policy.
+        //:
+        //: 2 In 'e_DEADLINE' mode, jobs are executed in order of effective
+        //:   deadline, an explicit deadline takes precedence over a later
+        //:   implicit one, and jobs having the same effective deadline are
+        //:   executed in FIFO order.
+        //:
+        //: 3 In 'e_DEADLINE' mode, a less urgent job that has waited long
+        //:   enough is executed before a more urgent job enqueued later,
+        //:   whereas in 'e_PRIORITY' mode it is not.
+        //:
+        //: 4 The numbers of pending jobs of each priority are maintained
+        //:   across enqueuing, executing, failed enqueuing, and 'removeJobs'
+        //:   in both modes.
+        //:
+        //: 5 The numbers of started jobs, the wait times, and the numbers of
+        //:   missed deadlines are maintained in both modes, and are reset by
+        //:   'resetStatistics'.
+        //:
+        //: 6 All memory is supplied by the allocator passed at construction.
+        //
+        // Plan:
+        //: 1 Construct pools with and without an aging interval, and check the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Enqueue jobs having various priorities and deadlines to a stopped
+        //:   single-threaded pool, start it, drain it, and verify the order of
+        //:   execution.  (C-2)
+        //:
+        //: 3 Enqueue a less urgent job, wait, enqueue a more urgent job, and
+        //:   verify the order of execution in both modes.  (C-3)
+        //:
+        //: 4 Throughout, check 'numPendingJobs' and the statistics accessors,
+        //:   and check that the test allocator has no memory in use once the
+        //:   pools are destroyed.  (C-4..6)
+        //
+        // Testing:
+        //   MultipriorityThreadPool(int, int, const TimeInterval&, *ba);
+        //   MultipriorityThreadPool(int, int, const TimeInterval&, attr, *ba);
+        //   enqueueJob(ThreadFunctor, int, const TimeInterval&)
+        //   resetStatistics()
+        //   agingInterval()
+        //   schedulingPolicy()
+        //   numPendingJobs(int)
+        //   numStartedJobs(int)
+        //   numMissedDeadlines(int)
+        //   totalWaitTime(int)
+        //   maxWaitTime(int)
+        // --------------------------------------------------------------------
+
+        using namespace MULTIPRIORITYTHREADPOOL_CASE_12;
+
+        if (verbose) {
+            cout << "==================================================\n"
+                    "Testing deadline scheduling, aging, and statistics\n"
+                    "==================================================\n";
+        }
+
+        bslma::TestAllocator localTa(veryVeryVerbose);
+
+        if (verbose) cout << "Scheduling policy and aging interval\n";
+        {
+            Obj mX(1, 2, &localTa);  const Obj& X = mX;
+            ASSERT(Obj::e_PRIORITY       == X.schedulingPolicy());
+            ASSERT(bsls::TimeInterval()  == X.agingInterval());
+
+            Obj mY(1, 2, bsls::TimeInterval(1.5), &localTa);
+            const Obj& Y = mY;
+            ASSERT(Obj::e_DEADLINE         == Y.schedulingPolicy());
+            ASSERT(bsls::TimeInterval(1.5) == Y.agingInterval());
+
+            bslmt::ThreadAttributes attributes;
+            Obj mZ(1, 2, bsls::TimeInterval(2), attributes, &localTa);
+            const Obj& Z = mZ;
+            ASSERT(Obj::e_DEADLINE       == Z.schedulingPolicy());
+            ASSERT(bsls::TimeInterval(2) == Z.agingInterval());
+
+            for (int i = 0; i < 2; ++i) {
+                ASSERT(0 == X.numPendingJobs(i));
+                ASSERT(0 == Y.numStartedJobs(i));
+                ASSERT(0 == Y.numMissedDeadlines(i));
+                ASSERT(bsls::TimeInterval() == Y.totalWaitTime(i));
+                ASSERT(bsls::TimeInterval() == Y.maxWaitTime(i));
+            }
+        }
+
+        if (verbose) cout << "Order of execution by deadline\n";
+        {
+            bsl::vector<int> order(&localTa);
+            bslmt::Mutex     mutex;
+
+            Obj mX(1, 3, bsls::TimeInterval(10), &localTa);
+            const Obj& X = mX;
+
+            const bsls::TimeInterval NOW = monotonicNow();
+
+            // Effective deadlines: job 0, 'NOW + 30'; jobs 1 and 3,
+            // 'NOW + 10'; job 2, 'NOW + 5'; job 4, 'NOW + 1'; job 5,
+            // 'NOW + 20' (explicit deadline later than implicit one).
+
+            ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 0), 2));
+            ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 1), 0));
+            ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 2),
+                                      1,
+                                      NOW + 5));
+            ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 3), 0));
+            ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 4),
+                                      2,
+                                      NOW - 1));
+            ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 5),
+                                      1,
+                                      NOW + 100));
+
+            ASSERT(6 == X.numPendingJobs());
+            ASSERT(2 == X.numPendingJobs(0));
+            ASSERT(2 == X.numPendingJobs(1));
+            ASSERT(2 == X.numPendingJobs(2));
+
+            mX.startThreads();
+            mX.drainJobs();
+
+            const int EXP[] = { 4, 2, 1, 3, 5, 0 };
+            const int NUM_EXP = static_cast<int>(LO_ARRAY_LENGTH(EXP));
+
+            ASSERTV(order.size(), NUM_EXP == static_cast<int>(order.size()));
+            for (int i = 0; i < NUM_EXP && i < (int) order.size(); ++i) {
+                ASSERTV(i, EXP[i], order[i], EXP[i] == order[i]);
+            }
+
+            ASSERT(0 == X.numPendingJobs());
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, 0 == X.numPendingJobs(i));
+                ASSERTV(i, 2 == X.numStartedJobs(i));
+                ASSERTV(i, X.maxWaitTime(i) <= X.totalWaitTime(i));
+            }
+
+            // Only job 4 began executing after its explicit deadline.
+
+            ASSERT(0 == X.numMissedDeadlines(0));
+            ASSERT(0 == X.numMissedDeadlines(1));
+            ASSERT(1 == X.numMissedDeadlines(2));
+
+            mX.resetStatistics();
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, 0 == X.numStartedJobs(i));
+                ASSERTV(i, 0 == X.numMissedDeadlines(i));
+                ASSERTV(i, bsls::TimeInterval() == X.totalWaitTime(i));
+                ASSERTV(i, bsls::TimeInterval() == X.maxWaitTime(i));
+            }
+
+            mX.stopThreads();
+        }
+
+        if (verbose) cout << "Priority aging\n";
+        {
+            for (int policy = 0; policy < 2; ++policy) {
+                bsl::vector<int> order(&localTa);
+                bslmt::Mutex     mutex;
+
+                Obj mP(1, 3, &localTa);
+                Obj mD(1, 3, bsls::TimeInterval(0.001), &localTa);
+
+                Obj& mX = policy ? mD : mP;  const Obj& X = mX;
+
+                ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 2), 2));
+                bslmt::ThreadUtil::microSleep(20 * 1000);
+                ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, 0), 0));
+
+                mX.startThreads();
+                mX.drainJobs();
+                mX.stopThreads();
+
+                ASSERTV(policy, 2 == order.size());
+                if (2 == order.size()) {
+                    // In 'e_DEADLINE' mode, the priority-2 job, enqueued 20
+                    // aging intervals earlier, is executed first.
+
+                    ASSERTV(policy, order[0], (policy ? 2 : 0) == order[0]);
+                }
+
+                // The priority-2 job waited at least 20 milliseconds.
+
+                ASSERTV(policy, X.maxWaitTime(2),
+                        bsls::TimeInterval(0.02) <= X.maxWaitTime(2));
+                ASSERTV(policy, X.maxWaitTime(2) == X.totalWaitTime(2));
+                ASSERTV(policy, 1 == X.numStartedJobs(0));
+                ASSERTV(policy, 1 == X.numStartedJobs(2));
+            }
+        }
+
+        if (verbose) cout << "Pending jobs, 'removeJobs', 'disableQueue'\n";
+        {
+            for (int policy = 0; policy < 2; ++policy) {
+                bsl::vector<int> order(&localTa);
+                bslmt::Mutex     mutex;
+
+                Obj mP(2, 2, &localTa);
+                Obj mD(2, 2, bsls::TimeInterval(1), &localTa);
+
+                Obj& mX = policy ? mD : mP;  const Obj& X = mX;
+
+                const bsls::TimeInterval PAST = monotonicNow() - 1;
+
+                for (int i = 0; i < 10; ++i) {
+                    ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, i),
+                                              i % 2,
+                                              PAST));
+                }
+                ASSERTV(policy, 10 == X.numPendingJobs());
+                ASSERTV(policy, 5  == X.numPendingJobs(0));
+                ASSERTV(policy, 5  == X.numPendingJobs(1));
+
+                mX.removeJobs();
+
+                ASSERTV(policy, 0 == X.numPendingJobs());
+                ASSERTV(policy, 0 == X.numPendingJobs(0));
+                ASSERTV(policy, 0 == X.numPendingJobs(1));
+
+                mX.disableQueue();
+                ASSERTV(policy, 0 != mX.enqueueJob(
+                                           recordJob(&order, &mutex, 10), 1));
+                ASSERTV(policy, 0 == X.numPendingJobs());
+                ASSERTV(policy, 0 == X.numPendingJobs(1));
+                mX.enableQueue();
+
+                for (int i = 0; i < 4; ++i) {
+                    ASSERT(0 == mX.enqueueJob(recordJob(&order, &mutex, i),
+                                              1,
+                                              PAST));
+                }
+                ASSERTV(policy, 4 == X.numPendingJobs(1));
+
+                mX.startThreads();
+                mX.drainJobs();
+                mX.stopThreads();
+
+                ASSERTV(policy, order.size(), 4 == order.size());
+                ASSERTV(policy, 0 == X.numPendingJobs(1));
+                ASSERTV(policy, 4 == X.numStartedJobs(1));
+                ASSERTV(policy, 4 == X.numMissedDeadlines(1));
+                ASSERTV(policy, 0 == X.numStartedJobs(0));
+            }
+        }
+
+        ASSERTV(localTa.numBytesInUse(), 0 == localTa.numBytesInUse());
+      }  break;
       case 11: {
         // --------------------------------------------------------------------
         // JOINABLE ATTRIBUTE IGNORED TEST
@@ -12,6 +12,9 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlmt_timereventscheduler_cpp,"$Id$ $CSID$")
 
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
 #include <bslmt_lockguard.h>
 
 #include <bslma_default.h>
@@ -25,6 +28,8 @@ BSLS_IDENT_RCSID(bdlmt_timereventscheduler_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>   // for 'CHAR_BIT'
 #include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -73,11 +78,69 @@ namespace bdlmt {
 
 struct TimerEventSchedulerDispatcher {
     // This class just contains the method called to run the dispatcher
-    // thread.  Once started, it infinite loops, either waiting for or
-    // executing events.
+    // thread, and the methods it uses to hand callbacks to the executor of a
+    // scheduler.  Once started, the dispatcher thread infinite loops, either
+    // waiting for or executing events.
+
+    // TYPES
+    typedef bsl::pair<bsls::TimeInterval, bsl::function<void()> > BatchItem;
+        // A callback, and the time for which it was scheduled.
+
+    typedef bsl::vector<BatchItem>                                 Batch;
+
+    struct BatchDeleter {
+        // This 'struct' provides a deleter for the batches of a scheduler,
+        // which releases a batch by calling 'releaseBatch'.
+
+        // DATA
+        TimerEventScheduler *d_scheduler_p;  // scheduler owning the batches
+
+        // CREATORS
+        explicit BatchDeleter(TimerEventScheduler *scheduler)
+            // Create a deleter for the batches of the specified 'scheduler'.
+        : d_scheduler_p(scheduler)
+        {
+        }
+
+        // ACCESSORS
+        void operator()(Batch *batch) const
+            // Release the specified 'batch'.
+        {
+            releaseBatch(d_scheduler_p, batch);
+        }
+    };
 
     // CLASS METHODS
+    static void dispatch(TimerEventScheduler          *scheduler,
+                         const bsls::TimeInterval&     time,
+                         const bsl::function<void()>&  callback,
+                         bsl::shared_ptr<Batch>       *batch);
+        // Dispatch the specified 'callback', scheduled for the specified
+        // 'time', on the specified 'scheduler'.  If 'scheduler' has no
+        // executor, invoke its dispatcher functor with 'callback'; otherwise,
+        // append 'callback' to the specified 'batch' (creating it if it is
+        // null), and enqueue 'batch' to the executor if it is full.
+
     static void dispatchEvents(TimerEventScheduler *scheduler);
+        // Run the dispatcher thread of the specified 'scheduler' until it is
+        // stopped.
+
+    static void enqueueBatch(TimerEventScheduler    *scheduler,
+                             bsl::shared_ptr<Batch> *batch);
+        // Enqueue the specified 'batch' of callbacks, if not null, to the
+        // executor of the specified 'scheduler', executing it in the calling
+        // thread if the executor does not accept it, and reset 'batch'.
+
+    static void releaseBatch(TimerEventScheduler *scheduler, Batch *batch);
+        // Destroy the specified 'batch', allocated by the specified
+        // 'scheduler', and decrement the number of pending batches of
+        // 'scheduler', waking up any thread waiting in 'stop' if it drops to
+        // 0.
+
+    static void runBatch(TimerEventScheduler           *scheduler,
+                         const bsl::shared_ptr<Batch>&  batch);
+        // Invoke, in order, the callbacks in the specified 'batch', updating
+        // the lateness statistics of the specified 'scheduler'.
 };
 
 extern "C" void *TimerEventSchedulerDispatcherThread(void *scheduler)
@@ -87,6 +150,85 @@ extern "C" void *TimerEventSchedulerDispatcherThread(void *scheduler)
     return scheduler;
 }
 
+void TimerEventSchedulerDispatcher::dispatch(
+                                 TimerEventScheduler          *scheduler,
+                                 const bsls::TimeInterval&     time,
+                                 const bsl::function<void()>&  callback,
+                                 bsl::shared_ptr<Batch>       *batch)
+{
+    if (0 == scheduler->d_maxBatchSize) {
+        scheduler->recordLateness(time);
+        scheduler->d_dispatcherFunctor(callback);
+        return;                                                       // RETURN
+    }
+
+    if (!*batch) {
+        bslma::Allocator *allocator = scheduler->d_allocator_p;
+
+        Batch *newBatch = new (*allocator) Batch(allocator);
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&scheduler->d_mutex);
+            ++scheduler->d_numPendingBatches;
+        }
+        batch->reset(newBatch, BatchDeleter(scheduler), allocator);
+
+        (*batch)->reserve(scheduler->d_maxBatchSize);
+    }
+    (*batch)->push_back(BatchItem(time, callback));
+
+    if ((int) (*batch)->size() >= scheduler->d_maxBatchSize) {
+        enqueueBatch(scheduler, batch);
+    }
+}
+
+void TimerEventSchedulerDispatcher::enqueueBatch(
+                                             TimerEventScheduler    *scheduler,
+                                             bsl::shared_ptr<Batch> *batch)
+{
+    if (!*batch) {
+        return;                                                       // RETURN
+    }
+
+    bsl::function<void()> job(bsl::allocator_arg_t(),
+                              scheduler->d_allocator_p,
+                              bdlf::BindUtil::bind(&runBatch,
+                                                   scheduler,
+                                                   *batch));
+
+    const int rc = scheduler->d_threadPool_p
+                 ? scheduler->d_threadPool_p->enqueueJob(job)
+                 : scheduler->d_fixedThreadPool_p->enqueueJob(job);
+    if (0 != rc) {
+        runBatch(scheduler, *batch);
+    }
+    batch->reset();
+}
+
+void TimerEventSchedulerDispatcher::releaseBatch(
+                                                TimerEventScheduler *scheduler,
+                                                Batch               *batch)
+{
+    scheduler->d_allocator_p->deleteObject(batch);
+
+    // 'scheduler' may be destroyed as soon as the count of pending batches
+    // drops to 0, so it must not be accessed after 'd_mutex' is released.
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&scheduler->d_mutex);
+    if (0 == --scheduler->d_numPendingBatches) {
+        scheduler->d_batchCondition.broadcast();
+    }
+}
+
+void TimerEventSchedulerDispatcher::runBatch(
+                                 TimerEventScheduler           *scheduler,
+                                 const bsl::shared_ptr<Batch>&  batch)
+{
+    for (Batch::const_iterator it = batch->begin(); it != batch->end(); ++it) {
+        scheduler->recordLateness(it->first);
+        it->second();
+    }
+}
+
 void TimerEventSchedulerDispatcher::dispatchEvents(
                                                 TimerEventScheduler* scheduler)
 {
@@ -96,6 +238,11 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
 
     bsl::vector<PendingClockItem> pendingClockItems;
 
+    // 'batch' holds the callbacks not yet enqueued to the executor of
+    // 'scheduler', if it has one.
+
+    bsl::shared_ptr<Batch> batch;
+
     while (1) {
         bsl::size_t clockLen;
 
@@ -189,7 +336,7 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             if (clockTime < eventData[*eventIdxPtr].time()) {
                 ClockDataPtr cd(clockData[clockIdx].data());
                 if (!cd->d_isCancelled) {
-                    scheduler->d_dispatcherFunctor(cd->d_callback);
+                    dispatch(scheduler, clockTime, cd->d_callback, &batch);
                     if (!cd->d_isCancelled) {
                         cd->d_handle = scheduler->d_clockTimeQueue.add(
                                        clockTime + cd->d_periodicInterval, cd);
@@ -200,7 +347,10 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             }
             else {
                 --scheduler->d_numEvents;
-                scheduler->d_dispatcherFunctor(eventData[*eventIdxPtr].data());
+                dispatch(scheduler,
+                         eventData[*eventIdxPtr].time(),
+                         eventData[*eventIdxPtr].data(),
+                         &batch);
                 ++ *eventIdxPtr;
             }
         }
@@ -211,7 +361,7 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
             const bsls::TimeInterval& clockTime = clockData[clockIdx].time();
             ClockDataPtr cd(clockData[clockIdx].data());
             if (!cd->d_isCancelled) {
-                scheduler->d_dispatcherFunctor(cd->d_callback);
+                dispatch(scheduler, clockTime, cd->d_callback, &batch);
                 if (!cd->d_isCancelled) {
                     cd->d_handle = scheduler->d_clockTimeQueue.add(
                                             clockTime + cd->d_periodicInterval,
@@ -223,9 +373,14 @@ void TimerEventSchedulerDispatcher::dispatchEvents(
         for (; *eventIdxPtr < (int) scheduler->d_pendingEventItems.size();
                                                             ++ *eventIdxPtr) {
             --scheduler->d_numEvents;
-            scheduler->d_dispatcherFunctor(eventData[*eventIdxPtr].data());
+            dispatch(scheduler,
+                     eventData[*eventIdxPtr].time(),
+                     eventData[*eventIdxPtr].data(),
+                     &batch);
         }
 
+        enqueueBatch(scheduler, &batch);
+
         pendingClockItems.clear();
         scheduler->d_pendingEventItems.clear();
     }
@@ -311,6 +466,26 @@ namespace bdlmt {
                          // -------------------------
 
 // PRIVATE MANIPULATORS
+void TimerEventScheduler::recordLateness(
+                                      const bsls::TimeInterval& scheduledTime)
+{
+    const bsls::Types::Int64 lateness =
+                  (d_currentTimeFunctor() - scheduledTime).totalMicroseconds();
+
+    ++d_numDispatchedEvents;
+    d_totalLateness += lateness;
+
+    bsls::Types::Int64 maxLateness = d_maxLateness;
+    while (lateness > maxLateness) {
+        const bsls::Types::Int64 prevMaxLateness =
+                              d_maxLateness.testAndSwap(maxLateness, lateness);
+        if (prevMaxLateness == maxLateness) {
+            break;
+        }
+        maxLateness = prevMaxLateness;
+    }
+}
+
 void TimerEventScheduler::yieldToDispatcher()
 {
     if (d_running.loadRelaxed()) {
@@ -349,6 +524,13 @@ TimerEventScheduler::TimerEventScheduler(bslma::Allocator* basicAllocator)
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
 }
 
@@ -375,6 +557,13 @@ TimerEventScheduler::TimerEventScheduler(
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(clockType)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
 }
 
@@ -400,6 +589,13 @@ TimerEventScheduler::TimerEventScheduler(
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
 }
 
@@ -426,6 +622,13 @@ TimerEventScheduler::TimerEventScheduler(
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(clockType)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
 }
 
@@ -453,6 +656,13 @@ TimerEventScheduler::TimerEventScheduler(int               numEvents,
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
     BSLS_ASSERT(numEvents < (1 << 24) - 1);
     BSLS_ASSERT(numClocks < (1 << 24) - 1);
@@ -485,6 +695,13 @@ TimerEventScheduler::TimerEventScheduler(
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(clockType)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
     BSLS_ASSERT(numEvents < (1 << 24) - 1);
     BSLS_ASSERT(numClocks < (1 << 24) - 1);
@@ -517,6 +734,13 @@ TimerEventScheduler::TimerEventScheduler(
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
     BSLS_ASSERT(numEvents < (1 << 24) - 1);
     BSLS_ASSERT(numClocks < (1 << 24) - 1);
@@ -549,11 +773,160 @@ TimerEventScheduler::TimerEventScheduler(
 , d_numEvents(0)
 , d_numClocks(0)
 , d_clockType(clockType)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(0)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
 {
     BSLS_ASSERT(numEvents < (1 << 24) - 1);
     BSLS_ASSERT(numClocks < (1 << 24) - 1);
 }
 
+TimerEventScheduler::TimerEventScheduler(
+                                              ThreadPool       *threadPool,
+                                              int               maxBatchSize,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(
+                                            bsls::SystemClockType::e_REALTIME))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clockTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clocks(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_threadPool_p(threadPool)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(maxBatchSize)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
+{
+    BSLS_ASSERT(0 != threadPool);
+    BSLS_ASSERT(1 <= maxBatchSize);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+                                   ThreadPool                  *threadPool,
+                                   int                          maxBatchSize,
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clockTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+, d_threadPool_p(threadPool)
+, d_fixedThreadPool_p(0)
+, d_maxBatchSize(maxBatchSize)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
+{
+    BSLS_ASSERT(0 != threadPool);
+    BSLS_ASSERT(1 <= maxBatchSize);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+                                              FixedThreadPool  *threadPool,
+                                              int               maxBatchSize,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(
+                                            bsls::SystemClockType::e_REALTIME))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clockTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clocks(basicAllocator)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(bsls::SystemClockType::e_REALTIME)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(threadPool)
+, d_maxBatchSize(maxBatchSize)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
+{
+    BSLS_ASSERT(0 != threadPool);
+    BSLS_ASSERT(1 <= maxBatchSize);
+}
+
+TimerEventScheduler::TimerEventScheduler(
+                                   FixedThreadPool             *threadPool,
+                                   int                          maxBatchSize,
+                                   bsls::SystemClockType::Enum  clockType,
+                                   bslma::Allocator            *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_currentTimeFunctor(bsl::allocator_arg_t(), basicAllocator,
+                       createDefaultCurrentTimeFunctor(clockType))
+, d_clockDataAllocator(sizeof(TimerEventScheduler::ClockData), basicAllocator)
+, d_eventTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clockTimeQueue(NUM_INDEX_BITS_DEFAULT, basicAllocator)
+, d_clocks(basicAllocator)
+, d_condition(clockType)
+, d_dispatcherFunctor(bsl::allocator_arg_t(), basicAllocator,
+                      &defaultDispatcherFunction)
+, d_dispatcherId(0)
+, d_dispatcherThread(bslmt::ThreadUtil::invalidHandle())
+, d_running(0)
+, d_iterations(0)
+, d_pendingEventItems(basicAllocator)
+, d_currentEventIndex(-1)
+, d_numEvents(0)
+, d_numClocks(0)
+, d_clockType(clockType)
+, d_threadPool_p(0)
+, d_fixedThreadPool_p(threadPool)
+, d_maxBatchSize(maxBatchSize)
+, d_numPendingBatches(0)
+, d_numDispatchedEvents(0)
+, d_totalLateness(0)
+, d_maxLateness(0)
+{
+    BSLS_ASSERT(0 != threadPool);
+    BSLS_ASSERT(1 <= maxBatchSize);
+}
+
 TimerEventScheduler::~TimerEventScheduler()
 {
     stop();
@@ -618,6 +991,14 @@ void TimerEventScheduler::stop()
     }
 
     bslmt::ThreadUtil::join(d_dispatcherThread);
+
+    // Wait for the batches enqueued to the executor, which refer to this
+    // scheduler, to finish running.
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+    while (0 < d_numPendingBatches) {
+        d_batchCondition.wait(&d_mutex);
+    }
 }
 
 TimerEventScheduler::Handle
@@ -822,6 +1203,28 @@ void TimerEventScheduler::cancelAllClocks(bool wait)
     }
 }
 
+void TimerEventScheduler::resetStatistics()
+{
+    d_numDispatchedEvents = 0;
+    d_totalLateness       = 0;
+    d_maxLateness         = 0;
+}
+
+// ACCESSORS
+bsls::TimeInterval TimerEventScheduler::maxLateness() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_maxLateness);
+    return result;
+}
+
+bsls::TimeInterval TimerEventScheduler::totalLateness() const
+{
+    bsls::TimeInterval result;
+    result.addMicroseconds(d_totalLateness);
+    return result;
+}
+
                   // ---------------------------------------
                   // class TimerEventSchedulerTestTimeSource
                   // ---------------------------------------
@@ -84,6 +84,48 @@ BSLS_IDENT("$Id: $")
 // thread to run the callbacks).  In that case, the user-supplied functor will
 // still be run in the dispatcher thread, different from the scheduler thread.
 //
+///Dispatching Events to a Thread Pool
+///-----------------------------------
+// A scheduler constructed with a 'bdlmt::ThreadPool' or a
+// 'bdlmt::FixedThreadPool' (called the *executor*) does not run callbacks in
+// the dispatcher thread.  Instead, in each dispatcher cycle, the dispatcher
+// thread collects the callbacks of all expired events and clocks, in time
+// order, into batches of at most 'maxBatchSize' callbacks, and enqueues each
+// batch as a single job to the executor, which invokes the callbacks of the
+// batch in order.  Therefore, a slow callback delays only the callbacks that
+// follow it in its batch, and a 'maxBatchSize' of 1 hands each callback to
+// the executor separately, while larger batches amortize the cost of
+// enqueuing a job over several short callbacks.  If the executor does not
+// accept a batch (e.g., because it has been stopped), the batch is executed
+// in the dispatcher thread.
+//
+// Note that, when an executor is used, callbacks may run concurrently with
+// each other (including successive callbacks of the same clock, if one of
+// them runs longer than the clock's interval), the guarantee that events are
+// processed in increasing time order holds only for the order in which they
+// are handed to the executor, and the 'wait' argument of the 'cancel' and
+// 'reschedule' methods ensures only that the dispatcher thread has handed off
+// the corresponding event, not that its callback has completed.  The executor
+// is held, not owned.  Since the jobs enqueued to the executor refer to the
+// scheduler, 'stop' (and therefore the destructor) waits until every batch
+// handed to the executor has either been run or been discarded by the
+// executor (e.g., by its 'shutdown' method), so a callback run by the
+// executor must not call 'stop' on its own scheduler, and the executor must
+// keep processing its jobs while a scheduler using it is being stopped.
+//
+///Lateness Statistics
+///-------------------
+// Every scheduler measures, for each callback of an event or clock that it
+// dispatches, the *lateness* of that callback: the time at which the callback
+// is invoked (or, if a dispatcher functor was supplied at construction, is
+// passed to that functor) minus the time for which it was scheduled.  The
+// number of dispatched callbacks, and the total and maximum of their
+// lateness, are available through the 'numDispatchedEvents', 'totalLateness',
+// and 'maxLateness' accessors, and may be reset with 'resetStatistics'.  When
+// an executor is used, lateness includes the time a batch spends in the queue
+// of the executor, and the time spent running the preceding callbacks of the
+// same batch.
+//
 ///Thread Safety
 ///-------------
 // The 'bdlmt::TimerEventScheduler' class is both *fully thread-safe* (i.e.,
@@ -331,6 +373,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomic.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
@@ -340,6 +383,8 @@ namespace BloombergLP {
 
 namespace bdlmt {
 
+class  FixedThreadPool;
+class  ThreadPool;
 struct TimerEventSchedulerDispatcher;
 class  TimerEventSchedulerTestTimeSource_Data;
 
@@ -498,6 +543,35 @@ class TimerEventScheduler {
     bsls::SystemClockType::Enum
                       d_clockType;          // clock type used
 
+    ThreadPool       *d_threadPool_p;       // executor for callbacks, or 0
+                                            // (held, not owned)
+
+    FixedThreadPool  *d_fixedThreadPool_p;  // executor for callbacks, or 0
+                                            // (held, not owned)
+
+    int               d_maxBatchSize;       // maximum number of callbacks in
+                                            // a job enqueued to the executor
+
+    int               d_numPendingBatches;  // number of batches of
+                                            // callbacks for the executor
+                                            // that have not been destroyed
+                                            // (guarded by 'd_mutex')
+
+    bslmt::Condition  d_batchCondition;     // signaled when
+                                            // 'd_numPendingBatches' drops to
+                                            // 0
+
+    bsls::AtomicInt64 d_numDispatchedEvents;
+                                            // number of callbacks dispatched
+
+    bsls::AtomicInt64 d_totalLateness;      // total lateness, in
+                                            // microseconds, of the dispatched
+                                            // callbacks
+
+    bsls::AtomicInt64 d_maxLateness;        // maximum lateness, in
+                                            // microseconds, of a dispatched
+                                            // callback
+
     // NOT IMPLEMENTED
     TimerEventScheduler(const TimerEventScheduler& original);
     TimerEventScheduler& operator=(const TimerEventScheduler& rhs);
@@ -508,6 +582,11 @@ class TimerEventScheduler {
 
   private:
     // PRIVATE MANIPULATORS
+    void recordLateness(const bsls::TimeInterval& scheduledTime);
+        // Update the lateness statistics of this scheduler to reflect that a
+        // callback scheduled for the specified 'scheduledTime' is being
+        // dispatched now.
+
     void yieldToDispatcher();
         // Repeatedly wake up dispatcher thread until it noticeably starts
         // running.
@@ -628,9 +707,40 @@ class TimerEventScheduler {
         // installed default allocator is used.  The behavior is undefined
         // unless '0 <= numEvents < 2**24' and '0 <= numClocks < 2**24'.
 
+    TimerEventScheduler(ThreadPool       *threadPool,
+                        int               maxBatchSize,
+                        bslma::Allocator *basicAllocator = 0);
+    TimerEventScheduler(ThreadPool                  *threadPool,
+                        int                          maxBatchSize,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+    TimerEventScheduler(FixedThreadPool  *threadPool,
+                        int               maxBatchSize,
+                        bslma::Allocator *basicAllocator = 0);
+    TimerEventScheduler(FixedThreadPool             *threadPool,
+                        int                          maxBatchSize,
+                        bsls::SystemClockType::Enum  clockType,
+                        bslma::Allocator            *basicAllocator = 0);
+        // Construct an event scheduler that hands the callbacks of expired
+        // events and clocks to the specified 'threadPool' in jobs of at most
+        // the specified 'maxBatchSize' callbacks (see {Dispatching Events to a
+        // Thread Pool} in the component documentation).  Optionally specify a
+        // 'clockType' indicating the epoch used for all time intervals (see
+        // {Supported Clock-Types} in the component documentation); if
+        // 'clockType' is not specified, the realtime clock epoch is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 != threadPool' and
+        // '1 <= maxBatchSize'.  Note that the maximal number of scheduled
+        // non-recurring events and recurring events defaults to an
+        // implementation defined constant.
+
     ~TimerEventScheduler();
         // Stop this scheduler, discard all the unprocessed events and destroy
-        // this object.
+        // this object.  If this scheduler has an executor, wait until every
+        // batch of callbacks handed to the executor has been run or
+        // discarded.  The behavior is undefined if this method is invoked
+        // from a callback run by the executor of this scheduler.
 
     // MANIPULATORS
     int start();
@@ -662,9 +772,13 @@ class TimerEventScheduler {
         // End the dispatching of events on this scheduler (but do not remove
         // any pending events), and wait for any (one) currently executing
         // event to complete.  If the scheduler is already stopped then this
-        // method has no effect.  This scheduler can be restarted by invoking
-        // 'start'.  The behavior is undefined if this method is invoked from
-        // the dispatcher thread.
+        // method has no effect.  If this scheduler has an executor, also wait
+        // until every batch of callbacks handed to the executor has been run
+        // or discarded (see {Dispatching Events to a Thread Pool} in the
+        // component documentation).  This scheduler can be restarted by
+        // invoking 'start'.  The behavior is undefined if this method is
+        // invoked from the dispatcher thread, or from a callback run by the
+        // executor of this scheduler.
 
     Handle scheduleEvent(const bsls::TimeInterval&    time,
                          const bsl::function<void()>& callback,
@@ -752,11 +866,25 @@ class TimerEventScheduler {
         // method is being invoked from the dispatcher thread, then the 'wait'
         // is ignored to avoid deadlock.
 
+    void resetStatistics();
+        // Reset to 0 the number of dispatched callbacks, and the total and
+        // maximum lateness, of this scheduler.
+
     // ACCESSORS
     bsls::SystemClockType::Enum clockType() const;
         // Return the value of the clock type that this object was created
         // with.
 
+    int maxBatchSize() const;
+        // Return the maximum number of callbacks in a job enqueued by this
+        // scheduler to its executor, or 0 if this scheduler was not
+        // constructed with an executor.
+
+    bsls::TimeInterval maxLateness() const;
+        // Return the maximum lateness of a callback dispatched by this
+        // scheduler since it was created or its statistics were last reset
+        // (see {Lateness Statistics} in the component documentation).
+
     bsls::TimeInterval now() const;
         // Return the current epoch time, an absolute time represented as an
         // interval from some epoch, which is determined by the clock indicated
@@ -767,9 +895,20 @@ class TimerEventScheduler {
         // Return a *snapshot* of the number of registered clocks with this
         // scheduler.
 
+    bsls::Types::Int64 numDispatchedEvents() const;
+        // Return the number of callbacks of events and clocks dispatched by
+        // this scheduler since it was created or its statistics were last
+        // reset.
+
     int numEvents() const;
         // Return a *snapshot* of the number of pending events and events being
         // dispatched in this scheduler.
+
+    bsls::TimeInterval totalLateness() const;
+        // Return the total lateness of the callbacks dispatched by this
+        // scheduler since it was created or its statistics were last reset
+        // (see {Lateness Statistics} in the component documentation).  Note
+        // that the mean lateness is 'totalLateness() / numDispatchedEvents()'.
 };
 
                   // =======================================
@@ -861,12 +1000,24 @@ bsls::TimeInterval TimerEventScheduler::now() const
     return d_currentTimeFunctor();
 }
 
+inline
+int TimerEventScheduler::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
 inline
 int TimerEventScheduler::numClocks() const
 {
     return d_numClocks;
 }
 
+inline
+bsls::Types::Int64 TimerEventScheduler::numDispatchedEvents() const
+{
+    return d_numDispatchedEvents;
+}
+
 inline
 int TimerEventScheduler::numEvents() const
 {
@@ -9,6 +9,9 @@
 
 #include <bdlmt_timereventscheduler.h>
 
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
 #include <bslim_testutil.h>
 
 #include <bslma_testallocator.h>
@@ -17,6 +20,8 @@
 #include <bsls_review.h>
 
 #include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_threadgroup.h>
 
 #include <bdlf_bind.h>
@@ -45,6 +50,7 @@
 #include <bsl_iostream.h>
 #include <bsl_list.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 
 using namespace BloombergLP;
@@ -106,8 +112,14 @@ using bsl::flush;
 // [23] bdlmt::TimerEventScheduler(nE, nC, disp, bA = 0);
 // [24] bdlmt::TimerEventScheduler(nE, nC, disp, cT, bA = 0);
 //
+// [29] bdlmt::TimerEventScheduler(ThreadPool *, mBS, bA = 0);
+// [29] bdlmt::TimerEventScheduler(ThreadPool *, mBS, cT, bA = 0);
+// [29] bdlmt::TimerEventScheduler(FixedThreadPool *, mBS, bA = 0);
+// [29] bdlmt::TimerEventScheduler(FixedThreadPool *, mBS, cT, bA = 0);
+//
 //
 // [01] ~bdlmt::TimerEventScheduler();
+// [29] ~bdlmt::TimerEventScheduler();
 //
 // MANIPULATORS
 // [09] int start();
@@ -115,6 +127,7 @@ using bsl::flush;
 // [16] int start(const bslmt::ThreadAttributes& threadAttributes);
 //
 // [09] void stop();
+// [29] void stop();
 //
 // [02] Handle scheduleEvent(time, callback);
 //
@@ -133,9 +146,15 @@ using bsl::flush;
 //
 // [06] void cancelAllClocks(bool wait=false);
 //
+// [29] void resetStatistics();
+//
 // ACCESSORS
 // [25] bsls::SystemClockType::Enum clockType();
+// [29] int maxBatchSize() const;
+// [29] bsls::TimeInterval maxLateness() const;
 // [27] bsls::TimeInterval now();
+// [29] bsls::Types::Int64 numDispatchedEvents() const;
+// [29] bsls::TimeInterval totalLateness() const;
 // ----------------------------------------------------------------------------
 // [01] BREATHING TEST
 // [28] DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
@@ -143,7 +162,8 @@ using bsl::flush;
 // [10] TESTING CONCURRENT SCHEDULING AND CANCELLING
 // [11] TESTING CONCURRENT SCHEDULING AND CANCELLING-ALL
 // [26] CLOCK-REPLACEMENT BREATHING TEST
-// [29] USAGE EXAMPLE
+// [29] DISPATCHING TO A THREAD POOL AND LATENESS STATISTICS
+// [30] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -784,6 +804,97 @@ void my_Server::dataAvailable(my_Server::Connection *connection,
 
 }  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_USAGE
 
+// ============================================================================
+//                         CASE 29 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29
+{
+
+class Recorder {
+    // This class records, in a thread-safe manner, the identifiers of the
+    // callbacks that have been invoked, in the order of their invocations.
+
+    // DATA
+    mutable bslmt::Mutex d_mutex;
+    bsl::vector<int>     d_ids;
+
+  public:
+    // MANIPULATORS
+    void record(int id)
+        // Record the specified 'id'.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_ids.push_back(id);
+    }
+
+    // ACCESSORS
+    bsl::vector<int> ids() const
+        // Return the recorded identifiers.
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_ids;
+    }
+};
+
+void blockAndRecord(bslmt::Semaphore *started,
+                    bslmt::Semaphore *release,
+                    Recorder         *recorder,
+                    int               id)
+    // Post to the specified 'started' semaphore, wait on the specified
+    // 'release' semaphore, then record the specified 'id' in the specified
+    // 'recorder'.
+{
+    started->post();
+    release->wait();
+    recorder->record(id);
+}
+
+void recordAndPost(Recorder              *recorder,
+                   int                    id,
+                   bslmt::TimedSemaphore *done)
+    // Record the specified 'id' in the specified 'recorder', then post to the
+    // specified 'done' semaphore.
+{
+    recorder->record(id);
+    done->post();
+}
+
+bool waitForNumPendingJobs(const bdlmt::ThreadPool& pool, int numJobs)
+    // Wait for at most five seconds until the specified 'pool' has the
+    // specified 'numJobs' pending jobs.  Return 'true' if it does, and
+    // 'false' otherwise.
+{
+    for (int i = 0; i < 5000 && numJobs != pool.numPendingJobs(); ++i) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+    return numJobs == pool.numPendingJobs();
+}
+
+bool waitForNumDispatchedEvents(const Obj& scheduler, int numEvents)
+    // Wait for at most five seconds until the specified 'scheduler' has
+    // dispatched the specified 'numEvents' callbacks.  Return 'true' if it
+    // has, and 'false' otherwise.
+{
+    for (int i = 0; i < 5000 && numEvents != scheduler.numDispatchedEvents();
+                                                                         ++i) {
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+    return numEvents == scheduler.numDispatchedEvents();
+}
+
+extern "C" {
+void *postAfterDelay(void *semaphore)
+    // Sleep for a tenth of a second, then post to the specified 'semaphore',
+    // which is a 'bslmt::Semaphore'.
+{
+    bslmt::ThreadUtil::microSleep(100 * 1000);
+    static_cast<bslmt::Semaphore *>(semaphore)->post();
+    return 0;
+}
+} // extern "C"
+
+}  // close namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29
+
 // ============================================================================
 //                         CASE 20 RELATED ENTITIES
 // ----------------------------------------------------------------------------
@@ -2751,7 +2862,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE:
         //
@@ -2776,6 +2887,356 @@ int main(int argc, char *argv[])
         my_Server server(bsls::TimeInterval(10), &ta);
 
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // DISPATCHING TO A THREAD POOL AND LATENESS STATISTICS
+        //
+        // Concerns:
+        //: 1 A scheduler constructed with a thread pool runs the callbacks of
+        //:   events and clocks in that pool, so that a blocked callback does
+        //:   not delay the callbacks of later events.
+        //:
+        //: 2 Expired callbacks are handed to the pool, in time order, in jobs
+        //:   of at most 'maxBatchSize' callbacks.
+        //:
+        //: 3 A batch not accepted by the pool is executed by the dispatcher
+        //:   thread.
+        //:
+        //: 4 The number of dispatched callbacks, and their total and maximum
+        //:   lateness, are maintained by every scheduler, and are reset by
+        //:   'resetStatistics'.
+        //:
+        //: 5 'stop' waits until the batches handed to the pool have been run
+        //:   or discarded by the pool, so that the scheduler may be destroyed
+        //:   as soon as 'stop' returns.
+        //
+        // Plan:
+        //: 1 Using a thread pool having two threads and a 'maxBatchSize' of
+        //:   1, schedule an event whose callback blocks, and a later event,
+        //:   and verify that the later event is executed while the first is
+        //:   blocked.  (C-1)
+        //:
+        //: 2 Using a test time source and a thread pool having one thread,
+        //:   block the pool with a first event, then make 7 events expire at
+        //:   once with a 'maxBatchSize' of 3, and verify that 3 jobs are
+        //:   enqueued to the pool, and that the callbacks execute in time
+        //:   order.  (C-2)
+        //:
+        //: 3 Start a clock on a scheduler using a 'FixedThreadPool', and
+        //:   verify that it is invoked repeatedly.  (C-1)
+        //:
+        //: 4 Schedule an event on a scheduler using a thread pool that has
+        //:   not been started, and verify that the event is executed.  (C-3)
+        //:
+        //: 5 Using a test time source, dispatch events a known amount of time
+        //:   after their scheduled times, and verify the statistics before
+        //:   and after calling 'resetStatistics'.  (C-4)
+        //:
+        //: 6 Using a thread pool having one thread, block the pool with a
+        //:   first event while a second event is queued to the pool.  Release
+        //:   the first event from another thread after a delay, call 'stop',
+        //:   and verify that both callbacks have run when 'stop' returns.
+        //:   Repeat, but cancel the queued job with 'shutdown' on the pool,
+        //:   and verify that 'stop' returns.  (C-5)
+        //
+        // Testing:
+        //   bdlmt::TimerEventScheduler(ThreadPool *, mBS, bA = 0);
+        //   bdlmt::TimerEventScheduler(ThreadPool *, mBS, cT, bA = 0);
+        //   bdlmt::TimerEventScheduler(FixedThreadPool *, mBS, bA = 0);
+        //   bdlmt::TimerEventScheduler(FixedThreadPool *, mBS, cT, bA = 0);
+        //   ~bdlmt::TimerEventScheduler();
+        //   void stop();
+        //   void resetStatistics();
+        //   int maxBatchSize() const;
+        //   bsls::TimeInterval maxLateness() const;
+        //   bsls::Types::Int64 numDispatchedEvents() const;
+        //   bsls::TimeInterval totalLateness() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << "DISPATCHING TO A THREAD POOL AND LATENESS STATISTICS\n"
+                 << "====================================================\n";
+        }
+
+        using namespace TIMER_EVENT_SCHEDULER_TEST_CASE_29;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        const bsls::SystemClockType::Enum monotonic =
+                                            bsls::SystemClockType::e_MONOTONIC;
+
+        if (verbose) cout << "Accessors\n";
+        {
+            bdlmt::ThreadPool      pool(bslmt::ThreadAttributes(), 1, 1, 100);
+            bdlmt::FixedThreadPool fixedPool(1, 10);
+
+            Obj mW(&ta);                          const Obj& W = mW;
+            Obj mX(&pool, 3, &ta);                const Obj& X = mX;
+            Obj mY(&pool, 4, monotonic, &ta);     const Obj& Y = mY;
+            Obj mZ(&fixedPool, 5, monotonic, &ta);
+            const Obj& Z = mZ;
+
+            ASSERT(0 == W.maxBatchSize());
+            ASSERT(3 == X.maxBatchSize());
+            ASSERT(4 == Y.maxBatchSize());
+            ASSERT(5 == Z.maxBatchSize());
+
+            ASSERT(bsls::SystemClockType::e_REALTIME == X.clockType());
+            ASSERT(monotonic                         == Y.clockType());
+            ASSERT(monotonic                         == Z.clockType());
+
+            ASSERT(0                    == X.numDispatchedEvents());
+            ASSERT(bsls::TimeInterval() == X.totalLateness());
+            ASSERT(bsls::TimeInterval() == X.maxLateness());
+        }
+
+        if (verbose) cout << "A blocked callback does not delay others\n";
+        {
+            bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 2, 2, 100, &ta);
+            ASSERT(0 == pool.start());
+
+            Recorder              recorder;
+            bslmt::Semaphore      started;
+            bslmt::Semaphore      release;
+            bslmt::TimedSemaphore done;
+
+            Obj mX(&pool, 1, &ta);
+
+            const bsls::TimeInterval T = mX.now();
+            mX.scheduleEvent(T,
+                             bdlf::BindUtil::bind(&blockAndRecord,
+                                                  &started,
+                                                  &release,
+                                                  &recorder,
+                                                  1));
+            mX.scheduleEvent(T + bsls::TimeInterval(0, 10 * 1000 * 1000),
+                             bdlf::BindUtil::bind(&recordAndPost,
+                                                  &recorder,
+                                                  2,
+                                                  &done));
+            ASSERT(0 == mX.start());
+
+            started.wait();
+            ASSERT(0 == done.timedWait(bsls::SystemTime::nowRealtimeClock()
+                                                                         + 5));
+            release.post();
+
+            mX.stop();
+            pool.stop();
+
+            const bsl::vector<int> ids = recorder.ids();
+            ASSERTV(ids.size(), 2 == ids.size());
+            if (2 == ids.size()) {
+                ASSERT(2 == ids[0]);
+                ASSERT(1 == ids[1]);
+            }
+            ASSERT(2 == mX.numDispatchedEvents());
+        }
+
+        if (verbose) cout << "Callbacks are handed off in batches\n";
+        {
+            bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 1, 1, 100, &ta);
+            ASSERT(0 == pool.start());
+
+            Recorder              recorder;
+            bslmt::Semaphore      started;
+            bslmt::Semaphore      release;
+            bslmt::TimedSemaphore done;
+
+            Obj mX(&pool, 3, &ta);
+
+            bdlmt::TimerEventSchedulerTestTimeSource timeSource(&mX);
+
+            const bsls::TimeInterval T = timeSource.now();
+            mX.scheduleEvent(T + 1,
+                             bdlf::BindUtil::bind(&blockAndRecord,
+                                                  &started,
+                                                  &release,
+                                                  &recorder,
+                                                  0));
+            for (int i = 1; i <= 7; ++i) {
+                mX.scheduleEvent(T + 2 + bsls::TimeInterval(0, i * 1000),
+                                 bdlf::BindUtil::bind(&recordAndPost,
+                                                      &recorder,
+                                                      i,
+                                                      &done));
+            }
+            ASSERT(0 == mX.start());
+
+            timeSource.advanceTime(bsls::TimeInterval(1));
+            started.wait();
+
+            timeSource.advanceTime(bsls::TimeInterval(2));
+            ASSERT(waitForNumPendingJobs(pool, 3));
+
+            release.post();
+            for (int i = 1; i <= 7; ++i) {
+                done.wait();
+            }
+
+            mX.stop();
+            pool.stop();
+
+            const bsl::vector<int> ids = recorder.ids();
+            ASSERTV(ids.size(), 8 == ids.size());
+            for (int i = 0; i < (int) ids.size(); ++i) {
+                ASSERTV(i, ids[i], i == ids[i]);
+            }
+            ASSERT(8 == mX.numDispatchedEvents());
+        }
+
+        if (verbose) cout << "Clocks on a 'FixedThreadPool'\n";
+        {
+            bdlmt::FixedThreadPool pool(2, 100, &ta);
+            ASSERT(0 == pool.start());
+
+            Recorder              recorder;
+            bslmt::TimedSemaphore done;
+
+            Obj mX(&pool, 2, monotonic, &ta);
+
+            Handle h = mX.startClock(bsls::TimeInterval(0, 10 * 1000 * 1000),
+                                     bdlf::BindUtil::bind(&recordAndPost,
+                                                          &recorder,
+                                                          1,
+                                                          &done));
+            ASSERT(0 == mX.start());
+
+            for (int i = 0; i < 5; ++i) {
+                done.wait();
+            }
+
+            ASSERT(0 == mX.cancelClock(h, true));
+            mX.stop();
+            pool.stop();
+
+            ASSERT(5 <= mX.numDispatchedEvents());
+        }
+
+        if (verbose) cout << "Batches not accepted by the pool\n";
+        {
+            bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 1, 1, 100, &ta);
+
+            Recorder              recorder;
+            bslmt::TimedSemaphore done;
+
+            Obj mX(&pool, 2, &ta);
+
+            mX.scheduleEvent(mX.now(),
+                             bdlf::BindUtil::bind(&recordAndPost,
+                                                  &recorder,
+                                                  1,
+                                                  &done));
+            ASSERT(0 == mX.start());
+
+            done.wait();
+            mX.stop();
+
+            ASSERT(1 == recorder.ids().size());
+            ASSERT(1 == mX.numDispatchedEvents());
+        }
+
+        if (verbose) cout << "Lateness statistics\n";
+        {
+            bdlmt::ThreadPool pool(bslmt::ThreadAttributes(), 1, 1, 100, &ta);
+            ASSERT(0 == pool.start());
+
+            Obj mX(&ta);                const Obj& X = mX;
+            Obj mY(&pool, 1, &ta);      const Obj& Y = mY;
+
+            bdlmt::TimerEventSchedulerTestTimeSource xTimeSource(&mX);
+            bdlmt::TimerEventSchedulerTestTimeSource yTimeSource(&mY);
+
+            const bsls::TimeInterval TX = xTimeSource.now();
+            const bsls::TimeInterval TY = yTimeSource.now();
+
+            mX.scheduleEvent(TX + 1, noop);
+            mX.scheduleEvent(TX + 2, noop);
+            mY.scheduleEvent(TY + 1, noop);
+            mY.scheduleEvent(TY + 2, noop);
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mY.start());
+
+            xTimeSource.advanceTime(bsls::TimeInterval(5));
+            yTimeSource.advanceTime(bsls::TimeInterval(5));
+
+            ASSERT(waitForNumDispatchedEvents(X, 2));
+            ASSERT(waitForNumDispatchedEvents(Y, 2));
+
+            mX.stop();
+            mY.stop();
+            pool.stop();
+
+            ASSERTV(X.totalLateness(), bsls::TimeInterval(7) ==
+                                                          X.totalLateness());
+            ASSERTV(X.maxLateness(),   bsls::TimeInterval(4) ==
+                                                            X.maxLateness());
+            ASSERTV(Y.totalLateness(), bsls::TimeInterval(7) ==
+                                                          Y.totalLateness());
+            ASSERTV(Y.maxLateness(),   bsls::TimeInterval(4) ==
+                                                            Y.maxLateness());
+
+            mX.resetStatistics();
+
+            ASSERT(0                    == X.numDispatchedEvents());
+            ASSERT(bsls::TimeInterval() == X.totalLateness());
+            ASSERT(bsls::TimeInterval() == X.maxLateness());
+            ASSERT(2                    == Y.numDispatchedEvents());
+        }
+
+        if (verbose) cout << "'stop' waits for the batches in the pool\n";
+        {
+            for (int discard = 0; discard < 2; ++discard) {
+                bdlmt::ThreadPool pool(bslmt::ThreadAttributes(),
+                                       1,
+                                       1,
+                                       100,
+                                       &ta);
+                ASSERT(0 == pool.start());
+
+                Recorder              recorder;
+                bslmt::Semaphore      started;
+                bslmt::Semaphore      release;
+                bslmt::TimedSemaphore done;
+
+                Obj mX(&pool, 1, &ta);
+
+                const bsls::TimeInterval T = mX.now();
+                mX.scheduleEvent(T,
+                                 bdlf::BindUtil::bind(&blockAndRecord,
+                                                      &started,
+                                                      &release,
+                                                      &recorder,
+                                                      1));
+                mX.scheduleEvent(T,
+                                 bdlf::BindUtil::bind(&recordAndPost,
+                                                      &recorder,
+                                                      2,
+                                                      &done));
+                ASSERT(0 == mX.start());
+
+                started.wait();
+                ASSERT(waitForNumPendingJobs(pool, 1));
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      &postAfterDelay,
+                                                      &release));
+
+                if (discard) {
+                    pool.shutdown();
+                }
+                mX.stop();
+
+                ASSERTV(discard, recorder.ids().size(),
+                        2 - discard == (int) recorder.ids().size());
+
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                pool.stop();
+            }
+        }
+      } break;
       case 28: {
         // --------------------------------------------------------------------
         // DRQS 150475152: AFTER TEST TIME SOURCE DESTRUCTION
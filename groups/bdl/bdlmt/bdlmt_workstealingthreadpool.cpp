@@ -0,0 +1,524 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_cstdlib.h>
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // ===================================
+                    // class WorkStealingThreadPool_Worker
+                    // ===================================
+
+class WorkStealingThreadPool_Worker {
+    // This class holds the job queue, and the state needed to steal from the
+    // job queues of other threads, of one processing thread of a
+    // 'WorkStealingThreadPool'.  The queue is accessed from the back by its
+    // owning thread and from the front by stealing threads.
+
+    // PRIVATE CONSTANTS
+    enum { k_CACHE_LINE_SIZE = 64 };
+
+  public:
+    // DATA
+    bslmt::Mutex                                d_mutex;  // protects 'd_jobs'
+
+    bsl::deque<WorkStealingThreadPool::Job>     d_jobs;   // pending jobs
+
+    bsls::AtomicInt                             d_size;   // number of jobs in
+                                                          // 'd_jobs', readable
+                                                          // without the lock
+
+    unsigned int                                d_seed;   // state used to
+                                                          // select a victim,
+                                                          // accessed only by
+                                                          // the owning thread
+
+    WorkStealingThreadPool                     *d_pool_p; // owning pool (held,
+                                                          // not owned)
+
+    char                                        d_pad[k_CACHE_LINE_SIZE];
+                                                          // prevents false
+                                                          // sharing with the
+                                                          // next worker
+
+    // CREATORS
+    WorkStealingThreadPool_Worker(WorkStealingThreadPool *pool,
+                                  unsigned int            seed,
+                                  bslma::Allocator       *basicAllocator)
+        // Create a worker for the specified 'pool' using the specified 'seed'
+        // to select steal victims, and the specified 'basicAllocator' to
+        // supply memory.
+    : d_jobs(basicAllocator)
+    , d_size(0)
+    , d_seed(seed ? seed : 1)
+    , d_pool_p(pool)
+    {
+    }
+
+    // CLASS METHODS
+    static void run(WorkStealingThreadPool_Worker *worker)
+        // Process jobs on behalf of the specified 'worker' until its pool is
+        // stopped.
+    {
+        worker->d_pool_p->workerThread(worker);
+    }
+
+    // MANIPULATORS
+    unsigned int nextRandom()
+        // Return the next value of a (xorshift) pseudo-random sequence.
+    {
+        d_seed ^= d_seed << 13;
+        d_seed ^= d_seed >> 17;
+        d_seed ^= d_seed << 5;
+        return d_seed;
+    }
+};
+
+}  // close package namespace
+
+extern "C" void *bdlmt_WorkStealingThreadPool_threadEntry(void *arg)
+    // Entry point for processing threads.  The specified 'arg' is the address
+    // of the 'WorkStealingThreadPool_Worker' served by the thread.
+{
+    bdlmt::WorkStealingThreadPool_Worker::run(
+                     static_cast<bdlmt::WorkStealingThreadPool_Worker *>(arg));
+    return 0;
+}
+
+namespace bdlmt {
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::clearQueues()
+{
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        Worker *worker = d_workers[i];
+
+        bsl::deque<Job> jobs(d_workers.get_allocator().mechanism());
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+            jobs.swap(worker->d_jobs);
+            d_numPendingJobs.add(-worker->d_size.swap(0));
+        }
+
+        // The jobs are destroyed here, without holding the lock, since they
+        // might have objects bound with non-trivial destructors.
+    }
+}
+
+void WorkStealingThreadPool::init(int numThreads)
+{
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+
+    bslma::Allocator *allocator = d_workers.get_allocator().mechanism();
+
+    d_workers.reserve(numThreads);
+    d_handles.reserve(numThreads);
+    for (int i = 0; i < numThreads; ++i) {
+        d_workers.push_back(new (*allocator) Worker(
+                                       this,
+                                       static_cast<unsigned int>(i) * 7919 + 1,
+                                       allocator));
+    }
+
+    // The processing threads are joined by 'stop' and 'shutdown'.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigfillset(&d_blockSet);
+
+    static const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+    static const int SIZE =
+                        sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(&d_blockSet, synchronousSignals[i]);
+    }
+#endif
+}
+
+void WorkStealingThreadPool::jobEnqueued()
+{
+    // 'd_numPendingJobs' and 'd_numSleeping' are modified and read with
+    // sequentially consistent operations so that either this thread observes
+    // a sleeping thread, or the sleeping thread observes the new job before
+    // blocking.
+
+    if (d_numSleeping.load()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_wakeCondition.signal();
+    }
+}
+
+void WorkStealingThreadPool::joinThreads()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_wakeCondition.broadcast();
+        d_drainCondition.broadcast();
+    }
+
+    for (bsl::size_t i = 0; i < d_handles.size(); ++i) {
+        bslmt::ThreadUtil::join(d_handles[i]);
+    }
+    d_handles.clear();
+    d_numThreadsStarted.storeRelease(0);
+}
+
+bool WorkStealingThreadPool::popJob(Job *job, Worker *self)
+{
+    // First, take the most recently submitted job of the calling thread.
+
+    if (self->d_size.loadAcquire()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&self->d_mutex);
+        if (!self->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(self->d_jobs.back());
+            self->d_jobs.pop_back();
+            self->d_size.storeRelease(static_cast<int>(self->d_jobs.size()));
+
+            d_numActiveThreads.add(1);
+            d_numPendingJobs.add(-1);
+            return true;                                              // RETURN
+        }
+    }
+
+    // Then, steal the oldest job of another thread, starting from a randomly
+    // chosen victim.
+
+    const bsl::size_t numWorkers = d_workers.size();
+    const bsl::size_t start      = self->nextRandom() % numWorkers;
+    for (bsl::size_t i = 0; i < numWorkers; ++i) {
+        Worker *victim = d_workers[(start + i) % numWorkers];
+        if (victim == self || 0 == victim->d_size.loadAcquire()) {
+            continue;                                               // CONTINUE
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&victim->d_mutex);
+        if (!victim->d_jobs.empty()) {
+            *job = bslmf::MovableRefUtil::move(victim->d_jobs.front());
+            victim->d_jobs.pop_front();
+            victim->d_size.storeRelease(
+                                      static_cast<int>(victim->d_jobs.size()));
+
+            d_numActiveThreads.add(1);
+            d_numPendingJobs.add(-1);
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+WorkStealingThreadPool::Worker *WorkStealingThreadPool::selectWorker()
+{
+    Worker *worker = static_cast<Worker *>(
+                                bslmt::ThreadUtil::getSpecific(d_workerKey));
+    if (!worker) {
+        worker = d_workers[d_nextWorker.addRelaxed(1) % d_workers.size()];
+    }
+    return worker;
+}
+
+void WorkStealingThreadPool::workerThread(Worker *self)
+{
+    bslmt::ThreadUtil::setSpecific(d_workerKey, self);
+
+    Job job;
+    while (d_running.loadAcquire()) {
+        if (!popJob(&job, self)) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_numSleeping.add(1);
+            while (0 == d_numPendingJobs.load() && d_running.loadAcquire()) {
+                d_wakeCondition.wait(&d_mutex);
+            }
+            d_numSleeping.add(-1);
+            continue;                                               // CONTINUE
+        }
+
+        // Run the job and keep measurements.
+
+        bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+        job();
+        bsls::Types::Int64 finish = bsls::TimeUtil::getTimer();
+        bsls::Types::Int64 lastResetTime = d_lastResetTime.loadRelaxed();
+        d_callbackTime.add(finish - (start < lastResetTime ? lastResetTime
+                                                           : start));
+
+        // The job is cleared before the thread is reported idle, since it
+        // might have objects bound with non-trivial destructors.
+
+        job = Job();
+
+        if (0 == d_numActiveThreads.add(-1) && 0 == d_numPendingJobs.load()) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            d_drainCondition.broadcast();
+        }
+    }
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                          int               numThreads,
+                                          bslma::Allocator *basicAllocator)
+: d_workers(basicAllocator)
+, d_nextWorker(0)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numSleeping(0)
+, d_enabled(1)
+, d_running(0)
+, d_numThreadsStarted(0)
+, d_handles(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_lastResetTime(bsls::TimeUtil::getTimer())  // now
+, d_callbackTime(0)
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    init(numThreads);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                          const bslmt::ThreadAttributes&  threadAttributes,
+                          int                             numThreads,
+                          bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_nextWorker(0)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numSleeping(0)
+, d_enabled(1)
+, d_running(0)
+, d_numThreadsStarted(0)
+, d_handles(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_lastResetTime(bsls::TimeUtil::getTimer())  // now
+, d_callbackTime(0)
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    init(numThreads);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    bslma::Allocator *allocator = d_workers.get_allocator().mechanism();
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        allocator->deleteObject(d_workers[i]);
+    }
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    if (!d_enabled.loadAcquire()) {
+        return -1;                                                    // RETURN
+    }
+
+    Worker *worker = selectWorker();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+        worker->d_jobs.push_back(functor);
+
+        // The job is counted before the lock is released, and so before it
+        // can be popped, so that 'd_numPendingJobs' never becomes negative.
+
+        d_numPendingJobs.add(1);
+        worker->d_size.storeRelease(static_cast<int>(worker->d_jobs.size()));
+    }
+    jobEnqueued();
+    return 0;
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    if (!bslmf::MovableRefUtil::access(functor)) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    if (!d_enabled.loadAcquire()) {
+        return -1;                                                    // RETURN
+    }
+
+    Worker *worker = selectWorker();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&worker->d_mutex);
+        worker->d_jobs.push_back(bslmf::MovableRefUtil::move(functor));
+        d_numPendingJobs.add(1);  // before the job can be popped (see above)
+        worker->d_size.storeRelease(static_cast<int>(worker->d_jobs.size()));
+    }
+    jobEnqueued();
+    return 0;
+}
+
+void WorkStealingThreadPool::drain()
+{
+    BSLS_ASSERT(0 == bslmt::ThreadUtil::getSpecific(d_workerKey));
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    while (d_running.loadAcquire()
+        && (d_numPendingJobs.load() || d_numActiveThreads.load())) {
+        d_drainCondition.wait(&d_mutex);
+    }
+}
+
+double WorkStealingThreadPool::resetPercentBusy()
+{
+    bsls::Types::Int64 now           = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64 lastResetTime = d_lastResetTime.swap(now);
+    const double callbackTime = static_cast<double>(d_callbackTime.swap(0));
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    double interval = static_cast<double>(now - lastResetTime);
+    interval = 0 != interval ? interval : 1;
+
+    return 100.0 / numThreads() * callbackTime / interval;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    d_running.storeRelease(0);
+    disable();
+    joinThreads();
+    clearQueues();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    if (isStarted()) {
+        return 0;                                                     // RETURN
+    }
+
+    d_running.storeRelease(1);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals in the created threads.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = 0;
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        bslmt::ThreadUtil::Handle handle;
+        rc = bslmt::ThreadUtil::create(
+                                     &handle,
+                                     d_threadAttributes,
+                                     bdlmt_WorkStealingThreadPool_threadEntry,
+                                     d_workers[i]);
+        if (0 != rc) {
+            break;
+        }
+        d_handles.push_back(handle);
+        d_numThreadsStarted.addRelaxed(1);
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    pthread_sigmask(SIG_SETMASK, &oldset, 0);
+#endif
+
+    if (0 != rc) {
+        d_running.storeRelease(0);
+        joinThreads();
+        return -1;                                                    // RETURN
+    }
+
+    enable();
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> metaGuard(&d_metaMutex);
+
+    disable();
+    drain();
+    d_running.storeRelease(0);
+    joinThreads();
+}
+
+// ACCESSORS
+double WorkStealingThreadPool::percentBusy() const
+{
+    bsls::Types::Int64 last = d_lastResetTime.load();
+    double interval = static_cast<double>(bsls::TimeUtil::getTimer() - last);
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    interval = 0 != interval ? interval : 1;
+
+    double ratio = static_cast<double>(d_callbackTime.load()) / interval;
+    return 100.0 / numThreads() * ratio;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
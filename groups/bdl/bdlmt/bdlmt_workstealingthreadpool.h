@@ -0,0 +1,509 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool with per-thread work stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size pool with per-thread job queues
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that distributes user-defined functions
+// ("jobs") among a fixed number of processing threads.  Unlike
+// 'bdlmt::ThreadPool' and 'bdlmt::FixedThreadPool', which funnel every job
+// through a single shared queue, each processing thread of a
+// 'bdlmt::WorkStealingThreadPool' owns its own double-ended job queue, and the
+// lock protecting that queue is contended only when another thread submits a
+// job to it or steals a job from it.  This makes the pool well suited to
+// "fan-out" workloads, in which a large number of small jobs are enqueued,
+// often by jobs that are themselves running in the pool.
+//
+///Job Placement and Stealing
+///--------------------------
+// Jobs are placed and retrieved according to the following rules:
+//
+//: o A job enqueued from one of the pool's own processing threads is pushed
+//:   onto the back of that thread's queue ("local-first submission").
+//:
+//: o A job enqueued from any other thread is pushed onto the back of the
+//:   queue of a processing thread chosen in round-robin order.
+//:
+//: o A processing thread retrieves jobs from the back of its own queue (i.e.,
+//:   most recently submitted first), which favors jobs whose data is still
+//:   warm in the cache of that thread.
+//:
+//: o A processing thread whose own queue is empty attempts to steal the job
+//:   at the front of the queue (i.e., the oldest job) of another processing
+//:   thread, visiting the other threads in an order starting from a randomly
+//:   chosen victim.  Only if no job can be found in any queue does the thread
+//:   block.
+//
+// Note that, as a consequence of these rules, the pool provides *no* ordering
+// guarantee among the jobs it executes; clients requiring FIFO processing
+// should use 'bdlmt::FixedThreadPool' or 'bdlmt::ThreadPool'.
+//
+///Drop-in Replacement
+///-------------------
+// 'bdlmt::WorkStealingThreadPool' provides the same job-submission
+// ('enqueueJob'), life-cycle ('start', 'stop', 'shutdown', 'drain',
+// 'enable', 'disable'), and statistics ('numActiveThreads',
+// 'numPendingJobs', 'percentBusy', 'resetPercentBusy') methods as the other
+// thread pools of this package, with the semantics of
+// 'bdlmt::FixedThreadPool': 'drain' waits until all pending jobs complete but
+// does not disable enqueuing, and 'enqueueJob' fails only if enqueuing is
+// disabled.  The job queues are unbounded, so 'enqueueJob' never blocks.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with the other thread pools of this package, on Unix platforms all the
+// threads in the pool block all asynchronous signals, i.e., all signals except
+// 'SIGBUS', 'SIGFPE', 'SIGILL', 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and
+// 'SIGIOT'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Fan-Out
+/// - - - - - - - - - - - - - -
+// In this example we sum the elements of a large array by recursively
+// splitting the range into halves, enqueuing one job per half, until the
+// ranges are small enough to be summed directly.  Since the subranges are
+// enqueued from the processing threads themselves, they are placed on the
+// local queue of the submitting thread, and idle threads steal the remaining
+// work.
+//
+// First, we define the job that either sums a range directly or splits it:
+//..
+//  struct SumJob {
+//      // This 'struct' describes one subrange of the array to be summed.
+//
+//      bdlmt::WorkStealingThreadPool *d_pool_p;
+//      const int                     *d_begin_p;
+//      const int                     *d_end_p;
+//      bsls::AtomicInt64             *d_sum_p;
+//
+//      void operator()() const
+//          // Sum the range described by this object, splitting it into
+//          // two new jobs if it is too large.
+//      {
+//          const bsl::ptrdiff_t length = d_end_p - d_begin_p;
+//          if (length <= 1024) {
+//              bsls::Types::Int64 sum = 0;
+//              for (const int *p = d_begin_p; p != d_end_p; ++p) {
+//                  sum += *p;
+//              }
+//              d_sum_p->add(sum);
+//              return;                                               // RETURN
+//          }
+//          const int *middle = d_begin_p + length / 2;
+//
+//          SumJob left  = { d_pool_p, d_begin_p, middle,  d_sum_p };
+//          SumJob right = { d_pool_p, middle,    d_end_p, d_sum_p };
+//          d_pool_p->enqueueJob(left);
+//          d_pool_p->enqueueJob(right);
+//      }
+//  };
+//..
+// Then, we create and start a pool of four threads:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we populate an array to be summed:
+//..
+//  bsl::vector<int> data(100000);
+//  for (bsl::size_t i = 0; i < data.size(); ++i) {
+//      data[i] = static_cast<int>(i % 10);
+//  }
+//..
+// Now, we enqueue a single job for the entire array:
+//..
+//  bsls::AtomicInt64 sum(0);
+//  SumJob job = { &pool, data.data(), data.data() + data.size(), &sum };
+//  pool.enqueueJob(job);
+//..
+// Finally, we wait for all the jobs, including those enqueued by other jobs,
+// to complete, and verify the result:
+//..
+//  pool.drain();
+//  assert(450000 == sum);
+//
+//  pool.stop();
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+class WorkStealingThreadPool_Worker;
+
+                       // ============================
+                       // class WorkStealingThreadPool
+                       // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool, used for concurrently
+    // executing multiple user-defined functions ("jobs"), in which each
+    // processing thread owns a job queue and idle threads steal jobs from the
+    // queues of busy threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    // DATA
+    bsl::vector<Worker *>    d_workers;           // per-thread job queues,
+                                                  // owned
+
+    bslmt::ThreadUtil::Key   d_workerKey;         // thread-specific key
+                                                  // identifying the 'Worker'
+                                                  // of the calling thread
+
+    bsls::AtomicUint         d_nextWorker;        // round-robin index used to
+                                                  // place jobs submitted from
+                                                  // non-pool threads
+
+    bsls::AtomicInt          d_numPendingJobs;    // number of jobs enqueued
+                                                  // but not yet started
+
+    bsls::AtomicInt          d_numActiveThreads;  // number of threads
+                                                  // currently executing a job
+
+    bsls::AtomicInt          d_numSleeping;       // number of threads blocked
+                                                  // on 'd_wakeCondition'
+
+    bsls::AtomicInt          d_enabled;           // 1 if enqueuing is enabled,
+                                                  // and 0 otherwise
+
+    bsls::AtomicInt          d_running;           // 1 while processing
+                                                  // threads should keep
+                                                  // running, and 0 otherwise
+
+    bsls::AtomicInt          d_numThreadsStarted; // number of processing
+                                                  // threads currently started
+
+    bslmt::Mutex             d_mutex;             // protects sleeping and
+                                                  // draining
+
+    bslmt::Condition         d_wakeCondition;     // signaled when a job is
+                                                  // available, or the threads
+                                                  // are to stop
+
+    bslmt::Condition         d_drainCondition;    // signaled when the pool
+                                                  // becomes idle
+
+    bslmt::Mutex             d_metaMutex;         // serializes 'start', 'stop'
+                                                  // and 'shutdown'
+
+    bsl::vector<bslmt::ThreadUtil::Handle>
+                             d_handles;           // handles of the started
+                                                  // processing threads
+
+    bslmt::ThreadAttributes  d_threadAttributes;  // attributes used to create
+                                                  // processing threads
+
+    bsls::AtomicInt64        d_lastResetTime;     // last reset time of the
+                                                  // percent-busy metric, in
+                                                  // nanoseconds
+
+    bsls::AtomicInt64        d_callbackTime;      // total time spent running
+                                                  // jobs, in nanoseconds
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;          // set of signals to be
+                                                  // blocked in managed threads
+#endif
+
+    // FRIENDS
+    friend class WorkStealingThreadPool_Worker;
+
+    // PRIVATE MANIPULATORS
+    void clearQueues();
+        // Remove, without executing them, all jobs from all the job queues of
+        // this pool.
+
+    void init(int numThreads);
+        // Create the job queues of the specified 'numThreads' processing
+        // threads and initialize the remaining state of this object.  Note
+        // that this method is called only by the constructors.
+
+    void joinThreads();
+        // Wake and join all the started processing threads.  The behavior is
+        // undefined unless 'd_metaMutex' is locked and 'd_running' is 0.
+
+    void jobEnqueued();
+        // Wake a processing thread if one is sleeping.  The behavior is
+        // undefined unless a job was just pushed onto a job queue, and
+        // counted in 'd_numPendingJobs' before the job could be popped.
+
+    bool popJob(Job *job, Worker *self);
+        // Load into the specified 'job' a job retrieved from the queue of the
+        // specified 'self' worker, or, if that queue is empty, stolen from the
+        // queue of another worker.  Return 'true' if a job was loaded, and
+        // 'false' otherwise.  On success, 'd_numActiveThreads' has been
+        // incremented and 'd_numPendingJobs' decremented.
+
+    Worker *selectWorker();
+        // Return the worker onto whose queue a job submitted by the calling
+        // thread should be pushed.
+
+    void workerThread(Worker *self);
+        // Process jobs on behalf of the specified 'self' worker until
+        // 'd_running' becomes 0.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool having the specified 'numThreads' processing
+        // threads, each owning its own job queue.  Optionally specify
+        // 'threadAttributes' used to create the processing threads.  If
+        // 'threadAttributes' is not specified, default attributes are used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The pool is created enabled and not started.  The behavior is
+        // undefined unless '1 <= numThreads'.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs without executing them, block until all
+        // currently running jobs complete, and then destroy this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable enqueuing into this pool.  Subsequent calls to 'enqueueJob'
+        // will immediately fail.  Note that this method has no effect on jobs
+        // currently in the pool.
+
+    void enable();
+        // Enable enqueuing into this pool.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread.  If called from a processing thread of this pool, the job is
+        // placed on the queue of the calling thread; otherwise it is placed on
+        // the queue of a processing thread chosen in round-robin order.
+        // Return 0 if enqueued successfully, and a non-zero value if enqueuing
+        // is currently disabled.  The behavior is undefined unless 'functor'
+        // is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if enqueuing is currently
+        // disabled.
+
+    void drain();
+        // Wait until all pending jobs complete, including jobs enqueued by
+        // other jobs while waiting.  Note that this method does not disable
+        // enqueuing, and that if jobs are submitted concurrently by other
+        // threads, this method may or may not wait until they have also
+        // completed.  The behavior is undefined if this method is called from
+        // a processing thread of this pool.
+
+    double resetPercentBusy();
+        // Atomically report the percentage of wall time spent by each thread
+        // of this thread pool executing jobs since the last reset time, and
+        // set the reset time to now.  The creation of the thread pool is
+        // considered a first reset time.  See 'percentBusy'.
+
+    void shutdown();
+        // Disable enqueuing on this thread pool, cancel all queued jobs, and,
+        // after all active jobs have completed, join all processing threads.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise, in which
+        // case no threads are left running.  This method has no effect if the
+        // threads are already started.
+
+    void stop();
+        // Disable enqueuing on this thread pool and wait until all pending
+        // jobs complete, then join all processing threads.
+
+    // ACCESSORS
+    bool isEnabled() const;
+        // Return 'true' if enqueuing is enabled on this thread pool, and
+        // 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if the processing threads of this pool are started,
+        // and 'false' otherwise.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job for this thread pool.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs currently enqueued, but not
+        // yet being processed, in all the job queues of this thread pool.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return the number of threads currently started by this thread pool.
+
+    double percentBusy() const;
+        // Return the percentage of wall time spent by each thread of this
+        // thread pool executing jobs since the last reset time.  The creation
+        // of the thread pool is considered a first reset time.  This value is
+        // calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      numThreads
+        //..
+        // Note that this percentage reflects the wall time spent per thread,
+        // and not CPU time per thread, or not even CPU time per processor.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class WorkStealingThreadPool
+                       // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabled.storeRelease(0);
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabled.storeRelease(1);
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(
+                                       WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return 0 != d_enabled.loadAcquire();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs.loadRelaxed();
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return numThreads() == d_numThreadsStarted.loadAcquire();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return static_cast<int>(d_workers.size());
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_numThreadsStarted.loadAcquire();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,932 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>  // for testing only
+#include <bdlmt_threadpool.h>       // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_latch.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+#include <bslmt_throughputbenchmark.h>
+#include <bslmt_throughputbenchmarkresult.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a thread pool in which each processing thread
+// owns a job queue, and idle threads steal jobs from the queues of other
+// threads.  The primary manipulators are 'start', 'enqueueJob', and 'stop';
+// 'drain' is used extensively to observe the completion of the enqueued jobs.
+// Since the order in which jobs are executed depends on the scheduling of the
+// processing threads, the tests verify, with one exception, only that every
+// job is executed exactly once.  The exception is local-first submission,
+// which is observed by arranging for all but one processing thread to be
+// blocked, so that the jobs enqueued by the remaining thread are executed by
+// that thread in last-in, first-out order.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(int numThreads, *bA = 0);
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, *bA = 0);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 2] void disable();
+// [ 2] void enable();
+// [ 3] int enqueueJob(const Job& functor);
+// [ 3] int enqueueJob(bslmf::MovableRef<Job> functor);
+// [ 3] int enqueueJob(WorkStealingThreadPoolJobFunc function, void *data);
+// [ 3] void drain();
+// [ 6] double resetPercentBusy();
+// [ 5] void shutdown();
+// [ 2] int start();
+// [ 2] void stop();
+//
+// ACCESSORS
+// [ 2] bool isEnabled() const;
+// [ 2] bool isStarted() const;
+// [ 3] int numActiveThreads() const;
+// [ 3] int numPendingJobs() const;
+// [ 2] int numThreads() const;
+// [ 2] int numThreadsStarted() const;
+// [ 6] double percentBusy() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 4] CONCERN: jobs enqueued by a processing thread stay on its queue
+// [-1] PERFORMANCE: comparison with 'ThreadPool' and 'FixedThreadPool'
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+typedef Obj::Job                      Job;
+
+// ============================================================================
+//                   GLOBAL STRUCTS/FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+extern "C" void incrementCounter(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void waitThenIncrement(bslmt::Semaphore *semaphore, bsls::AtomicInt *counter)
+    // Wait on the specified 'semaphore', then increment the specified
+    // 'counter'.
+{
+    semaphore->wait();
+    ++*counter;
+}
+
+void sampleNumPendingJobs(int *minimum, const Obj *pool, bsls::AtomicInt *done)
+    // Load into the specified 'minimum' the smallest number of pending jobs
+    // of the specified 'pool' observed until the specified 'done' is set.
+{
+    *minimum = pool->numPendingJobs();
+    while (0 == *done) {
+        const int numPendingJobs = pool->numPendingJobs();
+        if (numPendingJobs < *minimum) {
+            *minimum = numPendingJobs;
+        }
+    }
+}
+
+                            // ==================
+                            // struct LocalFanOut
+                            // ==================
+
+struct LocalFanOut {
+    // This 'struct' provides the jobs used to verify local-first submission.
+
+    enum { k_NUM_CHILDREN = 10 };
+
+    Obj              *d_pool_p;
+    bslmt::Barrier   *d_barrier_p;
+    bslmt::Semaphore *d_release_p;
+    bslmt::Mutex     *d_mutex_p;
+    bsl::vector<int> *d_order_p;
+    bsls::AtomicInt  *d_remaining_p;
+
+    void blocker() const
+        // Rendezvous with the other blockers and the parent, then wait until
+        // all the children have run.
+    {
+        d_barrier_p->wait();
+        d_release_p->wait();
+    }
+
+    void child(int index) const
+        // Record the specified 'index' and, if this is the last child to run,
+        // release the blockers.
+    {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(d_mutex_p);
+            d_order_p->push_back(index);
+        }
+        if (0 == --*d_remaining_p) {
+            for (int i = 0; i < d_pool_p->numThreads() - 1; ++i) {
+                d_release_p->post();
+            }
+        }
+    }
+
+    void parent() const
+        // Rendezvous with the blockers, then enqueue the children.
+    {
+        d_barrier_p->wait();
+        for (int i = 0; i < k_NUM_CHILDREN; ++i) {
+            d_pool_p->enqueueJob(bdlf::BindUtil::bind(&LocalFanOut::child,
+                                                      *this,
+                                                      i));
+        }
+    }
+};
+
+                            // ===============
+                            // struct FanOutJob
+                            // ===============
+
+struct FanOutJob {
+    // This 'struct' provides a tiny job used by the performance test.
+
+    bslmt::Latch *d_latch_p;
+
+    void operator()() const
+        // Perform a negligible amount of work and count down the latch.
+    {
+        bslmt::ThroughputBenchmark::busyWork(10);
+        d_latch_p->arrive();
+    }
+};
+
+template <class POOL>
+void fanOut(POOL *pool, int numJobs, int)
+    // Enqueue the specified 'numJobs' tiny jobs to the specified 'pool' and
+    // wait for them to complete.
+{
+    bslmt::Latch latch(numJobs);
+    FanOutJob    job = { &latch };
+    for (int i = 0; i < numJobs; ++i) {
+        pool->enqueueJob(job);
+    }
+    latch.wait();
+}
+
+template <class POOL>
+double benchmarkPool(POOL *pool, int numSubmitters, int numJobs, int numMillis)
+    // Return the median number of fan-outs of the specified 'numJobs' jobs to
+    // the specified 'pool' per second, performed by the specified
+    // 'numSubmitters' threads, each sample running for the specified
+    // 'numMillis'.
+{
+    bslmt::ThroughputBenchmark       bench;
+    bslmt::ThroughputBenchmarkResult result;
+
+    bsl::function<void(int)> run = bdlf::BindUtil::bind(&fanOut<POOL>,
+                                                        pool,
+                                                        numJobs,
+                                                        bdlf::PlaceHolders::_1);
+    int group = bench.addThreadGroup(run, numSubmitters, 0);
+    bench.execute(&result, numMillis, 5);
+
+    double median;
+    result.getMedian(&median, group);
+    return median;
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Fan-Out
+/// - - - - - - - - - - - - - -
+// In this example we sum the elements of a large array by recursively
+// splitting the range into halves, enqueuing one job per half, until the
+// ranges are small enough to be summed directly.  Since the subranges are
+// enqueued from the processing threads themselves, they are placed on the
+// local queue of the submitting thread, and idle threads steal the remaining
+// work.
+//
+// First, we define the job that either sums a range directly or splits it:
+//..
+    struct SumJob {
+        // This 'struct' describes one subrange of the array to be summed.
+
+        bdlmt::WorkStealingThreadPool *d_pool_p;
+        const int                     *d_begin_p;
+        const int                     *d_end_p;
+        bsls::AtomicInt64             *d_sum_p;
+
+        void operator()() const
+            // Sum the range described by this object, splitting it into
+            // two new jobs if it is too large.
+        {
+            const bsl::ptrdiff_t length = d_end_p - d_begin_p;
+            if (length <= 1024) {
+                bsls::Types::Int64 sum = 0;
+                for (const int *p = d_begin_p; p != d_end_p; ++p) {
+                    sum += *p;
+                }
+                d_sum_p->add(sum);
+                return;                                               // RETURN
+            }
+            const int *middle = d_begin_p + length / 2;
+
+            SumJob left  = { d_pool_p, d_begin_p, middle,  d_sum_p };
+            SumJob right = { d_pool_p, middle,    d_end_p, d_sum_p };
+            d_pool_p->enqueueJob(left);
+            d_pool_p->enqueueJob(right);
+        }
+    };
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create and start a pool of four threads:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Next, we populate an array to be summed:
+//..
+    bsl::vector<int> data(100000);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<int>(i % 10);
+    }
+//..
+// Now, we enqueue a single job for the entire array:
+//..
+    bsls::AtomicInt64 sum(0);
+    SumJob job = { &pool, data.data(), data.data() + data.size(), &sum };
+    pool.enqueueJob(job);
+//..
+// Finally, we wait for all the jobs, including those enqueued by other jobs,
+// to complete, and verify the result:
+//..
+    pool.drain();
+    ASSERT(450000 == sum);
+
+    pool.stop();
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentBusy' AND 'resetPercentBusy'
+        //
+        // Concerns:
+        //: 1 'percentBusy' is near 0 for an idle pool.
+        //:
+        //: 2 'percentBusy' reflects the time spent executing jobs.
+        //:
+        //: 3 'resetPercentBusy' returns the current value and restarts the
+        //:   measurement.
+        //
+        // Plan:
+        //: 1 Measure an idle pool.  (C-1)
+        //:
+        //: 2 Run one job per thread, each sleeping for a known interval, and
+        //:   verify the reported percentage is plausible.  (C-2..3)
+        //
+        // Testing:
+        //   double percentBusy() const;
+        //   double resetPercentBusy();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'percentBusy' AND 'resetPercentBusy'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        enum { k_NUM_THREADS = 2 };
+
+        Obj mX(k_NUM_THREADS);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+
+        bslmt::ThreadUtil::microSleep(50000);
+        double busy = X.percentBusy();
+        ASSERTV(busy, 0.0 <= busy && busy < 10.0);
+
+        mX.resetPercentBusy();
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            mX.enqueueJob(bdlf::BindUtil::bind(&bslmt::ThreadUtil::microSleep,
+                                               100000,
+                                               0));
+        }
+        mX.drain();
+
+        busy = mX.resetPercentBusy();
+        ASSERTV(busy, 20.0 < busy && busy <= 101.0);
+
+        busy = X.percentBusy();
+        ASSERTV(busy, 0.0 <= busy && busy < 20.0);
+
+        mX.stop();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'shutdown'
+        //
+        // Concerns:
+        //: 1 'shutdown' discards the pending jobs without executing them.
+        //:
+        //: 2 'shutdown' waits for the active jobs to complete.
+        //:
+        //: 3 'shutdown' disables enqueuing.
+        //:
+        //: 4 The destructor discards the jobs of a pool that was never
+        //:   started.
+        //
+        // Plan:
+        //: 1 Block every processing thread in a job, enqueue additional jobs,
+        //:   and call 'shutdown' from another thread; release the blocked jobs
+        //:   and verify only those have run.  (C-1..3)
+        //:
+        //: 2 Enqueue jobs to a pool that is not started and destroy it.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void shutdown();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'shutdown'" << endl
+                          << "==================" << endl;
+
+        enum { k_NUM_THREADS = 3, k_NUM_EXTRA = 20 };
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(k_NUM_THREADS, &ta);  const Obj& X = mX;
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore semaphore;
+            bsls::AtomicInt  counter(0);
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                            &waitThenIncrement,
+                                                            &semaphore,
+                                                            &counter)));
+            }
+            while (X.numActiveThreads() < k_NUM_THREADS) {
+                bslmt::ThreadUtil::yield();
+            }
+            for (int i = 0; i < k_NUM_EXTRA; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+            ASSERTV(X.numPendingJobs(), k_NUM_EXTRA == X.numPendingJobs());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handle,
+                                      bdlf::BindUtil::bind(&Obj::shutdown,
+                                                           &mX)));
+            while (X.isEnabled()) {
+                bslmt::ThreadUtil::yield();
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                semaphore.post();
+            }
+            bslmt::ThreadUtil::join(handle);
+
+            ASSERTV(counter, k_NUM_THREADS == counter);
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(0 == X.numThreadsStarted());
+            ASSERT(0 != mX.enqueueJob(&incrementCounter, &counter));
+        }
+        {
+            bsls::AtomicInt counter(0);
+
+            Obj mX(k_NUM_THREADS, &ta);
+            for (int i = 0; i < k_NUM_EXTRA; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING LOCAL-FIRST SUBMISSION
+        //
+        // Concerns:
+        //: 1 A job enqueued by a processing thread is pushed onto the queue of
+        //:   that thread.
+        //:
+        //: 2 A processing thread executes the jobs of its own queue in
+        //:   last-in, first-out order.
+        //
+        // Plan:
+        //: 1 Enqueue 'numThreads() - 1' jobs that block, and a parent job
+        //:   that, once all the blockers are running, enqueues several
+        //:   children that record their index.  The last child releases the
+        //:   blockers.  Since the only thread available to execute the
+        //:   children is the thread of the parent, they are executed in
+        //:   reverse order only if they were all placed on its queue.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: jobs enqueued by a processing thread stay on its queue
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING LOCAL-FIRST SUBMISSION" << endl
+                          << "==============================" << endl;
+
+        for (int numThreads = 2; numThreads <= 5; ++numThreads) {
+            Obj mX(numThreads);
+            ASSERT(0 == mX.start());
+
+            bslmt::Barrier   barrier(numThreads);
+            bslmt::Semaphore release;
+            bslmt::Mutex     mutex;
+            bsl::vector<int> order;
+            bsls::AtomicInt  remaining(LocalFanOut::k_NUM_CHILDREN);
+
+            LocalFanOut fanOut = { &mX,
+                                   &barrier,
+                                   &release,
+                                   &mutex,
+                                   &order,
+                                   &remaining };
+
+            for (int i = 0; i < numThreads - 1; ++i) {
+                mX.enqueueJob(bdlf::BindUtil::bind(&LocalFanOut::blocker,
+                                                   fanOut));
+            }
+            mX.enqueueJob(bdlf::BindUtil::bind(&LocalFanOut::parent, fanOut));
+            mX.drain();
+
+            ASSERTV(numThreads, order.size(),
+                    LocalFanOut::k_NUM_CHILDREN == order.size());
+            for (int i = 0; i < static_cast<int>(order.size()); ++i) {
+                ASSERTV(numThreads, i, order[i],
+                        LocalFanOut::k_NUM_CHILDREN - 1 - i == order[i]);
+            }
+            mX.stop();
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueJob' AND 'drain'
+        //
+        // Concerns:
+        //: 1 Every job enqueued, through any of the 'enqueueJob' overloads,
+        //:   is executed exactly once.
+        //:
+        //: 2 Jobs enqueued before 'start' are executed once the pool starts.
+        //:
+        //: 3 'drain' returns only after all the jobs, including those enqueued
+        //:   by other jobs, have completed, and does not disable enqueuing.
+        //:
+        //: 4 Jobs may be enqueued concurrently by several external threads.
+        //:
+        //: 5 'numPendingJobs' and 'numActiveThreads' are 0 after 'drain'.
+        //:
+        //: 6 All memory is released when the pool is destroyed.
+        //:
+        //: 7 'numPendingJobs' never becomes negative, even when a job is
+        //:   stolen as soon as it is enqueued.
+        //
+        // Plan:
+        //: 1 Enqueue jobs, incrementing a counter, before and after 'start',
+        //:   using each overload, and verify the counter after 'drain'.
+        //:   (C-1..3, 5..6)
+        //:
+        //: 2 Enqueue jobs from several threads concurrently.  (C-4)
+        //:
+        //: 3 Enqueue many jobs while the processing threads are executing
+        //:   and stealing them, and while another thread records the smallest
+        //:   value of 'numPendingJobs'.  (C-7)
+        //
+        // Testing:
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(bslmf::MovableRef<Job> functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc function, void *);
+        //   void drain();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'enqueueJob' AND 'drain'" << endl
+                          << "================================" << endl;
+
+        const int k_NUM_JOBS = 1000;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            bsls::AtomicInt counter(0);
+
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+            ASSERTV(X.numPendingJobs(), k_NUM_JOBS == X.numPendingJobs());
+
+            ASSERT(0 == mX.start());
+
+            const Job job = bdlf::BindUtil::bind(&incrementCounter, &counter);
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(job));
+
+                Job movedJob(job);
+                ASSERT(0 == mX.enqueueJob(
+                                   bslmf::MovableRefUtil::move(movedJob)));
+            }
+            mX.drain();
+
+            ASSERTV(counter, 3 * k_NUM_JOBS == counter);
+            ASSERT(0 == X.numPendingJobs());
+            ASSERT(0 == X.numActiveThreads());
+            ASSERT(X.isEnabled());
+
+            counter = 0;
+
+            const int k_NUM_SUBMITTERS = 4;
+
+            bslmt::ThreadGroup submitters;
+            for (int i = 0; i < k_NUM_SUBMITTERS; ++i) {
+                submitters.addThread(bdlf::BindUtil::bind(
+                                             &fanOut<Obj>, &mX, k_NUM_JOBS, i));
+            }
+            submitters.joinAll();
+            mX.drain();
+
+            bsls::AtomicInt64 sum(0);
+            bsl::vector<int>  data(50000, 1);
+            SumJob sumJob = { &mX, data.data(), data.data() + data.size(),
+                              &sum };
+            ASSERT(0 == mX.enqueueJob(sumJob));
+            mX.drain();
+            ASSERTV(sum, 50000 == sum);
+
+            int                       minimum = 0;
+            bsls::AtomicInt           done(0);
+            bslmt::ThreadUtil::Handle sampler;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                &sampler,
+                                bdlf::BindUtil::bind(&sampleNumPendingJobs,
+                                                     &minimum,
+                                                     &X,
+                                                     &done)));
+
+            counter = 0;
+            for (int i = 0; i < 100 * k_NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+            }
+            done = 1;
+            bslmt::ThreadUtil::join(sampler);
+            ASSERTV(minimum, 0 <= minimum);
+
+            mX.drain();
+            ASSERTV(counter, 100 * k_NUM_JOBS == counter);
+            ASSERT(0 == X.numPendingJobs());
+
+            mX.stop();
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', 'stop', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A pool is created enabled, not started, with the specified number
+        //:   of threads.
+        //:
+        //: 2 'start' starts 'numThreads()' threads, and is idempotent.
+        //:
+        //: 3 'stop' disables enqueuing, executes the pending jobs, and joins
+        //:   the threads; the pool can be restarted afterwards.
+        //:
+        //: 4 'disable' and 'enable' control whether 'enqueueJob' succeeds.
+        //:
+        //: 5 All memory is supplied by the object allocator and released by
+        //:   the destructor.
+        //
+        // Plan:
+        //: 1 Create pools of various sizes, with and without thread
+        //:   attributes, and exercise the life-cycle methods, verifying the
+        //:   accessors at each step.  (C-1..5)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int numThreads, *bA = 0);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, *bA = 0);
+        //   ~WorkStealingThreadPool();
+        //   void disable();
+        //   void enable();
+        //   int start();
+        //   void stop();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'start', 'stop', AND BASIC "
+                          << "ACCESSORS" << endl
+                          << "============================================="
+                          << "=========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        for (int numThreads = 1; numThreads <= 8; ++numThreads) {
+            for (int withAttributes = 0; withAttributes < 2; ++withAttributes) {
+                bslma::DefaultAllocatorGuard dag(&ta);
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+                {
+                    bslmt::ThreadAttributes attributes;
+                    attributes.setStackSize(256 * 1024);
+
+                    Obj *objPtr = withAttributes
+                                ? new (oa) Obj(attributes, numThreads, &oa)
+                                : new (oa) Obj(numThreads, &oa);
+                    Obj& mX = *objPtr;  const Obj& X = mX;
+
+                    ASSERTV(numThreads, numThreads == X.numThreads());
+                    ASSERT(X.isEnabled());
+                    ASSERT(!X.isStarted());
+                    ASSERT(0 == X.numThreadsStarted());
+
+                    mX.disable();
+                    ASSERT(!X.isEnabled());
+                    ASSERT(0 != mX.enqueueJob(&incrementCounter, 0));
+                    mX.enable();
+                    ASSERT(X.isEnabled());
+
+                    bsls::AtomicInt counter(0);
+                    ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+
+                    ASSERT(0 == mX.start());
+                    ASSERT(X.isStarted());
+                    ASSERT(numThreads == X.numThreadsStarted());
+                    ASSERT(0 == mX.start());
+                    ASSERT(numThreads == X.numThreadsStarted());
+
+                    ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+
+                    mX.stop();
+                    ASSERTV(counter, 2 == counter);
+                    ASSERT(!X.isStarted());
+                    ASSERT(!X.isEnabled());
+                    ASSERT(0 == X.numThreadsStarted());
+
+                    ASSERT(0 == mX.start());
+                    ASSERT(X.isEnabled());
+                    ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+                    mX.drain();
+                    ASSERTV(counter, 3 == counter);
+
+                    oa.deleteObject(objPtr);
+                }
+                ASSERT(0 == oa.numBlocksInUse());
+                ASSERT(0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue jobs, drain, and stop.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsls::AtomicInt counter(0);
+
+        Obj mX(3);  const Obj& X = mX;
+        ASSERT(0 == mX.start());
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(&incrementCounter, &counter));
+        }
+        mX.drain();
+        ASSERTV(counter, 100 == counter);
+        ASSERT(0 == X.numPendingJobs());
+
+        mX.stop();
+        ASSERT(!X.isStarted());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: COMPARISON WITH 'ThreadPool' AND 'FixedThreadPool'
+        //
+        // Concerns:
+        //: 1 The work-stealing pool sustains a higher throughput of tiny jobs
+        //:   than the pools based on a single shared queue.
+        //
+        // Plan:
+        //: 1 Using 'bslmt::ThroughputBenchmark', have a number of submitter
+        //:   threads repeatedly enqueue a fan-out of tiny jobs and wait for
+        //:   them to complete, and report the median number of fan-outs per
+        //:   second for each pool.  The number of pool threads, submitter
+        //:   threads, and jobs per fan-out can be given on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE: comparison with 'ThreadPool' and 'FixedThreadPool'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: COMPARISON WITH 'ThreadPool' AND "
+                          << "'FixedThreadPool'" << endl
+                          << "=============================================="
+                          << "=================" << endl;
+
+        const int numThreads    = argc > 2 ? atoi(argv[2]) : 8;
+        const int numSubmitters = argc > 3 ? atoi(argv[3]) : 4;
+        const int numJobs       = argc > 4 ? atoi(argv[4]) : 100;
+        const int numMillis     = 1000;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        bdlmt::ThreadPool tp(bslmt::ThreadAttributes(),
+                             numThreads,
+                             numThreads,
+                             1000,
+                             &ta);
+        ASSERT(0 == tp.start());
+        double tpRate = benchmarkPool(&tp, numSubmitters, numJobs, numMillis);
+        tp.stop();
+
+        bdlmt::FixedThreadPool ftp(numThreads,
+                                   numSubmitters * numJobs,
+                                   &ta);
+        ASSERT(0 == ftp.start());
+        double ftpRate = benchmarkPool(&ftp, numSubmitters, numJobs, numMillis);
+        ftp.stop();
+
+        Obj wsp(numThreads, &ta);
+        ASSERT(0 == wsp.start());
+        double wspRate = benchmarkPool(&wsp, numSubmitters, numJobs, numMillis);
+        wsp.stop();
+
+        cout << "threads=" << numThreads << " submitters=" << numSubmitters
+             << " jobs/fan-out=" << numJobs << " (fan-outs per second)\n"
+             << bsl::fixed << bsl::setprecision(0)
+             << "    ThreadPool:             " << tpRate  << "\n"
+             << "    FixedThreadPool:        " << ftpRate << "\n"
+             << "    WorkStealingThreadPool: " << wspRate << "\n";
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
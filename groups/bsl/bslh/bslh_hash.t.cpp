@@ -3,11 +3,14 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
+#include <bslh_xxhash3algorithm.h>
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <limits>
@@ -79,6 +82,7 @@ using namespace bslh;
 // [ 6] is_trivially_copyable trait
 // [ 6] is_trivially_default_constructible trait
 // [ 7] QoI: Support for empty base optimization
+// [-1] PERFORMANCE TEST
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -829,6 +833,99 @@ namespace Z {
 }  // close namespace Z
 
 
+                          // ====================
+                          // struct BenchmarkKey
+                          // ====================
+
+struct BenchmarkKey {
+    // This 'struct' provides a key consisting of a sequence of bytes, held by
+    // reference, that is used to measure the performance of hashing
+    // algorithms on keys of arbitrary length.
+
+    // DATA
+    const char *d_data_p;  // bytes of the key (held, not owned)
+    size_t      d_length;  // number of bytes in the key
+};
+
+template <class HASHALG>
+void hashAppend(HASHALG& hashAlg, const BenchmarkKey& key)
+    // Pass the bytes of the specified 'key' to the specified 'hashAlg'.
+{
+    hashAlg(key.d_data_p, key.d_length);
+}
+
+                      // ===============================
+                      // class FixedSeedSipHashAlgorithm
+                      // ===============================
+
+class FixedSeedSipHashAlgorithm : public SipHashAlgorithm {
+    // This class provides a default-constructible 'SipHashAlgorithm', seeded
+    // with a fixed seed, so that SipHash can be measured through 'bslh::Hash'
+    // like the other algorithms.
+
+    // CLASS DATA
+    static const char s_seed[k_SEED_LENGTH];
+
+  public:
+    // CREATORS
+    FixedSeedSipHashAlgorithm()
+        // Create a 'SipHashAlgorithm' seeded with a fixed seed.
+    : SipHashAlgorithm(s_seed)
+    {
+    }
+};
+
+const char FixedSeedSipHashAlgorithm::s_seed[k_SEED_LENGTH] = {
+    0x1B, 0x11, 0x7C, 0x2A, 0x70, 0x2B, 0x10, 0x75,
+    0x78, 0x37, 0x47, 0x41, 0x77, 0x00, 0x09, 0x73,
+};
+
+static volatile size_t g_benchmarkSink = 0;
+    // Results of the benchmark, published to prevent the compiler from
+    // eliding the hashing.
+
+template <class HASHALG>
+double nanosecondsPerHash(const char *buffer,
+                          size_t      keyLength,
+                          int         numIterations)
+    // Return the average time, in nanoseconds, taken by
+    // 'bslh::Hash<HASHALG>' to hash each of the specified 'numIterations'
+    // keys of the specified 'keyLength' bytes drawn from the specified
+    // 'buffer'.  Keys of 4 and 8 bytes are hashed as 'int' and
+    // 'bsls::Types::Int64' values, and longer keys as sequences of bytes
+    // starting at one of the first 64 bytes of 'buffer'.  Each key depends on
+    // the hash of the previous key, so that the latency, rather than the
+    // throughput, of the hash function is measured.  The behavior is
+    // undefined unless 'buffer' has at least '64 + keyLength' bytes.
+{
+    bslh::Hash<HASHALG> hasher;
+    size_t              hash = 0;
+    bsls::Stopwatch     timer;
+
+    timer.start();
+    if (sizeof(int) == keyLength) {
+        for (int i = 0; i < numIterations; ++i) {
+            hash = hasher(static_cast<int>(i + (hash & 1)));
+        }
+    }
+    else if (sizeof(bsls::Types::Int64) == keyLength) {
+        for (int i = 0; i < numIterations; ++i) {
+            hash = hasher(static_cast<bsls::Types::Int64>(i + (hash & 1)));
+        }
+    }
+    else {
+        for (int i = 0; i < numIterations; ++i) {
+            const BenchmarkKey key = { buffer + ((i + hash) & 63), keyLength };
+            hash = hasher(key);
+        }
+    }
+    timer.stop();
+
+    g_benchmarkSink = hash;
+    return timer.accumulatedWallTime() * 1e9 / numIterations;
+}
+
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1811,6 +1908,71 @@ int main(int argc, char *argv[])
             ASSERT(hashAlg(int1) == hashAlg(int2));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Measure the time taken by 'bslh::Hash' to hash keys of various
+        //   lengths with each of the hashing algorithms in 'bslh'.
+        //
+        // Concerns:
+        //: 1 The relative cost of each algorithm is known for keys from 4
+        //:   bytes (e.g., 'int' identifiers) to 4 kilobytes.
+        //
+        // Plan:
+        //: 1 For key lengths from 4 to 4096 bytes, hash a sequence of
+        //:   dependent keys through 'bslh::Hash' with each algorithm, and
+        //:   report the average time per key in nanoseconds.  The number of
+        //:   keys hashed can be scaled by the optional second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE TEST"
+               "\n================\n");
+
+        const int SCALE = argc > 2 ? atoi(argv[2]) : 1;
+
+        static const size_t KEY_LENGTHS[] = { 4, 8, 16, 24, 32, 64, 128, 256,
+                                              512, 1024, 2048, 4096 };
+        const int NUM_KEY_LENGTHS = sizeof KEY_LENGTHS / sizeof *KEY_LENGTHS;
+
+        enum { k_BUFFER_LENGTH = 4096 + 64 };
+
+        static char buffer[k_BUFFER_LENGTH];
+        for (int i = 0; i < k_BUFFER_LENGTH; ++i) {
+            buffer[i] = static_cast<char>(i * 131 + (i >> 8));
+        }
+
+        printf("Nanoseconds per 'bslh::Hash<ALGORITHM>' call:\n\n"
+               "%6s %9s %9s %9s %9s %9s\n",
+               "bytes", "Default", "Spooky", "SipHash", "wyhash", "XXH3");
+
+        for (int i = 0; i < NUM_KEY_LENGTHS; ++i) {
+            const size_t LENGTH = KEY_LENGTHS[i];
+            const int    NUM_ITERATIONS =
+                      SCALE * static_cast<int>(100000 + (1 << 24) / LENGTH);
+
+            printf("%6d %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+                   static_cast<int>(LENGTH),
+                   nanosecondsPerHash<DefaultHashAlgorithm>(buffer,
+                                                            LENGTH,
+                                                            NUM_ITERATIONS),
+                   nanosecondsPerHash<SpookyHashAlgorithm>(buffer,
+                                                           LENGTH,
+                                                           NUM_ITERATIONS),
+                   nanosecondsPerHash<FixedSeedSipHashAlgorithm>(
+                                                              buffer,
+                                                              LENGTH,
+                                                              NUM_ITERATIONS),
+                   nanosecondsPerHash<WyHashAlgorithm>(buffer,
+                                                       LENGTH,
+                                                       NUM_ITERATIONS),
+                   nanosecondsPerHash<XxHash3Algorithm>(buffer,
+                                                        LENGTH,
+                                                        NUM_ITERATIONS));
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
@@ -0,0 +1,259 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#include <intrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The canonical implementation of wyhash hashes a contiguous key in one pass:
+// while more than 48 bytes remain it consumes a 48-byte stripe in three
+// independent lanes, then it consumes the remaining (at most 48) bytes 16 at a
+// time, and finally mixes the *last* 16 bytes of the key -- which may overlap
+// bytes already consumed -- with the running state.  Keys of at most 16 bytes
+// are handled by a separate path that reads the key in (possibly overlapping)
+// 4-byte words.
+//
+// To produce the same hashes however the key is split across calls to
+// 'operator()', this implementation consumes a stripe only once it is known
+// that at least one more byte follows it, and keeps unconsumed input in a
+// 48-byte buffer.  When a full buffer is consumed, or stripes are consumed
+// directly from the caller's data, the last 16 bytes of the consumed stripe
+// are left at (or copied to) the end of the buffer; since at most 15 bytes of
+// new input are buffered when those bytes are needed, they are never
+// overwritten, and 'computeHash' can reconstruct the last 16 bytes of the
+// key.
+
+namespace BloombergLP {
+
+namespace bslh {
+
+typedef bsls::Types::Uint64 u64;
+typedef unsigned char       u8;
+
+static const u64 s_secret[4] = { 0x2d358dccaa6c78a5ULL,
+                                 0x8bb84b93962eacc9ULL,
+                                 0x4b33a62ed433d4a3ULL,
+                                 0x4d5a2da51de1aa47ULL };
+    // Default secret of the canonical wyhash implementation.
+
+inline
+static void multiply(u64 *low, u64 *high)
+    // Multiply the specified 'low' and 'high' as unsigned 64-bit integers,
+    // and load the low 64 bits of the 128-bit product into 'low' and the high
+    // 64 bits into 'high'.
+{
+#if (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))     \
+ && defined(BSLS_PLATFORM_CPU_64_BIT)
+    __extension__ typedef unsigned __int128 u128;
+
+    u128 product = static_cast<u128>(*low) * *high;
+    *low  = static_cast<u64>(product);
+    *high = static_cast<u64>(product >> 64);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    *low = _umul128(*low, *high, high);
+#else
+    const u64 a  = *low;
+    const u64 b  = *high;
+    const u64 ha = a >> 32, hb = b >> 32, la = a & 0xffffffff,
+              lb = b & 0xffffffff;
+    const u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const u64 t  = rl + (rm0 << 32);
+    u64       c  = t < rl;
+    const u64 lo = t + (rm1 << 32);
+    c += lo < t;
+    *low  = lo;
+    *high = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline
+static u64 mix(u64 a, u64 b)
+    // Return the XOR of the low and high halves of the 128-bit product of the
+    // specified 'a' and 'b'.
+{
+    multiply(&a, &b);
+    return a ^ b;
+}
+
+inline
+static u64 read64(const u8 *p)
+    // Return the little-endian 64-bit integer at the specified 'p'.  The
+    // behavior is undefined unless 'p' points to at least 8 bytes of
+    // initialized memory.
+{
+    u64 ret;
+    memcpy(&ret, p, sizeof(ret));
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(ret);
+}
+
+inline
+static u64 read32(const u8 *p)
+    // Return the little-endian 32-bit integer at the specified 'p'.  The
+    // behavior is undefined unless 'p' points to at least 4 bytes of
+    // initialized memory.
+{
+    unsigned int ret;
+    memcpy(&ret, p, sizeof(ret));
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(ret);
+}
+
+inline
+static u64 read3(const u8 *p, size_t length)
+    // Return an integer combining the first, middle, and last bytes of the
+    // specified 'p' of the specified 'length'.  The behavior is undefined
+    // unless '1 <= length <= 3'.
+{
+    return static_cast<u64>(p[0]) << 16
+         | static_cast<u64>(p[length >> 1]) << 8
+         | p[length - 1];
+}
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE CLASS METHODS
+WyHashAlgorithm::Uint64 WyHashAlgorithm::initialState(Uint64 seed)
+{
+    return seed ^ mix(seed ^ s_secret[0], s_secret[1]);
+}
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::consume(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT(k_STRIPE_LENGTH < d_bufferLength + numBytes);
+
+    d_totalLength += numBytes;
+
+    u64 seed = d_seed;
+    u64 see1 = d_see1;
+    u64 see2 = d_see2;
+
+    if (d_bufferLength) {
+        const size_t fill = k_STRIPE_LENGTH - d_bufferLength;
+        memcpy(d_buffer + d_bufferLength, data, fill);
+        data     += fill;
+        numBytes -= fill;
+
+        seed = mix(read64(d_buffer)      ^ s_secret[1],
+                   read64(d_buffer + 8)  ^ seed);
+        see1 = mix(read64(d_buffer + 16) ^ s_secret[2],
+                   read64(d_buffer + 24) ^ see1);
+        see2 = mix(read64(d_buffer + 32) ^ s_secret[3],
+                   read64(d_buffer + 40) ^ see2);
+    }
+
+    if (k_STRIPE_LENGTH < numBytes) {
+        do {
+            seed = mix(read64(data)      ^ s_secret[1],
+                       read64(data + 8)  ^ seed);
+            see1 = mix(read64(data + 16) ^ s_secret[2],
+                       read64(data + 24) ^ see1);
+            see2 = mix(read64(data + 32) ^ s_secret[3],
+                       read64(data + 40) ^ see2);
+            data     += k_STRIPE_LENGTH;
+            numBytes -= k_STRIPE_LENGTH;
+        } while (k_STRIPE_LENGTH < numBytes);
+
+        memcpy(d_buffer + k_STRIPE_LENGTH - 16, data - 16, 16);
+    }
+
+    memcpy(d_buffer, data, numBytes);
+    d_bufferLength = numBytes;
+
+    d_seed = seed;
+    d_see1 = see1;
+    d_see2 = see2;
+}
+
+// MANIPULATORS
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    const size_t  length = d_totalLength;
+    u64           seed   = d_seed;
+    u64           a;
+    u64           b;
+
+    if (length <= 16) {
+        const u8 *p = d_buffer;
+        if (4 <= length) {
+            const size_t offset = (length >> 3) << 2;
+            a = read32(p) << 32 | read32(p + offset);
+            b = read32(p + length - 4) << 32 | read32(p + length - 4 - offset);
+        }
+        else if (0 < length) {
+            a = read3(p, length);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        if (k_STRIPE_LENGTH < length) {
+            seed ^= d_see1 ^ d_see2;
+        }
+
+        const u8 *p = d_buffer;
+        size_t    i = d_bufferLength;
+        while (16 < i) {
+            seed = mix(read64(p) ^ s_secret[1], read64(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+
+        if (16 <= d_bufferLength) {
+            a = read64(p + i - 16);
+            b = read64(p + i - 8);
+        }
+        else {
+            // The last 16 bytes of the input start in the tail of the last
+            // consumed stripe, which is preserved at the end of the buffer.
+
+            u8           last[16];
+            const size_t tail = 16 - d_bufferLength;
+            memcpy(last, d_buffer + k_STRIPE_LENGTH - tail, tail);
+            memcpy(last + tail, d_buffer, d_bufferLength);
+            a = read64(last);
+            b = read64(last + 8);
+        }
+    }
+
+    a ^= s_secret[1];
+    b ^= seed;
+    multiply(&a, &b);
+    return mix(a ^ s_secret[0] ^ length, b ^ s_secret[1]);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
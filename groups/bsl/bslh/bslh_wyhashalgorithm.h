@@ -0,0 +1,315 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_xxhash3algorithm, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the wyhash algorithm (final
+// version 4) by Wang Yi.  This is a general purpose, non-cryptographic
+// algorithm built from a single primitive -- a 64x64 to 128-bit multiplication
+// whose halves are folded together with XOR -- that reaches good avalanche
+// performance with very little work per byte.  It is particularly fast on
+// short keys, such as symbols, identifiers, and 64-bit integers, where
+// algorithms that set up a large internal state (e.g., SpookyHash) or perform
+// several rounds per word (e.g., SipHash) spend most of their time in setup
+// and finalization.  For more information, see:
+// https://github.com/wangyi-fudan/wyhash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh'.
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm, even if they do not know
+// the seed.  If security is required, an algorithm that documents better
+// secure properties should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  Keys of up to 16 bytes are hashed with two
+// 128-bit multiplications, and longer keys are consumed 48 bytes at a time in
+// three independent lanes.  The state of the algorithm is small (about 100
+// bytes), so constructing a 'bslh::WyHashAlgorithm' is cheap.  Data passed to
+// 'operator()' is buffered so that the result does not depend on how the
+// input is split; hashing a key through a single call to 'operator()' is
+// therefore faster than hashing it through many small calls.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  wyhash passes the SMHasher test suite.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent: input is always read as
+// little-endian words, so the same sequence of bytes and the same seed
+// produce the same hash on every platform.  The hashes produced are identical
+// to those of the canonical implementation of wyhash (final version 4) using
+// its default secret, where the seed is the 'k_SEED_LENGTH' bytes supplied at
+// construction interpreted as a little-endian 64-bit integer (or 0 for a
+// default-constructed object).  Note that future versions of the canonical
+// wyhash algorithm have, in the past, changed their output; hashes from
+// 'bslh::WyHashAlgorithm' should not be persisted or sent across a network.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing a Symbol Incrementally
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we need to hash ticker symbols that are delivered to us in two
+// parts, an exchange code and a ticker, and look them up in a hash table
+// keyed by the full symbol.  The hash must be the same whether the symbol is
+// hashed in parts or as a whole.
+//
+// First, we hash the full symbol in a single call:
+//..
+//  const char *symbol = "XNYS:IBM";
+//
+//  bslh::WyHashAlgorithm wholeHasher;
+//  wholeHasher(symbol, strlen(symbol));
+//  bslh::WyHashAlgorithm::result_type wholeHash = wholeHasher.computeHash();
+//..
+// Then, we hash the same bytes in two parts:
+//..
+//  bslh::WyHashAlgorithm partHasher;
+//  partHasher("XNYS:", 5);
+//  partHasher("IBM",   3);
+//  bslh::WyHashAlgorithm::result_type partHash = partHasher.computeHash();
+//..
+// Next, we observe that the two hashes are the same:
+//..
+//  assert(wholeHash == partHash);
+//..
+// Finally, we hash the symbol using a seeded instance of the algorithm, as
+// a 'bslh::SeededHash' would, and observe that the seed changes the result:
+//..
+//  const char seed[bslh::WyHashAlgorithm::k_SEED_LENGTH] = {
+//                                         'a', 'b', 'c', 'd', 'e', 'f', 'g' };
+//
+//  bslh::WyHashAlgorithm seededHasher(seed);
+//  seededHasher(symbol, strlen(symbol));
+//  assert(wholeHash != seededHasher.computeHash());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class wraps an implementation of the "wyhash" hash algorithm in an
+    // interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    // PRIVATE CONSTANTS
+    enum { k_STRIPE_LENGTH = 48 };  // bytes consumed by one step of the
+                                    // algorithm
+
+    // DATA
+    Uint64        d_seed;     // running state of the first lane, initially
+                              // the mixed seed
+
+    Uint64        d_see1;     // running state of the second lane
+
+    Uint64        d_see2;     // running state of the third lane
+
+    size_t        d_totalLength;
+                              // total number of bytes passed to 'operator()'
+
+    size_t        d_bufferLength;
+                              // number of bytes in 'd_buffer' that have not
+                              // been consumed
+
+    unsigned char d_buffer[k_STRIPE_LENGTH];
+                              // input not yet consumed, followed, if
+                              // 'd_bufferLength < 16', by the tail of the
+                              // last consumed stripe
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 initialState(Uint64 seed);
+        // Return the initial state of the first lane of the algorithm for the
+        // specified 'seed'.
+
+    // PRIVATE MANIPULATORS
+    void consume(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', of the specified 'numBytes', into
+        // the internal state of this object, consuming every complete stripe
+        // that is known to be followed by more input and buffering the rest.
+        // The behavior is undefined unless
+        // 'k_STRIPE_LENGTH < d_bufferLength + numBytes'.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behaviour is undefined unless
+        // 'seed' points to at least 8 bytes of initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+: d_seed(initialState(0))
+, d_see1(d_seed)
+, d_see2(d_seed)
+, d_totalLength(0)
+, d_bufferLength(0)
+{
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+: d_totalLength(0)
+, d_bufferLength(0)
+{
+    BSLS_ASSERT(seed);
+
+    // Assemble the seed byte by byte to avoid unaligned reads and to produce
+    // the same hashes on all platforms.
+
+    Uint64 value = 0;
+    for (int i = k_SEED_LENGTH - 1; 0 <= i; --i) {
+        value = value << 8 | static_cast<unsigned char>(seed[i]);
+    }
+
+    d_seed = initialState(value);
+    d_see1 = d_seed;
+    d_see2 = d_seed;
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (d_bufferLength + numBytes <= k_STRIPE_LENGTH) {
+        // It is not yet known whether a full buffer will be followed by more
+        // input, so buffer the data; this is the common case for short keys.
+
+        if (numBytes) {
+            memcpy(d_buffer + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+            d_totalLength  += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    consume(static_cast<const unsigned char *>(data), numBytes);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,818 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm
+// (the test vectors published with the canonical implementation of wyhash).
+// Since the algorithm buffers its input, we also verify that the result does
+// not depend on how the input is split across calls to 'operator()'.  The
+// component will also be tested for conformance to the requirements on 'bslh'
+// hashing algorithms, outlined in the 'bslh' package level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// [ 7] void operator()(void const* key, size_t len);
+// [ 7] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 8] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm Obj;
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void makeSeed(char *seed, Uint64 value)
+    // Load into the specified 'seed' the 'Obj::k_SEED_LENGTH' bytes of the
+    // little-endian representation of the specified 'value'.
+{
+    for (int i = 0; i < Obj::k_SEED_LENGTH; ++i) {
+        seed[i] = static_cast<char>(value >> (8 * i));
+    }
+}
+
+static void fillPseudoRandom(unsigned char *buffer, int length)
+    // Load into the specified 'buffer' the specified 'length' bytes of a
+    // fixed pseudo-random sequence.
+{
+    unsigned int state = 1;
+    for (int i = 0; i < length; ++i) {
+        state = state * 1103515245 + 12345;
+        buffer[i] = static_cast<unsigned char>(state >> 16);
+    }
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing a Symbol Incrementally
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we need to hash ticker symbols that are delivered to us in two
+// parts, an exchange code and a ticker, and look them up in a hash table
+// keyed by the full symbol.  The hash must be the same whether the symbol is
+// hashed in parts or as a whole.
+//
+// First, we hash the full symbol in a single call:
+//..
+    const char *symbol = "XNYS:IBM";
+
+    bslh::WyHashAlgorithm wholeHasher;
+    wholeHasher(symbol, strlen(symbol));
+    bslh::WyHashAlgorithm::result_type wholeHash = wholeHasher.computeHash();
+//..
+// Then, we hash the same bytes in two parts:
+//..
+    bslh::WyHashAlgorithm partHasher;
+    partHasher("XNYS:", 5);
+    partHasher("IBM",   3);
+    bslh::WyHashAlgorithm::result_type partHash = partHasher.computeHash();
+//..
+// Next, we observe that the two hashes are the same:
+//..
+    ASSERT(wholeHash == partHash);
+//..
+// Finally, we hash the symbol using a seeded instance of the algorithm, as
+// a 'bslh::SeededHash' would, and observe that the seed changes the result:
+//..
+    const char seed[bslh::WyHashAlgorithm::k_SEED_LENGTH] = {
+                                           'a', 'b', 'c', 'd', 'e', 'f', 'g' };
+
+    bslh::WyHashAlgorithm seededHasher(seed);
+    seededHasher(symbol, strlen(symbol));
+    ASSERT(wholeHash != seededHasher.computeHash());
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING SEEDED AND SEGMENTED INPUT
+        //   Verify that the seed is incorporated as specified by wyhash, and
+        //   that input longer than the internal buffer produces the same hash
+        //   however it is split across calls to 'operator()'.
+        //
+        // Concerns:
+        //: 1 A seeded object produces the hashes of the canonical wyhash
+        //:   implementation with the seed interpreted as a little-endian
+        //:   64-bit integer, for inputs that exercise every code path.
+        //:
+        //: 2 The hash does not depend on how input of any length is split
+        //:   across calls to 'operator()', in particular when a call ends or
+        //:   starts exactly on, or one byte from, a 48-byte stripe boundary.
+        //:
+        //: 3 The hash depends on every byte of the seed.
+        //
+        // Plan:
+        //: 1 Hash the messages of the canonical test vectors with the seeds
+        //:   used by those vectors and compare against the published results.
+        //:   (C-1)
+        //:
+        //: 2 For every length from 0 to 300, and for several longer lengths,
+        //:   hash a pseudo-random buffer in one call and in chunks of every
+        //:   size from 1 to 100, with and without a seed, and verify that the
+        //:   results are the same.  (C-2)
+        //:
+        //: 3 Verify that flipping any bit of the seed changes the hash.  (C-3)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING SEEDED AND SEGMENTED INPUT"
+                            "\n==================================\n");
+
+        if (verbose) printf("Compare against the canonical test vectors."
+                            " (C-1)\n");
+        {
+            static const struct {
+                int         d_line;
+                const char *d_value;
+                Uint64      d_seed;
+                Uint64      d_expectedHash;
+            } DATA[] = {
+                // LINE  VALUE  SEED  HASH
+                { L_, "", 0, 0x93228a4de0eec5a2ULL },
+                { L_, "a", 1, 0xc5bac3db178713c4ULL },
+                { L_, "abc", 2, 0xa97f2f7b1d9b3314ULL },
+                { L_, "message digest", 3, 0x786d1f1df3801df4ULL },
+                { L_, "abcdefghijklmnopqrstuvwxyz", 4,
+                                                      0xdca5a8138ad37c87ULL },
+                { L_, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                      "0123456789", 5, 0xb9e734f117cfaf70ULL },
+                { L_, "1234567890123456789012345678901234567890"
+                      "1234567890123456789012345678901234567890", 6,
+                                                      0x6cc5eab49a92d617ULL },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int     LINE  = DATA[i].d_line;
+                const char   *VALUE = DATA[i].d_value;
+                const Uint64  SEED  = DATA[i].d_seed;
+                const Uint64  HASH  = DATA[i].d_expectedHash;
+
+                if (veryVerbose) { P_(LINE) P_(VALUE) P(SEED) }
+
+                char seed[Obj::k_SEED_LENGTH];
+                makeSeed(seed, SEED);
+
+                Obj hash(seed);
+                hash(VALUE, strlen(VALUE));
+                LOOP_ASSERT(LINE, HASH == hash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Hash input in chunks of varying sizes. (C-2)\n");
+        {
+            enum { k_MAX_LENGTH = 1100 };
+
+            unsigned char buffer[k_MAX_LENGTH];
+            fillPseudoRandom(buffer, k_MAX_LENGTH);
+
+            static const int LONG_LENGTHS[] = { 479, 480, 481, 1055, 1056,
+                                                1057, k_MAX_LENGTH };
+            const int NUM_LONG_LENGTHS =
+                                   sizeof LONG_LENGTHS / sizeof *LONG_LENGTHS;
+
+            char seed[Obj::k_SEED_LENGTH];
+            makeSeed(seed, 0x0123456789abcdefULL);
+
+            for (int i = 0; i <= 300 + NUM_LONG_LENGTHS; ++i) {
+                const int LENGTH = i <= 300 ? i : LONG_LENGTHS[i - 301];
+
+                if (veryVerbose) { P(LENGTH) }
+
+                Obj wholeHash;
+                wholeHash(buffer, LENGTH);
+                const Uint64 EXPECTED = wholeHash.computeHash();
+
+                Obj wholeSeededHash(seed);
+                wholeSeededHash(buffer, LENGTH);
+                const Uint64 EXPECTED_SEEDED = wholeSeededHash.computeHash();
+
+                LOOP_ASSERT(LENGTH, EXPECTED != EXPECTED_SEEDED);
+
+                for (int chunk = 1; chunk <= 100; ++chunk) {
+                    Obj hash;
+                    Obj seededHash(seed);
+                    for (int offset = 0; offset < LENGTH; offset += chunk) {
+                        const int n = LENGTH - offset < chunk
+                                    ? LENGTH - offset
+                                    : chunk;
+                        hash(buffer + offset, n);
+                        seededHash(buffer + offset, n);
+                    }
+                    LOOP2_ASSERT(LENGTH, chunk,
+                                 EXPECTED == hash.computeHash());
+                    LOOP2_ASSERT(LENGTH, chunk,
+                                 EXPECTED_SEEDED == seededHash.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Verify that every bit of the seed contributes."
+                            " (C-3)\n");
+        {
+            const char *VALUE = "12345678";
+
+            char seed[Obj::k_SEED_LENGTH] = { 0 };
+
+            Obj unflipped(seed);
+            unflipped(VALUE, strlen(VALUE));
+            const Uint64 EXPECTED = unflipped.computeHash();
+
+            for (int bit = 0; bit < 8 * Obj::k_SEED_LENGTH; ++bit) {
+                seed[bit / 8] = static_cast<char>(1 << (bit % 8));
+
+                Obj hash(seed);
+                hash(VALUE, strlen(VALUE));
+                LOOP_ASSERT(bit, EXPECTED != hash.computeHash());
+
+                seed[bit / 8] = 0;
+            }
+        }
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the 'bslalg::HasTrait'
+        //:   metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslalg::HasTrait' metafunction. (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<WyHashAlgorithm>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == WyHashAlgorithm::k_SEED_LENGTH);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                  Obj::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            expectedSignature = &Obj::computeHash;
+            (void)expectedSignature;
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by wyhash.  Verify that 'computeHash()' returns
+        //   the final value specified by the canonical wyhash implementation.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 Given the same bytes, the function call operator will permute the
+        //:   internal state of the algorithm in the same way, regardless of
+        //:   whether the bytes are passed in all at once or in pieces.
+        //:
+        //: 3 Byte sequences passed in to 'operator()' with a length of 0 will
+        //:   not contribute to the final hash
+        //:
+        //: 4 'computeHash()' and returns the appropriate value
+        //:   according to the wyhash specification.
+        //:
+        //: 5 'operator()' does a BSLS_ASSERT for null pointers and non-zero
+        //:   length, and not for null pointers and zero length.
+        //
+        // Plan:
+        //: 1 Insert various lengths of c-strings into the algorithm both all
+        //:   at once and char by char using 'operator()'.  Assert that the
+        //:   algorithm produces the same result in both cases. (C-1,2)
+        //:
+        //: 2 Hash c-strings all at once and with multiple calls to
+        //:   'operator()' with length 0.  Assert that both methods of hashing
+        //:   c-strings produce the same values.(C-3)
+        //:
+        //: 3 Check the output of 'computeHash()' against the expected results
+        //:   from a known good version of the algorithm. (C-4)
+        //:
+        //: 4 Call 'operator()' with a null pointer. (C-5)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        static const struct {
+            int                  d_line;
+            const char           d_value [21];
+            bsls::Types::Uint64  d_expectedHash;
+        } DATA[] = {
+        // LINE DATA               HASH
+         {  L_,                     "1", 14530020785791580170ULL,},
+         {  L_,                    "12",  9843717798896708226ULL,},
+         {  L_,                   "123",  3129789143644569579ULL,},
+         {  L_,                  "1234",  9479618551612963370ULL,},
+         {  L_,                 "12345",  3963873508453707620ULL,},
+         {  L_,                "123456", 16880224817819365153ULL,},
+         {  L_,               "1234567", 17238209688330046621ULL,},
+         {  L_,              "12345678", 16884480881891038673ULL,},
+         {  L_,             "123456789",  6986004815908187255ULL,},
+         {  L_,            "1234567890",  2651239019635830564ULL,},
+         {  L_,           "12345678901",  5996526293929543982ULL,},
+         {  L_,          "123456789012", 13076667019151633514ULL,},
+         {  L_,         "1234567890123",  4070803974053074645ULL,},
+         {  L_,        "12345678901234",  3279594353762576381ULL,},
+         {  L_,       "123456789012345",  8716315145871469487ULL,},
+         {  L_,      "1234567890123456",    78302340168896960ULL,},
+         {  L_,     "12345678901234567", 18192345620073581257ULL,},
+         {  L_,    "123456789012345678", 10867889578446987524ULL,},
+         {  L_,   "1234567890123456789", 12410676863811293513ULL,},
+         {  L_,  "12345678901234567890", 17014185259216636145ULL,},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("Insert various lengths of c-strings into the"
+                            " algorithm both all at once and char by char"
+                            " using 'operator()'.  Assert that the algorithm"
+                            " produces the same result in both cases. (C-1,2)"
+                            "\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value;
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj contiguousHash;
+                Obj dispirateHash;
+
+                contiguousHash(VALUE, strlen(VALUE));
+                for (unsigned int j = 0; j < strlen(VALUE); ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Hash c-strings all at once and with multiple"
+                            " calls to 'operator()' with length 0.  Assert"
+                            " that both methods of hashing c-strings produce"
+                            " the same values.(C-3)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value;
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj contiguousHash;
+                Obj dispirateHash;
+
+                contiguousHash(VALUE, strlen(VALUE));
+                for (unsigned int j = 0; j < strlen(VALUE); ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                    dispirateHash(VALUE, 0);
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Check the output of 'computeHash()' against the"
+                            " expected results from a known good version of"
+                            " the algorithm. (C-4)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int                LINE  = DATA[i].d_line;
+                const char              *VALUE = DATA[i].d_value;
+                const unsigned long long HASH  = DATA[i].d_expectedHash;
+
+                if (veryVerbose) printf("Hashing: %s, Expecting: %llu\n",
+                                        VALUE,
+                                        HASH);
+
+                Obj hash;
+                hash(VALUE, strlen(VALUE));
+                LOOP_ASSERT(LINE, hash.computeHash() == HASH);
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-5)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(   0, 0));
+            ASSERT_PASS(Obj().operator()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and parameterized constructors are publicly callable.
+        //   Verify that the algorithm can be instantiated with or without a
+        //   seed.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 A default-constructed object behaves as if seeded with 8 zero
+        //:   bytes.
+        //:
+        //: 5 The parameterized constructor does a BSLS_ASSERT for a null
+        //:   seed.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'WyHashAlgorithm' and allow it to
+        //:   leave scope to be destroyed. (C-1,3)
+        //:
+        //: 2 Call the parameterized constructor with a seed. (C-2)
+        //:
+        //: 3 Hash the same value with a default-constructed object and with an
+        //:   object seeded with zeros, and compare the results.  (C-4)
+        //:
+        //: 4 Call the parameterized constructor with a null pointer. (C-5)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS"
+                   "\n================\n");
+
+        if (verbose) printf("Create a default constructed"
+                            " 'WyHashAlgorithm' and allow it to leave"
+                            " scope to be destroyed. (C-1,3)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a seed."
+                            " (C-2)\n");
+        {
+            Uint64 value = 0;
+            Obj alg1(reinterpret_cast<const char *>(&value));
+        }
+
+        if (verbose) printf("Compare the default seed with a zero seed."
+                            " (C-4)\n");
+        {
+            const char seed[Obj::k_SEED_LENGTH] = { 0 };
+
+            Obj alg1;
+            Obj alg2(seed);
+            alg1("abc", 3);
+            alg2("abc", 3);
+            ASSERT(alg1.computeHash() == alg2.computeHash());
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a null"
+                            " pointer. (C-5)\n");
+        {
+            const char seed[Obj::k_SEED_LENGTH] = { 0 };
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL((void)Obj(static_cast<const char *>(0)));
+            ASSERT_PASS((void)Obj(seed));
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bslh::WyHashAlgorithm'\n");
+        {
+            WyHashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different 'int's.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " 'int's.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,561 @@
+// bslh_xxhash3algorithm.cpp                                          -*-C++-*-
+#include <bslh_xxhash3algorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_byteorderutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)
+#include <emmintrin.h>
+#define BSLH_XXHASH3ALGORITHM_SSE2 1
+#endif
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#include <intrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The canonical implementation of XXH3 hashes a contiguous key in one pass.
+// Keys of at most 240 bytes are hashed by dedicated functions that read the
+// key at fixed (possibly overlapping) offsets.  Longer keys are divided into
+// 64-byte stripes; every stripe that is followed by at least one more byte is
+// accumulated into eight 64-bit lanes, using a window of the secret that
+// advances by 8 bytes per stripe, and the lanes are scrambled after each block
+// of 16 stripes (1024 bytes).  The *last* 64 bytes of the key -- which may
+// overlap bytes already accumulated -- are then accumulated with a fixed
+// window of the secret, and the lanes are merged into the result.
+//
+// To produce the same hashes however the key is split across calls to
+// 'operator()', this implementation buffers the first 256 bytes of input, so
+// that keys of at most 240 bytes are hashed from the buffer by the short-key
+// functions, and thereafter consumes a stripe only once it is known that at
+// least one more byte follows it.  When a full buffer is consumed, or stripes
+// are consumed directly from the caller's data, the last 64 bytes of consumed
+// input are left at (or copied to) the end of the buffer; since at most 63
+// bytes of new input are buffered when those bytes are needed, they are never
+// overwritten, and 'computeHash' can reconstruct the last stripe of the key.
+// This is the same scheme used by the streaming interface of the canonical
+// implementation.
+
+namespace BloombergLP {
+
+namespace bslh {
+
+typedef bsls::Types::Uint64 u64;
+typedef unsigned int        u32;
+typedef unsigned char       u8;
+
+enum {
+    k_STRIPE_LENGTH       = 64,  // bytes consumed by one step of the long-key
+                                 // path
+
+    k_STRIPES_PER_BLOCK   = 16,  // stripes consumed between scrambles
+
+    k_MIDSIZE_MAX         = 240, // longest key hashed without stripes
+
+    k_SECRET_SIZE         = 192, // length of the secret
+
+    k_LAST_STRIPE_OFFSET  = k_SECRET_SIZE - k_STRIPE_LENGTH - 7,
+                                 // offset into the secret used for the last
+                                 // stripe
+
+    k_MERGE_OFFSET        = 11   // offset into the secret used to merge the
+                                 // accumulators
+};
+
+static const u8 s_secret[k_SECRET_SIZE] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe,
+    0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+    0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78,
+    0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e,
+    0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+    0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e,
+    0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f,
+    0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+    0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3,
+    0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49,
+    0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+    0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28,
+    0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+    // Default secret of the canonical XXH3 implementation.
+
+static const u32 k_PRIME32_1 = 0x9E3779B1U;
+static const u32 k_PRIME32_2 = 0x85EBCA77U;
+static const u32 k_PRIME32_3 = 0xC2B2AE3DU;
+
+static const u64 k_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const u64 k_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const u64 k_PRIME64_3 = 0x165667B19E3779F9ULL;
+static const u64 k_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const u64 k_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+static const u64 k_PRIME_MX1 = 0x165667919E3779F9ULL;
+static const u64 k_PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+inline
+static u64 read64(const u8 *p)
+    // Return the little-endian 64-bit integer at the specified 'p'.  The
+    // behavior is undefined unless 'p' points to at least 8 bytes of
+    // initialized memory.
+{
+    u64 ret;
+    memcpy(&ret, p, sizeof(ret));
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(ret);
+}
+
+inline
+static u32 read32(const u8 *p)
+    // Return the little-endian 32-bit integer at the specified 'p'.  The
+    // behavior is undefined unless 'p' points to at least 4 bytes of
+    // initialized memory.
+{
+    u32 ret;
+    memcpy(&ret, p, sizeof(ret));
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(ret);
+}
+
+inline
+static void write64(u8 *p, u64 value)
+    // Store the specified 'value' as a little-endian 64-bit integer at the
+    // specified 'p'.
+{
+    value = BSLS_BYTEORDER_HOST_U64_TO_LE(value);
+    memcpy(p, &value, sizeof(value));
+}
+
+inline
+static u64 rotl(u64 x, int b)
+    // Return the bits of the specified 'x' rotated to the left by the
+    // specified 'b' number of bits.  The behavior is undefined unless
+    // '0 < b < 64'.
+{
+    return (x << b) | (x >> (64 - b));
+}
+
+inline
+static u64 multiplyFold(u64 a, u64 b)
+    // Return the XOR of the low and high halves of the 128-bit product of the
+    // specified 'a' and 'b'.
+{
+#if (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))     \
+ && defined(BSLS_PLATFORM_CPU_64_BIT)
+    __extension__ typedef unsigned __int128 u128;
+
+    const u128 product = static_cast<u128>(a) * b;
+    return static_cast<u64>(product) ^ static_cast<u64>(product >> 64);
+#elif defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    u64 high;
+    u64 low = _umul128(a, b, &high);
+    return low ^ high;
+#else
+    const u64 loLo  = (a & 0xffffffff) * (b & 0xffffffff);
+    const u64 hiLo  = (a >> 32)        * (b & 0xffffffff);
+    const u64 loHi  = (a & 0xffffffff) * (b >> 32);
+    const u64 hiHi  = (a >> 32)        * (b >> 32);
+    const u64 cross = (loLo >> 32) + (hiLo & 0xffffffff) + loHi;
+    const u64 high  = (hiLo >> 32) + (cross >> 32) + hiHi;
+    const u64 low   = (cross << 32) | (loLo & 0xffffffff);
+    return low ^ high;
+#endif
+}
+
+inline
+static u64 xxh64Avalanche(u64 h)
+    // Return the specified 'h' mixed by the final step of XXH64.
+{
+    h ^= h >> 33;
+    h *= k_PRIME64_2;
+    h ^= h >> 29;
+    h *= k_PRIME64_3;
+    h ^= h >> 32;
+    return h;
+}
+
+inline
+static u64 avalanche(u64 h)
+    // Return the specified 'h' mixed by the final step of XXH3.
+{
+    h ^= h >> 37;
+    h *= k_PRIME_MX1;
+    h ^= h >> 32;
+    return h;
+}
+
+inline
+static u64 rrmxmx(u64 h, u64 length)
+    // Return the specified 'h' mixed with the specified 'length' by the
+    // stronger final step used by XXH3 for keys of 4 to 8 bytes.
+{
+    h ^= rotl(h, 49) ^ rotl(h, 24);
+    h *= k_PRIME_MX2;
+    h ^= (h >> 35) + length;
+    h *= k_PRIME_MX2;
+    return h ^ (h >> 28);
+}
+
+inline
+static u64 mix16(const u8 *input, const u8 *secret, u64 seed)
+    // Return the mix of the 16 bytes at the specified 'input' with the 16
+    // bytes at the specified 'secret' and the specified 'seed'.
+{
+    return multiplyFold(read64(input)     ^ (read64(secret)     + seed),
+                        read64(input + 8) ^ (read64(secret + 8) - seed));
+}
+
+static u64 hashShort(const u8 *input, size_t length, u64 seed)
+    // Return the XXH3 hash, with the specified 'seed', of the specified
+    // 'input' of the specified 'length'.  The behavior is undefined unless
+    // 'length <= k_MIDSIZE_MAX'.
+{
+    const u8 *secret = s_secret;
+
+    if (length <= 16) {
+        if (8 < length) {
+            const u64 bitflip1 = (read64(secret + 24) ^ read64(secret + 32))
+                               + seed;
+            const u64 bitflip2 = (read64(secret + 40) ^ read64(secret + 48))
+                               - seed;
+            const u64 lo = read64(input) ^ bitflip1;
+            const u64 hi = read64(input + length - 8) ^ bitflip2;
+            const u64 acc = length + bsls::ByteOrderUtil::swapBytes64(lo) + hi
+                          + multiplyFold(lo, hi);
+            return avalanche(acc);                                    // RETURN
+        }
+        if (4 <= length) {
+            seed ^= static_cast<u64>(bsls::ByteOrderUtil::swapBytes32(
+                                           static_cast<u32>(seed))) << 32;
+            const u64 input1  = read32(input);
+            const u64 input2  = read32(input + length - 4);
+            const u64 bitflip = (read64(secret + 8) ^ read64(secret + 16))
+                              - seed;
+            const u64 keyed   = (input2 + (input1 << 32)) ^ bitflip;
+            return rrmxmx(keyed, length);                             // RETURN
+        }
+        if (0 < length) {
+            const u32 combined = static_cast<u32>(input[0]) << 16
+                               | static_cast<u32>(input[length >> 1]) << 24
+                               | static_cast<u32>(input[length - 1])
+                               | static_cast<u32>(length) << 8;
+            const u64 bitflip  = (read32(secret) ^ read32(secret + 4)) + seed;
+            return xxh64Avalanche(combined ^ bitflip);                // RETURN
+        }
+        return xxh64Avalanche(seed ^ read64(secret + 56)
+                                   ^ read64(secret + 64));            // RETURN
+    }
+
+    u64 acc = length * k_PRIME64_1;
+
+    if (length <= 128) {
+        if (32 < length) {
+            if (64 < length) {
+                if (96 < length) {
+                    acc += mix16(input + 48, secret + 96, seed);
+                    acc += mix16(input + length - 64, secret + 112, seed);
+                }
+                acc += mix16(input + 32, secret + 64, seed);
+                acc += mix16(input + length - 48, secret + 80, seed);
+            }
+            acc += mix16(input + 16, secret + 32, seed);
+            acc += mix16(input + length - 32, secret + 48, seed);
+        }
+        acc += mix16(input, secret, seed);
+        acc += mix16(input + length - 16, secret + 16, seed);
+        return avalanche(acc);                                        // RETURN
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        acc += mix16(input + 16 * i, secret + 16 * i, seed);
+    }
+    acc = avalanche(acc);
+
+    const int numRounds = static_cast<int>(length / 16);
+    for (int i = 8; i < numRounds; ++i) {
+        acc += mix16(input + 16 * i, secret + 16 * (i - 8) + 3, seed);
+    }
+    acc += mix16(input + length - 16, secret + 136 - 17, seed);
+    return avalanche(acc);
+}
+
+#if defined(BSLH_XXHASH3ALGORITHM_SSE2)
+inline
+static __m128i accumulateLane(__m128i acc, const void *input, const void *key)
+    // Return the specified 'acc' after accumulating the 16 bytes at the
+    // specified 'input' mixed with the 16 bytes at the specified 'key'.
+{
+    const __m128i data      = _mm_loadu_si128(
+                                      static_cast<const __m128i *>(input));
+    const __m128i dataKey   = _mm_xor_si128(
+                                  data,
+                                  _mm_loadu_si128(
+                                        static_cast<const __m128i *>(key)));
+    const __m128i dataKeyHi = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0,3,0,1));
+    const __m128i product   = _mm_mul_epu32(dataKey, dataKeyHi);
+    const __m128i swapped   = _mm_shuffle_epi32(data, _MM_SHUFFLE(1,0,3,2));
+    return _mm_add_epi64(_mm_add_epi64(acc, swapped), product);
+}
+#endif
+
+static void accumulate(u64       *accumulators,
+                       const u8  *input,
+                       const u8  *secret,
+                       size_t     numStripes)
+    // Accumulate the specified 'numStripes' stripes at the specified 'input'
+    // into the specified 'accumulators', using a window of the specified
+    // 'secret' that advances by 8 bytes per stripe.
+{
+#if defined(BSLH_XXHASH3ALGORITHM_SSE2)
+    // The four lanes are kept in named variables, rather than an array, so
+    // that they stay in registers across stripes.
+
+    __m128i *acc  = reinterpret_cast<__m128i *>(accumulators);
+    __m128i  acc0 = _mm_loadu_si128(acc);
+    __m128i  acc1 = _mm_loadu_si128(acc + 1);
+    __m128i  acc2 = _mm_loadu_si128(acc + 2);
+    __m128i  acc3 = _mm_loadu_si128(acc + 3);
+
+    for (size_t n = 0; n < numStripes; ++n) {
+        const u8 *in  = input + n * k_STRIPE_LENGTH;
+        const u8 *key = secret + n * 8;
+
+        acc0 = accumulateLane(acc0, in,      key);
+        acc1 = accumulateLane(acc1, in + 16, key + 16);
+        acc2 = accumulateLane(acc2, in + 32, key + 32);
+        acc3 = accumulateLane(acc3, in + 48, key + 48);
+    }
+
+    _mm_storeu_si128(acc,     acc0);
+    _mm_storeu_si128(acc + 1, acc1);
+    _mm_storeu_si128(acc + 2, acc2);
+    _mm_storeu_si128(acc + 3, acc3);
+#else
+    for (size_t n = 0; n < numStripes; ++n) {
+        const u8 *in  = input + n * k_STRIPE_LENGTH;
+        const u8 *key = secret + n * 8;
+        for (int i = 0; i < 8; ++i) {
+            const u64 data    = read64(in + 8 * i);
+            const u64 dataKey = data ^ read64(key + 8 * i);
+            accumulators[i ^ 1] += data;
+            accumulators[i]     += (dataKey & 0xffffffff) * (dataKey >> 32);
+        }
+    }
+#endif
+}
+
+static void scramble(u64 *accumulators, const u8 *secret)
+    // Scramble the specified 'accumulators' with the 64 bytes at the
+    // specified 'secret'.
+{
+#if defined(BSLH_XXHASH3ALGORITHM_SSE2)
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(k_PRIME32_1));
+    __m128i      *acc   = reinterpret_cast<__m128i *>(accumulators);
+    const __m128i *key  = reinterpret_cast<const __m128i *>(secret);
+    for (int i = 0; i < 4; ++i) {
+        __m128i value = _mm_loadu_si128(acc + i);
+        value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+        value = _mm_xor_si128(value, _mm_loadu_si128(key + i));
+        const __m128i valueHi = _mm_shuffle_epi32(value, _MM_SHUFFLE(0,3,0,1));
+        const __m128i productLo = _mm_mul_epu32(value, prime);
+        const __m128i productHi = _mm_mul_epu32(valueHi, prime);
+        _mm_storeu_si128(acc + i,
+                         _mm_add_epi64(productLo,
+                                       _mm_slli_epi64(productHi, 32)));
+    }
+#else
+    for (int i = 0; i < 8; ++i) {
+        u64 value = accumulators[i];
+        value ^= value >> 47;
+        value ^= read64(secret + 8 * i);
+        value *= k_PRIME32_1;
+        accumulators[i] = value;
+    }
+#endif
+}
+
+static void consumeStripes(u64       *accumulators,
+                           size_t    *numStripesInBlock,
+                           const u8  *input,
+                           size_t     numStripes,
+                           const u8  *secret)
+    // Accumulate the specified 'numStripes' stripes at the specified 'input'
+    // into the specified 'accumulators' using the specified 'secret',
+    // scrambling the accumulators whenever a block is completed, and update
+    // the specified 'numStripesInBlock' accordingly.  The behavior is
+    // undefined unless every stripe consumed is followed by more input.
+{
+    while (numStripes) {
+        const size_t remaining = k_STRIPES_PER_BLOCK - *numStripesInBlock;
+        const size_t count     = numStripes < remaining ? numStripes
+                                                        : remaining;
+        accumulate(accumulators,
+                   input,
+                   secret + *numStripesInBlock * 8,
+                   count);
+        input              += count * k_STRIPE_LENGTH;
+        numStripes         -= count;
+        *numStripesInBlock += count;
+        if (k_STRIPES_PER_BLOCK == *numStripesInBlock) {
+            scramble(accumulators, secret + k_SECRET_SIZE - k_STRIPE_LENGTH);
+            *numStripesInBlock = 0;
+        }
+    }
+}
+
+                         // ----------------------------
+                         // class bslh::XxHash3Algorithm
+                         // ----------------------------
+
+// PRIVATE MANIPULATORS
+void XxHash3Algorithm::consume(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT(k_BUFFER_LENGTH < d_bufferLength + numBytes);
+
+    if (!d_isLong) {
+        startLong();
+    }
+
+    const u8 *secret = d_seed ? d_secret : s_secret;
+
+    d_totalLength += numBytes;
+
+    if (d_bufferLength) {
+        const size_t fill = k_BUFFER_LENGTH - d_bufferLength;
+        memcpy(d_buffer + d_bufferLength, data, fill);
+        data     += fill;
+        numBytes -= fill;
+
+        consumeStripes(d_accumulators,
+                       &d_numStripes,
+                       d_buffer,
+                       k_BUFFER_LENGTH / k_STRIPE_LENGTH,
+                       secret);
+    }
+
+    if (k_BUFFER_LENGTH < numBytes) {
+        // Consume every stripe that is followed by more input directly from
+        // 'data', leaving between 1 and 'k_STRIPE_LENGTH' bytes to buffer.
+
+        const size_t numStripes = (numBytes - 1) / k_STRIPE_LENGTH;
+        consumeStripes(d_accumulators,
+                       &d_numStripes,
+                       data,
+                       numStripes,
+                       secret);
+        data     += numStripes * k_STRIPE_LENGTH;
+        numBytes -= numStripes * k_STRIPE_LENGTH;
+
+        memcpy(d_buffer + k_BUFFER_LENGTH - k_STRIPE_LENGTH,
+               data - k_STRIPE_LENGTH,
+               k_STRIPE_LENGTH);
+    }
+
+    memcpy(d_buffer, data, numBytes);
+    d_bufferLength = numBytes;
+}
+
+void XxHash3Algorithm::startLong()
+{
+    d_accumulators[0] = k_PRIME32_3;
+    d_accumulators[1] = k_PRIME64_1;
+    d_accumulators[2] = k_PRIME64_2;
+    d_accumulators[3] = k_PRIME64_3;
+    d_accumulators[4] = k_PRIME64_4;
+    d_accumulators[5] = k_PRIME32_2;
+    d_accumulators[6] = k_PRIME64_5;
+    d_accumulators[7] = k_PRIME32_1;
+
+    if (d_seed) {
+        for (int i = 0; i < k_SECRET_SIZE; i += 16) {
+            write64(d_secret + i,     read64(s_secret + i)     + d_seed);
+            write64(d_secret + i + 8, read64(s_secret + i + 8) - d_seed);
+        }
+    }
+
+    d_isLong = true;
+}
+
+// MANIPULATORS
+XxHash3Algorithm::result_type XxHash3Algorithm::computeHash()
+{
+    if (d_totalLength <= k_MIDSIZE_MAX) {
+        return hashShort(d_buffer, d_totalLength, d_seed);            // RETURN
+    }
+
+    if (!d_isLong) {
+        startLong();
+    }
+
+    const u8 *secret = d_seed ? d_secret : s_secret;
+
+    if (k_STRIPE_LENGTH <= d_bufferLength) {
+        consumeStripes(d_accumulators,
+                       &d_numStripes,
+                       d_buffer,
+                       (d_bufferLength - 1) / k_STRIPE_LENGTH,
+                       secret);
+        accumulate(d_accumulators,
+                   d_buffer + d_bufferLength - k_STRIPE_LENGTH,
+                   secret + k_LAST_STRIPE_OFFSET,
+                   1);
+    }
+    else {
+        // The last stripe of the input starts in the tail of the last
+        // consumed stripe, which is preserved at the end of the buffer.
+
+        u8           last[k_STRIPE_LENGTH];
+        const size_t tail = k_STRIPE_LENGTH - d_bufferLength;
+        memcpy(last, d_buffer + k_BUFFER_LENGTH - tail, tail);
+        memcpy(last + tail, d_buffer, d_bufferLength);
+        accumulate(d_accumulators, last, secret + k_LAST_STRIPE_OFFSET, 1);
+    }
+
+    u64 result = d_totalLength * k_PRIME64_1;
+    for (int i = 0; i < 4; ++i) {
+        result += multiplyFold(
+                   d_accumulators[2 * i]     ^ read64(secret + k_MERGE_OFFSET
+                                                             + 16 * i),
+                   d_accumulators[2 * i + 1] ^ read64(secret + k_MERGE_OFFSET
+                                                             + 16 * i + 8));
+    }
+    return avalanche(result);
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,320 @@
+// bslh_xxhash3algorithm.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLH_XXHASH3ALGORITHM
+#define INCLUDED_BSLH_XXHASH3ALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the 64-bit XXH3 (xxHash3) algorithm.
+//
+//@CLASSES:
+//  bslh::XxHash3Algorithm: functor implementing the 64-bit XXH3 algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_wyhashalgorithm, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::XxHash3Algorithm' implements the 64-bit variant of the
+// XXH3 algorithm from the xxHash family (version 0.8) by Yann Collet.  This is
+// a general purpose, non-cryptographic algorithm that selects a dedicated
+// code path for each range of key lengths: keys of up to 16 bytes are hashed
+// with a handful of multiplications, keys of up to 240 bytes are mixed 16
+// bytes at a time, and longer keys are consumed 64 bytes at a time by an
+// accumulator designed to be computed with vector instructions.  It is
+// therefore both fast on short keys and among the fastest available
+// algorithms on long keys.  For more information, see:
+// https://github.com/Cyan4973/xxHash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh'.
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::XxHash3Algorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm, even if they do not know
+// the seed.  If security is required, an algorithm that documents better
+// secure properties should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  On x86-64 platforms, keys longer than 240 bytes
+// are consumed using SSE2 instructions (which every x86-64 CPU supports).
+// Data passed to 'operator()' is buffered so that the result does not depend
+// on how the input is split; the buffer holds 256 bytes, making an object of
+// this type considerably larger than a 'bslh::WyHashAlgorithm', which should
+// be preferred when all keys are short.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  XXH3 passes the SMHasher test suite.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent: input is always read as
+// little-endian words, so the same sequence of bytes and the same seed
+// produce the same hash on every platform.  The hashes produced are identical
+// to those of 'XXH3_64bits_withSeed' from the canonical xxHash library
+// (version 0.8.0 or later, whose output is guaranteed to be stable), where the
+// seed is the 'k_SEED_LENGTH' bytes supplied at construction interpreted as a
+// little-endian 64-bit integer (or 0 for a default-constructed object).
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing a Message Body
+///- - - - - - - - - - - - - - - -
+// Suppose we cache responses keyed by the body of the request that produced
+// them, and that request bodies are received in several fragments.  We need a
+// hash of the whole body that does not depend on how it was fragmented.
+//
+// First, we create a body that is long enough to use the long-key path of the
+// algorithm:
+//..
+//  char body[1000];
+//  for (int i = 0; i < 1000; ++i) {
+//      body[i] = static_cast<char>('a' + i % 26);
+//  }
+//..
+// Then, we hash the body in a single call:
+//..
+//  bslh::XxHash3Algorithm wholeHasher;
+//  wholeHasher(body, sizeof body);
+//  bslh::XxHash3Algorithm::result_type wholeHash = wholeHasher.computeHash();
+//..
+// Next, we hash the same body delivered in fragments of 300 bytes:
+//..
+//  bslh::XxHash3Algorithm fragmentHasher;
+//  for (int offset = 0; offset < 1000; offset += 300) {
+//      const int length = offset + 300 < 1000 ? 300 : 1000 - offset;
+//      fragmentHasher(body + offset, length);
+//  }
+//..
+// Finally, we observe that the two hashes are the same:
+//..
+//  assert(wholeHash == fragmentHasher.computeHash());
+//..
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                         // ============================
+                         // class bslh::XxHash3Algorithm
+                         // ============================
+
+class XxHash3Algorithm {
+    // This class wraps an implementation of the 64-bit "XXH3" hash algorithm
+    // in an interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_BUFFER_LENGTH = 256,  // bytes of input buffered before stripes are
+                                // consumed
+
+        k_SECRET_LENGTH = 192   // length of the secret used to consume
+                                // stripes
+    };
+
+    // DATA
+    Uint64        d_accumulators[8];
+                              // accumulators of the long-key path; valid only
+                              // if 'd_isLong'
+
+    Uint64        d_seed;     // seed supplied at construction
+
+    size_t        d_totalLength;
+                              // total number of bytes passed to 'operator()'
+
+    size_t        d_bufferLength;
+                              // number of bytes in 'd_buffer' that have not
+                              // been consumed
+
+    size_t        d_numStripes;
+                              // number of stripes consumed in the current
+                              // block of the long-key path
+
+    bool          d_isLong;   // 'true' if any stripe has been consumed
+
+    unsigned char d_buffer[k_BUFFER_LENGTH];
+                              // input not yet consumed, followed, if
+                              // 'd_bufferLength < 64', by the tail of the
+                              // last consumed stripe
+
+    unsigned char d_secret[k_SECRET_LENGTH];
+                              // secret derived from 'd_seed'; valid only if
+                              // 'd_isLong' and '0 != d_seed'
+
+    // NOT IMPLEMENTED
+    XxHash3Algorithm(const XxHash3Algorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    XxHash3Algorithm& operator=(const XxHash3Algorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE MANIPULATORS
+    void consume(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', of the specified 'numBytes', into
+        // the internal state of this object, consuming every complete stripe
+        // that is known to be followed by more input and buffering the rest.
+        // The behavior is undefined unless
+        // 'k_BUFFER_LENGTH < d_bufferLength + numBytes'.
+
+    void startLong();
+        // Initialize the accumulators and, if this object is seeded, the
+        // secret of the long-key path.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CREATORS
+    XxHash3Algorithm();
+        // Create a 'bslh::XxHash3Algorithm' using a default initial seed.
+
+    explicit XxHash3Algorithm(const char *seed);
+        // Create a 'bslh::XxHash3Algorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behaviour is undefined unless
+        // 'seed' points to at least 8 bytes of initialized memory.
+
+    //! ~XxHash3Algorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// CREATORS
+inline
+XxHash3Algorithm::XxHash3Algorithm()
+: d_seed(0)
+, d_totalLength(0)
+, d_bufferLength(0)
+, d_numStripes(0)
+, d_isLong(false)
+{
+}
+
+inline
+XxHash3Algorithm::XxHash3Algorithm(const char *seed)
+: d_totalLength(0)
+, d_bufferLength(0)
+, d_numStripes(0)
+, d_isLong(false)
+{
+    BSLS_ASSERT(seed);
+
+    // Assemble the seed byte by byte to avoid unaligned reads and to produce
+    // the same hashes on all platforms.
+
+    Uint64 value = 0;
+    for (int i = k_SEED_LENGTH - 1; 0 <= i; --i) {
+        value = value << 8 | static_cast<unsigned char>(seed[i]);
+    }
+    d_seed = value;
+}
+
+// MANIPULATORS
+inline
+void XxHash3Algorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (d_bufferLength + numBytes <= k_BUFFER_LENGTH) {
+        // It is not yet known whether a full buffer will be followed by more
+        // input, so buffer the data; this is the only case for short keys.
+
+        if (numBytes) {
+            memcpy(d_buffer + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+            d_totalLength  += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    consume(static_cast<const unsigned char *>(data), numBytes);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::XxHash3Algorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2020 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -32,6 +32,7 @@ bslmt::ThreadAttributes::ThreadAttributes()
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
 , d_threadName(static_cast<bslma::Allocator *>(0))
+, d_cpuAffinity(static_cast<bslma::Allocator *>(0))
 {
 }
 
@@ -43,6 +44,7 @@ bslmt::ThreadAttributes::ThreadAttributes(bslma::Allocator *basicAllocator)
 , d_schedulingPriority(e_UNSET_PRIORITY)
 , d_stackSize(e_UNSET_STACK_SIZE)
 , d_threadName(basicAllocator)
+, d_cpuAffinity(basicAllocator)
 {
 }
 
@@ -57,6 +59,7 @@ bslmt::ThreadAttributes::ThreadAttributes(
 , d_schedulingPriority(original.d_schedulingPriority)
 , d_stackSize(original.d_stackSize)
 , d_threadName(original.d_threadName, basicAllocator)
+, d_cpuAffinity(original.d_cpuAffinity, basicAllocator)
 {
 }
 
@@ -71,6 +74,7 @@ bslmt::ThreadAttributes& bslmt::ThreadAttributes::operator=(
     d_schedulingPriority  = rhs.d_schedulingPriority;
     d_stackSize           = rhs.d_stackSize;
     d_threadName          = rhs.d_threadName;
+    d_cpuAffinity         = rhs.d_cpuAffinity;
 
     return *this;
 }
@@ -85,7 +89,8 @@ bool bslmt::operator==(const ThreadAttributes& lhs,
            lhs.schedulingPolicy()   == rhs.schedulingPolicy()   &&
            lhs.schedulingPriority() == rhs.schedulingPriority() &&
            lhs.stackSize()          == rhs.stackSize()          &&
-           lhs.threadName()         == rhs.threadName();
+           lhs.threadName()         == rhs.threadName()         &&
+           lhs.cpuAffinity()        == rhs.cpuAffinity();
 }
 
 bool bslmt::operator!=(const ThreadAttributes& lhs,
@@ -97,7 +102,8 @@ bool bslmt::operator!=(const ThreadAttributes& lhs,
            lhs.schedulingPolicy()   != rhs.schedulingPolicy()   ||
            lhs.schedulingPriority() != rhs.schedulingPriority() ||
            lhs.stackSize()          != rhs.stackSize()          ||
-           lhs.threadName()         != rhs.threadName();
+           lhs.threadName()         != rhs.threadName()         ||
+           lhs.cpuAffinity()        != rhs.cpuAffinity();
 }
 
 }  // close enterprise namespace
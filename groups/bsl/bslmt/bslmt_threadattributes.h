@@ -36,6 +36,7 @@ BSLS_IDENT("$Id: $")
 //  schedulingPolicy    enum SchedulingPolicy  e_SCHED_DEFAULT
 //  schedulingPriority  int                    e_UNSET_PRIORITY
 //  threadName          bsl::string            ""
+//  cpuAffinity         bsl::vector<int>       empty
 //
 //  Name          Constraint
 //  ---------     ---------------------------------------------------
@@ -130,6 +131,20 @@ BSLS_IDENT("$Id: $")
 // thread names, and there is a maximum thread name length of 15 on both of
 // those platforms.
 //
+///'cpuAffinity' Attribute
+///- - - - - - - - - - - -
+// The 'cpuAffinity' attribute is the set of (zero-based) indices of the
+// processors on which the created thread is allowed to run.  If 'cpuAffinity'
+// is empty (the default), the created thread inherits the affinity of its
+// parent thread.  Pinning a thread to the processors of a single NUMA node,
+// for example, lets it allocate and use node-local memory (see
+// 'bdlma_numaarenaallocator').  At this time, only Linux and Windows support
+// this attribute; it is ignored on other platforms.  On Linux, thread creation
+// fails if none of the specified processors is available to the process.  On
+// Windows, only processors having an index less than the number of bits in a
+// pointer are honored, and the affinity is applied just after the thread
+// starts.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -271,6 +286,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bsl_c_limits.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bslmt {
@@ -375,6 +391,9 @@ class ThreadAttributes {
 
     bsl::string      d_threadName;          // name of the thread
 
+    bsl::vector<int> d_cpuAffinity;         // processors on which the thread
+                                            // may run; empty if inherited
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(ThreadAttributes,
@@ -392,6 +411,7 @@ class ThreadAttributes {
         //: o 'schedulingPriority() == e_UNSET_PRIORITY'
         //: o 'stackSize()          == e_UNSET_STACK_SIZE'
         //: o 'threadName()         == ""'
+        //: o 'cpuAffinity()        == bsl::vector<int>()'
         // Optionally specify a 'basicAllocator' used to supply memory.  If
         // 'basicAllocator' is 0, the currently installed default allocator is
         // used.
@@ -409,6 +429,15 @@ class ThreadAttributes {
         // return a reference providing modifiable access to this object.
 
     // MANIPULATORS
+    void setCpuAffinity(const bsl::vector<int>& value);
+        // Set the 'cpuAffinity' attribute of this object to the specified
+        // 'value', the indices of the processors on which a created thread is
+        // allowed to run.  An empty 'value' (the default) indicates that the
+        // thread inherits the affinity of the thread that created it.  The
+        // behavior is undefined unless each element of 'value' is
+        // non-negative.  See {'cpuAffinity' Attribute} for information about
+        // support for this attribute.
+
     void setDetachedState(DetachedState value);
         // Set the 'detachedState' attribute of this object to the specified
         // 'value'.  A value of 'e_CREATE_JOINABLE' (the default) indicates
@@ -463,6 +492,11 @@ class ThreadAttributes {
         // 'value'.
 
     // ACCESSORS
+    const bsl::vector<int>& cpuAffinity() const;
+        // Return a reference providing non-modifiable access to the
+        // 'cpuAffinity' attribute of this object.  An empty result indicates
+        // that a thread inherits the affinity of the thread that created it.
+
     DetachedState detachedState() const;
         // Return the value of the 'detachedState' attribute of this object.  A
         // value of 'e_CREATE_JOINABLE' indicates that a thread must be joined
@@ -524,14 +558,16 @@ bool operator==(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // value, and 'false' otherwise.  Two 'ThreadAttributes' objects have the
     // same value if the corresponding values of their 'detachedState',
     // 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are the same.
+    // 'schedulingPriority', 'stackSize', 'threadName', and 'cpuAffinity'
+    // attributes are the same.
 
 bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
     // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
     // same value, and 'false' otherwise.  Two 'baltzo::LocalTimeDescriptor'
     // objects do not have the same value if the corresponding values of their
     // 'detachedState', 'guardSize', 'inheritSchedule', 'schedulingPolicy',
-    // 'schedulingPriority', and 'stackSize' attributes are not the same.
+    // 'schedulingPriority', 'stackSize', 'threadName', and 'cpuAffinity'
+    // attributes are not the same.
 
 }  // close package namespace
 
@@ -544,6 +580,12 @@ bool operator!=(const ThreadAttributes& lhs, const ThreadAttributes& rhs);
                           // ----------------------
 
 // MANIPULATORS
+inline
+void bslmt::ThreadAttributes::setCpuAffinity(const bsl::vector<int>& value)
+{
+    d_cpuAffinity = value;
+}
+
 inline
 void bslmt::ThreadAttributes::setDetachedState(
                                          ThreadAttributes::DetachedState value)
@@ -603,6 +645,12 @@ void bslmt::ThreadAttributes::setThreadName(const bslstl::StringRef& value)
 }
 
 // ACCESSORS
+inline
+const bsl::vector<int>& bslmt::ThreadAttributes::cpuAffinity() const
+{
+    return d_cpuAffinity;
+}
+
 inline
 bslmt::ThreadAttributes::DetachedState
 bslmt::ThreadAttributes::detachedState() const
@@ -24,6 +24,7 @@
 #include <bsl_cstdlib.h>
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLMT_PLATFORM_POSIX_THREADS
 #include <pthread.h>
@@ -318,7 +319,7 @@ int main(int argc, char *argv[])
         // ------------------------------------------------------------------
         // Testing Primary Manipulators / Accessors
         //
-        // For each of the 6 attributes of Attribute, set the attribute on a
+        // For each of the attributes of Attribute, set the attribute on a
         // newly constructed object, copy the object, and use the accessor for
         // that attribute to verify the value.
         // ------------------------------------------------------------------
@@ -465,6 +466,43 @@ int main(int argc, char *argv[])
             LOOP_ASSERT(PARAM[i].d_line,
                         PARAM[i].d_threadName == Z.threadName());
         }
+
+        if (verbose) cout << "Testing 'cpuAffinity'\n";
+        {
+            static const int CPUS[] = { 0, 3, 70 };
+
+            bsl::vector<int> cpus(CPUS, CPUS + sizeof CPUS / sizeof *CPUS);
+
+            Obj mX(&ta);    const Obj& X = mX;
+            ASSERT(X.cpuAffinity().empty());
+
+            const Obj W(&ta);
+            ASSERT(W == X);
+
+            mX.setCpuAffinity(cpus);
+            ASSERT(cpus == X.cpuAffinity());
+            ASSERT(W != X);
+            ASSERT(!(W == X));
+
+            Obj mY(&ta);    const Obj& Y = mY;
+            mY = X;
+            ASSERT(cpus == Y.cpuAffinity());
+            ASSERT(Y == X);
+
+            const Obj Z(X, &ta);
+            ASSERT(cpus == Z.cpuAffinity());
+            ASSERT(&ta == Z.cpuAffinity().get_allocator().mechanism());
+            ASSERT(Z == X);
+
+            cpus.pop_back();
+            mY.setCpuAffinity(cpus);
+            ASSERT(cpus == Y.cpuAffinity());
+            ASSERT(Y != X);
+
+            mY.setCpuAffinity(bsl::vector<int>());
+            ASSERT(Y.cpuAffinity().empty());
+            ASSERT(Y == W);
+        }
       } break;
       case 1: {
         // ------------------------------------------------------------------
@@ -494,6 +532,7 @@ int main(int argc, char *argv[])
         ASSERT(X.inheritSchedule());
         ASSERT(0 != X.stackSize());
         ASSERT("" == X.threadName());
+        ASSERT(X.cpuAffinity().empty());
       } break;
       case -1: {
         // --------------------------------------------------------------------
@@ -37,6 +37,7 @@
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_set.h>
+#include <bsl_vector.h>
 
 #include <errno.h>
 
@@ -49,6 +50,10 @@
 #   include <sys/utsname.h>
 # endif
 
+# ifdef BSLS_PLATFORM_OS_LINUX
+#   include <sched.h>     // 'sched_getaffinity'
+# endif
+
 #endif
 
 #ifndef BSLS_PLATFORM_OS_WINDOWS
@@ -420,6 +425,43 @@ void *allCreateTestFunction(void *arg)
 
 }  // close namespace BSLMT_THREADUTIL_ALL_CREATE_TEST
 
+//-----------------------------------------------------------------------------
+//                              CPU Affinity Test
+//-----------------------------------------------------------------------------
+
+namespace BSLMT_THREADUTIL_CPU_AFFINITY_TEST {
+
+void getCpuAffinity(bsl::vector<int> *result)
+    // Load into the specified 'result' the indices of the processors on which
+    // the calling thread is allowed to run, in increasing order, or load an
+    // empty vector if the affinity of a thread cannot be obtained on this
+    // platform.
+{
+    result->clear();
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (0 == sched_getaffinity(0, sizeof(cpuSet), &cpuSet)) {
+        for (int i = 0; i < CPU_SETSIZE; ++i) {
+            if (CPU_ISSET(i, &cpuSet)) {
+                result->push_back(i);
+            }
+        }
+    }
+#endif
+}
+
+extern "C" void *cpuAffinityThread(void *arg)
+    // Load the processor affinity of the calling thread into the
+    // 'bsl::vector<int>' addressed by the specified 'arg'.
+{
+    getCpuAffinity(static_cast<bsl::vector<int> *>(arg));
+    return 0;
+}
+
+}  // close namespace BSLMT_THREADUTIL_CPU_AFFINITY_TEST
+
 //-----------------------------------------------------------------------------
 //                             Unnamed Namespace
 //-----------------------------------------------------------------------------
@@ -1357,6 +1399,97 @@ int main(int argc, char *argv[])
 #endif
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING CPU AFFINITY
+        //
+        // Concerns:
+        //: 1 A thread created with an empty 'cpuAffinity' attribute inherits
+        //:   the affinity of the creating thread.
+        //:
+        //: 2 A thread created with a non-empty 'cpuAffinity' attribute runs
+        //:   only on the specified processors.
+        //:
+        //: 3 Processors having an index that cannot be represented by the
+        //:   platform are ignored.
+        //
+        // Plan:
+        //: 1 Create threads with and without the 'cpuAffinity' attribute and
+        //:   have each thread report the processors on which it may run.  On
+        //:   platforms where the affinity cannot be observed, verify only
+        //:   that the threads are created.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: 'ThreadAttributes::cpuAffinity' is honored
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING CPU AFFINITY\n"
+                             "====================\n";
+
+        using namespace BSLMT_THREADUTIL_CPU_AFFINITY_TEST;
+
+        bsl::vector<int> parentCpus;
+        getCpuAffinity(&parentCpus);
+
+        if (veryVerbose) { P(parentCpus.size()) }
+
+        {
+            Attr             attr;
+            bsl::vector<int> cpus;
+            Obj::Handle      handle;
+
+            ASSERT(0 == Obj::create(&handle,
+                                    attr,
+                                    &cpuAffinityThread,
+                                    &cpus));
+            ASSERT(0 == Obj::join(handle));
+            ASSERT(parentCpus == cpus);
+        }
+
+        const int CPU = parentCpus.empty() ? 0 : parentCpus.back();
+        {
+            Attr             attr;
+            bsl::vector<int> cpus;
+            Obj::Handle      handle;
+
+            attr.setCpuAffinity(bsl::vector<int>(1, CPU));
+
+            ASSERT(0 == Obj::create(&handle,
+                                    attr,
+                                    &cpuAffinityThread,
+                                    &cpus));
+            ASSERT(0 == Obj::join(handle));
+            if (!parentCpus.empty()) {
+                ASSERTV(CPU, cpus.size(), 1 == cpus.size());
+                ASSERTV(CPU, cpus.empty() || CPU == cpus[0]);
+            }
+        }
+
+        {
+            Attr             attr;
+            bsl::vector<int> cpus;
+            Obj::Handle      handle;
+
+            bsl::vector<int> affinity(1, CPU);
+            affinity.push_back(INT_MAX);
+            attr.setCpuAffinity(affinity);
+
+            ASSERT(0 == Obj::create(&handle,
+                                    attr,
+                                    &cpuAffinityThread,
+                                    &cpus));
+            ASSERT(0 == Obj::join(handle));
+            if (!parentCpus.empty()) {
+                ASSERTV(CPU, cpus.size(), 1 == cpus.size());
+            }
+        }
+
+        // The affinity of the creating thread is unaffected.
+
+        bsl::vector<int> cpus;
+        getCpuAffinity(&cpus);
+        ASSERT(parentCpus == cpus);
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING 'hardwareConcurrency'
@@ -44,6 +44,7 @@ BSLS_IDENT_RCSID(bslmt_threadutilimpl_pthread_cpp,"$Id$ $CSID$")
 #elif defined(BSLS_PLATFORM_OS_SOLARIS)
 # include <sys/utsname.h>
 #elif defined(BSLS_PLATFORM_OS_LINUX)
+# include <sched.h>        // 'cpu_set_t'
 # include <sys/prctl.h>
 #elif defined(BSLS_PLATFORM_OS_HPUX)
 # include <sys/mpctl.h>
@@ -193,6 +194,24 @@ static int initPthreadAttribute(pthread_attr_t                 *destination,
         rc |= pthread_attr_setstacksize(destination, stackSize);
     }
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    const bsl::vector<int>& cpus = src.cpuAffinity();
+    if (!cpus.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+            BSLS_ASSERT(0 <= cpus[i]);
+
+            if (cpus[i] < CPU_SETSIZE) {
+                CPU_SET(cpus[i], &cpuSet);
+            }
+        }
+        rc |= pthread_attr_setaffinity_np(destination,
+                                          sizeof(cpuSet),
+                                          &cpuSet);
+    }
+#endif
+
     return rc;
 }
 
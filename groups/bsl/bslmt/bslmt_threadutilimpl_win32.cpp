@@ -545,6 +545,23 @@ int bslmt::ThreadUtilImpl<bslmt::Platform::Win32Threads>::create(
         u::freeStartupInfo(startInfo);
         return 1;                                                     // RETURN
     }
+
+    const bsl::vector<int>& cpus = attribute.cpuAffinity();
+    if (!cpus.empty()) {
+        // Only the processors of the current processor group having an index
+        // below the width of 'DWORD_PTR' can be specified.
+
+        DWORD_PTR mask = 0;
+        for (bsl::size_t i = 0; i < cpus.size(); ++i) {
+            if (cpus[i] < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+                mask |= static_cast<DWORD_PTR>(1) << cpus[i];
+            }
+        }
+        if (mask) {
+            SetThreadAffinityMask(handle->d_handle, mask);
+        }
+    }
+
     if (ThreadAttributes::e_CREATE_DETACHED ==
                                                    attribute.detachedState()) {
         HANDLE tmpHandle = handle->d_handle;